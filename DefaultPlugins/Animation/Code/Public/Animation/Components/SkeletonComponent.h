@@ -23,6 +23,8 @@ namespace ngine::Animation
 
 		using BaseType = Component3D;
 		using InstanceIdentifier = TIdentifier<uint32, 11>;
+		//! Each skeleton only samples its own controller into its own instance, so skeletons can be updated concurrently
+		inline static constexpr bool EnableParallelUpdate = true;
 
 		struct Initializer : public BaseType::Initializer
 		{
@@ -2110,6 +2110,8 @@ namespace ngine::AssetCompiler::Compilers
 			Rendering::VertexTangents::Generate(indices, vertexPositions, vertexNormals, vertexTextureCoordinates, 180.0);
 
 		staticObject.CalculateAndSetBoundingBox();
+		staticObject.GenerateLevelsOfDetail();
+		staticObject.GenerateMeshlets();
 
 		bool success = true;
 		{
@@ -0,0 +1,376 @@
+#include "AssetCompilerCore/CompilationCache.h"
+
+#include <Common/Asset/Asset.h>
+#include <Common/IO/File.h>
+#include <Common/IO/FileIterator.h>
+#include <Common/Math/Min.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/FixedSizeVector.h>
+#include <Common/Serialization/SerializedData.h>
+
+namespace ngine::AssetCompiler
+{
+	//! Version of the manifest format
+	inline static constexpr uint32 ManifestVersion = 1;
+	inline static constexpr uint32 ReadChunkSize = 1024 * 1024;
+
+	//! 64-bit FNV-1a, chosen as it is stable across platforms and runs
+	struct ContentHasher
+	{
+		void Append(const ConstByteView data)
+		{
+			for (const ByteType byte : data)
+			{
+				m_hash ^= (uint64)byte;
+				m_hash *= 1099511628211ull;
+			}
+		}
+		template<typename Type>
+		void AppendValue(const Type& value)
+		{
+			Append(ConstByteView::Make(value));
+		}
+		template<typename StringViewType>
+		void AppendString(const StringViewType string)
+		{
+			AppendValue((uint32)string.GetSize());
+			Append(ConstByteView{reinterpret_cast<const ByteType*>(string.GetData()), string.GetDataSize()});
+		}
+
+		uint64 m_hash = 14695981039346656037ull;
+	};
+
+	[[nodiscard]] static IO::Path GetKeyFileName(const CompilationCache::Key key, const IO::PathView extension)
+	{
+		using CharType = IO::PathView::ConstStringViewType::CharType;
+		constexpr uint8 DigitCount = sizeof(CompilationCache::Key) * 2;
+		CharType characters[DigitCount];
+		for (uint8 digitIndex = 0; digitIndex < DigitCount; ++digitIndex)
+		{
+			const uint8 digit = (uint8)((key >> ((DigitCount - 1 - digitIndex) * 4)) & 0xF);
+			characters[digitIndex] = (CharType)(digit < 10 ? '0' + digit : 'a' + (digit - 10));
+		}
+		return IO::Path::Merge(IO::PathView{IO::PathView::ConstStringViewType{characters, DigitCount}}, extension);
+	}
+
+	[[nodiscard]] static bool ReadFile(const IO::PathView filePath, Vector<ByteType>& contentsOut)
+	{
+		const IO::File file(filePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite);
+		if (!file.IsValid())
+		{
+			return false;
+		}
+		contentsOut.Resize((uint32)file.GetSize());
+		return contentsOut.IsEmpty() || file.ReadIntoView(contentsOut.GetView());
+	}
+
+	template<typename Type>
+	[[nodiscard]] static bool ReadManifestValue(const ConstByteView manifest, uint32& offset, Type& valueOut)
+	{
+		if ((uint64)offset + sizeof(Type) > manifest.GetDataSize())
+		{
+			return false;
+		}
+		ByteView::Make(valueOut).CopyFrom(ConstByteView{manifest.GetData() + offset, sizeof(Type)});
+		offset += sizeof(Type);
+		return true;
+	}
+
+	[[nodiscard]] static bool WriteFile(const IO::PathView filePath, const ConstByteView contents)
+	{
+		const IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+		return file.IsValid() && file.Write(contents) == contents.GetDataSize();
+	}
+
+	CompilationCache::CompilationCache()
+		: m_directory(IO::Path::Combine(IO::Path::GetApplicationCacheDirectory(), MAKE_PATH("AssetCompilationCache")))
+	{
+	}
+
+	CompilationCache::CompilationCache(IO::Path&& directory)
+		: m_directory(Forward<IO::Path>(directory))
+	{
+	}
+
+	Optional<CompilationCache::Key> CompilationCache::ComputeKey(
+		const IO::PathView sourceFilePath,
+		const IO::PathView sourceFileExtension,
+		const Serialization::Data& assetData,
+		const EnumFlags<Platform::Type> platforms
+	)
+	{
+		ContentHasher hasher;
+		hasher.AppendValue(CompilerVersion);
+		for (const Platform::Type platform : platforms)
+		{
+			hasher.AppendValue(platform);
+		}
+		hasher.AppendString(sourceFileExtension.GetStringView());
+
+		// Compile options live in the metadata, hash it minified so formatting does not affect the key
+		const String metadata = assetData.SaveToBuffer<String>(Serialization::SavingFlags{});
+		hasher.AppendString(metadata.GetView());
+
+		const IO::File sourceFile(sourceFilePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite);
+		if (UNLIKELY(!sourceFile.IsValid()))
+		{
+			return Invalid;
+		}
+
+		uint64 remainingSize = (uint64)sourceFile.GetSize();
+		hasher.AppendValue(remainingSize);
+		FixedSizeVector<ByteType, uint32>
+			buffer(Memory::ConstructWithSize, Memory::Uninitialized, (uint32)Math::Min(remainingSize, (uint64)ReadChunkSize));
+		while (remainingSize > 0)
+		{
+			const uint32 chunkSize = (uint32)Math::Min(remainingSize, (uint64)ReadChunkSize);
+			const ArrayView<ByteType, uint32> chunk = buffer.GetView().GetSubView(0u, chunkSize);
+			if (UNLIKELY(!sourceFile.ReadIntoView(chunk)))
+			{
+				return Invalid;
+			}
+			hasher.Append(chunk);
+			remainingSize -= chunkSize;
+		}
+
+		return hasher.m_hash;
+	}
+
+	//! Gets the file name without its right-most extension, i.e. 'Brick.tex' for 'Brick.tex.nasset'
+	[[nodiscard]] static IO::PathView::ConstStringViewType GetFileStem(const IO::PathView filePath)
+	{
+		const IO::PathView::ConstStringViewType fileName = filePath.GetFileName().GetStringView();
+		const uint32 extensionSize = filePath.GetRightMostExtension().GetStringView().GetSize();
+		return fileName.GetSubstringUpTo(fileName.GetSize() - extensionSize);
+	}
+
+	[[nodiscard]] static bool IsOutputFileOf(const IO::PathView filePath, const IO::PathView metadataFilePath)
+	{
+		// Compare the full stem, only matching on the name without any extensions would include unrelated files such as 'Brick.png'
+		return filePath.GetRightMostExtension().HasElements() && GetFileStem(filePath) == GetFileStem(metadataFilePath);
+	}
+
+	Vector<IO::Path> CompilationCache::GetOutputFiles(const IO::PathView metadataFilePath, const IO::PathView sourceFilePath)
+	{
+		Vector<IO::Path> outputFiles;
+		outputFiles.EmplaceBack(IO::Path(metadataFilePath));
+
+		IO::FileIterator::TraverseDirectory(
+			IO::Path(metadataFilePath.GetParentPath()),
+			[&outputFiles, metadataFilePath, sourceFilePath](IO::Path&& filePath) -> IO::FileIterator::TraversalResult
+			{
+				if (filePath != metadataFilePath && filePath != sourceFilePath && IsOutputFileOf(filePath, metadataFilePath) &&
+			      filePath.IsFile())
+				{
+					outputFiles.EmplaceBack(Move(filePath));
+				}
+				return IO::FileIterator::TraversalResult::Continue;
+			}
+		);
+		return outputFiles;
+	}
+
+	IO::Path CompilationCache::GetEntryDirectory(const Key key) const
+	{
+		return IO::Path::Combine(m_directory, MAKE_PATH("Entries"), GetKeyFileName(key, {}));
+	}
+
+	IO::Path CompilationCache::GetManifestPath(const Key key) const
+	{
+		return IO::Path::Combine(m_directory, MAKE_PATH("Manifests"), GetKeyFileName(key, ManifestFileExtension));
+	}
+
+	IO::Path CompilationCache::GetStampPath(const IO::PathView metadataFilePath) const
+	{
+		ContentHasher hasher;
+		hasher.AppendString(metadataFilePath.GetStringView());
+		return IO::Path::Combine(m_directory, MAKE_PATH("Stamps"), GetKeyFileName(hasher.m_hash, StampFileExtension));
+	}
+
+	Optional<CompilationCache::Key> CompilationCache::GetStamp(const IO::PathView metadataFilePath) const
+	{
+		if (!IsEnabled())
+		{
+			return Invalid;
+		}
+
+		Vector<ByteType> contents;
+		if (!ReadFile(GetStampPath(metadataFilePath), contents) || contents.GetDataSize() != sizeof(Key))
+		{
+			return Invalid;
+		}
+		return *reinterpret_cast<const Key*>(contents.GetData());
+	}
+
+	void CompilationCache::SetStamp(const IO::PathView metadataFilePath, const Key key) const
+	{
+		if (IsEnabled())
+		{
+			const IO::Path stampPath = GetStampPath(metadataFilePath);
+			IO::Path(stampPath.GetParentPath()).CreateDirectories();
+			[[maybe_unused]] const bool wasWritten = WriteFile(stampPath, ConstByteView::Make(key));
+		}
+	}
+
+	bool CompilationCache::ReadManifest(const Key key, Key& entryKeyOut, Vector<IO::Path>& fileNamesOut) const
+	{
+		Vector<ByteType> manifest;
+		if (!IsEnabled() || !ReadFile(GetManifestPath(key), manifest))
+		{
+			return false;
+		}
+
+		// Manifest layout: version, entry key, file count, then the length and characters of each file name
+		using CharType = IO::PathView::ConstStringViewType::CharType;
+		uint32 offset = 0;
+		uint32 version;
+		uint32 fileCount;
+		if (!ReadManifestValue(manifest.GetView(), offset, version) || version != ManifestVersion ||
+		    !ReadManifestValue(manifest.GetView(), offset, entryKeyOut) || !ReadManifestValue(manifest.GetView(), offset, fileCount))
+		{
+			return false;
+		}
+
+		fileNamesOut.Reserve(fileCount);
+		for (uint32 fileIndex = 0; fileIndex < fileCount; ++fileIndex)
+		{
+			uint32 characterCount;
+			if (!ReadManifestValue(manifest.GetView(), offset, characterCount) ||
+			    (uint64)offset + characterCount * sizeof(CharType) > manifest.GetDataSize())
+			{
+				return false;
+			}
+			fileNamesOut.EmplaceBack(IO::Path(
+				IO::PathView{IO::PathView::ConstStringViewType{reinterpret_cast<const CharType*>(manifest.GetData() + offset), characterCount}}
+			));
+			offset += characterCount * sizeof(CharType);
+		}
+		return true;
+	}
+
+	bool CompilationCache::IsUpToDate(const Key key, const IO::PathView metadataFilePath) const
+	{
+		const Optional<Key> stamp = GetStamp(metadataFilePath);
+		return stamp.IsValid() && *stamp == key && HasOutputs(key, metadataFilePath);
+	}
+
+	bool CompilationCache::HasOutputs(const Key key, const IO::PathView metadataFilePath) const
+	{
+		Key entryKey;
+		Vector<IO::Path> fileNames;
+		if (!ReadManifest(key, entryKey, fileNames))
+		{
+			return false;
+		}
+
+		const IO::PathView targetDirectory = metadataFilePath.GetParentPath();
+		for (const IO::Path& fileName : fileNames)
+		{
+			if (!IO::Path::Combine(targetDirectory, fileName).Exists())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool CompilationCache::Restore(const Key key, const IO::PathView metadataFilePath) const
+	{
+		Key entryKey;
+		Vector<IO::Path> fileNames;
+		if (!ReadManifest(key, entryKey, fileNames))
+		{
+			return false;
+		}
+
+		const IO::Path entryDirectory = GetEntryDirectory(entryKey);
+		const IO::PathView targetDirectory = metadataFilePath.GetParentPath();
+		for (const IO::Path& fileName : fileNames)
+		{
+			// Entries are stored by name, identical inputs always produce identically named outputs
+			if (fileName != metadataFilePath.GetFileName() && !IsOutputFileOf(fileName, metadataFilePath))
+			{
+				return false;
+			}
+
+			if (!IO::Path::Combine(entryDirectory, fileName).CopyFileTo(IO::Path::Combine(targetDirectory, fileName)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool CompilationCache::Store(const ArrayView<const Key> keys, const IO::PathView metadataFilePath, const IO::PathView sourceFilePath) const
+	{
+		if (!IsEnabled() || keys.IsEmpty())
+		{
+			return false;
+		}
+
+		// Entries are immutable, a published key always describes identical outputs
+		bool hasAllKeys = true;
+		for (const Key key : keys)
+		{
+			hasAllKeys &= GetManifestPath(key).Exists();
+		}
+		if (hasAllKeys)
+		{
+			return true;
+		}
+
+		using CharType = IO::PathView::ConstStringViewType::CharType;
+		const Key entryKey = keys[0];
+		const IO::Path entryDirectory = GetEntryDirectory(entryKey);
+		entryDirectory.CreateDirectories();
+
+		const Vector<IO::Path> outputFiles = GetOutputFiles(metadataFilePath, sourceFilePath);
+		Vector<ByteType> manifest;
+		manifest.CopyEmplaceRangeBack(ConstByteView::Make(ManifestVersion));
+		manifest.CopyEmplaceRangeBack(ConstByteView::Make(entryKey));
+		manifest.CopyEmplaceRangeBack(ConstByteView::Make((uint32)outputFiles.GetSize()));
+		for (const IO::Path& outputFile : outputFiles)
+		{
+			const IO::PathView fileName = outputFile.GetFileName();
+			if (!outputFile.CopyFileTo(IO::Path::Combine(entryDirectory, fileName)))
+			{
+				return false;
+			}
+
+			const uint32 characterCount = fileName.GetStringView().GetSize();
+			manifest.CopyEmplaceRangeBack(ConstByteView::Make(characterCount));
+			manifest.CopyEmplaceRangeBack(
+				ConstByteView{reinterpret_cast<const ByteType*>(fileName.GetStringView().GetData()), characterCount * sizeof(CharType)}
+			);
+		}
+
+		// Manifests are published last and through a rename, so readers never observe partially written entries
+		bool storedAll = true;
+		for (const Key key : keys)
+		{
+			const IO::Path manifestPath = GetManifestPath(key);
+			IO::Path(manifestPath.GetParentPath()).CreateDirectories();
+			const IO::Path temporaryManifestPath = IO::Path::Merge(manifestPath, MAKE_PATH(".tmp"));
+			storedAll &= WriteFile(temporaryManifestPath, manifest.GetView()) && temporaryManifestPath.MoveFileTo(manifestPath);
+		}
+		return storedAll;
+	}
+
+	bool CompilationCache::StoreCompiled(
+		const Key compilationKey, const Key producedKey, const IO::PathView metadataFilePath, const IO::PathView sourceFilePath
+	) const
+	{
+		// Compilers that leave the metadata untouched produce the key they were compiled from
+		const Array<Key, 2> keys{compilationKey, producedKey};
+		const bool wasStored = producedKey != compilationKey ? Store(keys.GetView(), metadataFilePath, sourceFilePath)
+		                                                     : Store(ArrayView<const Key>{compilationKey}, metadataFilePath, sourceFilePath);
+		if (!wasStored)
+		{
+			return false;
+		}
+
+		SetStamp(metadataFilePath, producedKey);
+		return true;
+	}
+}
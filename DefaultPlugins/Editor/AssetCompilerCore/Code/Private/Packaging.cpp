@@ -28,6 +28,7 @@
 #include <Common/Threading/Jobs/Job.h>
 #include <Common/Threading/Jobs/JobRunnerThread.h>
 #include <Common/System/Query.h>
+#include <Engine/Asset/BinaryAssetDatabase.h>
 #include <AssetCompilerCore/Plugin.h>
 
 namespace ngine::ProjectSystem
@@ -209,11 +210,29 @@ namespace ngine::ProjectSystem
 			failedAnyTasksOut = true;
 		}
 
-		packagedBundle.AddAssetDatabase(
-			targetAssetDirectory.GetParentPath().GetRelativeToParent(buildDirectory),
-			targetAssetDirectory.GetParentPath(),
-			Asset::Database(database)
-		);
+		const IO::Path binaryAssetDatabasePath = Asset::BinaryDatabase::GetFilePath(targetAssetDirectory.GetParentPath(), database.GetGuid());
+		if (Asset::BinaryDatabase::Save(database, targetAssetDirectory.GetParentPath(), binaryAssetDatabasePath))
+		{
+			// Entries are loaded from the binary database at runtime, keep the bundle down to the database path and guid
+			Asset::Database bundledDatabase;
+			bundledDatabase.SetGuid(database.GetGuid());
+			packagedBundle.AddAssetDatabase(
+				targetAssetDirectory.GetParentPath().GetRelativeToParent(buildDirectory),
+				targetAssetDirectory.GetParentPath(),
+				Move(bundledDatabase)
+			);
+		}
+		else
+		{
+			LogError("Failed to save binary database {}", binaryAssetDatabasePath);
+			failedAnyTasksOut = true;
+
+			packagedBundle.AddAssetDatabase(
+				targetAssetDirectory.GetParentPath().GetRelativeToParent(buildDirectory),
+				targetAssetDirectory.GetParentPath(),
+				Asset::Database(database)
+			);
+		}
 
 		Assert(!context.GetEngine().IsValid() || context.GetEngine()->GetGuid().IsValid());
 
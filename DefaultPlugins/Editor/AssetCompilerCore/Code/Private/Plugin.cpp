@@ -45,6 +45,7 @@
 #include <Engine/Engine.h>
 #include <Engine/Project/Project.h>
 #include <Engine/Scene/Scene3DAssetType.h>
+#include <Engine/Entity/Scene/BinaryScene.h>
 #include <Engine/Asset/AssetManager.h>
 #include <Engine/Tag/TagRegistry.h>
 
@@ -184,6 +185,16 @@ namespace ngine::AssetCompiler
 			targetDirectory = IO::Path(pTargetDirectory->value.GetView());
 		}
 
+		if (commandLineArgs.HasArgument(MAKE_NATIVE_LITERAL("no_asset_cache"), CommandLine::Prefix::Minus))
+		{
+			m_compilationCache.Disable();
+		}
+		else if (OptionalIterator<const CommandLine::Argument> pCacheDirectory = commandLineArgs.FindArgument(MAKE_NATIVE_LITERAL("asset_cache_directory"), CommandLine::Prefix::Minus))
+		{
+			// Allows sharing compiled results between workspaces and machines through a common directory
+			m_compilationCache.SetDirectory(IO::Path(pCacheDirectory->value.GetView()));
+		}
+
 		EnumFlags<CompileFlags> compileFlags = AssetCompiler::CompileFlags::WasDirectlyRequested |
 		                                       AssetCompiler::CompileFlags::SaveHumanReadable;
 		compileFlags |= AssetCompiler::CompileFlags::ForceRecompile *
@@ -2128,6 +2139,103 @@ namespace ngine::AssetCompiler
 		}
 	}
 
+	namespace SceneAsset
+	{
+		[[nodiscard]] bool IsCompiledSceneUpToDate(const IO::Path& metadataFilePath)
+		{
+			const IO::Path compiledScenePath = Entity::BinaryScene::GetFilePath(metadataFilePath);
+			return compiledScenePath.Exists() && metadataFilePath.GetLastModifiedTime() <= compiledScenePath.GetLastModifiedTime();
+		}
+
+		[[nodiscard]] bool WriteCompiledScene(const Serialization::Data& assetData, const IO::Path& metadataFilePath)
+		{
+			Vector<ByteType> compiledScene;
+			if (UNLIKELY_ERROR(!Entity::BinaryScene::Compile(Serialization::Reader(assetData), compiledScene)))
+			{
+				return false;
+			}
+
+			const IO::File file(Entity::BinaryScene::GetFilePath(metadataFilePath), IO::AccessModeFlags::WriteBinary);
+			return file.IsValid() && file.Write(compiledScene.GetView()) == compiledScene.GetDataSize();
+		}
+
+		bool IsUpToDate(
+			const Platform::Type platform,
+			const Serialization::Data& assetData,
+			const Asset::Asset& asset,
+			const IO::Path& sourceFilePath,
+			const Asset::Context& context
+		)
+		{
+			return MetadataAsset::IsUpToDate(platform, assetData, asset, sourceFilePath, context) &&
+			       IsCompiledSceneUpToDate(asset.GetMetaDataFilePath());
+		}
+
+		//! Compiles the scene through its source asset or file first, then emits the flattened binary representation loaded at runtime
+		Threading::Job* Compile(
+			const EnumFlags<CompileFlags> flags,
+			CompileCallback&& callback,
+			Threading::JobRunnerThread& currentThread,
+			const AssetCompiler::Plugin& assetCompiler,
+			const EnumFlags<Platform::Type> platforms,
+			Serialization::Data&& assetData,
+			Asset::Asset&& asset,
+			const IO::Path& sourceFilePath,
+			const Asset::Context& context,
+			const Asset::Context& sourceContext
+		)
+		{
+			return MetadataAsset::Compile(
+				flags,
+				[callback = Forward<CompileCallback>(callback)](
+					const EnumFlags<CompileFlags> compileFlags,
+					ArrayView<Asset::Asset> assets,
+					ArrayView<const Serialization::Data> assetsData
+				) mutable
+				{
+					// Forward first, the callback saves the updated metadata which the binary scene has to be newer than
+					if (callback.IsValid())
+					{
+						callback(compileFlags, assets, assetsData);
+					}
+
+					if (!compileFlags.AreAnySet(CompileFlags::Compiled | CompileFlags::UpToDate))
+					{
+						return;
+					}
+
+					for (const Asset::Asset& compiledAsset : assets)
+					{
+						const IO::Path& metadataFilePath = compiledAsset.GetMetaDataFilePath();
+						if (!metadataFilePath.EndsWithExtensions(Scene3DAssetType::AssetFormat.metadataFileExtension))
+						{
+							continue;
+						}
+
+						if (compileFlags.IsNotSet(CompileFlags::Compiled) && IsCompiledSceneUpToDate(metadataFilePath))
+						{
+							continue;
+						}
+
+						const Serialization::Data& sceneData = assetsData[assets.GetIteratorIndex(&compiledAsset)];
+						if (UNLIKELY_ERROR(!WriteCompiledScene(sceneData, metadataFilePath)))
+						{
+							LogError("Failed to compile scene {}", metadataFilePath);
+						}
+					}
+				},
+				currentThread,
+				assetCompiler,
+				platforms,
+				Forward<Serialization::Data>(assetData),
+				Forward<Asset::Asset>(asset),
+				sourceFilePath,
+				context,
+				sourceContext
+			);
+		}
+	}
+
 	namespace DynamicTypeDefinitionAsset
 	{
 		Threading::Job* Compile(
@@ -2346,8 +2454,8 @@ namespace ngine::AssetCompiler
 		SourceFileFormat{
 			Scene3DAssetType::AssetFormat.metadataFileExtension,
 			Scene3DAssetType::AssetFormat,
-			MetadataAsset::Compile,
-			MetadataAsset::IsUpToDate,
+			SceneAsset::Compile,
+			SceneAsset::IsUpToDate,
 			MAKE_PATH(".fbx"),
 			Compilers::SceneObjectCompiler::Export
 		},
@@ -2892,6 +3000,16 @@ namespace ngine::AssetCompiler
 		}
 	}
 
+	//! Whether the compiled result of the format depends only on its source file and metadata
+	//! Other formats read further files that the cache key can't describe, such as shader includes or referenced assets
+	[[nodiscard]] static bool IsCompiledFromSourceFileOnly(const Asset::Format& assetFormat)
+	{
+		return assetFormat.assetTypeGuid == TextureAssetType::AssetFormat.assetTypeGuid ||
+		       assetFormat.assetTypeGuid == Audio::AssetFormat.assetTypeGuid || assetFormat.assetTypeGuid == FontFileFormat.assetTypeGuid ||
+		       assetFormat.assetTypeGuid == NetworkCertificateFileFormat.assetTypeGuid ||
+		       assetFormat.assetTypeGuid == Widgets::Style::ComputedStylesheet::CSSAssetFormat.assetTypeGuid;
+	}
+
 	Threading::Job* Plugin::CompileAsset(
 		const EnumFlags<CompileFlags> flags,
 		CompileCallback&& callback,
@@ -2907,13 +3025,48 @@ namespace ngine::AssetCompiler
 	{
 		Assert(sourceFilePath.IsAbsolute());
 
+		const EnumFlags<Platform::Type> requestedPlatforms = platforms;
+
+		// Only assets compiled purely from their own source file can be described by a content hash
+		const bool isCacheable = m_compilationCache.IsEnabled() && IsCompiledFromSourceFileOnly(sourceFileFormat.m_assetFormat) &&
+		                         sourceFileFormat.m_assetFormat.flags.IsNotSet(Asset::Format::Flags::IsCollection) &&
+		                         !asset.GetSourceAssetGuid().IsValid();
+		Optional<CompilationCache::Key> compilationKey;
+		if (isCacheable)
+		{
+			compilationKey = CompilationCache::ComputeKey(sourceFilePath, sourceFileFormat.sourceFileExtension, assetData, requestedPlatforms);
+		}
+
 		if (flags.IsNotSet(CompileFlags::ForceRecompile))
 		{
-			for (const Platform::Type platform : platforms)
+			Optional<CompilationCache::Key> stamp;
+			if (compilationKey.IsValid())
+			{
+				stamp = m_compilationCache.GetStamp(asset.GetMetaDataFilePath());
+			}
+
+			if (stamp.IsValid())
+			{
+				// Content hashes are authoritative once the outputs were stamped, timestamps are ignored
+				if (m_compilationCache.IsUpToDate(*compilationKey, asset.GetMetaDataFilePath()))
+				{
+					platforms = {};
+				}
+			}
+			else
 			{
-				if (sourceFileFormat.isUpToDateFunction(platform, assetData, asset, sourceFilePath, context))
+				for (const Platform::Type platform : platforms)
 				{
-					platforms &= ~platform;
+					if (sourceFileFormat.isUpToDateFunction(platform, assetData, asset, sourceFilePath, context))
+					{
+						platforms &= ~platform;
+					}
+				}
+
+				// Seed the cache with outputs that were compiled before it was in use
+				if (!platforms.AreAnySet() && compilationKey.IsValid())
+				{
+					m_compilationCache.StoreCompiled(*compilationKey, *compilationKey, asset.GetMetaDataFilePath(), sourceFilePath);
 				}
 			}
 		}
@@ -2937,96 +3090,131 @@ namespace ngine::AssetCompiler
 		}
 
 		const IO::Path mainAssetDirectory{asset.GetMetaDataFilePath().GetParentPath()};
-		return sourceFileFormat.compileFunction(
-			flags,
-			[callback = Forward<CompileCallback>(callback), mainAssetDirectory](
-				EnumFlags<CompileFlags> compileFlags,
-				const ArrayView<Asset::Asset> assets,
-				const ArrayView<const Serialization::Data> assetsData
-			)
+		auto onCompiled = [callback = Forward<CompileCallback>(callback),
+		                   mainAssetDirectory,
+		                   compilationKey,
+		                   sourceFileExtension = sourceFileFormat.sourceFileExtension,
+		                   sourceFilePath,
+		                   requestedPlatforms](
+			EnumFlags<CompileFlags> compileFlags,
+			const ArrayView<Asset::Asset> assets,
+			const ArrayView<const Serialization::Data> assetsData
+		)
+		{
+			Plugin& assetCompiler = *System::FindPlugin<Plugin>();
+			if (compileFlags.IsSet(CompileFlags::Compiled))
 			{
-				Plugin& assetCompiler = *System::FindPlugin<Plugin>();
-				if (compileFlags.IsSet(CompileFlags::Compiled))
+				for (Asset::Asset& asset : assets)
 				{
-					for (Asset::Asset& asset : assets)
+					const uint32 assetIndex = assets.GetIteratorIndex(Memory::GetAddressOf(asset));
+					const Serialization::Data& assetData = assetsData[assetIndex];
+					const EnumFlags<Serialization::SavingFlags> savingFlags = Serialization::SavingFlags::HumanReadable *
+				                                                            compileFlags.IsSet(CompileFlags::SaveHumanReadable);
+					if (assetData.SaveToFile(asset.GetMetaDataFilePath(), savingFlags))
 					{
-						const uint32 assetIndex = assets.GetIteratorIndex(Memory::GetAddressOf(asset));
-						const Serialization::Data& assetData = assetsData[assetIndex];
-						const EnumFlags<Serialization::SavingFlags> savingFlags = Serialization::SavingFlags::HumanReadable *
-					                                                            compileFlags.IsSet(CompileFlags::SaveHumanReadable);
-						if (assetData.SaveToFile(asset.GetMetaDataFilePath(), savingFlags))
+						const Asset::Owners assetOwners(asset.GetMetaDataFilePath(), Asset::Context());
+						const bool isNewAsset = !asset.GetMetaDataFilePath().Exists() ||
+					                          !assetCompiler.HasAssetInDatabase(asset.GetGuid(), assetOwners);
+						if (isNewAsset)
 						{
-							const Asset::Owners assetOwners(asset.GetMetaDataFilePath(), Asset::Context());
-							const bool isNewAsset = !asset.GetMetaDataFilePath().Exists() ||
-						                          !assetCompiler.HasAssetInDatabase(asset.GetGuid(), assetOwners);
-							if (isNewAsset)
+							if (assetOwners.HasOwner())
 							{
-								if (assetOwners.HasOwner())
+								const bool addedToDatabase =
+									assetCompiler.AddNewAssetToDatabase(Asset::DatabaseEntry{asset}, asset.GetGuid(), assetOwners, savingFlags);
+								if (UNLIKELY_ERROR(!addedToDatabase))
 								{
-									const bool addedToDatabase =
-										assetCompiler.AddNewAssetToDatabase(Asset::DatabaseEntry{asset}, asset.GetGuid(), assetOwners, savingFlags);
-									if (UNLIKELY_ERROR(!addedToDatabase))
-									{
-										compileFlags &= ~CompileFlags::Compiled;
-										LogError(
-											"Failed to add asset {} ({}) at {} to database",
-											asset.GetName(),
-											ngine::Guid(asset.GetGuid()),
-											asset.GetMetaDataFilePath()
-										);
-										continue;
-									}
+									compileFlags &= ~CompileFlags::Compiled;
+									LogError(
+										"Failed to add asset {} ({}) at {} to database",
+										asset.GetName(),
+										ngine::Guid(asset.GetGuid()),
+										asset.GetMetaDataFilePath()
+									);
+									continue;
 								}
-
-								assetCompiler.RegisterRuntimeAsset(asset, assetOwners);
 							}
+
+							assetCompiler.RegisterRuntimeAsset(asset, assetOwners);
 						}
-						else
+
+						// Key the result by both the inputs it was compiled from and the metadata it produced,
+						// as compilation commonly writes back into the metadata
+						if (compilationKey.IsValid() && assets.GetSize() == 1)
 						{
-							LogError("Failed to save asset {} ({}) to {}", asset.GetName(), ngine::Guid(asset.GetGuid()), asset.GetMetaDataFilePath());
-							compileFlags &= ~CompileFlags::Compiled;
+							if (const Optional<CompilationCache::Key> producedKey =
+							      CompilationCache::ComputeKey(sourceFilePath, sourceFileExtension, assetData, requestedPlatforms))
+							{
+								assetCompiler.m_compilationCache.StoreCompiled(*compilationKey, *producedKey, asset.GetMetaDataFilePath(), sourceFilePath);
+							}
 						}
 					}
-				}
-				else if (compileFlags.IsSet(CompileFlags::IsCollection))
-				{
-					for (Asset::Asset& asset : assets)
+					else
 					{
-						if (asset.GetGuid().IsValid())
-						{
-							const Asset::Owners assetOwners(asset.GetMetaDataFilePath(), Asset::Context());
-							assetCompiler.RegisterRuntimeAsset(asset, assetOwners);
-						}
+						LogError("Failed to save asset {} ({}) to {}", asset.GetName(), ngine::Guid(asset.GetGuid()), asset.GetMetaDataFilePath());
+						compileFlags &= ~CompileFlags::Compiled;
 					}
 				}
-				else if (compileFlags.IsSet(CompileFlags::UpToDate))
-					;
-				else if (compileFlags.IsSet(CompileFlags::UnsupportedOnPlatform))
-					;
-				else if (assets.HasElements())
+			}
+			else if (compileFlags.IsSet(CompileFlags::IsCollection))
+			{
+				for (Asset::Asset& asset : assets)
 				{
-					for (Asset::Asset& asset : assets)
+					if (asset.GetGuid().IsValid())
 					{
-						LogError("Failed to compile asset {} ({})", asset.GetName(), ngine::Guid(asset.GetGuid()));
+						const Asset::Owners assetOwners(asset.GetMetaDataFilePath(), Asset::Context());
+						assetCompiler.RegisterRuntimeAsset(asset, assetOwners);
 					}
-					compileFlags &= ~CompileFlags::Compiled;
-				}
-				else
-				{
-					LogError("Failed to compile unknown asset");
-					compileFlags &= ~CompileFlags::Compiled;
 				}
-
+			}
+			else if (compileFlags.IsSet(CompileFlags::UpToDate))
+				;
+			else if (compileFlags.IsSet(CompileFlags::UnsupportedOnPlatform))
+				;
+			else if (assets.HasElements())
+			{
 				for (Asset::Asset& asset : assets)
 				{
-					assetCompiler.OnAssetFinishedCompilingInternal(asset.GetGuid());
+					LogError("Failed to compile asset {} ({})", asset.GetName(), ngine::Guid(asset.GetGuid()));
 				}
+				compileFlags &= ~CompileFlags::Compiled;
+			}
+			else
+			{
+				LogError("Failed to compile unknown asset");
+				compileFlags &= ~CompileFlags::Compiled;
+			}
 
-				if (callback.IsValid())
-				{
-					callback(compileFlags, assets, assetsData);
-				}
-			},
+			for (Asset::Asset& asset : assets)
+			{
+				assetCompiler.OnAssetFinishedCompilingInternal(asset.GetGuid());
+			}
+
+			if (callback.IsValid())
+			{
+				callback(compileFlags, assets, assetsData);
+			}
+		};
+
+		// Identical inputs were compiled before, restore the results instead of invoking the compiler
+		if (flags.IsNotSet(CompileFlags::ForceRecompile) && compilationKey.IsValid() &&
+		    m_compilationCache.Restore(*compilationKey, asset.GetMetaDataFilePath()))
+		{
+			Serialization::Data restoredAssetData(asset.GetMetaDataFilePath());
+			if (restoredAssetData.IsValid())
+			{
+				Asset::Asset restoredAsset(restoredAssetData, IO::Path(asset.GetMetaDataFilePath()));
+				onCompiled(
+					flags | CompileFlags::Compiled,
+					ArrayView<Asset::Asset>{restoredAsset},
+					ArrayView<const Serialization::Data>{restoredAssetData}
+				);
+				return nullptr;
+			}
+		}
+
+		return sourceFileFormat.compileFunction(
+			flags,
+			Move(onCompiled),
 			currentThread,
 			*this,
 			platforms,
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Common/Platform/Type.h>
+#include <Common/EnumFlags.h>
+#include <Common/IO/Path.h>
+#include <Common/IO/PathView.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Serialization/ForwardDeclarations/SerializedData.h>
+
+namespace ngine::Asset
+{
+	struct Asset;
+}
+
+namespace ngine::AssetCompiler
+{
+	//! Persistent local cache of compiled asset outputs, keyed by a hash of the source content, compiler version and compile options
+	//! Staleness is decided by comparing content hashes instead of timestamps, and a hit restores the outputs without compiling
+	//! The directory can be shared between machines, as entries are only ever added and are published atomically
+	struct CompilationCache
+	{
+		//! Increment whenever compiler output changes, invalidating all previously cached results
+		static constexpr uint32 CompilerVersion = 1;
+
+		inline static constexpr IO::PathView ManifestFileExtension = MAKE_PATH(".nccache");
+		inline static constexpr IO::PathView StampFileExtension = MAKE_PATH(".nccstamp");
+
+		using Key = uint64;
+
+		//! Creates the cache in the default per-user cache directory
+		CompilationCache();
+		explicit CompilationCache(IO::Path&& directory);
+
+		[[nodiscard]] bool IsEnabled() const
+		{
+			return m_directory.HasElements();
+		}
+		[[nodiscard]] IO::PathView GetDirectory() const
+		{
+			return m_directory;
+		}
+		void SetDirectory(IO::Path&& directory)
+		{
+			m_directory = Forward<IO::Path>(directory);
+		}
+		void Disable()
+		{
+			m_directory = {};
+		}
+
+		//! Hashes everything that affects the compiled result of an asset
+		[[nodiscard]] static Optional<Key> ComputeKey(
+			const IO::PathView sourceFilePath,
+			const IO::PathView sourceFileExtension,
+			const Serialization::Data& assetData,
+			const EnumFlags<Platform::Type> platforms
+		);
+
+		//! Gets the files produced by compiling the asset, the metadata file first
+		//! Outputs share the metadata's full name including the type extension, e.g. 'Brick.tex.bc' for 'Brick.tex.nasset'
+		//! The source file is never considered an output, even when it matches that name
+		[[nodiscard]] static Vector<IO::Path> GetOutputFiles(const IO::PathView metadataFilePath, const IO::PathView sourceFilePath);
+
+		//! Gets the key of the inputs that the asset's current outputs were produced from
+		[[nodiscard]] Optional<Key> GetStamp(const IO::PathView metadataFilePath) const;
+		//! Records that the asset's current outputs were produced from the inputs described by the key
+		void SetStamp(const IO::PathView metadataFilePath, const Key key) const;
+
+		//! Whether the asset was stamped with the key and the outputs cached under it are all present next to the asset's metadata
+		[[nodiscard]] bool IsUpToDate(const Key key, const IO::PathView metadataFilePath) const;
+		//! Whether the outputs cached under the key are all present next to the asset's metadata
+		[[nodiscard]] bool HasOutputs(const Key key, const IO::PathView metadataFilePath) const;
+		//! Copies previously cached outputs next to the asset's metadata
+		[[nodiscard]] bool Restore(const Key key, const IO::PathView metadataFilePath) const;
+		//! Stores the asset's current outputs, making them available under all of the specified keys
+		bool Store(const ArrayView<const Key> keys, const IO::PathView metadataFilePath, const IO::PathView sourceFilePath) const;
+		//! Stores the outputs of a finished compilation under the key it was compiled from and the key of the metadata it produced
+		//! The asset is only stamped with the produced key once the outputs were stored, so stamps always refer to stored entries
+		bool StoreCompiled(
+			const Key compilationKey, const Key producedKey, const IO::PathView metadataFilePath, const IO::PathView sourceFilePath
+		) const;
+	protected:
+		[[nodiscard]] IO::Path GetEntryDirectory(const Key key) const;
+		[[nodiscard]] IO::Path GetManifestPath(const Key key) const;
+		[[nodiscard]] IO::Path GetStampPath(const IO::PathView metadataFilePath) const;
+		[[nodiscard]] bool ReadManifest(const Key key, Key& entryKeyOut, Vector<IO::Path>& fileNamesOut) const;
+	protected:
+		IO::Path m_directory;
+	};
+}
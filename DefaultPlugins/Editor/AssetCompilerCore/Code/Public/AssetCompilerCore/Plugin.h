@@ -1,5 +1,7 @@
 #pragma once
 
+#include <AssetCompilerCore/CompilationCache.h>
+
 #include <Common/Plugin/Plugin.h>
 #include <Common/Platform/Type.h>
 #include <Common/EnumFlags.h>
@@ -306,6 +308,8 @@ namespace ngine::AssetCompiler
 
 		mutable Threading::Mutex m_currentlyCompilingAssetsLock;
 		mutable UnorderedSet<Asset::Guid, Asset::Guid::Hash> m_currentlyCompilingAssets;
+
+		CompilationCache m_compilationCache;
 	};
 
 	ENUM_FLAG_OPERATORS(CompileFlags);
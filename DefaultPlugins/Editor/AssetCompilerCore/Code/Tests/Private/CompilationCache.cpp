@@ -0,0 +1,215 @@
+#include <Common/Memory/New.h>
+
+#include "gtest/gtest.h"
+
+#include <AssetCompilerCore/CompilationCache.h>
+
+#include <Common/IO/File.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Serialization/SerializedData.h>
+
+namespace ngine::Tests
+{
+	static void WriteTestFile(const IO::PathView filePath, const ConstStringView contents)
+	{
+		const IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+		ASSERT_TRUE(file.IsValid());
+		EXPECT_EQ(file.Write(ConstByteView{reinterpret_cast<const ByteType*>(contents.GetData()), contents.GetSize()}), contents.GetSize());
+	}
+
+	[[nodiscard]] static String ReadTestFile(const IO::PathView filePath)
+	{
+		const IO::File file(filePath, IO::AccessModeFlags::ReadBinary);
+		if (!file.IsValid())
+		{
+			return {};
+		}
+		Vector<ByteType> contents(Memory::ConstructWithSize, Memory::Uninitialized, (uint32)file.GetSize());
+		if (!file.ReadIntoView(contents.GetView()))
+		{
+			return {};
+		}
+		return String(ConstStringView{reinterpret_cast<const char*>(contents.GetData()), contents.GetSize()});
+	}
+
+	[[nodiscard]] static bool ContainsFile(const ArrayView<const IO::Path> files, const IO::PathView filePath)
+	{
+		for (const IO::Path& file : files)
+		{
+			if (file == filePath)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	struct CompilationCacheTestDirectories
+	{
+		CompilationCacheTestDirectories(const IO::PathView name)
+			: m_rootDirectory(IO::Path::Combine(IO::Path::GetTemporaryDirectory(), name))
+			, m_assetDirectory(IO::Path::Combine(m_rootDirectory, MAKE_PATH("Assets")))
+			, m_cacheDirectory(IO::Path::Combine(m_rootDirectory, MAKE_PATH("Cache")))
+		{
+			if (m_rootDirectory.Exists())
+			{
+				m_rootDirectory.EmptyDirectoryRecursively();
+			}
+			m_assetDirectory.CreateDirectories();
+			m_cacheDirectory.CreateDirectories();
+		}
+		~CompilationCacheTestDirectories()
+		{
+			m_rootDirectory.EmptyDirectoryRecursively();
+			m_rootDirectory.RemoveDirectory();
+		}
+
+		IO::Path m_rootDirectory;
+		IO::Path m_assetDirectory;
+		IO::Path m_cacheDirectory;
+	};
+
+	TEST(CompilationCache, OutputFilesMatchFullName)
+	{
+		const CompilationCacheTestDirectories directories(MAKE_PATH("CompilationCacheOutputFiles"));
+		const IO::Path metadataPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.nasset"));
+		const IO::Path bcPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.bc"));
+		const IO::Path astcPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.astc"));
+		const IO::Path sourcePath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.png"));
+		const IO::Path otherTypePath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.mtl.nasset"));
+		const IO::Path otherAssetPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Wall.tex.bc"));
+		WriteTestFile(metadataPath, "{}");
+		WriteTestFile(bcPath, "bc");
+		WriteTestFile(astcPath, "astc");
+		WriteTestFile(sourcePath, "png");
+		WriteTestFile(otherTypePath, "{}");
+		WriteTestFile(otherAssetPath, "bc");
+
+		const Vector<IO::Path> outputFiles = AssetCompiler::CompilationCache::GetOutputFiles(metadataPath, sourcePath);
+		ASSERT_EQ(outputFiles.GetSize(), 3u);
+		EXPECT_TRUE(outputFiles[0] == metadataPath);
+		EXPECT_TRUE(ContainsFile(outputFiles.GetView(), bcPath));
+		EXPECT_TRUE(ContainsFile(outputFiles.GetView(), astcPath));
+
+		// The source is excluded even if it shares the metadata's full name
+		const IO::Path untypedMetadataPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.nasset"));
+		WriteTestFile(untypedMetadataPath, "{}");
+		const Vector<IO::Path> untypedOutputFiles = AssetCompiler::CompilationCache::GetOutputFiles(untypedMetadataPath, sourcePath);
+		ASSERT_EQ(untypedOutputFiles.GetSize(), 1u);
+		EXPECT_TRUE(untypedOutputFiles[0] == untypedMetadataPath);
+	}
+
+	TEST(CompilationCache, StoreAndRestore)
+	{
+		const CompilationCacheTestDirectories directories(MAKE_PATH("CompilationCacheStoreAndRestore"));
+		const AssetCompiler::CompilationCache cache{IO::Path(directories.m_cacheDirectory)};
+		ASSERT_TRUE(cache.IsEnabled());
+
+		const IO::Path metadataPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.nasset"));
+		const IO::Path bcPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.bc"));
+		const IO::Path sourcePath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.png"));
+		WriteTestFile(metadataPath, "{\"compiled\": true}");
+		WriteTestFile(bcPath, "compressed");
+		WriteTestFile(sourcePath, "png");
+
+		constexpr AssetCompiler::CompilationCache::Key key = 0x1234'5678'9ABC'DEF0ull;
+		constexpr AssetCompiler::CompilationCache::Key producedKey = 0x0FED'CBA9'8765'4321ull;
+		EXPECT_FALSE(cache.HasOutputs(key, metadataPath));
+		EXPECT_FALSE(cache.Restore(key, metadataPath));
+
+		const Array<AssetCompiler::CompilationCache::Key, 2> keys{key, producedKey};
+		EXPECT_TRUE(cache.Store(keys.GetView(), metadataPath, sourcePath));
+		EXPECT_TRUE(cache.HasOutputs(key, metadataPath));
+
+		cache.SetStamp(metadataPath, producedKey);
+		const Optional<AssetCompiler::CompilationCache::Key> stamp = cache.GetStamp(metadataPath);
+		ASSERT_TRUE(stamp.IsValid());
+		EXPECT_EQ(*stamp, producedKey);
+
+		// Losing the outputs is detected, and both keys restore them
+		EXPECT_TRUE(bcPath.RemoveFile());
+		EXPECT_TRUE(sourcePath.RemoveFile());
+		EXPECT_FALSE(cache.HasOutputs(key, metadataPath));
+		EXPECT_TRUE(cache.Restore(producedKey, metadataPath));
+		EXPECT_TRUE(cache.HasOutputs(key, metadataPath));
+		EXPECT_TRUE(ReadTestFile(bcPath) == ConstStringView("compressed"));
+		EXPECT_TRUE(ReadTestFile(metadataPath) == ConstStringView("{\"compiled\": true}"));
+
+		// The source file is never part of an entry
+		EXPECT_FALSE(sourcePath.Exists());
+
+		// A disabled cache never stores nor restores
+		AssetCompiler::CompilationCache disabledCache{IO::Path(directories.m_cacheDirectory)};
+		disabledCache.Disable();
+		EXPECT_FALSE(disabledCache.Restore(key, metadataPath));
+		EXPECT_FALSE(disabledCache.GetStamp(metadataPath).IsValid());
+	}
+
+	TEST(CompilationCache, RecompileWithUnchangedMetadataHitsCache)
+	{
+		const CompilationCacheTestDirectories directories(MAKE_PATH("CompilationCacheUnchangedMetadata"));
+		const AssetCompiler::CompilationCache cache{IO::Path(directories.m_cacheDirectory)};
+
+		const IO::Path metadataPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.nasset"));
+		const IO::Path bcPath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.tex.bc"));
+		const IO::Path sourcePath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.png"));
+		WriteTestFile(metadataPath, "{\"quality\": 1}");
+		WriteTestFile(sourcePath, "png");
+		const Serialization::Data assetData(ConstStringView("{\"quality\": 1}"));
+		const EnumFlags<Platform::Type> platforms = Platform::Type::Windows;
+
+		// First compilation leaves the metadata untouched, so it produces the key it was compiled from
+		const Optional<AssetCompiler::CompilationCache::Key> key =
+			AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms);
+		ASSERT_TRUE(key.IsValid());
+		EXPECT_FALSE(cache.IsUpToDate(*key, metadataPath));
+		WriteTestFile(bcPath, "compressed");
+		const Optional<AssetCompiler::CompilationCache::Key> producedKey =
+			AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms);
+		ASSERT_TRUE(producedKey.IsValid());
+		EXPECT_EQ(*producedKey, *key);
+		EXPECT_TRUE(cache.StoreCompiled(*key, *producedKey, metadataPath, sourcePath));
+
+		// Second compilation with identical inputs is a cache hit
+		const Optional<AssetCompiler::CompilationCache::Key> secondKey =
+			AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms);
+		ASSERT_TRUE(secondKey.IsValid());
+		EXPECT_TRUE(cache.IsUpToDate(*secondKey, metadataPath));
+		EXPECT_TRUE(cache.HasOutputs(*secondKey, metadataPath));
+
+		// Changed inputs miss
+		WriteTestFile(sourcePath, "changed png");
+		const Optional<AssetCompiler::CompilationCache::Key> changedKey =
+			AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms);
+		ASSERT_TRUE(changedKey.IsValid());
+		EXPECT_FALSE(cache.IsUpToDate(*changedKey, metadataPath));
+	}
+
+	TEST(CompilationCache, KeyDependsOnInputs)
+	{
+		const CompilationCacheTestDirectories directories(MAKE_PATH("CompilationCacheKey"));
+		const IO::Path sourcePath = IO::Path::Combine(directories.m_assetDirectory, MAKE_PATH("Brick.png"));
+		WriteTestFile(sourcePath, "first");
+
+		const Serialization::Data assetData(ConstStringView("{\"quality\": 1}"));
+		const Serialization::Data changedAssetData(ConstStringView("{\"quality\": 2}"));
+		const EnumFlags<Platform::Type> platforms = Platform::Type::Windows;
+
+		const Optional<AssetCompiler::CompilationCache::Key> key =
+			AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms);
+		ASSERT_TRUE(key.IsValid());
+		EXPECT_EQ(*AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms), *key);
+
+		// Compile options, target platforms and source content all contribute
+		EXPECT_NE(*AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), changedAssetData, platforms), *key);
+		EXPECT_NE(*AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, Platform::Type::Android), *key);
+		WriteTestFile(sourcePath, "second");
+		EXPECT_NE(*AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms), *key);
+
+		// Missing sources can't be hashed
+		EXPECT_TRUE(sourcePath.RemoveFile());
+		EXPECT_FALSE(AssetCompiler::CompilationCache::ComputeKey(sourcePath, MAKE_PATH(".png"), assetData, platforms).IsValid());
+	}
+}
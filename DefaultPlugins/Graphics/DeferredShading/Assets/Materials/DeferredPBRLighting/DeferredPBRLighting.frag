@@ -172,6 +172,7 @@ struct Mesh
     uint64_t vertexNormalsBufferAddress;
     uint64_t vertexTextureCoordinatesBufferAddress;
     uint64_t indicesBufferAddress;
+    uint64_t halfPrecisionTextureCoordinates;
 };
 
 struct MaterialInstance
@@ -196,6 +197,49 @@ layout(std140, binding = 0, set = 3) buffer readonly MeshesBuffer
 } meshesBuffer;
 #endif
 
+// Raytraced lighting keeps its own descriptor layout and iterates the tile ranges instead
+#define CLUSTERED_LIGHTS RASTERIZED_SHADOWS
+
+#if CLUSTERED_LIGHTS
+#if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+const uint lastLightBindingIndex = lastCubemapBindingIndex + 4;
+#else
+const uint lastLightBindingIndex = lastCubemapBindingIndex + 3;
+#endif
+
+layout(std430, binding = lastLightBindingIndex + 1) buffer readonly LightClustersBuffer
+{
+	vec4 tanHalfFieldOfViewAndDepthRange;
+	// Cluster light indices below the point light count refer to point lights, the remaining ones to spot lights
+	uvec4 gridSizeAndPointLightCount;
+	// First light index and light count of each cluster
+	uvec2 clusters[];
+} lightClustersBuffer;
+
+layout(std430, binding = lastLightBindingIndex + 2) buffer readonly LightClusterIndicesBuffer
+{
+	uint indices[];
+} lightClusterIndicesBuffer;
+
+uvec2 getLightCluster(const vec3 fragPos)
+{
+	// Clusters are built in the camera's local space with depth moved to z
+	const vec3 localFrag = viewInfo.current.invertedViewRotation * (fragPos - viewInfo.current.viewLocationAndTime.xyz);
+	const vec3 clusterPosition = localFrag.xzy;
+	const vec4 tanHalfFieldOfViewAndDepthRange = lightClustersBuffer.tanHalfFieldOfViewAndDepthRange;
+	const uvec3 gridSize = lightClustersBuffer.gridSizeAndPointLightCount.xyz;
+
+	const float depth = max(clusterPosition.z, tanHalfFieldOfViewAndDepthRange.z);
+	const vec2 coordinate = clusterPosition.xy / (depth * tanHalfFieldOfViewAndDepthRange.xy);
+	const uvec2 tile = uvec2(clamp(ivec2(floor((coordinate * 0.5 + 0.5) * vec2(gridSize.xy))), ivec2(0), ivec2(gridSize.xy) - 1));
+
+	// Slices are distributed exponentially between the near and far plane
+	const float sliceCoordinate = log(depth / tanHalfFieldOfViewAndDepthRange.z) / log(tanHalfFieldOfViewAndDepthRange.w / tanHalfFieldOfViewAndDepthRange.z);
+	const uint slice = uint(clamp(int(floor(sliceCoordinate * float(gridSize.z))), 0, int(gridSize.z) - 1));
+	return lightClustersBuffer.clusters[(slice * gridSize.y + tile.y) * gridSize.x + tile.x];
+}
+#endif
+
 #define PI 3.1415926535897932384626433832795
 
 #define USE_PCF (!RENDERER_WEBGPU)
@@ -491,6 +535,8 @@ vec3 RandomInUnitSphere(const uint seed)
 }
 
 layout(buffer_reference, scalar) buffer VertexNormals {vec4 normals[]; };
+// Texture coordinates are stored as two packed half floats, or as two floats for meshes that need the precision
+layout(buffer_reference, scalar) buffer HalfVertexTextureCoordinates {uint textureCoordinates[]; };
 layout(buffer_reference, scalar) buffer VertexTextureCoordinates {vec2 textureCoordinates[]; };
 layout(buffer_reference, scalar) buffer Indices {uint indices[]; };
 
@@ -503,12 +549,21 @@ RayHitMaterialInfo GetRayHitMaterialInfo(const uint renderItemIndex, const uint
 
 	 Indices indices = Indices(mesh.indicesBufferAddress);
 	 VertexNormals vertexNormals = VertexNormals(mesh.vertexNormalsBufferAddress);
-	 VertexTextureCoordinates vertexTextureCoordinates = VertexTextureCoordinates(mesh.vertexTextureCoordinatesBufferAddress);
 
 	 const uint baseVertexIndex = triangleIndex * 3;
 	 uvec3 vertexIndices = uvec3(indices.indices[baseVertexIndex + 0], indices.indices[baseVertexIndex + 1], indices.indices[baseVertexIndex + 2]);
 
-	 vec2 meshTextureCoordinates = Mix(vertexTextureCoordinates.textureCoordinates[vertexIndices[0]], vertexTextureCoordinates.textureCoordinates[vertexIndices[1]], vertexTextureCoordinates.textureCoordinates[vertexIndices[2]], barycentrics);
+	 vec2 meshTextureCoordinates;
+	 if (mesh.halfPrecisionTextureCoordinates != 0)
+	 {
+		 HalfVertexTextureCoordinates vertexTextureCoordinates = HalfVertexTextureCoordinates(mesh.vertexTextureCoordinatesBufferAddress);
+		 meshTextureCoordinates = Mix(unpackHalf2x16(vertexTextureCoordinates.textureCoordinates[vertexIndices[0]]), unpackHalf2x16(vertexTextureCoordinates.textureCoordinates[vertexIndices[1]]), unpackHalf2x16(vertexTextureCoordinates.textureCoordinates[vertexIndices[2]]), barycentrics);
+	 }
+	 else
+	 {
+		 VertexTextureCoordinates vertexTextureCoordinates = VertexTextureCoordinates(mesh.vertexTextureCoordinatesBufferAddress);
+		 meshTextureCoordinates = Mix(vertexTextureCoordinates.textureCoordinates[vertexIndices[0]], vertexTextureCoordinates.textureCoordinates[vertexIndices[1]], vertexTextureCoordinates.textureCoordinates[vertexIndices[2]], barycentrics);
+	 }
 	 vec3 meshNormal = Mix(vertexNormals.normals[vertexIndices[0]].rgb, vertexNormals.normals[vertexIndices[1]].rgb, vertexNormals.normals[vertexIndices[2]].rgb, barycentrics);
 
 	 /*const vec3 hitLocation = rayOrigin + rayDirection * distance;
@@ -597,8 +652,6 @@ void main()
 
 	outColor.rgb = vec3(0, 0, 0);
 
-	// TODO: Change to cluster
-	// Just need to figure out depth index
 	const ivec2 clusterTexCoord = ivec2(inTexCoord * textureSize(usampler2D(tilesTexture, tilesSampler), 0));
 	const uvec4 clusterData = texelFetch(usampler2D(tilesTexture, tilesSampler), clusterTexCoord, 0);
 
@@ -607,8 +660,28 @@ void main()
 	const uint pointLightRange = clusterData.r;
 	const uint firstPointLightIndex = pointLightRange & 0xFFFF;
 	const uint endPointLightIndex = pointLightRange >> 16;
+#if CLUSTERED_LIGHTS
+	// Clusters list their point lights first, followed by their spot lights
+	const uvec2 lightCluster = getLightCluster(fragPos);
+	const uint endClusterLightIndex = lightCluster.x + lightCluster.y;
+	const uint clusteredPointLightCount = lightClustersBuffer.gridSizeAndPointLightCount.w;
+	uint clusterLightIndex = lightCluster.x;
+	for(; clusterLightIndex != endClusterLightIndex; ++clusterLightIndex)
+	{
+		const uint lightIndex = lightClusterIndicesBuffer.indices[clusterLightIndex];
+		if(lightIndex >= clusteredPointLightCount)
+		{
+			break;
+		}
+		// Lights can be removed after the clusters were built
+		if(lightIndex >= endPointLightIndex)
+		{
+			continue;
+		}
+#else
 	for(uint lightIndex = firstPointLightIndex; lightIndex != endPointLightIndex; ++lightIndex)
 	{
+#endif
 		vec3 l = pointLightBuffer.lights[lightIndex].positionAndInfluenceRadius.xyz - fragPos.rgb;
 
 		// Distance from light to fragment position
@@ -662,8 +735,18 @@ void main()
 	const uint spotLightRange = clusterData.g;
 	const uint firstSpotLightIndex = spotLightRange & 0xFFFF;
 	const uint endSpotLightIndex = spotLightRange >> 16;
+#if CLUSTERED_LIGHTS
+	for(; clusterLightIndex != endClusterLightIndex; ++clusterLightIndex)
+	{
+		const uint lightIndex = lightClusterIndicesBuffer.indices[clusterLightIndex] - clusteredPointLightCount;
+		if(lightIndex >= endSpotLightIndex)
+		{
+			continue;
+		}
+#else
 	for(uint lightIndex = firstSpotLightIndex; lightIndex != endSpotLightIndex; ++lightIndex)
 	{
+#endif
 		const vec4 clip = spotLightBuffer.lights[lightIndex].viewMatrix * vec4(fragPos.rgb, 1.0);
 		const vec4 coordinate = clip / clip.w;
 
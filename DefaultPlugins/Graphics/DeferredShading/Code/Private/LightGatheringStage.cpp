@@ -102,15 +102,19 @@ namespace ngine::Rendering
 				}
 
 				const Entity::LightSourceComponent& light = pVisibleComponent->AsExpected<Entity::LightSourceComponent>();
+				const LightTypes lightType = GetLightType(light);
+				LightContainer& typeVisibleLights = m_visibleLights[(uint8)lightType];
+				m_visibleLightSlots[Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)] =
+					VisibleLightSlot{lightType, typeVisibleLights.GetSize()};
 #if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
-				m_visibleLights[(uint8)GetLightType(light)].EmplaceBack(VisibleLight{-1, 0, 0, light});
+				typeVisibleLights.EmplaceBack(VisibleLight{-1, 0, 0, light});
 #else
-				m_visibleLights[(uint8)GetLightType(light)].EmplaceBack(VisibleLight{-1, 0, light});
+				typeVisibleLights.EmplaceBack(VisibleLight{-1, 0, light});
 #endif
 				m_sceneView.GetSubmittedRenderItemStageMask(Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)).Set(stageIdentifier);
 			}
 
-			UpdateLightBuffer();
+			AssignShadowMaps();
 			return true;
 		}
 		else
@@ -167,69 +171,80 @@ namespace ngine::Rendering
 				m_sceneView.GetSceneChecked()->GetMaximumUsedRenderItemCount();
 			for (const uint32 renderItemIndex : removedLightsMask.GetSetBitsIterator(0, maximumUsedRenderItemCount))
 			{
-				for (LightContainer& typeVisibleLights : m_visibleLights)
+				const VisibleLightSlot slot = m_visibleLightSlots[Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)];
+				const LightTypes lightType = slot.m_type;
+				LightContainer& typeVisibleLights = m_visibleLights[(uint8)lightType];
+				VisibleLight& visibleLight = typeVisibleLights[slot.m_index];
+				Assert(visibleLight.light->GetRenderItemIdentifier().GetFirstValidIndex() == renderItemIndex);
+
+				const int32 shadowMapIndex = visibleLight.shadowMapIndex;
+				if (shadowMapIndex != -1)
 				{
-					const LightTypes lightType = (LightTypes)m_visibleLights.GetIteratorIndex(&typeVisibleLights);
-					for (auto it = typeVisibleLights.begin(), endIt = typeVisibleLights.end(); it != endIt; ++it)
+					const ShadowMapIndexType shadowMapCount = [](const LightTypes lightType, const VisibleLight& light) -> ShadowMapIndexType
 					{
-						if (it->light->GetRenderItemIdentifier().GetFirstValidIndex() == renderItemIndex)
+						switch (lightType)
 						{
-							const int32 shadowMapIndex = it->shadowMapIndex;
-							if (shadowMapIndex != -1)
-							{
-								const ShadowMapIndexType shadowMapCount = [](const LightTypes lightType, const VisibleLight& light) -> ShadowMapIndexType
-								{
-									switch (lightType)
-									{
-										case LightTypes::SpotLight:
-										case LightTypes::DirectionalLight:
-											return light.cascadeCount;
-										case LightTypes::PointLight:
-											return 6;
-										case LightTypes::EnvironmentLight:
-										case LightTypes::Count:
-											ExpectUnreachable();
-									}
-									ExpectUnreachable();
-								}(lightType, *it);
-								m_visibleShadowCastingLights.Remove(
-									m_visibleShadowCastingLights.GetSubView((ShadowMapIndexType)shadowMapIndex, shadowMapCount)
-								);
-								m_visibleShadowCastingLightIdentifiers.Remove(
-									m_visibleShadowCastingLightIdentifiers.GetSubView((ShadowMapIndexType)shadowMapIndex, shadowMapCount)
-								);
-
-								// Update shadow map indices if we end up shifting the array
-								for (LightContainer& lights : m_visibleLights)
-								{
-									for (VisibleLight& light : lights)
-									{
-										if (light.shadowMapIndex > shadowMapIndex)
-										{
-											light.shadowMapIndex--;
-										}
-									}
-								}
-
-								if (lightType == LightTypes::DirectionalLight)
-								{
-									m_parallelShadowMapsIndices.Remove(
-										m_parallelShadowMapsIndices.GetSubView((ShadowMapIndexType)it->directionalShadowMatrixIndex, it->cascadeCount)
-									);
-								}
-							}
-
-							typeVisibleLights.Remove(it);
-
-							break;
+							case LightTypes::SpotLight:
+							case LightTypes::DirectionalLight:
+								return light.cascadeCount;
+							case LightTypes::PointLight:
+								return 6;
+							case LightTypes::EnvironmentLight:
+							case LightTypes::Count:
+								ExpectUnreachable();
 						}
+						ExpectUnreachable();
+					}(lightType, visibleLight);
+					m_visibleShadowCastingLights.Remove(m_visibleShadowCastingLights.GetSubView((ShadowMapIndexType)shadowMapIndex, shadowMapCount));
+					m_visibleShadowCastingLightIdentifiers.Remove(
+						m_visibleShadowCastingLightIdentifiers.GetSubView((ShadowMapIndexType)shadowMapIndex, shadowMapCount)
+					);
+
+					// Only the lights whose shadow maps followed the removed ones shift, found through the bounded shadow map identifiers
+					const ArrayView<const Entity::RenderItemIdentifier, ShadowMapIndexType> shadowCastingLightIdentifiers =
+						m_visibleShadowCastingLightIdentifiers.GetView();
+					for (ShadowMapIndexType index = (ShadowMapIndexType)shadowMapIndex, count = shadowCastingLightIdentifiers.GetSize(); index < count;
+					     ++index)
+					{
+						const Entity::RenderItemIdentifier shadowCastingLightIdentifier = shadowCastingLightIdentifiers[index];
+						if (index == shadowMapIndex || shadowCastingLightIdentifiers[index - 1] != shadowCastingLightIdentifier)
+						{
+							const VisibleLightSlot shiftedSlot = m_visibleLightSlots[shadowCastingLightIdentifier];
+							m_visibleLights[(uint8)shiftedSlot.m_type][shiftedSlot.m_index].shadowMapIndex = index;
+						}
+					}
+
+#if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+					if (lightType == LightTypes::DirectionalLight)
+					{
+						m_parallelShadowMapsIndices.Remove(
+							m_parallelShadowMapsIndices.GetSubView((ShadowMapIndexType)visibleLight.directionalShadowMatrixIndex, visibleLight.cascadeCount)
+						);
 					}
+					for (uint32& parallelShadowMapIndex : m_parallelShadowMapsIndices)
+					{
+						if (parallelShadowMapIndex > (uint32)shadowMapIndex)
+						{
+							parallelShadowMapIndex -= shadowMapCount;
+						}
+					}
+#endif
+				}
+
+				// Swap the last light of the type into the freed slot so removal stays constant time
+				const uint32 lastIndex = typeVisibleLights.GetSize() - 1;
+				if (slot.m_index != lastIndex)
+				{
+					visibleLight = Move(typeVisibleLights[lastIndex]);
+					m_visibleLightSlots[visibleLight.light->GetRenderItemIdentifier()].m_index = slot.m_index;
 				}
+				typeVisibleLights.PopBack();
 			}
 
 			m_visibleLightsMask.Clear(renderItems);
 
-			UpdateLightBuffer();
+			// Hand the freed shadow maps to lights that didn't get one
+			AssignShadowMaps();
 			return true;
 		}
 		else
@@ -240,26 +255,23 @@ namespace ngine::Rendering
 
 	void LightGatheringStage::OnVisibleRenderItemTransformsChanged(const Entity::RenderItemMask& renderItems)
 	{
-		bool encounteredLights = false;
+		if (!CanRasterizeShadows())
+		{
+			return;
+		}
 
+		// Only the moved lights need new shadow matrices, the others are unaffected
+		const Entity::RenderItemMask changedLightsMask = m_visibleLightsMask & renderItems;
 		const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount =
 			m_sceneView.GetSceneChecked()->GetMaximumUsedRenderItemCount();
-		for (const uint32 renderItemIndex : renderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
+		for (const uint32 renderItemIndex : changedLightsMask.GetSetBitsIterator(0, maximumUsedRenderItemCount))
 		{
-			const Optional<Entity::HierarchyComponentBase*> pVisibleComponent =
-				m_sceneView.GetVisibleRenderItemComponent(Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex));
-			Assert(pVisibleComponent.IsValid());
-			if (UNLIKELY_ERROR(pVisibleComponent.IsInvalid()))
+			const VisibleLightSlot slot = m_visibleLightSlots[Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)];
+			VisibleLight& visibleLight = m_visibleLights[(uint8)slot.m_type][slot.m_index];
+			if (visibleLight.shadowMapIndex != -1)
 			{
-				continue;
+				UpdateShadowMatrices(visibleLight, slot.m_type);
 			}
-
-			encounteredLights |= pVisibleComponent->IsLight();
-		}
-
-		if (encounteredLights)
-		{
-			UpdateLightBuffer();
 		}
 	}
 
@@ -272,276 +284,326 @@ namespace ngine::Rendering
 		m_visibleLightsMask.ClearAll();
 		m_numDirectionalShadowingCastingLight = 0;
 		m_visibleShadowCastingLights.Clear();
+		m_visibleShadowCastingLightIdentifiers.Clear();
 		m_parallelShadowMapsIndices.Clear();
 	}
 
 	void LightGatheringStage::OnActiveCameraPropertiesChanged()
 	{
-		UpdateLightBuffer();
+#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+		// Spot and point light shadows don't depend on the camera, only the directional cascades are fitted to its frustum
+		if (CanRasterizeShadows())
+		{
+			for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::DirectionalLight])
+			{
+				if (light.shadowMapIndex != -1)
+				{
+					UpdateDirectionalLightCascades(light);
+				}
+			}
+		}
+#endif
 	}
 
 	Optional<const VisibleLight*> LightGatheringStage::GetVisibleLightInfo(const Entity::LightSourceComponent& light) const
 	{
-		if(OptionalIterator<const VisibleLight> pVisibleLight = m_visibleLights[(uint8)GetLightType(light)].FindIf(
-		       [&light](const VisibleLight& visibleLight)
-		       {
-			       return visibleLight.light == light;
-		       }
-		   ))
+		const Entity::RenderItemIdentifier renderItemIdentifier = light.GetRenderItemIdentifier();
+		if (m_visibleLightsMask.IsSet(renderItemIdentifier))
 		{
-			return *pVisibleLight;
+			const VisibleLightSlot slot = m_visibleLightSlots[renderItemIdentifier];
+			return m_visibleLights[(uint8)slot.m_type][slot.m_index];
 		}
 
 		return Invalid;
 	}
 
-	void LightGatheringStage::UpdateLightBuffer()
+	bool LightGatheringStage::CanRasterizeShadows() const
 	{
-		if (m_pShadowsStage.IsValid() && m_pShadowsStage->GetState() == ShadowsStage::State::Rasterized)
-		{
-			// TODO: Detect which light or camera changed, and only update that.
+		return m_pShadowsStage.IsValid() && m_pShadowsStage->GetState() == ShadowsStage::State::Rasterized;
+	}
 
-			constexpr Math::Matrix4x4f biasMatrix =
-				Math::Matrix4x4f{0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.5f, 0.5f, 0.0f, 1.0f};
+	static constexpr Math::Matrix4x4f ShadowSampleBiasMatrix =
+		Math::Matrix4x4f{0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.5f, 0.5f, 0.0f, 1.0f};
 
-			for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::SpotLight])
-			{
-				const Entity::SpotLightComponent& spotLight = static_cast<const Entity::SpotLightComponent&>(*light.light);
-
-				const Math::WorldTransform worldTransform = spotLight.GetWorldTransform();
-				const Math::Matrix4x4f projection = Math::Matrix4x4f::CreatePerspective(
-					spotLight.GetFieldOfView(),
-					1.f,
-					spotLight.GetNearPlane().GetMeters(),
-					spotLight.GetInfluenceRadius().GetMeters()
-				);
-				const Math::Matrix4x4f lookAt = Math::Matrix4x4f::CreateLookAt(
-					worldTransform.GetLocation(),
-					worldTransform.GetLocation() + worldTransform.GetForwardColumn(),
-					worldTransform.GetUpColumn()
-				);
-				const Math::Matrix4x4f viewProjectionMatrix = lookAt * projection;
-
-				light.shadowSampleViewProjectionMatrices[0] = viewProjectionMatrix * biasMatrix;
-
-				if (light.shadowMapIndex == -1)
-				{
-					if (m_visibleShadowCastingLights.ReachedCapacity())
-					{
-						continue;
-					}
+	[[nodiscard]] static Math::Matrix4x4f GetSpotLightViewProjectionMatrix(const Entity::SpotLightComponent& spotLight)
+	{
+		const Math::WorldTransform worldTransform = spotLight.GetWorldTransform();
+		const Math::Matrix4x4f projection = Math::Matrix4x4f::CreatePerspective(
+			spotLight.GetFieldOfView(),
+			1.f,
+			spotLight.GetNearPlane().GetMeters(),
+			spotLight.GetInfluenceRadius().GetMeters()
+		);
+		const Math::Matrix4x4f lookAt = Math::Matrix4x4f::CreateLookAt(
+			worldTransform.GetLocation(),
+			worldTransform.GetLocation() + worldTransform.GetForwardColumn(),
+			worldTransform.GetUpColumn()
+		);
+		return lookAt * projection;
+	}
 
-					light.cascadeCount = 1;
-					light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
-					m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{viewProjectionMatrix});
-					m_visibleShadowCastingLightIdentifiers.EmplaceBack(spotLight.GetRenderItemIdentifier());
-				}
-				else
+	[[nodiscard]] static Math::Matrix4x4f GetPointLightViewProjectionMatrix(const Entity::PointLightComponent& pointLight, const uint8 cubemapIndex)
+	{
+		const Math::Matrix4x4f projection =
+			Math::Matrix4x4f::CreatePerspective(90_degrees, 1.f, 0.1f, pointLight.GetInfluenceRadius().GetMeters());
+		const Math::WorldCoordinate position = pointLight.GetWorldLocation();
+
+		switch (cubemapIndex)
+		{
+			case 0:
+				return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Right}, Math::Vector3f{Math::Up}) * projection;
+			case 1:
+				return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Right}, Math::Vector3f{Math::Up}) * projection;
+			case 2:
+				return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Forward}, Math::Vector3f{Math::Up}) * projection;
+			case 3:
+				return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Forward}, Math::Vector3f{Math::Up}) * projection;
+			case 4:
+				return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Up}, Math::Vector3f{Math::Backward}) * projection;
+			case 5:
+				return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Up}, Math::Vector3f{Math::Forward}) * projection;
+			default:
+				ExpectUnreachable();
+		}
+	}
+
+	void LightGatheringStage::UpdateShadowMatrices(VisibleLight& light, const LightTypes lightType)
+	{
+		Assert(light.shadowMapIndex != -1);
+		switch (lightType)
+		{
+			case LightTypes::SpotLight:
+			{
+				const Math::Matrix4x4f viewProjectionMatrix =
+					GetSpotLightViewProjectionMatrix(static_cast<const Entity::SpotLightComponent&>(*light.light));
+				light.shadowSampleViewProjectionMatrices[0] = viewProjectionMatrix * ShadowSampleBiasMatrix;
+				m_visibleShadowCastingLights[(ShadowMapIndexType)light.shadowMapIndex] = ShadowInfo{viewProjectionMatrix};
+			}
+			break;
+			case LightTypes::PointLight:
+			{
+				const Entity::PointLightComponent& pointLight = static_cast<const Entity::PointLightComponent&>(*light.light);
+				for (uint8 i = 0; i < 6; ++i)
 				{
-					m_visibleShadowCastingLights[(ShadowMapIndexType)light.shadowMapIndex] = ShadowInfo{viewProjectionMatrix};
+					const Math::Matrix4x4f viewProjection = GetPointLightViewProjectionMatrix(pointLight, i);
+					light.shadowSampleViewProjectionMatrices[i] = viewProjection * ShadowSampleBiasMatrix;
+					m_visibleShadowCastingLights[ShadowMapIndexType(light.shadowMapIndex + i)] = ShadowInfo{viewProjection};
 				}
 			}
+			break;
+			case LightTypes::DirectionalLight:
+			{
+#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+				UpdateDirectionalLightCascades(light);
+#endif
+			}
+			break;
+			case LightTypes::EnvironmentLight:
+			case LightTypes::Count:
+				ExpectUnreachable();
+		}
+	}
+
+	void LightGatheringStage::AssignShadowMaps()
+	{
+		if (!CanRasterizeShadows())
+		{
+			return;
+		}
 
-			for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::PointLight])
+		for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::SpotLight])
+		{
+			if (m_visibleShadowCastingLights.ReachedCapacity())
 			{
-				const Entity::PointLightComponent& pointLight = static_cast<const Entity::PointLightComponent&>(*light.light);
-				const Math::Matrix4x4f projection =
-					Math::Matrix4x4f::CreatePerspective(90_degrees, 1.f, 0.1f, pointLight.GetInfluenceRadius().GetMeters());
-				const Math::WorldCoordinate position = pointLight.GetWorldLocation();
+				break;
+			}
 
-				auto getLookAtMatrix = [position](const uint8 cubemapIndex)
-				{
-					switch (cubemapIndex)
-					{
-						case 0:
-							return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Right}, Math::Vector3f{Math::Up});
-						case 1:
-							return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Right}, Math::Vector3f{Math::Up});
-						case 2:
-							return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Forward}, Math::Vector3f{Math::Up});
-						case 3:
-							return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Forward}, Math::Vector3f{Math::Up});
-						case 4:
-							return Math::Matrix4x4f::CreateLookAt(position, position + Math::Vector3f{Math::Up}, Math::Vector3f{Math::Backward});
-						case 5:
-							return Math::Matrix4x4f::CreateLookAt(position, position - Math::Vector3f{Math::Up}, Math::Vector3f{Math::Forward});
-						default:
-							ExpectUnreachable();
-					}
-				};
+			if (light.shadowMapIndex == -1)
+			{
+				light.cascadeCount = 1;
+				light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
+				m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{});
+				m_visibleShadowCastingLightIdentifiers.EmplaceBack(light.light->GetRenderItemIdentifier());
+				UpdateShadowMatrices(light, LightTypes::SpotLight);
+			}
+		}
 
-				if (light.shadowMapIndex == -1)
-				{
-					if (m_visibleShadowCastingLights.GetRemainingCapacity() < 6)
-					{
-						continue;
-					}
+		for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::PointLight])
+		{
+			if (m_visibleShadowCastingLights.GetRemainingCapacity() < 6)
+			{
+				break;
+			}
 
-					light.cascadeCount = 1;
-					light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
+			if (light.shadowMapIndex == -1)
+			{
+				light.cascadeCount = 1;
+				light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
 
-					const Entity::RenderItemIdentifier renderItemIdentifier = pointLight.GetRenderItemIdentifier();
-					for (uint8 i = 0; i < 6; ++i)
-					{
-						Math::Matrix4x4f viewProjection = getLookAtMatrix(i) * projection;
-						light.shadowSampleViewProjectionMatrices[i] = viewProjection * biasMatrix;
-						m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{viewProjection});
-						m_visibleShadowCastingLightIdentifiers.EmplaceBack(renderItemIdentifier);
-					}
-				}
-				else
+				const Entity::RenderItemIdentifier renderItemIdentifier = light.light->GetRenderItemIdentifier();
+				for (uint8 i = 0; i < 6; ++i)
 				{
-					for (uint8 i = 0; i < 6; ++i)
-					{
-						Math::Matrix4x4f viewProjection = getLookAtMatrix(i) * projection;
-						light.shadowSampleViewProjectionMatrices[i] = viewProjection * biasMatrix;
-						m_visibleShadowCastingLights[ShadowMapIndexType(light.shadowMapIndex + i)] = ShadowInfo{viewProjection};
-					}
+					m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{});
+					m_visibleShadowCastingLightIdentifiers.EmplaceBack(renderItemIdentifier);
 				}
+				UpdateShadowMatrices(light, LightTypes::PointLight);
 			}
+		}
 
-#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
-			const Entity::CameraComponent& activeCamera = m_sceneView.GetActiveCameraComponent();
-			const float nearPlane = activeCamera.GetNearPlane().GetUnits();
-			const float clipRange = activeCamera.GetDepthRange().GetUnits();
+		DirectionalLightIndexType numDirectionalShadowingCastingLight = 0;
+		for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::DirectionalLight])
+		{
+			numDirectionalShadowingCastingLight += light.shadowMapIndex != -1;
+		}
 
-			Array<Math::Lengthf, VisibleLight::MaximumCascadeCount> cascadeSplits;
-#endif
-			DirectionalLightIndexType numDirectionalShadowingCastingLight = 0;
-			for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::DirectionalLight])
+		for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::DirectionalLight])
+		{
+			if (numDirectionalShadowingCastingLight >= MaximumDirectionalLightCount)
 			{
-				numDirectionalShadowingCastingLight += light.shadowMapIndex != -1;
+				break;
 			}
 
-			for (VisibleLight& light : m_visibleLights[(uint8)LightTypes::DirectionalLight])
+			const Entity::DirectionalLightComponent& directionalLight = static_cast<const Entity::DirectionalLightComponent&>(*light.light);
+			if (light.shadowMapIndex == -1)
 			{
-				const Entity::DirectionalLightComponent& directionalLight = static_cast<const Entity::DirectionalLightComponent&>(*light.light);
-
-				if (light.shadowMapIndex == -1)
+				const uint16 numCascades = directionalLight.GetCascadeCount();
+				if (m_visibleShadowCastingLights.GetRemainingCapacity() < numCascades)
 				{
-					const uint16 numCascades = directionalLight.GetCascadeCount();
-					if (m_visibleShadowCastingLights.GetRemainingCapacity() < numCascades || numDirectionalShadowingCastingLight >= MaximumDirectionalLightCount)
-					{
-						continue;
-					}
+					continue;
+				}
 
-					++numDirectionalShadowingCastingLight;
+				++numDirectionalShadowingCastingLight;
 
-					light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
-					Assert(numCascades <= MaximumCascadeCount);
-					light.cascadeCount = (VisibleLight::CascadeIndexType)numCascades;
+				light.shadowMapIndex = m_visibleShadowCastingLights.GetNextAvailableIndex();
+				Assert(numCascades <= MaximumCascadeCount);
+				light.cascadeCount = (VisibleLight::CascadeIndexType)numCascades;
 
-					const Entity::RenderItemIdentifier renderItemIdentifier = directionalLight.GetRenderItemIdentifier();
+				const Entity::RenderItemIdentifier renderItemIdentifier = directionalLight.GetRenderItemIdentifier();
 
 #if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
-					light.directionalShadowMatrixIndex = m_parallelShadowMapsIndices.GetSize();
+				light.directionalShadowMatrixIndex = m_parallelShadowMapsIndices.GetSize();
+#endif
+				for (uint8 cascadeIndex = 0; cascadeIndex < numCascades; cascadeIndex++)
+				{
+#if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+					m_parallelShadowMapsIndices.EmplaceBack(m_visibleShadowCastingLights.GetSize());
+#endif
+					m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{}); // reserve space, filled by the GPU or when fitting the cascades
+					m_visibleShadowCastingLightIdentifiers.EmplaceBack(renderItemIdentifier);
+				}
 
-					for (uint8 cascadeIndex = 0; cascadeIndex < numCascades; cascadeIndex++)
-					{
-						m_parallelShadowMapsIndices.EmplaceBack(m_visibleShadowCastingLights.GetSize());
-						m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{}); // reserve space, will be filled by GPU
-						m_visibleShadowCastingLightIdentifiers.EmplaceBack(renderItemIdentifier);
-					}
-#else
-					cascadeSplits.GetView().CopyFrom(directionalLight.GetCascadeDistances());
-					// Change the cascade split from meters to ratio
-					for (uint8 i = 0; i < numCascades; i++)
-					{
-						cascadeSplits[i] = Math::Lengthf::FromMeters((cascadeSplits[i].GetMeters() - nearPlane) / clipRange);
-					}
+#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+				UpdateDirectionalLightCascades(light);
+#endif
+			}
+		}
 
-					Array<Math::Vector3f, 8> frustumCorners = {
-						Math::Vector3f{-1.0f, 1.0f, 1.0f},  // near bottom left
-						Math::Vector3f{-1.0f, -1.0f, 1.0f}, // near top left
-						Math::Vector3f{1.0f, -1.0f, 1.0f},  // near top right
-						Math::Vector3f{1.0f, 1.0f, 1.0f},   // near bottom right,
-						Math::Vector3f{-1.0f, 1.0f, 0.0f},  // far bottom left
-						Math::Vector3f{-1.0f, -1.0f, 0.0f}, // far top left
-						Math::Vector3f{1.0f, -1.0f, 0.0f},  // far top right
-						Math::Vector3f{1.0f, 1.0f, 0.0f},   // far bottom right,
-					};
-
-					// Project frustum corners into world space
-					for (Math::Vector3f& frustumCorner : frustumCorners)
-					{
-						frustumCorner = m_sceneView.ViewToWorld(Math::Vector2f{frustumCorner.x, frustumCorner.y}, frustumCorner.z);
-					}
+		m_numDirectionalShadowingCastingLight = numDirectionalShadowingCastingLight;
+	}
 
-					// Calculate orthographic projection matrix for each cascade
+#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+	void LightGatheringStage::UpdateDirectionalLightCascades(VisibleLight& light)
+	{
+		const Entity::CameraComponent& activeCamera = m_sceneView.GetActiveCameraComponent();
+		const float nearPlane = activeCamera.GetNearPlane().GetUnits();
+		const float clipRange = activeCamera.GetDepthRange().GetUnits();
 
-					const Math::Vector3f lightDir = light.light->GetWorldForwardDirection();
+		const Entity::DirectionalLightComponent& directionalLight = static_cast<const Entity::DirectionalLightComponent&>(*light.light);
+		const uint8 numCascades = light.cascadeCount;
 
-					Math::Lengthf lastSplitDist = 0_meters;
-					for (uint8 cascadeIndex = 0; cascadeIndex < numCascades; cascadeIndex++)
-					{
-						const Math::Lengthf splitDist = cascadeSplits[cascadeIndex];
+		Array<Math::Lengthf, VisibleLight::MaximumCascadeCount> cascadeSplits;
+		cascadeSplits.GetView().CopyFrom(directionalLight.GetCascadeDistances());
+		// Change the cascade split from meters to ratio
+		for (uint8 i = 0; i < numCascades; i++)
+		{
+			cascadeSplits[i] = Math::Lengthf::FromMeters((cascadeSplits[i].GetMeters() - nearPlane) / clipRange);
+		}
 
-						Array<Math::Vector3f, 8> cascadeFrustumCorners;
-						for (uint8 i = 0; i < 4; i++)
-						{
-							const Math::Vector3f dist = frustumCorners[i + 4] - frustumCorners[i];
-							cascadeFrustumCorners[i + 4] = frustumCorners[i] + (dist * splitDist.GetMeters());
-							cascadeFrustumCorners[i] = frustumCorners[i] + (dist * lastSplitDist.GetMeters());
-						}
+		Array<Math::Vector3f, 8> frustumCorners = {
+			Math::Vector3f{-1.0f, 1.0f, 1.0f},  // near bottom left
+			Math::Vector3f{-1.0f, -1.0f, 1.0f}, // near top left
+			Math::Vector3f{1.0f, -1.0f, 1.0f},  // near top right
+			Math::Vector3f{1.0f, 1.0f, 1.0f},   // near bottom right,
+			Math::Vector3f{-1.0f, 1.0f, 0.0f},  // far bottom left
+			Math::Vector3f{-1.0f, -1.0f, 0.0f}, // far top left
+			Math::Vector3f{1.0f, -1.0f, 0.0f},  // far top right
+			Math::Vector3f{1.0f, 1.0f, 0.0f},   // far bottom right,
+		};
+
+		// Project frustum corners into world space
+		for (Math::Vector3f& frustumCorner : frustumCorners)
+		{
+			frustumCorner = m_sceneView.ViewToWorld(Math::Vector2f{frustumCorner.x, frustumCorner.y}, frustumCorner.z);
+		}
 
-						// Get frustum center
-						Math::Vector3f frustumCenter = Math::Zero;
-						for (const Math::Vector3f frustumCorner : cascadeFrustumCorners)
-						{
-							frustumCenter += frustumCorner;
-						}
-						constexpr float inverseCornerCount = 1.f / cascadeFrustumCorners.GetSize();
-						frustumCenter *= inverseCornerCount;
+		// Calculate orthographic projection matrix for each cascade
 
-						float radius = 0.0f;
-						for (const Math::Vector3f frustumCorner : cascadeFrustumCorners)
-						{
-							const float distance = (frustumCorner - frustumCenter).GetLength();
-							radius = Math::Max(radius, distance);
-						}
-						radius = Math::Ceil(radius * 16.0f) / 16.0f;
+		const Math::Vector3f lightDir = light.light->GetWorldForwardDirection();
+
+		Math::Lengthf lastSplitDist = 0_meters;
+		for (uint8 cascadeIndex = 0; cascadeIndex < numCascades; cascadeIndex++)
+		{
+			const Math::Lengthf splitDist = cascadeSplits[cascadeIndex];
+
+			Array<Math::Vector3f, 8> cascadeFrustumCorners;
+			for (uint8 i = 0; i < 4; i++)
+			{
+				const Math::Vector3f dist = frustumCorners[i + 4] - frustumCorners[i];
+				cascadeFrustumCorners[i + 4] = frustumCorners[i] + (dist * splitDist.GetMeters());
+				cascadeFrustumCorners[i] = frustumCorners[i] + (dist * lastSplitDist.GetMeters());
+			}
+
+			// Get frustum center
+			Math::Vector3f frustumCenter = Math::Zero;
+			for (const Math::Vector3f frustumCorner : cascadeFrustumCorners)
+			{
+				frustumCenter += frustumCorner;
+			}
+			constexpr float inverseCornerCount = 1.f / cascadeFrustumCorners.GetSize();
+			frustumCenter *= inverseCornerCount;
 
-						Math::Matrix4x4f lightViewMatrix =
-							Math::Matrix4x4f::CreateLookAt(frustumCenter - lightDir * radius, frustumCenter, light.light->GetWorldUpDirection());
+			float radius = 0.0f;
+			for (const Math::Vector3f frustumCorner : cascadeFrustumCorners)
+			{
+				const float distance = (frustumCorner - frustumCenter).GetLength();
+				radius = Math::Max(radius, distance);
+			}
+			radius = Math::Ceil(radius * 16.0f) / 16.0f;
 
-						// Snap frustumCenter to texel size in order to stabilize the shadow map (ie. no shimering)
+			Math::Matrix4x4f lightViewMatrix =
+				Math::Matrix4x4f::CreateLookAt(frustumCenter - lightDir * radius, frustumCenter, light.light->GetWorldUpDirection());
 
-						Math::Vector3f S(lightViewMatrix.m_rows[0].x, lightViewMatrix.m_rows[1].x, lightViewMatrix.m_rows[2].x);
-						Math::Vector3f T(lightViewMatrix.m_rows[0].y, lightViewMatrix.m_rows[1].y, lightViewMatrix.m_rows[2].y);
-						Math::Vector3f U(lightViewMatrix.m_rows[0].z, lightViewMatrix.m_rows[1].z, lightViewMatrix.m_rows[2].z);
+			// Snap frustumCenter to texel size in order to stabilize the shadow map (ie. no shimering)
 
-						float s = S.Dot(frustumCenter);
-						float t = T.Dot(frustumCenter);
-						float u = U.Dot(frustumCenter);
+			Math::Vector3f S(lightViewMatrix.m_rows[0].x, lightViewMatrix.m_rows[1].x, lightViewMatrix.m_rows[2].x);
+			Math::Vector3f T(lightViewMatrix.m_rows[0].y, lightViewMatrix.m_rows[1].y, lightViewMatrix.m_rows[2].y);
+			Math::Vector3f U(lightViewMatrix.m_rows[0].z, lightViewMatrix.m_rows[1].z, lightViewMatrix.m_rows[2].z);
 
-						float texelSize = 2.0f * radius / (float)ShadowMapSize;
+			float s = S.Dot(frustumCenter);
+			float t = T.Dot(frustumCenter);
+			float u = U.Dot(frustumCenter);
 
-						s = (Math::Round(s / texelSize) + 0.5f) * texelSize; // TODO not sure about this half pixel offset
-						t = (Math::Round(t / texelSize) + 0.5f) * texelSize;
+			float texelSize = 2.0f * radius / (float)ShadowMapSize;
 
-						frustumCenter = S * s + T * t + U * u;
+			s = (Math::Round(s / texelSize) + 0.5f) * texelSize; // TODO not sure about this half pixel offset
+			t = (Math::Round(t / texelSize) + 0.5f) * texelSize;
 
-						// Compute matrices
-						lightViewMatrix =
-							Math::Matrix4x4f::CreateLookAt(frustumCenter - lightDir * radius, frustumCenter, light.light->GetWorldUpDirection());
+			frustumCenter = S * s + T * t + U * u;
 
-						const Math::Matrix4x4f lightOrthoMatrix =
-							Math::Matrix4x4f::CreateOrthographic(-radius, radius, -radius, radius, 0.0f, radius * 2.0f);
+			// Compute matrices
+			lightViewMatrix =
+				Math::Matrix4x4f::CreateLookAt(frustumCenter - lightDir * radius, frustumCenter, light.light->GetWorldUpDirection());
 
-						const Math::Matrix4x4f viewProjection = lightViewMatrix * lightOrthoMatrix;
-						light.shadowSampleViewProjectionMatrices[cascadeIndex] = viewProjection * biasMatrix;
+			const Math::Matrix4x4f lightOrthoMatrix = Math::Matrix4x4f::CreateOrthographic(-radius, radius, -radius, radius, 0.0f, radius * 2.0f);
 
-						m_visibleShadowCastingLights.EmplaceBack(ShadowInfo{viewProjection});
-						m_visibleShadowCastingLightIdentifiers.EmplaceBack(renderItemIdentifier);
-						light.cascadeSplitDepths[cascadeIndex] = (nearPlane + splitDist.GetMeters() * clipRange);
+			const Math::Matrix4x4f viewProjection = lightViewMatrix * lightOrthoMatrix;
+			light.shadowSampleViewProjectionMatrices[cascadeIndex] = viewProjection * ShadowSampleBiasMatrix;
 
-						lastSplitDist = cascadeSplits[cascadeIndex];
-					}
-#endif
-				}
-			}
+			m_visibleShadowCastingLights[ShadowMapIndexType(light.shadowMapIndex + cascadeIndex)] = ShadowInfo{viewProjection};
+			light.cascadeSplitDepths[cascadeIndex] = (nearPlane + splitDist.GetMeters() * clipRange);
 
-			m_numDirectionalShadowingCastingLight = numDirectionalShadowingCastingLight;
+			lastSplitDist = cascadeSplits[cascadeIndex];
 		}
 	}
+#endif
 }
@@ -591,7 +591,7 @@ namespace ngine::Rendering
 	void PBRLightingStage::PopulateDescriptorSet(const Rendering::DescriptorSetView descriptorSet)
 	{
 		FlatVector<DescriptorSet::ImageInfo, TotalSampledTextureCount * 2> imageInfo;
-		FlatVector<DescriptorSet::BufferInfo, (uint8)LightTypes::Count - 1 + 2> bufferInfo;
+		FlatVector<DescriptorSet::BufferInfo, (uint8)LightTypes::Count - 1 + 3> bufferInfo;
 		FlatVector<DescriptorSet::UpdateInfo, (uint8)PBRLightingPipeline::DescriptorBinding::Count> descriptorUpdates;
 
 		if (m_pShadowsStage.IsInvalid() || m_pShadowsStage->GetState() == ShadowsStage::State::Rasterized)
@@ -808,6 +808,38 @@ namespace ngine::Rendering
 					}
 					break;
 #endif
+					case PBRLightingPipeline::DescriptorBinding::LightClustersBuffer:
+					{
+						DescriptorSet::BufferInfo& emplacedBufferInfo = bufferInfo.EmplaceBack(
+							DescriptorSet::BufferInfo{m_tilePopulationStage.GetClusterBuffer(), 0, TilePopulationStage::ClusterBufferSize}
+						);
+
+						descriptorUpdates.EmplaceBack(
+							descriptorSet,
+							(uint8)descriptorBinding,
+							0,
+							DescriptorType::StorageBuffer,
+							ArrayView<const DescriptorSet::BufferInfo>(emplacedBufferInfo)
+						);
+					}
+					break;
+					case PBRLightingPipeline::DescriptorBinding::LightClusterIndicesBuffer:
+					{
+						DescriptorSet::BufferInfo& emplacedBufferInfo = bufferInfo.EmplaceBack(DescriptorSet::BufferInfo{
+							m_tilePopulationStage.GetClusterLightIndexBuffer(),
+							0,
+							TilePopulationStage::ClusterLightIndexBufferSize
+						});
+
+						descriptorUpdates.EmplaceBack(
+							descriptorSet,
+							(uint8)descriptorBinding,
+							0,
+							DescriptorType::StorageBuffer,
+							ArrayView<const DescriptorSet::BufferInfo>(emplacedBufferInfo)
+						);
+					}
+					break;
 					case PBRLightingPipeline::DescriptorBinding::Count:
 						ExpectUnreachable();
 				}
@@ -1126,14 +1158,8 @@ namespace ngine::Rendering
 			}
 		}
 
-		if (m_descriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 	}
 
 	void PBRLightingStage::OnVisibleRenderItemsReset(const Entity::RenderItemMask& renderItems)
@@ -1169,26 +1195,14 @@ namespace ngine::Rendering
 			}
 		}
 
-		if (m_descriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 	}
 
 	void PBRLightingStage::OnVisibleRenderItemTransformsChanged(const Entity::RenderItemMask&)
 	{
-		if (m_descriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 	}
 
 	Threading::JobBatch PBRLightingStage::LoadRenderItemsResources(const Entity::RenderItemMask&)
@@ -1472,14 +1486,8 @@ namespace ngine::Rendering
 
 	void PBRLightingStage::OnActiveCameraPropertiesChanged(const Rendering::CommandEncoderView, PerFrameStagingBuffer&)
 	{
-		if (m_descriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 	}
 
 	void PBRLightingStage::UpdateLightBufferDescriptorSet()
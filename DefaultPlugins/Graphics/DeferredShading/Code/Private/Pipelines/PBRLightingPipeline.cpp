@@ -168,6 +168,14 @@ namespace ngine::Rendering
 				ShaderStage::Fragment
 			),
 #endif
+			DescriptorSetLayout::Binding::MakeStorageBuffer(
+				(uint8)PBRLightingPipeline::DescriptorBinding::LightClustersBuffer,
+				ShaderStage::Fragment
+			),
+			DescriptorSetLayout::Binding::MakeStorageBuffer(
+				(uint8)PBRLightingPipeline::DescriptorBinding::LightClusterIndicesBuffer,
+				ShaderStage::Fragment
+			),
 	};
 
 	inline static constexpr Array<const DescriptorSetLayout::Binding, (uint8)PBRLightingPipelineRaytraced::DescriptorBinding::Count>
@@ -6,6 +6,7 @@
 #include <Common/Math/Power.h>
 #include <Common/Memory/AddressOf.h>
 #include <Common/Memory/OffsetOf.h>
+#include <Common/Math/Primitives/Transform/BoundingBox.h>
 
 #include <Engine/Threading/JobRunnerThread.h>
 
@@ -16,6 +17,8 @@
 #include <Engine/Entity/Lights/EnvironmentLightComponent.h>
 #include <Engine/Entity/CameraComponent.h>
 #include <Engine/Scene/Scene.h>
+#include <Engine/Entity/Data/WorldTransform.h>
+#include <Engine/Entity/Data/BoundingBox.h>
 
 #include <Renderer/Commands/CommandEncoderView.h>
 #include <Renderer/Commands/RenderCommandEncoder.h>
@@ -32,6 +35,7 @@
 #include <Renderer/Stages/PerFrameStagingBuffer.h>
 #include <Renderer/Assets/Texture/RenderTexture.h>
 #include <Renderer/RenderOutput/RenderOutput.h>
+#include <Renderer/Scene/ViewFrustum.h>
 
 #include <Renderer/Wrappers/AttachmentReference.h>
 #include <Renderer/Wrappers/AttachmentDescription.h>
@@ -82,6 +86,21 @@ namespace ngine::Rendering
 				Rendering::DependencyFlags()
 			}
 		};
+
+		[[nodiscard]] inline static bool AreMatricesEqual(const Math::Matrix4x4f& left, const Math::Matrix4x4f& right)
+		{
+			for (uint8 rowIndex = 0; rowIndex < 4; ++rowIndex)
+			{
+				for (uint8 columnIndex = 0; columnIndex < 4; ++columnIndex)
+				{
+					if (left.m_rows[rowIndex][columnIndex] != right.m_rows[rowIndex][columnIndex])
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
 	}
 
 	ShadowsStage::ShadowsStage(
@@ -153,6 +172,7 @@ namespace ngine::Rendering
 		const SceneRenderStageIdentifier stageIdentifier = System::Get<Rendering::Renderer>().GetStageCache().FindIdentifier(Guid);
 		m_sceneView.RegisterRenderItemStage(stageIdentifier, *this);
 		m_sceneView.SetStageDependentOnCameraProperties(stageIdentifier);
+		m_sceneView.SetStageDrawsShadowCasters(stageIdentifier);
 
 		Threading::EngineJobRunnerThread& thread = static_cast<Threading::EngineJobRunnerThread&>(*Threading::JobRunnerThread::GetCurrent());
 
@@ -316,6 +336,7 @@ namespace ngine::Rendering
 				shadowMapMappingArrayLayerCount
 			);
 		}
+		InvalidateShadowMaps();
 		m_loadedResources = true;
 	}
 
@@ -369,6 +390,8 @@ namespace ngine::Rendering
 				graphicsCommandEncoder,
 				perFrameStagingBuffer
 			);
+			m_shadowCasterRenderItems |= staticMeshes;
+			m_changedShadowCasterRenderItems |= staticMeshes;
 
 			if (m_pBuildAccelerationStructureStage.IsValid())
 			{
@@ -439,6 +462,9 @@ namespace ngine::Rendering
 				graphicsCommandEncoder,
 				perFrameStagingBuffer
 			);
+			m_shadowCasterRenderItems |= staticMeshes;
+			// Reset items can move to another instance group or instance
+			m_changedShadowCasterRenderItems |= staticMeshes;
 
 			if (m_pBuildAccelerationStructureStage.IsValid())
 			{
@@ -464,6 +490,8 @@ namespace ngine::Rendering
 		{
 			m_visibleStaticMeshes
 				.RemoveRenderItems(m_sceneView.GetLogicalDevice(), renderItems, scene, graphicsCommandEncoder, perFrameStagingBuffer);
+			m_removedShadowCasterRenderItems |= m_shadowCasterRenderItems & renderItems;
+			m_shadowCasterRenderItems.Clear(renderItems);
 		}
 
 		if (m_pBuildAccelerationStructureStage.IsValid())
@@ -509,6 +537,8 @@ namespace ngine::Rendering
 
 		if (meshes.AreAnySet())
 		{
+			m_changedShadowCasterRenderItems |= meshes;
+
 			if (m_pBuildAccelerationStructureStage.IsValid())
 			{
 				m_pBuildAccelerationStructureStage->OnVisibleRenderItemTransformsChanged(meshes, graphicsCommandEncoder, perFrameStagingBuffer);
@@ -543,6 +573,10 @@ namespace ngine::Rendering
 	{
 		m_lightGatheringStage.OnSceneUnloaded();
 		m_visibleStaticMeshes.OnSceneUnloaded(m_sceneView.GetLogicalDevice(), *m_sceneView.GetSceneChecked());
+		m_shadowCasterRenderItems.ClearAll();
+		m_changedShadowCasterRenderItems.ClearAll();
+		m_removedShadowCasterRenderItems.ClearAll();
+		InvalidateShadowMaps();
 	}
 
 	void ShadowsStage::OnActiveCameraPropertiesChanged(
@@ -559,9 +593,6 @@ namespace ngine::Rendering
 
 	)
 	{
-		Array<DescriptorSet::UpdateInfo, 1> descriptorUpdates;
-		Array<DescriptorSet::BufferInfo, 1> bufferInfo;
-
 		{
 			LogicalDevice& logicalDevice = m_logicalDevice;
 
@@ -598,22 +629,25 @@ namespace ngine::Rendering
 
 			perFrameStagingBuffer.EndBatchCopyToBuffer(batchCopyContext, graphicsCommandEncoder);
 
-			bufferInfo[0] =
-				DescriptorSet::BufferInfo{m_shadowGenInfoBuffer, 0, sizeof(LightGatheringStage::Header) + visibleShadowCastingLights.GetDataSize()};
-
-			descriptorUpdates[0] = DescriptorSet::UpdateInfo{
-				m_descriptorSets[0],
-				0,
-				0,
-				DescriptorType::StorageBuffer,
-				ArrayView<const DescriptorSet::BufferInfo>(bufferInfo[0])
-			};
+			m_shadowGenInfoSize = sizeof(LightGatheringStage::Header) + visibleShadowCastingLights.GetDataSize();
 		}
 
-		if (Ensure(m_descriptorSets[0].IsValid()))
+		// Only copied here, the descriptor is updated before recording once earlier frames stopped reading it
+		m_shouldUpdateLightBufferDescriptorSet = true;
+	}
+
+	void ShadowsStage::OnBeforeRecordCommands(const CommandEncoderView)
+	{
+		bool expected = true;
+		if (m_descriptorSets[0].IsValid() && m_shouldUpdateLightBufferDescriptorSet.CompareExchangeStrong(expected, false))
 		{
+			const Array<DescriptorSet::BufferInfo, 1> bufferInfo{DescriptorSet::BufferInfo{m_shadowGenInfoBuffer, 0, m_shadowGenInfoSize}};
+			const Array<DescriptorSet::UpdateInfo, 1> descriptorUpdates{
+				DescriptorSet::UpdateInfo{m_descriptorSets[0], 0, 0, DescriptorType::StorageBuffer, bufferInfo.GetSubView(0, 1)}
+			};
+
 			Threading::UniqueLock lock(m_textureLoadMutex);
-			DescriptorSet::Update(m_sceneView.GetLogicalDevice(), descriptorUpdates);
+			DescriptorSet::Update(m_sceneView.GetLogicalDevice(), descriptorUpdates.GetView());
 		}
 	}
 
@@ -651,6 +685,8 @@ namespace ngine::Rendering
 		AnalyzeDepthBufferToSetupParallelSplitShadowMaps(graphicsCommandEncoder);
 #endif
 
+		BuildShadowCasterSets();
+
 		constexpr Array<ClearValue, 1> clearValues = {DepthStencilValue{1.f, 0}};
 
 		const DescriptorSetView transformBufferDescriptorSet = m_sceneView.GetTransformBufferDescriptorSet();
@@ -659,39 +695,28 @@ namespace ngine::Rendering
 					PhysicalDeviceFeatures::GeometryShader | PhysicalDeviceFeatures::LayeredRendering
 				))
 		{
-			const VisibleRenderItems::VisibleInstanceGroups::ConstDynamicView instanceGroups = m_visibleStaticMeshes.GetVisibleItems();
+			// Layers are rendered in a single pass, so all shadow maps are rendered again once any of them was invalidated
+			if (m_invalidatedShadowMaps.AreNoneSet())
+			{
+				return;
+			}
+
 			Rendering::RenderCommandEncoder renderCommandEncoder = graphicsCommandEncoder.BeginRenderPass(
 				m_logicalDevice,
 				m_renderPass,
 				m_framebuffers[0],
 				Math::Rectangleui{Math::Zero, {ShadowMapSize, ShadowMapSize}},
 				clearValues,
-				instanceGroups.GetSize()
+				m_combinedShadowCasters.GetSize()
 			);
 			renderCommandEncoder.BindPipeline(m_pipeline);
 
 			renderCommandEncoder
 				.BindDescriptorSets(m_pipeline, Array<const DescriptorSetView, 2>{transformBufferDescriptorSet, m_descriptorSets[0]});
 
-			for (const Optional<VisibleRenderItems::InstanceGroup*> pInstanceGroup : instanceGroups)
-			{
-				if (pInstanceGroup == nullptr)
-				{
-					continue;
-				}
-
-				if (pInstanceGroup->m_instanceBuffer.GetInstanceCount() > 0)
-				{
-					const VisibleStaticMeshes::InstanceGroup& instanceGroup = static_cast<const VisibleStaticMeshes::InstanceGroup&>(*pInstanceGroup);
-					m_pipeline.Draw(
-						instanceGroup.m_instanceBuffer.GetFirstInstanceIndex(),
-						instanceGroup.m_instanceBuffer.GetInstanceCount(),
-						instanceGroup.m_renderMeshView,
-						instanceGroup.m_instanceBuffer.GetBuffer(),
-						renderCommandEncoder
-					);
-				}
-			}
+			// Layers are selected by the geometry shader, so only casters outside of all shadow maps can be skipped
+			DrawShadowCasters(m_combinedShadowCasters.GetView(), renderCommandEncoder);
+			m_invalidatedShadowMaps.ClearAll();
 		}
 		else
 		{
@@ -700,6 +725,11 @@ namespace ngine::Rendering
 			for (const LightGatheringStage::ShadowInfo& lightInfo : visibleShadowCastingLights)
 			{
 				const ShadowMapIndexType shadowmapIndex = visibleShadowCastingLights.GetIteratorIndex(Memory::GetAddressOf(lightInfo));
+				if (!m_invalidatedShadowMaps.IsSet(shadowmapIndex))
+				{
+					// Contents from the previous render are still valid
+					continue;
+				}
 
 				Rendering::RenderCommandEncoder renderCommandEncoder = graphicsCommandEncoder.BeginRenderPass(
 					m_logicalDevice,
@@ -733,28 +763,194 @@ namespace ngine::Rendering
 					m_pipeline.PushConstants(m_logicalDevice, renderCommandEncoder, WithoutGeometryShader::ShadowPushConstantRanges, constants);
 				}
 
-				const VisibleRenderItems::VisibleInstanceGroups::ConstDynamicView instanceGroups = m_visibleStaticMeshes.GetVisibleItems();
-				for (const Optional<VisibleRenderItems::InstanceGroup*> pInstanceGroup : instanceGroups)
-				{
-					if (pInstanceGroup == nullptr)
-					{
-						continue;
-					}
+				DrawShadowCasters(m_cachedShadowMaps[shadowmapIndex].m_shadowCasters.GetView(), renderCommandEncoder);
+			}
+			m_invalidatedShadowMaps.ClearAll();
+		}
+	}
 
-					if (pInstanceGroup->m_instanceBuffer.GetInstanceCount() > 0)
+#if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+	//! View depth covered by the cascades of a directional light, its furthest cascade distance limited to the camera's far plane
+	[[nodiscard]] static Math::Lengthf GetDirectionalShadowRange(const Entity::LightSourceComponent& light, const Entity::CameraComponent& camera)
+	{
+		const ArrayView<const Math::Lengthf> cascadeDistances = static_cast<const Entity::DirectionalLightComponent&>(light).GetCascadeDistances();
+		if (cascadeDistances.IsEmpty())
+		{
+			return camera.GetFarPlane();
+		}
+		return Math::Lengthf::FromMeters(Math::Min(cascadeDistances.GetLastElement().GetMeters(), camera.GetFarPlane().GetMeters()));
+	}
+#endif
+
+	void ShadowsStage::BuildShadowCasterSets()
+	{
+		const ArrayView<const LightGatheringStage::ShadowInfo, ShadowMapIndexType> visibleShadowCastingLights =
+			m_lightGatheringStage.GetVisibleShadowCastingLights();
+		const ShadowMapIndexType shadowMapCount = visibleShadowCastingLights.GetSize();
+
+		// Casters can be anywhere between the light and the shadow map volume, so each volume is extended towards its light
+		Array<ViewFrustum, MaximumShadowmapCount> shadowMapVolumes;
+		for (ShadowMapIndexType shadowMapIndex = 0; shadowMapIndex < shadowMapCount; ++shadowMapIndex)
+		{
+			shadowMapVolumes[shadowMapIndex] = ViewFrustum(visibleShadowCastingLights[shadowMapIndex].viewProjectionMatrix);
+			shadowMapVolumes[shadowMapIndex].RemoveNearPlane();
+			m_shadowMapCasters[shadowMapIndex].Clear();
+		}
+#if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+		// Matrices of the parallel split shadow maps are only known on the GPU, but their cascades cover the view up to the shadow range
+		// Use the view frustum clamped to that range and extended towards the directional light instead
+		const Entity::CameraComponent& camera = m_sceneView.GetActiveCameraComponent();
+		for (const VisibleLight& visibleLight : m_lightGatheringStage.GetVisibleLights(LightTypes::DirectionalLight))
+		{
+			if (visibleLight.shadowMapIndex == -1)
+			{
+				continue;
+			}
+
+			ViewFrustum lightVolume = m_sceneView.GetViewFrustum();
+			lightVolume.SetFarPlane(
+				camera.GetWorldLocation(),
+				camera.GetWorldForwardDirection(),
+				GetDirectionalShadowRange(*visibleLight.light, camera).GetMeters()
+			);
+			lightVolume.ExtrudeTowards(-visibleLight.light->GetWorldForwardDirection());
+			for (uint32 cascadeIndex = 0; cascadeIndex < visibleLight.cascadeCount; ++cascadeIndex)
+			{
+				const ShadowMapIndexType shadowMapIndex = (ShadowMapIndexType)(visibleLight.shadowMapIndex + cascadeIndex);
+				shadowMapVolumes[shadowMapIndex] = lightVolume;
+				// Placed based on the depth buffer every frame, so they can't be cached
+				m_invalidatedShadowMaps.Set(shadowMapIndex);
+			}
+		}
+#endif
+		// The next octree traversal collects the static meshes inside these volumes, including the ones outside the view
+		m_sceneView.SetShadowCasterVolumes(ArrayView<const ViewFrustum, uint8>{shadowMapVolumes.GetData(), shadowMapCount});
+		m_combinedShadowCasters.Clear();
+
+		Entity::SceneRegistry& sceneRegistry = m_sceneView.GetScene().GetEntitySceneRegistry();
+		Entity::ComponentTypeSceneData<Entity::Data::WorldTransform>& worldTransformSceneData =
+			sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>();
+		Entity::ComponentTypeSceneData<Entity::Data::BoundingBox>& boundingBoxSceneData =
+			sceneRegistry.GetCachedSceneData<Entity::Data::BoundingBox>();
+
+		const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount =
+			m_sceneView.GetSceneChecked()->GetMaximumUsedRenderItemCount();
+		for (const uint32 renderItemIndex : m_shadowCasterRenderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
+		{
+			const Entity::RenderItemIdentifier renderItemIdentifier = Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex);
+			const VisibleRenderItems::VisibleInstanceGroupIdentifier instanceGroupIdentifier =
+				m_visibleStaticMeshes.GetRenderItemInstanceGroup(renderItemIdentifier);
+			if (instanceGroupIdentifier.IsInvalid())
+			{
+				continue;
+			}
+
+			const Entity::ComponentIdentifier componentIdentifier = m_sceneView.GetVisibleRenderItemComponentIdentifier(renderItemIdentifier);
+			const Math::WorldBoundingBox worldBoundingBox = Math::Transform(
+				worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier),
+				boundingBoxSceneData.GetComponentImplementationUnchecked(componentIdentifier)
+			);
+
+			const ShadowCaster shadowCaster{
+				instanceGroupIdentifier.GetIndex(),
+				m_visibleStaticMeshes.GetRenderItemInstanceIndex(renderItemIdentifier),
+				renderItemIdentifier
+			};
+			const bool hasMoved = m_changedShadowCasterRenderItems.IsSet(renderItemIdentifier);
+			bool castsAnyShadow = false;
+			for (ShadowMapIndexType shadowMapIndex = 0; shadowMapIndex < shadowMapCount; ++shadowMapIndex)
+			{
+				if (shadowMapVolumes[shadowMapIndex].IsVisible(worldBoundingBox))
+				{
+					m_shadowMapCasters[shadowMapIndex].EmplaceBack(shadowCaster);
+					castsAnyShadow = true;
+					if (hasMoved)
 					{
-						const VisibleStaticMeshes::InstanceGroup& instanceGroup = static_cast<const VisibleStaticMeshes::InstanceGroup&>(*pInstanceGroup
-						);
-						m_pipeline.Draw(
-							instanceGroup.m_instanceBuffer.GetFirstInstanceIndex(),
-							instanceGroup.m_instanceBuffer.GetInstanceCount(),
-							instanceGroup.m_renderMeshView,
-							instanceGroup.m_instanceBuffer.GetBuffer(),
-							renderCommandEncoder
-						);
+						m_invalidatedShadowMaps.Set(shadowMapIndex);
 					}
 				}
 			}
+			if (castsAnyShadow)
+			{
+				m_combinedShadowCasters.EmplaceBack(shadowCaster);
+			}
+		}
+
+		Rendering::ShadowCasters::Sort(m_combinedShadowCasters.GetView());
+
+		// Casters entering or leaving a volume change its sorted caster list, added, reset and moved casters within it were invalidated above
+		const ArrayView<const Entity::RenderItemIdentifier, ShadowMapIndexType> shadowCastingLightIdentifiers =
+			m_lightGatheringStage.GetVisibleShadowCastingLightIdentifiers();
+		for (ShadowMapIndexType shadowMapIndex = 0; shadowMapIndex < shadowMapCount; ++shadowMapIndex)
+		{
+			ShadowCasters& shadowCasters = m_shadowMapCasters[shadowMapIndex];
+			Rendering::ShadowCasters::Sort(shadowCasters.GetView());
+
+			CachedShadowMap& cachedShadowMap = m_cachedShadowMaps[shadowMapIndex];
+			const Math::Matrix4x4f& viewProjectionMatrix = visibleShadowCastingLights[shadowMapIndex].viewProjectionMatrix;
+			const bool isValid = cachedShadowMap.m_lightIdentifier == shadowCastingLightIdentifiers[shadowMapIndex] &&
+			                     Shadowmapping::AreMatricesEqual(cachedShadowMap.m_viewProjectionMatrix, viewProjectionMatrix) &&
+			                     Rendering::ShadowCasters::IsCacheValid(
+			                       cachedShadowMap.m_shadowCasters.GetView(),
+			                       shadowCasters.GetView(),
+			                       m_removedShadowCasterRenderItems
+			                     );
+			if (!isValid)
+			{
+				m_invalidatedShadowMaps.Set(shadowMapIndex);
+			}
+
+			cachedShadowMap.m_lightIdentifier = shadowCastingLightIdentifiers[shadowMapIndex];
+			cachedShadowMap.m_viewProjectionMatrix = viewProjectionMatrix;
+			// Keep the current casters for the next comparison, and reuse the previous allocation for the next frame
+			ShadowCasters previousShadowCasters = Move(cachedShadowMap.m_shadowCasters);
+			cachedShadowMap.m_shadowCasters = Move(shadowCasters);
+			shadowCasters = Move(previousShadowCasters);
+		}
+		m_changedShadowCasterRenderItems.ClearAll();
+		m_removedShadowCasterRenderItems.ClearAll();
+	}
+
+	void ShadowsStage::InvalidateShadowMaps()
+	{
+		for (CachedShadowMap& cachedShadowMap : m_cachedShadowMaps)
+		{
+			cachedShadowMap.m_lightIdentifier = {};
+		}
+	}
+
+	void ShadowsStage::DrawShadowCasters(
+		const ArrayView<const ShadowCaster, uint32> shadowCasters, const RenderCommandEncoderView renderCommandEncoder
+	) const
+	{
+		for (uint32 index = 0, count = shadowCasters.GetSize(); index < count;)
+		{
+			const ShadowCaster& firstCaster = shadowCasters[index];
+			uint32 instanceCount = 1;
+			while (index + instanceCount < count &&
+			       shadowCasters[index + instanceCount].m_instanceGroupIdentifierIndex == firstCaster.m_instanceGroupIdentifierIndex &&
+			       shadowCasters[index + instanceCount].m_instanceIndex == firstCaster.m_instanceIndex + instanceCount)
+			{
+				++instanceCount;
+			}
+			index += instanceCount;
+
+			const Optional<const VisibleRenderItems::InstanceGroup*> pInstanceGroup = m_visibleStaticMeshes.GetInstanceGroup(
+				VisibleRenderItems::VisibleInstanceGroupIdentifier::MakeFromIndex(firstCaster.m_instanceGroupIdentifierIndex)
+			);
+			if (pInstanceGroup.IsInvalid())
+			{
+				continue;
+			}
+
+			const VisibleStaticMeshes::InstanceGroup& instanceGroup = static_cast<const VisibleStaticMeshes::InstanceGroup&>(*pInstanceGroup);
+			m_pipeline.Draw(
+				firstCaster.m_instanceIndex,
+				instanceCount,
+				instanceGroup.m_renderMeshView,
+				instanceGroup.m_instanceBuffer.GetBuffer(),
+				renderCommandEncoder
+			);
 		}
 	}
 
@@ -771,6 +967,7 @@ namespace ngine::Rendering
 		const DirectionalLightIndexType numDirectionalShadowingCastingLight = m_lightGatheringStage.GetDirectionalShadowingCastingLightCount();
 		if (numDirectionalShadowingCastingLight > 0)
 		{
+			const Entity::CameraComponent& camera = m_sceneView.GetActiveCameraComponent();
 			const ArrayView<const VisibleLight> visibleDirectionalLights = m_lightGatheringStage.GetVisibleLights(LightTypes::DirectionalLight);
 			for (DirectionalLightIndexType i = 0; i < numDirectionalShadowingCastingLight; ++i)
 			{
@@ -787,7 +984,8 @@ namespace ngine::Rendering
 
 				// TODO expose these paramaters
 				m_sdsmLightInfos[i].PSSMLambda = 1.0;
-				m_sdsmLightInfos[i].MaxShadowRange = 10000.0;
+				// Matches the range of the caster volumes built on the CPU
+				m_sdsmLightInfos[i].MaxShadowRange = GetDirectionalShadowRange(*visibleDirectionalLights[i].light, camera).GetMeters();
 			}
 
 			{
@@ -7,6 +7,7 @@
 #include <Common/Threading/Jobs/AsyncJob.h>
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
 #include <Common/Math/Log2.h>
+#include <Common/Math/Tan.h>
 #include <Common/Math/Vector2/Mod.h>
 #include <Common/Math/Vector2/Sign.h>
 #include <Common/Memory/AddressOf.h>
@@ -37,10 +38,67 @@
 #include <Renderer/RenderOutput/RenderOutput.h>
 #include <Renderer/Assets/Texture/RenderTexture.h>
 #include <Renderer/Buffers/DataToBufferBatch.h>
+#include <Renderer/Wrappers/BufferMemoryBarrier.h>
 #include <DeferredShading/FSR/fsr_settings.h>
 
 namespace ngine::Rendering
 {
+	struct TilePopulationStage::ClusterStartJob final : public Threading::Job
+	{
+		ClusterStartJob(TilePopulationStage& stage)
+			: Threading::Job(Threading::JobPriority::Draw)
+			, m_stage(stage)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.PrepareLightClusters();
+			if (m_stage.m_clusterSliceJobs.IsEmpty())
+			{
+				m_stage.AssignLightClusterSlices(0, 1);
+			}
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Light Cluster Start Job";
+		}
+#endif
+	protected:
+		TilePopulationStage& m_stage;
+	};
+
+	struct TilePopulationStage::ClusterSliceJob final : public Threading::Job
+	{
+		ClusterSliceJob(TilePopulationStage& stage, const uint32 firstSliceIndex, const uint32 sliceStep)
+			: Threading::Job(Threading::JobPriority::Draw)
+			, m_stage(stage)
+			, m_firstSliceIndex(firstSliceIndex)
+			, m_sliceStep(sliceStep)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.AssignLightClusterSlices(m_firstSliceIndex, m_sliceStep);
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Light Cluster Slice Job";
+		}
+#endif
+	protected:
+		TilePopulationStage& m_stage;
+		const uint32 m_firstSliceIndex;
+		const uint32 m_sliceStep;
+	};
+
 	[[nodiscard]] Math::Vector2ui TilePopulationStage::CalculateTileSize(const Math::Vector2ui renderResolution)
 	{
 		return (renderResolution / TilePopulationPipeline::TileSize) +
@@ -81,7 +139,45 @@ namespace ngine::Rendering
 					DirectionalLightBufferSize
 				}
 			}
+		, m_pClusterStartJob(UniqueRef<ClusterStartJob>::Make(*this))
+		, m_clusters(Memory::ConstructWithSize, Memory::Zeroed, ClusterCount)
+		, m_sliceLightIndices(Memory::ConstructWithSize, Memory::DefaultConstruct, ClusterSliceCount)
+		, m_clusterStagingBuffer(
+				m_sceneView.GetLogicalDevice(),
+				m_sceneView.GetLogicalDevice().GetPhysicalDevice(),
+				m_sceneView.GetLogicalDevice().GetDeviceMemoryPool(),
+				ClusterBufferSize + ClusterLightIndexBufferSize,
+				StagingBuffer::Flags::TransferSource | StagingBuffer::Flags::TransferDestination
+			)
+		, m_clusterBuffer(
+				m_sceneView.GetLogicalDevice(),
+				m_sceneView.GetLogicalDevice().GetPhysicalDevice(),
+				m_sceneView.GetLogicalDevice().GetDeviceMemoryPool(),
+				ClusterBufferSize
+			)
+		, m_clusterLightIndexBuffer(
+				m_sceneView.GetLogicalDevice(),
+				m_sceneView.GetLogicalDevice().GetPhysicalDevice(),
+				m_sceneView.GetLogicalDevice().GetDeviceMemoryPool(),
+				ClusterLightIndexBufferSize
+			)
 	{
+		// Slices are independent, so each job assigns every n-th slice
+		const uint32 sliceJobCount =
+			Math::Min((uint32)System::Get<Threading::JobManager>().GetJobThreads().GetSize(), ClusterSliceCount);
+		m_clusterSliceJobs.Reserve(sliceJobCount);
+		for (uint32 sliceJobIndex = 0; sliceJobIndex < sliceJobCount; ++sliceJobIndex)
+		{
+			ClusterSliceJob& sliceJob = *m_clusterSliceJobs.EmplaceBack(UniquePtr<ClusterSliceJob>::Make(*this, sliceJobIndex, sliceJobCount));
+			m_pClusterStartJob->AddSubsequentStage(sliceJob);
+			sliceJob.AddSubsequentStage(m_clustersFinishedStage);
+		}
+		if (m_clusterSliceJobs.IsEmpty())
+		{
+			m_pClusterStartJob->AddSubsequentStage(m_clustersFinishedStage);
+		}
+		m_sceneView.RegisterPostTraversalJobs(*m_pClusterStartJob, m_clustersFinishedStage, *this);
+
 		// Copy header into directional light if necessary
 		for (LightTypes lightType = LightTypes::First; lightType <= LightTypes::LastRealLight; lightType = LightTypes((uint8)lightType + 1))
 		{
@@ -126,6 +222,17 @@ namespace ngine::Rendering
 
 	TilePopulationStage::~TilePopulationStage()
 	{
+		m_sceneView.DeregisterPostTraversalJobs(*m_pClusterStartJob, *this);
+		for (const UniquePtr<ClusterSliceJob>& pSliceJob : m_clusterSliceJobs)
+		{
+			pSliceJob->RemoveSubsequentStage(m_clustersFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+			m_pClusterStartJob->RemoveSubsequentStage(*pSliceJob, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+		if (m_clusterSliceJobs.IsEmpty())
+		{
+			m_pClusterStartJob->RemoveSubsequentStage(m_clustersFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+
 		m_tilePopulationPipeline.Destroy(m_sceneView.GetLogicalDevice());
 
 		if (m_pDescriptorSetLoadingThread != nullptr)
@@ -141,6 +248,9 @@ namespace ngine::Rendering
 		{
 			lightBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
 		}
+		m_clusterBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
+		m_clusterLightIndexBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
+		m_clusterStagingBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
 
 		Rendering::StageCache& stageCache = System::Get<Rendering::Renderer>().GetStageCache();
 		const SceneRenderStageIdentifier stageIdentifier = stageCache.FindIdentifier(Guid);
@@ -265,20 +375,17 @@ namespace ngine::Rendering
 			const Entity::LightSourceComponent& lightComponent = pVisibleComponent->AsExpected<Entity::LightSourceComponent>();
 			const LightTypes lightType = LightGatheringStage::GetLightType(lightComponent);
 
-			m_visibleLights[(uint8)lightType].EmplaceBack(lightComponent);
+			Vector<ReferenceWrapper<const Entity::LightSourceComponent>>& typeVisibleLights = m_visibleLights[(uint8)lightType];
+			m_visibleLightSlots[renderItemIdentifier] = VisibleLightSlot{lightType, typeVisibleLights.GetSize()};
+			typeVisibleLights.EmplaceBack(lightComponent);
+			m_visibleLightsMask.Set(renderItemIdentifier);
 
 			m_sceneView.GetSubmittedRenderItemStageMask(renderItemIdentifier).Set(stageIdentifier);
 		}
 
 		UpdateLightBuffer(graphicsCommandEncoder, perFrameStagingBuffer);
-		if (m_tileDescriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 
 		if (m_pPBRLightingStage.IsValid())
 		{
@@ -325,32 +432,27 @@ namespace ngine::Rendering
 	{
 		const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount =
 			m_sceneView.GetSceneChecked()->GetMaximumUsedRenderItemCount();
-		for (const uint32 renderItemIndex : renderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
+		const Entity::RenderItemMask removedLightsMask = m_visibleLightsMask & renderItems;
+		for (const uint32 renderItemIndex : removedLightsMask.GetSetBitsIterator(0, maximumUsedRenderItemCount))
 		{
-			for (auto& typeVisibleLights : m_visibleLights)
+			const VisibleLightSlot slot = m_visibleLightSlots[Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)];
+			Vector<ReferenceWrapper<const Entity::LightSourceComponent>>& typeVisibleLights = m_visibleLights[(uint8)slot.m_type];
+			Assert(typeVisibleLights[slot.m_index]->GetRenderItemIdentifier().GetFirstValidIndex() == renderItemIndex);
+
+			// Swap the last light of the type into the freed slot so removal stays constant time
+			const uint32 lastIndex = typeVisibleLights.GetSize() - 1;
+			if (slot.m_index != lastIndex)
 			{
-				if (typeVisibleLights.RemoveFirstOccurrencePredicate(
-							[renderItemIndex](const Entity::LightSourceComponent& component) -> ErasePredicateResult
-							{
-								return component.GetRenderItemIdentifier().GetFirstValidIndex() == renderItemIndex ? ErasePredicateResult::Remove
-					                                                                                         : ErasePredicateResult::Continue;
-							}
-						))
-				{
-					break;
-				}
+				typeVisibleLights[slot.m_index] = typeVisibleLights[lastIndex];
+				m_visibleLightSlots[typeVisibleLights[slot.m_index]->GetRenderItemIdentifier()].m_index = slot.m_index;
 			}
+			typeVisibleLights.PopBack();
 		}
+		m_visibleLightsMask.Clear(renderItems);
 
 		UpdateLightBuffer(graphicsCommandEncoder, perFrameStagingBuffer);
-		if (m_tileDescriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 
 		if (m_pPBRLightingStage.IsValid())
 		{
@@ -366,14 +468,8 @@ namespace ngine::Rendering
 	)
 	{
 		UpdateLightBuffer(graphicsCommandEncoder, perFrameStagingBuffer);
-		if (m_tileDescriptorSet.IsValid())
-		{
-			UpdateLightBufferDescriptorSet();
-		}
-		else
-		{
-			m_shouldUpdateLightBuffer = true;
-		}
+		// Applied before recording, once earlier frames stopped reading the descriptor set
+		m_shouldUpdateLightBuffer = true;
 
 		if (m_pPBRLightingStage.IsValid())
 		{
@@ -399,6 +495,7 @@ namespace ngine::Rendering
 		{
 			lightContainer.Clear();
 		}
+		m_visibleLightsMask.ClearAll();
 	}
 
 	void TilePopulationStage::
@@ -411,6 +508,7 @@ namespace ngine::Rendering
 
 	)
 	{
+		Threading::UniqueLock lock(m_clusterLightsMutex);
 		{
 			m_pointLights.Clear();
 			for (const Entity::LightSourceComponent& lightComponent :
@@ -615,7 +713,150 @@ namespace ngine::Rendering
 		       (!m_pPBRLightingStage.IsValid() || !m_pPBRLightingStage->EvaluateShouldSkip()) & m_tilePopulationPipeline.IsValid();
 	}
 
-	void TilePopulationStage::OnBeforeRecordCommands(const CommandEncoderView)
+	void TilePopulationStage::PrepareLightClusters()
+	{
+		m_clusterLights.Clear();
+		m_clusterPointLightCount = 0;
+
+		const Optional<Entity::CameraComponent*> pCamera = m_sceneView.GetActiveCameraComponentSafe();
+		if (pCamera.IsInvalid())
+		{
+			return;
+		}
+
+		const Math::WorldTransform cameraTransform = pCamera->GetWorldTransform();
+		const Math::Vector2ui renderResolution = m_sceneView.GetMatrices().GetRenderResolution();
+		const float tanHalfVerticalFieldOfView = Math::Tan(pCamera->GetFieldOfView().GetRadians() * 0.5f);
+		const float aspectRatio = (float)renderResolution.x / (float)Math::Max(renderResolution.y, 1u);
+		m_clusterGrid.m_nearPlane = pCamera->GetNearPlane().GetUnits();
+		m_clusterGrid.m_farPlane = pCamera->GetFarPlane().GetUnits();
+		m_clusterGrid.m_tanHalfFieldOfView = Math::Vector2f{tanHalfVerticalFieldOfView * aspectRatio, tanHalfVerticalFieldOfView};
+
+		// Cluster space matches the camera's local space with depth moved to z, the lighting pass derives it the same way
+		const Math::WorldCoordinate cameraLocation = cameraTransform.GetLocation();
+		const Math::Vector3f right = cameraTransform.GetRightColumn();
+		const Math::Vector3f forward = cameraTransform.GetForwardColumn();
+		const Math::Vector3f up = cameraTransform.GetUpColumn();
+		const auto getLightBounds = [cameraLocation, right, forward, up](const Math::Vector4f positionAndRadius)
+		{
+			const Math::Vector3f relativeLocation{
+				positionAndRadius.x - cameraLocation.x,
+				positionAndRadius.y - cameraLocation.y,
+				positionAndRadius.z - cameraLocation.z
+			};
+			return LightClusters::LightBounds{
+				Math::Vector3f{relativeLocation.Dot(right), relativeLocation.Dot(up), relativeLocation.Dot(forward)},
+				positionAndRadius.w
+			};
+		};
+
+		Threading::UniqueLock lock(m_clusterLightsMutex);
+		m_clusterLights.Reserve(m_pointLights.GetSize() + m_spotLights.GetSize());
+		for (const PointLightInfo& pointLight : m_pointLights)
+		{
+			m_clusterLights.EmplaceBack(getLightBounds(pointLight.positionAndRadius));
+		}
+		// Spot lights are bound by the sphere of their influence radius
+		for (const SpotLightInfo& spotLight : m_spotLights)
+		{
+			m_clusterLights.EmplaceBack(getLightBounds(spotLight.positionAndRadius));
+		}
+		m_clusterPointLightCount = m_pointLights.GetSize();
+	}
+
+	void TilePopulationStage::AssignLightClusterSlices(const uint32 firstSliceIndex, const uint32 sliceStep)
+	{
+		const uint32 sliceClusterCount = m_clusterGrid.GetSliceClusterCount();
+		for (uint32 sliceIndex = firstSliceIndex; sliceIndex < ClusterSliceCount; sliceIndex += sliceStep)
+		{
+			LightClusters::AssignSlice(
+				m_clusterGrid,
+				m_clusterLights.GetView(),
+				sliceIndex,
+				m_clusters.GetView().GetSubView(sliceIndex * sliceClusterCount, sliceClusterCount),
+				m_sliceLightIndices[sliceIndex]
+			);
+		}
+	}
+
+	void TilePopulationStage::UploadLightClusters(const Rendering::CommandEncoderView graphicsCommandEncoder)
+	{
+		const uint32 sliceClusterCount = m_clusterGrid.GetSliceClusterCount();
+		m_clusterLightIndices.Clear();
+		for (uint32 sliceIndex = 0; sliceIndex < ClusterSliceCount; ++sliceIndex)
+		{
+			LightClusters::AppendSlice(
+				m_clusters.GetView().GetSubView(sliceIndex * sliceClusterCount, sliceClusterCount),
+				m_sliceLightIndices[sliceIndex].GetView(),
+				m_clusterLightIndices
+			);
+		}
+		LightClusters::LimitLightIndexCount(m_clusters.GetView(), m_clusterLightIndices, MaximumClusterLightIndexCount);
+
+		const LightClustersHeader header{
+			Math::Vector4f{
+				m_clusterGrid.m_tanHalfFieldOfView.x,
+				m_clusterGrid.m_tanHalfFieldOfView.y,
+				m_clusterGrid.m_nearPlane,
+				m_clusterGrid.m_farPlane
+			},
+			Math::Vector4ui{ClusterTileCountX, ClusterTileCountY, ClusterSliceCount, m_clusterPointLightCount}
+		};
+
+		// The previous frame's lighting pass may still be reading the clusters
+		{
+			const Array<Rendering::BufferMemoryBarrier, 2> barriers{
+				Rendering::BufferMemoryBarrier{AccessFlags::ShaderRead, AccessFlags::TransferWrite, m_clusterBuffer, 0, ClusterBufferSize},
+				Rendering::BufferMemoryBarrier{
+					AccessFlags::ShaderRead,
+					AccessFlags::TransferWrite,
+					m_clusterLightIndexBuffer,
+					0,
+					ClusterLightIndexBufferSize
+				}
+			};
+			graphicsCommandEncoder.RecordPipelineBarrier(PipelineStageFlags::FragmentShader, PipelineStageFlags::Transfer, {}, barriers.GetView());
+		}
+
+		m_clusterStagingBuffer.Start();
+		const CommandQueueView graphicsCommandQueue = m_logicalDevice.GetCommandQueue(QueueFamily::Graphics);
+		m_clusterStagingBuffer
+			.CopyToBuffer(m_logicalDevice, graphicsCommandQueue, graphicsCommandEncoder, ConstByteView::Make(header), m_clusterBuffer);
+		m_clusterStagingBuffer.CopyToBuffer(
+			m_logicalDevice,
+			graphicsCommandQueue,
+			graphicsCommandEncoder,
+			ConstByteView(m_clusters.GetView()),
+			m_clusterBuffer,
+			sizeof(LightClustersHeader)
+		);
+		if (m_clusterLightIndices.HasElements())
+		{
+			m_clusterStagingBuffer.CopyToBuffer(
+				m_logicalDevice,
+				graphicsCommandQueue,
+				graphicsCommandEncoder,
+				ConstByteView(m_clusterLightIndices.GetView()),
+				m_clusterLightIndexBuffer
+			);
+		}
+
+		{
+			const Array<Rendering::BufferMemoryBarrier, 2> barriers{
+				Rendering::BufferMemoryBarrier{AccessFlags::TransferWrite, AccessFlags::ShaderRead, m_clusterBuffer, 0, ClusterBufferSize},
+				Rendering::BufferMemoryBarrier{
+					AccessFlags::TransferWrite,
+					AccessFlags::ShaderRead,
+					m_clusterLightIndexBuffer,
+					0,
+					ClusterLightIndexBufferSize
+				}
+			};
+			graphicsCommandEncoder.RecordPipelineBarrier(PipelineStageFlags::Transfer, PipelineStageFlags::FragmentShader, {}, barriers.GetView());
+		}
+	}
+
+	void TilePopulationStage::OnBeforeRecordCommands(const CommandEncoderView graphicsCommandEncoder)
 	{
 		if (WasSkipped())
 		{
@@ -627,6 +868,9 @@ namespace ngine::Rendering
 		{
 			UpdateLightBufferDescriptorSet();
 		}
+
+		// The cluster jobs finished before this stage's pass was queued
+		UploadLightClusters(graphicsCommandEncoder);
 	}
 
 	void TilePopulationStage::RecordComputePassCommands(
@@ -10,6 +10,7 @@
 #include <Common/Math/Matrix4x4.h>
 #include <Common/Memory/Containers/FlatVector.h>
 #include <Common/Storage/Identifier.h>
+#include <Common/Storage/IdentifierArray.h>
 #include <Common/Storage/IdentifierMask.h>
 
 namespace ngine::Entity
@@ -83,6 +84,11 @@ namespace ngine::Rendering
 		{
 			return m_visibleShadowCastingLights.GetView();
 		}
+		//! Gets the light rendered into each shadow map, cascades and cube faces of a light share its identifier
+		[[nodiscard]] ArrayView<const Entity::RenderItemIdentifier, ShadowMapIndexType> GetVisibleShadowCastingLightIdentifiers() const
+		{
+			return m_visibleShadowCastingLightIdentifiers.GetView();
+		}
 		[[nodiscard]] bool HasVisibleShadowCastingLights() const
 		{
 			return m_visibleShadowCastingLights.HasElements();
@@ -123,7 +129,15 @@ namespace ngine::Rendering
 		void OnSceneUnloaded();
 		void OnActiveCameraPropertiesChanged();
 	protected:
-		void UpdateLightBuffer();
+		[[nodiscard]] bool CanRasterizeShadows() const;
+		//! Assigns shadow maps to visible lights without one, until all shadow maps are taken
+		void AssignShadowMaps();
+		//! Recomputes the shadow matrices of a light with assigned shadow maps
+		void UpdateShadowMatrices(VisibleLight& light, const LightTypes lightType);
+#if !ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
+		//! Fits the cascades of a directional light to the active camera frustum
+		void UpdateDirectionalLightCascades(VisibleLight& light);
+#endif
 	protected:
 		SceneView& m_sceneView;
 		Optional<ShadowsStage*> m_pShadowsStage;
@@ -131,6 +145,13 @@ namespace ngine::Rendering
 		using LightContainer = Vector<VisibleLight>;
 		Array<LightContainer, (uint8)LightTypes::Count> m_visibleLights;
 		Entity::RenderItemMask m_visibleLightsMask;
+		//! Location of each visible light in m_visibleLights, lights are removed by swapping in the last light of their type
+		struct VisibleLightSlot
+		{
+			LightTypes m_type;
+			uint32 m_index;
+		};
+		TIdentifierArray<VisibleLightSlot, Entity::RenderItemIdentifier> m_visibleLightSlots;
 
 		DirectionalLightIndexType m_numDirectionalShadowingCastingLight = 0;
 
@@ -4,6 +4,7 @@
 #include "LightTypes.h"
 
 #include <Common/Math/Matrix4x4.h>
+#include <Common/Math/Vector4.h>
 
 namespace ngine::Rendering
 {
@@ -47,6 +48,15 @@ namespace ngine::Rendering
 #endif
 	};
 
+	//! Froxel grid the lighting pass uses to find the clustered lights of a fragment
+	struct LightClustersHeader
+	{
+		//! Tangents of half the horizontal and vertical field of view, followed by the near and far depth of the grid
+		Math::Vector4f tanHalfFieldOfViewAndDepthRange;
+		//! Tile and slice counts followed by the number of point lights, clustered light indices past it refer to spot lights
+		Math::Vector4ui gridSizeAndPointLightCount;
+	};
+
 	inline static constexpr Array<size, 3> LightHeaderSizes = {
 		size(0),
 		size(0),
@@ -60,8 +70,8 @@ namespace ngine::Rendering
 
 	inline static constexpr bool SupportCubemapArrays = false;
 
-	inline static constexpr uint16 MaximumPointLightCount = 32;
-	inline static constexpr uint16 MaximumSpotLightCount = 2;
+	inline static constexpr uint16 MaximumPointLightCount = 1024;
+	inline static constexpr uint16 MaximumSpotLightCount = 256;
 	inline static constexpr uint16 MaximumDirectionalLightCount = 1;
 	inline static constexpr uint8 MaximumEnvironmentLightCount = SupportCubemapArrays ? 8 : 1;
 
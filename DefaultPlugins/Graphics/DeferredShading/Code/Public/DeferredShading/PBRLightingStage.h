@@ -160,6 +160,11 @@ namespace ngine::Rendering
 		virtual void
 		OnActiveCameraPropertiesChanged(const CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer) override;
 
+		//! The descriptor set is populated again every frame before recording
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override
+		{
+			return true;
+		}
 		virtual void OnBeforeRecordCommands(const CommandEncoderView) override;
 		virtual void RecordRenderPassCommands(
 			RenderCommandEncoder&, const ViewMatrices&, const Math::Rectangleui renderArea, const uint8 subpassIndex
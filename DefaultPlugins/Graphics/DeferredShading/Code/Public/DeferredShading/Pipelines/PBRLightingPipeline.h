@@ -63,6 +63,8 @@ namespace ngine::Rendering
 #if ENABLE_SAMPLE_DISTRIBUTION_SHADOW_MAPS
 			ShadowInfoBuffer,
 #endif
+			LightClustersBuffer,
+			LightClusterIndicesBuffer,
 			Count
 		};
 
@@ -5,10 +5,13 @@
 #include <Common/Threading/AtomicBool.h>
 #include <Common/Math/Matrix4x4.h>
 #include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Bitset.h>
 #include <Common/Storage/IdentifierMask.h>
 
 #include <Renderer/Stages/RenderItemStage.h>
 #include <Renderer/Stages/VisibleStaticMeshes.h>
+#include <Renderer/Scene/ShadowCasters.h>
 
 #include <Renderer/Wrappers/RenderPass.h>
 #include <Renderer/Wrappers/Framebuffer.h>
@@ -23,6 +26,7 @@
 #include <Renderer/Assets/Texture/LoadedTextureFlags.h>
 #include <Renderer/Assets/Texture/MipMask.h>
 #include <Renderer/Devices/PhysicalDeviceFeatures.h>
+#include <Renderer/Commands/RenderCommandEncoderView.h>
 
 #include <DeferredShading/Pipelines/ShadowsPipeline.h>
 #include <DeferredShading/Pipelines/SDSMPipelines.h>
@@ -133,6 +137,11 @@ namespace ngine::Rendering
 		) override;
 
 		[[nodiscard]] virtual bool ShouldRecordCommands() const override;
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override
+		{
+			return m_shouldUpdateLightBufferDescriptorSet;
+		}
+		virtual void OnBeforeRecordCommands(const CommandEncoderView commandEncoder) override;
 		virtual void RecordCommands(const CommandEncoderView commandEncoder) override;
 		[[nodiscard]] virtual EnumFlags<PipelineStageFlags> GetPipelineStageFlags() const override
 		{
@@ -159,6 +168,24 @@ namespace ngine::Rendering
 #endif
 
 		void UpdateLightBuffer(const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer);
+
+		using ShadowCasters = Vector<ShadowCaster, uint32>;
+
+		struct CachedShadowMap
+		{
+			Entity::RenderItemIdentifier m_lightIdentifier;
+			Math::Matrix4x4f m_viewProjectionMatrix;
+			//! Casters the shadow map contents were rendered with
+			ShadowCasters m_shadowCasters;
+		};
+
+		//! Assigns the casters found by the octree traversal to each shadow map volume, and invalidates the shadow maps whose casters or light changed
+		//! The volumes are passed on to the view, so that the next traversal culls octree nodes against them and collects casters outside the view
+		void BuildShadowCasterSets();
+		//! Forces all shadow maps to be rendered again, i.e. when their contents were lost
+		void InvalidateShadowMaps();
+		//! Draws the casters, merging consecutive instances of the same instance group into one draw
+		void DrawShadowCasters(const ArrayView<const ShadowCaster, uint32> shadowCasters, const RenderCommandEncoderView renderCommandEncoder) const;
 	protected:
 		State m_state;
 		SceneView& m_sceneView;
@@ -184,6 +211,10 @@ namespace ngine::Rendering
 		Threading::Mutex m_textureLoadMutex;
 
 		StorageBuffer m_shadowGenInfoBuffer;
+		//! Size of the shadow generation info written by the last UpdateLightBuffer
+		uint32 m_shadowGenInfoSize{0};
+		//! Set when the light buffer descriptor is out of date, applied before recording as earlier frames may still read the descriptor
+		Threading::Atomic<bool> m_shouldUpdateLightBufferDescriptorSet{false};
 
 		Array<LightGatheringStage::SDSMLightInfo, LightGatheringStage::MaximumDirectionalLightCount> m_sdsmLightInfos;
 
@@ -192,5 +223,18 @@ namespace ngine::Rendering
 		bool m_loadedResources{false};
 
 		Rendering::VisibleStaticMeshes m_visibleStaticMeshes;
+		//! Static meshes inside the view or a shadow caster volume that are considered as shadow casters
+		Entity::RenderItemMask m_shadowCasterRenderItems;
+		//! Shadow casters that were added, reset or moved since the shadow maps were last rendered
+		Entity::RenderItemMask m_changedShadowCasterRenderItems;
+		//! Shadow casters removed since the shadow maps were last rendered, invalidates the shadow maps that were rendered with them
+		Entity::RenderItemMask m_removedShadowCasterRenderItems;
+		//! Casters intersecting the volume of each shadow map in the current frame, sorted by instance group and instance
+		Array<ShadowCasters, MaximumShadowmapCount> m_shadowMapCasters;
+		//! State each shadow map was last rendered with, used to skip shadow maps whose contents are still valid
+		Array<CachedShadowMap, MaximumShadowmapCount> m_cachedShadowMaps;
+		Bitset<MaximumShadowmapCount> m_invalidatedShadowMaps;
+		//! Casters intersecting any shadow map, used when all shadow maps are rendered in one layered pass
+		ShadowCasters m_combinedShadowCasters;
 	};
 }
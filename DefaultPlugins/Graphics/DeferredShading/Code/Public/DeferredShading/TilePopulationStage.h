@@ -3,6 +3,11 @@
 #include <Common/Asset/Guid.h>
 #include <Common/Threading/AtomicInteger.h>
 #include <Common/Threading/AtomicBool.h>
+#include <Common/Threading/Jobs/IntermediateStage.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Storage/IdentifierArray.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/UniqueRef.h>
 
 #include <Renderer/Stages/RenderItemStage.h>
 
@@ -15,6 +20,8 @@
 #include <Renderer/Buffers/StagingBuffer.h>
 #include <Renderer/Assets/Texture/TextureIdentifier.h>
 #include <Renderer/Assets/Texture/LoadedTextureFlags.h>
+#include <Renderer/Scene/LightClusters.h>
+#include <Renderer/Stages/PerFrameStagingBuffer.h>
 
 #include <DeferredShading/Pipelines/TilePopulationPipeline.h>
 #include <DeferredShading/LightTypes.h>
@@ -38,6 +45,16 @@ namespace ngine::Rendering
 		inline static constexpr Asset::Guid Guid = "F141B823-5844-4FBC-B106-0635FF52199C"_asset;
 		inline static constexpr Asset::Guid ClustersTextureAssetGuid = "9fcf4ee6-86dd-45dc-90a1-702dabdfe926"_asset;
 
+		//! Froxel grid point and spot lights are assigned to on the CPU each frame
+		inline static constexpr uint32 ClusterTileCountX = 16;
+		inline static constexpr uint32 ClusterTileCountY = 9;
+		inline static constexpr uint32 ClusterSliceCount = 24;
+		inline static constexpr uint32 ClusterCount = ClusterTileCountX * ClusterTileCountY * ClusterSliceCount;
+		//! Clusters past the limit are cut short, spread over every cluster this leaves room for ~75 lights each
+		inline static constexpr uint32 MaximumClusterLightIndexCount = 262144;
+		inline static constexpr size ClusterBufferSize = sizeof(LightClustersHeader) + sizeof(LightClusters::Cluster) * ClusterCount;
+		inline static constexpr size ClusterLightIndexBufferSize = sizeof(uint32) * MaximumClusterLightIndexCount;
+
 		TilePopulationStage(SceneView& sceneView);
 		virtual ~TilePopulationStage();
 
@@ -58,6 +75,17 @@ namespace ngine::Rendering
 			return m_lightStorageBufferSizes[(uint8)lightType];
 		}
 
+		//! Header followed by the light index range of each cluster, indexed by slice, then tile row, then tile column
+		[[nodiscard]] BufferView GetClusterBuffer() const
+		{
+			return m_clusterBuffer;
+		}
+		//! Point and spot light indices referenced by the cluster ranges
+		[[nodiscard]] BufferView GetClusterLightIndexBuffer() const
+		{
+			return m_clusterLightIndexBuffer;
+		}
+
 		[[nodiscard]] static Math::Vector2ui CalculateTileSize(const Math::Vector2ui renderResolution);
 
 		void SetPBRLightingStage(PBRLightingStage& stage)
@@ -125,6 +153,10 @@ namespace ngine::Rendering
 			const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer
 		) override;
 
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override
+		{
+			return m_shouldUpdateLightBuffer;
+		}
 		virtual void OnBeforeRecordCommands(const CommandEncoderView) override;
 		virtual void RecordComputePassCommands(
 			const Rendering::ComputeCommandEncoderView, const Rendering::ViewMatrices&, const uint8 subpassIndex
@@ -157,7 +189,16 @@ namespace ngine::Rendering
 		void UpdateLightBuffer(const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer&);
 		void UpdateLightBufferDescriptorSet();
 		void PopulateTileDescriptorSet(const Rendering::DescriptorSetView descriptorSet);
+
+		//! Fits the cluster grid to the active camera and gathers the view space bounds of the uploaded point and spot lights
+		void PrepareLightClusters();
+		//! Assigns lights to every slice from the given one on, stepping over the slices handled by other jobs
+		void AssignLightClusterSlices(const uint32 firstSliceIndex, const uint32 sliceStep);
+		//! Merges the assigned slices and uploads them for the lighting pass
+		void UploadLightClusters(const Rendering::CommandEncoderView graphicsCommandEncoder);
 	protected:
+		struct ClusterStartJob;
+		struct ClusterSliceJob;
 		SceneView& m_sceneView;
 		LightGatheringStage m_lightGatheringStage;
 		Optional<PBRLightingStage*> m_pPBRLightingStage;
@@ -173,6 +214,14 @@ namespace ngine::Rendering
 		Array<StorageBuffer, (uint8)LightTypes::Count - 1> m_lightStorageBuffers;
 		Array<size, (uint8)LightTypes::Count - 1> m_lightStorageBufferSizes{Memory::Zeroed};
 		Array<Vector<ReferenceWrapper<const Entity::LightSourceComponent>>, (uint8)LightTypes::Count> m_visibleLights;
+		Entity::RenderItemMask m_visibleLightsMask;
+		//! Index of each visible light in its type's container, lights are removed by swapping in the last light of their type
+		struct VisibleLightSlot
+		{
+			LightTypes m_type;
+			uint32 m_index;
+		};
+		TIdentifierArray<VisibleLightSlot, Entity::RenderItemIdentifier> m_visibleLightSlots;
 		Threading::Mutex m_descriptorMutex;
 		Threading::EngineJobRunnerThread* m_pDescriptorSetLoadingThread = nullptr;
 
@@ -180,8 +229,30 @@ namespace ngine::Rendering
 
 		Array<LightHeader, (uint8)LightTypes::Count, LightTypes> m_lightHeaders{Memory::Zeroed};
 
+		//! Guards the point and spot lights between notifications and the cluster start job
+		Threading::Mutex m_clusterLightsMutex;
 		FlatVector<PointLightInfo, MaximumLightCounts[(uint8)LightTypes::PointLight]> m_pointLights;
 		FlatVector<SpotLightInfo, MaximumLightCounts[(uint8)LightTypes::SpotLight]> m_spotLights;
 		FlatVector<DirectionalLightInfo, MaximumLightCounts[(uint8)LightTypes::DirectionalLight]> m_directionalLights;
+
+		//! Clusters are built once the visibility passes notified the stage, as start job -> slice jobs -> finished stage -> this stage's pass
+		UniqueRef<ClusterStartJob> m_pClusterStartJob;
+		Vector<UniquePtr<ClusterSliceJob>> m_clusterSliceJobs;
+		Threading::IntermediateStage m_clustersFinishedStage{"Light Clusters Finished"};
+
+		LightClusters::Grid m_clusterGrid{
+			Math::Vector2ui{ClusterTileCountX, ClusterTileCountY}, ClusterSliceCount, 0.1f, 1000.f, Math::Vector2f{1.f, 1.f}
+		};
+		//! Point lights followed by spot lights, in the order of the light buffers
+		Vector<LightClusters::LightBounds, uint32> m_clusterLights;
+		uint32 m_clusterPointLightCount = 0;
+		Vector<LightClusters::Cluster, uint32> m_clusters;
+		//! Light indices of each slice, written by the slice jobs and merged before recording
+		Vector<Vector<uint32, uint32>, uint32> m_sliceLightIndices;
+		Vector<uint32, uint32> m_clusterLightIndices;
+
+		PerFrameStagingBuffer m_clusterStagingBuffer;
+		StorageBuffer m_clusterBuffer;
+		StorageBuffer m_clusterLightIndexBuffer;
 	};
 }
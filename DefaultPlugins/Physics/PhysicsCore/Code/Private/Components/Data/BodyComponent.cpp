@@ -356,7 +356,10 @@ namespace ngine::Physics::Data
 		worldTransform.SetRotation(rotation);
 		worldTransformComponent = worldTransform;
 
-		const Math::WorldTransform parentWorldTransform = *worldTransformSceneData.GetComponentImplementation(owner.GetParent().GetIdentifier()
+		const Math::WorldTransform parentWorldTransform = owner.GetRootSceneComponent().GetResolvedWorldTransform(
+			owner.GetParent().GetIdentifier(),
+			worldTransformSceneData,
+			localTransformSceneData
 		);
 
 		Entity::Data::LocalTransform3D& localTransformComponent = *localTransformSceneData.GetComponentImplementation(identifier);
@@ -367,15 +370,20 @@ namespace ngine::Physics::Data
 		owner.OnWorldTransformChanged(Entity::TransformChangeFlags::ChangedByPhysics);
 		owner.OnWorldTransformChangedEvent(Entity::TransformChangeFlags::ChangedByPhysics);
 
-		for (Entity::Component3D& child : owner.GetChildren())
+		// Children are resolved in the scene's batched transform update, unless the scene propagates immediately
+		if (owner.HasChildren() &&
+		    !owner.GetRootSceneComponent().QueueChildTransformPropagation(owner, Entity::TransformChangeFlags::ChangedByPhysics))
 		{
-			child.OnParentWorldTransformChanged(
-				worldTransform,
-				worldTransformSceneData,
-				localTransformSceneData,
-				flagsSceneData,
-				Entity::TransformChangeFlags::ChangedByPhysics
-			);
+			for (Entity::Component3D& child : owner.GetChildren())
+			{
+				child.OnParentWorldTransformChanged(
+					worldTransform,
+					worldTransformSceneData,
+					localTransformSceneData,
+					flagsSceneData,
+					Entity::TransformChangeFlags::ChangedByPhysics
+				);
+			}
 		}
 
 		Assert(owner.IsRegisteredInTree());
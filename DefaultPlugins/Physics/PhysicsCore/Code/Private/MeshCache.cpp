@@ -108,6 +108,8 @@ namespace ngine::Physics
 				Threading::IntermediateStage& finishedLoadingStage = Threading::CreateIntermediateStage();
 				finishedLoadingStage.AddSubsequentStage(intermediateStage.GetFinishedStage());
 
+				// Keep the vertex data from being evicted until the shape was created from it
+				renderMeshCache.AcquireMeshData(renderMeshIdentifier);
 				Threading::JobBatch loadMeshJobBatch = renderMeshCache.TryLoadStaticMesh(
 					renderMeshIdentifier,
 					Rendering::MeshCache::MeshLoadListenerData{
@@ -138,6 +140,8 @@ namespace ngine::Physics
 							targetVertexPositions++;
 						}
 
+						renderMeshCache.ReleaseMeshData(renderMeshIdentifier);
+
 						const float convexRadius = 0.05f;
 						JPH::ConvexHullShapeSettings hullShapeSettings(position.GetData(), position.GetSize(), convexRadius);
 						JPH::ShapeSettings::ShapeResult result = hullShapeSettings.Create();
@@ -209,6 +213,8 @@ namespace ngine::Physics
 				Threading::IntermediateStage& finishedLoadingStage = Threading::CreateIntermediateStage();
 				finishedLoadingStage.AddSubsequentStage(intermediateStage.GetFinishedStage());
 
+				// Keep the vertex data from being evicted until the shape was created from it
+				renderMeshCache.AcquireMeshData(renderMeshIdentifier);
 				Threading::JobBatch loadMeshJobBatch = renderMeshCache.TryLoadStaticMesh(
 					renderMeshIdentifier,
 					Rendering::MeshCache::MeshLoadListenerData{
@@ -221,7 +227,7 @@ namespace ngine::Physics
 					}
 				);
 				Threading::Job& createFromRenderMeshJob = Threading::CreateCallback(
-					[this, identifier, &renderMesh](Threading::JobRunnerThread&)
+					[this, identifier, &renderMesh, &renderMeshCache, renderMeshIdentifier](Threading::JobRunnerThread&)
 					{
 						const ArrayView<const Rendering::VertexPosition, Rendering::Index> vertexPositions = renderMesh.GetVertexPositions();
 						ArrayView<const Rendering::Index, Rendering::Index> sourceIndices = renderMesh.GetIndices();
@@ -254,6 +260,8 @@ namespace ngine::Physics
 							sourceIndices += 3;
 						}
 
+						renderMeshCache.ReleaseMeshData(renderMeshIdentifier);
+
 						meshSettings.mMaterials.resize(1);
 						meshSettings.mMaterials[0] = nullptr;
 
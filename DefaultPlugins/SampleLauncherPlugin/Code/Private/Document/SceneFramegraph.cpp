@@ -1042,6 +1042,7 @@ namespace ngine::App::UI
 		UniquePtr<FramegraphBuilder> pFramegraphBuilder{Memory::ConstructInPlace};
 		FramegraphBuilder& framegraphBuilder = *pFramegraphBuilder;
 		SceneFramegraphBuilder::Build(framegraphBuilder, sceneView);
+		framegraphBuilder.MergeRenderPasses();
 		Framegraph::Compile(framegraphBuilder.GetStages(), jobBatchOut);
 	}
 }
@@ -177,6 +177,8 @@ namespace ngine::Rendering
 
 		m_framegraph.Reset();
 
+		framegraphBuilder.MergeRenderPasses();
+
 		Threading::JobBatch jobBatch;
 		m_framegraph.Compile(framegraphBuilder.GetStages(), jobBatch);
 
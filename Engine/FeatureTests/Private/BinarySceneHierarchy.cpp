@@ -0,0 +1,114 @@
+#include <Common/Memory/New.h>
+
+#include <Engine/Scene/Scene.h>
+#include <Engine/Entity/Component3D.inl>
+#include <Engine/Entity/RootSceneComponent.h>
+#include <Engine/Entity/ComponentType.h>
+#include <Engine/Entity/ComponentTypeSceneData.h>
+#include <Engine/Entity/Scene/BinaryScene.h>
+#include <Engine/Tests/FeatureTest.h>
+
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Serialization/SerializedData.h>
+#include <Common/Serialization/Reader.h>
+#include <Common/Serialization/Writer.h>
+#include <Common/Threading/Jobs/JobBatch.h>
+#include <Common/Threading/Jobs/JobRunnerThread.inl>
+#include <Common/Reflection/Registry.inl>
+
+namespace ngine::Tests
+{
+	static void RunJobBatch(Threading::JobBatch& jobBatch)
+	{
+		if (!jobBatch.IsValid())
+		{
+			return;
+		}
+
+		bool finished = false;
+		jobBatch.QueueAsNewFinishedStage(Threading::CreateCallback(
+			[&finished](Threading::JobRunnerThread&)
+			{
+				finished = true;
+			},
+			Threading::JobPriority::LoadScene
+		));
+
+		Threading::JobRunnerThread& thread = *Threading::JobRunnerThread::GetCurrent();
+		thread.Queue(jobBatch);
+		while (!finished)
+		{
+			thread.DoRunNextJob();
+		}
+	}
+
+	FEATURE_TEST(Components, BinarySceneDeserializeIntoPopulatedHierarchy)
+	{
+		Entity::SceneRegistry sceneRegistry;
+		UniquePtr<Scene> pScene = UniquePtr<Scene>::Make(
+			sceneRegistry,
+			Optional<Entity::HierarchyComponentBase*>{},
+			1024_meters,
+			"{7D2B94E1-5C3A-4F08-B6E2-19A4C8D73F50}"_guid,
+			Scene::Flags::IsDisabled
+		);
+
+		Entity::RootSceneComponent& rootComponent = pScene->GetRootComponent();
+		Entity::ComponentTypeSceneData<Entity::Component3D>& typeSceneData =
+			*sceneRegistry.GetOrCreateComponentTypeData<Entity::Component3D>();
+
+		const Optional<Entity::Component3D*> pParent = typeSceneData.CreateInstance(Entity::Component3D::Initializer{rootComponent});
+		ASSERT_TRUE(pParent.IsValid());
+		const Optional<Entity::Component3D*> pFirstChild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pParent});
+		ASSERT_TRUE(pFirstChild.IsValid());
+		const Optional<Entity::Component3D*> pSecondChild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pParent});
+		ASSERT_TRUE(pSecondChild.IsValid());
+		const Optional<Entity::Component3D*> pGrandchild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pFirstChild});
+		ASSERT_TRUE(pGrandchild.IsValid());
+		pSecondChild->SetRelativeLocation(Math::Vector3f{0.f, 0.f, 3.f});
+
+		Serialization::Data data(rapidjson::Type::kObjectType, Serialization::ContextFlags::ToDisk);
+		{
+			Serialization::Writer writer(data);
+			ASSERT_TRUE(writer.SerializeInPlace(*pParent));
+		}
+
+		Vector<ByteType> compiledScene;
+		ASSERT_TRUE(Entity::BinaryScene::Compile(Serialization::Reader(data), compiledScene));
+		const Entity::BinaryScene binaryScene(compiledScene.GetView());
+		ASSERT_TRUE(binaryScene.IsValid());
+
+		// Existing children are found by their instance guid and deserialized in place instead of being duplicated
+		{
+			Threading::JobBatch jobBatch = pParent->DeserializeDataComponentsAndChildren(binaryScene);
+			RunJobBatch(jobBatch);
+		}
+		EXPECT_EQ(pParent->GetChildCount(), 2u);
+		EXPECT_EQ(pFirstChild->GetChildCount(), 1u);
+		EXPECT_EQ(pSecondChild->GetChildCount(), 0u);
+
+		// Missing children are spawned from the compiled properties
+		const Guid secondChildInstanceGuid = pSecondChild->GetInstanceGuid();
+		pSecondChild->Destroy(sceneRegistry);
+		EXPECT_EQ(pParent->GetChildCount(), 1u);
+		{
+			Threading::JobBatch jobBatch = pParent->DeserializeDataComponentsAndChildren(binaryScene);
+			RunJobBatch(jobBatch);
+		}
+		ASSERT_EQ(pParent->GetChildCount(), 2u);
+		EXPECT_EQ(pFirstChild->GetChildCount(), 1u);
+
+		uint32 restoredChildCount = 0;
+		for (const Entity::Component3D& child : pParent->GetChildren())
+		{
+			if (child.GetInstanceGuid() == secondChildInstanceGuid)
+			{
+				restoredChildCount++;
+				EXPECT_NEAR(child.GetRelativeLocation().z, 3.f, 0.0001f);
+			}
+		}
+		EXPECT_EQ(restoredChildCount, 1u);
+
+		pParent->Destroy(sceneRegistry);
+	}
+}
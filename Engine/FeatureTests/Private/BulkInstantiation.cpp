@@ -0,0 +1,125 @@
+#include <Common/Memory/New.h>
+
+#include <Engine/Scene/Scene.h>
+#include <Engine/Entity/Component3D.inl>
+#include <Engine/Entity/RootSceneComponent.h>
+#include <Engine/Entity/ComponentType.h>
+#include <Engine/Entity/ComponentTypeSceneData.h>
+#include <Engine/Entity/Data/WorldTransform.h>
+#include <Engine/Entity/Manager.h>
+#include <Engine/Entity/Scene/ComponentTemplateCache.h>
+#include <Engine/Tests/FeatureTest.h>
+
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Jobs/JobRunnerThread.inl>
+#include <Common/Reflection/Registry.inl>
+
+namespace ngine::Tests
+{
+	FEATURE_TEST(Components, BulkInstantiation)
+	{
+		Entity::SceneRegistry sceneRegistry;
+		UniquePtr<Scene> pScene = UniquePtr<Scene>::Make(
+			sceneRegistry,
+			Optional<Entity::HierarchyComponentBase*>{},
+			1024_meters,
+			"{8F1C52A7-3D0B-4E96-B7A4-51C2E9D06F38}"_guid,
+			Scene::Flags::IsDisabled
+		);
+
+		Entity::RootSceneComponent& rootComponent = pScene->GetRootComponent();
+		Entity::ComponentTypeSceneData<Entity::Component3D>& typeSceneData =
+			*sceneRegistry.GetOrCreateComponentTypeData<Entity::Component3D>();
+
+		// Template of a root with a single child
+		const Optional<Entity::Component3D*> pSourceComponent = typeSceneData.CreateInstance(Entity::Component3D::Initializer{rootComponent});
+		ASSERT_TRUE(pSourceComponent.IsValid());
+		const Optional<Entity::Component3D*> pSourceChild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pSourceComponent});
+		ASSERT_TRUE(pSourceChild.IsValid());
+		pSourceChild->SetRelativeLocation(Math::Vector3f{0.f, 0.f, 2.f});
+
+		Entity::ComponentTemplateCache& templateCache = System::Get<Entity::Manager>().GetComponentTemplateCache();
+		const Entity::ComponentTemplateIdentifier templateIdentifier = templateCache.FindOrRegister("{2E7A90C4-6B13-4F85-A2D9-C03B8E5F1A67}"_guid);
+		ASSERT_TRUE(templateCache.MigrateInstance(templateIdentifier, *pSourceComponent, sceneRegistry));
+		ASSERT_TRUE(templateCache.HasSceneLoaded(templateIdentifier));
+
+		const Optional<Entity::Component3D*> pParent = typeSceneData.CreateInstance(Entity::Component3D::Initializer{rootComponent});
+		ASSERT_TRUE(pParent.IsValid());
+
+		// Spans several chunks, including a partially filled last one
+		constexpr uint32 instanceCount = 100;
+		Vector<Math::WorldTransform> worldTransforms(Memory::Reserve, instanceCount);
+		for (uint32 index = 0; index < instanceCount; ++index)
+		{
+			worldTransforms.EmplaceBack(Math::WorldTransform{Math::Identity, Math::WorldCoordinate{(float)index, 0.f, 0.f}});
+		}
+
+		struct InstantiatedData
+		{
+			Vector<Optional<Entity::Component3D*>> m_instances;
+			Threading::Atomic<uint32> m_instantiatedCount{0};
+		};
+		InstantiatedData instantiatedData{Vector<Optional<Entity::Component3D*>>(Memory::ConstructWithSize, Memory::Zeroed, instanceCount)};
+
+		Threading::JobBatch jobBatch = templateCache.InstantiateBulk(
+			templateIdentifier,
+			*pParent,
+			sceneRegistry,
+			worldTransforms.GetView(),
+			[&instantiatedData](Entity::Component3D& instance, const uint32 instanceIndex)
+			{
+				// Every index is reported exactly once
+				EXPECT_TRUE(instantiatedData.m_instances[instanceIndex].IsInvalid());
+				instantiatedData.m_instances[instanceIndex] = instance;
+				instantiatedData.m_instantiatedCount.FetchAdd(1);
+			}
+		);
+		ASSERT_TRUE(jobBatch.IsValid());
+
+		Threading::JobRunnerThread& thread = *Threading::JobRunnerThread::GetCurrent();
+		thread.Queue(jobBatch);
+		while (instantiatedData.m_instantiatedCount.Load() < instanceCount)
+		{
+			thread.DoRunNextJob();
+		}
+
+		EXPECT_EQ(pParent->GetChildCount(), instanceCount);
+		for (uint32 index = 0; index < instanceCount; ++index)
+		{
+			const Optional<Entity::Component3D*> pInstance = instantiatedData.m_instances[index];
+			ASSERT_TRUE(pInstance.IsValid());
+			EXPECT_NEAR(pInstance->GetWorldLocation().x, (float)index, 0.0001f);
+
+			// Children of the template are cloned along and keep their relative transform
+			ASSERT_EQ(pInstance->GetChildCount(), 1u);
+			for (const Entity::Component3D& instanceChild : pInstance->GetChildren())
+			{
+				EXPECT_NEAR(instanceChild.GetWorldLocation().x, (float)index, 0.0001f);
+				EXPECT_NEAR(instanceChild.GetWorldLocation().z, 2.f, 0.0001f);
+
+				// Children are created at their final transform, so nothing was left to propagate to them
+				const Math::WorldTransform storedChildTransform =
+					sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>().GetComponentImplementationUnchecked(instanceChild.GetIdentifier());
+				EXPECT_NEAR(storedChildTransform.GetLocation().x, (float)index, 0.0001f);
+			}
+		}
+
+		// An empty set of transforms instantiates nothing
+		const Threading::JobBatch emptyJobBatch = templateCache.InstantiateBulk(
+			templateIdentifier,
+			*pParent,
+			sceneRegistry,
+			{},
+			[](Entity::Component3D&, const uint32)
+			{
+				EXPECT_TRUE(false);
+			}
+		);
+		EXPECT_FALSE(emptyJobBatch.IsValid());
+
+		templateCache.Reset(templateIdentifier);
+		pParent->Destroy(sceneRegistry);
+		pSourceComponent->Destroy(sceneRegistry);
+	}
+}
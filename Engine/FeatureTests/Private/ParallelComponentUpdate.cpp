@@ -0,0 +1,172 @@
+#include <Common/Memory/New.h>
+
+#include <Engine/Scene/Scene.h>
+#include <Engine/Entity/Component3D.h>
+#include <Engine/Entity/RootSceneComponent.h>
+#include <Engine/Entity/ComponentType.h>
+#include <Engine/Entity/ComponentTypeSceneData.h>
+#include <Engine/Tests/FeatureTest.h>
+
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Reflection/Registry.inl>
+
+namespace ngine::Tests
+{
+	struct ParallelUpdateTestComponent final : public Entity::Component3D
+	{
+		using BaseType = Component3D;
+		inline static constexpr bool EnableParallelUpdate = true;
+
+		using BaseType::BaseType;
+
+		void Update()
+		{
+			m_updateCount++;
+			m_value = m_value * 3u + 1u;
+		}
+
+		uint32 m_updateCount{0};
+		uint32 m_value{0};
+	};
+
+	struct SerialUpdateTestComponent final : public Entity::Component3D
+	{
+		using BaseType = Component3D;
+
+		using BaseType::BaseType;
+
+		void Update()
+		{
+			m_updateCount++;
+			m_value = m_value * 3u + 1u;
+		}
+
+		uint32 m_updateCount{0};
+		uint32 m_value{0};
+	};
+}
+
+namespace ngine::Reflection
+{
+	template<>
+	struct ReflectedType<Tests::ParallelUpdateTestComponent>
+	{
+		inline static constexpr auto Type = Reflection::Reflect<Tests::ParallelUpdateTestComponent>(
+			"{4C0B3E1A-5F0E-4E61-9A53-0C6C3B0F7E21}"_guid,
+			MAKE_UNICODE_LITERAL("Parallel Update Test Component"),
+			TypeFlags::DisableUserInterfaceInstantiation | TypeFlags::DisableDynamicInstantiation
+		);
+	};
+
+	template<>
+	struct ReflectedType<Tests::SerialUpdateTestComponent>
+	{
+		inline static constexpr auto Type = Reflection::Reflect<Tests::SerialUpdateTestComponent>(
+			"{9E3D7B52-1A44-4C38-8F1B-2B6E0D5C9A07}"_guid,
+			MAKE_UNICODE_LITERAL("Serial Update Test Component"),
+			TypeFlags::DisableUserInterfaceInstantiation | TypeFlags::DisableDynamicInstantiation
+		);
+	};
+}
+
+namespace ngine::Tests
+{
+	static_assert(Entity::ComponentTypeSceneData<ParallelUpdateTestComponent>::EnableParallelUpdate);
+	static_assert(!Entity::ComponentTypeSceneData<SerialUpdateTestComponent>::EnableParallelUpdate);
+
+	template<typename ComponentType>
+	static void RunUpdateStage(Entity::ComponentTypeSceneData<ComponentType>& typeSceneData)
+	{
+		const Optional<Entity::ComponentStage*> pUpdateStage = typeSceneData.GetUpdateStage();
+		EXPECT_TRUE(pUpdateStage.IsValid());
+		if (pUpdateStage.IsInvalid())
+		{
+			return;
+		}
+
+		Threading::JobRunnerThread& thread = *Threading::JobRunnerThread::GetCurrent();
+		pUpdateStage->Queue(thread);
+		while (pUpdateStage->IsQueuedOrExecuting())
+		{
+			thread.DoRunNextJob();
+		}
+	}
+
+	template<typename ComponentType>
+	static void TestUpdateStage(const uint32 componentCount, const uint32 skippedComponentInterval)
+	{
+		System::Get<Reflection::Registry>().RegisterDynamicType<ComponentType>();
+		UniquePtr<Entity::ComponentType<ComponentType>> pComponentType = UniquePtr<Entity::ComponentType<ComponentType>>::Make();
+		System::Get<Entity::Manager>().GetRegistry().Register(pComponentType.Get());
+
+		{
+			Entity::SceneRegistry sceneRegistry;
+			UniquePtr<Scene> pScene = UniquePtr<Scene>::Make(
+				sceneRegistry,
+				Optional<Entity::HierarchyComponentBase*>{},
+				1024_meters,
+				"{6A2F4E0C-8D31-4B57-A1C9-3E5B7D2F0A64}"_guid,
+				Scene::Flags::IsDisabled
+			);
+
+			Entity::ComponentTypeSceneData<ComponentType>& typeSceneData =
+				*pScene->GetEntitySceneRegistry().template GetOrCreateComponentTypeData<ComponentType>();
+
+			Vector<ReferenceWrapper<ComponentType>, uint32> components(Memory::Reserve, componentCount);
+			for (uint32 index = 0; index < componentCount; ++index)
+			{
+				const Optional<ComponentType*> pComponent =
+					typeSceneData.CreateInstance(typename ComponentType::Initializer{pScene->GetRootComponent()});
+				ASSERT_TRUE(pComponent.IsValid());
+				components.EmplaceBack(*pComponent);
+				// Leave gaps in the update mask so that chunks contain unregistered components
+				if (index % skippedComponentInterval != 0)
+				{
+					EXPECT_TRUE(typeSceneData.EnableUpdate(*pComponent));
+				}
+			}
+
+			constexpr uint32 updateCount = 3;
+			for (uint32 updateIndex = 0; updateIndex < updateCount; ++updateIndex)
+			{
+				RunUpdateStage(typeSceneData);
+			}
+
+			// Every registered component was updated exactly once per run, and unregistered ones never
+			for (uint32 index = 0; index < componentCount; ++index)
+			{
+				const bool isRegistered = index % skippedComponentInterval != 0;
+				EXPECT_EQ(components[index]->m_updateCount, isRegistered ? updateCount : 0u);
+				EXPECT_EQ(components[index]->m_value, isRegistered ? 13u : 0u);
+			}
+
+			for (uint32 index = 0; index < componentCount; ++index)
+			{
+				if (index % skippedComponentInterval != 0)
+				{
+					EXPECT_TRUE(typeSceneData.DisableUpdate(*components[index]));
+				}
+			}
+		}
+
+		System::Get<Reflection::Registry>().DeregisterDynamicType<ComponentType>();
+		System::Get<Entity::Manager>().GetRegistry().Deregister(Reflection::GetTypeGuid<ComponentType>());
+	}
+
+	FEATURE_TEST(Components, ParallelUpdate)
+	{
+		// Spans several update chunks, including a partially filled last chunk
+		TestUpdateStage<ParallelUpdateTestComponent>(5000, 7);
+	}
+
+	FEATURE_TEST(Components, ParallelUpdateSingleChunk)
+	{
+		// Fewer components than a chunk falls back to updating on the stage's own job
+		TestUpdateStage<ParallelUpdateTestComponent>(100, 5);
+	}
+
+	FEATURE_TEST(Components, SerialUpdate)
+	{
+		TestUpdateStage<SerialUpdateTestComponent>(1200, 3);
+	}
+}
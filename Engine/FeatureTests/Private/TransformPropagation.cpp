@@ -0,0 +1,112 @@
+#include <Common/Memory/New.h>
+
+#include <Engine/Scene/Scene.h>
+#include <Engine/Entity/Component3D.inl>
+#include <Engine/Entity/RootSceneComponent.h>
+#include <Engine/Entity/ComponentType.h>
+#include <Engine/Entity/ComponentTypeSceneData.h>
+#include <Engine/Entity/Data/WorldTransform.h>
+#include <Engine/Tests/FeatureTest.h>
+
+#include <Common/Reflection/Registry.inl>
+
+namespace ngine::Tests
+{
+	[[nodiscard]] static Math::WorldCoordinate GetStoredWorldLocation(const Entity::Component3D& component, Entity::SceneRegistry& sceneRegistry)
+	{
+		const Math::WorldTransform worldTransform =
+			sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>().GetComponentImplementationUnchecked(component.GetIdentifier());
+		return worldTransform.GetLocation();
+	}
+
+	static void ExpectLocation(const Math::WorldCoordinate location, const Math::WorldCoordinate expectedLocation)
+	{
+		EXPECT_NEAR(location.x, expectedLocation.x, 0.0001f);
+		EXPECT_NEAR(location.y, expectedLocation.y, 0.0001f);
+		EXPECT_NEAR(location.z, expectedLocation.z, 0.0001f);
+	}
+
+	FEATURE_TEST(Components, DeferredTransformPropagation)
+	{
+		Entity::SceneRegistry sceneRegistry;
+		UniquePtr<Scene> pScene = UniquePtr<Scene>::Make(
+			sceneRegistry,
+			Optional<Entity::HierarchyComponentBase*>{},
+			1024_meters,
+			"{3B9E61D4-72C8-4F0A-9D15-8A4E2C7B6F03}"_guid,
+			Scene::Flags::IsDisabled
+		);
+		// Propagation is only deferred while the octree stages run
+		pScene->Enable();
+
+		Entity::RootSceneComponent& rootComponent = pScene->GetRootComponent();
+		Entity::ComponentTypeSceneData<Entity::Component3D>& typeSceneData =
+			*sceneRegistry.GetOrCreateComponentTypeData<Entity::Component3D>();
+
+		const Optional<Entity::Component3D*> pParent = typeSceneData.CreateInstance(Entity::Component3D::Initializer{rootComponent});
+		ASSERT_TRUE(pParent.IsValid());
+		const Optional<Entity::Component3D*> pChild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pParent});
+		ASSERT_TRUE(pChild.IsValid());
+		const Optional<Entity::Component3D*> pGrandchild = typeSceneData.CreateInstance(Entity::Component3D::Initializer{*pChild});
+		ASSERT_TRUE(pGrandchild.IsValid());
+
+		pChild->SetRelativeLocation(Math::Vector3f{1.f, 0.f, 0.f});
+		pGrandchild->SetRelativeLocation(Math::Vector3f{0.f, 1.f, 0.f});
+		rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+
+		uint32 grandchildChangeCount = 0;
+		pGrandchild->OnWorldTransformChangedEvent.Add(
+			grandchildChangeCount,
+			[](uint32& changeCount, const EnumFlags<Entity::TransformChangeFlags>)
+			{
+				changeCount++;
+			}
+		);
+
+		// Repeated moves of the parent are resolved once for the whole subtree
+		pParent->SetWorldLocation(Math::WorldCoordinate{5.f, 0.f, 0.f});
+		pParent->SetWorldLocation(Math::WorldCoordinate{10.f, 0.f, 0.f});
+
+		// Reads include the pending ancestor change before the batch ran
+		ExpectLocation(pChild->GetWorldLocation(), Math::WorldCoordinate{11.f, 0.f, 0.f});
+		ExpectLocation(pGrandchild->GetWorldLocation(), Math::WorldCoordinate{11.f, 1.f, 0.f});
+
+		// Setting a descendant's world transform is relative to its resolved parent, not the stale stored one
+		pChild->SetWorldRotation(Math::WorldQuaternion{Math::Identity});
+		ExpectLocation(pChild->GetWorldLocation(), Math::WorldCoordinate{11.f, 0.f, 0.f});
+		pGrandchild->SetWorldLocation(Math::WorldCoordinate{11.f, 3.f, 0.f});
+		const uint32 changeCountBeforeBatch = grandchildChangeCount;
+
+		rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+
+		ExpectLocation(GetStoredWorldLocation(*pChild, sceneRegistry), Math::WorldCoordinate{11.f, 0.f, 0.f});
+		ExpectLocation(GetStoredWorldLocation(*pGrandchild, sceneRegistry), Math::WorldCoordinate{11.f, 3.f, 0.f});
+		EXPECT_NEAR(pGrandchild->GetRelativeLocation().y, 3.f, 0.0001f);
+		EXPECT_LE(grandchildChangeCount - changeCountBeforeBatch, 1u);
+
+		// Nothing is left to resolve
+		rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+		ExpectLocation(GetStoredWorldLocation(*pGrandchild, sceneRegistry), Math::WorldCoordinate{11.f, 3.f, 0.f});
+
+		// Changes queued on unrelated components don't affect reads, and later queuing an ancestor is still picked up
+		const Optional<Entity::Component3D*> pUnrelated = typeSceneData.CreateInstance(Entity::Component3D::Initializer{rootComponent});
+		ASSERT_TRUE(pUnrelated.IsValid());
+		pUnrelated->SetWorldLocation(Math::WorldCoordinate{-5.f, 0.f, 0.f});
+		ExpectLocation(pGrandchild->GetWorldLocation(), Math::WorldCoordinate{11.f, 3.f, 0.f});
+		pParent->SetWorldLocation(Math::WorldCoordinate{12.f, 0.f, 0.f});
+		ExpectLocation(pGrandchild->GetWorldLocation(), Math::WorldCoordinate{13.f, 3.f, 0.f});
+		rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+		ExpectLocation(GetStoredWorldLocation(*pGrandchild, sceneRegistry), Math::WorldCoordinate{13.f, 3.f, 0.f});
+		pUnrelated->Destroy(sceneRegistry);
+
+		// Destroying a component with a pending change hands it to its children first
+		pParent->SetWorldLocation(Math::WorldCoordinate{20.f, 0.f, 0.f});
+		pGrandchild->OnWorldTransformChangedEvent.Remove(&grandchildChangeCount);
+		pChild->Destroy(sceneRegistry);
+		rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+		rootComponent.ProcessQueuedOctreeUpdates(sceneRegistry);
+
+		pParent->Destroy(sceneRegistry);
+		pScene->Disable();
+	}
+}
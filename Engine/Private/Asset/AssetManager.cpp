@@ -1,4 +1,5 @@
 #include "Asset/AssetManager.h"
+#include "Asset/BinaryAssetDatabase.h"
 
 #include "Engine.h"
 #include "Tag/TagContainer.inl"
@@ -21,6 +22,7 @@
 #include <Common/Asset/FolderAssetType.h>
 
 #include <Common/Serialization/Deserialize.h>
+#include <Common/Serialization/Serialize.h>
 #include <Common/Serialization/Guid.h>
 #include <Common/IO/FileIterator.h>
 
@@ -144,6 +146,19 @@ namespace ngine::Asset
 		System::Get<Log>().Close();
 	}
 
+	//! Checks whether a bundled asset database still contains its asset entries, keyed by asset guid
+	[[nodiscard]] static bool HasBundledAssetEntries(const Serialization::Reader assetDatabaseReader)
+	{
+		for (Serialization::Member<Serialization::Reader> member : assetDatabaseReader.GetMemberView())
+		{
+			if (Guid::TryParse(member.key).IsValid())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
 	Threading::JobBatch EngineManager::LoadDefaultResources()
 	{
 		Threading::JobBatch jobBatch;
@@ -222,33 +237,91 @@ namespace ngine::Asset
 							{
 								databaseRootDirectory = IO::Path::Combine(enginePath, relativePath);
 								const Identifier rootFolderAssetIdentifier = m_assetLibrary.FindOrRegisterFolder(databaseRootDirectory, Identifier{});
-								[[maybe_unused]] const bool wasLoaded =
-									m_assetLibrary.Load(assetDatabaseReader.value, databaseRootDirectory, rootFolderAssetIdentifier);
-								Assert(wasLoaded);
-
 								const Guid assetDatabaseGuid = *assetDatabaseReader.value.Read<Guid>("guid");
-								String jsonData = assetDatabaseReader.value.GetValue().SaveToBuffer<String>();
-								RegisterAsyncLoadCallback(
-									assetDatabaseGuid,
-									[jsonData = Move(jsonData)](
-										[[maybe_unused]] const Guid assetGuid,
-										[[maybe_unused]] const IO::PathView path,
-										const Threading::JobPriority priority,
-										IO::AsyncLoadCallback&& callback,
-										[[maybe_unused]] const ByteView target,
-										[[maybe_unused]] const Math::Range<size> dataRange
-									) -> Optional<Threading::Job*>
-									{
-										return Threading::CreateCallback(
-											[callback = Forward<IO::AsyncLoadCallback>(callback), jsonData = jsonData.GetView()](Threading::JobRunnerThread&)
-											{
-												callback(jsonData);
-											},
-											priority,
-											"Load asset database"
-										);
-									}
-								);
+
+								// Prefer the compiled database emitted during packaging, the bundle then only contains the database path and guid
+								const IO::Path binaryDatabasePath = BinaryDatabase::GetFilePath(databaseRootDirectory, assetDatabaseGuid);
+								UniquePtr<BinaryDatabase> pBinaryDatabase = UniquePtr<BinaryDatabase>::Make(binaryDatabasePath);
+								if (pBinaryDatabase->IsValid() &&
+								    m_assetLibrary.Load(Move(pBinaryDatabase), databaseRootDirectory, rootFolderAssetIdentifier))
+								{
+									// Only build the json representation if the database is explicitly requested
+									RegisterAsyncLoadCallback(
+										assetDatabaseGuid,
+										[binaryDatabasePath = IO::Path(binaryDatabasePath), databaseRootDirectory = IO::Path(databaseRootDirectory)](
+											const Guid assetGuid,
+											[[maybe_unused]] const IO::PathView path,
+											const Threading::JobPriority priority,
+											IO::AsyncLoadCallback&& callback,
+											[[maybe_unused]] const ByteView target,
+											[[maybe_unused]] const Math::Range<size> dataRange
+										) -> Optional<Threading::Job*>
+										{
+											return Threading::CreateCallback(
+												[callback = Forward<IO::AsyncLoadCallback>(callback),
+												 binaryDatabasePath = binaryDatabasePath.GetView(),
+												 databaseRootDirectory = databaseRootDirectory.GetView(),
+												 assetGuid](Threading::JobRunnerThread&)
+												{
+													const BinaryDatabase binaryDatabase(binaryDatabasePath);
+													Database database;
+													database.SetGuid(assetGuid);
+													for (const BinaryDatabase::Entry& entry : binaryDatabase.GetEntries())
+													{
+														database.RegisterAsset(
+															entry.m_guid,
+															binaryDatabase.CreateDatabaseEntry(entry, databaseRootDirectory),
+															databaseRootDirectory
+														);
+													}
+
+													Serialization::Data databaseData(rapidjson::kObjectType, Serialization::ContextFlags::ToBuffer);
+													[[maybe_unused]] const bool wasSerialized = Serialization::Serialize(databaseData, database);
+													Assert(wasSerialized);
+													const String jsonData = databaseData.SaveToBuffer<String>();
+													callback(jsonData.GetView());
+												},
+												priority,
+												"Load asset database"
+											);
+										}
+									);
+								}
+								else if (UNLIKELY_ERROR(!HasBundledAssetEntries(assetDatabaseReader.value)))
+								{
+									// Packaging strips the entries from the bundle once the compiled database was written, there is nothing to fall back to
+									LogError("Failed to load compiled asset database {}, and the bundle contains no asset entries", binaryDatabasePath);
+									AssertMessage(false, "Failed to load compiled asset database {}", binaryDatabasePath);
+								}
+								else
+								{
+									[[maybe_unused]] const bool wasLoaded =
+										m_assetLibrary.Load(assetDatabaseReader.value, databaseRootDirectory, rootFolderAssetIdentifier);
+									Assert(wasLoaded);
+
+									String jsonData = assetDatabaseReader.value.GetValue().SaveToBuffer<String>();
+									RegisterAsyncLoadCallback(
+										assetDatabaseGuid,
+										[jsonData = Move(jsonData)](
+											[[maybe_unused]] const Guid assetGuid,
+											[[maybe_unused]] const IO::PathView path,
+											const Threading::JobPriority priority,
+											IO::AsyncLoadCallback&& callback,
+											[[maybe_unused]] const ByteView target,
+											[[maybe_unused]] const Math::Range<size> dataRange
+										) -> Optional<Threading::Job*>
+										{
+											return Threading::CreateCallback(
+												[callback = Forward<IO::AsyncLoadCallback>(callback), jsonData = jsonData.GetView()](Threading::JobRunnerThread&)
+												{
+													callback(jsonData);
+												},
+												priority,
+												"Load asset database"
+											);
+										}
+									);
+								}
 							}
 							else
 							{
@@ -453,6 +526,7 @@ namespace ngine::Asset
 									RegisterAssetFolders(assetIdentifier, entry->m_path, rootFolderAssetIdentifier, tagIdentifiers);
 								}
 
+								ResolveAssetEntry(assetGuid);
 								{
 									Threading::SharedLock databaseLock(m_assetDatabaseMutex);
 									const Optional<DatabaseEntry*> pDatabaseEntry = Database::GetAssetEntry(assetGuid);
@@ -544,6 +618,276 @@ namespace ngine::Asset
 		return true;
 	}
 
+	bool EngineAssetDatabase::Load(
+		UniquePtr<BinaryDatabase>&& pDatabase,
+		const IO::PathView databaseRootDirectory,
+		const Identifier rootFolderAssetIdentifier,
+		const ArrayView<const Tag::Identifier, uint8> tagIdentifiers
+	)
+	{
+		if (UNLIKELY(pDatabase.IsInvalid() || !pDatabase->IsValid()))
+		{
+			return false;
+		}
+
+		// The database stays mapped, entries are created from it when an asset is first accessed
+		const BinaryDatabase& database = *pDatabase;
+		{
+			Threading::UniqueLock lock(m_compiledDatabasesMutex);
+			m_compiledDatabases.EmplaceBack(CompiledDatabase{Move(pDatabase), IO::Path(databaseRootDirectory)});
+		}
+
+		const ArrayView<const BinaryDatabase::Entry, uint32> entries = database.GetEntries();
+		Reserve(entries.GetSize());
+
+		Tag::Registry& tagRegistry = System::Get<Tag::Registry>();
+
+		// Acquire identifiers for new assets in bulk, assets we already know about are merged below
+		Vector<Identifier, uint32> assetIdentifiers(Memory::ConstructWithSize, Memory::DefaultConstruct, entries.GetSize());
+		Mask loadedAssetsMask;
+		uint32 newAssetCount = 0;
+		{
+			Threading::UniqueLock lock(m_assetIdentifierLookupMapMutex);
+			for (uint32 index = 0, count = entries.GetSize(); index < count; ++index)
+			{
+				const BinaryDatabase::Entry& entry = entries[index];
+				if (!m_assetIdentifierLookupMap.Contains(entry.m_guid))
+				{
+					const Identifier assetIdentifier = m_assetIdentifiers.AcquireIdentifier();
+					Assert(assetIdentifier.IsValid());
+					m_assets[assetIdentifier] = entry.m_guid;
+					m_assetIdentifierLookupMap.Emplace(Guid(entry.m_guid), Identifier(assetIdentifier));
+					assetIdentifiers[index] = assetIdentifier;
+					loadedAssetsMask.Set(assetIdentifier);
+					newAssetCount++;
+				}
+			}
+		}
+
+		// Only folders are created up front, as they are looked up by path when registering the hierarchy
+		{
+			Threading::UniqueLock lock(m_assetDatabaseMutex);
+			Threading::UniqueLock identifierLookupLock(m_identifierLookupMapMutex);
+			uint32 unresolvedAssetCount = 0;
+			for (uint32 index = 0, count = entries.GetSize(); index < count; ++index)
+			{
+				const Identifier assetIdentifier = assetIdentifiers[index];
+				if (assetIdentifier.IsValid())
+				{
+					const BinaryDatabase::Entry& entry = entries[index];
+					if (database.GetGuid(entry.m_assetTypeGuidIndex) == FolderAssetType::AssetFormat.assetTypeGuid)
+					{
+						auto it = m_assetMap.Emplace(Guid(entry.m_guid), database.CreateDatabaseEntry(entry, databaseRootDirectory));
+						Assert(it->second.m_path.HasElements());
+						m_identifierLookupMap.Emplace(IO::Path(it->second.m_path), Identifier(assetIdentifier));
+					}
+					else
+					{
+						m_unresolvedAssets.Set(assetIdentifier);
+						unresolvedAssetCount++;
+					}
+				}
+			}
+			m_unresolvedAssetCount += unresolvedAssetCount;
+		}
+
+		// Directories are interned, so each one only needs its folders registered once
+		UnorderedMap<uint32, Identifier> directoryFolderIdentifiers;
+		for (uint32 index = 0, count = entries.GetSize(); index < count; ++index)
+		{
+			const BinaryDatabase::Entry& entry = entries[index];
+			const Identifier assetIdentifier = assetIdentifiers[index];
+			if (assetIdentifier.IsInvalid())
+			{
+				const Identifier existingAssetIdentifier = RegisterAssetInternal(
+					entry.m_guid,
+					database.CreateDatabaseEntry(entry, databaseRootDirectory),
+					rootFolderAssetIdentifier,
+					tagIdentifiers
+				);
+				loadedAssetsMask.Set(existingAssetIdentifier);
+				continue;
+			}
+
+			const Guid assetTypeGuid = database.GetGuid(entry.m_assetTypeGuidIndex);
+			if (assetTypeGuid != FolderAssetType::AssetFormat.assetTypeGuid && rootFolderAssetIdentifier.IsValid())
+			{
+				auto folderIt = directoryFolderIdentifiers.Find(entry.m_directory.m_offset);
+				if (folderIt != directoryFolderIdentifiers.end())
+				{
+					const Identifier folderAssetIdentifier = folderIt->second;
+					m_assetParentIndices[assetIdentifier] = folderAssetIdentifier.GetIndex();
+					m_tags.Set(tagRegistry.FindOrRegister(GetAssetGuid(folderAssetIdentifier)), assetIdentifier);
+				}
+				else
+				{
+					RegisterAssetFolders(assetIdentifier, database.GetPath(entry, databaseRootDirectory), rootFolderAssetIdentifier, tagIdentifiers);
+					directoryFolderIdentifiers.Emplace(
+						uint32(entry.m_directory.m_offset),
+						Identifier::MakeFromIndex(m_assetParentIndices[assetIdentifier])
+					);
+				}
+			}
+
+			if (assetTypeGuid.IsValid())
+			{
+				m_tags.Set(tagRegistry.FindOrRegister(assetTypeGuid), assetIdentifier);
+			}
+
+			for (const Tag::Guid tagGuid : database.GetGuids(entry.m_tags))
+			{
+				m_tags.Set(tagRegistry.FindOrRegister(tagGuid), assetIdentifier);
+			}
+
+			for (const Tag::Identifier tagIdentifier : tagIdentifiers)
+			{
+				m_tags.Set(tagIdentifier, assetIdentifier);
+			}
+
+			if (assetTypeGuid == TagAssetType::AssetFormat.assetTypeGuid)
+			{
+				tagRegistry.RegisterAsset(entry.m_guid);
+			}
+		}
+
+		m_assetCount += newAssetCount;
+		OnAssetsAdded(loadedAssetsMask);
+		OnDataChanged();
+		return true;
+	}
+
+	bool EngineAssetDatabase::IsAssetEntryUnresolved(const Identifier assetIdentifier) const
+	{
+		if (m_unresolvedAssetCount.Load() == 0 || assetIdentifier.IsInvalid())
+		{
+			return false;
+		}
+
+		Threading::SharedLock lock(m_assetDatabaseMutex);
+		return m_unresolvedAssets.IsSet(assetIdentifier);
+	}
+
+	void EngineAssetDatabase::ResolveCompiledAssetEntry(const Guid assetGuid) const
+	{
+		const Identifier assetIdentifier = GetAssetIdentifier(assetGuid);
+		if (!IsAssetEntryUnresolved(assetIdentifier))
+		{
+			return;
+		}
+
+		// Create the entry outside of the database lock, only the insertion is exclusive
+		Optional<DatabaseEntry> entry;
+		{
+			Threading::SharedLock lock(m_compiledDatabasesMutex);
+			for (const CompiledDatabase& compiledDatabase : m_compiledDatabases)
+			{
+				if (const Optional<const BinaryDatabase::Entry*> pEntry = compiledDatabase.m_pDatabase->FindEntry(assetGuid))
+				{
+					entry = compiledDatabase.m_pDatabase->CreateDatabaseEntry(*pEntry, compiledDatabase.m_rootDirectory);
+					break;
+				}
+			}
+		}
+		Assert(entry.IsValid());
+		if (UNLIKELY_ERROR(entry.IsInvalid()))
+		{
+			return;
+		}
+
+		EngineAssetDatabase& database = const_cast<EngineAssetDatabase&>(*this);
+		Threading::UniqueLock lock(database.m_assetDatabaseMutex);
+		if (!database.m_unresolvedAssets.IsSet(assetIdentifier))
+		{
+			// Another thread resolved the entry in the meantime
+			return;
+		}
+		database.m_unresolvedAssets.Clear(assetIdentifier);
+
+		auto it = database.m_assetMap.Emplace(Guid(assetGuid), Move(*entry));
+		Assert(it->second.m_path.HasElements());
+		{
+			Threading::UniqueLock identifierLookupLock(database.m_identifierLookupMapMutex);
+			database.m_identifierLookupMap.Emplace(IO::Path(it->second.m_path), Identifier(assetIdentifier));
+		}
+		database.m_unresolvedAssetCount.FetchSubtract(1);
+	}
+
+	void EngineAssetDatabase::ResolveAssetEntryAndReferences(const Guid assetGuid) const
+	{
+		if (m_unresolvedAssetCount.Load() == 0)
+		{
+			return;
+		}
+
+		Vector<Guid> queuedAssets;
+		queuedAssets.EmplaceBack(assetGuid);
+		Mask visitedAssets;
+		while (queuedAssets.HasElements())
+		{
+			const Guid queuedAssetGuid = queuedAssets.PopAndGetBack();
+			const Identifier assetIdentifier = GetAssetIdentifier(queuedAssetGuid);
+			if (assetIdentifier.IsInvalid() || visitedAssets.IsSet(assetIdentifier))
+			{
+				continue;
+			}
+			visitedAssets.Set(assetIdentifier);
+
+			ResolveCompiledAssetEntry(queuedAssetGuid);
+
+			Threading::SharedLock lock(m_assetDatabaseMutex);
+			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(queuedAssetGuid))
+			{
+				queuedAssets.CopyEmplaceRangeBack(pEntry->m_dependencies.GetView());
+				queuedAssets.CopyEmplaceRangeBack(pEntry->m_containerContents.GetView());
+				if (pEntry->m_thumbnailGuid.IsValid())
+				{
+					queuedAssets.EmplaceBack(pEntry->m_thumbnailGuid);
+				}
+			}
+		}
+	}
+
+	void EngineAssetDatabase::ResolveAllAssetEntries() const
+	{
+		if (m_unresolvedAssetCount.Load() == 0)
+		{
+			return;
+		}
+
+		Mask unresolvedAssets;
+		{
+			Threading::SharedLock lock(m_assetDatabaseMutex);
+			unresolvedAssets = m_unresolvedAssets;
+		}
+
+		for (const Identifier::IndexType identifierIndex : unresolvedAssets.GetSetBitsIterator())
+		{
+			ResolveCompiledAssetEntry(GetAssetGuid(Identifier::MakeFromValidIndex(identifierIndex)));
+		}
+	}
+
+	Identifier EngineAssetDatabase::FindCompiledAssetIdentifier(const IO::PathView path) const
+	{
+		if (m_unresolvedAssetCount.Load() == 0)
+		{
+			return {};
+		}
+
+		Threading::SharedLock lock(m_compiledDatabasesMutex);
+		for (const CompiledDatabase& compiledDatabase : m_compiledDatabases)
+		{
+			if (path.IsRelativeTo(compiledDatabase.m_rootDirectory))
+			{
+				if (const Optional<const BinaryDatabase::Entry*> pEntry =
+				      compiledDatabase.m_pDatabase->FindEntryByPath(path.GetRelativeToParent(compiledDatabase.m_rootDirectory)))
+				{
+					return GetAssetIdentifier(pEntry->m_guid);
+				}
+			}
+		}
+		return {};
+	}
+
 	bool Manager::Load(
 		[[maybe_unused]] const IO::PathView databaseFilePath,
 		const Serialization::Reader reader,
@@ -605,6 +949,7 @@ namespace ngine::Asset
 									RegisterAssetFolders(assetIdentifier, entry->m_path, rootFolderAssetIdentifier, tagIdentifiers);
 								}
 
+								ResolveAssetEntry(assetGuid);
 								{
 									Threading::SharedLock databaseLock(m_assetDatabaseMutex);
 									const Optional<DatabaseEntry*> pDatabaseEntry = Database::GetAssetEntry(assetGuid);
@@ -753,10 +1098,12 @@ namespace ngine::Asset
 					mainAssetPath = IO::Path::Combine(folderPath, folderPath.GetFileName());
 				}
 
+				const Guid mainAssetGuid = GetAssetGuid(mainAssetPath);
+				ResolveAssetEntry(mainAssetGuid);
 				{
 					Threading::SharedLock lock(m_assetDatabaseMutex);
 					const Optional<DatabaseEntry*> pFolderEntry = Database::GetAssetEntry(GetAssetGuid(folderAssetIdentifier));
-					const Optional<DatabaseEntry*> pMainAssetEntry = Database::GetAssetEntry(GetAssetGuid(mainAssetPath));
+					const Optional<DatabaseEntry*> pMainAssetEntry = Database::GetAssetEntry(mainAssetGuid);
 					if (pFolderEntry.IsValid() && pMainAssetEntry.IsValid() && pFolderEntry->m_assetTypeGuid != pMainAssetEntry->m_assetTypeGuid)
 					{
 						pFolderEntry->SetName(pMainAssetEntry->GetName());
@@ -999,6 +1346,9 @@ namespace ngine::Asset
 			return assetIdentifier;
 		}
 
+		// Dependencies are read from the library under a single lock, so make sure all referenced entries exist first
+		m_assetLibrary.ResolveAssetEntryAndReferences(libraryAssetReference.GetAssetGuid());
+
 		Threading::SharedLock lock(m_assetLibrary.m_assetDatabaseMutex);
 		return ImportInternal(libraryAssetReference, libraryAssetEntry, assetsMask, flags, tagIdentifiers);
 	}
@@ -1534,6 +1884,7 @@ namespace ngine::Asset
 					RegisterAssetFolders(assetIdentifier, entry.m_path, rootFolderAssetIdentifier, tagIdentifiers);
 				}
 
+				ResolveAssetEntry(assetGuid);
 				{
 					Threading::SharedLock databaseLock(m_assetDatabaseMutex);
 					const Optional<DatabaseEntry*> pDatabaseEntry = Database::GetAssetEntry(assetGuid);
@@ -1643,6 +1994,8 @@ namespace ngine::Asset
 
 	void EngineAssetDatabase::RemoveAsset(const Guid assetGuid)
 	{
+		// Resolve first so that the path is removed from the lookup map along with the entry
+		ResolveAssetEntry(assetGuid);
 		{
 			Threading::UniqueLock databaseLock(m_assetDatabaseMutex);
 
@@ -1922,6 +2275,7 @@ namespace ngine::Asset
 	{
 		const Identifier assetIdentifier = data.GetExpected<Identifier>();
 		const Guid assetGuid = m_assets[assetIdentifier];
+		ResolveAssetEntry(assetGuid);
 
 		if (const Optional<const DatabaseEntry*> pAssetEntry = GetAssetEntry(assetGuid))
 		{
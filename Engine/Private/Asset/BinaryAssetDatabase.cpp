@@ -0,0 +1,530 @@
+#include "Asset/BinaryAssetDatabase.h"
+
+#include <Common/Asset/AssetDatabase.h>
+#include <Common/Algorithms/Sort.h>
+#include <Common/IO/File.h>
+#include <Common/Memory/Align.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Serialization/Serialize.h>
+#include <Common/Serialization/Deserialize.h>
+
+#if PLATFORM_WINDOWS
+#include <Common/Platform/Windows.h>
+#define HAS_FILE_MAPPING 1
+#elif PLATFORM_APPLE || PLATFORM_LINUX || PLATFORM_ANDROID
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define HAS_FILE_MAPPING 1
+#else
+#define HAS_FILE_MAPPING 0
+#endif
+
+namespace ngine::Asset
+{
+	inline static constexpr uint32 SectionAlignment = 16;
+
+	BinaryDatabase::BinaryDatabase(const IO::PathView filePath)
+	{
+		const IO::Path path(filePath);
+#if PLATFORM_WINDOWS
+		const HANDLE fileHandle =
+			CreateFileW(path.GetZeroTerminated(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (fileHandle != INVALID_HANDLE_VALUE)
+		{
+			LARGE_INTEGER fileSize;
+			if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+			{
+				m_pFileMappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (m_pFileMappingHandle != nullptr)
+				{
+					m_pMappedData = MapViewOfFile(m_pFileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+					m_mappedSize = (size)fileSize.QuadPart;
+				}
+			}
+			CloseHandle(fileHandle);
+		}
+#elif HAS_FILE_MAPPING
+		const int fileDescriptor = open(path.GetZeroTerminated(), O_RDONLY);
+		if (fileDescriptor >= 0)
+		{
+			struct stat fileStatus;
+			if (fstat(fileDescriptor, &fileStatus) == 0 && fileStatus.st_size > 0)
+			{
+				void* pMappedData = mmap(nullptr, (size_t)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+				if (pMappedData != MAP_FAILED)
+				{
+					m_pMappedData = pMappedData;
+					m_mappedSize = (size)fileStatus.st_size;
+				}
+			}
+			close(fileDescriptor);
+		}
+#else
+		const IO::File file(path, IO::AccessModeFlags::Read | IO::AccessModeFlags::Binary, IO::SharingFlags::DisallowWrite);
+		if (file.IsValid())
+		{
+			m_fileData.Resize((uint32)file.GetSize());
+			if (!file.ReadIntoView(m_fileData.GetView()))
+			{
+				m_fileData.Clear();
+			}
+		}
+#endif
+
+		if (m_pMappedData != nullptr)
+		{
+			[[maybe_unused]] const bool isValid = Initialize(ConstByteView{reinterpret_cast<const ByteType*>(m_pMappedData), m_mappedSize});
+		}
+		else if (m_fileData.HasElements())
+		{
+			[[maybe_unused]] const bool isValid = Initialize(m_fileData.GetView());
+		}
+	}
+
+	BinaryDatabase::BinaryDatabase(const ConstByteView data)
+	{
+		[[maybe_unused]] const bool isValid = Initialize(data);
+	}
+
+	BinaryDatabase::~BinaryDatabase()
+	{
+#if PLATFORM_WINDOWS
+		if (m_pMappedData != nullptr)
+		{
+			UnmapViewOfFile(m_pMappedData);
+		}
+		if (m_pFileMappingHandle != nullptr)
+		{
+			CloseHandle(m_pFileMappingHandle);
+		}
+#elif HAS_FILE_MAPPING
+		if (m_pMappedData != nullptr)
+		{
+			munmap(m_pMappedData, (size_t)m_mappedSize);
+		}
+#endif
+	}
+
+	bool BinaryDatabase::Initialize(const ConstByteView data)
+	{
+		if (data.GetDataSize() < sizeof(Header))
+		{
+			return false;
+		}
+
+		const Header& header = *reinterpret_cast<const Header*>(data.GetData());
+		if (header.m_magic != Magic || header.m_version != Version || header.m_pathCharacterSize != sizeof(PathCharType) ||
+		    header.m_nameCharacterSize != sizeof(NameCharType))
+		{
+			return false;
+		}
+
+		const uint64 dataSize = data.GetDataSize();
+		const auto isSectionValid = [dataSize](const uint32 offset, const uint64 sectionSize)
+		{
+			return offset % SectionAlignment == 0 && (uint64)offset + sectionSize <= dataSize;
+		};
+		if (!isSectionValid(header.m_entriesOffset, (uint64)header.m_entryCount * sizeof(Entry)) ||
+		    !isSectionValid(header.m_guidsOffset, (uint64)header.m_guidCount * sizeof(Guid)) ||
+		    !isSectionValid(header.m_stringDataOffset, header.m_stringDataSize) ||
+		    !isSectionValid(header.m_pathsOffset, (uint64)header.m_entryCount * sizeof(PathEntry)))
+		{
+			return false;
+		}
+
+		const ArrayView<const Entry, uint32> entries{
+			reinterpret_cast<const Entry*>(data.GetData() + header.m_entriesOffset),
+			header.m_entryCount
+		};
+		const ArrayView<const PathEntry, uint32> paths{
+			reinterpret_cast<const PathEntry*>(data.GetData() + header.m_pathsOffset),
+			header.m_entryCount
+		};
+
+		// Entries are only ever accessed in place, so every range is checked once up front instead of on each access
+		const uint32 guidCount = header.m_guidCount;
+		const uint32 stringDataSize = header.m_stringDataSize;
+		const auto isStringValid = [stringDataSize](const StringRange range, const uint32 characterSize)
+		{
+			return range.m_offset % characterSize == 0 && (uint64)range.m_offset + (uint64)range.m_count * characterSize <= stringDataSize;
+		};
+		const auto isGuidIndexValid = [guidCount](const uint32 index)
+		{
+			return index == InvalidGuidIndex || index < guidCount;
+		};
+		const auto isGuidRangeValid = [guidCount](const GuidRange range)
+		{
+			return (uint64)range.m_index + range.m_count <= guidCount;
+		};
+		for (uint32 index = 0, count = entries.GetSize(); index < count; ++index)
+		{
+			const Entry& entry = entries[index];
+			const bool isValid = isStringValid(entry.m_directory, sizeof(PathCharType)) && isStringValid(entry.m_fileName, sizeof(PathCharType)) &&
+			                     isStringValid(entry.m_name, sizeof(NameCharType)) &&
+			                     isStringValid(entry.m_description, sizeof(NameCharType)) && isStringValid(entry.m_metaData, sizeof(char)) &&
+			                     isGuidIndexValid(entry.m_assetTypeGuidIndex) && isGuidIndexValid(entry.m_componentTypeGuidIndex) &&
+			                     isGuidIndexValid(entry.m_thumbnailGuidIndex) && isGuidRangeValid(entry.m_tags) &&
+			                     isGuidRangeValid(entry.m_dependencies) && isGuidRangeValid(entry.m_containerContents) &&
+			                     paths[index].m_entryIndex < count;
+			// Lookups binary search both tables
+			const bool isSorted = index == 0 ||
+			                      (IsLess(entries[index - 1].m_guid, entry.m_guid) && paths[index - 1].m_hash <= paths[index].m_hash);
+			if (UNLIKELY(!isValid || !isSorted))
+			{
+				return false;
+			}
+		}
+
+		m_pHeader = &header;
+		m_entries = entries;
+		m_guids = ArrayView<const Guid, uint32>{reinterpret_cast<const Guid*>(data.GetData() + header.m_guidsOffset), header.m_guidCount};
+		m_paths = paths;
+		m_stringData = ConstByteView{data.GetData() + header.m_stringDataOffset, header.m_stringDataSize};
+		return true;
+	}
+
+	IO::Path BinaryDatabase::GetFilePath(const IO::PathView databaseRootDirectory, const Guid databaseGuid)
+	{
+		return IO::Path::Combine(databaseRootDirectory, IO::Path::Merge(databaseGuid.ToString().GetView(), FileExtension));
+	}
+
+	bool BinaryDatabase::IsLess(const Guid& left, const Guid& right)
+	{
+		const ByteType* pLeft = reinterpret_cast<const ByteType*>(&left);
+		const ByteType* pRight = reinterpret_cast<const ByteType*>(&right);
+		for (uint8 index = 0; index < sizeof(Guid); ++index)
+		{
+			if (pLeft[index] != pRight[index])
+			{
+				return pLeft[index] < pRight[index];
+			}
+		}
+		return false;
+	}
+
+	Optional<const BinaryDatabase::Entry*> BinaryDatabase::FindEntry(const Guid assetGuid) const
+	{
+		uint32 first = 0;
+		uint32 count = m_entries.GetSize();
+		while (count > 0)
+		{
+			const uint32 step = count / 2;
+			const uint32 middle = first + step;
+			if (IsLess(m_entries[middle].m_guid, assetGuid))
+			{
+				first = middle + 1;
+				count -= step + 1;
+			}
+			else
+			{
+				count = step;
+			}
+		}
+
+		if (first < m_entries.GetSize() && m_entries[first].m_guid == assetGuid)
+		{
+			return &m_entries[first];
+		}
+		return Invalid;
+	}
+
+	uint64 BinaryDatabase::HashPath(const IO::PathView relativeDirectory, const IO::PathView fileName)
+	{
+		// 64-bit FNV-1a over the directory and file name, separated so that moving characters between them changes the hash
+		uint64 hash = 14695981039346656037ull;
+		const auto append = [&hash](const IO::PathView path)
+		{
+			const ConstByteView data{reinterpret_cast<const ByteType*>(path.GetStringView().GetData()), path.GetStringView().GetDataSize()};
+			for (const ByteType byte : data)
+			{
+				hash ^= (uint64)byte;
+				hash *= 1099511628211ull;
+			}
+		};
+		append(relativeDirectory);
+		hash ^= 0xFFu;
+		hash *= 1099511628211ull;
+		append(fileName);
+		return hash;
+	}
+
+	Optional<const BinaryDatabase::Entry*> BinaryDatabase::FindEntryByPath(const IO::PathView relativePath) const
+	{
+		const IO::PathView relativeDirectory = relativePath.GetParentPath();
+		const IO::PathView fileName = relativePath.GetFileName();
+		const uint64 hash = HashPath(relativeDirectory, fileName);
+
+		uint32 first = 0;
+		uint32 count = m_paths.GetSize();
+		while (count > 0)
+		{
+			const uint32 step = count / 2;
+			const uint32 middle = first + step;
+			if (m_paths[middle].m_hash < hash)
+			{
+				first = middle + 1;
+				count -= step + 1;
+			}
+			else
+			{
+				count = step;
+			}
+		}
+
+		for (; first < m_paths.GetSize() && m_paths[first].m_hash == hash; ++first)
+		{
+			const Entry& entry = m_entries[m_paths[first].m_entryIndex];
+			if (GetFileName(entry) == fileName && GetRelativeDirectory(entry) == relativeDirectory)
+			{
+				return &entry;
+			}
+		}
+		return Invalid;
+	}
+
+	IO::PathView BinaryDatabase::GetPathString(const StringRange range) const
+	{
+		const PathCharType* pCharacters = reinterpret_cast<const PathCharType*>(m_stringData.GetData() + range.m_offset);
+		return IO::PathView{IO::PathView::ConstStringViewType{pCharacters, range.m_count}};
+	}
+
+	ConstUnicodeStringView BinaryDatabase::GetName(const Entry& entry) const
+	{
+		const NameCharType* pCharacters = reinterpret_cast<const NameCharType*>(m_stringData.GetData() + entry.m_name.m_offset);
+		return ConstUnicodeStringView{pCharacters, entry.m_name.m_count};
+	}
+
+	ConstUnicodeStringView BinaryDatabase::GetDescription(const Entry& entry) const
+	{
+		const NameCharType* pCharacters = reinterpret_cast<const NameCharType*>(m_stringData.GetData() + entry.m_description.m_offset);
+		return ConstUnicodeStringView{pCharacters, entry.m_description.m_count};
+	}
+
+	ConstStringView BinaryDatabase::GetMetaData(const Entry& entry) const
+	{
+		const char* pCharacters = reinterpret_cast<const char*>(m_stringData.GetData() + entry.m_metaData.m_offset);
+		return ConstStringView{pCharacters, entry.m_metaData.m_count};
+	}
+
+	IO::Path BinaryDatabase::GetPath(const Entry& entry, const IO::PathView databaseRootDirectory) const
+	{
+		const IO::PathView relativeDirectory = GetRelativeDirectory(entry);
+		if (relativeDirectory.HasElements())
+		{
+			return IO::Path::Combine(IO::Path::Combine(databaseRootDirectory, relativeDirectory), GetFileName(entry));
+		}
+		return IO::Path::Combine(databaseRootDirectory, GetFileName(entry));
+	}
+
+	DatabaseEntry BinaryDatabase::CreateDatabaseEntry(const Entry& entry, const IO::PathView databaseRootDirectory) const
+	{
+		DatabaseEntry databaseEntry{
+			GetGuid(entry.m_assetTypeGuidIndex),
+			GetGuid(entry.m_componentTypeGuidIndex),
+			GetPath(entry, databaseRootDirectory),
+			UnicodeString(GetName(entry)),
+			UnicodeString(GetDescription(entry)),
+			GetGuid(entry.m_thumbnailGuidIndex),
+			GetGuids(entry.m_tags),
+			GetGuids(entry.m_dependencies),
+			GetGuids(entry.m_containerContents)
+		};
+
+		const ConstStringView metaData = GetMetaData(entry);
+		if (metaData.HasElements())
+		{
+			const Serialization::Data metaDataSerializationData(metaData);
+			Assert(metaDataSerializationData.IsValid());
+			if (LIKELY(metaDataSerializationData.IsValid()))
+			{
+				[[maybe_unused]] const bool wasRead = Serialization::Deserialize(metaDataSerializationData, databaseEntry.m_metaData);
+				Assert(wasRead);
+			}
+		}
+		return databaseEntry;
+	}
+
+	template<typename StringViewType>
+	[[nodiscard]] static BinaryDatabase::StringRange AppendString(Vector<ByteType>& stringData, const StringViewType string)
+	{
+		using CharType = typename StringViewType::CharType;
+
+		// Keep every string aligned to its character size so it can be viewed in place
+		const uint32 offset = Memory::Align(stringData.GetSize(), (uint32)sizeof(CharType));
+		stringData.Resize(offset);
+		stringData.CopyEmplaceRangeBack(
+			ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(string.GetData()), (uint32)(string.GetSize() * sizeof(CharType))}
+		);
+		return BinaryDatabase::StringRange{offset, (uint32)string.GetSize()};
+	}
+
+	[[nodiscard]] static uint32 InternGuid(Vector<Guid>& guids, UnorderedMap<Guid, uint32, Guid::Hash>& guidIndices, const Guid guid)
+	{
+		if (!guid.IsValid())
+		{
+			return BinaryDatabase::InvalidGuidIndex;
+		}
+
+		auto it = guidIndices.Find(guid);
+		if (it != guidIndices.end())
+		{
+			return it->second;
+		}
+
+		const uint32 index = guids.GetSize();
+		guids.EmplaceBack(guid);
+		guidIndices.Emplace(Guid(guid), uint32(index));
+		return index;
+	}
+
+	[[nodiscard]] static BinaryDatabase::GuidRange AppendGuids(Vector<Guid>& guids, const ArrayView<const Guid, uint32> newGuids)
+	{
+		const uint32 index = guids.GetSize();
+		guids.CopyEmplaceRangeBack(newGuids);
+		return BinaryDatabase::GuidRange{index, newGuids.GetSize()};
+	}
+
+	bool BinaryDatabase::Serialize(const Database& database, const IO::PathView databaseRootDirectory, Vector<ByteType>& output)
+	{
+		Vector<Entry> entries;
+		entries.Reserve(database.GetAssetCount());
+		Vector<Guid> guids;
+		UnorderedMap<Guid, uint32, Guid::Hash> guidIndices;
+		Vector<ByteType> stringData;
+		UnorderedMap<IO::Path, StringRange, IO::Path::Hash> directoryRanges;
+
+		bool failedAny = false;
+		database.IterateAssets(
+			[&entries, &guids, &guidIndices, &stringData, &directoryRanges, &failedAny, databaseRootDirectory](
+				const Guid assetGuid,
+				const DatabaseEntry& databaseEntry
+			)
+			{
+				const IO::Path relativePath(databaseEntry.m_path.GetRelativeToParent(databaseRootDirectory));
+				if (UNLIKELY(relativePath.IsEmpty()))
+				{
+					failedAny = true;
+					return Memory::CallbackResult::Continue;
+				}
+
+				Entry entry{};
+				entry.m_guid = assetGuid;
+
+				// Assets are mostly grouped in few directories, so directories are only stored once
+				const IO::PathView relativeDirectory = relativePath.GetParentPath();
+				auto directoryIt = directoryRanges.Find(relativeDirectory);
+				if (directoryIt != directoryRanges.end())
+				{
+					entry.m_directory = directoryIt->second;
+				}
+				else
+				{
+					entry.m_directory = AppendString(stringData, relativeDirectory.GetStringView());
+					directoryRanges.Emplace(IO::Path(relativeDirectory), StringRange(entry.m_directory));
+				}
+				entry.m_fileName = AppendString(stringData, relativePath.GetFileName().GetStringView());
+
+				const UnicodeString name(databaseEntry.GetName());
+				entry.m_name = AppendString(stringData, name.GetView());
+				entry.m_description = AppendString(stringData, databaseEntry.m_description.GetView());
+
+				// Meta data is rare and free-form, so it is kept in its serialized form and only parsed for assets that have any
+				Serialization::Data metaDataSerializationData(rapidjson::kObjectType, Serialization::ContextFlags::ToBuffer);
+				if (Serialization::Serialize(metaDataSerializationData, databaseEntry.m_metaData) &&
+				    metaDataSerializationData.GetDocument().IsObject() && !metaDataSerializationData.GetDocument().ObjectEmpty())
+				{
+					const String metaData = metaDataSerializationData.SaveToBuffer<String>();
+					entry.m_metaData = AppendString(stringData, metaData.GetView());
+				}
+
+				entry.m_assetTypeGuidIndex = InternGuid(guids, guidIndices, databaseEntry.m_assetTypeGuid);
+				entry.m_componentTypeGuidIndex = InternGuid(guids, guidIndices, databaseEntry.m_componentTypeGuid);
+				entry.m_thumbnailGuidIndex = InternGuid(guids, guidIndices, databaseEntry.m_thumbnailGuid);
+				entry.m_tags = AppendGuids(guids, databaseEntry.m_tags.GetView());
+				entry.m_dependencies = AppendGuids(guids, databaseEntry.m_dependencies.GetView());
+				entry.m_containerContents = AppendGuids(guids, databaseEntry.m_containerContents.GetView());
+
+				entries.EmplaceBack(entry);
+				return Memory::CallbackResult::Continue;
+			}
+		);
+
+		Algorithms::Sort(
+			entries.begin(),
+			entries.end(),
+			[](const Entry& left, const Entry& right)
+			{
+				return IsLess(left.m_guid, right.m_guid);
+			}
+		);
+
+		Vector<PathEntry> paths;
+		paths.Reserve(entries.GetSize());
+		for (uint32 index = 0, count = entries.GetSize(); index < count; ++index)
+		{
+			const Entry& entry = entries[index];
+			const IO::PathView relativeDirectory{IO::PathView::ConstStringViewType{
+				reinterpret_cast<const PathCharType*>(stringData.GetData() + entry.m_directory.m_offset),
+				entry.m_directory.m_count
+			}};
+			const IO::PathView fileName{IO::PathView::ConstStringViewType{
+				reinterpret_cast<const PathCharType*>(stringData.GetData() + entry.m_fileName.m_offset),
+				entry.m_fileName.m_count
+			}};
+			paths.EmplaceBack(PathEntry{HashPath(relativeDirectory, fileName), index, 0});
+		}
+		Algorithms::Sort(
+			paths.begin(),
+			paths.end(),
+			[](const PathEntry& left, const PathEntry& right)
+			{
+				return left.m_hash < right.m_hash;
+			}
+		);
+
+		Header header{};
+		header.m_magic = Magic;
+		header.m_version = Version;
+		header.m_pathCharacterSize = sizeof(PathCharType);
+		header.m_nameCharacterSize = sizeof(NameCharType);
+		header.m_entryCount = entries.GetSize();
+		header.m_guidCount = guids.GetSize();
+		header.m_stringDataSize = stringData.GetSize();
+		header.m_entriesOffset = Memory::Align((uint32)sizeof(Header), SectionAlignment);
+		header.m_guidsOffset = Memory::Align(header.m_entriesOffset + (uint32)entries.GetDataSize(), SectionAlignment);
+		header.m_stringDataOffset = Memory::Align(header.m_guidsOffset + (uint32)guids.GetDataSize(), SectionAlignment);
+		header.m_pathsOffset = Memory::Align(header.m_stringDataOffset + header.m_stringDataSize, SectionAlignment);
+
+		output.Reserve(output.GetSize() + header.m_pathsOffset + paths.GetDataSize());
+		const uint32 baseOffset = output.GetSize();
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(&header), sizeof(Header)});
+		output.Resize(baseOffset + header.m_entriesOffset);
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(entries.GetData()), entries.GetDataSize()});
+		output.Resize(baseOffset + header.m_guidsOffset);
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(guids.GetData()), guids.GetDataSize()});
+		output.Resize(baseOffset + header.m_stringDataOffset);
+		output.CopyEmplaceRangeBack(stringData.GetView());
+		output.Resize(baseOffset + header.m_pathsOffset);
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(paths.GetData()), paths.GetDataSize()});
+		return !failedAny;
+	}
+
+	bool BinaryDatabase::Save(const Database& database, const IO::PathView databaseRootDirectory, const IO::PathView filePath)
+	{
+		Vector<ByteType> data;
+		if (!Serialize(database, databaseRootDirectory, data))
+		{
+			return false;
+		}
+
+		const IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+		if (UNLIKELY(!file.IsValid()))
+		{
+			return false;
+		}
+		return file.Write(data.GetView()) == data.GetDataSize();
+	}
+}
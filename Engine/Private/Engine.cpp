@@ -278,6 +278,8 @@ namespace ngine
 		}
 #endif
 
+		GetSystems().m_resourceManager.AdvanceFrame();
+
 		m_frameIndex = (m_frameIndex + 1) % Rendering::MaximumConcurrentFrameCount;
 		return true;
 	}
@@ -263,10 +263,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 		SetWorldTransformInternal(
 			worldTransformSceneData,
 			localTransformSceneData,
@@ -296,10 +296,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		SetWorldRotationInternal(
 			worldTransformSceneData,
@@ -330,10 +330,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		SetWorldLocationInternal(
 			worldTransformSceneData,
@@ -368,10 +368,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		SetWorldLocationAndRotationInternal(
 			worldTransformSceneData,
@@ -404,10 +404,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		SetWorldScaleInternal(worldTransformSceneData, localTransformSceneData, flagsSceneData, scale * parentWorldTransform.GetScale());
 	}
@@ -428,10 +428,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		Data::LocalTransform3D& localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 
@@ -455,10 +455,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		Data::LocalTransform3D& localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 
@@ -484,10 +484,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		Data::LocalTransform3D& localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 
@@ -516,10 +516,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		Data::LocalTransform3D& __restrict localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 
@@ -547,10 +547,10 @@ namespace ngine::Entity
 
 		const Entity::ComponentIdentifier parentIdentifier =
 			Entity::ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(GetIdentifier()).Get());
-		const Math::WorldTransform parentWorldTransform = flags.IsNotSet(ComponentFlags::IsRootScene)
-		                                                    ? (Math::WorldTransform
-		                                                      )worldTransformSceneData.GetComponentImplementationUnchecked(parentIdentifier)
-		                                                    : Math::Identity;
+		const Math::WorldTransform parentWorldTransform =
+			flags.IsNotSet(ComponentFlags::IsRootScene)
+				? m_rootSceneComponent.GetResolvedWorldTransform(parentIdentifier, worldTransformSceneData, localTransformSceneData)
+				: Math::WorldTransform(Math::Identity);
 
 		Data::LocalTransform3D& __restrict localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 
@@ -587,7 +587,8 @@ namespace ngine::Entity
 	)
 	{
 		Data::WorldTransform& __restrict worldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
-		Math::WorldTransform newWorldTransform = worldTransform;
+		Math::WorldTransform newWorldTransform =
+			m_rootSceneComponent.GetResolvedWorldTransform(GetIdentifier(), worldTransformSceneData, localTransformSceneData);
 		newWorldTransform.SetLocation(location);
 		worldTransform = newWorldTransform;
 
@@ -602,7 +603,8 @@ namespace ngine::Entity
 	)
 	{
 		Data::WorldTransform& __restrict worldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
-		Math::WorldTransform newWorldTransform = worldTransform;
+		Math::WorldTransform newWorldTransform =
+			m_rootSceneComponent.GetResolvedWorldTransform(GetIdentifier(), worldTransformSceneData, localTransformSceneData);
 		newWorldTransform.SetRotation(rotation);
 		worldTransform = newWorldTransform;
 
@@ -618,7 +620,8 @@ namespace ngine::Entity
 	)
 	{
 		Data::WorldTransform& __restrict worldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
-		Math::WorldTransform newWorldTransform = worldTransform;
+		Math::WorldTransform newWorldTransform =
+			m_rootSceneComponent.GetResolvedWorldTransform(GetIdentifier(), worldTransformSceneData, localTransformSceneData);
 		newWorldTransform.SetLocation(location);
 		newWorldTransform.SetRotation(rotation);
 		worldTransform = newWorldTransform;
@@ -634,7 +637,8 @@ namespace ngine::Entity
 	)
 	{
 		Data::WorldTransform& __restrict worldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
-		Math::WorldTransform newWorldTransform = worldTransform;
+		Math::WorldTransform newWorldTransform =
+			m_rootSceneComponent.GetResolvedWorldTransform(GetIdentifier(), worldTransformSceneData, localTransformSceneData);
 		newWorldTransform.SetScale(scale);
 		worldTransform = newWorldTransform;
 
@@ -650,14 +654,14 @@ namespace ngine::Entity
 	)
 	{
 		const Math::LocalTransform localTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
+		const Math::WorldTransform worldTransform = parentWorldTransform.Transform(localTransform);
 
-		SetWorldTransformInternal(
-			worldTransformSceneData,
-			localTransformSceneData,
-			flagsSceneData,
-			parentWorldTransform.Transform(localTransform),
-			flags
-		);
+		Data::WorldTransform& __restrict storedWorldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
+		storedWorldTransform = worldTransform;
+
+		// Already resolving parent-first, so continue into the children directly instead of queuing them for another batch
+		PropagateWorldTransformToChildren(worldTransform, worldTransformSceneData, localTransformSceneData, flagsSceneData, flags);
+		NotifyWorldTransformChanged(worldTransformSceneData, flagsSceneData, flags);
 	}
 
 	void Component3D::OnWorldTransformChangedInternal(
@@ -667,6 +671,26 @@ namespace ngine::Entity
 		ComponentTypeSceneData<Data::Flags>& flagsSceneData,
 		const EnumFlags<TransformChangeFlags> transformChangeFlags
 	)
+	{
+		const EnumFlags<Flags> flags = flagsSceneData.GetComponentImplementationUnchecked(GetIdentifier());
+		// Children of components in the octree are resolved in one batch per frame, repeated sets before then only cost the component itself
+		const bool isDeferred = HasChildren() && !flags.AreAnySet(ComponentFlags::IsDetachedFromTreeFromAnySource | ComponentFlags::IsRootScene) &&
+		                        m_rootSceneComponent.QueueChildTransformPropagation(*this, transformChangeFlags);
+		if (!isDeferred)
+		{
+			PropagateWorldTransformToChildren(worldTransform, worldTransformSceneData, localTransformSceneData, flagsSceneData, transformChangeFlags);
+		}
+
+		NotifyWorldTransformChanged(worldTransformSceneData, flagsSceneData, transformChangeFlags);
+	}
+
+	void Component3D::PropagateWorldTransformToChildren(
+		const Math::WorldTransform worldTransform,
+		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+		ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData,
+		ComponentTypeSceneData<Data::Flags>& flagsSceneData,
+		const EnumFlags<TransformChangeFlags> transformChangeFlags
+	)
 	{
 		const EnumFlags<Flags> flags = flagsSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 		if (flags.IsNotSet(Flags::IsRootScene))
@@ -699,7 +723,15 @@ namespace ngine::Entity
 				}
 			}
 		}
+	}
 
+	void Component3D::NotifyWorldTransformChanged(
+		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+		ComponentTypeSceneData<Data::Flags>& flagsSceneData,
+		const EnumFlags<TransformChangeFlags> transformChangeFlags
+	)
+	{
+		const EnumFlags<Flags> flags = flagsSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 		if (!flags.AreAnySet(ComponentFlags::IsDetachedFromTreeFromAnySource | ComponentFlags::IsRootScene))
 		{
 			m_rootSceneComponent.OnComponentWorldLocationOrBoundsChanged(*this, worldTransformSceneData.GetSceneRegistry());
@@ -712,7 +744,9 @@ namespace ngine::Entity
 	Math::WorldTransform Component3D::GetWorldTransform(const Entity::SceneRegistry& sceneRegistry) const
 	{
 		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
+		ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData = sceneRegistry.GetCachedSceneData<Data::LocalTransform3D>();
+		// Includes ancestor changes that have not been propagated to this component yet
+		return m_rootSceneComponent.GetResolvedWorldTransform(GetIdentifier(), worldTransformSceneData, localTransformSceneData);
 	}
 
 	Math::WorldTransform Component3D::GetWorldTransform() const
@@ -722,8 +756,7 @@ namespace ngine::Entity
 
 	Math::WorldCoordinate Component3D::GetWorldLocation(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetLocation();
+		return GetWorldTransform(sceneRegistry).GetLocation();
 	}
 
 	Math::WorldCoordinate Component3D::GetWorldLocation() const
@@ -733,8 +766,7 @@ namespace ngine::Entity
 
 	Math::WorldTransform::QuaternionType Component3D::GetWorldRotation(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetRotation();
+		return GetWorldTransform(sceneRegistry).GetRotation();
 	}
 
 	Math::WorldTransform::QuaternionType Component3D::GetWorldRotation() const
@@ -744,8 +776,7 @@ namespace ngine::Entity
 
 	Math::WorldScale Component3D::GetWorldScale(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetScale();
+		return GetWorldTransform(sceneRegistry).GetScale();
 	}
 
 	Math::WorldScale Component3D::GetWorldScale() const
@@ -755,8 +786,7 @@ namespace ngine::Entity
 
 	Math::Vector3f Component3D::GetWorldRightDirection(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetRotation().GetRightColumn();
+		return GetWorldTransform(sceneRegistry).GetRotation().GetRightColumn();
 	}
 
 	Math::Vector3f Component3D::GetWorldRightDirection() const
@@ -766,8 +796,7 @@ namespace ngine::Entity
 
 	Math::Vector3f Component3D::GetWorldForwardDirection(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetRotation().GetForwardColumn();
+		return GetWorldTransform(sceneRegistry).GetRotation().GetForwardColumn();
 	}
 
 	Math::Vector3f Component3D::GetWorldForwardDirection() const
@@ -777,8 +806,7 @@ namespace ngine::Entity
 
 	Math::Vector3f Component3D::GetWorldUpDirection(const Entity::SceneRegistry& sceneRegistry) const
 	{
-		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
-		return worldTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier()).GetRotation().GetUpColumn();
+		return GetWorldTransform(sceneRegistry).GetRotation().GetUpColumn();
 	}
 
 	Math::Vector3f Component3D::GetWorldUpDirection() const
@@ -1098,6 +1126,9 @@ namespace ngine::Entity
 
 		Data::LocalTransform3D& __restrict relativeTransform = localTransformSceneData.GetComponentImplementationUnchecked(GetIdentifier());
 		relativeTransform = newParentWorldTransform.GetTransformRelativeToAsLocal(worldTransform);
+
+		// The new ancestors may have changes queued for their children
+		m_rootSceneComponent.InvalidateUnqueuedAncestorsCache();
 	}
 
 	void Component3D::OnAttachedToTree([[maybe_unused]] const Optional<Component3D*> pParent)
@@ -13,11 +13,15 @@
 #include "Entity/ComponentTypeSceneData.h"
 #include "Entity/RootSceneComponent.h"
 #include "Entity/Scene/SceneComponent.h"
+#include "Entity/Scene/BinaryScene.h"
+#include "Entity/ComponentTypeSceneDataInterface.h"
 #include "Entity/Serialization/ComponentReference.h"
 
 #include <Common/Reflection/Registry.inl>
 #include <Common/Memory/Serialization/ReferenceWrapper.h>
+#include <Common/Serialization/Deserialize.h>
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
+#include <Common/IO/Log.h>
 
 namespace ngine::Entity
 {
@@ -628,6 +632,111 @@ namespace ngine::Entity
 		return batch;
 	}
 
+	Threading::JobBatch HierarchyComponentBase::DeserializeDataComponentsAndChildren(const BinaryScene& scene)
+	{
+		// Properties of all nodes are stored as one array, parse it once and index into it per node
+		const Serialization::RootReader propertiesSerializer = Serialization::GetReaderFromBuffer(scene.GetPropertyData());
+		if (UNLIKELY_ERROR(!propertiesSerializer.GetData().IsValid()))
+		{
+			LogError("Failed to parse compiled scene properties");
+			return {};
+		}
+
+		Vector<Serialization::Reader, uint32> propertyReaders;
+		if (UNLIKELY_ERROR(!scene.GetPropertyReaders(propertiesSerializer, propertyReaders)))
+		{
+			LogError("Compiled scene properties don't match its {} nodes", scene.GetNodes().GetSize());
+			return {};
+		}
+		return DeserializeDataComponentsAndChildren(scene, propertyReaders.GetView());
+	}
+
+	Threading::JobBatch HierarchyComponentBase::DeserializeDataComponentsAndChildren(
+		const BinaryScene& scene, const ArrayView<const Serialization::Reader, uint32> propertyReaders
+	)
+	{
+		Threading::JobBatch batch;
+		const ArrayView<const BinaryScene::Node, uint32> nodes = scene.GetNodes();
+		if (UNLIKELY_ERROR(propertyReaders.GetSize() != nodes.GetSize()))
+		{
+			LogError("Compiled scene properties don't match its {} nodes", nodes.GetSize());
+			return batch;
+		}
+
+		Entity::SceneRegistry& sceneRegistry = GetSceneRegistry();
+		Entity::ComponentRegistry& registry = System::Get<Entity::Manager>().GetRegistry();
+
+		// Reserve the storage of every type in the scene once, instead of growing it per instance
+		for (const BinaryScene::Type& type : scene.GetTypes())
+		{
+			const ComponentTypeIdentifier typeIdentifier = registry.FindIdentifier(type.m_typeGuid);
+			if (typeIdentifier.IsValid())
+			{
+				if (const Optional<ComponentTypeSceneDataInterface*> pTypeSceneData = sceneRegistry.GetOrCreateComponentTypeData(typeIdentifier))
+				{
+					if (UNLIKELY_ERROR(!pTypeSceneData->ReserveAdditionalInstances(type.m_instanceCount)))
+					{
+						LogError("Not enough component storage to deserialize {} instances of type {}", type.m_instanceCount, type.m_typeGuid);
+						return batch;
+					}
+				}
+			}
+		}
+
+		// Parents always precede their children, so the flattened hierarchy can be instantiated in a single pass
+		Vector<Optional<HierarchyComponentBase*>> components(Memory::Reserve, nodes.GetSize());
+		components.EmplaceBack(this);
+		ReserveAdditionalChildren(nodes[0].m_childCount);
+
+		for (uint32 nodeIndex = 1, nodeCount = nodes.GetSize(); nodeIndex < nodeCount; ++nodeIndex)
+		{
+			const BinaryScene::Node& node = nodes[nodeIndex];
+			const Optional<HierarchyComponentBase*> pParent = components[node.m_parentIndex];
+			if (UNLIKELY(pParent.IsInvalid()))
+			{
+				// Skip the subtree of components that failed to load
+				components.EmplaceBack(Invalid);
+				continue;
+			}
+
+			const Serialization::Reader nodeReader = propertyReaders[node.m_propertiesIndex];
+			if (node.IsDataComponent())
+			{
+				Threading::JobBatch dataComponentBatch;
+				[[maybe_unused]] Optional<ComponentValue<Data::Component>> componentValue =
+					nodeReader.ReadInPlace<ComponentValue<Data::Component>>(*pParent, sceneRegistry, dataComponentBatch);
+				batch.QueueAfterStartStage(dataComponentBatch);
+				components.EmplaceBack(Invalid);
+				continue;
+			}
+
+			// Start by attempting to find the existing child instance, its data components and children are then applied onto it
+			if (const Optional<ComponentSoftReference> softComponentReference = nodeReader.ReadInPlace<ComponentSoftReference>(sceneRegistry))
+			{
+				if (const Optional<HierarchyComponentBase*> pChildComponent = softComponentReference->Find<HierarchyComponentBase>(sceneRegistry))
+				{
+					components.EmplaceBack(pChildComponent);
+					continue;
+				}
+			}
+
+			// Spawn a new instance from the read data
+			Threading::JobBatch childComponentBatch;
+			const Optional<ComponentValue<HierarchyComponentBase>> componentValue =
+				nodeReader.ReadInPlace<ComponentValue<HierarchyComponentBase>>(*pParent, sceneRegistry, childComponentBatch);
+			batch.QueueAfterStartStage(childComponentBatch);
+
+			const Optional<HierarchyComponentBase*> pComponent = componentValue.IsValid() ? componentValue->Get() : Invalid;
+			if (pComponent.IsValid())
+			{
+				pComponent->ReserveAdditionalChildren(node.m_childCount);
+			}
+			components.EmplaceBack(pComponent);
+		}
+
+		return batch;
+	}
+
 	bool HierarchyComponentBase::SerializeChildren(Serialization::Writer serializer) const
 	{
 		ChildView children = GetChildren();
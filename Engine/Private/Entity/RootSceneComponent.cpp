@@ -6,6 +6,7 @@
 #include "Engine/Entity/Data/WorldTransform.h"
 #include "Engine/Entity/Data/LocalTransform3D.h"
 #include "Engine/Entity/Data/OctreeNode.h"
+#include "Engine/Entity/Data/ParentComponent.h"
 #include "Engine/Entity/Data/Flags.h"
 #include "Engine/Entity/Data/InstanceGuid.h"
 #include "Engine/Entity/Component3D.inl"
@@ -52,6 +53,11 @@ namespace ngine::Entity
 #endif
 		virtual Result OnExecute([[maybe_unused]] Threading::JobRunnerThread& thread) override
 		{
+			// Apply transform changes made during late updates before cleaning up, so nodes emptied by them are released this frame
+			Entity::SceneRegistry& sceneRegistry = m_rootComponent.m_scene->GetEntitySceneRegistry();
+			m_rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+			m_rootComponent.ProcessQueuedOctreeUpdates(sceneRegistry);
+
 			Threading::UniqueLock lock(m_queuedOctreeNodeRemovalsLock);
 
 			for (decltype(m_queuedOctreeNodeRemovals)::iterator it = m_queuedOctreeNodeRemovals.begin(); it != m_queuedOctreeNodeRemovals.end();
@@ -125,6 +131,34 @@ namespace ngine::Entity
 		FlatVector<ReferenceWrapper<SceneOctreeNode>, MaximumQueuedOctreeNodeRemovals> m_queuedOctreeNodeRemovals;
 	};
 
+	//! Resolves the world transforms of children whose ancestors moved during the dynamic updates, then moves all changed components to their new
+	//! octree nodes in one batch, before views traverse the octree
+	struct UpdateOctreeJob final : Threading::Job
+	{
+		UpdateOctreeJob(RootSceneComponent& rootSceneComponent)
+			: Threading::Job(Threading::JobPriority::OctreeCulling)
+			, m_rootComponent(rootSceneComponent)
+		{
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Update Octree Stage";
+		}
+#endif
+		virtual Result OnExecute([[maybe_unused]] Threading::JobRunnerThread& thread) override
+		{
+			// Children are resolved first, as that queues their own octree reinsertion
+			Entity::SceneRegistry& sceneRegistry = m_rootComponent.m_scene->GetEntitySceneRegistry();
+			m_rootComponent.ProcessQueuedTransformPropagations(sceneRegistry);
+			m_rootComponent.ProcessQueuedOctreeUpdates(sceneRegistry);
+			return Result::Finished;
+		}
+	protected:
+		RootSceneComponent& m_rootComponent;
+	};
+
 	RootSceneComponent::RootSceneComponent(Initializer&& initializer)
 		: SceneComponent(
 				initializer.m_scene,
@@ -142,6 +176,7 @@ namespace ngine::Entity
 		, m_rootNode(nullptr, 255, Math::WorldCoordinate{Math::Zero}, m_radius)
 		, m_pChildNodePool(m_scene->IsTemplate() ? UniquePtr<ChildNodePool>() : UniquePtr<ChildNodePool>::Make())
 		, m_destroyEmptyOctreeNodesJob(UniqueRef<DestroyEmptyOctreeNodesJob>::Make(*this))
+		, m_updateOctreeJob(UniqueRef<UpdateOctreeJob>::Make(*this))
 		, m_octreeNodeSceneData(initializer.m_sceneRegistry.GetCachedSceneData<Entity::Data::OctreeNode>())
 		, m_tagComponentTypeSceneData(*initializer.m_sceneRegistry.GetOrCreateComponentTypeData<Entity::Data::Tags>())
 	{
@@ -150,8 +185,7 @@ namespace ngine::Entity
 			m_scene->ModifyFrameGraph(
 				[this, &sceneRegistry = initializer.m_sceneRegistry]()
 				{
-					sceneRegistry.GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
-					m_destroyEmptyOctreeNodesJob->AddSubsequentStage(m_scene->GetEndFrameStage());
+					AddOctreeStages(sceneRegistry);
 				}
 			);
 		}
@@ -175,6 +209,7 @@ namespace ngine::Entity
 		, m_rootNode(nullptr, 255, Math::WorldCoordinate{Math::Zero}, m_radius)
 		, m_pChildNodePool(m_scene->IsTemplate() ? UniquePtr<ChildNodePool>() : UniquePtr<ChildNodePool>::Make())
 		, m_destroyEmptyOctreeNodesJob(UniqueRef<DestroyEmptyOctreeNodesJob>::Make(*this))
+		, m_updateOctreeJob(UniqueRef<UpdateOctreeJob>::Make(*this))
 		, m_octreeNodeSceneData(deserializer.m_scene.GetEntitySceneRegistry().GetCachedSceneData<Entity::Data::OctreeNode>())
 		, m_tagComponentTypeSceneData(*m_scene->GetEntitySceneRegistry().GetOrCreateComponentTypeData<Entity::Data::Tags>())
 	{
@@ -183,8 +218,7 @@ namespace ngine::Entity
 			m_scene->ModifyFrameGraph(
 				[this]()
 				{
-					m_scene->GetEntitySceneRegistry().GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
-					m_destroyEmptyOctreeNodesJob->AddSubsequentStage(m_scene->GetEndFrameStage());
+					AddOctreeStages(m_scene->GetEntitySceneRegistry());
 				}
 			);
 		}
@@ -209,6 +243,7 @@ namespace ngine::Entity
 		, m_rootNode(nullptr, 255, Math::WorldCoordinate{Math::Zero}, m_radius)
 		, m_pChildNodePool(m_scene->IsTemplate() ? UniquePtr<ChildNodePool>() : UniquePtr<ChildNodePool>::Make())
 		, m_destroyEmptyOctreeNodesJob(UniqueRef<DestroyEmptyOctreeNodesJob>::Make(*this))
+		, m_updateOctreeJob(UniqueRef<UpdateOctreeJob>::Make(*this))
 		, m_octreeNodeSceneData(scene.GetEntitySceneRegistry().GetCachedSceneData<Entity::Data::OctreeNode>())
 		, m_tagComponentTypeSceneData(*m_scene->GetEntitySceneRegistry().GetOrCreateComponentTypeData<Entity::Data::Tags>())
 	{
@@ -217,8 +252,7 @@ namespace ngine::Entity
 			m_scene->ModifyFrameGraph(
 				[this]()
 				{
-					m_scene->GetEntitySceneRegistry().GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
-					m_destroyEmptyOctreeNodesJob->AddSubsequentStage(m_scene->GetEndFrameStage());
+					AddOctreeStages(m_scene->GetEntitySceneRegistry());
 				}
 			);
 		}
@@ -246,18 +280,40 @@ namespace ngine::Entity
 		m_scene->ModifyFrameGraph(
 			[this]()
 			{
-				m_scene->GetEntitySceneRegistry().GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
-				m_destroyEmptyOctreeNodesJob->AddSubsequentStage(m_scene->GetEndFrameStage());
+				AddOctreeStages(m_scene->GetEntitySceneRegistry());
 			}
 		);
 	}
 
 	void RootSceneComponent::OnDisable()
 	{
-		m_scene->GetEntitySceneRegistry()
-			.GetDynamicLateUpdatesFinishedStage()
+		RemoveOctreeStages(m_scene->GetEntitySceneRegistry());
+	}
+
+	void RootSceneComponent::AddOctreeStages(SceneRegistry& sceneRegistry)
+	{
+		// The batch is resolved by the octree stages, so propagation can only be deferred while they run
+		m_deferTransformPropagation = true;
+
+		sceneRegistry.GetDynamicRenderUpdatesFinishedStage().AddSubsequentStage(*m_updateOctreeJob);
+		m_updateOctreeJob->AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
+
+		sceneRegistry.GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*m_destroyEmptyOctreeNodesJob);
+		m_destroyEmptyOctreeNodesJob->AddSubsequentStage(m_scene->GetEndFrameStage());
+	}
+
+	void RootSceneComponent::RemoveOctreeStages(SceneRegistry& sceneRegistry)
+	{
+		sceneRegistry.GetDynamicRenderUpdatesFinishedStage().RemoveSubsequentStage(*m_updateOctreeJob, Invalid, Threading::StageBase::RemovalFlags{});
+		m_updateOctreeJob->RemoveSubsequentStage(*m_destroyEmptyOctreeNodesJob, Invalid, Threading::StageBase::RemovalFlags{});
+
+		sceneRegistry.GetDynamicLateUpdatesFinishedStage()
 			.RemoveSubsequentStage(m_destroyEmptyOctreeNodesJob, Invalid, Threading::StageBase::RemovalFlags{});
 		m_destroyEmptyOctreeNodesJob->RemoveSubsequentStage(m_scene->GetEndFrameStage(), Invalid, Threading::StageBase::RemovalFlags{});
+
+		m_deferTransformPropagation = false;
+		ProcessQueuedTransformPropagations(sceneRegistry);
+		ProcessQueuedOctreeUpdates(sceneRegistry);
 	}
 
 	bool RootSceneComponent::Destroy(SceneRegistry& sceneRegistry)
@@ -304,6 +360,11 @@ namespace ngine::Entity
 		return *m_destroyEmptyOctreeNodesJob;
 	}
 
+	Threading::StageBase& RootSceneComponent::GetOctreeUpdateJob()
+	{
+		return *m_updateOctreeJob;
+	}
+
 	Optional<SceneOctreeNode*> RootSceneComponent::GetOrMakeIdealChildNode(
 		SceneOctreeNode& node, float componentRadiusSquared, const Math::WorldCoordinate itemLocation, const Math::WorldBoundingBox itemBounds
 	)
@@ -375,7 +436,181 @@ namespace ngine::Entity
 		return pNode;
 	}
 
-	void RootSceneComponent::OnComponentWorldLocationOrBoundsChanged(Entity::Component3D& component, Entity::SceneRegistry& sceneRegistry)
+	void RootSceneComponent::OnComponentWorldLocationOrBoundsChanged(
+		Entity::Component3D& component, [[maybe_unused]] Entity::SceneRegistry& sceneRegistry
+	)
+	{
+		if (m_queuedOctreeUpdateMask.Set(component.GetIdentifier()))
+		{
+			Threading::UniqueLock lock(m_queuedOctreeUpdatesMutex);
+			m_queuedOctreeUpdates.EmplaceBack(component);
+		}
+	}
+
+	void RootSceneComponent::ProcessQueuedOctreeUpdates(Entity::SceneRegistry& sceneRegistry)
+	{
+		// Hold the lock for the whole batch so that RemoveComponent can't release a component we are about to reinsert
+		// Reinsertion does not change transforms, so nothing is queued from within the loop
+		Threading::UniqueLock lock(m_queuedOctreeUpdatesMutex);
+		for (Entity::Component3D& component : m_queuedOctreeUpdates)
+		{
+			// Clear before updating so that changes made during the update are queued again
+			if (m_queuedOctreeUpdateMask.Clear(component.GetIdentifier()))
+			{
+				UpdateComponentOctreeNode(component, sceneRegistry);
+			}
+		}
+		m_queuedOctreeUpdates.Clear();
+	}
+
+	bool RootSceneComponent::QueueChildTransformPropagation(Entity::Component3D& component, const EnumFlags<TransformChangeFlags> flags)
+	{
+		if (!m_deferTransformPropagation)
+		{
+			return false;
+		}
+
+		const Entity::ComponentIdentifier componentIdentifier = component.GetIdentifier();
+		// Record the flags before publishing the mask bit, so whichever batch takes the entry sees them
+		m_queuedTransformPropagationExcludedFlags[componentIdentifier].FetchOr(~flags);
+		if (m_queuedTransformPropagationMask.Set(componentIdentifier))
+		{
+			m_queuedTransformPropagationCount.FetchAdd(1);
+			// Descendants now have a queued ancestor, published after the mask bit so readers of the new epoch find it
+			InvalidateUnqueuedAncestorsCache();
+
+			Threading::UniqueLock lock(m_queuedTransformPropagationsMutex);
+			m_queuedTransformPropagations.EmplaceBack(component);
+		}
+		return true;
+	}
+
+	EnumFlags<TransformChangeFlags> RootSceneComponent::TakeQueuedTransformPropagationFlags(const ComponentIdentifier componentIdentifier)
+	{
+		const EnumFlags<TransformChangeFlags> excludedFlags = m_queuedTransformPropagationExcludedFlags[componentIdentifier].FetchAnd(
+			~(TransformChangeFlags::ChangedByPhysics | TransformChangeFlags::ChangedByTransformReset)
+		);
+		return ~excludedFlags;
+	}
+
+	Math::WorldTransform RootSceneComponent::GetResolvedWorldTransform(
+		const ComponentIdentifier componentIdentifier,
+		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+		ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData
+	) const
+	{
+		if (m_queuedTransformPropagationCount.Load() == 0 || componentIdentifier == GetIdentifier())
+		{
+			return worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
+		}
+
+		// Only walk the ancestors if one of them may have been queued since this component was last found to have none
+		const uint32 queuedAncestorsEpoch = m_queuedAncestorsEpoch.Load();
+		Threading::Atomic<uint32>& unqueuedAncestorsEpoch = m_unqueuedAncestorsEpochs[componentIdentifier];
+		if (unqueuedAncestorsEpoch.Load() == queuedAncestorsEpoch)
+		{
+			return worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
+		}
+
+		// Find the topmost ancestor whose change has not reached its children yet
+		ComponentTypeSceneData<Data::Parent>& parentSceneData = worldTransformSceneData.GetSceneRegistry().GetCachedSceneData<Data::Parent>();
+		const auto getParentIdentifier = [&parentSceneData](const ComponentIdentifier identifier)
+		{
+			return ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(identifier).Get());
+		};
+		ComponentIdentifier queuedAncestorIdentifier;
+		for (ComponentIdentifier ancestorIdentifier = getParentIdentifier(componentIdentifier); ancestorIdentifier != GetIdentifier();
+		     ancestorIdentifier = getParentIdentifier(ancestorIdentifier))
+		{
+			if (m_queuedTransformPropagationMask.IsSet(ancestorIdentifier))
+			{
+				queuedAncestorIdentifier = ancestorIdentifier;
+			}
+		}
+		if (queuedAncestorIdentifier.IsInvalid())
+		{
+			// A queue that raced with the walk has already advanced the epoch, so storing the one loaded above stays conservative
+			unqueuedAncestorsEpoch = queuedAncestorsEpoch;
+			return worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
+		}
+
+		// Apply the relative transforms from that ancestor down, without writing so that readers on other threads see no partial state
+		const auto resolve = [&](const auto& resolve, const ComponentIdentifier identifier) -> Math::WorldTransform
+		{
+			if (identifier == queuedAncestorIdentifier)
+			{
+				return worldTransformSceneData.GetComponentImplementationUnchecked(identifier);
+			}
+			const Math::LocalTransform localTransform = localTransformSceneData.GetComponentImplementationUnchecked(identifier);
+			return resolve(resolve, getParentIdentifier(identifier)).Transform(localTransform);
+		};
+		return resolve(resolve, componentIdentifier);
+	}
+
+	void RootSceneComponent::ProcessQueuedTransformPropagations(Entity::SceneRegistry& sceneRegistry)
+	{
+		ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
+		ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData = sceneRegistry.GetCachedSceneData<Data::LocalTransform3D>();
+		ComponentTypeSceneData<Data::Flags>& flagsSceneData = sceneRegistry.GetCachedSceneData<Data::Flags>();
+		ComponentTypeSceneData<Data::Parent>& parentSceneData = sceneRegistry.GetCachedSceneData<Data::Parent>();
+
+		{
+			Threading::UniqueLock lock(m_queuedTransformPropagationsMutex);
+			Assert(m_processedTransformPropagations.IsEmpty());
+
+			// Components below another queued component are resolved by the recursion from the topmost one, so only the topmost are kept
+			// The topmost keep their mask bit until their turn below, which is what lets every descendant find them here
+			for (Entity::Component3D& component : m_queuedTransformPropagations)
+			{
+				const Entity::ComponentIdentifier componentIdentifier = component.GetIdentifier();
+				bool hasQueuedAncestor = false;
+				for (ComponentIdentifier ancestorIdentifier =
+				       ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(componentIdentifier).Get());
+				     ancestorIdentifier != GetIdentifier();
+				     ancestorIdentifier =
+				       ComponentIdentifier::MakeFromValidIndex(parentSceneData.GetComponentImplementationUnchecked(ancestorIdentifier).Get()))
+				{
+					if (m_queuedTransformPropagationMask.IsSet(ancestorIdentifier))
+					{
+						hasQueuedAncestor = true;
+						break;
+					}
+				}
+
+				if (hasQueuedAncestor)
+				{
+					[[maybe_unused]] const EnumFlags<TransformChangeFlags> flags = TakeQueuedTransformPropagationFlags(componentIdentifier);
+					if (m_queuedTransformPropagationMask.Clear(componentIdentifier))
+					{
+						m_queuedTransformPropagationCount.FetchSubtract(1);
+					}
+				}
+				else
+				{
+					m_processedTransformPropagations.EmplaceBack(component);
+				}
+			}
+			m_queuedTransformPropagations.Clear();
+		}
+
+		// Events raised while resolving may run user code, so the batch is processed outside of the lock
+		// Entries removed from the scene in the meantime had their bit cleared by RemoveComponent and are skipped
+		for (Entity::Component3D& component : m_processedTransformPropagations)
+		{
+			// Take the flags before clearing, a change racing with this only leaves its flags for the next batch
+			const EnumFlags<TransformChangeFlags> flags = TakeQueuedTransformPropagationFlags(component.GetIdentifier());
+			// Clear before resolving so that changes made from within the resolution are queued for the next batch
+			if (m_queuedTransformPropagationMask.Clear(component.GetIdentifier()))
+			{
+				m_queuedTransformPropagationCount.FetchSubtract(1);
+				const Math::WorldTransform worldTransform = worldTransformSceneData.GetComponentImplementationUnchecked(component.GetIdentifier());
+				component.PropagateWorldTransformToChildren(worldTransform, worldTransformSceneData, localTransformSceneData, flagsSceneData, flags);
+			}
+		}
+		m_processedTransformPropagations.Clear();
+	}
+
+	void RootSceneComponent::UpdateComponentOctreeNode(Entity::Component3D& component, Entity::SceneRegistry& sceneRegistry)
 	{
 		const Entity::ComponentIdentifier componentIdentifier = component.GetIdentifier();
 		const Optional<Data::OctreeNode*> pCurrentOctreeNode = m_octreeNodeSceneData.GetComponentImplementation(componentIdentifier);
@@ -384,7 +619,21 @@ namespace ngine::Entity
 			SceneOctreeNode& currentNode = pCurrentOctreeNode->Get();
 
 			const Math::WorldCoordinate newComponentLocation = component.GetWorldLocation(sceneRegistry);
-			if (!currentNode.GetStaticBoundingBox().Contains(newComponentLocation) && &currentNode != &m_rootNode)
+			if (currentNode.GetStaticBoundingBox().Contains(newComponentLocation) || &currentNode == &m_rootNode)
+			{
+				// The component stays in its node, make sure the node and its ancestors still enclose its bounds for culling
+				const Math::WorldBoundingBox componentBounds = component.GetWorldBoundingBox(sceneRegistry);
+				for (SceneOctreeNode* pNode = &currentNode; pNode != nullptr && pNode != &m_rootNode; pNode = pNode->GetParent())
+				{
+					const Math::WorldBoundingBox nodeBounds = pNode->GetChildBoundingBox();
+					if (nodeBounds.Contains(componentBounds.GetMinimum()) & nodeBounds.Contains(componentBounds.GetMaximum()))
+					{
+						break;
+					}
+					pNode->ExpandChildBoundingBox(componentBounds);
+				}
+			}
+			else
 			{
 				SceneOctreeNode* pNewNode = currentNode.GetParent();
 				while (pNewNode != &m_rootNode && !pNewNode->GetStaticBoundingBox().Contains(newComponentLocation))
@@ -467,6 +716,36 @@ namespace ngine::Entity
 		SceneRegistry& sceneRegistry = m_scene->GetEntitySceneRegistry();
 		Assert(sceneRegistry.HasDataComponentOfType(componentIdentifier, m_octreeNodeSceneData.GetIdentifier()));
 
+		if (m_queuedOctreeUpdateMask.Clear(componentIdentifier))
+		{
+			Threading::UniqueLock lock(m_queuedOctreeUpdatesMutex);
+			[[maybe_unused]] const bool wasRemoved = m_queuedOctreeUpdates.RemoveFirstOccurrence(component);
+		}
+
+		// Components added later under this identifier start without any knowledge of their ancestors
+		InvalidateUnqueuedAncestorsCache();
+
+		// Give the children their pending transform now, as the queued entry can't be used once the component leaves the scene
+		// An entry already taken by a running batch is skipped there since its bit is cleared
+		const EnumFlags<TransformChangeFlags> queuedTransformChangeFlags = TakeQueuedTransformPropagationFlags(componentIdentifier);
+		if (m_queuedTransformPropagationMask.Clear(componentIdentifier))
+		{
+			m_queuedTransformPropagationCount.FetchSubtract(1);
+			{
+				Threading::UniqueLock lock(m_queuedTransformPropagationsMutex);
+				[[maybe_unused]] const bool wasRemoved = m_queuedTransformPropagations.RemoveFirstOccurrence(component);
+			}
+
+			ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData = sceneRegistry.GetCachedSceneData<Data::WorldTransform>();
+			component.PropagateWorldTransformToChildren(
+				worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier),
+				worldTransformSceneData,
+				sceneRegistry.GetCachedSceneData<Data::LocalTransform3D>(),
+				sceneRegistry.GetCachedSceneData<Data::Flags>(),
+				queuedTransformChangeFlags
+			);
+		}
+
 		const Optional<Data::OctreeNode*> pCurrentOctreeNode = m_octreeNodeSceneData.GetComponentImplementation(componentIdentifier);
 		if (LIKELY(pCurrentOctreeNode.IsValid()))
 		{
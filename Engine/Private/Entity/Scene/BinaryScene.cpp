@@ -0,0 +1,245 @@
+#include "Entity/Scene/BinaryScene.h"
+#include "Entity/Scene/SceneComponent.h"
+#include "Entity/RootSceneComponent.h"
+
+#include <Common/Memory/Align.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Reflection/Registry.inl>
+#include <Common/Serialization/Reader.h>
+#include <Common/Serialization/Writer.h>
+#include <Common/Asset/Format/Guid.h>
+
+namespace ngine::Entity
+{
+	inline static constexpr uint32 SectionAlignment = 16;
+
+	BinaryScene::BinaryScene(const ConstByteView data)
+	{
+		if (data.GetDataSize() < sizeof(Header))
+		{
+			return;
+		}
+
+		const Header& header = *reinterpret_cast<const Header*>(data.GetData());
+		if (header.m_magic != Magic || header.m_version != Version)
+		{
+			return;
+		}
+
+		const uint64 dataSize = data.GetDataSize();
+		const auto isSectionValid = [dataSize](const uint32 offset, const uint64 sectionSize)
+		{
+			return offset % SectionAlignment == 0 && (uint64)offset + sectionSize <= dataSize;
+		};
+		if (!isSectionValid(header.m_typesOffset, (uint64)header.m_typeCount * sizeof(Type)) ||
+		    !isSectionValid(header.m_nodesOffset, (uint64)header.m_nodeCount * sizeof(Node)) ||
+		    !isSectionValid(header.m_propertyDataOffset, header.m_propertyDataSize) || header.m_propertyDataSize == 0)
+		{
+			return;
+		}
+
+		m_pHeader = &header;
+		m_types = ArrayView<const Type, uint32>{reinterpret_cast<const Type*>(data.GetData() + header.m_typesOffset), header.m_typeCount};
+		m_nodes = ArrayView<const Node, uint32>{reinterpret_cast<const Node*>(data.GetData() + header.m_nodesOffset), header.m_nodeCount};
+		m_propertyData = ConstByteView{data.GetData() + header.m_propertyDataOffset, header.m_propertyDataSize};
+	}
+
+	bool BinaryScene::GetPropertyReaders(const Serialization::Reader propertyDataReader, Vector<Serialization::Reader, uint32>& readersOut) const
+	{
+		readersOut.Clear();
+		readersOut.Reserve(m_nodes.GetSize());
+		for (const Serialization::Reader propertyReader : propertyDataReader.GetArrayView())
+		{
+			readersOut.EmplaceBack(propertyReader);
+		}
+		return readersOut.GetSize() == m_nodes.GetSize();
+	}
+
+	struct SceneCompiler
+	{
+		[[nodiscard]] bool Flatten(const Serialization::Reader reader, const uint32 parentIndex, const bool isDataComponent)
+		{
+			const Optional<Guid> typeGuid = reader.Read<Guid>("typeGuid");
+			if (UNLIKELY(!typeGuid.IsValid()))
+			{
+				return false;
+			}
+
+			// Nested scenes apply their children as overrides onto the template instance, so they have to stay in their own document
+			const bool isRoot = parentIndex == BinaryScene::InvalidNodeIndex;
+			const bool hasInlineChildren = !isRoot && !isDataComponent &&
+			                               (*typeGuid == Reflection::GetTypeGuid<SceneComponent>() ||
+			                                *typeGuid == Reflection::GetTypeGuid<RootSceneComponent>());
+
+			Serialization::Data propertiesData(rapidjson::Type::kObjectType, reader.GetData().GetContextFlags());
+			Serialization::Document& propertiesDocument = propertiesData.GetDocument();
+			propertiesDocument.CopyFrom(reader.GetValue().GetValue(), propertiesDocument.GetAllocator());
+			if (!hasInlineChildren)
+			{
+				propertiesDocument.RemoveMember("data_components");
+				propertiesDocument.RemoveMember("children");
+			}
+
+			const uint32 nodeIndex = m_nodes.GetSize();
+			m_nodes.EmplaceBack(PendingNode{
+				parentIndex,
+				FindOrAddType(*typeGuid),
+				(uint8)((uint8)BinaryScene::Node::Flags::IsDataComponent * isDataComponent |
+				        (uint8)BinaryScene::Node::Flags::HasInlineChildren * hasInlineChildren),
+				propertiesData.SaveToBuffer<String>(Serialization::SavingFlags{})
+			});
+			m_types[m_nodes[nodeIndex].m_typeIndex].m_instanceCount++;
+
+			if (hasInlineChildren)
+			{
+				return true;
+			}
+
+			if (const Optional<Serialization::Reader> dataComponentsReader = reader.FindSerializer("data_components"))
+			{
+				for (const Serialization::Reader dataComponentReader : dataComponentsReader->GetArrayView())
+				{
+					if (!Flatten(dataComponentReader, nodeIndex, true))
+					{
+						return false;
+					}
+				}
+			}
+
+			if (const Optional<Serialization::Reader> childrenReader = reader.FindSerializer("children"))
+			{
+				if (UNLIKELY(childrenReader->GetArraySize() > Math::NumericLimits<uint16>::Max))
+				{
+					return false;
+				}
+				m_nodes[nodeIndex].m_childCount = (uint16)childrenReader->GetArraySize();
+
+				for (const Serialization::Reader childReader : childrenReader->GetArrayView())
+				{
+					if (!Flatten(childReader, nodeIndex, false))
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] uint32 FindOrAddType(const Guid typeGuid)
+		{
+			auto it = m_typeIndices.Find(typeGuid);
+			if (it != m_typeIndices.end())
+			{
+				return it->second;
+			}
+
+			const uint32 index = m_types.GetSize();
+			m_types.EmplaceBack(BinaryScene::Type{typeGuid, 0, 0, 0, 0});
+			m_typeIndices.Emplace(Guid(typeGuid), uint32(index));
+			return index;
+		}
+
+		struct PendingNode
+		{
+			uint32 m_parentIndex;
+			uint32 m_typeIndex;
+			uint8 m_flags;
+			String m_properties;
+			uint16 m_childCount{0};
+		};
+
+		Vector<BinaryScene::Type> m_types;
+		UnorderedMap<Guid, uint32, Guid::Hash> m_typeIndices;
+		Vector<PendingNode> m_nodes;
+	};
+
+	bool BinaryScene::Compile(const Serialization::Reader sceneReader, Vector<ByteType>& output)
+	{
+		SceneCompiler compiler;
+		if (!compiler.Flatten(sceneReader, InvalidNodeIndex, false))
+		{
+			return false;
+		}
+
+		// Group the properties of each type into one contiguous block, so instances of a type are read from adjacent memory
+		// All blocks together form one JSON array, allowing the loader to parse the whole scene at once
+		for (const SceneCompiler::PendingNode& pendingNode : compiler.m_nodes)
+		{
+			// Every element is followed by a separator, or the closing bracket for the last one
+			compiler.m_types[pendingNode.m_typeIndex].m_propertyDataSize += pendingNode.m_properties.GetSize() + 1;
+		}
+
+		Vector<uint32> typePropertyOffsets(Memory::Reserve, compiler.m_types.GetSize());
+		Vector<uint32> typePropertyIndices(Memory::Reserve, compiler.m_types.GetSize());
+		// Opening bracket
+		uint32 propertyDataSize = 1;
+		uint32 propertiesIndex = 0;
+		for (BinaryScene::Type& type : compiler.m_types)
+		{
+			type.m_propertyDataOffset = propertyDataSize;
+			typePropertyOffsets.EmplaceBack(propertyDataSize);
+			typePropertyIndices.EmplaceBack(propertiesIndex);
+			propertyDataSize += type.m_propertyDataSize;
+			propertiesIndex += type.m_instanceCount;
+			// Exclude the trailing separator from the type's block
+			type.m_propertyDataSize--;
+		}
+		// Zero terminator
+		propertyDataSize++;
+
+		Vector<ByteType> propertyData(Memory::ConstructWithSize, Memory::Uninitialized, propertyDataSize);
+		propertyData[0] = ByteType('[');
+
+		Vector<Node> nodes(Memory::Reserve, compiler.m_nodes.GetSize());
+		for (const SceneCompiler::PendingNode& pendingNode : compiler.m_nodes)
+		{
+			uint32& propertiesOffset = typePropertyOffsets[pendingNode.m_typeIndex];
+			uint32& nodePropertiesIndex = typePropertyIndices[pendingNode.m_typeIndex];
+			const uint32 propertiesSize = pendingNode.m_properties.GetSize();
+			ByteView{propertyData.GetData() + propertiesOffset, propertiesSize}.CopyFrom(ConstByteView{
+				reinterpret_cast<const ByteType*>(pendingNode.m_properties.GetData()),
+				propertiesSize
+			});
+			propertyData[propertiesOffset + propertiesSize] = ByteType(',');
+
+			nodes.EmplaceBack(Node{
+				pendingNode.m_parentIndex,
+				pendingNode.m_typeIndex,
+				propertiesOffset,
+				propertiesSize,
+				nodePropertiesIndex,
+				pendingNode.m_childCount,
+				pendingNode.m_flags,
+				0
+			});
+			propertiesOffset += propertiesSize + 1;
+			nodePropertiesIndex++;
+		}
+		propertyData[propertyDataSize - 2] = ByteType(']');
+		propertyData[propertyDataSize - 1] = ByteType(0);
+
+		Header header{};
+		header.m_magic = Magic;
+		header.m_version = Version;
+		header.m_typeCount = compiler.m_types.GetSize();
+		header.m_nodeCount = nodes.GetSize();
+		header.m_propertyDataSize = propertyData.GetSize();
+		header.m_typesOffset = Memory::Align((uint32)sizeof(Header), SectionAlignment);
+		header.m_nodesOffset = Memory::Align(header.m_typesOffset + (uint32)compiler.m_types.GetDataSize(), SectionAlignment);
+		header.m_propertyDataOffset = Memory::Align(header.m_nodesOffset + (uint32)nodes.GetDataSize(), SectionAlignment);
+
+		output.Reserve(output.GetSize() + header.m_propertyDataOffset + header.m_propertyDataSize);
+		const uint32 baseOffset = output.GetSize();
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(&header), sizeof(Header)});
+		output.Resize(baseOffset + header.m_typesOffset);
+		output.CopyEmplaceRangeBack(
+			ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(compiler.m_types.GetData()), compiler.m_types.GetDataSize()}
+		);
+		output.Resize(baseOffset + header.m_nodesOffset);
+		output.CopyEmplaceRangeBack(ArrayView<const ByteType>{reinterpret_cast<const ByteType*>(nodes.GetData()), nodes.GetDataSize()});
+		output.Resize(baseOffset + header.m_propertyDataOffset);
+		output.CopyEmplaceRangeBack(propertyData.GetView());
+		return true;
+	}
+}
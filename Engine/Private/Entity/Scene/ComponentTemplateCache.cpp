@@ -1,6 +1,7 @@
 #include "Entity/Scene/ComponentTemplateCache.h"
 #include "Scene/Scene.h"
 #include "Entity/Scene/SceneChildInstance.h"
+#include "Entity/Scene/BinaryScene.h"
 
 #include <Engine/Asset/AssetType.inl>
 #include <Common/System/Query.h>
@@ -8,15 +9,163 @@
 #include <Engine/Entity/RootSceneComponent.h>
 #include <Engine/Entity/ComponentType.h>
 #include <Engine/Entity/Data/InstanceGuid.h>
+#include <Engine/Entity/Manager.h>
+#include <Engine/Entity/ComponentTypeSceneDataInterface.h>
 
 #include <Common/Threading/Jobs/JobBatch.h>
+#include <Common/Threading/AtomicInteger.h>
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
 #include <Common/Serialization/Deserialize.h>
 #include <Common/Asset/Format/Guid.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/NumericLimits.h>
 #include <Common/IO/Log.h>
 
 namespace ngine::Entity
 {
+	using ComponentTypeCounts = UnorderedMap<ComponentTypeIdentifier, uint32, ComponentTypeIdentifier::Hash>;
+
+	//! Counts the components and data components of each type in a template hierarchy
+	static void CountTemplateComponents(
+		const HierarchyComponentBase& templateComponent, const SceneRegistry& templateSceneRegistry, ComponentTypeCounts& componentCounts
+	)
+	{
+		const auto countComponent = [&componentCounts](const ComponentTypeIdentifier typeIdentifier)
+		{
+			auto it = componentCounts.Find(typeIdentifier);
+			if (it != componentCounts.end())
+			{
+				it->second++;
+			}
+			else
+			{
+				componentCounts.Emplace(ComponentTypeIdentifier(typeIdentifier), 1u);
+			}
+		};
+
+		countComponent(templateComponent.GetTypeIdentifier(templateSceneRegistry));
+		for (const SceneRegistry::DataComponentsBitIndexType index : templateSceneRegistry.GetDataComponentIterator(templateComponent.GetIdentifier()))
+		{
+			countComponent(ComponentTypeIdentifier::MakeFromValidIndex(index));
+		}
+
+		for (const HierarchyComponentBase& templateChild : templateComponent.GetChildren())
+		{
+			CountTemplateComponents(templateChild, templateSceneRegistry, componentCounts);
+		}
+	}
+
+	struct ComponentTemplateCache::BulkInstantiation
+	{
+		BulkInstantiation(
+			ComponentTemplateCache& cache,
+			const Component3D& templateComponent,
+			HierarchyComponentBase& parent,
+			SceneRegistry& sceneRegistry,
+			const ArrayView<const Math::WorldTransform> worldTransforms,
+			BulkInstantiatedCallback&& callback
+		)
+			: m_cache(cache)
+			, m_templateComponent(templateComponent)
+			, m_parent(parent)
+			, m_sceneRegistry(sceneRegistry)
+			, m_callback(Forward<BulkInstantiatedCallback>(callback))
+			, m_remainingInstanceCount(worldTransforms.GetSize())
+		{
+			m_worldTransforms.Reserve(worldTransforms.GetSize());
+			for (const Math::WorldTransform& worldTransform : worldTransforms)
+			{
+				m_worldTransforms.EmplaceBack(worldTransform);
+			}
+		}
+
+		void CloneInstances(Threading::JobRunnerThread& thread, const uint32 firstInstanceIndex, const uint32 endInstanceIndex)
+		{
+			Entity::ComponentRegistry& componentRegistry = System::Get<Entity::Manager>().GetRegistry();
+			ComponentTypeInterface& typeInterface = *m_templateComponent.GetTypeInfo();
+			const SceneRegistry& templateSceneRegistry = m_templateComponent.GetSceneRegistry();
+
+			for (uint32 instanceIndex = firstInstanceIndex; instanceIndex < endInstanceIndex; ++instanceIndex)
+			{
+				Threading::JobBatch cloningJobBatch;
+				const Optional<Entity::Component*> pComponent = typeInterface.CloneFromTemplateManualOnCreated(
+					Guid::Generate(),
+					m_templateComponent,
+					m_templateComponent.GetParent(),
+					m_parent,
+					m_sceneRegistry,
+					templateSceneRegistry,
+					cloningJobBatch
+				);
+				if (UNLIKELY(!pComponent.IsValid()))
+				{
+					OnInstanceProcessed();
+					continue;
+				}
+
+				// Move the instance before cloning its children, so they are created and inserted into the octree at their final transforms
+				// Only the childless instance root is moved, its reinsertion is deferred and batched with all others by the root scene
+				Component3D& component = static_cast<Component3D&>(*pComponent);
+				const Math::WorldTransform worldTransform = m_worldTransforms[instanceIndex];
+				if (!worldTransform.IsEquivalentTo(component.GetWorldTransform(m_sceneRegistry)))
+				{
+					component.SetWorldTransform(worldTransform);
+				}
+
+				for (const Component3D& templateChild : m_templateComponent.GetChildren())
+				{
+					ComponentTypeInterface& childTypeInterface = *templateChild.GetTypeInfo(templateSceneRegistry);
+					[[maybe_unused]] const Optional<Entity::Component*> pChild = childTypeInterface.CloneFromTemplateWithChildren(
+						Guid::Generate(),
+						templateChild,
+						m_templateComponent,
+						component,
+						componentRegistry,
+						m_sceneRegistry,
+						templateSceneRegistry,
+						cloningJobBatch
+					);
+				}
+				typeInterface.OnComponentCreated(component, m_parent, m_sceneRegistry);
+
+				if (cloningJobBatch.IsValid())
+				{
+					cloningJobBatch.QueueAsNewFinishedStage(Threading::CreateCallback(
+						[this, &component, instanceIndex](Threading::JobRunnerThread&)
+						{
+							m_callback(component, instanceIndex);
+							OnInstanceProcessed();
+						},
+						Threading::JobPriority::LoadScene
+					));
+					thread.Queue(cloningJobBatch);
+				}
+				else
+				{
+					m_callback(component, instanceIndex);
+					OnInstanceProcessed();
+				}
+			}
+		}
+	protected:
+		void OnInstanceProcessed()
+		{
+			if (m_remainingInstanceCount.FetchSubtract(1) == 1)
+			{
+				// Releases this instantiation, nothing may be accessed afterwards
+				m_cache.OnBulkInstantiationFinished(*this);
+			}
+		}
+	protected:
+		ComponentTemplateCache& m_cache;
+		const Component3D& m_templateComponent;
+		HierarchyComponentBase& m_parent;
+		SceneRegistry& m_sceneRegistry;
+		Vector<Math::WorldTransform> m_worldTransforms;
+		BulkInstantiatedCallback m_callback;
+		Threading::Atomic<uint32> m_remainingInstanceCount;
+	};
+
 	ComponentTemplateCache::ComponentTemplateCache(Asset::Manager& assetManager)
 		: m_pTemplateScene(UniquePtr<Scene>::Make(
 				m_templateSceneRegistry, Invalid, 10000_meters, Guid::Generate(), Scene::Flags::IsDisabled | Scene::Flags::IsTemplate
@@ -79,10 +228,18 @@ namespace ngine::Entity
 				{
 					const Asset::Guid assetGuid = GetAssetGuid(identifier);
 
-					Threading::Job* pLoadAssetJob = System::Get<Asset::Manager>().RequestAsyncLoadAssetMetadata(
+					// Prefer the compiled scene emitted by the asset compiler, as long as it is not outdated by the source metadata
+					Asset::Manager& assetManager = System::Get<Asset::Manager>();
+					const IO::Path metadataPath = assetManager.GetAssetPath(assetGuid);
+					const IO::Path compiledScenePath = BinaryScene::GetFilePath(metadataPath);
+					const bool isCompiledScene = metadataPath.HasElements() && compiledScenePath.Exists() &&
+					                             compiledScenePath.GetLastModifiedTime() >= metadataPath.GetLastModifiedTime();
+
+					Threading::Job* pLoadAssetJob = assetManager.RequestAsyncLoadAssetPath(
 						assetGuid,
+						isCompiledScene ? compiledScenePath : metadataPath,
 						Threading::JobPriority::LoadSceneTemplate,
-						[assetGuid, &sceneTemplate, this, identifier, pSceneRequesters](const ConstByteView data)
+						[assetGuid, &sceneTemplate, this, identifier, pSceneRequesters, isCompiledScene](const ConstByteView data)
 						{
 							if (UNLIKELY(!data.HasElements()))
 							{
@@ -94,9 +251,25 @@ namespace ngine::Entity
 								return;
 							}
 
-							Serialization::RootReader sceneSerializer = Serialization::GetReaderFromBuffer(
-								ConstStringView{reinterpret_cast<const char*>(data.GetData()), (uint32)(data.GetDataSize() / sizeof(char))}
-							);
+							BinaryScene binaryScene;
+							ConstStringView sceneData{reinterpret_cast<const char*>(data.GetData()), (uint32)(data.GetDataSize() / sizeof(char))};
+							if (isCompiledScene)
+							{
+								binaryScene = BinaryScene(data);
+								if (UNLIKELY(!binaryScene.IsValid()))
+								{
+									System::Get<Log>()
+										.Warning(SOURCE_LOCATION, "Scene template load failed: Asset with guid {0} compiled scene was invalid", assetGuid);
+									[[maybe_unused]] const bool wasCleared = m_loadingScenes.Clear(identifier);
+									Assert(wasCleared);
+									(*pSceneRequesters)(identifier);
+									return;
+								}
+								// The properties of all nodes form one array, parsed once for both the root and the flattened hierarchy
+								sceneData = binaryScene.GetPropertyData();
+							}
+
+							Serialization::RootReader sceneSerializer = Serialization::GetReaderFromBuffer(sceneData);
 							if (UNLIKELY(!sceneSerializer.GetData().IsValid()))
 							{
 								System::Get<Log>()
@@ -107,7 +280,19 @@ namespace ngine::Entity
 								return;
 							}
 
-							const Serialization::Reader reader = sceneSerializer;
+							Vector<Serialization::Reader, uint32> propertyReaders;
+							if (binaryScene.IsValid() && UNLIKELY(!binaryScene.GetPropertyReaders(sceneSerializer, propertyReaders)))
+							{
+								System::Get<Log>()
+									.Warning(SOURCE_LOCATION, "Scene template load failed: Asset with guid {0} compiled scene properties were invalid", assetGuid);
+								[[maybe_unused]] const bool wasCleared = m_loadingScenes.Clear(identifier);
+								Assert(wasCleared);
+								(*pSceneRequesters)(identifier);
+								return;
+							}
+
+							const Serialization::Reader reader = binaryScene.IsValid() ? propertyReaders[binaryScene.GetRootNode().m_propertiesIndex]
+							                                                           : Serialization::Reader(sceneSerializer);
 							Optional<Guid> typeGuid = reader.Read<Guid>("typeGuid");
 							if (UNLIKELY(!typeGuid.IsValid()))
 							{
@@ -176,7 +361,9 @@ namespace ngine::Entity
 								sceneComponent.SetSceneTemplateIdentifier(identifier);
 							}
 
-							Threading::JobBatch childJobBatch = component.Component3D::DeserializeDataComponentsAndChildren(deserializer.m_reader);
+							Threading::JobBatch childJobBatch = binaryScene.IsValid()
+							                                      ? component.Component3D::DeserializeDataComponentsAndChildren(binaryScene, propertyReaders.GetView())
+							                                      : component.Component3D::DeserializeDataComponentsAndChildren(deserializer.m_reader);
 							deserializer.m_pJobBatch->QueueAsNewFinishedStage(childJobBatch);
 
 							if (*typeGuid == Reflection::GetTypeGuid<SceneComponent>() || *typeGuid == Reflection::GetTypeGuid<RootSceneComponent>())
@@ -473,6 +660,91 @@ namespace ngine::Entity
 		return m_loadedScenes.IsSet(identifier);
 	}
 
+	Threading::JobBatch ComponentTemplateCache::InstantiateBulk(
+		const ComponentTemplateIdentifier identifier,
+		HierarchyComponentBase& parent,
+		SceneRegistry& sceneRegistry,
+		const ArrayView<const Math::WorldTransform> worldTransforms,
+		BulkInstantiatedCallback&& callback
+	)
+	{
+		Assert(HasSceneLoaded(identifier));
+		const Optional<Component3D*> pTemplateComponent = GetAssetData(identifier).m_pRootComponent;
+		if (UNLIKELY(pTemplateComponent.IsInvalid() || worldTransforms.IsEmpty()))
+		{
+			return {};
+		}
+
+		const uint32 instanceCount = worldTransforms.GetSize();
+
+		// Grow the parent's children and the per type storage once, instead of once per cloned component
+		parent.ReserveAdditionalChildren((HierarchyComponentBase::ChildIndex)Math::Min(instanceCount, (uint32)Math::NumericLimits<uint16>::Max));
+		{
+			ComponentTypeCounts componentCounts;
+			CountTemplateComponents(*pTemplateComponent, pTemplateComponent->GetSceneRegistry(), componentCounts);
+			for (const auto& componentCount : componentCounts)
+			{
+				const Optional<ComponentTypeSceneDataInterface*> pSceneData = sceneRegistry.GetOrCreateComponentTypeData(componentCount.first);
+				if (UNLIKELY_ERROR(pSceneData.IsInvalid() || !pSceneData->ReserveAdditionalInstances(componentCount.second * instanceCount)))
+				{
+					// Fail before cloning anything instead of leaving a partially instantiated set
+					LogError("Not enough component storage to instantiate {} instances", instanceCount);
+					return {};
+				}
+			}
+		}
+
+		// Owned by the cache until the last instance was processed, cloning jobs and their nested batches can outlive the returned batch
+		UniquePtr<BulkInstantiation> pNewBulkInstantiation = UniquePtr<BulkInstantiation>::Make(
+			*this,
+			*pTemplateComponent,
+			parent,
+			sceneRegistry,
+			worldTransforms,
+			Forward<BulkInstantiatedCallback>(callback)
+		);
+		BulkInstantiation* pBulkInstantiation = pNewBulkInstantiation.Get();
+		{
+			Threading::UniqueLock lock(m_bulkInstantiationsMutex);
+			m_bulkInstantiations.EmplaceBack(Move(pNewBulkInstantiation));
+		}
+
+		Threading::JobBatch jobBatch{Threading::JobBatch::IntermediateStage};
+		for (uint32 firstInstanceIndex = 0; firstInstanceIndex < instanceCount; firstInstanceIndex += BulkInstantiationChunkSize)
+		{
+			const uint32 endInstanceIndex = Math::Min(firstInstanceIndex + BulkInstantiationChunkSize, instanceCount);
+			jobBatch.QueueAfterStartStage(Threading::CreateCallback(
+				[pBulkInstantiation, firstInstanceIndex, endInstanceIndex](Threading::JobRunnerThread& thread)
+				{
+					pBulkInstantiation->CloneInstances(thread, firstInstanceIndex, endInstanceIndex);
+				},
+				Threading::JobPriority::LoadScene
+			));
+		}
+		return jobBatch;
+	}
+
+	void ComponentTemplateCache::OnBulkInstantiationFinished(BulkInstantiation& bulkInstantiation)
+	{
+		UniquePtr<BulkInstantiation> pReleasedBulkInstantiation;
+		{
+			Threading::UniqueLock lock(m_bulkInstantiationsMutex);
+			m_bulkInstantiations.RemoveFirstOccurrencePredicate(
+				[&bulkInstantiation, &pReleasedBulkInstantiation](UniquePtr<BulkInstantiation>& pBulkInstantiation)
+				{
+					if (pBulkInstantiation.Get() == &bulkInstantiation)
+					{
+						pReleasedBulkInstantiation = Move(pBulkInstantiation);
+						return ErasePredicateResult::Remove;
+					}
+					return ErasePredicateResult::Continue;
+				}
+			);
+		}
+		// Destroyed outside of the lock, the callback may own arbitrary state
+		Assert(pReleasedBulkInstantiation.IsValid());
+	}
+
 	void ComponentTemplateCache::Reset()
 	{
 		m_loadingScenes.Clear(m_loadedScenes);
@@ -2,35 +2,439 @@
 
 #include <Common/System/Query.h>
 #include <Common/IO/Log.h>
+#include <Common/Algorithms/Sort.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
 
 namespace ngine::Resource
 {
-	// TODO: Resource priority
-	// On unload we should find the least prioritized assets that would free up the necessary space
-	// Maybe it should be a weighted sort based on priority and size. Priority weighted first so higher prio is always further up in the list,
-	// then order by size for equal priorities. Freeing should start with the lowest prioritized assets
+	// The resource manager solely cares about memory, on CPU and GPU.
+	// Resources are evicted in order of a score weighted by priority, recent usage and distance to the closest viewer,
+	// with larger resources freed first among equal scores. Resources marked as unused score zero and are always freed first.
+	// Grouped resources (i.e. one mesh with its CPU vertex data and GPU buffers) are scored and freed as one, so they never end up partially loaded.
+	// Pooled allocations on both CPU and GPU should only be combined if they have the same or very similar priorities.
 
-	// The resource manager should solely care about memory, on CPU and GPU
-	// We should also be able to mark assets as unused, which would make them first to unload
-	// First example is when a scene or project is unloaded.
+	Manager::Manager()
+	{
+		System::Query::GetInstance().RegisterSystem(*this);
+	}
 
-	// We should probably be able to group multiple allocations as well as both GPU and CPU usage on a higher level
-	// For example, one mesh and its allocations treated as one. This way we deallocate everything at the same time instead of partially.
+	Manager::~Manager()
+	{
+		System::Query::GetInstance().DeregisterSystem<Manager>();
+	}
 
-	// Examples:
-	// Mesh = StaticObject 1 allocation for all vertex data on CPU
-	// Also means that pooled allocations on both CPU and GPU can only be combined if they have the same or very similar priorities
+	Identifier Manager::Register(Handler& handler, const Priority priority)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		const Identifier identifier = m_resourceIdentifiers.AcquireIdentifier();
+		Assert(identifier.IsValid());
+		if (UNLIKELY(identifier.IsInvalid()))
+		{
+			return {};
+		}
 
-	// Support having CPU and GPU memory budgets, and autorelease stuff if we request a resource with a higher priority when the limit has
-	// been reached
+		if (identifier.GetFirstValidIndex() >= m_resources.GetSize())
+		{
+			m_resources.Resize(identifier.GetFirstValidIndex() + 1);
+		}
 
-	Manager::Manager()
+		Resource& resource = GetResource(identifier);
+		resource = Resource{};
+		resource.m_identifier = identifier;
+		resource.m_pHandler = handler;
+		resource.m_priority = priority;
+		resource.m_lastUsedFrameIndex = m_frameIndex.Load();
+		resource.m_state = Resource::State::Pending;
+		m_resourceUseCounts[identifier] = 0;
+		return identifier;
+	}
+
+	void Manager::Deregister(const Identifier identifier)
 	{
-		System::Query::GetInstance().RegisterSystem(*this);
+		RemoveFromGroup(identifier);
+
+		Threading::UniqueLock lock(m_mutex);
+		Resource& resource = GetResource(identifier);
+		Assert(resource.m_state != Resource::State::Unregistered);
+		SetDataSizes(resource, 0, 0);
+		resource = Resource{};
+		m_resourceIdentifiers.ReturnIdentifier(identifier);
+	}
+
+	void Manager::Acquire(const Identifier identifier)
+	{
+		m_resourceUseCounts[identifier].FetchAdd(1);
+	}
+
+	void Manager::Release(const Identifier identifier)
+	{
+		[[maybe_unused]] const uint32 previousUseCount = m_resourceUseCounts[identifier].FetchSubtract(1);
+		Assert(previousUseCount > 0);
+	}
+
+	bool Manager::IsPinned(const Identifier identifier) const
+	{
+		return m_resourceUseCounts[identifier].Load() > 0;
+	}
+
+	void Manager::SetBudget(const MemoryType type, const size budget)
+	{
+		Vector<QueuedHandlerCall> evictedResources;
+		{
+			Threading::UniqueLock lock(m_mutex);
+			m_budgets[(uint8)type] = budget;
+			EvictUntilWithinTargets(m_budgets, Math::NumericLimits<float>::Max, Identifier{}, evictedResources);
+		}
+		UnloadEvictedResources(evictedResources);
+	}
+
+	size Manager::GetBudget(const MemoryType type) const
+	{
+		Threading::UniqueLock lock(m_mutex);
+		return m_budgets[(uint8)type];
+	}
+
+	size Manager::GetUsage(const MemoryType type) const
+	{
+		Threading::UniqueLock lock(m_mutex);
+		return m_usages[(uint8)type];
+	}
+
+	bool Manager::OnLoaded(const Identifier identifier, const size cpuDataSize, const size gpuDataSize)
+	{
+		Vector<QueuedHandlerCall> evictedResources;
+		bool isWithinBudget;
+		{
+			Threading::UniqueLock lock(m_mutex);
+			Resource& resource = GetResource(identifier);
+			Assert(resource.m_state != Resource::State::Unregistered);
+			SetDataSizes(resource, cpuDataSize, gpuDataSize);
+			resource.m_state = Resource::State::Loaded;
+			resource.m_lastUsedFrameIndex = m_frameIndex.Load();
+
+			// Only make room by evicting resources that matter less than the one that was just loaded
+			isWithinBudget = EvictUntilWithinTargets(m_budgets, CalculateScore(resource), identifier, evictedResources);
+		}
+		UnloadEvictedResources(evictedResources);
+		return isWithinBudget;
+	}
+
+	void Manager::SetPriority(const Identifier identifier, const Priority priority)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		GetResource(identifier).m_priority = priority;
+	}
+
+	void Manager::SetDistance(const Identifier identifier, const float distance)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		GetResource(identifier).m_distance = distance;
+	}
+
+	void Manager::MarkUsed(const Identifier identifier)
+	{
+		Vector<QueuedHandlerCall> reloadedResources;
+		{
+			Threading::UniqueLock lock(m_mutex);
+			Resource& resource = GetResource(identifier);
+			resource.m_lastUsedFrameIndex = m_frameIndex.Load();
+			resource.m_isMarkedUnused = false;
+
+			const auto queueReload = [&reloadedResources](Resource& resource)
+			{
+				if (resource.m_state == Resource::State::Evicted)
+				{
+					resource.m_state = Resource::State::Reloading;
+					reloadedResources.EmplaceBack(QueuedHandlerCall{resource.m_identifier, *resource.m_pHandler});
+				}
+			};
+
+			if (resource.m_groupIdentifier.IsValid())
+			{
+				for (const Identifier groupResourceIdentifier : m_groups[resource.m_groupIdentifier.GetFirstValidIndex()].m_resources)
+				{
+					Resource& groupResource = GetResource(groupResourceIdentifier);
+					groupResource.m_lastUsedFrameIndex = resource.m_lastUsedFrameIndex;
+					queueReload(groupResource);
+				}
+			}
+			else
+			{
+				queueReload(resource);
+			}
+		}
+
+		for (const QueuedHandlerCall& reloadedResource : reloadedResources)
+		{
+			reloadedResource.m_handler->Reload(reloadedResource.m_identifier);
+		}
+	}
+
+	void Manager::MarkUnused(const Identifier identifier)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		GetResource(identifier).m_isMarkedUnused = true;
+	}
+
+	GroupIdentifier Manager::CreateGroup()
+	{
+		Threading::UniqueLock lock(m_mutex);
+		const GroupIdentifier groupIdentifier = m_groupIdentifiers.AcquireIdentifier();
+		Assert(groupIdentifier.IsValid());
+		if (LIKELY(groupIdentifier.IsValid()) && groupIdentifier.GetFirstValidIndex() >= m_groups.GetSize())
+		{
+			m_groups.Resize(groupIdentifier.GetFirstValidIndex() + 1);
+		}
+		return groupIdentifier;
+	}
+
+	void Manager::AddToGroup(const Identifier identifier, const GroupIdentifier groupIdentifier)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		Resource& resource = GetResource(identifier);
+		Assert(resource.m_groupIdentifier.IsInvalid(), "Resources can only be part of one group");
+		resource.m_groupIdentifier = groupIdentifier;
+		m_groups[groupIdentifier.GetFirstValidIndex()].m_resources.EmplaceBack(identifier);
+	}
+
+	void Manager::RemoveFromGroup(const Identifier identifier)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		Resource& resource = GetResource(identifier);
+		if (resource.m_groupIdentifier.IsValid())
+		{
+			[[maybe_unused]] const bool wasRemoved =
+				m_groups[resource.m_groupIdentifier.GetFirstValidIndex()].m_resources.RemoveFirstOccurrence(identifier);
+			Assert(wasRemoved);
+			resource.m_groupIdentifier = {};
+		}
+	}
+
+	void Manager::DestroyGroup(const GroupIdentifier groupIdentifier)
+	{
+		Threading::UniqueLock lock(m_mutex);
+		Group& group = m_groups[groupIdentifier.GetFirstValidIndex()];
+		for (const Identifier identifier : group.m_resources)
+		{
+			GetResource(identifier).m_groupIdentifier = {};
+		}
+		group.m_resources.Clear();
+		m_groupIdentifiers.ReturnIdentifier(groupIdentifier);
+	}
+
+	Manager::Resource::State Manager::GetState(const Identifier identifier) const
+	{
+		Threading::UniqueLock lock(m_mutex);
+		return GetResource(identifier).m_state;
+	}
+
+	size Manager::GetDataSize(const Identifier identifier, const MemoryType type) const
+	{
+		Threading::UniqueLock lock(m_mutex);
+		return GetResource(identifier).GetDataSize(type);
 	}
 
 	void Manager::OnMemoryRunningLow()
 	{
 		System::Get<Log>().Warning(SOURCE_LOCATION, "Running low on memory!");
+
+		Vector<QueuedHandlerCall> evictedResources;
+		{
+			Threading::UniqueLock lock(m_mutex);
+			Array<size, (uint8)MemoryType::Count> targets;
+			for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+			{
+				targets[typeIndex] = (size)((float)Math::Min(m_budgets[typeIndex], m_usages[typeIndex]) * LowMemoryTargetRatio);
+			}
+			EvictUntilWithinTargets(targets, Math::NumericLimits<float>::Max, Identifier{}, evictedResources);
+		}
+		UnloadEvictedResources(evictedResources);
+	}
+
+	float Manager::CalculateScore(const Resource& resource) const
+	{
+		if (resource.m_isMarkedUnused)
+		{
+			return 0.f;
+		}
+
+		const float framesSinceUse = (float)(m_frameIndex.Load() - resource.m_lastUsedFrameIndex);
+		const float usageWeight = UsageHalfLifeFrames / (UsageHalfLifeFrames + framesSinceUse);
+		const float distanceWeight = DistanceHalfLife / (DistanceHalfLife + Math::Max(resource.m_distance, 0.f));
+		return (float)resource.m_priority * usageWeight * distanceWeight;
+	}
+
+	void Manager::SetDataSizes(Resource& resource, const size cpuDataSize, const size gpuDataSize)
+	{
+		const Array<size, (uint8)MemoryType::Count> newDataSizes{cpuDataSize, gpuDataSize};
+		for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+		{
+			Assert(m_usages[typeIndex] >= resource.m_dataSizes[typeIndex]);
+			m_usages[typeIndex] = m_usages[typeIndex] - resource.m_dataSizes[typeIndex] + newDataSizes[typeIndex];
+			resource.m_dataSizes[typeIndex] = newDataSizes[typeIndex];
+		}
+	}
+
+	void Manager::Evict(Resource& resource, Vector<QueuedHandlerCall>& evictedResourcesOut)
+	{
+		Assert(resource.m_state == Resource::State::Loaded);
+		SetDataSizes(resource, 0, 0);
+		resource.m_state = Resource::State::Evicted;
+		evictedResourcesOut.EmplaceBack(QueuedHandlerCall{resource.m_identifier, *resource.m_pHandler});
+	}
+
+	bool Manager::EvictUntilWithinTargets(
+		const Array<size, (uint8)MemoryType::Count> targets,
+		const float scoreThreshold,
+		const Identifier excludedIdentifier,
+		Vector<QueuedHandlerCall>& evictedResourcesOut
+	)
+	{
+		const auto isOverTarget = [this, &targets](const uint8 typeIndex)
+		{
+			return m_usages[typeIndex] > targets[typeIndex];
+		};
+		const auto isWithinTargets = [isOverTarget]()
+		{
+			for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+			{
+				if (isOverTarget(typeIndex))
+				{
+					return false;
+				}
+			}
+			return true;
+		};
+
+		if (isWithinTargets())
+		{
+			return true;
+		}
+
+		const GroupIdentifier excludedGroupIdentifier = excludedIdentifier.IsValid() ? GetResource(excludedIdentifier).m_groupIdentifier
+		                                                                             : GroupIdentifier{};
+
+		Vector<EvictionCandidate> candidates;
+
+		// Ungrouped resources are evicted individually
+		for (const Resource& resource : m_resources)
+		{
+			if (resource.m_state != Resource::State::Loaded || resource.m_groupIdentifier.IsValid() ||
+			    resource.m_identifier == excludedIdentifier || IsPinned(resource.m_identifier))
+			{
+				continue;
+			}
+
+			const float score = CalculateScore(resource);
+			if (score < scoreThreshold)
+			{
+				candidates.EmplaceBack(EvictionCandidate{score, resource.m_dataSizes, resource.m_identifier, GroupIdentifier{}});
+			}
+		}
+
+		// Groups are evicted as a whole, scored by their most important loaded member
+		for (const Group& group : m_groups)
+		{
+			if (group.m_resources.IsEmpty())
+			{
+				continue;
+			}
+
+			const GroupIdentifier groupIdentifier = GetResource(group.m_resources[0]).m_groupIdentifier;
+			if (groupIdentifier == excludedGroupIdentifier)
+			{
+				continue;
+			}
+
+			EvictionCandidate candidate{0.f, {Memory::InitializeAll, 0u}, Identifier{}, groupIdentifier};
+			bool isPinned = false;
+			bool hasLoadedResources = false;
+			for (const Identifier identifier : group.m_resources)
+			{
+				const Resource& resource = GetResource(identifier);
+				isPinned |= IsPinned(identifier);
+				if (resource.m_state == Resource::State::Loaded)
+				{
+					hasLoadedResources = true;
+					candidate.m_score = Math::Max(candidate.m_score, CalculateScore(resource));
+					for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+					{
+						candidate.m_dataSizes[typeIndex] += resource.m_dataSizes[typeIndex];
+					}
+				}
+			}
+
+			if (hasLoadedResources && !isPinned && candidate.m_score < scoreThreshold)
+			{
+				candidates.EmplaceBack(Move(candidate));
+			}
+		}
+
+		// Lowest score first, and the largest first among equal scores
+		Algorithms::Sort(
+			candidates.begin(),
+			candidates.end(),
+			[](const EvictionCandidate& left, const EvictionCandidate& right)
+			{
+				if (left.m_score != right.m_score)
+				{
+					return left.m_score < right.m_score;
+				}
+
+				size leftSize = 0;
+				size rightSize = 0;
+				for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+				{
+					leftSize += left.m_dataSizes[typeIndex];
+					rightSize += right.m_dataSizes[typeIndex];
+				}
+				return leftSize > rightSize;
+			}
+		);
+
+		for (const EvictionCandidate& candidate : candidates)
+		{
+			if (isWithinTargets())
+			{
+				break;
+			}
+
+			bool freesOverTargetMemory = false;
+			for (uint8 typeIndex = 0; typeIndex < (uint8)MemoryType::Count; ++typeIndex)
+			{
+				freesOverTargetMemory |= isOverTarget(typeIndex) & (candidate.m_dataSizes[typeIndex] > 0);
+			}
+			if (!freesOverTargetMemory)
+			{
+				continue;
+			}
+
+			if (candidate.m_groupIdentifier.IsValid())
+			{
+				for (const Identifier identifier : m_groups[candidate.m_groupIdentifier.GetFirstValidIndex()].m_resources)
+				{
+					Resource& resource = GetResource(identifier);
+					if (resource.m_state == Resource::State::Loaded)
+					{
+						Evict(resource, evictedResourcesOut);
+					}
+				}
+			}
+			else
+			{
+				Evict(GetResource(candidate.m_identifier), evictedResourcesOut);
+			}
+		}
+
+		return isWithinTargets();
+	}
+
+	/* static */ void Manager::UnloadEvictedResources(const ArrayView<const QueuedHandlerCall> evictedResources)
+	{
+		for (const QueuedHandlerCall& evictedResource : evictedResources)
+		{
+			evictedResource.m_handler->Unload(evictedResource.m_identifier);
+		}
 	}
 }
@@ -0,0 +1,136 @@
+#include "Scene/Queries/AsyncOctreeTraversalCastJob.h"
+
+#include <Engine/Scene/SceneOctreeNode.h>
+#include <Engine/Entity/Component3D.h>
+#include <Engine/Entity/Data/Tags.h>
+#include <Engine/Entity/Component3D.inl>
+
+#include <Common/Serialization/Reader.h>
+#include <Common/Serialization/Writer.h>
+
+namespace ngine::SceneQueries
+{
+	AsyncOctreeTraversalCastJob::AsyncOctreeTraversalCastJob(
+		Entity::SceneRegistry& sceneRegistry,
+		const SceneOctreeNode& octreeNode,
+		const Tag::Mask tagMask,
+		const Math::WorldCoordinate origin,
+		const Math::Vector3f direction,
+		const Math::Lengthf maximumDistance,
+		Callback&& callback,
+		const Priority priority
+	)
+		: AsyncOctreeTraversalCastJob(
+				sceneRegistry, octreeNode, tagMask, origin, direction, maximumDistance, Math::Radiusf(0_meters), Forward<Callback>(callback), priority
+			)
+	{
+	}
+
+	AsyncOctreeTraversalCastJob::AsyncOctreeTraversalCastJob(
+		Entity::SceneRegistry& sceneRegistry,
+		const SceneOctreeNode& octreeNode,
+		const Tag::Mask tagMask,
+		const Math::WorldCoordinate origin,
+		const Math::Vector3f direction,
+		const Math::Lengthf maximumDistance,
+		const Math::Radiusf radius,
+		Callback&& callback,
+		const Priority priority
+	)
+		: Job(priority)
+		, m_sceneRegistry(sceneRegistry)
+		, m_initialOctreeNode(octreeNode)
+		, m_tagMask(tagMask)
+		, m_origin(origin)
+		, m_direction(direction)
+		, m_maximumDistance(maximumDistance.GetMeters())
+		, m_radius(radius.GetMeters())
+		, m_callback(Forward<Callback>(callback))
+	{
+	}
+
+	Threading::Job::Result AsyncOctreeTraversalCastJob::OnExecute(Threading::JobRunnerThread&)
+	{
+		Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData = m_sceneRegistry.GetCachedSceneData<Entity::Data::Tags>();
+
+		// Only the subtree of the initial node is searched, callers pass the root node to cast through the whole scene
+		QueueNode(*m_initialOctreeNode);
+
+		bool foundAny{false};
+		while (!m_queue.IsEmpty())
+		{
+			const OctreeTraversalQueue::Entry entry = m_queue.Pop();
+			if (entry.m_pComponent.IsValid())
+			{
+				foundAny = true;
+				if (m_callback(entry.m_pComponent, Math::Lengthf::FromMeters(entry.m_distance)) == Memory::CallbackResult::Break)
+				{
+					return Result::FinishedAndDelete;
+				}
+				continue;
+			}
+
+			const SceneOctreeNode& node = *entry.m_pNode;
+			{
+				const SceneOctreeNode::ComponentsView components = node.GetComponentsView();
+				for (Entity::Component3D& component : components)
+				{
+					QueueComponent(component, tagsSceneData);
+				}
+			}
+
+			for (const Optional<SceneOctreeNode*> pChildNode : node.GetChildren())
+			{
+				if (pChildNode != nullptr)
+				{
+					QueueNode(*pChildNode);
+				}
+			}
+		}
+
+		if (!foundAny)
+		{
+			m_callback(Invalid, Math::Lengthf::FromMeters(m_maximumDistance));
+		}
+		return Result::FinishedAndDelete;
+	}
+
+	void AsyncOctreeTraversalCastJob::QueueNode(const SceneOctreeNode& node)
+	{
+		if (node.ContainsAnyTags(m_tagMask))
+		{
+			if (const Optional<float> entryDistance =
+			      OctreeTraversalQueue::GetRayEntryDistance(node.GetChildBoundingBox(), m_origin, m_direction, m_maximumDistance, m_radius))
+			{
+				m_queue.PushNode(node, *entryDistance);
+			}
+		}
+	}
+
+	void AsyncOctreeTraversalCastJob::QueueComponent(
+		Entity::Component3D& component, Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData
+	)
+	{
+		Tag::Mask mask = Tag::Mask();
+		if (Optional<Entity::Data::Tags*> pTagComponent = component.FindDataComponentOfType<Entity::Data::Tags>(tagsSceneData))
+		{
+			mask = pTagComponent->GetMask();
+		}
+
+		if ((mask & m_tagMask).AreNoneSet())
+		{
+			return;
+		}
+
+		if (const Optional<float> entryDistance = OctreeTraversalQueue::GetRayEntryDistance(
+					component.GetWorldBoundingBox(m_sceneRegistry),
+					m_origin,
+					m_direction,
+					m_maximumDistance,
+					m_radius
+				))
+		{
+			m_queue.PushComponent(component, *entryDistance);
+		}
+	}
+}
@@ -0,0 +1,114 @@
+#include "Scene/Queries/AsyncOctreeTraversalNearestJob.h"
+
+#include <Engine/Scene/SceneOctreeNode.h>
+#include <Engine/Entity/Component3D.h>
+#include <Engine/Entity/Data/Tags.h>
+#include <Engine/Entity/Component3D.inl>
+
+#include <Common/Math/Sqrt.h>
+#include <Common/Serialization/Reader.h>
+#include <Common/Serialization/Writer.h>
+
+namespace ngine::SceneQueries
+{
+	AsyncOctreeTraversalNearestJob::AsyncOctreeTraversalNearestJob(
+		Entity::SceneRegistry& sceneRegistry,
+		const SceneOctreeNode& octreeNode,
+		const Tag::Mask tagMask,
+		const Math::WorldCoordinate location,
+		const Math::Lengthf maximumDistance,
+		const uint32 maximumCount,
+		Callback&& callback,
+		const Priority priority
+	)
+		: Job(priority)
+		, m_sceneRegistry(sceneRegistry)
+		, m_initialOctreeNode(octreeNode)
+		, m_tagMask(tagMask)
+		, m_location(location)
+		, m_maximumDistanceSquared(maximumDistance.GetMeters() * maximumDistance.GetMeters())
+		, m_callback(Forward<Callback>(callback))
+		, m_nearestComponents(maximumCount)
+	{
+	}
+
+	Threading::Job::Result AsyncOctreeTraversalNearestJob::OnExecute(Threading::JobRunnerThread&)
+	{
+		Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData = m_sceneRegistry.GetCachedSceneData<Entity::Data::Tags>();
+
+		// Only the subtree of the initial node is searched, callers pass the root node to search the whole scene
+		QueueNode(*m_initialOctreeNode);
+
+		// Nodes are visited nearest first, so once the nearest remaining node is further than the k'th nearest component found so far
+		// nothing left in the queue can contain a closer one
+		while (!m_queue.IsEmpty() && m_queue.GetNearestDistance() <= m_nearestComponents.GetAcceptedDistance(m_maximumDistanceSquared))
+		{
+			const OctreeTraversalQueue::Entry entry = m_queue.Pop();
+			const SceneOctreeNode& node = *entry.m_pNode;
+			{
+				const SceneOctreeNode::ComponentsView components = node.GetComponentsView();
+				for (Entity::Component3D& component : components)
+				{
+					QueueComponent(component, tagsSceneData);
+				}
+			}
+
+			for (const Optional<SceneOctreeNode*> pChildNode : node.GetChildren())
+			{
+				if (pChildNode != nullptr)
+				{
+					QueueNode(*pChildNode);
+				}
+			}
+		}
+
+		if (m_nearestComponents.IsEmpty())
+		{
+			m_callback(Invalid, Math::Lengthf::FromMeters(Math::Sqrt(m_maximumDistanceSquared)));
+			return Result::FinishedAndDelete;
+		}
+
+		for (const NearestComponentQueue::Entry& entry : m_nearestComponents.SortNearestFirst())
+		{
+			if (m_callback(&*entry.m_element, Math::Lengthf::FromMeters(Math::Sqrt(entry.m_distance))) == Memory::CallbackResult::Break)
+			{
+				break;
+			}
+		}
+		return Result::FinishedAndDelete;
+	}
+
+	void AsyncOctreeTraversalNearestJob::QueueNode(const SceneOctreeNode& node)
+	{
+		if (node.ContainsAnyTags(m_tagMask))
+		{
+			const float squaredDistance = OctreeTraversalQueue::GetSquaredDistance(node.GetChildBoundingBox(), m_location);
+			if (squaredDistance <= m_nearestComponents.GetAcceptedDistance(m_maximumDistanceSquared))
+			{
+				m_queue.PushNode(node, squaredDistance);
+			}
+		}
+	}
+
+	void AsyncOctreeTraversalNearestJob::QueueComponent(
+		Entity::Component3D& component, Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData
+	)
+	{
+		Tag::Mask mask = Tag::Mask();
+		if (Optional<Entity::Data::Tags*> pTagComponent = component.FindDataComponentOfType<Entity::Data::Tags>(tagsSceneData))
+		{
+			mask = pTagComponent->GetMask();
+		}
+
+		if ((mask & m_tagMask).AreNoneSet())
+		{
+			return;
+		}
+
+		const float squaredDistance = OctreeTraversalQueue::GetSquaredDistance(component.GetWorldBoundingBox(m_sceneRegistry), m_location);
+		if (squaredDistance <= m_maximumDistanceSquared)
+		{
+			m_nearestComponents.TryPush(component, squaredDistance);
+		}
+	}
+}
@@ -0,0 +1,121 @@
+#include "Scene/Queries/OctreeTraversalQueue.h"
+
+#include <Common/Math/Abs.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
+
+namespace ngine::SceneQueries
+{
+	void OctreeTraversalQueue::Push(const Entry entry)
+	{
+		m_entries.EmplaceBack(entry);
+
+		uint32 index = m_entries.GetSize() - 1;
+		while (index > 0)
+		{
+			const uint32 parentIndex = (index - 1) / 2;
+			if (m_entries[parentIndex].m_distance <= m_entries[index].m_distance)
+			{
+				break;
+			}
+			const Entry parentEntry = m_entries[parentIndex];
+			m_entries[parentIndex] = m_entries[index];
+			m_entries[index] = parentEntry;
+			index = parentIndex;
+		}
+	}
+
+	OctreeTraversalQueue::Entry OctreeTraversalQueue::Pop()
+	{
+		Assert(m_entries.HasElements());
+		const Entry result = m_entries[0];
+		m_entries[0] = m_entries.GetLastElement();
+		m_entries.PopBack();
+
+		const uint32 entryCount = m_entries.GetSize();
+		uint32 index = 0;
+		while (true)
+		{
+			const uint32 leftIndex = index * 2 + 1;
+			const uint32 rightIndex = leftIndex + 1;
+			uint32 smallestIndex = index;
+			if (leftIndex < entryCount && m_entries[leftIndex].m_distance < m_entries[smallestIndex].m_distance)
+			{
+				smallestIndex = leftIndex;
+			}
+			if (rightIndex < entryCount && m_entries[rightIndex].m_distance < m_entries[smallestIndex].m_distance)
+			{
+				smallestIndex = rightIndex;
+			}
+			if (smallestIndex == index)
+			{
+				break;
+			}
+
+			const Entry entry = m_entries[smallestIndex];
+			m_entries[smallestIndex] = m_entries[index];
+			m_entries[index] = entry;
+			index = smallestIndex;
+		}
+		return result;
+	}
+
+	Optional<float> OctreeTraversalQueue::GetRayEntryDistance(
+		const Math::WorldBoundingBox boundingBox,
+		const Math::WorldCoordinate origin,
+		const Math::Vector3f direction,
+		const float maximumDistance,
+		const float radius
+	)
+	{
+		const Math::Vector3f minimum = boundingBox.GetMinimum() - Math::Vector3f(radius);
+		const Math::Vector3f maximum = boundingBox.GetMaximum() + Math::Vector3f(radius);
+
+		float entryDistance = 0.f;
+		float exitDistance = maximumDistance;
+		for (uint8 axis = 0; axis < 3; ++axis)
+		{
+			if (Math::Abs(direction[axis]) < 1e-8f)
+			{
+				// Parallel to the slab, only hits if the origin lies within it
+				if (origin[axis] < minimum[axis] || origin[axis] > maximum[axis])
+				{
+					return Invalid;
+				}
+				continue;
+			}
+
+			const float inverseDirection = 1.f / direction[axis];
+			float nearDistance = (minimum[axis] - origin[axis]) * inverseDirection;
+			float farDistance = (maximum[axis] - origin[axis]) * inverseDirection;
+			if (nearDistance > farDistance)
+			{
+				const float distance = nearDistance;
+				nearDistance = farDistance;
+				farDistance = distance;
+			}
+
+			entryDistance = Math::Max(entryDistance, nearDistance);
+			exitDistance = Math::Min(exitDistance, farDistance);
+			if (entryDistance > exitDistance)
+			{
+				return Invalid;
+			}
+		}
+		return entryDistance;
+	}
+
+	float OctreeTraversalQueue::GetSquaredDistance(const Math::WorldBoundingBox boundingBox, const Math::WorldCoordinate point)
+	{
+		const Math::Vector3f minimum = boundingBox.GetMinimum();
+		const Math::Vector3f maximum = boundingBox.GetMaximum();
+
+		float squaredDistance = 0.f;
+		for (uint8 axis = 0; axis < 3; ++axis)
+		{
+			const float delta = Math::Max(Math::Max(minimum[axis] - point[axis], point[axis] - maximum[axis]), 0.f);
+			squaredDistance += delta * delta;
+		}
+		return squaredDistance;
+	}
+}
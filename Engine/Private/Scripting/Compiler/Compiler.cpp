@@ -86,7 +86,13 @@ namespace ngine::Scripting
 		{
 			EmitByte(uint8(OpCode::Return));
 		}
-		return m_state.flags.IsSet(Flags::Error) ? nullptr : UniquePtr<FunctionObject>::FromRaw(pFunction);
+		if (m_state.flags.IsSet(Flags::Error))
+		{
+			return nullptr;
+		}
+
+		FuseSuperinstructions(*pFunction);
+		return UniquePtr<FunctionObject>::FromRaw(pFunction);
 	}
 
 	UniquePtr<FunctionObject> Compiler::Compile(const AST::Expression::Function& function)
@@ -101,8 +107,13 @@ namespace ngine::Scripting
 		{
 			Error("Failed to compile function");
 		}
+		if (m_state.flags.IsSet(Flags::Error))
+		{
+			return nullptr;
+		}
 
-		return m_state.flags.IsSet(Flags::Error) ? nullptr : UniquePtr<FunctionObject>::FromRaw(pFunction);
+		FuseSuperinstructions(*pFunction);
+		return UniquePtr<FunctionObject>::FromRaw(pFunction);
 	}
 
 	void Compiler::Visit(const AST::Statement::Block& block)
@@ -3245,7 +3256,8 @@ namespace ngine::Scripting
 
 			if (Optional<const uint32*> pVersion = input.ReadAndSkip<uint32>())
 			{
-				if (*pVersion != Version)
+				// Older versions only lack superinstructions and remain executable
+				if (*pVersion > Version)
 				{
 					// This is the place to potentially patch older formats
 					LogError("Can't load file version '{}', only '{}' is supported", *pVersion, Version);
@@ -3634,4 +3646,161 @@ namespace ngine::Scripting
 		}
 		return true;
 	}
+
+	[[nodiscard]] static uint32 GetInstructionSize(const Chunk& chunk, const uint32 offset)
+	{
+		switch (OpCode(chunk.code[offset]))
+		{
+			case OpCode::PushConstant:
+			case OpCode::PushImmediate:
+			case OpCode::PushComponentSoftReference:
+			case OpCode::PushGlobal:
+			case OpCode::SetGlobal:
+			case OpCode::PushLocal:
+			case OpCode::SetLocal:
+			case OpCode::PushUpvalue:
+			case OpCode::SetUpvalue:
+			// Superinstructions keep the operands of their first instruction
+			case OpCode::PushLocalPushImmediateAddInteger:
+			case OpCode::PushLocalPushConstantAddFloat:
+			case OpCode::PushLocalPushLocalAddFloat:
+			case OpCode::PushLocalPushLocalSubtractFloat:
+			case OpCode::PushLocalPushLocalMultiplyFloat:
+				return 2;
+			case OpCode::JumpIfFalse:
+			case OpCode::JumpIfTrue:
+			case OpCode::Jump:
+			case OpCode::CallNative:
+			case OpCode::CallClosure:
+				return 3;
+			case OpCode::PushClosure:
+			{
+				const Chunk::ConstantIndex constantIndex = chunk.code[offset + 1];
+				const Value value{chunk.constantValues[constantIndex], chunk.constantTypes[constantIndex]};
+				return 2 + AsFunctionObject(value)->upvalues * 2;
+			}
+			default:
+				return 1;
+		}
+	}
+
+	//! Gets the superinstruction fusing a comparison with the following JumpIfFalse, or Nop if none exists
+	[[nodiscard]] static OpCode GetCompareJumpIfFalseSuperinstruction(const OpCode opCode)
+	{
+		switch (opCode)
+		{
+			case OpCode::LessInteger:
+				return OpCode::LessIntegerJumpIfFalse;
+			case OpCode::LessEqualInteger:
+				return OpCode::LessEqualIntegerJumpIfFalse;
+			case OpCode::GreaterInteger:
+				return OpCode::GreaterIntegerJumpIfFalse;
+			case OpCode::GreaterEqualInteger:
+				return OpCode::GreaterEqualIntegerJumpIfFalse;
+			case OpCode::EqualEqualInteger:
+				return OpCode::EqualEqualIntegerJumpIfFalse;
+			case OpCode::NotEqualInteger:
+				return OpCode::NotEqualIntegerJumpIfFalse;
+			case OpCode::LessFloat:
+				return OpCode::LessFloatJumpIfFalse;
+			case OpCode::LessEqualFloat:
+				return OpCode::LessEqualFloatJumpIfFalse;
+			case OpCode::GreaterFloat:
+				return OpCode::GreaterFloatJumpIfFalse;
+			case OpCode::GreaterEqualFloat:
+				return OpCode::GreaterEqualFloatJumpIfFalse;
+			default:
+				return OpCode::Nop;
+		}
+	}
+
+	//! Gets the superinstruction fusing two PushLocal instructions with the following operation, or Nop if none exists
+	[[nodiscard]] static OpCode GetPushLocalsSuperinstruction(const OpCode opCode)
+	{
+		switch (opCode)
+		{
+			case OpCode::AddFloat:
+				return OpCode::PushLocalPushLocalAddFloat;
+			case OpCode::SubtractFloat:
+				return OpCode::PushLocalPushLocalSubtractFloat;
+			case OpCode::MultiplyFloat:
+				return OpCode::PushLocalPushLocalMultiplyFloat;
+			default:
+				return OpCode::Nop;
+		}
+	}
+
+	void Compiler::FuseSuperinstructions(FunctionObject& function)
+	{
+		Chunk& chunk = function.chunk;
+
+		Vector<uint32> instructionOffsets(Memory::Reserve, chunk.code.GetSize());
+		for (uint32 offset = 0, codeSize = chunk.code.GetSize(); offset < codeSize; offset += GetInstructionSize(chunk, offset))
+		{
+			instructionOffsets.EmplaceBack(offset);
+		}
+
+		const auto getOpCode = [&chunk, &instructionOffsets](const uint32 instructionIndex)
+		{
+			return instructionIndex < instructionOffsets.GetSize() ? OpCode(chunk.code[instructionOffsets[instructionIndex]]) : OpCode::Nop;
+		};
+
+		const uint32 instructionCount = instructionOffsets.GetSize();
+		for (uint32 instructionIndex = 0; instructionIndex < instructionCount; ++instructionIndex)
+		{
+			uint8& opCode = chunk.code[instructionOffsets[instructionIndex]];
+			const OpCode nextOpCode = getOpCode(instructionIndex + 1);
+			switch (OpCode(opCode))
+			{
+				case OpCode::PushLocal:
+				{
+					const OpCode thirdOpCode = getOpCode(instructionIndex + 2);
+					if (nextOpCode == OpCode::PushImmediate && thirdOpCode == OpCode::AddInteger)
+					{
+						opCode = uint8(OpCode::PushLocalPushImmediateAddInteger);
+						instructionIndex += 2;
+					}
+					else if (nextOpCode == OpCode::PushConstant && thirdOpCode == OpCode::AddFloat)
+					{
+						opCode = uint8(OpCode::PushLocalPushConstantAddFloat);
+						instructionIndex += 2;
+					}
+					else if (nextOpCode == OpCode::PushLocal && GetPushLocalsSuperinstruction(thirdOpCode) != OpCode::Nop)
+					{
+						opCode = uint8(GetPushLocalsSuperinstruction(thirdOpCode));
+						instructionIndex += 2;
+					}
+				}
+				break;
+				case OpCode::MultiplyFloat:
+				{
+					if (nextOpCode == OpCode::AddFloat)
+					{
+						opCode = uint8(OpCode::MultiplyAddFloat);
+						instructionIndex++;
+					}
+				}
+				break;
+				default:
+				{
+					const OpCode superinstruction = GetCompareJumpIfFalseSuperinstruction(OpCode(opCode));
+					if (superinstruction != OpCode::Nop && nextOpCode == OpCode::JumpIfFalse)
+					{
+						opCode = uint8(superinstruction);
+						instructionIndex++;
+					}
+				}
+				break;
+			}
+		}
+
+		for (Chunk::ConstantIndex i = 0, n = chunk.constantValues.GetSize(); i < n; ++i)
+		{
+			const Value value{chunk.constantValues[i], chunk.constantTypes[i]};
+			if (IsFunctionObject(value))
+			{
+				FuseSuperinstructions(*AsFunctionObject(value));
+			}
+		}
+	}
 }
@@ -439,6 +439,40 @@ namespace ngine::Scripting
 				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("SetUpvalue"));
 			case OpCode::CloseUpvalue:
 				return DisassembleInstruction(SCRIPT_STRING_LITERAL("CloseUpvalue"));
+
+			// Superinstructions, the fused instructions that follow are disassembled separately
+			case OpCode::PushLocalPushImmediateAddInteger:
+				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("PushLocalPushImmediateAddInteger"));
+			case OpCode::PushLocalPushConstantAddFloat:
+				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("PushLocalPushConstantAddFloat"));
+			case OpCode::PushLocalPushLocalAddFloat:
+				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("PushLocalPushLocalAddFloat"));
+			case OpCode::PushLocalPushLocalSubtractFloat:
+				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("PushLocalPushLocalSubtractFloat"));
+			case OpCode::PushLocalPushLocalMultiplyFloat:
+				return DisassembleByteInstruction(SCRIPT_STRING_LITERAL("PushLocalPushLocalMultiplyFloat"));
+			case OpCode::MultiplyAddFloat:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("MultiplyAddFloat"));
+			case OpCode::LessIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("LessIntegerJumpIfFalse"));
+			case OpCode::LessEqualIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("LessEqualIntegerJumpIfFalse"));
+			case OpCode::GreaterIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("GreaterIntegerJumpIfFalse"));
+			case OpCode::GreaterEqualIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("GreaterEqualIntegerJumpIfFalse"));
+			case OpCode::EqualEqualIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("EqualEqualIntegerJumpIfFalse"));
+			case OpCode::NotEqualIntegerJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("NotEqualIntegerJumpIfFalse"));
+			case OpCode::LessFloatJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("LessFloatJumpIfFalse"));
+			case OpCode::LessEqualFloatJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("LessEqualFloatJumpIfFalse"));
+			case OpCode::GreaterFloatJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("GreaterFloatJumpIfFalse"));
+			case OpCode::GreaterEqualFloatJumpIfFalse:
+				return DisassembleInstruction(SCRIPT_STRING_LITERAL("GreaterEqualFloatJumpIfFalse"));
 		}
 		ExpectUnreachable();
 	}
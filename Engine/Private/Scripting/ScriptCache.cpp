@@ -12,6 +12,7 @@
 #include <Engine/Scripting/Interpreter/Resolver.h>
 #include <Engine/Scripting/Compiler/Compiler.h>
 
+#include <Common/Math/Hash.h>
 #include <Common/Memory/Containers/String.h>
 #include <Common/Memory/Variant.h>
 #include <Common/Memory/Containers/Vector.h>
@@ -30,6 +31,32 @@
 
 namespace ngine::Scripting
 {
+	//! Records the shared function referenced by a compiled function of the script, or none if invalid
+	//! Returns the bytecode hash of the previously referenced shared function, which the caller has to release
+	[[nodiscard]] static Optional<size>
+	ExchangeSharedFunctionHash(Script& scriptData, const Guid localFunctionIdentifier, const Optional<size> bytecodeHash)
+	{
+		Optional<size> previousBytecodeHash;
+		const auto it = scriptData.m_sharedFunctionHashes.Find(localFunctionIdentifier);
+		if (it != scriptData.m_sharedFunctionHashes.end())
+		{
+			previousBytecodeHash = it->second;
+			if (bytecodeHash.IsValid())
+			{
+				it->second = *bytecodeHash;
+			}
+			else
+			{
+				scriptData.m_sharedFunctionHashes.Remove(it);
+			}
+		}
+		else if (bytecodeHash.IsValid())
+		{
+			scriptData.m_sharedFunctionHashes.Emplace(Guid{localFunctionIdentifier}, size(*bytecodeHash));
+		}
+		return previousBytecodeHash;
+	}
+
 	struct LoadScriptJob : public Threading::Job
 	{
 		enum class Mode : uint8
@@ -90,12 +117,18 @@ namespace ngine::Scripting
 								assetGuid,
 								binaryFilePath,
 								Threading::JobPriority::LoadLogic,
-								[&code = m_code](const ConstByteView data)
+								[this, &scriptCache = scriptCache](const ConstByteView data)
 								{
 									if (data.HasElements())
 									{
-										code.Resize((uint32)data.GetDataSize());
-										ByteView(code.GetView()).CopyFrom(data);
+										// Identical functions are only parsed and linked once per process
+										m_bytecodeHash = ScriptCache::GetBytecodeHash(data);
+										m_pSharedFunction = scriptCache.AcquireSharedFunction(data, m_bytecodeHash);
+										if (m_pSharedFunction.IsInvalid())
+										{
+											m_code.Resize((uint32)data.GetDataSize());
+											ByteView(m_code.GetView()).CopyFrom(data);
+										}
 									}
 								},
 								{},
@@ -162,23 +195,50 @@ namespace ngine::Scripting
 						break;
 						case Mode::Compiled:
 						{
-							Compiler compiler;
-							UniquePtr<FunctionObject> pFunction = compiler.Load(m_code.GetView());
-							if (pFunction.IsInvalid())
+							if (m_pSharedFunction.IsInvalid())
 							{
-								scriptCache.OnCompiledLoadFailed(m_identifier);
-								return Result::FinishedAndDelete;
+								Compiler compiler;
+								UniquePtr<FunctionObject> pFunction = compiler.Load(m_code.GetView());
+								if (pFunction.IsInvalid())
+								{
+									scriptCache.OnCompiledLoadFailed(m_identifier);
+									return Result::FinishedAndDelete;
+								}
+
+								m_pSharedFunction = scriptCache.FindOrAddSharedFunction(m_code.GetView(), m_bytecodeHash, pFunction);
+								if (m_pSharedFunction.IsInvalid())
+								{
+									// Bytecode hash collided with a different shared function, so this script owns its own copy
+									m_pSharedFunction = pFunction.Get();
+									m_pUnsharedFunction = Move(pFunction);
+								}
 							}
 
 							Script& scriptData = scriptCache.GetAssetData(m_identifier);
+							Optional<size> previousBytecodeHash;
 							{
 								Threading::UniqueLock lock(scriptData.m_functionMutex);
+								Optional<size> bytecodeHash;
+								if (m_pUnsharedFunction.IsValid())
+								{
+									scriptData.m_assignedFunctions.EmplaceOrAssign(Guid{m_functionGuid}, Move(m_pUnsharedFunction));
+								}
+								else
+								{
+									bytecodeHash = m_bytecodeHash;
+								}
 								auto it = scriptData.m_compiledFunctions.Find(m_functionGuid);
 								if (it == scriptData.m_compiledFunctions.end())
 								{
 									it = scriptData.m_compiledFunctions.Emplace(Guid{m_functionGuid}, {});
 								}
-								it->second = Move(pFunction);
+								it->second = m_pSharedFunction;
+								previousBytecodeHash = ExchangeSharedFunctionHash(scriptData, m_functionGuid, bytecodeHash);
+							}
+							// Released after the new reference was added, so reloading identical bytecode keeps the shared function alive
+							if (previousBytecodeHash.IsValid())
+							{
+								scriptCache.ReleaseSharedFunction(*previousBytecodeHash);
 							}
 
 							scriptCache.OnLoadedCompiled(m_identifier);
@@ -198,6 +258,9 @@ namespace ngine::Scripting
 		const Mode m_mode;
 		Serialization::Data m_abstractSyntaxTreeData;
 		Vector<ByteType> m_code;
+		size m_bytecodeHash{0};
+		Optional<const FunctionObject*> m_pSharedFunction;
+		UniquePtr<FunctionObject> m_pUnsharedFunction;
 		enum class State : uint8
 		{
 			AwaitingStart,
@@ -251,11 +314,87 @@ namespace ngine::Scripting
 		const auto it = scriptData.m_compiledFunctions.Find(localFunctionIdentifier);
 		if (it != scriptData.m_compiledFunctions.end())
 		{
-			return it->second.Get();
+			return it->second;
+		}
+		return Invalid;
+	}
+
+	[[nodiscard]] static ArrayView<const ByteType, size> GetBytecodeBody(const ConstByteView bytecode)
+	{
+		// Skip the header, as it contains the time of compilation
+		const size headerSize = Math::Min(bytecode.GetDataSize(), (size)Compiler::HeaderSize);
+		return ArrayView<const ByteType, size>{bytecode.GetData() + headerSize, bytecode.GetDataSize() - headerSize};
+	}
+
+	size ScriptCache::GetBytecodeHash(const ConstByteView bytecode)
+	{
+		return Math::Hash(GetBytecodeBody(bytecode));
+	}
+
+	Optional<const FunctionObject*> ScriptCache::FindSharedFunction(const ConstByteView bytecode, const size bytecodeHash) const
+	{
+		Threading::SharedLock lock(m_sharedFunctionsMutex);
+		const auto it = m_sharedFunctions.Find(bytecodeHash);
+		if (it != m_sharedFunctions.end() && it->second.m_bytecode.GetView() == GetBytecodeBody(bytecode))
+		{
+			return it->second.m_pFunction.Get();
+		}
+		return Invalid;
+	}
+
+	Optional<const FunctionObject*> ScriptCache::AcquireSharedFunction(const ConstByteView bytecode, const size bytecodeHash)
+	{
+		Threading::UniqueLock lock(m_sharedFunctionsMutex);
+		const auto it = m_sharedFunctions.Find(bytecodeHash);
+		if (it != m_sharedFunctions.end() && it->second.m_bytecode.GetView() == GetBytecodeBody(bytecode))
+		{
+			it->second.m_referenceCount++;
+			return it->second.m_pFunction.Get();
 		}
 		return Invalid;
 	}
 
+	Optional<const FunctionObject*>
+	ScriptCache::FindOrAddSharedFunction(const ConstByteView bytecode, const size bytecodeHash, UniquePtr<FunctionObject>& pFunction)
+	{
+		const ArrayView<const ByteType, size> bytecodeBody = GetBytecodeBody(bytecode);
+		Threading::UniqueLock lock(m_sharedFunctionsMutex);
+		auto it = m_sharedFunctions.Find(bytecodeHash);
+		if (it == m_sharedFunctions.end())
+		{
+			Vector<ByteType, size> sharedBytecode(Memory::ConstructWithSize, Memory::Uninitialized, bytecodeBody.GetSize());
+			sharedBytecode.GetView().CopyFrom(bytecodeBody);
+			it = m_sharedFunctions.Emplace(size(bytecodeHash), SharedFunction{Move(sharedBytecode), Move(pFunction), 1u});
+			return it->second.m_pFunction.Get();
+		}
+		else if (LIKELY(it->second.m_bytecode.GetView() == bytecodeBody))
+		{
+			it->second.m_referenceCount++;
+			return it->second.m_pFunction.Get();
+		}
+		else
+		{
+			// Hash collision, the shared function may already be referenced so it is kept and the new function stays unshared
+			return Invalid;
+		}
+	}
+
+	void ScriptCache::ReleaseSharedFunction(const size bytecodeHash)
+	{
+		// Destroyed once the lock was released
+		UniquePtr<FunctionObject> pReleasedFunction;
+		{
+			Threading::UniqueLock lock(m_sharedFunctionsMutex);
+			const auto it = m_sharedFunctions.Find(bytecodeHash);
+			Assert(it != m_sharedFunctions.end() && it->second.m_referenceCount > 0);
+			if (LIKELY(it != m_sharedFunctions.end()) && --it->second.m_referenceCount == 0)
+			{
+				pReleasedFunction = Move(it->second.m_pFunction);
+				m_sharedFunctions.Remove(it);
+			}
+		}
+	}
+
 	SharedPtr<Environment> ScriptCache::GetIntermediateEnvironment() const
 	{
 		return m_pIntermediateEnvironment;
@@ -360,17 +499,17 @@ namespace ngine::Scripting
 		if (m_loadingCompiledScripts.Set(identifier))
 		{
 			Script& scriptData = GetAssetData(identifier);
+			Optional<size> previousBytecodeHash;
 			{
 				Threading::UniqueLock lock(scriptData.m_functionMutex);
-				auto it = scriptData.m_compiledFunctions.Find(localFunctionIdentifier);
-				if (it != scriptData.m_compiledFunctions.end())
-				{
-					it->second = Forward<UniquePtr<FunctionObject>>(pFunctionObject);
-				}
-				else
-				{
-					scriptData.m_compiledFunctions.Emplace(Guid{localFunctionIdentifier}, Forward<UniquePtr<FunctionObject>>(pFunctionObject));
-				}
+				const Optional<const FunctionObject*> pFunction = pFunctionObject.Get();
+				scriptData.m_assignedFunctions.EmplaceOrAssign(Guid{localFunctionIdentifier}, Forward<UniquePtr<FunctionObject>>(pFunctionObject));
+				scriptData.m_compiledFunctions.EmplaceOrAssign(Guid{localFunctionIdentifier}, Optional<const FunctionObject*>{pFunction});
+				previousBytecodeHash = ExchangeSharedFunctionHash(scriptData, localFunctionIdentifier, Invalid);
+			}
+			if (previousBytecodeHash.IsValid())
+			{
+				ReleaseSharedFunction(*previousBytecodeHash);
 			}
 
 			OnLoadedCompiled(identifier);
@@ -387,19 +526,49 @@ namespace ngine::Scripting
 		if (m_loadingCompiledScripts.Set(identifier))
 		{
 			Script& scriptData = GetAssetData(identifier);
+			Optional<size> previousBytecodeHash;
 			{
 				Threading::UniqueLock lock(scriptData.m_functionMutex);
 				auto it = scriptData.m_compiledFunctions.Find(localFunctionIdentifier);
 				if (it != scriptData.m_compiledFunctions.end())
 				{
-					it->second.DestroyElement();
+					it->second = Invalid;
 				}
+
+				auto assignedIt = scriptData.m_assignedFunctions.Find(localFunctionIdentifier);
+				if (assignedIt != scriptData.m_assignedFunctions.end())
+				{
+					assignedIt->second.DestroyElement();
+				}
+				previousBytecodeHash = ExchangeSharedFunctionHash(scriptData, localFunctionIdentifier, Invalid);
+			}
+			if (previousBytecodeHash.IsValid())
+			{
+				ReleaseSharedFunction(*previousBytecodeHash);
 			}
 
 			OnLoadedCompiled(identifier);
 		}
 	}
 
+	void ScriptCache::UnloadCompiledFunctions(ScriptIdentifier identifier)
+	{
+		Script& scriptData = GetAssetData(identifier);
+		UnorderedMap<Guid, size, Guid::Hash> sharedFunctionHashes;
+		{
+			Threading::UniqueLock lock(scriptData.m_functionMutex);
+			scriptData.m_compiledFunctions.Clear();
+			scriptData.m_assignedFunctions.Clear();
+			sharedFunctionHashes = Move(scriptData.m_sharedFunctionHashes);
+			scriptData.m_sharedFunctionHashes.Clear();
+		}
+
+		for (const auto& sharedFunctionHash : sharedFunctionHashes)
+		{
+			ReleaseSharedFunction(sharedFunctionHash.second);
+		}
+	}
+
 	void ScriptCache::OnLoadedInterpreted(ScriptIdentifier identifier)
 	{
 		m_reloadingAssets.Clear(identifier);
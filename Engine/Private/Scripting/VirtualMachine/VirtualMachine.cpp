@@ -42,14 +42,79 @@
 
 // #define SCRIPTING_DEBUG_TRACE_EXECUTION
 
+//! Dispatches each instruction with a computed goto at the end of the previous one where the compiler supports it
+//! Define as 0 (or configure with OPTION_SCRIPTING_VM_THREADED_DISPATCH=OFF) to use the portable switch based loop instead
+#ifndef SCRIPTING_VM_THREADED_DISPATCH
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(SCRIPTING_DEBUG_TRACE_EXECUTION)
+#define SCRIPTING_VM_THREADED_DISPATCH 1
+#else
+#define SCRIPTING_VM_THREADED_DISPATCH 0
+#endif
+#endif
+
 namespace ngine::Scripting
 {
 	constexpr bool EnableStressGC = false;
 
+	//! Binds an execution stack to the virtual machine for the duration of an execution
+	//! Stacks are pooled per thread and nesting level, as native functions called by a script can execute other scripts
+	struct VirtualMachine::ExecutionScope
+	{
+		struct Pool
+		{
+			Vector<UniquePtr<ExecutionStack>, uint32> m_stacks;
+			uint32 m_depth{0};
+		};
+
+		[[nodiscard]] static Pool& GetPool()
+		{
+			thread_local Pool pool;
+			return pool;
+		}
+
+		ExecutionScope(State& state)
+			: m_state(state)
+			, m_previousSp(state.sp)
+			, m_pPreviousStack(state.pStack)
+			, m_previousFrameCount(state.frameCount)
+			, m_pPreviousOpenUpvalues(state.pOpenUpvalues)
+		{
+			Pool& pool = GetPool();
+			if (pool.m_depth == pool.m_stacks.GetSize())
+			{
+				pool.m_stacks.EmplaceBack(UniquePtr<ExecutionStack>::Make());
+				pool.m_stacks.GetLastElement()->values.Resize(InitialStackSize);
+			}
+
+			ExecutionStack& stack = *pool.m_stacks[pool.m_depth++];
+			state.pStack = stack;
+			state.sp = stack.values.GetData();
+			state.frameCount = 0;
+			state.pOpenUpvalues = nullptr;
+		}
+		ExecutionScope(const ExecutionScope&) = delete;
+		ExecutionScope& operator=(const ExecutionScope&) = delete;
+		~ExecutionScope()
+		{
+			GetPool().m_depth--;
+
+			m_state.sp = m_previousSp;
+			m_state.pStack = m_pPreviousStack;
+			m_state.frameCount = m_previousFrameCount;
+			m_state.pOpenUpvalues = m_pPreviousOpenUpvalues;
+		}
+	protected:
+		State& m_state;
+		RawValue* m_previousSp;
+		Optional<ExecutionStack*> m_pPreviousStack;
+		uint32 m_previousFrameCount;
+		UpvalueObject* m_pPreviousOpenUpvalues;
+	};
+
 	VirtualMachine::VirtualMachine()
 		: m_pScript(nullptr)
 	{
-		m_state.sp = m_state.stack.GetData();
+		m_state.sp = nullptr;
 		m_state.frameCount = 0;
 		m_state.pOpenUpvalues = nullptr;
 		m_state.pObjects = nullptr;
@@ -79,6 +144,7 @@ namespace ngine::Scripting
 
 	bool VirtualMachine::Execute()
 	{
+		ExecutionScope executionScope(m_state);
 		ClosureObject* const pClosureObject = CreateClosureObject(m_state.gc, const_cast<FunctionObject*>(m_pScript.Get()));
 		Push(RawValue((Object*)pClosureObject));
 		Call(*pClosureObject, 0, 0);
@@ -89,6 +155,7 @@ namespace ngine::Scripting
 	VM::ReturnValue
 	VirtualMachine::Execute(VM::Register R0, VM::Register R1, VM::Register R2, VM::Register R3, VM::Register R4, VM::Register R5)
 	{
+		ExecutionScope executionScope(m_state);
 		ClosureObject* const pClosureObject = CreateClosureObject(m_state.gc, const_cast<FunctionObject*>(m_pScript.Get()));
 		Push(RawValue{(Object*)pClosureObject});
 
@@ -120,6 +187,7 @@ namespace ngine::Scripting
 
 	bool VirtualMachine::Execute(const ArrayView<RawValue, uint8> args, const ArrayView<RawValue, uint8> results)
 	{
+		ExecutionScope executionScope(m_state);
 		ClosureObject* const pClosureObject = CreateClosureObject(m_state.gc, const_cast<FunctionObject*>(m_pScript.Get()));
 		Push(RawValue{(Object*)pClosureObject});
 
@@ -148,7 +216,7 @@ namespace ngine::Scripting
 
 	bool VirtualMachine::Invoke(ClosureObject& function, ArrayView<RawValue, uint8> args, ArrayView<RawValue, uint8> results)
 	{
-		m_state.sp = m_state.stack.GetData();
+		ExecutionScope executionScope(m_state);
 		Push(RawValue{(Object*)&function});
 		const uint8 argCount = uint8(args.GetSize());
 		const uint8 coarity = uint8(results.GetSize());
@@ -225,7 +293,7 @@ namespace ngine::Scripting
 
 	bool VirtualMachine::Run()
 	{
-		CallFrame* pFrame = &m_state.frames[m_state.frameCount - 1];
+		CallFrame* pFrame = &m_state.pStack->frames[m_state.frameCount - 1];
 		const uint8* ip = pFrame->ip;
 		if (ip == nullptr)
 		{
@@ -240,6 +308,204 @@ namespace ngine::Scripting
 #define READ_GUID() GetConstantGuid(pFrame->pClosure->pFunction->chunk, READ_BYTE())
 #define READ_FUNCTION() GetFunctionIdentifier(pFrame->pClosure->pFunction->chunk, READ_BYTE())
 
+#if SCRIPTING_VM_THREADED_DISPATCH
+		// Indexed by opcode, must list every opcode in declaration order
+		static const void* const dispatchTable[] = {
+			&&Label_Nop,
+			&&Label_Null,
+			&&Label_True,
+			&&Label_False,
+			&&Label_PushConstant,
+			&&Label_PushImmediate,
+			&&Label_JumpIfFalse,
+			&&Label_JumpIfTrue,
+			&&Label_Pop,
+			&&Label_Return,
+			&&Label_CallNative,
+			&&Label_CallClosure,
+			&&Label_Jump,
+			&&Label_NegateFloat,
+			&&Label_AddFloat,
+			&&Label_SubtractFloat,
+			&&Label_MultiplyFloat,
+			&&Label_DivideFloat,
+			&&Label_LogicalNotFloat,
+			&&Label_LessFloat,
+			&&Label_LessFloat4,
+			&&Label_LessEqualFloat,
+			&&Label_LessEqualFloat4,
+			&&Label_GreaterFloat,
+			&&Label_GreaterFloat4,
+			&&Label_GreaterEqualFloat,
+			&&Label_GreaterEqualFloat4,
+			&&Label_NotEqualFloat,
+			&&Label_NotEqualFloat4,
+			&&Label_EqualEqualFloat,
+			&&Label_EqualEqualFloat4,
+			&&Label_ModuloFloat,
+			&&Label_AbsFloat,
+			&&Label_AcosFloat,
+			&&Label_AsinFloat,
+			&&Label_AtanFloat,
+			&&Label_Atan2Float,
+			&&Label_CeilFloat,
+			&&Label_CubicRootFloat,
+			&&Label_CosFloat,
+			&&Label_RadiansToDegreesFloat,
+			&&Label_ExpFloat,
+			&&Label_FloorFloat,
+			&&Label_FractFloat,
+			&&Label_InverseSqrtFloat,
+			&&Label_LogFloat,
+			&&Label_Log2Float,
+			&&Label_Log10Float,
+			&&Label_MaxFloat,
+			&&Label_MinFloat,
+			&&Label_RoundFloat,
+			&&Label_MultiplicativeInverseFloat,
+			&&Label_PowerFloat,
+			&&Label_Power2Float,
+			&&Label_Power10Float,
+			&&Label_DegreesToRadiansFloat,
+			&&Label_RandomFloat,
+			&&Label_SignFloat,
+			&&Label_SignNonZeroFloat,
+			&&Label_SinFloat,
+			&&Label_SqrtFloat,
+			&&Label_TanFloat,
+			&&Label_TruncateFloat,
+			&&Label_AreNearlyEqualFloat,
+			&&Label_NegateInteger,
+			&&Label_AddInteger,
+			&&Label_SubtractInteger,
+			&&Label_MultiplyInteger,
+			&&Label_DivideInteger,
+			&&Label_LogicalNotInteger,
+			&&Label_TruthyNotInteger,
+			&&Label_FalseyNotInteger,
+			&&Label_BitwiseNotInteger,
+			&&Label_LessInteger,
+			&&Label_LessInteger4,
+			&&Label_LessEqualInteger,
+			&&Label_LessEqualInteger4,
+			&&Label_GreaterInteger,
+			&&Label_GreaterInteger4,
+			&&Label_GreaterEqualInteger,
+			&&Label_GreaterEqualInteger4,
+			&&Label_NotEqualInteger,
+			&&Label_NotEqualInteger4,
+			&&Label_EqualEqualInteger,
+			&&Label_EqualEqualInteger4,
+			&&Label_LeftShiftInteger,
+			&&Label_RightShiftInteger,
+			&&Label_ModuloInteger,
+			&&Label_AndInteger,
+			&&Label_OrInteger,
+			&&Label_ExclusiveOrInteger,
+			&&Label_AbsInteger,
+			&&Label_MaxInteger,
+			&&Label_MinInteger,
+			&&Label_RandomInteger,
+			&&Label_LengthInteger2,
+			&&Label_LengthInteger3,
+			&&Label_LengthInteger4,
+			&&Label_LengthSquaredInteger2,
+			&&Label_LengthSquaredInteger3,
+			&&Label_LengthSquaredInteger4,
+			&&Label_LessString,
+			&&Label_LessEqualString,
+			&&Label_GreaterString,
+			&&Label_GreaterEqualString,
+			&&Label_NotEqualString,
+			&&Label_EqualEqualString,
+			&&Label_LogicalNotBoolean,
+			&&Label_AnyBoolean2,
+			&&Label_AnyBoolean3,
+			&&Label_AnyBoolean4,
+			&&Label_AllBoolean2,
+			&&Label_AllBoolean3,
+			&&Label_AllBoolean4,
+			&&Label_Dot2,
+			&&Label_Dot3,
+			&&Label_Dot4,
+			&&Label_Cross2,
+			&&Label_Cross3,
+			&&Label_LengthFloat2,
+			&&Label_LengthFloat3,
+			&&Label_LengthFloat4,
+			&&Label_LengthSquaredFloat2,
+			&&Label_LengthSquaredFloat3,
+			&&Label_LengthSquaredFloat4,
+			&&Label_InverseLengthFloat2,
+			&&Label_InverseLengthFloat3,
+			&&Label_InverseLengthFloat4,
+			&&Label_DistanceInteger2,
+			&&Label_DistanceInteger3,
+			&&Label_DistanceFloat2,
+			&&Label_DistanceFloat3,
+			&&Label_Normalize2,
+			&&Label_Normalize3,
+			&&Label_Normalize4,
+			&&Label_Project2,
+			&&Label_Project3,
+			&&Label_Reflect2,
+			&&Label_Reflect3,
+			&&Label_Refract2,
+			&&Label_Refract3,
+			&&Label_RightRotationDirection3,
+			&&Label_ForwardRotationDirection2,
+			&&Label_ForwardRotationDirection3,
+			&&Label_UpRotationDirection2,
+			&&Label_UpRotationDirection3,
+			&&Label_RotateRotation2,
+			&&Label_RotateRotation3,
+			&&Label_InverseRotateRotation2,
+			&&Label_InverseRotateRotation3,
+			&&Label_RotateDirection2,
+			&&Label_RotateDirection3,
+			&&Label_InverseRotateDirection2,
+			&&Label_InverseRotateDirection3,
+			&&Label_InverseRotation2,
+			&&Label_InverseRotation3,
+			&&Label_NegateRotation3,
+			&&Label_RotationEuler3,
+			&&Label_PushGlobal,
+			&&Label_SetGlobal,
+			&&Label_PushLocal,
+			&&Label_SetLocal,
+			&&Label_PushClosure,
+			&&Label_PushUpvalue,
+			&&Label_SetUpvalue,
+			&&Label_CloseUpvalue,
+			&&Label_PushComponentSoftReference,
+			&&Label_PushLocalPushImmediateAddInteger,
+			&&Label_PushLocalPushConstantAddFloat,
+			&&Label_PushLocalPushLocalAddFloat,
+			&&Label_PushLocalPushLocalSubtractFloat,
+			&&Label_PushLocalPushLocalMultiplyFloat,
+			&&Label_MultiplyAddFloat,
+			&&Label_LessIntegerJumpIfFalse,
+			&&Label_LessEqualIntegerJumpIfFalse,
+			&&Label_GreaterIntegerJumpIfFalse,
+			&&Label_GreaterEqualIntegerJumpIfFalse,
+			&&Label_EqualEqualIntegerJumpIfFalse,
+			&&Label_NotEqualIntegerJumpIfFalse,
+			&&Label_LessFloatJumpIfFalse,
+			&&Label_LessEqualFloatJumpIfFalse,
+			&&Label_GreaterFloatJumpIfFalse,
+			&&Label_GreaterEqualFloatJumpIfFalse,
+		};
+		static_assert(sizeof(dispatchTable) / sizeof(dispatchTable[0]) == OpCodeCount);
+
+#define VM_CASE(opCode) \
+	case OpCode::opCode: \
+	Label_##opCode
+#define VM_DISPATCH() goto* dispatchTable[READ_BYTE()]
+#else
+#define VM_CASE(opCode) case OpCode::opCode
+#define VM_DISPATCH() continue
+#endif
+
 #ifdef SCRIPTING_DEBUG_TRACE_EXECUTION
 		Disassembler disassembler;
 #endif
@@ -279,26 +545,26 @@ namespace ngine::Scripting
 #endif
 			switch (OpCode(READ_BYTE()))
 			{
-				case OpCode::Nop:
+				VM_CASE(Nop):
 				{
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Null:
+				VM_CASE(Null):
 				{
 					Push(RawValue{nullptr});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::True:
+				VM_CASE(True):
 				{
 					Push(RawValue{true});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::False:
+				VM_CASE(False):
 				{
 					Push(RawValue{false});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Return:
+				VM_CASE(Return):
 				{
 					const uint8 resultCount = uint8((uintptr(m_state.sp) - uintptr(pFrame->pSlots)) / sizeof(RawValue)) - 1 // function pointer
 					                          - pFrame->pClosure->pFunction->locals;
@@ -338,36 +604,35 @@ namespace ngine::Scripting
 						}
 					}
 
-					pFrame = &m_state.frames[m_state.frameCount - 1];
+					pFrame = &m_state.pStack->frames[m_state.frameCount - 1];
 					ip = pFrame->ip;
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::JumpIfFalse:
+				VM_CASE(JumpIfFalse):
 				{
 					const int16 offset = READ_SIGNED_SHORT();
 					if (!Peek(0).AsBool())
 					{
 						ip += offset;
 					}
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::JumpIfTrue:
+				VM_CASE(JumpIfTrue):
 				{
 					const int16 offset = READ_SIGNED_SHORT();
 					if ((bool)Peek(0).AsBool())
 					{
 						ip += offset;
 					}
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Jump:
+				VM_CASE(Jump):
 				{
 					const int16 offset = READ_SIGNED_SHORT();
 					ip += offset;
-					continue;
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CallNative:
+				VM_CASE(CallNative):
 				{
 					const uint8 argCount = READ_BYTE();
 					const uint8 coarity = READ_BYTE();
@@ -377,12 +642,12 @@ namespace ngine::Scripting
 					const RawValue functionValue = Peek(argCount);
 					const VM::DynamicFunction functionPointer = functionValue.GetNativeFunctionPointer();
 					Call(functionPointer, argCount, coarity);
-					pFrame = &m_state.frames[m_state.frameCount - 1];
+					pFrame = &m_state.pStack->frames[m_state.frameCount - 1];
 					ip = pFrame->ip;
 
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CallClosure:
+				VM_CASE(CallClosure):
 				{
 					const uint8 argCount = READ_BYTE();
 					const uint8 coarity = READ_BYTE();
@@ -392,19 +657,19 @@ namespace ngine::Scripting
 					{
 						return false;
 					}
-					pFrame = &m_state.frames[m_state.frameCount - 1];
+					pFrame = &m_state.pStack->frames[m_state.frameCount - 1];
 					ip = pFrame->ip;
 
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushConstant:
+				VM_CASE(PushConstant):
 				{
 					const RawValue value = pFrame->pClosure->pFunction->chunk.constantValues[READ_BYTE()];
 					Assert(!value.ValidateIsNativeFunctionGuid());
 					Push(value);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushComponentSoftReference:
+				VM_CASE(PushComponentSoftReference):
 				{
 					Assert(s_pEntitySceneRegistry.IsValid());
 					if (UNLIKELY_ERROR(s_pEntitySceneRegistry.IsInvalid()))
@@ -423,1013 +688,1013 @@ namespace ngine::Scripting
 					}
 
 					Push(RawValue{pComponent.Get()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushImmediate:
+				VM_CASE(PushImmediate):
 				{
 					Push(RawValue{IntegerType{READ_BYTE()}});
-					continue;
+					VM_DISPATCH();
 				}
 
 				// Float operations
-				case OpCode::NegateFloat:
+				VM_CASE(NegateFloat):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(-value.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LogicalNotFloat:
+				VM_CASE(LogicalNotFloat):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(!value.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AddFloat:
+				VM_CASE(AddFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() + right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SubtractFloat:
+				VM_CASE(SubtractFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() - right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MultiplyFloat:
+				VM_CASE(MultiplyFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() * right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DivideFloat:
+				VM_CASE(DivideFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() / right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessFloat:
+				VM_CASE(LessFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x < right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessFloat4:
+				VM_CASE(LessFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() < right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessEqualFloat:
+				VM_CASE(LessEqualFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x <= right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessEqualFloat4:
+				VM_CASE(LessEqualFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() <= right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterFloat:
+				VM_CASE(GreaterFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x > right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterFloat4:
+				VM_CASE(GreaterFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() > right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterEqualFloat:
+				VM_CASE(GreaterEqualFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x >= right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterEqualFloat4:
+				VM_CASE(GreaterEqualFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() >= right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NotEqualFloat:
+				VM_CASE(NotEqualFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x != right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NotEqualFloat4:
+				VM_CASE(NotEqualFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() != right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::EqualEqualFloat:
+				VM_CASE(EqualEqualFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().x == right.GetVector4f().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::EqualEqualFloat4:
+				VM_CASE(EqualEqualFloat4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4f() == right.GetVector4f());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ModuloFloat:
+				VM_CASE(ModuloFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Mod(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AbsFloat:
+				VM_CASE(AbsFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Abs(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AcosFloat:
+				VM_CASE(AcosFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Acos(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AsinFloat:
+				VM_CASE(AsinFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Asin(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AtanFloat:
+				VM_CASE(AtanFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Atan(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Atan2Float:
+				VM_CASE(Atan2Float):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Atan2(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CeilFloat:
+				VM_CASE(CeilFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Ceil(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CubicRootFloat:
+				VM_CASE(CubicRootFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::CubicRoot(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CosFloat:
+				VM_CASE(CosFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Cos(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RadiansToDegreesFloat:
+				VM_CASE(RadiansToDegreesFloat):
 				{
 					const RawValue right = Pop();
 					Push(right.GetVector4f() * Math::Vector4f{Math::TConstants<FloatType>::RadToDeg});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ExpFloat:
+				VM_CASE(ExpFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Exponential(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::FloorFloat:
+				VM_CASE(FloorFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Floor(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RoundFloat:
+				VM_CASE(RoundFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Round(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::FractFloat:
+				VM_CASE(FractFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Fract(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseSqrtFloat:
+				VM_CASE(InverseSqrtFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Isqrt(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LogFloat:
+				VM_CASE(LogFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Log(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Log2Float:
+				VM_CASE(Log2Float):
 				{
 					const RawValue right = Pop();
 					Push(Math::Log2(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Log10Float:
+				VM_CASE(Log10Float):
 				{
 					const RawValue right = Pop();
 					Push(Math::Log10(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MaxFloat:
+				VM_CASE(MaxFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Max(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MinFloat:
+				VM_CASE(MinFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Min(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MultiplicativeInverseFloat:
+				VM_CASE(MultiplicativeInverseFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::MultiplicativeInverse(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PowerFloat:
+				VM_CASE(PowerFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Power(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Power2Float:
+				VM_CASE(Power2Float):
 				{
 					const RawValue right = Pop();
 					Push(Math::Power2(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Power10Float:
+				VM_CASE(Power10Float):
 				{
 					const RawValue right = Pop();
 					Push(Math::Power10(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DegreesToRadiansFloat:
+				VM_CASE(DegreesToRadiansFloat):
 				{
 					const RawValue right = Pop();
 					Push(right.GetVector4f() * Math::Vector4f{Math::TConstants<FloatType>::DegToRad});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RandomFloat:
+				VM_CASE(RandomFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Random(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SignFloat:
+				VM_CASE(SignFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Sign(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SignNonZeroFloat:
+				VM_CASE(SignNonZeroFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::SignNonZero(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SinFloat:
+				VM_CASE(SinFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Sin(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SqrtFloat:
+				VM_CASE(SqrtFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Sqrt(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::TanFloat:
+				VM_CASE(TanFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Tan(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::TruncateFloat:
+				VM_CASE(TruncateFloat):
 				{
 					const RawValue right = Pop();
 					Push(Math::Truncate<Math::Vector4i>(right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AreNearlyEqualFloat:
+				VM_CASE(AreNearlyEqualFloat):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::IsEquivalentTo(left.GetVector4f(), right.GetVector4f()));
-					continue;
+					VM_DISPATCH();
 				}
 
 				// Integral operations
-				case OpCode::NegateInteger:
+				VM_CASE(NegateInteger):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(-value.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LogicalNotInteger:
+				VM_CASE(LogicalNotInteger):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(!value.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::TruthyNotInteger:
+				VM_CASE(TruthyNotInteger):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(false);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::FalseyNotInteger:
+				VM_CASE(FalseyNotInteger):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(true);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::BitwiseNotInteger:
+				VM_CASE(BitwiseNotInteger):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(Math::Vector4i::BoolType{~value.GetBool4i()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AddInteger:
+				VM_CASE(AddInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() + right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SubtractInteger:
+				VM_CASE(SubtractInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() - right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MultiplyInteger:
+				VM_CASE(MultiplyInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() * right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DivideInteger:
+				VM_CASE(DivideInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() / right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessInteger:
+				VM_CASE(LessInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x < right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessInteger4:
+				VM_CASE(LessInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() < right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessEqualInteger:
+				VM_CASE(LessEqualInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x <= right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessEqualInteger4:
+				VM_CASE(LessEqualInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() <= right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterInteger:
+				VM_CASE(GreaterInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x > right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterInteger4:
+				VM_CASE(GreaterInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() > right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterEqualInteger:
+				VM_CASE(GreaterEqualInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x >= right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterEqualInteger4:
+				VM_CASE(GreaterEqualInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() >= right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NotEqualInteger:
+				VM_CASE(NotEqualInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x != right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NotEqualInteger4:
+				VM_CASE(NotEqualInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() != right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::EqualEqualInteger:
+				VM_CASE(EqualEqualInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4i().x == right.GetVector4i().x});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::EqualEqualInteger4:
+				VM_CASE(EqualEqualInteger4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() == right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LeftShiftInteger:
+				VM_CASE(LeftShiftInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() << right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RightShiftInteger:
+				VM_CASE(RightShiftInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() >> right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ModuloInteger:
+				VM_CASE(ModuloInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() % right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AndInteger:
+				VM_CASE(AndInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() & right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::OrInteger:
+				VM_CASE(OrInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() | right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ExclusiveOrInteger:
+				VM_CASE(ExclusiveOrInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(left.GetVector4i() ^ right.GetVector4i());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AbsInteger:
+				VM_CASE(AbsInteger):
 				{
 					const RawValue right = Pop();
 					Push(Math::Abs(right.GetVector4i()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MaxInteger:
+				VM_CASE(MaxInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Max(left.GetVector4i(), right.GetVector4i()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::MinInteger:
+				VM_CASE(MinInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Min(left.GetVector4i(), right.GetVector4i()));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RandomInteger:
+				VM_CASE(RandomInteger):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(Math::Random(left.GetVector4i(), right.GetVector4i()));
-					continue;
+					VM_DISPATCH();
 				}
 
-				case OpCode::LengthInteger2:
+				VM_CASE(LengthInteger2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2i().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthInteger3:
+				VM_CASE(LengthInteger3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3i().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthInteger4:
+				VM_CASE(LengthInteger4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4i().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredInteger2:
+				VM_CASE(LengthSquaredInteger2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2i().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredInteger3:
+				VM_CASE(LengthSquaredInteger3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3i().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredInteger4:
+				VM_CASE(LengthSquaredInteger4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4i().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
 
 				// String operations
-				case OpCode::LessString:
+				VM_CASE(LessString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() < ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LessEqualString:
+				VM_CASE(LessEqualString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() <= ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterString:
+				VM_CASE(GreaterString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() > ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::GreaterEqualString:
+				VM_CASE(GreaterEqualString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() >= ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NotEqualString:
+				VM_CASE(NotEqualString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() != ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::EqualEqualString:
+				VM_CASE(EqualEqualString):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{((StringObject*)left.GetObject())->string.GetView() == ((StringObject*)right.GetObject())->string.GetView()});
-					continue;
+					VM_DISPATCH();
 				}
 
 				// Boolean operations
-				case OpCode::LogicalNotBoolean:
+				VM_CASE(LogicalNotBoolean):
 				{
 					RawValue& __restrict value = *(m_state.sp - 1);
 					value = RawValue(!value.GetBool());
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AnyBoolean2:
+				VM_CASE(AnyBoolean2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool2f().AreAnySet()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AnyBoolean3:
+				VM_CASE(AnyBoolean3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool3f().AreAnySet()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AnyBoolean4:
+				VM_CASE(AnyBoolean4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool4f().AreAnySet()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AllBoolean2:
+				VM_CASE(AllBoolean2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool2f().AreAllSet()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AllBoolean3:
+				VM_CASE(AllBoolean3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool3f().AreAllSet()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::AllBoolean4:
+				VM_CASE(AllBoolean4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetBool4f().AreAllSet()});
-					continue;
+					VM_DISPATCH();
 				}
 
 				// Vector operations
-				case OpCode::Dot2:
+				VM_CASE(Dot2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector2f().Dot(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Dot3:
+				VM_CASE(Dot3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector3f().Dot(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Dot4:
+				VM_CASE(Dot4):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector4f().Dot(right.GetVector4f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Cross2:
+				VM_CASE(Cross2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector2f().Cross(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Cross3:
+				VM_CASE(Cross3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector3f().Cross(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DistanceInteger2:
+				VM_CASE(DistanceInteger2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{(left.GetVector2i() - right.GetVector2i()).GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DistanceInteger3:
+				VM_CASE(DistanceInteger3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{(left.GetVector3i() - right.GetVector3i()).GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DistanceFloat2:
+				VM_CASE(DistanceFloat2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{(left.GetVector2f() - right.GetVector2f()).GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::DistanceFloat3:
+				VM_CASE(DistanceFloat3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{(left.GetVector3f() - right.GetVector3f()).GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthFloat2:
+				VM_CASE(LengthFloat2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2f().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthFloat3:
+				VM_CASE(LengthFloat3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3f().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthFloat4:
+				VM_CASE(LengthFloat4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4f().GetLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseLengthFloat2:
+				VM_CASE(InverseLengthFloat2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2f().GetInverseLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseLengthFloat3:
+				VM_CASE(InverseLengthFloat3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3f().GetInverseLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseLengthFloat4:
+				VM_CASE(InverseLengthFloat4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4f().GetInverseLength()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredFloat2:
+				VM_CASE(LengthSquaredFloat2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2f().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredFloat3:
+				VM_CASE(LengthSquaredFloat3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3f().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::LengthSquaredFloat4:
+				VM_CASE(LengthSquaredFloat4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4f().GetLengthSquared()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Normalize2:
+				VM_CASE(Normalize2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector2f().GetNormalizedSafe()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Normalize3:
+				VM_CASE(Normalize3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector3f().GetNormalizedSafe()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Normalize4:
+				VM_CASE(Normalize4):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetVector4f().GetNormalizedSafe()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Project2:
+				VM_CASE(Project2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector2f().Project(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Project3:
+				VM_CASE(Project3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector3f().Project(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Reflect2:
+				VM_CASE(Reflect2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector2f().Reflect(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Reflect3:
+				VM_CASE(Reflect3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetVector3f().Reflect(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Refract2:
+				VM_CASE(Refract2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					const RawValue eta = Pop();
 					Push(RawValue{left.GetVector2f().Refract(right.GetVector2f(), eta.GetDecimal())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::Refract3:
+				VM_CASE(Refract3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					const RawValue eta = Pop();
 					Push(RawValue{left.GetVector3f().Refract(right.GetVector3f(), eta.GetDecimal())});
-					continue;
+					VM_DISPATCH();
 				}
 
 				// Rotation operations
-				case OpCode::RightRotationDirection3:
+				VM_CASE(RightRotationDirection3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation3Df().GetRightColumn()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ForwardRotationDirection2:
+				VM_CASE(ForwardRotationDirection2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation2Df().GetForwardColumn()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::ForwardRotationDirection3:
+				VM_CASE(ForwardRotationDirection3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation3Df().GetForwardColumn()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::UpRotationDirection2:
+				VM_CASE(UpRotationDirection2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation2Df().GetUpColumn()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::UpRotationDirection3:
+				VM_CASE(UpRotationDirection3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation3Df().GetUpColumn()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RotateRotation2:
+				VM_CASE(RotateRotation2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation2Df().TransformRotation(right.GetRotation2Df())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RotateRotation3:
+				VM_CASE(RotateRotation3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation3Df().TransformRotation(right.GetRotation3Df())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotateRotation2:
+				VM_CASE(InverseRotateRotation2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation2Df().InverseTransformRotation(right.GetRotation2Df())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotateRotation3:
+				VM_CASE(InverseRotateRotation3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation3Df().InverseTransformRotation(right.GetRotation3Df())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RotateDirection2:
+				VM_CASE(RotateDirection2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation2Df().TransformDirection(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RotateDirection3:
+				VM_CASE(RotateDirection3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation3Df().TransformDirection(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotateDirection2:
+				VM_CASE(InverseRotateDirection2):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation2Df().InverseTransformDirection(right.GetVector2f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotateDirection3:
+				VM_CASE(InverseRotateDirection3):
 				{
 					const RawValue right = Pop();
 					const RawValue left = Pop();
 					Push(RawValue{left.GetRotation3Df().InverseTransformDirection(right.GetVector3f())});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotation2:
+				VM_CASE(InverseRotation2):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation2Df().GetInverted()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::InverseRotation3:
+				VM_CASE(InverseRotation3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation3Df().GetInverted()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::NegateRotation3:
+				VM_CASE(NegateRotation3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{-right.GetRotation3Df()});
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::RotationEuler3:
+				VM_CASE(RotationEuler3):
 				{
 					const RawValue right = Pop();
 					Push(RawValue{right.GetRotation3Df().GetEulerAngles()});
-					continue;
+					VM_DISPATCH();
 				}
 
-				case OpCode::Pop:
+				VM_CASE(Pop):
 				{
 					--m_state.sp;
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushGlobal:
+				VM_CASE(PushGlobal):
 				{
 					const Guid identifier = READ_GUID();
 					const auto globalIt = m_state.globals.Find(identifier);
 					if (globalIt == m_state.globals.end())
 					{
 						Push(RawValue{nullptr});
-						continue;
+						VM_DISPATCH();
 					}
 					Push(globalIt->second);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SetGlobal:
+				VM_CASE(SetGlobal):
 				{
 					const Guid identifier = READ_GUID();
 					Assert(!Peek(0).ValidateIsNativeFunctionGuid());
 					m_state.globals.EmplaceOrAssign(identifier, Peek(0));
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushLocal:
+				VM_CASE(PushLocal):
 				{
 					const uint8 slot = READ_BYTE();
 					Push(pFrame->pSlots[slot]);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SetLocal:
+				VM_CASE(SetLocal):
 				{
 					const uint8 slot = READ_BYTE();
 					pFrame->pSlots[slot] = Peek(0);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushClosure:
+				VM_CASE(PushClosure):
 				{
 					FunctionObject* const pFunction = READ_FUNCTION();
 					ClosureObject* const pClosure = CreateClosureObject(m_state.gc, pFunction);
@@ -1447,27 +1712,225 @@ namespace ngine::Scripting
 							pUpvalue = pFrame->pClosure->upvalues[index];
 						}
 					}
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::PushUpvalue:
+				VM_CASE(PushUpvalue):
 				{
 					const uint8 slot = READ_BYTE();
 					Push(*pFrame->pClosure->upvalues[slot]->pLocation);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::SetUpvalue:
+				VM_CASE(SetUpvalue):
 				{
 					const uint8 slot = READ_BYTE();
 					*pFrame->pClosure->upvalues[slot]->pLocation = Peek(0);
-					continue;
+					VM_DISPATCH();
 				}
-				case OpCode::CloseUpvalue:
+				VM_CASE(CloseUpvalue):
 				{
 					CloseUpvalues(m_state.sp - 1);
-					continue;
+					VM_DISPATCH();
+				}
+
+				// Superinstructions, skip the opcodes of the fused instructions while reading their operands in place
+				VM_CASE(PushLocalPushImmediateAddInteger):
+				{
+					const RawValue left = pFrame->pSlots[READ_BYTE()];
+					ip++; // PushImmediate
+					const RawValue right{IntegerType{READ_BYTE()}};
+					ip++; // AddInteger
+					Push(left.GetVector4i() + right.GetVector4i());
+					VM_DISPATCH();
+				}
+				VM_CASE(PushLocalPushConstantAddFloat):
+				{
+					const RawValue left = pFrame->pSlots[READ_BYTE()];
+					ip++; // PushConstant
+					const RawValue right = pFrame->pClosure->pFunction->chunk.constantValues[READ_BYTE()];
+					ip++; // AddFloat
+					Push(left.GetVector4f() + right.GetVector4f());
+					VM_DISPATCH();
+				}
+				VM_CASE(PushLocalPushLocalAddFloat):
+				{
+					const RawValue left = pFrame->pSlots[READ_BYTE()];
+					ip++; // PushLocal
+					const RawValue right = pFrame->pSlots[READ_BYTE()];
+					ip++; // AddFloat
+					Push(left.GetVector4f() + right.GetVector4f());
+					VM_DISPATCH();
+				}
+				VM_CASE(PushLocalPushLocalSubtractFloat):
+				{
+					const RawValue left = pFrame->pSlots[READ_BYTE()];
+					ip++; // PushLocal
+					const RawValue right = pFrame->pSlots[READ_BYTE()];
+					ip++; // SubtractFloat
+					Push(left.GetVector4f() - right.GetVector4f());
+					VM_DISPATCH();
+				}
+				VM_CASE(PushLocalPushLocalMultiplyFloat):
+				{
+					const RawValue left = pFrame->pSlots[READ_BYTE()];
+					ip++; // PushLocal
+					const RawValue right = pFrame->pSlots[READ_BYTE()];
+					ip++; // MultiplyFloat
+					Push(left.GetVector4f() * right.GetVector4f());
+					VM_DISPATCH();
+				}
+				VM_CASE(MultiplyAddFloat):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const RawValue addend = Pop();
+					ip++; // AddFloat
+					Push(addend.GetVector4f() + left.GetVector4f() * right.GetVector4f());
+					VM_DISPATCH();
+				}
+				VM_CASE(LessIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x < right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(LessEqualIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x <= right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(GreaterIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x > right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(GreaterEqualIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x >= right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(EqualEqualIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x == right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(NotEqualIntegerJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4i().x != right.GetVector4i().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(LessFloatJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4f().x < right.GetVector4f().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(LessEqualFloatJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4f().x <= right.GetVector4f().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(GreaterFloatJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4f().x > right.GetVector4f().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
+				}
+				VM_CASE(GreaterEqualFloatJumpIfFalse):
+				{
+					const RawValue right = Pop();
+					const RawValue left = Pop();
+					const bool result = left.GetVector4f().x >= right.GetVector4f().x;
+					Push(RawValue{result});
+					ip++; // JumpIfFalse
+					const int16 offset = READ_SIGNED_SHORT();
+					if (!result)
+					{
+						ip += offset;
+					}
+					VM_DISPATCH();
 				}
 			}
 		}
+#undef VM_CASE
+#undef VM_DISPATCH
 #undef READ_BYTE
 #undef READ_SHORT
 #undef READ_SIGNED_SHORT
@@ -1476,7 +1939,7 @@ namespace ngine::Scripting
 
 	bool VirtualMachine::Call(ClosureObject& closure, uint8 argCount, uint8 coarity)
 	{
-		if (UNLIKELY_ERROR(m_state.frameCount >= MaxCallStackSize))
+		if (UNLIKELY_ERROR(m_state.frameCount >= MaxCallStackSize || !ReserveFrameStack()))
 		{
 			return Error("Stack overflow");
 		}
@@ -1489,7 +1952,7 @@ namespace ngine::Scripting
 		}
 		Pop(argCount - pFunction->arity);
 
-		CallFrame& frame = m_state.frames[m_state.frameCount++];
+		CallFrame& frame = m_state.pStack->frames[m_state.frameCount++];
 		frame.ip = pFunction->chunk.code.GetData();
 		frame.pSlots = m_state.sp - pFunction->arity - 1;
 		frame.pClosure = &closure;
@@ -1588,7 +2051,7 @@ namespace ngine::Scripting
 		int32 frameIndex = m_state.frameCount;
 		while (frameIndex--)
 		{
-			CallFrame& frame = m_state.frames[frameIndex];
+			CallFrame& frame = m_state.pStack->frames[frameIndex];
 			const FunctionObject* const pFunction = frame.pClosure->pFunction;
 
 			const uint32 offset = uint32(frame.ip - pFunction->chunk.code.GetData());
@@ -1614,11 +2077,45 @@ namespace ngine::Scripting
 
 	void VirtualMachine::ResetStack()
 	{
-		m_state.sp = m_state.stack.GetData();
+		m_state.sp = m_state.pStack.IsValid() ? m_state.pStack->values.GetData() : nullptr;
 		m_state.frameCount = 0;
 		m_state.pOpenUpvalues = nullptr;
 	}
 
+	bool VirtualMachine::ReserveFrameStack()
+	{
+		Vector<RawValue, uint32>& values = m_state.pStack->values;
+		RawValue* const pPreviousValues = values.GetData();
+		const uint32 requiredSize = uint32(m_state.sp - pPreviousValues) + MaxFrameStackSize;
+		if (LIKELY(requiredSize <= values.GetSize()))
+		{
+			return true;
+		}
+		else if (requiredSize > MaxStackSize)
+		{
+			return false;
+		}
+
+		values.Resize(Math::Min(Math::Max(values.GetSize() * StackGrowFactor, requiredSize), MaxStackSize));
+
+		// Rebase everything pointing into the previous allocation
+		RawValue* const pValues = values.GetData();
+		const auto rebase = [pPreviousValues, pValues](RawValue*& pValue)
+		{
+			pValue = pValues + (uintptr(pValue) - uintptr(pPreviousValues)) / sizeof(RawValue);
+		};
+		rebase(m_state.sp);
+		for (uint32 frameIndex = 0; frameIndex < m_state.frameCount; ++frameIndex)
+		{
+			rebase(m_state.pStack->frames[frameIndex].pSlots);
+		}
+		for (UpvalueObject* pUpvalue = m_state.pOpenUpvalues; pUpvalue != nullptr; pUpvalue = pUpvalue->pNextUpvalue)
+		{
+			rebase(pUpvalue->pLocation);
+		}
+		return true;
+	}
+
 	void* VirtualMachine::Reallocate(GC& gc, void* pPointer, size oldSize, size newSize, size alignment)
 	{
 		if (VirtualMachine* pVm = (VirtualMachine*)gc.customData)
@@ -1677,9 +2174,12 @@ namespace ngine::Scripting
 	{
 		// Mark roots
 		// Assert(false, "TODO");
-		for (RawValue* pSlot = m_state.stack.GetData(); pSlot < m_state.sp; ++pSlot)
+		if (m_state.pStack.IsValid())
 		{
-			MarkValue(pSlot->GetObject(), m_state.grayStack);
+			for (RawValue* pSlot = m_state.pStack->values.GetData(); pSlot < m_state.sp; ++pSlot)
+			{
+				MarkValue(pSlot->GetObject(), m_state.grayStack);
+			}
 		}
 
 		// Mark globals
@@ -1691,7 +2191,7 @@ namespace ngine::Scripting
 		// Mark closures
 		for (uint32 i = 0; i < m_state.frameCount; ++i)
 		{
-			MarkObject((Object*)m_state.frames[i].pClosure, m_state.grayStack);
+			MarkObject((Object*)m_state.pStack->frames[i].pClosure, m_state.grayStack);
 		}
 
 		// Mark upvalues
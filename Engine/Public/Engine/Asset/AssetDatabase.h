@@ -2,6 +2,7 @@
 
 #include <Engine/Asset/Identifier.h>
 #include <Engine/Asset/Mask.h>
+#include <Engine/Asset/BinaryAssetDatabase.h>
 #include <Engine/DataSource/DataSourceInterface.h>
 #include <Engine/Tag/TagContainer.h>
 
@@ -51,7 +52,16 @@ namespace ngine::Asset
 			const Identifier rootFolderAssetIdentifier,
 			const ArrayView<const Tag::Identifier, uint8> tagIdentifiers = {}
 		);
+		//! Registers all assets of a compiled database in batches, and keeps the database mapped
+		//! Entries are only created from the mapped table when an asset is first accessed
+		[[nodiscard]] bool Load(
+			UniquePtr<BinaryDatabase>&& pDatabase,
+			const IO::PathView databaseRootDirectory,
+			const Identifier rootFolderAssetIdentifier,
+			const ArrayView<const Tag::Identifier, uint8> tagIdentifiers = {}
+		);
 
+		//! Note that assets registered from a compiled database only have entries once resolved, see ResolveAllAssetEntries
 		[[nodiscard]] Database& GetDatabase()
 		{
 			return *this;
@@ -79,6 +89,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] Guid GetAssetTypeGuid(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -92,6 +103,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] Guid GetAssetComponentTypeGuid(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -105,6 +117,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] IO::Path GetAssetPath(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -123,6 +136,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] IO::Path GetAssetBinaryPath(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -136,6 +150,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] IO::Path::StringType GetAssetName(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -149,6 +164,7 @@ namespace ngine::Asset
 
 		[[nodiscard]] IO::Path::StringType GetAssetNameFromPath(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -163,6 +179,7 @@ namespace ngine::Asset
 		template<typename Callback>
 		auto VisitAssetEntry(const Guid assetGuid, Callback&& callback) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<const DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -177,6 +194,7 @@ namespace ngine::Asset
 		template<typename Callback>
 		auto VisitAssetEntry(const Guid assetGuid, Callback&& callback)
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			if (const Optional<DatabaseEntry*> pEntry = Database::GetAssetEntry(assetGuid))
 			{
@@ -188,8 +206,22 @@ namespace ngine::Asset
 			}
 		}
 
+		//! Creates the entry of an asset registered from a compiled database, if it wasn't accessed yet
+		void ResolveAssetEntry(const Guid assetGuid) const
+		{
+			if (m_unresolvedAssetCount.Load() > 0)
+			{
+				ResolveCompiledAssetEntry(assetGuid);
+			}
+		}
+		//! Creates the entries of an asset and of all assets it references, recursively
+		void ResolveAssetEntryAndReferences(const Guid assetGuid) const;
+		//! Creates the entries of all assets registered from compiled databases that weren't accessed yet
+		void ResolveAllAssetEntries() const;
+
 		[[nodiscard]] bool HasAsset(const Guid assetGuid) const
 		{
+			ResolveAssetEntry(assetGuid);
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			return Database::HasAsset(assetGuid);
 		}
@@ -208,6 +240,7 @@ namespace ngine::Asset
 		template<typename Callback>
 		void IterateAssetsOfAssetType(Callback&& callback, const ArrayView<const TypeGuid> typeGuids)
 		{
+			ResolveAllAssetEntries();
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			Database::IterateAssetsOfAssetType<Callback>(Forward<Callback>(callback), typeGuids);
 		}
@@ -215,6 +248,7 @@ namespace ngine::Asset
 		template<typename Callback>
 		void IterateAssetsOfAssetType(Callback&& callback, const TypeGuid typeGuid)
 		{
+			ResolveAllAssetEntries();
 			Threading::SharedLock lock(m_assetDatabaseMutex);
 			Database::IterateAssetsOfAssetType<Callback>(Forward<Callback>(callback), typeGuid);
 		}
@@ -294,19 +328,27 @@ namespace ngine::Asset
 		using Database::HasAsset;
 		[[nodiscard]] bool HasAsset(const IO::PathView path) const
 		{
-			Threading::SharedLock lock(m_identifierLookupMapMutex);
-			return m_identifierLookupMap.Contains(path);
+			{
+				Threading::SharedLock lock(m_identifierLookupMapMutex);
+				if (m_identifierLookupMap.Contains(path))
+				{
+					return true;
+				}
+			}
+			return FindCompiledAssetIdentifier(path).IsValid();
 		}
 
 		[[nodiscard]] Identifier GetAssetIdentifier(const IO::PathView path) const
 		{
-			Threading::SharedLock lock(m_identifierLookupMapMutex);
-			decltype(m_identifierLookupMap)::const_iterator it = m_identifierLookupMap.Find(path);
-			if (it == m_identifierLookupMap.end())
 			{
-				return Identifier();
+				Threading::SharedLock lock(m_identifierLookupMapMutex);
+				decltype(m_identifierLookupMap)::const_iterator it = m_identifierLookupMap.Find(path);
+				if (it != m_identifierLookupMap.end())
+				{
+					return it->second;
+				}
 			}
-			return it->second;
+			return FindCompiledAssetIdentifier(path);
 		}
 		[[nodiscard]] Guid GetAssetGuid(const IO::PathView path) const
 		{
@@ -362,6 +404,11 @@ namespace ngine::Asset
 			const Identifier rootFolderAssetIdentifier,
 			const ArrayView<const Tag::Identifier, uint8> tagIdentifiers = {}
 		);
+
+		//! Returns whether the asset was registered from a compiled database and its entry has yet to be created
+		[[nodiscard]] bool IsAssetEntryUnresolved(const Identifier assetIdentifier) const;
+		void ResolveCompiledAssetEntry(const Guid assetGuid) const;
+		[[nodiscard]] Identifier FindCompiledAssetIdentifier(const IO::PathView path) const;
 	protected:
 		mutable Threading::SharedMutex m_assetDatabaseMutex;
 		Threading::Atomic<GenericDataIndex> m_assetCount = 0;
@@ -383,6 +430,18 @@ namespace ngine::Asset
 		//! Array containing the parent index of each asset, relating to the folder / path hierarchy
 		TIdentifierArray<Identifier::IndexType, Identifier> m_assetParentIndices{Memory::Zeroed};
 
+		struct CompiledDatabase
+		{
+			UniquePtr<BinaryDatabase> m_pDatabase;
+			IO::Path m_rootDirectory;
+		};
+		//! Compiled databases that assets were registered from, kept mapped to create entries on demand
+		mutable Threading::SharedMutex m_compiledDatabasesMutex;
+		Vector<CompiledDatabase> m_compiledDatabases;
+		//! Assets registered from a compiled database whose entry hasn't been created yet, guarded by m_assetDatabaseMutex
+		Mask m_unresolvedAssets;
+		mutable Threading::Atomic<uint32> m_unresolvedAssetCount{0};
+
 		UnorderedMap<DataSource::PropertyIdentifier, ExtensionCallback, DataSource::PropertyIdentifier::Hash> m_propertyExtensions;
 		UnorderedMap<DataSource::PropertyIdentifier, SortingCallback, DataSource::PropertyIdentifier::Hash> m_propertySortingExtensions;
 	};
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <Common/Asset/Guid.h>
+#include <Common/IO/Path.h>
+#include <Common/IO/PathView.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/StringView.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Math/NumericLimits.h>
+
+namespace ngine::Asset
+{
+	struct Database;
+	struct DatabaseEntry;
+
+	//! Compiled, read-only representation of an asset database
+	//! Entries are sorted by guid and only reference offsets into the file, allowing the file to be mapped and queried in place
+	struct BinaryDatabase
+	{
+		inline static constexpr IO::PathView FileExtension = MAKE_PATH(".nassetdbbin");
+		static constexpr uint64 Magic = 0x0000424454455341; // ASETDB\0\0
+		static constexpr uint32 Version = 3;
+
+		using PathCharType = IO::PathView::ConstStringViewType::CharType;
+		using NameCharType = ConstUnicodeStringView::CharType;
+
+		//! Range of characters in the string data section
+		struct StringRange
+		{
+			uint32 m_offset;
+			uint32 m_count;
+		};
+
+		//! Range of guids in the guid section
+		struct GuidRange
+		{
+			uint32 m_index;
+			uint32 m_count;
+		};
+
+		inline static constexpr uint32 InvalidGuidIndex = Math::NumericLimits<uint32>::Max;
+
+		struct Header
+		{
+			uint64 m_magic;
+			uint32 m_version;
+			uint8 m_pathCharacterSize;
+			uint8 m_nameCharacterSize;
+			uint16 m_padding;
+			uint32 m_entryCount;
+			uint32 m_guidCount;
+			uint32 m_stringDataSize;
+			uint32 m_entriesOffset;
+			uint32 m_guidsOffset;
+			uint32 m_stringDataOffset;
+			//! Offset of the path lookup table, holding one element per entry
+			uint32 m_pathsOffset;
+		};
+
+		struct Entry
+		{
+			Guid m_guid;
+			//! Parent directory relative to the database root, interned across all entries
+			StringRange m_directory;
+			StringRange m_fileName;
+			StringRange m_name;
+			StringRange m_description;
+			//! Serialized asset meta data, empty if the asset has none
+			StringRange m_metaData;
+			//! Indices into the interned guid section, or InvalidGuidIndex
+			uint32 m_assetTypeGuidIndex;
+			uint32 m_componentTypeGuidIndex;
+			uint32 m_thumbnailGuidIndex;
+			GuidRange m_tags;
+			GuidRange m_dependencies;
+			GuidRange m_containerContents;
+		};
+
+		//! Element of the path lookup table, sorted by hash
+		struct PathEntry
+		{
+			uint64 m_hash;
+			uint32 m_entryIndex;
+			uint32 m_padding;
+		};
+
+		BinaryDatabase() = default;
+		//! Maps the file at the specified path, check IsValid for success
+		explicit BinaryDatabase(const IO::PathView filePath);
+		//! Creates a view into data owned by the caller
+		explicit BinaryDatabase(const ConstByteView data);
+		BinaryDatabase(const BinaryDatabase&) = delete;
+		BinaryDatabase& operator=(const BinaryDatabase&) = delete;
+		BinaryDatabase(BinaryDatabase&&) = delete;
+		BinaryDatabase& operator=(BinaryDatabase&&) = delete;
+		~BinaryDatabase();
+
+		//! Gets the path of the binary database emitted for the database with the specified guid
+		[[nodiscard]] static IO::Path GetFilePath(const IO::PathView databaseRootDirectory, const Guid databaseGuid);
+
+		//! Serializes the database with all paths stored relative to the root directory
+		[[nodiscard]] static bool Serialize(const Database& database, const IO::PathView databaseRootDirectory, Vector<ByteType>& output);
+		[[nodiscard]] static bool Save(const Database& database, const IO::PathView databaseRootDirectory, const IO::PathView filePath);
+
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_pHeader.IsValid();
+		}
+
+		[[nodiscard]] uint32 GetEntryCount() const
+		{
+			return m_entries.GetSize();
+		}
+		[[nodiscard]] ArrayView<const Entry, uint32> GetEntries() const
+		{
+			return m_entries;
+		}
+		//! Binary searches the sorted entry table for the asset
+		[[nodiscard]] Optional<const Entry*> FindEntry(const Guid assetGuid) const;
+		//! Binary searches the path lookup table for the asset at the path relative to the database root
+		[[nodiscard]] Optional<const Entry*> FindEntryByPath(const IO::PathView relativePath) const;
+		[[nodiscard]] bool HasAsset(const Guid assetGuid) const
+		{
+			return FindEntry(assetGuid).IsValid();
+		}
+
+		[[nodiscard]] IO::PathView GetRelativeDirectory(const Entry& entry) const
+		{
+			return GetPathString(entry.m_directory);
+		}
+		[[nodiscard]] IO::PathView GetFileName(const Entry& entry) const
+		{
+			return GetPathString(entry.m_fileName);
+		}
+		[[nodiscard]] IO::Path GetPath(const Entry& entry, const IO::PathView databaseRootDirectory) const;
+		[[nodiscard]] ConstUnicodeStringView GetName(const Entry& entry) const;
+		[[nodiscard]] ConstUnicodeStringView GetDescription(const Entry& entry) const;
+		[[nodiscard]] ConstStringView GetMetaData(const Entry& entry) const;
+		[[nodiscard]] Guid GetGuid(const uint32 index) const
+		{
+			return index != InvalidGuidIndex ? m_guids[index] : Guid{};
+		}
+		[[nodiscard]] ArrayView<const Guid, uint32> GetGuids(const GuidRange range) const
+		{
+			return m_guids.GetSubView(range.m_index, range.m_count);
+		}
+
+		//! Creates the in-memory entry used by the asset database
+		[[nodiscard]] DatabaseEntry CreateDatabaseEntry(const Entry& entry, const IO::PathView databaseRootDirectory) const;
+
+		//! Strict weak ordering used for the entry table
+		[[nodiscard]] static bool IsLess(const Guid& left, const Guid& right);
+		//! Hash used for the path lookup table, stable across platforms and runs
+		[[nodiscard]] static uint64 HashPath(const IO::PathView relativeDirectory, const IO::PathView fileName);
+	protected:
+		//! Validates the header and every entry against the data, as the file is used in place
+		[[nodiscard]] bool Initialize(const ConstByteView data);
+		[[nodiscard]] IO::PathView GetPathString(const StringRange range) const;
+	protected:
+		Optional<const Header*> m_pHeader;
+		ArrayView<const Entry, uint32> m_entries;
+		ArrayView<const Guid, uint32> m_guids;
+		ArrayView<const PathEntry, uint32> m_paths;
+		ConstByteView m_stringData;
+
+		//! Platform mapping of the file, or an owned copy where mapping is not supported
+		void* m_pMappedData = nullptr;
+		size m_mappedSize = 0;
+#if PLATFORM_WINDOWS
+		void* m_pFileMappingHandle = nullptr;
+#endif
+		Vector<ByteType> m_fileData;
+	};
+}
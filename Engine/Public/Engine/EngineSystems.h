@@ -12,6 +12,7 @@
 #include "Asset/AssetManager.h"
 #include "Threading/JobManager.h"
 #include "Project/Project.h"
+#include "Resource/ResourceManager.h"
 
 #include <Common/Application/Application.h>
 #include <Common/Project System/EngineInfo.h>
@@ -51,6 +52,7 @@ namespace ngine
 		DataSource::Cache m_dataSourceCache;
 		Tag::Registry m_tagRegistry;
 		Asset::EngineManager m_assetManager;
+		Resource::Manager m_resourceManager;
 		Project m_currentProject;
 		Reflection::EngineRegistry m_reflectionRegistry;
 		Scripting::ScriptCache m_scriptCache;
@@ -506,6 +506,20 @@ namespace ngine::Entity
 			ComponentTypeSceneData<Data::Flags>& flagsSceneData,
 			const EnumFlags<TransformChangeFlags> flags = {}
 		);
+		//! Recomputes the world transforms of all descendants from their relative transforms, parents before children
+		void PropagateWorldTransformToChildren(
+			const Math::WorldTransform worldTransform,
+			ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+			ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData,
+			ComponentTypeSceneData<Data::Flags>& flagsSceneData,
+			const EnumFlags<TransformChangeFlags> flags
+		);
+		//! Queues the octree reinsertion and raises the transform change callbacks of this component
+		void NotifyWorldTransformChanged(
+			ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+			ComponentTypeSceneData<Data::Flags>& flagsSceneData,
+			const EnumFlags<TransformChangeFlags> flags
+		);
 	private:
 		friend struct Reflection::ReflectedType<Entity::Component3D>;
 		friend RenderItemComponent;
@@ -5,6 +5,8 @@
 #include <Common/Memory/GetNumericSize.h>
 #include <Common/Memory/Containers/FlatVector.h>
 #include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/UniquePtr.h>
 #include <Common/Memory/Prefetch.h>
 #include <Common/Memory/CheckedCast.h>
 #include <Common/TypeTraits/EnableIf.h>
@@ -19,6 +21,8 @@
 #include <Common/Threading/Mutexes/SharedMutex.h>
 #include <Common/Platform/NoUniqueAddress.h>
 #include <Common/Threading/Jobs/Job.h>
+#include <Common/Threading/Jobs/JobManager.h>
+#include <Common/Math/Min.h>
 
 #include <Engine/Entity/Manager.h>
 #include <Engine/Entity/Scene/SceneRegistry.h>
@@ -83,6 +87,17 @@ namespace ngine::Entity
 
 	namespace Internal
 	{
+		template<typename Type, typename = void>
+		struct IsParallelUpdateEnabled
+		{
+			inline static constexpr bool Value = false;
+		};
+		template<typename Type>
+		struct IsParallelUpdateEnabled<Type, EnableIf<Type::EnableParallelUpdate>>
+		{
+			inline static constexpr bool Value = true;
+		};
+
 		struct DataComponentSparseIdentifierStorage
 		{
 			void OnInstanceCreated(const Entity::ComponentIdentifier identifier)
@@ -190,6 +205,11 @@ namespace ngine::Entity
 		HasTypeMemberFunction(Type, GetInstanceGuid, Guid);
 		HasTypeMemberFunction(Type, CanClone, bool);
 
+		//! Component types can opt in to having their update stages split into chunks that run concurrently across job runners
+		//! by declaring `inline static constexpr bool EnableParallelUpdate = true;`.
+		//! Such types must not access other components of the same type from their update functions.
+		inline static constexpr bool EnableParallelUpdate = Internal::IsParallelUpdateEnabled<Type>::Value;
+
 		inline static constexpr bool IsAbstract = TypeTraits::IsAbstract<Type> || Reflection::GetType<Type>().IsAbstract();
 		inline static constexpr bool ShouldEnableUpdate = HasUpdate && !IsAbstract;
 		inline static constexpr bool ShouldEnableBeforePhysicsUpdate = HasBeforePhysicsUpdate && !IsAbstract;
@@ -1002,6 +1022,40 @@ namespace ngine::Entity
 				}
 			}
 		}
+
+		virtual bool ReserveAdditionalInstances(const uint32 count) override final
+		{
+			if constexpr (HasGetInstanceGuid)
+			{
+				Threading::UniqueLock lock(m_instanceIdentifierLookup.m_mutex);
+				m_instanceIdentifierLookup.m_map.Reserve(m_instanceIdentifierLookup.m_map.GetSize() + count);
+			}
+
+			// Dense storage is fixed and only committed on first touch
+			// Claim the slots the new instances will use to check that they fit, and commit them here instead of page faulting from every creating job
+			Vector<DenseIdentifier> reservedIdentifiers(Memory::Reserve, count);
+			const typename FixedDenseStorageType::View denseStorage = m_denseComponentStorage.GetView();
+			bool hasCapacity = true;
+			for (uint32 index = 0; index < count; ++index)
+			{
+				const DenseIdentifier denseIdentifier = m_denseIdentifierStorage.AcquireIdentifier();
+				if (UNLIKELY(!denseIdentifier.IsValid()))
+				{
+					hasCapacity = false;
+					break;
+				}
+
+				// The slot is unconstructed and owned by us until returned below
+				*reinterpret_cast<volatile ByteType*>(&denseStorage[denseIdentifier.GetFirstValidIndex()]) = 0;
+				reservedIdentifiers.EmplaceBack(denseIdentifier);
+			}
+
+			for (const DenseIdentifier denseIdentifier : reservedIdentifiers)
+			{
+				m_denseIdentifierStorage.ReturnIdentifier(denseIdentifier);
+			}
+			return hasCapacity;
+		}
 	protected:
 		template<typename _Type = Type, typename... Args>
 		inline EnableIf<!TypeTraits::IsBaseOf<Data::Component, _Type> && !Reflection::GetType<_Type>().IsAbstract(), Optional<Type*>>
@@ -1287,7 +1341,121 @@ namespace ngine::Entity
 				m_updatedComponents.Clear();
 			}
 		protected:
+			using IndexType = typename DenseIdentifier::IndexType;
+
+			//! Invokes the stage's update on every registered component in the [startIndex, endIndex) dense range
+			virtual void UpdateComponents(const IndexType startIndex, const IndexType endIndex) = 0;
+			[[nodiscard]] virtual ComponentTypeSceneData& GetOwningTypeSceneData() = 0;
+
+			virtual Threading::Job::Result OnExecute([[maybe_unused]] Threading::JobRunnerThread& thread) override final
+			{
+				const IndexType maximumUsedDenseIndex = GetOwningTypeSceneData().m_denseIdentifierStorage.GetMaximumUsedElementCount();
+				if constexpr (EnableParallelUpdate)
+				{
+					const IndexType chunkCount = (IndexType)((maximumUsedDenseIndex + ChunkSize - 1) / ChunkSize);
+					const IndexType workerCount = Math::Min(chunkCount, (IndexType)thread.GetJobManager().GetJobThreads().GetSize());
+					if (workerCount > 1)
+					{
+						m_parallelUpdateState.m_maximumUsedDenseIndex = maximumUsedDenseIndex;
+						m_parallelUpdateState.m_chunkCount = chunkCount;
+						m_parallelUpdateState.m_workerCount = workerCount;
+						m_parallelUpdateState.m_remainingWorkerCount = workerCount;
+						return Threading::Job::Result::AwaitExternalFinish;
+					}
+				}
+
+				UpdateComponents(0, maximumUsedDenseIndex);
+				return Threading::Job::Result::Finished;
+			}
+
+			virtual void OnAwaitExternalFinish([[maybe_unused]] Threading::JobRunnerThread& thread) override final
+			{
+				if constexpr (EnableParallelUpdate)
+				{
+					Vector<UniquePtr<UpdateChunksJob>>& workerJobs = m_parallelUpdateState.m_workerJobs;
+					const IndexType workerCount = m_parallelUpdateState.m_workerCount;
+					while (workerJobs.GetSize() < workerCount)
+					{
+						workerJobs.EmplaceBack(UniquePtr<UpdateChunksJob>::Make(*this, (IndexType)workerJobs.GetSize()));
+					}
+
+					for (IndexType workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+					{
+						workerJobs[workerIndex]->Queue(thread);
+					}
+				}
+				else
+				{
+					ExpectUnreachable();
+				}
+			}
+
+			//! Processes every workerCount'th chunk starting at the worker's index, prefetching the next chunk's dense storage ahead of its update
+			void UpdateChunks(const IndexType workerIndex, Threading::JobRunnerThread& thread)
+			{
+				const typename FixedDenseStorageType::View denseStorage = GetOwningTypeSceneData().m_denseComponentStorage.GetView();
+				const IndexType maximumUsedDenseIndex = m_parallelUpdateState.m_maximumUsedDenseIndex;
+				const IndexType chunkCount = m_parallelUpdateState.m_chunkCount;
+				const IndexType workerCount = m_parallelUpdateState.m_workerCount;
+
+				for (IndexType chunkIndex = workerIndex; chunkIndex < chunkCount; chunkIndex += workerCount)
+				{
+					const IndexType nextChunkIndex = chunkIndex + workerCount;
+					if (nextChunkIndex < chunkCount)
+					{
+						const IndexType nextChunkStartIndex = nextChunkIndex * ChunkSize;
+						const IndexType nextChunkEndIndex = Math::Min(IndexType(nextChunkStartIndex + PrefetchedComponentCount), maximumUsedDenseIndex);
+						for (const IndexType denseComponentIndex : m_updatedComponents.GetSetBitsIterator(nextChunkStartIndex, nextChunkEndIndex))
+						{
+							Memory::PrefetchLine(&denseStorage[denseComponentIndex]);
+						}
+					}
+
+					const IndexType chunkStartIndex = chunkIndex * ChunkSize;
+					UpdateComponents(chunkStartIndex, Math::Min(IndexType(chunkStartIndex + ChunkSize), maximumUsedDenseIndex));
+				}
+
+				if (m_parallelUpdateState.m_remainingWorkerCount.FetchSubtract(1) == 1)
+				{
+					SignalExecutionFinished(thread);
+				}
+			}
+		protected:
+			struct UpdateChunksJob final : public Threading::Job
+			{
+				UpdateChunksJob(ComponentStage& stage, const IndexType workerIndex)
+					: Threading::Job(Threading::JobPriority::ComponentUpdates)
+					, m_stage(stage)
+					, m_workerIndex(workerIndex)
+				{
+				}
+
+				virtual Result OnExecute(Threading::JobRunnerThread& thread) override final
+				{
+					m_stage.UpdateChunks(m_workerIndex, thread);
+					return Result::Finished;
+				}
+			protected:
+				ComponentStage& m_stage;
+				const IndexType m_workerIndex;
+			};
+
+			struct ParallelUpdateState
+			{
+				IndexType m_maximumUsedDenseIndex{0};
+				IndexType m_chunkCount{0};
+				IndexType m_workerCount{0};
+				Threading::Atomic<IndexType> m_remainingWorkerCount{0};
+				Vector<UniquePtr<UpdateChunksJob>> m_workerJobs;
+			};
+
+			//! Number of components per chunk, chosen so that each chunk covers whole cache lines of the update mask and no two workers write to the same line
+			inline static constexpr IndexType ChunkSize = 64 * 8;
+			//! Number of leading components of the next chunk whose storage is prefetched before the current chunk is updated
+			inline static constexpr IndexType PrefetchedComponentCount = 8;
+
 			Threading::AtomicIdentifierMask<DenseIdentifier> m_updatedComponents;
+			NO_UNIQUE_ADDRESS TypeTraits::Select<EnableParallelUpdate, ParallelUpdateState, Dummy> m_parallelUpdateState;
 		};
 
 		struct MainUpdateComponents final : public ComponentStage
@@ -1338,23 +1506,17 @@ namespace ngine::Entity
 				}
 			}
 
-			virtual Threading::Job::Result OnExecute(Threading::JobRunnerThread&) override final
+			virtual void UpdateComponents(const IndexType startIndex, const IndexType endIndex) override final
 			{
 				if constexpr (ShouldEnableUpdate)
 				{
-					ComponentTypeSceneData& typeSceneData = GetTypeSceneData();
-					// TODO: Prefetching logic
-					const typename FixedDenseStorageType::View denseStorage = typeSceneData.m_denseComponentStorage.GetView();
-					const typename DenseIdentifier::IndexType maximumUsedDenseIndex =
-						typeSceneData.m_denseIdentifierStorage.GetMaximumUsedElementCount();
-					for (const typename DenseIdentifier::IndexType denseComponentIndex :
-					     ComponentStage::m_updatedComponents.GetSetBitsIterator(0, maximumUsedDenseIndex))
+					const typename FixedDenseStorageType::View denseStorage = GetTypeSceneData().m_denseComponentStorage.GetView();
+					for (const IndexType denseComponentIndex : ComponentStage::m_updatedComponents.GetSetBitsIterator(startIndex, endIndex))
 					{
 						StoredType& component = denseStorage[denseComponentIndex];
 						component.Update();
 					}
 				}
-				return Threading::Job::Result::Finished;
 			}
 
 			PURE_LOCALS_AND_POINTERS ComponentTypeSceneData& GetTypeSceneData()
@@ -1365,6 +1527,11 @@ namespace ngine::Entity
 			{
 				return Memory::GetConstOwnerFromMember(*this, &ComponentTypeSceneData::m_mainUpdateComponents);
 			}
+
+			virtual ComponentTypeSceneData& GetOwningTypeSceneData() override final
+			{
+				return GetTypeSceneData();
+			}
 		};
 		struct BeforePhysicsUpdateComponents final : public ComponentStage
 		{
@@ -1420,23 +1587,17 @@ namespace ngine::Entity
 				}
 			}
 
-			virtual Threading::Job::Result OnExecute(Threading::JobRunnerThread&) override final
+			virtual void UpdateComponents(const IndexType startIndex, const IndexType endIndex) override final
 			{
 				if constexpr (ShouldEnableBeforePhysicsUpdate)
 				{
-					ComponentTypeSceneData& typeSceneData = GetTypeSceneData();
-					// TODO: Prefetching logic
-					const typename FixedDenseStorageType::View denseStorage = typeSceneData.m_denseComponentStorage.GetView();
-					const typename DenseIdentifier::IndexType maximumUsedDenseIndex =
-						typeSceneData.m_denseIdentifierStorage.GetMaximumUsedElementCount();
-					for (const typename DenseIdentifier::IndexType denseComponentIndex :
-					     ComponentStage::m_updatedComponents.GetSetBitsIterator(0, maximumUsedDenseIndex))
+					const typename FixedDenseStorageType::View denseStorage = GetTypeSceneData().m_denseComponentStorage.GetView();
+					for (const IndexType denseComponentIndex : ComponentStage::m_updatedComponents.GetSetBitsIterator(startIndex, endIndex))
 					{
 						StoredType& component = denseStorage[denseComponentIndex];
 						component.BeforePhysicsUpdate();
 					}
 				}
-				return Threading::Job::Result::Finished;
 			}
 
 			PURE_LOCALS_AND_POINTERS ComponentTypeSceneData& GetTypeSceneData()
@@ -1447,6 +1608,11 @@ namespace ngine::Entity
 			{
 				return Memory::GetConstOwnerFromMember(*this, &ComponentTypeSceneData::m_beforePhysicsUpdateComponents);
 			}
+
+			virtual ComponentTypeSceneData& GetOwningTypeSceneData() override final
+			{
+				return GetTypeSceneData();
+			}
 		};
 		struct FixedPhysicsUpdateComponents final : public ComponentStage
 		{
@@ -1496,23 +1662,17 @@ namespace ngine::Entity
 				}
 			}
 
-			virtual Threading::Job::Result OnExecute(Threading::JobRunnerThread&) override final
+			virtual void UpdateComponents(const IndexType startIndex, const IndexType endIndex) override final
 			{
 				if constexpr (ShouldEnableFixedPhysicsUpdate)
 				{
-					ComponentTypeSceneData& typeSceneData = GetTypeSceneData();
-					// TODO: Prefetching logic
-					const typename FixedDenseStorageType::View denseStorage = typeSceneData.m_denseComponentStorage.GetView();
-					const typename DenseIdentifier::IndexType maximumUsedDenseIndex =
-						typeSceneData.m_denseIdentifierStorage.GetMaximumUsedElementCount();
-					for (const typename DenseIdentifier::IndexType denseComponentIndex :
-					     ComponentStage::m_updatedComponents.GetSetBitsIterator(0, maximumUsedDenseIndex))
+					const typename FixedDenseStorageType::View denseStorage = GetTypeSceneData().m_denseComponentStorage.GetView();
+					for (const IndexType denseComponentIndex : ComponentStage::m_updatedComponents.GetSetBitsIterator(startIndex, endIndex))
 					{
 						StoredType& component = denseStorage[denseComponentIndex];
 						component.FixedPhysicsUpdate();
 					}
 				}
-				return Threading::Job::Result::Finished;
 			}
 
 			PURE_LOCALS_AND_POINTERS ComponentTypeSceneData& GetTypeSceneData()
@@ -1523,6 +1683,11 @@ namespace ngine::Entity
 			{
 				return Memory::GetConstOwnerFromMember(*this, &ComponentTypeSceneData::m_fixedPhysicsUpdateComponents);
 			}
+
+			virtual ComponentTypeSceneData& GetOwningTypeSceneData() override final
+			{
+				return GetTypeSceneData();
+			}
 		};
 		struct AfterPhysicsUpdateComponents final : public ComponentStage
 		{
@@ -1574,23 +1739,17 @@ namespace ngine::Entity
 				}
 			}
 
-			virtual Threading::Job::Result OnExecute(Threading::JobRunnerThread&) override final
+			virtual void UpdateComponents(const IndexType startIndex, const IndexType endIndex) override final
 			{
 				if constexpr (ShouldEnableAfterPhysicsUpdate)
 				{
-					ComponentTypeSceneData& typeSceneData = GetTypeSceneData();
-					// TODO: Prefetching logic
-					const typename FixedDenseStorageType::View denseStorage = typeSceneData.m_denseComponentStorage.GetView();
-					const typename DenseIdentifier::IndexType maximumUsedDenseIndex =
-						typeSceneData.m_denseIdentifierStorage.GetMaximumUsedElementCount();
-					for (const typename DenseIdentifier::IndexType denseComponentIndex :
-					     ComponentStage::m_updatedComponents.GetSetBitsIterator(0, maximumUsedDenseIndex))
+					const typename FixedDenseStorageType::View denseStorage = GetTypeSceneData().m_denseComponentStorage.GetView();
+					for (const IndexType denseComponentIndex : ComponentStage::m_updatedComponents.GetSetBitsIterator(startIndex, endIndex))
 					{
 						StoredType& component = denseStorage[denseComponentIndex];
 						component.AfterPhysicsUpdate();
 					}
 				}
-				return Threading::Job::Result::Finished;
 			}
 
 			PURE_LOCALS_AND_POINTERS ComponentTypeSceneData& GetTypeSceneData()
@@ -1601,6 +1760,11 @@ namespace ngine::Entity
 			{
 				return Memory::GetConstOwnerFromMember(*this, &ComponentTypeSceneData::m_afterPhysicsUpdateComponents);
 			}
+
+			virtual ComponentTypeSceneData& GetOwningTypeSceneData() override final
+			{
+				return GetTypeSceneData();
+			}
 		};
 
 		NO_UNIQUE_ADDRESS TypeTraits::Select<ShouldEnableUpdate, MainUpdateComponents, Internal::DummyComponentStage> m_mainUpdateComponents;
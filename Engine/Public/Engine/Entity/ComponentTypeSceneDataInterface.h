@@ -92,6 +92,9 @@ namespace ngine::Entity
 		virtual Optional<Component*> CreateInstanceDynamic(AnyView initializer) = 0;
 
 		virtual void OnInstanceGuidChanged(const Guid previousGuid, const Guid newGuid) = 0;
+		//! Grows lookups and commits component storage ahead of creating the given number of instances at once
+		//! Returns false if the storage can't hold that many more instances
+		[[nodiscard]] virtual bool ReserveAdditionalInstances(const uint32 count) = 0;
 	protected:
 		const ComponentTypeIdentifier m_identifier;
 		ComponentTypeInterface& m_componentType;
@@ -35,6 +35,8 @@ namespace ngine::Entity
 	struct SceneRegistry;
 	struct RootSceneComponent;
 	struct RootSceneComponent2D;
+	struct ComponentTemplateCache;
+	struct BinaryScene;
 
 	struct HierarchyComponentBase : public DataComponentOwner
 	{
@@ -676,6 +678,11 @@ namespace ngine::Entity
 		bool Serialize(Serialization::Writer serializer) const;
 		bool SerializeDataComponents(Serialization::Writer serializer) const;
 		[[nodiscard]] Threading::JobBatch DeserializeDataComponentsAndChildren(const Serialization::Reader serializer);
+		//! Instantiates the flattened data components and children of a compiled scene whose root node describes this component
+		[[nodiscard]] Threading::JobBatch DeserializeDataComponentsAndChildren(const BinaryScene& scene);
+		//! Instantiates the flattened data components and children from the scene's already parsed per-node property readers
+		[[nodiscard]] Threading::JobBatch
+		DeserializeDataComponentsAndChildren(const BinaryScene& scene, const ArrayView<const Serialization::Reader, uint32> propertyReaders);
 		bool SerializeChildren(Serialization::Writer serializer) const;
 		bool SerializeDataComponentsAndChildren(Serialization::Writer serializer) const;
 		void DeserializeCustomData(const Optional<Serialization::Reader> serializer);
@@ -696,6 +703,7 @@ namespace ngine::Entity
 		friend Scene3D;
 		friend RootSceneComponent2D;
 		friend RootSceneComponent;
+		friend ComponentTemplateCache;
 		friend ComponentTypeSceneData<HierarchyComponentBase>;
 		friend Reflection::ReflectedType<HierarchyComponentBase>;
 
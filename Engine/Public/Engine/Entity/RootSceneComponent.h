@@ -3,7 +3,9 @@
 #include <Engine/Entity/Scene/SceneComponent.h>
 #include <Engine/Scene/SceneOctreeNode.h>
 #include <Engine/Entity/ForwardDeclarations/ComponentTypeSceneData.h>
+#include <Engine/Entity/ComponentIdentifier.h>
 #include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Memory/Containers/Vector.h>
 #include <Common/Time/FrameTime.h>
 #include <Common/Memory/Allocators/Pool.h>
 #include <Common/Memory/UniqueRef.h>
@@ -11,6 +13,11 @@
 #include <Renderer/Constants.h>
 
 #include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Threading/AtomicBool.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Storage/AtomicIdentifierMask.h>
+#include <Common/Storage/IdentifierArray.h>
+#include <Common/AtomicEnumFlags.h>
 
 namespace ngine::Asset
 {
@@ -31,6 +38,7 @@ namespace ngine::IO
 namespace ngine::Entity
 {
 	struct DestroyEmptyOctreeNodesJob;
+	struct UpdateOctreeJob;
 
 	namespace Data
 	{
@@ -112,7 +120,22 @@ namespace ngine::Entity
 			return m_rootNode;
 		}
 
+		//! Queues the component to be moved to its ideal octree node in the next batched octree update
+		//! Repeated changes to the same component within a frame only result in one reinsertion
 		void OnComponentWorldLocationOrBoundsChanged(Entity::Component3D& component, Entity::SceneRegistry& sceneRegistry);
+		//! Reinserts all components whose location or bounds changed since the last call
+		void ProcessQueuedOctreeUpdates(Entity::SceneRegistry& sceneRegistry);
+		//! Queues the children of the component to have their world transforms resolved from their relative transforms in the next batch
+		//! Returns false if the scene propagates transforms immediately, in which case the caller updates its children itself
+		[[nodiscard]] bool QueueChildTransformPropagation(Entity::Component3D& component, const EnumFlags<TransformChangeFlags> flags);
+		//! Resolves the world transforms below all components queued since the last call in one pass, parents before children
+		void ProcessQueuedTransformPropagations(Entity::SceneRegistry& sceneRegistry);
+		//! Gets the world transform of a component, including changes to its ancestors that were not propagated yet
+		[[nodiscard]] Math::WorldTransform GetResolvedWorldTransform(
+			const ComponentIdentifier componentIdentifier,
+			ComponentTypeSceneData<Data::WorldTransform>& worldTransformSceneData,
+			ComponentTypeSceneData<Data::LocalTransform3D>& localTransformSceneData
+		) const;
 		void RemoveComponent(Entity::Component3D& component);
 
 		[[nodiscard]] Math::Radius<Math::WorldCoordinateUnitType> GetRadius() const
@@ -134,6 +157,8 @@ namespace ngine::Entity
 		}
 
 		[[nodiscard]] Threading::StageBase& GetOctreeCleanupJob();
+		//! Stage that applies the queued octree reinsertions, views should traverse the octree after it
+		[[nodiscard]] Threading::StageBase& GetOctreeUpdateJob();
 
 		using Component3D::SerializeDataComponentsAndChildren;
 
@@ -162,6 +187,19 @@ namespace ngine::Entity
 		);
 
 		void AddComponent(Entity::Component3D& component);
+		void UpdateComponentOctreeNode(Entity::Component3D& component, Entity::SceneRegistry& sceneRegistry);
+
+		void AddOctreeStages(SceneRegistry& sceneRegistry);
+		void RemoveOctreeStages(SceneRegistry& sceneRegistry);
+
+		//! Resets the flags accumulated for a component's queued changes, returning the flags shared by all of them
+		//! Must be called before the component's mask bit is cleared, so that flags of changes queued concurrently are never lost
+		[[nodiscard]] EnumFlags<TransformChangeFlags> TakeQueuedTransformPropagationFlags(const ComponentIdentifier componentIdentifier);
+		//! Invalidates the cached knowledge of which components have no queued ancestors, called when a component may have gained one
+		void InvalidateUnqueuedAncestorsCache()
+		{
+			m_queuedAncestorsEpoch.FetchAdd(1);
+		}
 	protected:
 		ReferenceWrapper<Scene3D> m_scene;
 		Math::Radiusf m_radius;
@@ -175,6 +213,29 @@ namespace ngine::Entity
 
 		friend DestroyEmptyOctreeNodesJob;
 		UniqueRef<DestroyEmptyOctreeNodesJob> m_destroyEmptyOctreeNodesJob;
+		friend UpdateOctreeJob;
+		UniqueRef<UpdateOctreeJob> m_updateOctreeJob;
+
+		//! Components queued for octree reinsertion, the mask ensures each component is queued at most once
+		Threading::AtomicIdentifierMask<ComponentIdentifier> m_queuedOctreeUpdateMask;
+		Threading::Mutex m_queuedOctreeUpdatesMutex;
+		Vector<ReferenceWrapper<Component3D>> m_queuedOctreeUpdates;
+
+		//! Set once the scene runs the octree stages, until then transforms are propagated to children immediately
+		Threading::Atomic<bool> m_deferTransformPropagation{false};
+		//! Components whose children have not received their world transform change yet, the mask ensures each is queued at most once
+		Threading::AtomicIdentifierMask<ComponentIdentifier> m_queuedTransformPropagationMask;
+		Threading::Atomic<uint32> m_queuedTransformPropagationCount{0};
+		//! Change flags missing from at least one change queued for a component, so that children only see a flag if every change had it
+		//! Accumulated atomically before the mask bit is published and reset when the queued entry is taken
+		TIdentifierArray<AtomicEnumFlags<TransformChangeFlags>, ComponentIdentifier> m_queuedTransformPropagationExcludedFlags;
+		Threading::Mutex m_queuedTransformPropagationsMutex;
+		Vector<ReferenceWrapper<Component3D>> m_queuedTransformPropagations;
+		Vector<ReferenceWrapper<Component3D>> m_processedTransformPropagations;
+		//! Incremented whenever a component may have gained a queued ancestor, by queuing or by changes to the hierarchy
+		Threading::Atomic<uint32> m_queuedAncestorsEpoch{1};
+		//! Epoch at which each component was last found to have no queued ancestors, letting reads skip the walk up the hierarchy
+		mutable TIdentifierArray<Threading::Atomic<uint32>, ComponentIdentifier> m_unqueuedAncestorsEpochs;
 
 		ComponentTypeSceneData<Entity::Data::OctreeNode>& m_octreeNodeSceneData;
 		ComponentTypeSceneData<Entity::Data::Tags>& m_tagComponentTypeSceneData;
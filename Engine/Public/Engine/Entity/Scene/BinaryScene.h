@@ -0,0 +1,134 @@
+#pragma once
+
+#include <Common/Guid.h>
+#include <Common/IO/Path.h>
+#include <Common/IO/PathView.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/StringView.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Math/NumericLimits.h>
+#include <Common/Serialization/ForwardDeclarations/Reader.h>
+
+namespace ngine::Entity
+{
+	//! Compiled representation of a scene produced by the asset compiler, JSON remains the authoring format
+	//! Stores a table of all component types in the scene, their properties in dense per-type blocks and the hierarchy flattened depth-first
+	//! The property blocks together form a single JSON array, so the loader parses the scene's properties once, reserves each type's storage
+	//! once and instantiates without recursively walking the source document
+	struct BinaryScene
+	{
+		inline static constexpr IO::PathView FileExtension = MAKE_PATH(".scenebin");
+		static constexpr uint64 Magic = 0x004E454353425453; // STBSCEN\0
+		static constexpr uint32 Version = 2;
+
+		inline static constexpr uint32 InvalidNodeIndex = Math::NumericLimits<uint32>::Max;
+
+		struct Header
+		{
+			uint64 m_magic;
+			uint32 m_version;
+			uint32 m_typeCount;
+			uint32 m_nodeCount;
+			uint32 m_propertyDataSize;
+			uint32 m_typesOffset;
+			uint32 m_nodesOffset;
+			uint32 m_propertyDataOffset;
+			uint32 m_padding;
+		};
+
+		struct Type
+		{
+			Guid m_typeGuid;
+			uint32 m_instanceCount;
+			//! Range of the property data section containing the properties of all instances of this type
+			uint32 m_propertyDataOffset;
+			uint32 m_propertyDataSize;
+			uint32 m_padding;
+		};
+
+		struct Node
+		{
+			enum class Flags : uint8
+			{
+				//! Node is a data component owned by the parent node
+				IsDataComponent = 1 << 0,
+				//! Children are stored in the node's properties as they are interpreted by the component itself (i.e. nested scenes)
+				HasInlineChildren = 1 << 1
+			};
+
+			[[nodiscard]] bool IsDataComponent() const
+			{
+				return (m_flags & (uint8)Flags::IsDataComponent) != 0;
+			}
+			[[nodiscard]] bool HasInlineChildren() const
+			{
+				return (m_flags & (uint8)Flags::HasInlineChildren) != 0;
+			}
+
+			//! Index of the parent node, always lower than the node's own index
+			uint32 m_parentIndex;
+			uint32 m_typeIndex;
+			uint32 m_propertiesOffset;
+			uint32 m_propertiesSize;
+			//! Index of the node's properties in the property data array
+			uint32 m_propertiesIndex;
+			//! Number of flattened hierarchy children
+			uint16 m_childCount;
+			uint8 m_flags;
+			uint8 m_padding;
+		};
+
+		BinaryScene() = default;
+		//! Creates a view into data owned by the caller, check IsValid for success
+		explicit BinaryScene(const ConstByteView data);
+
+		//! Gets the path of the compiled scene emitted next to the scene's metadata
+		[[nodiscard]] static IO::Path GetFilePath(const IO::PathView metadataFilePath)
+		{
+			return IO::Path::Merge(metadataFilePath.GetWithoutExtensions(), FileExtension);
+		}
+
+		//! Compiles the scene JSON document into the binary representation
+		[[nodiscard]] static bool Compile(const Serialization::Reader sceneReader, Vector<ByteType>& output);
+
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_pHeader.IsValid() && m_nodes.HasElements();
+		}
+
+		[[nodiscard]] ArrayView<const Type, uint32> GetTypes() const
+		{
+			return m_types;
+		}
+		[[nodiscard]] ArrayView<const Node, uint32> GetNodes() const
+		{
+			return m_nodes;
+		}
+		[[nodiscard]] const Node& GetRootNode() const
+		{
+			return m_nodes[0];
+		}
+		//! Gets the node's JSON properties, excluding flattened children and data components
+		[[nodiscard]] ConstStringView GetProperties(const Node& node) const
+		{
+			return {reinterpret_cast<const char*>(m_propertyData.GetData() + node.m_propertiesOffset), node.m_propertiesSize};
+		}
+		//! Gets the JSON array holding the properties of all nodes, indexed by Node::m_propertiesIndex
+		[[nodiscard]] ConstStringView GetPropertyData() const
+		{
+			// Exclude the zero terminator
+			return {reinterpret_cast<const char*>(m_propertyData.GetData()), (uint32)m_propertyData.GetDataSize() - 1};
+		}
+		//! Splits the parsed property data array into one reader per node, indexed by Node::m_propertiesIndex
+		//! Lets the loader read the root and the flattened hierarchy from the same parsed document
+		[[nodiscard]] bool GetPropertyReaders(const Serialization::Reader propertyDataReader, Vector<Serialization::Reader, uint32>& readersOut) const;
+	protected:
+		Optional<const Header*> m_pHeader;
+		ArrayView<const Type, uint32> m_types;
+		ArrayView<const Node, uint32> m_nodes;
+		ConstByteView m_propertyData;
+	};
+}
@@ -3,8 +3,13 @@
 #include <Common/Memory/UniquePtr.h>
 #include <Common/Memory/Containers/UnorderedMap.h>
 #include <Common/Memory/Containers/InlineVector.h>
+#include <Common/Memory/Containers/Vector.h>
 #include <Common/Function/ThreadSafeEvent.h>
+#include <Common/Function/Function.h>
+#include <Common/Math/Transform.h>
+#include <Common/Memory/Containers/ArrayView.h>
 #include <Common/Storage/AtomicIdentifierMask.h>
+#include <Common/Threading/Mutexes/Mutex.h>
 
 #include <Engine/Entity/Scene/SceneRegistry.h>
 #include <Engine/Entity/Scene/ComponentTemplateIdentifier.h>
@@ -29,6 +34,7 @@ namespace ngine
 namespace ngine::Entity
 {
 	struct Component3D;
+	struct HierarchyComponentBase;
 
 	struct SceneTemplate
 	{
@@ -65,16 +71,40 @@ namespace ngine::Entity
 
 		[[nodiscard]] bool HasSceneLoaded(const ComponentTemplateIdentifier identifier) const;
 
+		using BulkInstantiatedCallback = Function<void(Component3D& instance, const uint32 instanceIndex), 24>;
+		//! Spawns one instance of a loaded template per world transform under the given parent
+		//! Storage is reserved once for all instances and cloning is spread across jobs, the callback is invoked from the job threads once each instance and its data components are cloned
+		//! Each instance is moved to its transform before its children are cloned, so only the instance roots are reinserted into the octree, in one deferred batch
+		//! The returned batch has to be queued by the caller
+		[[nodiscard]] Threading::JobBatch InstantiateBulk(
+			const ComponentTemplateIdentifier identifier,
+			HierarchyComponentBase& parent,
+			SceneRegistry& sceneRegistry,
+			const ArrayView<const Math::WorldTransform> worldTransforms,
+			BulkInstantiatedCallback&& callback
+		);
+
 		[[nodiscard]] Entity::SceneRegistry& GetTemplateSceneRegistry()
 		{
 			return m_templateSceneRegistry;
 		}
 	protected:
+		struct BulkInstantiation;
+
+		//! Number of instances cloned sequentially by each bulk instantiation job
+		inline static constexpr uint32 BulkInstantiationChunkSize = 32;
+
+		//! Called once all instances of a bulk instantiation were processed, releases it
+		void OnBulkInstantiationFinished(BulkInstantiation& bulkInstantiation);
+
 		virtual void OnAssetModified(const Asset::Guid assetGuid, const IdentifierType identifier, const IO::PathView filePath) override;
 
 		Threading::AtomicIdentifierMask<ComponentTemplateIdentifier> m_loadingScenes;
 		Threading::AtomicIdentifierMask<ComponentTemplateIdentifier> m_loadedScenes;
 
+		Threading::Mutex m_bulkInstantiationsMutex;
+		Vector<UniquePtr<BulkInstantiation>> m_bulkInstantiations;
+
 		Threading::SharedMutex m_sceneRequesterMutex;
 		UnorderedMap<ComponentTemplateIdentifier, UniquePtr<LoadEvent>, ComponentTemplateIdentifier::Hash> m_sceneRequesterMap;
 
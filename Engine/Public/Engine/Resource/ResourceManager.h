@@ -3,36 +3,193 @@
 #include <Common/Math/CoreNumericTypes.h>
 #include <Common/Storage/Identifier.h>
 #include <Common/Storage/IdentifierArray.h>
+#include <Common/Storage/SaltedIdentifierStorage.h>
 #include <Common/System/SystemType.h>
 #include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Memory/ReferenceWrapper.h>
+#include <Common/Math/NumericLimits.h>
 
 namespace ngine::Resource
 {
 	// Allow identifiers to reference others
 	// I.e. when a scene unloads it'll release references to all underneath it
 	using Identifier = TIdentifier<uint32, 18>;
+	//! Resources in the same group are always unloaded and reloaded together, i.e. a mesh and its GPU buffers
+	using GroupIdentifier = TIdentifier<uint32, 14>;
+
+	enum class MemoryType : uint8
+	{
+		CPU,
+		GPU,
+		Count
+	};
+
+	//! Implemented by the owner of a resource type, used by the manager to evict and restore its resources
+	struct Handler
+	{
+		virtual ~Handler() = default;
+
+		//! Frees the memory held by the resource
+		virtual void Unload(const Identifier identifier) = 0;
+		//! Starts loading a previously evicted resource again, usually by queueing its asset loading job
+		//! The owner reports the restored size with Manager::OnLoaded once done
+		virtual void Reload(const Identifier identifier) = 0;
+	};
 
 	struct Manager
 	{
 		inline static constexpr System::Type SystemType = System::Type::ResourceManager;
 
 		using Priority = uint32;
+		inline static constexpr Priority DefaultPriority = 100;
+
+		//! Fraction of each budget the manager evicts down to when the system reports low memory
+		inline static constexpr float LowMemoryTargetRatio = 0.5f;
+		//! Number of frames after which the usage weight of an untouched resource has halved
+		inline static constexpr float UsageHalfLifeFrames = 60.f;
+		//! Distance at which the distance weight of a resource has halved
+		inline static constexpr float DistanceHalfLife = 50.f;
 
 		struct Resource
 		{
-			size m_dataSize;
+			enum class State : uint8
+			{
+				Unregistered,
+				//! Registered, but its data has not been reported as loaded yet
+				Pending,
+				Loaded,
+				//! Unloaded by the manager to stay within budget
+				Evicted,
+				//! Evicted and requested again, waiting for the owner to report it loaded
+				Reloading
+			};
+
+			[[nodiscard]] size GetDataSize(const MemoryType type) const
+			{
+				return m_dataSizes[(uint8)type];
+			}
+
+			Identifier m_identifier;
+			Optional<Handler*> m_pHandler;
+			Array<size, (uint8)MemoryType::Count> m_dataSizes{Memory::InitializeAll, 0u};
+			Priority m_priority = DefaultPriority;
+			float m_distance = 0.f;
+			uint32 m_lastUsedFrameIndex = 0;
+			GroupIdentifier m_groupIdentifier;
+			State m_state = State::Unregistered;
+			bool m_isMarkedUnused = false;
 		};
 
 		Manager();
+		~Manager();
 
-		[[nodiscard]] Identifier Register() const;
+		[[nodiscard]] Identifier Register(Handler& handler, const Priority priority = DefaultPriority);
+		void Deregister(const Identifier identifier);
 
+		//! Pins the resource, acquired resources are never evicted
 		void Acquire(const Identifier);
 		void Release(const Identifier);
+		[[nodiscard]] bool IsAcquired(const Identifier identifier) const
+		{
+			return IsPinned(identifier);
+		}
+
+		void SetBudget(const MemoryType type, const size budget);
+		[[nodiscard]] size GetBudget(const MemoryType type) const;
+		[[nodiscard]] size GetUsage(const MemoryType type) const;
+
+		//! Reports the memory occupied by a resource once its data is available
+		//! Lower priority resources are evicted if a budget is exceeded, returns false if the budgets could not be met
+		bool OnLoaded(const Identifier identifier, const size cpuDataSize, const size gpuDataSize);
+
+		void SetPriority(const Identifier identifier, const Priority priority);
+		//! Sets the distance to the closest viewer, further resources are evicted first
+		void SetDistance(const Identifier identifier, const float distance);
+		//! Notifies that the resource was used this frame, requesting a reload if it had been evicted
+		void MarkUsed(const Identifier identifier);
+		//! Flags the resource as no longer needed, making it the first to be evicted
+		void MarkUnused(const Identifier identifier);
+
+		[[nodiscard]] GroupIdentifier CreateGroup();
+		void AddToGroup(const Identifier identifier, const GroupIdentifier groupIdentifier);
+		void RemoveFromGroup(const Identifier identifier);
+		void DestroyGroup(const GroupIdentifier groupIdentifier);
+
+		//! Ages usage information, expected to be called once per frame
+		void AdvanceFrame()
+		{
+			m_frameIndex++;
+		}
+
+		[[nodiscard]] Resource::State GetState(const Identifier identifier) const;
+		[[nodiscard]] bool IsLoaded(const Identifier identifier) const
+		{
+			return GetState(identifier) == Resource::State::Loaded;
+		}
+		[[nodiscard]] size GetDataSize(const Identifier identifier, const MemoryType type) const;
 
 		void OnMemoryRunningLow();
+	protected:
+		struct EvictionCandidate
+		{
+			float m_score;
+			Array<size, (uint8)MemoryType::Count> m_dataSizes;
+			Identifier m_identifier;
+			GroupIdentifier m_groupIdentifier;
+		};
+
+		struct Group
+		{
+			Vector<Identifier> m_resources;
+		};
+
+		//! Resource whose handler has to be notified once the mutex was released
+		struct QueuedHandlerCall
+		{
+			Identifier m_identifier;
+			ReferenceWrapper<Handler> m_handler;
+		};
+
+		[[nodiscard]] Resource& GetResource(const Identifier identifier)
+		{
+			return m_resources[identifier.GetFirstValidIndex()];
+		}
+		[[nodiscard]] const Resource& GetResource(const Identifier identifier) const
+		{
+			return m_resources[identifier.GetFirstValidIndex()];
+		}
+
+		[[nodiscard]] float CalculateScore(const Resource& resource) const;
+		[[nodiscard]] bool IsPinned(const Identifier identifier) const;
+		void SetDataSizes(Resource& resource, const size cpuDataSize, const size gpuDataSize);
+
+		//! Evicts resources scored below the threshold until each memory type is within its target, returns whether all targets were met
+		//! Must be called with the mutex held, evicted resources are appended to evictedResourcesOut and have to be unloaded once unlocked
+		bool EvictUntilWithinTargets(
+			const Array<size, (uint8)MemoryType::Count> targets,
+			const float scoreThreshold,
+			const Identifier excludedIdentifier,
+			Vector<QueuedHandlerCall>& evictedResourcesOut
+		);
+		void Evict(Resource& resource, Vector<QueuedHandlerCall>& evictedResourcesOut);
+		static void UnloadEvictedResources(const ArrayView<const QueuedHandlerCall> evictedResources);
 	protected:
 		TIdentifierArray<Threading::Atomic<uint32>, Identifier> m_resourceUseCounts;
 		// TIdentifierArray<Event<void(void*, const Identifier), 24>, Identifier> m_resourceReleaseCallbacks;
+
+		mutable Threading::Mutex m_mutex;
+		TSaltedIdentifierStorage<Identifier> m_resourceIdentifiers;
+		Vector<Resource> m_resources;
+		TSaltedIdentifierStorage<GroupIdentifier> m_groupIdentifiers;
+		Vector<Group> m_groups;
+
+		Array<size, (uint8)MemoryType::Count> m_budgets{Memory::InitializeAll, Math::NumericLimits<size>::Max};
+		Array<size, (uint8)MemoryType::Count> m_usages{Memory::InitializeAll, 0u};
+		Threading::Atomic<uint32> m_frameIndex{0};
 	};
 }
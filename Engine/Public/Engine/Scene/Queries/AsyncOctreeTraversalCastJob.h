@@ -0,0 +1,81 @@
+#pragma once
+
+#include "OctreeTraversalQueue.h"
+
+#include <Common/Threading/Jobs/Job.h>
+
+#include <Common/Function/Function.h>
+#include <Common/Memory/CallbackResult.h>
+#include <Common/Memory/ReferenceWrapper.h>
+#include <Common/Math/Length.h>
+#include <Common/Math/Radius.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/WorldCoordinate.h>
+
+#include <Engine/Tag/TagMask.h>
+#include <Engine/Entity/ForwardDeclarations/ComponentTypeSceneData.h>
+
+namespace ngine
+{
+	struct SceneOctreeNode;
+}
+
+namespace ngine::Entity
+{
+	struct Component3D;
+	struct SceneRegistry;
+
+	namespace Data
+	{
+		struct Tags;
+	}
+}
+
+namespace ngine::SceneQueries
+{
+	//! Casts a ray, segment or swept sphere through the subtree of the given octree node, reporting components whose world bounds are hit from front to back
+	//! The callback can return Break to stop at the first relevant hit; it is invoked with Invalid if nothing was hit
+	struct AsyncOctreeTraversalCastJob final : public Threading::Job
+	{
+		using Callback = Function<Memory::CallbackResult(const Optional<Entity::Component3D*>, const Math::Lengthf distance), 24>;
+
+		//! Ray or segment cast, direction must be normalized
+		AsyncOctreeTraversalCastJob(
+			Entity::SceneRegistry& sceneRegistry,
+			const SceneOctreeNode& octreeNode,
+			const Tag::Mask tagMask,
+			const Math::WorldCoordinate origin,
+			const Math::Vector3f direction,
+			const Math::Lengthf maximumDistance,
+			Callback&& callback,
+			const Priority priority
+		);
+		//! Swept sphere cast, direction must be normalized
+		AsyncOctreeTraversalCastJob(
+			Entity::SceneRegistry& sceneRegistry,
+			const SceneOctreeNode& octreeNode,
+			const Tag::Mask tagMask,
+			const Math::WorldCoordinate origin,
+			const Math::Vector3f direction,
+			const Math::Lengthf maximumDistance,
+			const Math::Radiusf radius,
+			Callback&& callback,
+			const Priority priority
+		);
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override;
+	protected:
+		void QueueNode(const SceneOctreeNode& node);
+		void QueueComponent(Entity::Component3D& component, Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData);
+	protected:
+		Entity::SceneRegistry& m_sceneRegistry;
+		ReferenceWrapper<const SceneOctreeNode> m_initialOctreeNode;
+		const Tag::Mask m_tagMask;
+		const Math::WorldCoordinate m_origin;
+		const Math::Vector3f m_direction;
+		const float m_maximumDistance;
+		const float m_radius;
+		const Callback m_callback;
+		OctreeTraversalQueue m_queue;
+	};
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "OctreeTraversalQueue.h"
+
+#include <Common/Threading/Jobs/Job.h>
+
+#include <Common/Function/Function.h>
+#include <Common/Memory/CallbackResult.h>
+#include <Common/Memory/ReferenceWrapper.h>
+#include <Common/Math/Length.h>
+#include <Common/Math/WorldCoordinate.h>
+
+#include <Engine/Tag/TagMask.h>
+#include <Engine/Entity/ForwardDeclarations/ComponentTypeSceneData.h>
+
+namespace ngine
+{
+	struct SceneOctreeNode;
+}
+
+namespace ngine::Entity
+{
+	struct Component3D;
+	struct SceneRegistry;
+
+	namespace Data
+	{
+		struct Tags;
+	}
+}
+
+namespace ngine::SceneQueries
+{
+	//! Finds up to maximumCount components closest to a location within a maximum distance, measured to their world bounds
+	//! Only the subtree of the given octree node is searched. Candidates are kept in a queue bounded at maximumCount, whose farthest entry
+	//! prunes the remaining nodes once it is full. Results are reported nearest first; the callback is invoked with Invalid if nothing was found
+	struct AsyncOctreeTraversalNearestJob final : public Threading::Job
+	{
+		using Callback = Function<Memory::CallbackResult(const Optional<Entity::Component3D*>, const Math::Lengthf distance), 24>;
+
+		AsyncOctreeTraversalNearestJob(
+			Entity::SceneRegistry& sceneRegistry,
+			const SceneOctreeNode& octreeNode,
+			const Tag::Mask tagMask,
+			const Math::WorldCoordinate location,
+			const Math::Lengthf maximumDistance,
+			const uint32 maximumCount,
+			Callback&& callback,
+			const Priority priority
+		);
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override;
+	protected:
+		void QueueNode(const SceneOctreeNode& node);
+		void QueueComponent(Entity::Component3D& component, Entity::ComponentTypeSceneData<Entity::Data::Tags>& tagsSceneData);
+	protected:
+		Entity::SceneRegistry& m_sceneRegistry;
+		ReferenceWrapper<const SceneOctreeNode> m_initialOctreeNode;
+		const Tag::Mask m_tagMask;
+		const Math::WorldCoordinate m_location;
+		const float m_maximumDistanceSquared;
+		const Callback m_callback;
+		//! Nodes left to visit, nearest first
+		OctreeTraversalQueue m_queue;
+		NearestComponentQueue m_nearestComponents;
+	};
+}
@@ -0,0 +1,190 @@
+#pragma once
+
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Memory/ReferenceWrapper.h>
+#include <Common/Math/Primitives/WorldBoundingBox.h>
+#include <Common/Math/Vector3.h>
+
+namespace ngine
+{
+	struct SceneOctreeNode;
+}
+
+namespace ngine::Entity
+{
+	struct Component3D;
+}
+
+namespace ngine::SceneQueries
+{
+	//! Min-heap of octree nodes and components keyed by distance, used to visit the octree best-first
+	//! Node distances are lower bounds for every component below them, so components are popped in ascending order
+	struct OctreeTraversalQueue
+	{
+		struct Entry
+		{
+			float m_distance;
+			Optional<const SceneOctreeNode*> m_pNode;
+			Optional<Entity::Component3D*> m_pComponent;
+		};
+
+		void PushNode(const SceneOctreeNode& node, const float distance)
+		{
+			Push(Entry{distance, &node, Invalid});
+		}
+		void PushComponent(Entity::Component3D& component, const float distance)
+		{
+			Push(Entry{distance, Invalid, &component});
+		}
+		void Push(const Entry entry);
+		[[nodiscard]] Entry Pop();
+
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return m_entries.IsEmpty();
+		}
+		[[nodiscard]] float GetNearestDistance() const
+		{
+			return m_entries[0].m_distance;
+		}
+		void Clear()
+		{
+			m_entries.Clear();
+		}
+
+		//! Returns the distance along the ray at which it enters the box, or Invalid if it misses within the maximum distance
+		//! The direction must be normalized; a non-zero radius expands the box to approximate a swept sphere
+		[[nodiscard]] static Optional<float> GetRayEntryDistance(
+			const Math::WorldBoundingBox boundingBox,
+			const Math::WorldCoordinate origin,
+			const Math::Vector3f direction,
+			const float maximumDistance,
+			const float radius
+		);
+		[[nodiscard]] static float GetSquaredDistance(const Math::WorldBoundingBox boundingBox, const Math::WorldCoordinate point);
+	protected:
+		Vector<Entry> m_entries;
+	};
+
+	//! Max-heap holding the k nearest elements found so far, bounded at a capacity of k
+	//! Once full, a nearer element replaces the farthest one, and the farthest distance becomes the bound that later candidates and nodes must be within
+	template<typename ElementType>
+	struct TBoundedNearestQueue
+	{
+		struct Entry
+		{
+			float m_distance;
+			ElementType m_element;
+		};
+
+		TBoundedNearestQueue(const uint32 capacity)
+			: m_entries(Memory::Reserve, capacity)
+			, m_capacity(capacity)
+		{
+		}
+
+		//! Adds the element if it is among the k nearest so far
+		//! @returns whether the element was added
+		bool TryPush(const ElementType element, const float distance)
+		{
+			if (m_entries.GetSize() < m_capacity)
+			{
+				m_entries.EmplaceBack(Entry{distance, element});
+				SiftUp(m_entries.GetSize() - 1);
+				return true;
+			}
+			else if (m_capacity > 0 && distance < m_entries[0].m_distance)
+			{
+				m_entries[0] = Entry{distance, element};
+				SiftDown(0, m_entries.GetSize());
+				return true;
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool IsFull() const
+		{
+			return m_entries.GetSize() == m_capacity;
+		}
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return m_entries.IsEmpty();
+		}
+		[[nodiscard]] uint32 GetSize() const
+		{
+			return m_entries.GetSize();
+		}
+		[[nodiscard]] uint32 GetCapacity() const
+		{
+			return m_capacity;
+		}
+
+		//! Gets the distance a candidate has to be within to be accepted, the farthest kept distance once full and maximumDistance until then
+		[[nodiscard]] float GetAcceptedDistance(const float maximumDistance) const
+		{
+			return IsFull() && m_capacity > 0 ? m_entries[0].m_distance : maximumDistance;
+		}
+
+		//! Sorts the entries nearest first in place, after which no more elements may be pushed
+		[[nodiscard]] ArrayView<const Entry> SortNearestFirst()
+		{
+			for (uint32 size = m_entries.GetSize(); size > 1; --size)
+			{
+				const Entry farthestEntry = m_entries[0];
+				m_entries[0] = m_entries[size - 1];
+				m_entries[size - 1] = farthestEntry;
+				SiftDown(0, size - 1);
+			}
+			m_capacity = 0;
+			return m_entries.GetView();
+		}
+	protected:
+		void SiftUp(uint32 index)
+		{
+			while (index > 0)
+			{
+				const uint32 parentIndex = (index - 1) / 2;
+				if (m_entries[parentIndex].m_distance >= m_entries[index].m_distance)
+				{
+					break;
+				}
+				const Entry parentEntry = m_entries[parentIndex];
+				m_entries[parentIndex] = m_entries[index];
+				m_entries[index] = parentEntry;
+				index = parentIndex;
+			}
+		}
+		void SiftDown(uint32 index, const uint32 size)
+		{
+			while (true)
+			{
+				const uint32 leftIndex = index * 2 + 1;
+				const uint32 rightIndex = leftIndex + 1;
+				uint32 farthestIndex = index;
+				if (leftIndex < size && m_entries[leftIndex].m_distance > m_entries[farthestIndex].m_distance)
+				{
+					farthestIndex = leftIndex;
+				}
+				if (rightIndex < size && m_entries[rightIndex].m_distance > m_entries[farthestIndex].m_distance)
+				{
+					farthestIndex = rightIndex;
+				}
+				if (farthestIndex == index)
+				{
+					break;
+				}
+
+				const Entry entry = m_entries[farthestIndex];
+				m_entries[farthestIndex] = m_entries[index];
+				m_entries[index] = entry;
+				index = farthestIndex;
+			}
+		}
+	protected:
+		Vector<Entry> m_entries;
+		uint32 m_capacity;
+	};
+
+	using NearestComponentQueue = TBoundedNearestQueue<ReferenceWrapper<Entity::Component3D>>;
+}
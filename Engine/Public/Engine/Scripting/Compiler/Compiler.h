@@ -32,8 +32,10 @@ namespace ngine::Scripting
 	struct Compiler : public AST::NodeVisitor<Compiler>
 	{
 	public:
-		static constexpr uint32 Version = 1;
+		static constexpr uint32 Version = 2;
 		static constexpr uint64 Magic = 0x0000545049524353; // SCRIPT\0\0
+		//! Size of the magic, version and timestamp preceding the function data in saved bytecode
+		static constexpr uint32 HeaderSize = sizeof(uint64) + sizeof(uint32) + sizeof(uint64);
 
 		static constexpr uint32 MaxLocalVariableCount = 0xFF;
 		static constexpr uint32 MaxUpValueCount = 0xFF;
@@ -60,6 +62,8 @@ namespace ngine::Scripting
 		[[nodiscard]] bool ResolveConstant(const Value& value) const;
 		//! Resolves function pointers in the given function, to make them executable on this machine
 		[[nodiscard]] bool ResolveFunction(FunctionObject& function) const;
+		//! Replaces common instruction sequences in the function and its nested functions with superinstructions
+		static void FuseSuperinstructions(FunctionObject& function);
 		[[nodiscard]] UniquePtr<FunctionObject> Load(ConstByteView input) const;
 		[[nodiscard]] bool Save(const FunctionObject& function, Vector<ByteType>& output) const;
 
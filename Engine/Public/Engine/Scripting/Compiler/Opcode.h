@@ -191,5 +191,27 @@ namespace ngine::Scripting
 		//! This expects that the resolving will succeed, and will terminate function execution if it fails
 		//! Used for known components from scene explorer and more - in dynamic cases the user must explicitly resolve soft references
 		PushComponentSoftReference,
+
+		// Superinstructions, fused by the compiler from common instruction sequences
+		// Only the first opcode of the sequence is replaced, the remaining instructions and all operands stay in place.
+		// This keeps jump offsets valid, and jumps into the middle of a sequence still execute the original instructions.
+		PushLocalPushImmediateAddInteger,
+		PushLocalPushConstantAddFloat,
+		PushLocalPushLocalAddFloat,
+		PushLocalPushLocalSubtractFloat,
+		PushLocalPushLocalMultiplyFloat,
+		MultiplyAddFloat,
+		LessIntegerJumpIfFalse,
+		LessEqualIntegerJumpIfFalse,
+		GreaterIntegerJumpIfFalse,
+		GreaterEqualIntegerJumpIfFalse,
+		EqualEqualIntegerJumpIfFalse,
+		NotEqualIntegerJumpIfFalse,
+		LessFloatJumpIfFalse,
+		LessEqualFloatJumpIfFalse,
+		GreaterFloatJumpIfFalse,
+		GreaterEqualFloatJumpIfFalse,
 	};
+
+	inline static constexpr uint16 OpCodeCount = uint16(OpCode::GreaterEqualFloatJumpIfFalse) + 1;
 }
@@ -35,6 +35,8 @@ namespace ngine::Scripting
 		Script(const Script&) = delete;
 		Script(Script&& other)
 			: m_compiledFunctions(Move(other.m_compiledFunctions))
+			, m_assignedFunctions(Move(other.m_assignedFunctions))
+			, m_sharedFunctionHashes(Move(other.m_sharedFunctionHashes))
 			, m_pAstGraph(Move(other.m_pAstGraph))
 		{
 		}
@@ -42,7 +44,12 @@ namespace ngine::Scripting
 		Script& operator=(Script&& other) = delete;
 
 		mutable Threading::SharedMutex m_functionMutex;
-		UnorderedMap<Guid, UniquePtr<FunctionObject>, Guid::Hash> m_compiledFunctions;
+		//! Functions are owned by the cache, and shared between all scripts with identical bytecode
+		UnorderedMap<Guid, Optional<const FunctionObject*>, Guid::Hash> m_compiledFunctions;
+		//! Functions assigned directly without saved bytecode, i.e. compiled in the editor
+		UnorderedMap<Guid, UniquePtr<FunctionObject>, Guid::Hash> m_assignedFunctions;
+		//! Bytecode hash of each compiled function that references a shared function, released when the function is replaced or unloaded
+		UnorderedMap<Guid, size, Guid::Hash> m_sharedFunctionHashes;
 		UniquePtr<AST::Graph> m_pAstGraph;
 	};
 
@@ -81,6 +88,32 @@ namespace ngine::Scripting
 		[[nodiscard]] bool
 		AssignCompiledFunction(ScriptIdentifier identifier, const Guid localFunctionIdentifier, UniquePtr<FunctionObject>&& pFunctionObject);
 		void RemoveCompiledFunction(ScriptIdentifier identifier, const Guid localFunctionIdentifier);
+		//! Unloads all compiled functions of the script, shared functions are destroyed once no other script references them
+		void UnloadCompiledFunctions(ScriptIdentifier identifier);
+
+		//! Hashes saved bytecode, ignoring the header as it contains the time of compilation
+		[[nodiscard]] static size GetBytecodeHash(const ConstByteView bytecode);
+
+		//! Finds a previously loaded function with identical saved bytecode, without referencing it
+		[[nodiscard]] Optional<const FunctionObject*> FindSharedFunction(const ConstByteView bytecode) const
+		{
+			return FindSharedFunction(bytecode, GetBytecodeHash(bytecode));
+		}
+		[[nodiscard]] Optional<const FunctionObject*> FindSharedFunction(const ConstByteView bytecode, const size bytecodeHash) const;
+		//! Finds a previously loaded function with identical saved bytecode and adds a reference to it
+		//! Every valid result must be released with ReleaseSharedFunction
+		[[nodiscard]] Optional<const FunctionObject*> AcquireSharedFunction(const ConstByteView bytecode, const size bytecodeHash);
+		//! Gets the single shared copy of the function with the specified saved bytecode and adds a reference to it, taking ownership of the
+		//! function if none existed yet. Every valid result must be released with ReleaseSharedFunction
+		//! Returns invalid if different bytecode with the same hash was shared before, in which case the caller keeps ownership of the function
+		[[nodiscard]] Optional<const FunctionObject*> FindOrAddSharedFunction(const ConstByteView bytecode, UniquePtr<FunctionObject>& pFunction)
+		{
+			return FindOrAddSharedFunction(bytecode, GetBytecodeHash(bytecode), pFunction);
+		}
+		[[nodiscard]] Optional<const FunctionObject*>
+		FindOrAddSharedFunction(const ConstByteView bytecode, const size bytecodeHash, UniquePtr<FunctionObject>& pFunction);
+		//! Removes a reference added by AcquireSharedFunction or FindOrAddSharedFunction, destroying the function with the last one
+		void ReleaseSharedFunction(const size bytecodeHash);
 
 	protected:
 		friend struct LoadScriptJob;
@@ -97,6 +130,18 @@ namespace ngine::Scripting
 		TIdentifierArray<ScriptLoadEvent, ScriptIdentifier> m_interpretedScriptLoadEvents;
 		TIdentifierArray<ScriptLoadEvent, ScriptIdentifier> m_compiledScriptLoadEvents;
 
+		struct SharedFunction
+		{
+			//! Saved bytecode excluding the header, compared on lookup to detect hash collisions
+			Vector<ByteType, size> m_bytecode;
+			UniquePtr<FunctionObject> m_pFunction;
+			//! Number of compiled script functions referencing this function
+			uint32 m_referenceCount{0};
+		};
+		//! Immutable linked functions keyed by the hash of their bytecode, never replaced while referenced
+		mutable Threading::SharedMutex m_sharedFunctionsMutex;
+		UnorderedMap<size, SharedFunction> m_sharedFunctions;
+
 		UniquePtr<ScriptFunctionCache> m_pFunctionCache;
 		UniquePtr<ScriptTableCache> m_pTableCache;
 		SharedPtr<Environment> m_pIntermediateEnvironment;
@@ -7,6 +7,7 @@
 #include <Common/Memory/Containers/UnorderedMap.h>
 #include <Common/Memory/Containers/String.h>
 #include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
 #include <Common/Memory/Optional.h>
 #include <Common/EnumFlags.h>
 #include <Common/EnumFlagOperators.h>
@@ -24,7 +25,11 @@ namespace ngine::Scripting
 	public:
 		static constexpr uint32 Version = 1;
 		static constexpr uint32 MaxCallStackSize = 0x40;
-		static constexpr uint32 MaxStackSize = MaxCallStackSize * 0xFF;
+		//! Number of stack slots a single call frame is guaranteed to have available
+		static constexpr uint32 MaxFrameStackSize = 0xFF;
+		static constexpr uint32 MaxStackSize = MaxCallStackSize * MaxFrameStackSize;
+		static constexpr uint32 InitialStackSize = MaxFrameStackSize * 4;
+		static constexpr uint32 StackGrowFactor = 2;
 		static constexpr uint32 HeapGrowFactor = 2;
 
 		using GlobalMapType = UnorderedMap<Guid, RawValue, Guid::Hash>;
@@ -61,6 +66,7 @@ namespace ngine::Scripting
 		void CloseUpvalues(RawValue* pLast);
 		[[nodiscard]] bool Error(StringType::ConstView error);
 		void ResetStack();
+		[[nodiscard]] bool ReserveFrameStack();
 	private:
 		static void* Reallocate(GC& gc, void*, size, size, size);
 		void CollectGarbage();
@@ -75,12 +81,18 @@ namespace ngine::Scripting
 			ClosureObject* pClosure;
 			uint8 coarity;
 		};
+		//! Transient state only needed while executing, shared by all virtual machines executing on the same thread
+		struct ExecutionStack
+		{
+			Array<CallFrame, MaxCallStackSize, uint32, uint32> frames;
+			Vector<RawValue, uint32> values;
+		};
+		struct ExecutionScope;
 		struct State
 		{
 			RawValue* sp;
-			Array<CallFrame, MaxCallStackSize, uint32, uint32> frames;
+			Optional<ExecutionStack*> pStack;
 			uint32 frameCount;
-			Array<RawValue, MaxStackSize, uint32, uint32> stack;
 			GlobalMapType globals;
 			UpvalueObject* pOpenUpvalues;
 			Object* pObjects;
@@ -0,0 +1,242 @@
+#include "gtest/gtest.h"
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Engine/Asset/BinaryAssetDatabase.h>
+
+#include <Common/Asset/AssetDatabase.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(BinaryAssetDatabase, RoundTrip)
+	{
+		const IO::Path rootDirectory(MAKE_PATH("Root"));
+		const Asset::Guid typeGuid = Asset::Guid::Generate();
+		const Asset::Guid tagGuid = Asset::Guid::Generate();
+
+		Asset::Database database;
+		Array<Asset::Guid, 3> assetGuids{Asset::Guid::Generate(), Asset::Guid::Generate(), Asset::Guid::Generate()};
+		Array<IO::Path, 3> assetPaths{
+			IO::Path::Combine(IO::Path::Combine(rootDirectory, MAKE_PATH("Textures")), MAKE_PATH("First.nasset")),
+			IO::Path::Combine(IO::Path::Combine(rootDirectory, MAKE_PATH("Textures")), MAKE_PATH("Second.nasset")),
+			IO::Path::Combine(rootDirectory, MAKE_PATH("Third.nasset"))
+		};
+		for (uint8 index = 0; index < 3; ++index)
+		{
+			database.RegisterAsset(
+				assetGuids[index],
+				Asset::DatabaseEntry{
+					typeGuid,
+					{},
+					IO::Path(assetPaths[index]),
+					UnicodeString{},
+					UnicodeString{},
+					Asset::Guid{},
+					Array{tagGuid}.GetDynamicView()
+				},
+				rootDirectory
+			);
+		}
+
+		Vector<ByteType> data;
+		EXPECT_TRUE(Asset::BinaryDatabase::Serialize(database, rootDirectory, data));
+
+		const Asset::BinaryDatabase binaryDatabase(data.GetView());
+		ASSERT_TRUE(binaryDatabase.IsValid());
+		EXPECT_EQ(binaryDatabase.GetEntryCount(), 3u);
+		for (uint32 index = 1; index < binaryDatabase.GetEntryCount(); ++index)
+		{
+			EXPECT_TRUE(Asset::BinaryDatabase::IsLess(binaryDatabase.GetEntries()[index - 1].m_guid, binaryDatabase.GetEntries()[index].m_guid));
+		}
+
+		for (uint8 index = 0; index < 3; ++index)
+		{
+			const Optional<const Asset::BinaryDatabase::Entry*> pEntry = binaryDatabase.FindEntry(assetGuids[index]);
+			ASSERT_TRUE(pEntry.IsValid());
+			EXPECT_TRUE(binaryDatabase.GetPath(*pEntry, rootDirectory) == assetPaths[index]);
+			EXPECT_TRUE(binaryDatabase.GetGuid(pEntry->m_assetTypeGuidIndex) == typeGuid);
+			EXPECT_EQ(binaryDatabase.GetGuids(pEntry->m_tags).GetSize(), 1u);
+			EXPECT_TRUE(binaryDatabase.GetGuids(pEntry->m_tags)[0] == tagGuid);
+		}
+
+		// Directories and type guids are only stored once
+		const Asset::BinaryDatabase::Entry& firstEntry = *binaryDatabase.FindEntry(assetGuids[0]);
+		const Asset::BinaryDatabase::Entry& secondEntry = *binaryDatabase.FindEntry(assetGuids[1]);
+		EXPECT_EQ(firstEntry.m_directory.m_offset, secondEntry.m_directory.m_offset);
+		EXPECT_EQ(firstEntry.m_assetTypeGuidIndex, secondEntry.m_assetTypeGuidIndex);
+
+		EXPECT_FALSE(binaryDatabase.HasAsset(Asset::Guid::Generate()));
+	}
+
+	UNIT_TEST(BinaryAssetDatabase, CreateDatabaseEntry)
+	{
+		const IO::Path rootDirectory(MAKE_PATH("Root"));
+		const Asset::Guid assetGuid = Asset::Guid::Generate();
+		const Asset::Guid typeGuid = Asset::Guid::Generate();
+		const Asset::Guid thumbnailGuid = Asset::Guid::Generate();
+		const Asset::Guid tagGuid = Asset::Guid::Generate();
+		const Asset::Guid dependencyGuid = Asset::Guid::Generate();
+		const IO::Path assetPath = IO::Path::Combine(IO::Path::Combine(rootDirectory, MAKE_PATH("Meshes")), MAKE_PATH("Mesh.nasset"));
+
+		Asset::Database database;
+		database.RegisterAsset(
+			assetGuid,
+			Asset::DatabaseEntry{
+				typeGuid,
+				{},
+				IO::Path(assetPath),
+				UnicodeString(MAKE_UNICODE_LITERAL("Mesh")),
+				UnicodeString(MAKE_UNICODE_LITERAL("Description")),
+				thumbnailGuid,
+				Array{tagGuid}.GetDynamicView(),
+				Array{dependencyGuid}.GetDynamicView()
+			},
+			rootDirectory
+		);
+
+		Vector<ByteType> data;
+		EXPECT_TRUE(Asset::BinaryDatabase::Serialize(database, rootDirectory, data));
+		const Asset::BinaryDatabase binaryDatabase(data.GetView());
+		ASSERT_TRUE(binaryDatabase.IsValid());
+
+		const Optional<const Asset::BinaryDatabase::Entry*> pEntry = binaryDatabase.FindEntry(assetGuid);
+		ASSERT_TRUE(pEntry.IsValid());
+		// Assets without meta data don't store any
+		EXPECT_TRUE(binaryDatabase.GetMetaData(*pEntry).IsEmpty());
+
+		const Asset::DatabaseEntry databaseEntry = binaryDatabase.CreateDatabaseEntry(*pEntry, rootDirectory);
+		const Optional<const Asset::DatabaseEntry*> pSourceEntry = database.GetAssetEntry(assetGuid);
+		ASSERT_TRUE(pSourceEntry.IsValid());
+		EXPECT_TRUE(databaseEntry.m_path == assetPath);
+		EXPECT_TRUE(databaseEntry.m_assetTypeGuid == typeGuid);
+		EXPECT_TRUE(databaseEntry.m_thumbnailGuid == thumbnailGuid);
+		EXPECT_TRUE(databaseEntry.GetName() == pSourceEntry->GetName());
+		EXPECT_TRUE(databaseEntry.m_description == pSourceEntry->m_description);
+		ASSERT_EQ(databaseEntry.m_tags.GetSize(), 1u);
+		EXPECT_TRUE(databaseEntry.m_tags[0] == tagGuid);
+		ASSERT_EQ(databaseEntry.m_dependencies.GetSize(), 1u);
+		EXPECT_TRUE(databaseEntry.m_dependencies[0] == dependencyGuid);
+	}
+
+	UNIT_TEST(BinaryAssetDatabase, RejectsInvalidData)
+	{
+		Vector<ByteType> data;
+		data.Resize(sizeof(Asset::BinaryDatabase::Header));
+		const Asset::BinaryDatabase binaryDatabase(data.GetView());
+		EXPECT_FALSE(binaryDatabase.IsValid());
+		EXPECT_FALSE(binaryDatabase.HasAsset(Asset::Guid::Generate()));
+
+		// Files written by a previous version are rejected rather than misread
+		Asset::BinaryDatabase::Header& header = *reinterpret_cast<Asset::BinaryDatabase::Header*>(data.GetData());
+		header.m_magic = Asset::BinaryDatabase::Magic;
+		header.m_version = Asset::BinaryDatabase::Version - 1;
+		header.m_pathCharacterSize = sizeof(Asset::BinaryDatabase::PathCharType);
+		header.m_nameCharacterSize = sizeof(Asset::BinaryDatabase::NameCharType);
+		const Asset::BinaryDatabase previousVersionDatabase(data.GetView());
+		EXPECT_FALSE(previousVersionDatabase.IsValid());
+	}
+
+	UNIT_TEST(BinaryAssetDatabase, FindEntryByPath)
+	{
+		const IO::Path rootDirectory(MAKE_PATH("Root"));
+		const Asset::Guid typeGuid = Asset::Guid::Generate();
+
+		Asset::Database database;
+		Array<Asset::Guid, 3> assetGuids{Asset::Guid::Generate(), Asset::Guid::Generate(), Asset::Guid::Generate()};
+		Array<IO::Path, 3> relativePaths{
+			IO::Path::Combine(MAKE_PATH("Textures"), MAKE_PATH("Asset.nasset")),
+			IO::Path::Combine(MAKE_PATH("Meshes"), MAKE_PATH("Asset.nasset")),
+			IO::Path(MAKE_PATH("Asset.nasset"))
+		};
+		for (uint8 index = 0; index < 3; ++index)
+		{
+			database.RegisterAsset(
+				assetGuids[index],
+				Asset::DatabaseEntry{
+					typeGuid,
+					{},
+					IO::Path::Combine(rootDirectory, relativePaths[index]),
+					UnicodeString{},
+					UnicodeString{},
+					Asset::Guid{}
+				},
+				rootDirectory
+			);
+		}
+
+		Vector<ByteType> data;
+		EXPECT_TRUE(Asset::BinaryDatabase::Serialize(database, rootDirectory, data));
+		const Asset::BinaryDatabase binaryDatabase(data.GetView());
+		ASSERT_TRUE(binaryDatabase.IsValid());
+
+		// Same file names in different directories resolve to their own entries
+		for (uint8 index = 0; index < 3; ++index)
+		{
+			const Optional<const Asset::BinaryDatabase::Entry*> pEntry = binaryDatabase.FindEntryByPath(relativePaths[index]);
+			ASSERT_TRUE(pEntry.IsValid());
+			EXPECT_TRUE(pEntry->m_guid == assetGuids[index]);
+		}
+
+		EXPECT_FALSE(binaryDatabase.FindEntryByPath(IO::Path::Combine(MAKE_PATH("Audio"), MAKE_PATH("Asset.nasset"))).IsValid());
+		EXPECT_FALSE(binaryDatabase.FindEntryByPath(MAKE_PATH("Missing.nasset")).IsValid());
+	}
+
+	UNIT_TEST(BinaryAssetDatabase, RejectsOutOfRangeEntries)
+	{
+		const IO::Path rootDirectory(MAKE_PATH("Root"));
+		const Asset::Guid assetGuid = Asset::Guid::Generate();
+
+		Asset::Database database;
+		database.RegisterAsset(
+			assetGuid,
+			Asset::DatabaseEntry{
+				Asset::Guid::Generate(),
+				{},
+				IO::Path::Combine(rootDirectory, MAKE_PATH("Asset.nasset")),
+				UnicodeString(MAKE_UNICODE_LITERAL("Asset")),
+				UnicodeString{},
+				Asset::Guid{},
+				Array{Asset::Guid::Generate()}.GetDynamicView()
+			},
+			rootDirectory
+		);
+
+		Vector<ByteType> data;
+		EXPECT_TRUE(Asset::BinaryDatabase::Serialize(database, rootDirectory, data));
+		EXPECT_TRUE(Asset::BinaryDatabase(data.GetView()).IsValid());
+
+		const Asset::BinaryDatabase::Header& header = *reinterpret_cast<const Asset::BinaryDatabase::Header*>(data.GetData());
+		const auto getEntry = [&header](Vector<ByteType>& entryData) -> Asset::BinaryDatabase::Entry&
+		{
+			return *reinterpret_cast<Asset::BinaryDatabase::Entry*>(entryData.GetData() + header.m_entriesOffset);
+		};
+
+		// Strings extending past the string data section
+		{
+			Vector<ByteType> corruptedData(data);
+			getEntry(corruptedData).m_name.m_count = header.m_stringDataSize;
+			EXPECT_FALSE(Asset::BinaryDatabase(corruptedData.GetView()).IsValid());
+		}
+
+		{
+			Vector<ByteType> corruptedData(data);
+			getEntry(corruptedData).m_fileName.m_offset = Math::NumericLimits<uint32>::Max;
+			EXPECT_FALSE(Asset::BinaryDatabase(corruptedData.GetView()).IsValid());
+		}
+
+		// Guids outside of the guid section
+		{
+			Vector<ByteType> corruptedData(data);
+			getEntry(corruptedData).m_tags.m_count = header.m_guidCount + 1;
+			EXPECT_FALSE(Asset::BinaryDatabase(corruptedData.GetView()).IsValid());
+		}
+
+		{
+			Vector<ByteType> corruptedData(data);
+			getEntry(corruptedData).m_assetTypeGuidIndex = header.m_guidCount;
+			EXPECT_FALSE(Asset::BinaryDatabase(corruptedData.GetView()).IsValid());
+		}
+	}
+}
@@ -0,0 +1,100 @@
+#include "gtest/gtest.h"
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Engine/Entity/Scene/BinaryScene.h>
+
+#include <Common/Serialization/Deserialize.h>
+#include <Common/Serialization/Reader.h>
+#include <Common/Serialization/Guid.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(BinaryScene, FlattensHierarchyDepthFirst)
+	{
+		static constexpr ConstZeroTerminatedStringView sceneJson = R"({
+	"typeGuid": "{11111111-1111-1111-1111-111111111111}",
+	"data_components": [
+		{ "typeGuid": "{33333333-3333-3333-3333-333333333333}", "value": 1 }
+	],
+	"children": [
+		{
+			"typeGuid": "{22222222-2222-2222-2222-222222222222}",
+			"name": "first",
+			"children": [
+				{ "typeGuid": "{22222222-2222-2222-2222-222222222222}", "name": "nested" }
+			]
+		},
+		{ "typeGuid": "{44444444-4444-4444-4444-444444444444}", "name": "second" }
+	]
+})";
+
+		const Serialization::RootReader sceneSerializer = Serialization::GetReaderFromBuffer(sceneJson);
+		ASSERT_TRUE(sceneSerializer.GetData().IsValid());
+
+		Vector<ByteType> data;
+		EXPECT_TRUE(Entity::BinaryScene::Compile(sceneSerializer, data));
+
+		const Entity::BinaryScene binaryScene(data.GetView());
+		ASSERT_TRUE(binaryScene.IsValid());
+		EXPECT_EQ(binaryScene.GetTypes().GetSize(), 4u);
+
+		const ArrayView<const Entity::BinaryScene::Node, uint32> nodes = binaryScene.GetNodes();
+		ASSERT_EQ(nodes.GetSize(), 5u);
+
+		// Root, its data component, then children depth-first
+		EXPECT_EQ(nodes[0].m_parentIndex, Entity::BinaryScene::InvalidNodeIndex);
+		EXPECT_EQ(nodes[0].m_childCount, 2u);
+		EXPECT_TRUE(nodes[1].IsDataComponent());
+		EXPECT_EQ(nodes[1].m_parentIndex, 0u);
+		EXPECT_EQ(nodes[2].m_parentIndex, 0u);
+		EXPECT_EQ(nodes[2].m_childCount, 1u);
+		EXPECT_EQ(nodes[3].m_parentIndex, 2u);
+		EXPECT_EQ(nodes[4].m_parentIndex, 0u);
+		EXPECT_FALSE(nodes[4].IsDataComponent());
+
+		// Instances of the same type share one type entry and a contiguous property block
+		EXPECT_EQ(nodes[2].m_typeIndex, nodes[3].m_typeIndex);
+		const Entity::BinaryScene::Type& sharedType = binaryScene.GetTypes()[nodes[2].m_typeIndex];
+		EXPECT_EQ(sharedType.m_instanceCount, 2u);
+		EXPECT_GE(nodes[2].m_propertiesOffset, sharedType.m_propertyDataOffset);
+		EXPECT_LE(nodes[3].m_propertiesOffset + nodes[3].m_propertiesSize, sharedType.m_propertyDataOffset + sharedType.m_propertyDataSize);
+
+		// Flattened members are stripped from the stored properties
+		const Serialization::RootReader rootSerializer = Serialization::GetReaderFromBuffer(binaryScene.GetProperties(nodes[0]));
+		ASSERT_TRUE(rootSerializer.GetData().IsValid());
+		const Serialization::Reader rootReader = rootSerializer;
+		EXPECT_FALSE(rootReader.FindSerializer("children").IsValid());
+		EXPECT_FALSE(rootReader.FindSerializer("data_components").IsValid());
+
+		const Serialization::RootReader nestedSerializer = Serialization::GetReaderFromBuffer(binaryScene.GetProperties(nodes[3]));
+		const Serialization::Reader nestedReader = nestedSerializer;
+		EXPECT_EQ(nestedReader.ReadWithDefaultValue<Guid>("typeGuid", Guid{}), "{22222222-2222-2222-2222-222222222222}"_guid);
+
+		// All properties can be parsed at once, grouped by type and indexed per node
+		const Serialization::RootReader propertiesSerializer = Serialization::GetReaderFromBuffer(binaryScene.GetPropertyData());
+		ASSERT_TRUE(propertiesSerializer.GetData().IsValid());
+		Vector<Serialization::Reader, uint32> propertyReaders;
+		ASSERT_TRUE(binaryScene.GetPropertyReaders(propertiesSerializer, propertyReaders));
+		ASSERT_EQ(propertyReaders.GetSize(), nodes.GetSize());
+		EXPECT_EQ(nodes[3].m_propertiesIndex, nodes[2].m_propertiesIndex + 1);
+		EXPECT_TRUE(propertyReaders[nodes[2].m_propertiesIndex].ReadWithDefaultValue<ConstStringView>("name", {}) == ConstStringView("first"));
+		EXPECT_TRUE(propertyReaders[nodes[3].m_propertiesIndex].ReadWithDefaultValue<ConstStringView>("name", {}) == ConstStringView("nested"));
+		EXPECT_TRUE(propertyReaders[nodes[4].m_propertiesIndex].ReadWithDefaultValue<ConstStringView>("name", {}) == ConstStringView("second"));
+		EXPECT_EQ(
+			propertyReaders[nodes[1].m_propertiesIndex].ReadWithDefaultValue<Guid>("typeGuid", Guid{}),
+			"{33333333-3333-3333-3333-333333333333}"_guid
+		);
+		// The root is read from the same parsed array, so it is not parsed a second time on load
+		EXPECT_FALSE(propertyReaders[nodes[0].m_propertiesIndex].FindSerializer("children").IsValid());
+	}
+
+	UNIT_TEST(BinaryScene, RejectsInvalidData)
+	{
+		Vector<ByteType> data;
+		data.Resize(sizeof(Entity::BinaryScene::Header));
+		const Entity::BinaryScene binaryScene(data.GetView());
+		EXPECT_FALSE(binaryScene.IsValid());
+	}
+}
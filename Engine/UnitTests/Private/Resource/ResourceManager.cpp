@@ -0,0 +1,217 @@
+#include "gtest/gtest.h"
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Engine/Resource/ResourceManager.h>
+
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	//! Synthetic resource type that only records what the manager asked of it
+	struct TestResourceHandler final : public Resource::Handler
+	{
+		virtual void Unload(const Resource::Identifier identifier) override
+		{
+			m_unloadedResources.EmplaceBack(identifier);
+		}
+		virtual void Reload(const Resource::Identifier identifier) override
+		{
+			m_reloadedResources.EmplaceBack(identifier);
+		}
+
+		Vector<Resource::Identifier> m_unloadedResources;
+		Vector<Resource::Identifier> m_reloadedResources;
+	};
+
+	UNIT_TEST(ResourceManager, TracksUsage)
+	{
+		Resource::Manager manager;
+		TestResourceHandler handler;
+
+		const Resource::Identifier first = manager.Register(handler);
+		const Resource::Identifier second = manager.Register(handler);
+		EXPECT_TRUE(manager.OnLoaded(first, 100, 20));
+		EXPECT_TRUE(manager.OnLoaded(second, 50, 0));
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 150u);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::GPU), 20u);
+
+		manager.Deregister(first);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 50u);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::GPU), 0u);
+		EXPECT_TRUE(handler.m_unloadedResources.IsEmpty());
+	}
+
+	UNIT_TEST(ResourceManager, EvictsLowerPriorityWhenOverBudget)
+	{
+		Resource::Manager manager;
+		TestResourceHandler handler;
+		manager.SetBudget(Resource::MemoryType::CPU, 100);
+
+		const Resource::Identifier lowPriority = manager.Register(handler, 10);
+		const Resource::Identifier highPriority = manager.Register(handler, 1000);
+		EXPECT_TRUE(manager.OnLoaded(lowPriority, 60, 0));
+		EXPECT_TRUE(manager.OnLoaded(highPriority, 60, 0));
+
+		EXPECT_EQ(manager.GetState(lowPriority), Resource::Manager::Resource::State::Evicted);
+		EXPECT_TRUE(manager.IsLoaded(highPriority));
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 60u);
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 1u);
+		EXPECT_TRUE(handler.m_unloadedResources[0] == lowPriority);
+
+		// A less important resource can not push out a more important one
+		const Resource::Identifier otherLowPriority = manager.Register(handler, 10);
+		EXPECT_FALSE(manager.OnLoaded(otherLowPriority, 60, 0));
+		EXPECT_TRUE(manager.IsLoaded(highPriority));
+	}
+
+	UNIT_TEST(ResourceManager, AcquiredResourcesAreNotEvicted)
+	{
+		Resource::Manager manager;
+		TestResourceHandler handler;
+		manager.SetBudget(Resource::MemoryType::GPU, 100);
+
+		const Resource::Identifier pinned = manager.Register(handler, 1);
+		manager.Acquire(pinned);
+		EXPECT_TRUE(manager.OnLoaded(pinned, 0, 80));
+
+		const Resource::Identifier other = manager.Register(handler, 1000);
+		EXPECT_FALSE(manager.OnLoaded(other, 0, 80));
+		EXPECT_TRUE(manager.IsLoaded(pinned));
+
+		manager.Release(pinned);
+		manager.SetBudget(Resource::MemoryType::GPU, 100);
+		EXPECT_EQ(manager.GetState(pinned), Resource::Manager::Resource::State::Evicted);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::GPU), 80u);
+	}
+
+	UNIT_TEST(ResourceManager, PrefersUnusedDistantAndStaleResources)
+	{
+		Resource::Manager manager;
+		TestResourceHandler handler;
+
+		const Resource::Identifier unused = manager.Register(handler);
+		const Resource::Identifier distant = manager.Register(handler);
+		const Resource::Identifier stale = manager.Register(handler);
+		const Resource::Identifier recent = manager.Register(handler);
+		EXPECT_TRUE(manager.OnLoaded(unused, 10, 0));
+		EXPECT_TRUE(manager.OnLoaded(distant, 10, 0));
+		EXPECT_TRUE(manager.OnLoaded(stale, 10, 0));
+		EXPECT_TRUE(manager.OnLoaded(recent, 10, 0));
+
+		manager.MarkUnused(unused);
+		manager.SetDistance(distant, 1000.f);
+		for (uint32 frameIndex = 0; frameIndex < 30; ++frameIndex)
+		{
+			manager.AdvanceFrame();
+			manager.MarkUsed(distant);
+			manager.MarkUsed(recent);
+		}
+
+		manager.SetBudget(Resource::MemoryType::CPU, 30);
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 1u);
+		EXPECT_TRUE(handler.m_unloadedResources[0] == unused);
+
+		manager.SetBudget(Resource::MemoryType::CPU, 20);
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 2u);
+		EXPECT_TRUE(handler.m_unloadedResources[1] == distant);
+
+		manager.SetBudget(Resource::MemoryType::CPU, 10);
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 3u);
+		EXPECT_TRUE(handler.m_unloadedResources[2] == stale);
+		EXPECT_TRUE(manager.IsLoaded(recent));
+	}
+
+	UNIT_TEST(ResourceManager, GroupsAreEvictedAndReloadedTogether)
+	{
+		Resource::Manager manager;
+		TestResourceHandler handler;
+
+		const Resource::Identifier cpuData = manager.Register(handler);
+		const Resource::Identifier gpuData = manager.Register(handler);
+		const Resource::Identifier other = manager.Register(handler, 1000);
+		const Resource::GroupIdentifier group = manager.CreateGroup();
+		manager.AddToGroup(cpuData, group);
+		manager.AddToGroup(gpuData, group);
+
+		EXPECT_TRUE(manager.OnLoaded(cpuData, 40, 0));
+		EXPECT_TRUE(manager.OnLoaded(gpuData, 0, 40));
+		EXPECT_TRUE(manager.OnLoaded(other, 0, 40));
+
+		// Only the GPU budget is exceeded, but the whole group goes
+		manager.SetBudget(Resource::MemoryType::GPU, 50);
+		EXPECT_EQ(manager.GetState(cpuData), Resource::Manager::Resource::State::Evicted);
+		EXPECT_EQ(manager.GetState(gpuData), Resource::Manager::Resource::State::Evicted);
+		EXPECT_TRUE(manager.IsLoaded(other));
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 0u);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::GPU), 40u);
+
+		manager.MarkUsed(cpuData);
+		EXPECT_EQ(handler.m_reloadedResources.GetSize(), 2u);
+		EXPECT_EQ(manager.GetState(cpuData), Resource::Manager::Resource::State::Reloading);
+		EXPECT_EQ(manager.GetState(gpuData), Resource::Manager::Resource::State::Reloading);
+	}
+
+	//! Handler that undoes evictions of resources acquired while the eviction was on its way, as the mesh cache does
+	struct RestoringResourceHandler final : public Resource::Handler
+	{
+		RestoringResourceHandler(Resource::Manager& manager)
+			: m_manager(manager)
+		{
+		}
+
+		virtual void Unload(const Resource::Identifier identifier) override
+		{
+			if (m_manager.IsAcquired(identifier))
+			{
+				m_manager.OnLoaded(identifier, m_dataSize, 0);
+			}
+			else
+			{
+				m_unloadedResources.EmplaceBack(identifier);
+			}
+		}
+		virtual void Reload(const Resource::Identifier identifier) override
+		{
+			m_manager.OnLoaded(identifier, m_dataSize, 0);
+		}
+
+		Resource::Manager& m_manager;
+		size m_dataSize{60};
+		Vector<Resource::Identifier> m_unloadedResources;
+	};
+
+	UNIT_TEST(ResourceManager, HandlerRestoresAcquiredResourceOnUnload)
+	{
+		Resource::Manager manager;
+		RestoringResourceHandler handler(manager);
+
+		const Resource::Identifier resource = manager.Register(handler, 10);
+		EXPECT_TRUE(manager.OnLoaded(resource, 60, 0));
+		EXPECT_FALSE(manager.IsAcquired(resource));
+
+		// Evicted without being pinned
+		manager.SetBudget(Resource::MemoryType::CPU, 50);
+		EXPECT_EQ(manager.GetState(resource), Resource::Manager::Resource::State::Evicted);
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 1u);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 0u);
+
+		// Using it again reloads it through the handler
+		manager.SetBudget(Resource::MemoryType::CPU, 100);
+		manager.MarkUsed(resource);
+		EXPECT_TRUE(manager.IsLoaded(resource));
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 60u);
+
+		// A reader acquiring the resource after it was selected for eviction keeps it loaded
+		manager.Acquire(resource);
+		EXPECT_TRUE(manager.IsAcquired(resource));
+		handler.Unload(resource);
+		EXPECT_TRUE(manager.IsLoaded(resource));
+		EXPECT_EQ(handler.m_unloadedResources.GetSize(), 1u);
+		EXPECT_EQ(manager.GetUsage(Resource::MemoryType::CPU), 60u);
+
+		manager.Release(resource);
+		EXPECT_FALSE(manager.IsAcquired(resource));
+		manager.Deregister(resource);
+	}
+}
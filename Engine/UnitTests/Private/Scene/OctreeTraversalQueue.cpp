@@ -0,0 +1,148 @@
+#include "gtest/gtest.h"
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Engine/Scene/Queries/OctreeTraversalQueue.h>
+
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	//! Deterministic pseudo random distances, including duplicates
+	[[nodiscard]] static Vector<float> CreateDistances(const uint32 count)
+	{
+		Vector<float> distances(Memory::Reserve, count);
+		uint32 state = 0x2545F491u;
+		for (uint32 index = 0; index < count; ++index)
+		{
+			state = state * 1664525u + 1013904223u;
+			distances.EmplaceBack((float)((state >> 8u) % 1000u) * 0.25f);
+		}
+		return distances;
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, PopsNearestFirst)
+	{
+		const Vector<float> distances = CreateDistances(512);
+
+		SceneQueries::OctreeTraversalQueue queue;
+		for (const float distance : distances)
+		{
+			queue.Push(SceneQueries::OctreeTraversalQueue::Entry{distance, Invalid, Invalid});
+		}
+
+		float previousDistance = 0.f;
+		uint32 poppedCount = 0;
+		while (!queue.IsEmpty())
+		{
+			const float nearestDistance = queue.GetNearestDistance();
+			const SceneQueries::OctreeTraversalQueue::Entry entry = queue.Pop();
+			EXPECT_EQ(entry.m_distance, nearestDistance);
+			EXPECT_GE(entry.m_distance, previousDistance);
+			previousDistance = entry.m_distance;
+			poppedCount++;
+		}
+		EXPECT_EQ(poppedCount, distances.GetSize());
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, BoundedNearestQueueKeepsNearest)
+	{
+		const Vector<float> distances = CreateDistances(2048);
+		constexpr uint32 capacity = 16;
+
+		SceneQueries::TBoundedNearestQueue<uint32> queue(capacity);
+		for (uint32 index = 0; index < distances.GetSize(); ++index)
+		{
+			queue.TryPush(index, distances[index]);
+			// Never grows past k
+			EXPECT_LE(queue.GetSize(), capacity);
+		}
+		EXPECT_TRUE(queue.IsFull());
+
+		// Brute force reference: the k'th smallest distance
+		Vector<float> sortedDistances = distances;
+		for (uint32 index = 1; index < sortedDistances.GetSize(); ++index)
+		{
+			const float distance = sortedDistances[index];
+			uint32 insertIndex = index;
+			for (; insertIndex > 0 && sortedDistances[insertIndex - 1] > distance; --insertIndex)
+			{
+				sortedDistances[insertIndex] = sortedDistances[insertIndex - 1];
+			}
+			sortedDistances[insertIndex] = distance;
+		}
+		EXPECT_EQ(queue.GetAcceptedDistance(1000.f), sortedDistances[capacity - 1]);
+
+		const ArrayView<const SceneQueries::TBoundedNearestQueue<uint32>::Entry> entries = queue.SortNearestFirst();
+		ASSERT_EQ(entries.GetSize(), capacity);
+		for (uint32 index = 0; index < capacity; ++index)
+		{
+			EXPECT_EQ(entries[index].m_distance, sortedDistances[index]);
+			EXPECT_EQ(distances[entries[index].m_element], entries[index].m_distance);
+		}
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, BoundedNearestQueueAcceptedDistance)
+	{
+		SceneQueries::TBoundedNearestQueue<uint32> queue(2);
+		// Until full, anything within the query's maximum distance is accepted
+		EXPECT_EQ(queue.GetAcceptedDistance(100.f), 100.f);
+		EXPECT_TRUE(queue.TryPush(0, 50.f));
+		EXPECT_EQ(queue.GetAcceptedDistance(100.f), 100.f);
+		EXPECT_TRUE(queue.TryPush(1, 10.f));
+		EXPECT_EQ(queue.GetAcceptedDistance(100.f), 50.f);
+
+		// Farther candidates are rejected, nearer ones replace the farthest
+		EXPECT_FALSE(queue.TryPush(2, 60.f));
+		EXPECT_TRUE(queue.TryPush(3, 20.f));
+		EXPECT_EQ(queue.GetAcceptedDistance(100.f), 20.f);
+
+		const ArrayView<const SceneQueries::TBoundedNearestQueue<uint32>::Entry> entries = queue.SortNearestFirst();
+		ASSERT_EQ(entries.GetSize(), 2u);
+		EXPECT_EQ(entries[0].m_element, 1u);
+		EXPECT_EQ(entries[1].m_element, 3u);
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, BoundedNearestQueueZeroCapacity)
+	{
+		SceneQueries::TBoundedNearestQueue<uint32> queue(0);
+		EXPECT_FALSE(queue.TryPush(0, 1.f));
+		EXPECT_TRUE(queue.IsEmpty());
+		EXPECT_EQ(queue.GetAcceptedDistance(5.f), 5.f);
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, SquaredDistance)
+	{
+		const Math::WorldBoundingBox box{Math::WorldCoordinate{-1.f, -1.f, -1.f}, Math::WorldCoordinate{1.f, 1.f, 1.f}};
+		EXPECT_EQ(SceneQueries::OctreeTraversalQueue::GetSquaredDistance(box, Math::WorldCoordinate{0.f, 0.f, 0.f}), 0.f);
+		EXPECT_EQ(SceneQueries::OctreeTraversalQueue::GetSquaredDistance(box, Math::WorldCoordinate{3.f, 0.f, 0.f}), 4.f);
+		EXPECT_EQ(SceneQueries::OctreeTraversalQueue::GetSquaredDistance(box, Math::WorldCoordinate{3.f, -4.f, 1.f}), 13.f);
+	}
+
+	UNIT_TEST(OctreeTraversalQueue, RayEntryDistance)
+	{
+		const Math::WorldBoundingBox box{Math::WorldCoordinate{4.f, -1.f, -1.f}, Math::WorldCoordinate{6.f, 1.f, 1.f}};
+		const Math::WorldCoordinate origin{0.f, 0.f, 0.f};
+
+		const Optional<float> hitDistance =
+			SceneQueries::OctreeTraversalQueue::GetRayEntryDistance(box, origin, Math::Vector3f{1.f, 0.f, 0.f}, 100.f, 0.f);
+		ASSERT_TRUE(hitDistance.IsValid());
+		EXPECT_NEAR(*hitDistance, 4.f, 0.0001f);
+
+		// Segment ends before the box
+		EXPECT_FALSE(SceneQueries::OctreeTraversalQueue::GetRayEntryDistance(box, origin, Math::Vector3f{1.f, 0.f, 0.f}, 3.f, 0.f).IsValid());
+		// Pointing away
+		EXPECT_FALSE(SceneQueries::OctreeTraversalQueue::GetRayEntryDistance(box, origin, Math::Vector3f{-1.f, 0.f, 0.f}, 100.f, 0.f).IsValid()
+		);
+
+		// Passes beside the box, only the swept sphere touches it
+		const Math::WorldCoordinate offsetOrigin{0.f, 1.5f, 0.f};
+		EXPECT_FALSE(
+			SceneQueries::OctreeTraversalQueue::GetRayEntryDistance(box, offsetOrigin, Math::Vector3f{1.f, 0.f, 0.f}, 100.f, 0.f).IsValid()
+		);
+		const Optional<float> sweptDistance =
+			SceneQueries::OctreeTraversalQueue::GetRayEntryDistance(box, offsetOrigin, Math::Vector3f{1.f, 0.f, 0.f}, 100.f, 1.f);
+		ASSERT_TRUE(sweptDistance.IsValid());
+		EXPECT_NEAR(*sweptDistance, 3.f, 0.0001f);
+	}
+}
@@ -0,0 +1,160 @@
+#include "gtest/gtest.h"
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Engine/Scripting/ScriptCache.h>
+#include <Engine/Scripting/Compiler/Compiler.h>
+#include <Engine/Scripting/Compiler/Object.h>
+#include <Engine/Asset/AssetManager.h>
+#include <Engine/Tag/TagRegistry.h>
+#include <Engine/DataSource/DataSourceCache.h>
+
+#include <Common/Memory/New.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Reflection/Registry.h>
+#include <Common/IO/Path.h>
+#include <Common/IO/Log.h>
+
+namespace ngine::Tests
+{
+	struct ScriptCacheSystems
+	{
+		ScriptCacheSystems()
+		{
+			System::Get<Log>().Open(IO::Path());
+
+			System::Query::GetInstance().RegisterSystem(m_reflectionRegistry);
+		}
+		~ScriptCacheSystems()
+		{
+			System::Get<Log>().Close();
+			System::Query::GetInstance().DeregisterSystem<Reflection::Registry>();
+			m_assetManager.DestroyElement();
+		}
+	protected:
+		Reflection::Registry m_reflectionRegistry{Reflection::Registry::Initializer::Initialize};
+		DataSource::Cache m_dataSourceCache;
+		Tag::Registry m_tagRegistry;
+		UniquePtr<Asset::Manager> m_assetManager{UniquePtr<Asset::Manager>::Make()};
+	public:
+		Scripting::ScriptCache m_scriptCache{*m_assetManager};
+	};
+
+	//! Creates saved bytecode with the specified compilation header and body
+	[[nodiscard]] static Vector<ByteType> CreateBytecode(const ByteType headerValue, const ArrayView<const ByteType> body)
+	{
+		Vector<ByteType> bytecode(Memory::ConstructWithSize, Memory::Uninitialized, Scripting::Compiler::HeaderSize + body.GetSize());
+		for (uint32 index = 0; index < Scripting::Compiler::HeaderSize; ++index)
+		{
+			bytecode[index] = headerValue;
+		}
+		for (uint32 index = 0; index < body.GetSize(); ++index)
+		{
+			bytecode[Scripting::Compiler::HeaderSize + index] = body[index];
+		}
+		return bytecode;
+	}
+
+	UNIT_TEST(Scripting, SharedFunctionDeduplication)
+	{
+		ScriptCacheSystems systems;
+		Scripting::ScriptCache& scriptCache = systems.m_scriptCache;
+
+		const Array<ByteType, 3> body{ByteType(1), ByteType(2), ByteType(3)};
+		const Vector<ByteType> bytecode = CreateBytecode(ByteType(0x10), body.GetView());
+		// Identical functions compiled at another time only differ in their header
+		const Vector<ByteType> recompiledBytecode = CreateBytecode(ByteType(0x20), body.GetView());
+		EXPECT_EQ(Scripting::ScriptCache::GetBytecodeHash(bytecode.GetView()), Scripting::ScriptCache::GetBytecodeHash(recompiledBytecode.GetView()));
+		EXPECT_TRUE(scriptCache.FindSharedFunction(bytecode.GetView()).IsInvalid());
+
+		UniquePtr<Scripting::FunctionObject> pFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		const Scripting::FunctionObject* pFunctionObject = pFunction.Get();
+		const Optional<const Scripting::FunctionObject*> pSharedFunction = scriptCache.FindOrAddSharedFunction(bytecode.GetView(), pFunction);
+		EXPECT_TRUE(pSharedFunction.Get() == pFunctionObject);
+		// The cache took ownership
+		EXPECT_TRUE(pFunction.IsInvalid());
+
+		EXPECT_TRUE(scriptCache.FindSharedFunction(recompiledBytecode.GetView()).Get() == pFunctionObject);
+
+		// Adding an identical function returns the existing copy and leaves the duplicate with the caller
+		UniquePtr<Scripting::FunctionObject> pDuplicateFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		EXPECT_TRUE(scriptCache.FindOrAddSharedFunction(recompiledBytecode.GetView(), pDuplicateFunction).Get() == pFunctionObject);
+		EXPECT_TRUE(pDuplicateFunction.IsValid());
+
+		const Array<ByteType, 3> otherBody{ByteType(1), ByteType(2), ByteType(4)};
+		const Vector<ByteType> otherBytecode = CreateBytecode(ByteType(0x10), otherBody.GetView());
+		EXPECT_TRUE(scriptCache.FindSharedFunction(otherBytecode.GetView()).IsInvalid());
+	}
+
+	UNIT_TEST(Scripting, SharedFunctionHashCollision)
+	{
+		ScriptCacheSystems systems;
+		Scripting::ScriptCache& scriptCache = systems.m_scriptCache;
+
+		const Array<ByteType, 3> body{ByteType(1), ByteType(2), ByteType(3)};
+		const Array<ByteType, 4> collidingBody{ByteType(5), ByteType(6), ByteType(7), ByteType(8)};
+		const Vector<ByteType> bytecode = CreateBytecode(ByteType(0), body.GetView());
+		const Vector<ByteType> collidingBytecode = CreateBytecode(ByteType(0), collidingBody.GetView());
+		constexpr size hash = 1337;
+
+		UniquePtr<Scripting::FunctionObject> pFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		pFunction->arity = 2;
+		const Scripting::FunctionObject* pFunctionObject = pFunction.Get();
+		EXPECT_TRUE(scriptCache.FindOrAddSharedFunction(bytecode.GetView(), hash, pFunction).Get() == pFunctionObject);
+
+		// Different bytecode with the same hash is neither found nor shared, and its function stays owned by the caller
+		EXPECT_TRUE(scriptCache.FindSharedFunction(collidingBytecode.GetView(), hash).IsInvalid());
+		UniquePtr<Scripting::FunctionObject> pCollidingFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		pCollidingFunction->arity = 3;
+		EXPECT_TRUE(scriptCache.FindOrAddSharedFunction(collidingBytecode.GetView(), hash, pCollidingFunction).IsInvalid());
+		ASSERT_TRUE(pCollidingFunction.IsValid());
+		EXPECT_EQ(pCollidingFunction->arity, 3);
+
+		// The function shared first is never replaced, so references handed out before remain valid
+		const Optional<const Scripting::FunctionObject*> pSharedFunction = scriptCache.FindSharedFunction(bytecode.GetView(), hash);
+		ASSERT_TRUE(pSharedFunction.Get() == pFunctionObject);
+		EXPECT_EQ(pSharedFunction->arity, 2);
+		EXPECT_EQ(pFunctionObject->arity, 2);
+	}
+
+	UNIT_TEST(Scripting, SharedFunctionReleasedAfterReload)
+	{
+		ScriptCacheSystems systems;
+		Scripting::ScriptCache& scriptCache = systems.m_scriptCache;
+
+		const Array<ByteType, 3> body{ByteType(1), ByteType(2), ByteType(3)};
+		const Vector<ByteType> bytecode = CreateBytecode(ByteType(0x10), body.GetView());
+		const size hash = Scripting::ScriptCache::GetBytecodeHash(bytecode.GetView());
+
+		// Two scripts load the same function
+		UniquePtr<Scripting::FunctionObject> pFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		const Scripting::FunctionObject* pFunctionObject = pFunction.Get();
+		EXPECT_TRUE(scriptCache.FindOrAddSharedFunction(bytecode.GetView(), hash, pFunction).Get() == pFunctionObject);
+		EXPECT_TRUE(scriptCache.AcquireSharedFunction(bytecode.GetView(), hash).Get() == pFunctionObject);
+
+		// Reloading unchanged bytecode acquires the new reference before releasing the previous one, keeping the function
+		EXPECT_TRUE(scriptCache.AcquireSharedFunction(bytecode.GetView(), hash).Get() == pFunctionObject);
+		scriptCache.ReleaseSharedFunction(hash);
+		EXPECT_TRUE(scriptCache.FindSharedFunction(bytecode.GetView(), hash).Get() == pFunctionObject);
+
+		// Reloading with modified bytecode shares the new function and releases the old one
+		const Array<ByteType, 3> modifiedBody{ByteType(1), ByteType(2), ByteType(4)};
+		const Vector<ByteType> modifiedBytecode = CreateBytecode(ByteType(0x20), modifiedBody.GetView());
+		const size modifiedHash = Scripting::ScriptCache::GetBytecodeHash(modifiedBytecode.GetView());
+		UniquePtr<Scripting::FunctionObject> pModifiedFunction = UniquePtr<Scripting::FunctionObject>::Make();
+		const Scripting::FunctionObject* pModifiedFunctionObject = pModifiedFunction.Get();
+		EXPECT_TRUE(scriptCache.FindOrAddSharedFunction(modifiedBytecode.GetView(), modifiedHash, pModifiedFunction).Get() == pModifiedFunctionObject);
+		scriptCache.ReleaseSharedFunction(hash);
+		// Still referenced by the other script
+		EXPECT_TRUE(scriptCache.FindSharedFunction(bytecode.GetView(), hash).Get() == pFunctionObject);
+
+		// Unloading the other script drops the last reference
+		scriptCache.ReleaseSharedFunction(hash);
+		EXPECT_TRUE(scriptCache.FindSharedFunction(bytecode.GetView(), hash).IsInvalid());
+		EXPECT_TRUE(scriptCache.FindSharedFunction(modifiedBytecode.GetView(), modifiedHash).Get() == pModifiedFunctionObject);
+
+		scriptCache.ReleaseSharedFunction(modifiedHash);
+		EXPECT_TRUE(scriptCache.FindSharedFunction(modifiedBytecode.GetView(), modifiedHash).IsInvalid());
+	}
+}
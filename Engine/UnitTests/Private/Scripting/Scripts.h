@@ -181,6 +181,25 @@ namespace ngine
 		local tag_id: tag = { "7568a6d8-f91e-4e4a-aee2-329d630ba249" };
 	)");
 
+	constexpr Scripting::StringType::ConstView ScriptSourceSuperinstructions = SCRIPT_STRING_LITERAL(R"(
+		local sum = 0
+		local i = 0
+		while i < 10 do
+			sum = sum + i
+			i = i + 1
+		end
+		assert(sum == 45 and i == 10)
+
+		local x, y = 1.5, 2.0
+		assert(x + y == 3.5)
+		assert(y - x == 0.5)
+		assert(x * y + 0.5 == 3.5)
+		assert(x + 1.0 == 2.5)
+		if x > y then
+			assert(false)
+		end
+	)");
+
 	constexpr Scripting::StringType::ConstView ScriptSourceMath = SCRIPT_STRING_LITERAL(R"(
 		assert(abs(-1.0) == 1.0)
 		assert(abs(1.0) == 1.0)
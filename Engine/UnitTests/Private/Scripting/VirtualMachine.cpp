@@ -12,6 +12,7 @@
 #include <Engine/Scripting/Parser/AST/Statement.h>
 #include <Engine/Scripting/Parser/AST/Expression.h>
 #include <Engine/Scripting/Compiler/Compiler.h>
+#include <Engine/Scripting/Compiler/Opcode.h>
 #include <Engine/Scripting/VirtualMachine/VirtualMachine.h>
 #include <Common/Scripting/VirtualMachine/DynamicFunction/DynamicDelegate.h>
 #include <Engine/Asset/AssetManager.h>
@@ -216,6 +217,40 @@ namespace ngine::Tests
 		}
 	}
 
+	UNIT_TEST(Scripting, GrowingStackInvokeExecute)
+	{
+		Systems systems;
+
+		constexpr Scripting::StringType::ConstView ScriptSourceRecursiveSum = SCRIPT_STRING_LITERAL(R"(
+			function sum(n: integer): integer
+				if n == 0 then
+					return 0
+				else
+					return n + sum(n - 1)
+				end
+			end
+		)");
+
+		UniquePtr<Scripting::FunctionObject> pScript = Compile(ScriptSourceRecursiveSum);
+
+		UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+		pVm->Initialize(*pScript);
+		EXPECT_TRUE(pVm->Execute());
+
+		const Scripting::VirtualMachine::GlobalMapType& globals = pVm->GetGlobals();
+		const auto functionIt = globals.Find(Scripting::Token::GuidFromScriptString("sum"));
+		ASSERT_TRUE(functionIt != globals.end());
+		Scripting::ClosureObject* pFunction = Scripting::AsClosureObject(functionIt->second.GetObject());
+		ASSERT_TRUE(pFunction != nullptr);
+
+		// Recurse deeper than the initial execution stack to force it to grow while frames are active
+		constexpr Scripting::IntegerType depth = Scripting::VirtualMachine::InitialStackSize / Scripting::VirtualMachine::MaxFrameStackSize * 8;
+		static_assert(depth < Scripting::VirtualMachine::MaxCallStackSize);
+		Array<Scripting::RawValue, 1> results;
+		EXPECT_TRUE(pVm->Invoke(*pFunction, Array<Scripting::RawValue, 1>{Scripting::RawValue{depth}}, results.GetView()));
+		EXPECT_EQ(results[0].GetInteger(), depth * (depth + 1) / 2);
+	}
+
 	UNIT_TEST(Scripting, FibonacciResetExecute)
 	{
 		Systems systems;
@@ -286,6 +321,169 @@ namespace ngine::Tests
 		EXPECT_TRUE(Execute(ScriptSourceMath));
 	}
 
+	UNIT_TEST(Scripting, SuperinstructionsExecute)
+	{
+		Systems systems;
+
+		{
+			UniquePtr<Scripting::FunctionObject> pScript = Compile(ScriptSourceSuperinstructions);
+			ASSERT_TRUE(pScript.IsValid());
+			EXPECT_TRUE(pScript->chunk.code.GetView().Contains(uint8(Scripting::OpCode::LessIntegerJumpIfFalse)));
+
+			UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+			pVm->Initialize(*pScript);
+			EXPECT_TRUE(pVm->Execute());
+		}
+
+		// Loop condition and local + immediate increments
+		{
+			constexpr Scripting::StringType::ConstView ScriptSourceSumTo = SCRIPT_STRING_LITERAL(R"(
+				function sum_to(n: integer): integer
+					local sum = 0
+					local i = 0
+					while i < n do
+						sum = sum + i
+						i = i + 1
+					end
+					return sum
+				end
+			)");
+
+			UniquePtr<Scripting::FunctionObject> pScript = CompileStandaloneFunction(ScriptSourceSumTo, "sum_to");
+			ASSERT_TRUE(pScript.IsValid());
+			EXPECT_TRUE(pScript->chunk.code.GetView().Contains(uint8(Scripting::OpCode::LessIntegerJumpIfFalse)));
+			EXPECT_TRUE(pScript->chunk.code.GetView().Contains(uint8(Scripting::OpCode::PushLocalPushImmediateAddInteger)));
+
+			UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+			pVm->Initialize(*pScript);
+
+			Array<Scripting::RawValue, 1> results;
+			EXPECT_TRUE(pVm->Execute(Array<Scripting::RawValue, 1>{Scripting::RawValue{Scripting::IntegerType(10)}}, results));
+			EXPECT_EQ(results[0].GetInteger(), 45);
+			EXPECT_TRUE(pVm->Execute(Array<Scripting::RawValue, 1>{Scripting::RawValue{Scripting::IntegerType(0)}}, results));
+			EXPECT_EQ(results[0].GetInteger(), 0);
+		}
+
+		// Float arithmetic on locals and constants
+		{
+			constexpr Scripting::StringType::ConstView ScriptSourceFloatOperations = SCRIPT_STRING_LITERAL(R"(
+				function float_operations(x: float, y: float, z: float)
+					return x + y, y - x, x * y, z + x * 2.0, x + 1.0
+				end
+			)");
+
+			UniquePtr<Scripting::FunctionObject> pScript = CompileStandaloneFunction(ScriptSourceFloatOperations, "float_operations");
+			ASSERT_TRUE(pScript.IsValid());
+			const auto code = pScript->chunk.code.GetView();
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::PushLocalPushLocalAddFloat)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::PushLocalPushLocalSubtractFloat)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::PushLocalPushLocalMultiplyFloat)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::MultiplyAddFloat)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::PushLocalPushConstantAddFloat)));
+
+			UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+			pVm->Initialize(*pScript);
+
+			Array<Scripting::RawValue, 5> results;
+			EXPECT_TRUE(pVm->Execute(
+				Array<Scripting::RawValue, 3>{
+					Scripting::RawValue{Scripting::FloatType(1.5f)},
+					Scripting::RawValue{Scripting::FloatType(2.f)},
+					Scripting::RawValue{Scripting::FloatType(0.25f)}
+				},
+				results
+			));
+			EXPECT_FLOAT_EQ(results[0].GetDecimal(), 3.5f);
+			EXPECT_FLOAT_EQ(results[1].GetDecimal(), 0.5f);
+			EXPECT_FLOAT_EQ(results[2].GetDecimal(), 3.f);
+			EXPECT_FLOAT_EQ(results[3].GetDecimal(), 3.25f);
+			EXPECT_FLOAT_EQ(results[4].GetDecimal(), 2.5f);
+		}
+
+		// Every fused comparison takes both its branches
+		{
+			constexpr Scripting::StringType::ConstView ScriptSourceCompareIntegers = SCRIPT_STRING_LITERAL(R"(
+				function compare_integers(a: integer, b: integer)
+					local less, less_equal, greater, greater_equal, equal, not_equal = 0, 0, 0, 0, 0, 0
+					if a < b then less = 1 end
+					if a <= b then less_equal = 1 end
+					if a > b then greater = 1 end
+					if a >= b then greater_equal = 1 end
+					if a == b then equal = 1 end
+					if a ~= b then not_equal = 1 end
+					return less, less_equal, greater, greater_equal, equal, not_equal
+				end
+			)");
+
+			UniquePtr<Scripting::FunctionObject> pScript = CompileStandaloneFunction(ScriptSourceCompareIntegers, "compare_integers");
+			ASSERT_TRUE(pScript.IsValid());
+			const auto code = pScript->chunk.code.GetView();
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::LessIntegerJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::LessEqualIntegerJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::GreaterIntegerJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::GreaterEqualIntegerJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::EqualEqualIntegerJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::NotEqualIntegerJumpIfFalse)));
+
+			UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+			pVm->Initialize(*pScript);
+
+			const auto expectComparison =
+				[&pVm](const Scripting::IntegerType a, const Scripting::IntegerType b, const Array<Scripting::IntegerType, 6> expectedResults)
+			{
+				Array<Scripting::RawValue, 6> results;
+				EXPECT_TRUE(pVm->Execute(Array<Scripting::RawValue, 2>{Scripting::RawValue{a}, Scripting::RawValue{b}}, results));
+				for (uint8 index = 0; index < 6; ++index)
+				{
+					EXPECT_EQ(results[index].GetInteger(), expectedResults[index]);
+				}
+			};
+
+			expectComparison(1, 2, Array<Scripting::IntegerType, 6>{1, 1, 0, 0, 0, 1});
+			expectComparison(2, 2, Array<Scripting::IntegerType, 6>{0, 1, 0, 1, 1, 0});
+			expectComparison(3, 2, Array<Scripting::IntegerType, 6>{0, 0, 1, 1, 0, 1});
+		}
+
+		{
+			constexpr Scripting::StringType::ConstView ScriptSourceCompareFloats = SCRIPT_STRING_LITERAL(R"(
+				function compare_floats(a: float, b: float)
+					local less, less_equal, greater, greater_equal = 0, 0, 0, 0
+					if a < b then less = 1 end
+					if a <= b then less_equal = 1 end
+					if a > b then greater = 1 end
+					if a >= b then greater_equal = 1 end
+					return less, less_equal, greater, greater_equal
+				end
+			)");
+
+			UniquePtr<Scripting::FunctionObject> pScript = CompileStandaloneFunction(ScriptSourceCompareFloats, "compare_floats");
+			ASSERT_TRUE(pScript.IsValid());
+			const auto code = pScript->chunk.code.GetView();
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::LessFloatJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::LessEqualFloatJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::GreaterFloatJumpIfFalse)));
+			EXPECT_TRUE(code.Contains(uint8(Scripting::OpCode::GreaterEqualFloatJumpIfFalse)));
+
+			UniquePtr<Scripting::VirtualMachine> pVm = UniquePtr<Scripting::VirtualMachine>::Make();
+			pVm->Initialize(*pScript);
+
+			const auto expectComparison =
+				[&pVm](const Scripting::FloatType a, const Scripting::FloatType b, const Array<Scripting::IntegerType, 4> expectedResults)
+			{
+				Array<Scripting::RawValue, 4> results;
+				EXPECT_TRUE(pVm->Execute(Array<Scripting::RawValue, 2>{Scripting::RawValue{a}, Scripting::RawValue{b}}, results));
+				for (uint8 index = 0; index < 4; ++index)
+				{
+					EXPECT_EQ(results[index].GetInteger(), expectedResults[index]);
+				}
+			};
+
+			expectComparison(1.5f, 2.f, Array<Scripting::IntegerType, 4>{1, 1, 0, 0});
+			expectComparison(2.f, 2.f, Array<Scripting::IntegerType, 4>{0, 1, 0, 1});
+			expectComparison(2.5f, 2.f, Array<Scripting::IntegerType, 4>{0, 0, 1, 1});
+		}
+	}
+
 	UNIT_TEST(Scripting, StandaloneDelegateExecuteArgs)
 	{
 		Systems systems;
@@ -22,6 +22,7 @@
 #include <Renderer/Assets/StaticMesh/VertexNormals.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexTextureCoordinate.h>
+#include <Renderer/Assets/StaticMesh/RenderVertexLayout.h>
 #include <Renderer/Assets/Texture/TextureAsset.h>
 #include <Renderer/Assets/Texture/RenderTargetAsset.h>
 #include <Renderer/Renderer.h>
@@ -31,6 +32,7 @@
 #include <Renderer/Scene/InstanceBuffer.h>
 #include <Renderer/Devices/LogicalDevice.h>
 #include <Renderer/Commands/RenderCommandEncoderView.h>
+#include <Renderer/Buffers/IndirectBuffer.h>
 #include <Renderer/Pipelines/PushConstantRange.h>
 
 #include <Renderer/Vulkan/Includes.h>
@@ -203,6 +205,7 @@ namespace ngine::Rendering
 
 	void RenderMaterial::Destroy(LogicalDevice& logicalDevice)
 	{
+		m_fullPrecisionTextureCoordinatesPipeline.Destroy(logicalDevice);
 		GraphicsPipeline::Destroy(logicalDevice);
 		DescriptorSetLayout::Destroy(logicalDevice);
 
@@ -218,6 +221,12 @@ namespace ngine::Rendering
 		);
 	}
 
+	void RenderMaterial::PrepareForResize(const LogicalDeviceView logicalDevice)
+	{
+		m_fullPrecisionTextureCoordinatesPipeline.PrepareForResize(logicalDevice);
+		GraphicsPipeline::PrepareForResize(logicalDevice);
+	}
+
 	Threading::JobBatch RenderMaterial::CreatePipeline(
 		LogicalDevice& logicalDevice,
 		ShaderCache& shaderCache,
@@ -236,6 +245,8 @@ namespace ngine::Rendering
 
 		uint8 bindingIndex = 0;
 		uint8 shaderIndex = 0;
+		uint8 textureCoordinatesBindingDescriptionIndex = 0;
+		uint8 textureCoordinatesAttributeDescriptionIndex = 0;
 		for (const MaterialAsset::VertexAttributes vertexAttribute : vertexAttributes)
 		{
 			switch (vertexAttribute)
@@ -263,13 +274,20 @@ namespace ngine::Rendering
 					});
 					break;
 				case MaterialAsset::VertexAttributes::TextureCoordinates:
-					vertexInputBindingDescriptions.EmplaceBack(
-						VertexInputBindingDescription{bindingIndex, sizeof(VertexTextureCoordinate), VertexInputRate::Vertex}
-					);
+					textureCoordinatesBindingDescriptionIndex = vertexInputBindingDescriptions.GetSize();
+					vertexInputBindingDescriptions.EmplaceBack(VertexInputBindingDescription{
+						bindingIndex,
+						RenderVertexLayout::GetTextureCoordinateSize(TextureCoordinateFormat::Half),
+						VertexInputRate::Vertex
+					});
 
-					vertexInputAttributeDescriptions.EmplaceBack(
-						VertexInputAttributeDescription{shaderIndex++, bindingIndex, Format::R32G32_SFLOAT, 0}
-					);
+					textureCoordinatesAttributeDescriptionIndex = vertexInputAttributeDescriptions.GetSize();
+					vertexInputAttributeDescriptions.EmplaceBack(VertexInputAttributeDescription{
+						shaderIndex++,
+						bindingIndex,
+						RenderVertexLayout::GetTextureCoordinateVertexFormat(TextureCoordinateFormat::Half),
+						0
+					});
 					break;
 				case MaterialAsset::VertexAttributes::InstanceIdentifier:
 					vertexInputBindingDescriptions.EmplaceBack(
@@ -284,12 +302,31 @@ namespace ngine::Rendering
 			bindingIndex++;
 		}
 
+		// Meshes choose their texture coordinate format, so materials reading them need a variant for full precision coordinates
+		const bool usesTextureCoordinates = vertexAttributes.IsSet(MaterialAsset::VertexAttributes::TextureCoordinates);
+		InlineVector<VertexInputBindingDescription, (uint8)MaterialAsset::VertexAttributes::Count> fullPrecisionVertexInputBindingDescriptions;
+		InlineVector<VertexInputAttributeDescription, (uint8)MaterialAsset::VertexAttributes::Count * 2> fullPrecisionVertexInputAttributeDescriptions;
+		if (usesTextureCoordinates)
+		{
+			fullPrecisionVertexInputBindingDescriptions.CopyEmplaceRangeBack(vertexInputBindingDescriptions.GetView());
+			fullPrecisionVertexInputAttributeDescriptions.CopyEmplaceRangeBack(vertexInputAttributeDescriptions.GetView());
+			fullPrecisionVertexInputBindingDescriptions[textureCoordinatesBindingDescriptionIndex].stride =
+				RenderVertexLayout::GetTextureCoordinateSize(TextureCoordinateFormat::Full);
+			fullPrecisionVertexInputAttributeDescriptions[textureCoordinatesAttributeDescriptionIndex].format =
+				RenderVertexLayout::GetTextureCoordinateVertexFormat(TextureCoordinateFormat::Full);
+		}
+
 		struct PipelineInfo
 		{
 			InlineVector<VertexInputBindingDescription, (uint8)MaterialAsset::VertexAttributes::Count> m_vertexInputBindingDescriptions;
 			InlineVector<VertexInputAttributeDescription, (uint8)MaterialAsset::VertexAttributes::Count * 2> m_vertexInputAttributeDescriptions;
+			InlineVector<VertexInputBindingDescription, (uint8)MaterialAsset::VertexAttributes::Count>
+				m_fullPrecisionVertexInputBindingDescriptions;
+			InlineVector<VertexInputAttributeDescription, (uint8)MaterialAsset::VertexAttributes::Count * 2>
+				m_fullPrecisionVertexInputAttributeDescriptions;
 
 			VertexStageInfo m_vertexStageInfo;
+			VertexStageInfo m_fullPrecisionVertexStageInfo;
 			FragmentStageInfo m_fragmentStageInfo;
 			Optional<FragmentStageInfo*> m_pFragmentStage;
 			PrimitiveInfo m_primitiveInfo;
@@ -305,6 +342,9 @@ namespace ngine::Rendering
 		UniquePtr<PipelineInfo> pPipelineInfo = UniquePtr<PipelineInfo>::Make(PipelineInfo{
 			Move(vertexInputBindingDescriptions),
 			Move(vertexInputAttributeDescriptions),
+			Move(fullPrecisionVertexInputBindingDescriptions),
+			Move(fullPrecisionVertexInputAttributeDescriptions),
+			VertexStageInfo{ShaderStageInfo{materialAsset.GetVertexShaderAssetGuid()}},
 			VertexStageInfo{ShaderStageInfo{materialAsset.GetVertexShaderAssetGuid()}},
 			FragmentStageInfo{},
 			Optional<FragmentStageInfo*>{},
@@ -348,6 +388,9 @@ namespace ngine::Rendering
 
 		pipelineInfo.m_vertexStageInfo.m_bindingDescriptions = pipelineInfo.m_vertexInputBindingDescriptions.GetView();
 		pipelineInfo.m_vertexStageInfo.m_attributeDescriptions = pipelineInfo.m_vertexInputAttributeDescriptions.GetView();
+		pipelineInfo.m_fullPrecisionVertexStageInfo.m_bindingDescriptions = pipelineInfo.m_fullPrecisionVertexInputBindingDescriptions.GetView();
+		pipelineInfo.m_fullPrecisionVertexStageInfo.m_attributeDescriptions =
+			pipelineInfo.m_fullPrecisionVertexInputAttributeDescriptions.GetView();
 
 		Asset::Manager& assetManager = System::Get<Asset::Manager>();
 
@@ -460,6 +503,53 @@ namespace ngine::Rendering
 			}
 		}
 
+		const auto createPipelines = [this, usesTextureCoordinates](
+																	 LogicalDevice& logicalDevice,
+																	 ShaderCache& shaderCache,
+																	 const RenderPassView renderPass,
+																	 const uint8 subpassIndex,
+																	 const EnumFlags<DynamicStateFlags> dynamicStateFlags,
+																	 const PipelineInfo& pipelineInfo
+																 )
+		{
+			Threading::JobBatch createAsyncJobBatch = CreateAsync(
+				logicalDevice,
+				shaderCache,
+				m_pipelineLayout,
+				renderPass,
+				pipelineInfo.m_vertexStageInfo,
+				pipelineInfo.m_primitiveInfo,
+				pipelineInfo.m_viewports,
+				pipelineInfo.m_scissors,
+				subpassIndex,
+				pipelineInfo.m_pFragmentStage,
+				Optional<const MultisamplingInfo*>{},
+				pipelineInfo.m_depthStencilInfo,
+				Optional<const GeometryStageInfo*>{},
+				dynamicStateFlags
+			);
+			if (usesTextureCoordinates)
+			{
+				createAsyncJobBatch.QueueAfterStartStage(m_fullPrecisionTextureCoordinatesPipeline.CreateAsync(
+					logicalDevice,
+					shaderCache,
+					m_pipelineLayout,
+					renderPass,
+					pipelineInfo.m_fullPrecisionVertexStageInfo,
+					pipelineInfo.m_primitiveInfo,
+					pipelineInfo.m_viewports,
+					pipelineInfo.m_scissors,
+					subpassIndex,
+					pipelineInfo.m_pFragmentStage,
+					Optional<const MultisamplingInfo*>{},
+					pipelineInfo.m_depthStencilInfo,
+					Optional<const GeometryStageInfo*>{},
+					dynamicStateFlags
+				));
+			}
+			return createAsyncJobBatch;
+		};
+
 		EnumFlags<DynamicStateFlags> dynamicStateFlags{};
 		// TODO: Hardwired for VR / XR, change to pass in a flag instead
 		// dynamicStateFlags |= DynamicStateFlags::Viewport * (outputArea != renderArea); // Needs to be commented out for FSR
@@ -475,26 +565,12 @@ namespace ngine::Rendering
 			   renderPass,
 			   subpassIndex,
 			   dynamicStateFlags,
+			   createPipelines,
 			   pPipelineInfo = Move(pPipelineInfo),
 			   &finishedStage](Threading::JobRunnerThread& thread)
 				{
-					PipelineInfo& pipelineInfo = *pPipelineInfo;
-					Threading::JobBatch createAsyncJobBatch = CreateAsync(
-						logicalDevice,
-						shaderCache,
-						m_pipelineLayout,
-						renderPass,
-						pipelineInfo.m_vertexStageInfo,
-						pipelineInfo.m_primitiveInfo,
-						pipelineInfo.m_viewports,
-						pipelineInfo.m_scissors,
-						subpassIndex,
-						pipelineInfo.m_pFragmentStage,
-						Optional<const MultisamplingInfo*>{},
-						pipelineInfo.m_depthStencilInfo,
-						Optional<const GeometryStageInfo*>{},
-						dynamicStateFlags
-					);
+					Threading::JobBatch createAsyncJobBatch =
+						createPipelines(logicalDevice, shaderCache, renderPass, subpassIndex, dynamicStateFlags, *pPipelineInfo);
 					createAsyncJobBatch.QueueAsNewFinishedStage(finishedStage);
 					thread.Queue(createAsyncJobBatch);
 				},
@@ -505,35 +581,16 @@ namespace ngine::Rendering
 		}
 		else
 		{
-			Threading::JobBatch createAsyncJobBatch = CreateAsync(
-				logicalDevice,
-				shaderCache,
-				m_pipelineLayout,
-				renderPass,
-				pipelineInfo.m_vertexStageInfo,
-				pipelineInfo.m_primitiveInfo,
-				pipelineInfo.m_viewports,
-				pipelineInfo.m_scissors,
-				subpassIndex,
-				pipelineInfo.m_pFragmentStage,
-				Optional<const MultisamplingInfo*>{},
-				pipelineInfo.m_depthStencilInfo,
-				Optional<const GeometryStageInfo*>{},
-				dynamicStateFlags
-			);
+			Threading::JobBatch createAsyncJobBatch =
+				createPipelines(logicalDevice, shaderCache, renderPass, subpassIndex, dynamicStateFlags, pipelineInfo);
 			jobBatch.QueueAsNewFinishedStage(createAsyncJobBatch);
 		}
 
 		return jobBatch;
 	}
 
-	void RenderMaterial::Draw(
-		uint32 firstInstanceIndex,
-		const uint32 instanceCount,
-		const RenderMeshView mesh,
-		const BufferView instanceBuffer,
-		const RenderMaterialInstance& materialInstance,
-		const RenderCommandEncoderView renderCommandEncoder
+	void RenderMaterial::BindMaterialInstance(
+		const RenderMaterialInstance& materialInstance, const RenderCommandEncoderView renderCommandEncoder
 	) const
 	{
 		const DescriptorSetView materialInstanceDescriptorSet = materialInstance.GetDescriptorSet();
@@ -543,68 +600,155 @@ namespace ngine::Rendering
 			Array<DescriptorSetView, 1> descriptorSets{materialInstanceDescriptorSet};
 			renderCommandEncoder.BindDescriptorSets(m_pipelineLayout, descriptorSets, descriptorOffset + GetFirstDescriptorSetIndex());
 		}
+	}
 
-		{
-			const MaterialAsset& materialAsset = *m_material->GetAsset();
-			EnumFlags<MaterialAsset::VertexAttributes> vertexAttributes = materialAsset.m_requiredVertexAttributes;
+	void RenderMaterial::BindMeshBuffers(
+		const uint32 firstInstanceIndex,
+		const uint32 instanceCount,
+		const RenderMeshView mesh,
+		const BufferView instanceBuffer,
+		const RenderCommandEncoderView renderCommandEncoder
+	) const
+	{
+		const MaterialAsset& materialAsset = *m_material->GetAsset();
+		EnumFlags<MaterialAsset::VertexAttributes> vertexAttributes = materialAsset.m_requiredVertexAttributes;
 
-			InlineVector<BufferView, (uint8)MaterialAsset::VertexAttributes::Count> vertexBuffers;
-			InlineVector<uint64, (uint8)MaterialAsset::VertexAttributes::Count> bufferOffsets;
-			InlineVector<uint64, (uint8)MaterialAsset::VertexAttributes::Count> bufferSizes;
+		InlineVector<BufferView, (uint8)MaterialAsset::VertexAttributes::Count> vertexBuffers;
+		InlineVector<uint64, (uint8)MaterialAsset::VertexAttributes::Count> bufferOffsets;
+		InlineVector<uint64, (uint8)MaterialAsset::VertexAttributes::Count> bufferSizes;
 
-			const BufferView meshBuffer = mesh.GetVertexBuffer();
-			const Rendering::Index vertexCount = mesh.GetVertexCount();
+		const BufferView meshBuffer = mesh.GetVertexBuffer();
+		const Rendering::Index vertexCount = mesh.GetVertexCount();
 
-			const uint64 normalsOffset = Memory::Align(sizeof(Rendering::VertexPosition) * vertexCount, alignof(Rendering::VertexNormals));
-			const uint64 textureCoordinatesOffset =
-				Memory::Align(normalsOffset + sizeof(Rendering::VertexNormals) * vertexCount, alignof(Rendering::VertexTextureCoordinate));
+		const uint64 normalsOffset = RenderVertexLayout::GetNormalsOffset(vertexCount);
+		const uint64 textureCoordinatesOffset = RenderVertexLayout::GetTextureCoordinatesOffset(vertexCount);
 
-			for (const MaterialAsset::VertexAttributes vertexAttribute : vertexAttributes)
+		for (const MaterialAsset::VertexAttributes vertexAttribute : vertexAttributes)
+		{
+			switch (vertexAttribute)
 			{
-				switch (vertexAttribute)
-				{
-					case MaterialAsset::VertexAttributes::Position:
-						vertexBuffers.EmplaceBack(meshBuffer);
-						bufferOffsets.EmplaceBack(0u);
-						bufferSizes.EmplaceBack(sizeof(Rendering::VertexPosition) * vertexCount);
-						break;
-					case MaterialAsset::VertexAttributes::Normals:
-						vertexBuffers.EmplaceBack(meshBuffer);
-						bufferOffsets.EmplaceBack(normalsOffset);
-						bufferSizes.EmplaceBack(sizeof(Rendering::VertexNormals) * vertexCount);
-						break;
-					case MaterialAsset::VertexAttributes::TextureCoordinates:
-						vertexBuffers.EmplaceBack(meshBuffer);
-						bufferOffsets.EmplaceBack(textureCoordinatesOffset);
-						bufferSizes.EmplaceBack(sizeof(Rendering::VertexTextureCoordinate) * vertexCount);
-						break;
-					case MaterialAsset::VertexAttributes::InstanceIdentifier:
-						vertexBuffers.EmplaceBack(instanceBuffer);
-						bufferOffsets.EmplaceBack(firstInstanceIndex * sizeof(InstanceBuffer::InstanceIndexType));
-						bufferSizes.EmplaceBack(sizeof(InstanceBuffer::InstanceIndexType) * instanceCount);
-						break;
-					case MaterialAsset::VertexAttributes::All:
-						ExpectUnreachable();
-				}
+				case MaterialAsset::VertexAttributes::Position:
+					vertexBuffers.EmplaceBack(meshBuffer);
+					bufferOffsets.EmplaceBack(0u);
+					bufferSizes.EmplaceBack(sizeof(Rendering::VertexPosition) * vertexCount);
+					break;
+				case MaterialAsset::VertexAttributes::Normals:
+					vertexBuffers.EmplaceBack(meshBuffer);
+					bufferOffsets.EmplaceBack(normalsOffset);
+					bufferSizes.EmplaceBack(sizeof(Rendering::VertexNormals) * vertexCount);
+					break;
+				case MaterialAsset::VertexAttributes::TextureCoordinates:
+					vertexBuffers.EmplaceBack(meshBuffer);
+					bufferOffsets.EmplaceBack(textureCoordinatesOffset);
+					bufferSizes.EmplaceBack(RenderVertexLayout::GetTextureCoordinateSize(mesh.GetTextureCoordinateFormat()) * vertexCount);
+					break;
+				case MaterialAsset::VertexAttributes::InstanceIdentifier:
+					vertexBuffers.EmplaceBack(instanceBuffer);
+					bufferOffsets.EmplaceBack(firstInstanceIndex * sizeof(InstanceBuffer::InstanceIndexType));
+					bufferSizes.EmplaceBack(sizeof(InstanceBuffer::InstanceIndexType) * instanceCount);
+					break;
+				case MaterialAsset::VertexAttributes::All:
+					ExpectUnreachable();
 			}
-			renderCommandEncoder.BindVertexBuffers(vertexBuffers.GetView(), bufferOffsets.GetView(), bufferSizes.GetView());
 		}
+		renderCommandEncoder.BindVertexBuffers(vertexBuffers.GetView(), bufferOffsets.GetView(), bufferSizes.GetView());
+	}
+
+	bool RenderMaterial::BindTextureCoordinatePipeline(const RenderMeshView mesh, const RenderCommandEncoderView renderCommandEncoder) const
+	{
+		// Both pipelines share the layout, so bound descriptor sets and push constants stay valid across the switch
+		if (mesh.GetTextureCoordinateFormat() == TextureCoordinateFormat::Full && m_fullPrecisionTextureCoordinatesPipeline.IsValid())
+		{
+			renderCommandEncoder.BindPipeline(m_fullPrecisionTextureCoordinatesPipeline);
+			return true;
+		}
+		return false;
+	}
+
+	void RenderMaterial::Draw(
+		const uint32 firstInstanceIndex,
+		const uint32 instanceCount,
+		const RenderMeshView mesh,
+		const BufferView instanceBuffer,
+		const RenderMaterialInstance& materialInstance,
+		const RenderCommandEncoderView renderCommandEncoder,
+		const ArrayView<const Math::Range<Index>, Index> indexRanges
+	) const
+	{
+		BindMaterialInstance(materialInstance, renderCommandEncoder);
+		BindMeshBuffers(firstInstanceIndex, instanceCount, mesh, instanceBuffer, renderCommandEncoder);
+		const bool boundFullPrecisionPipeline = BindTextureCoordinatePipeline(mesh, renderCommandEncoder);
 
 		// Actual instance index will be 0 since buffers were bound with an offset
-		firstInstanceIndex = 0;
+		const uint32 boundFirstInstanceIndex = 0;
 
 		const uint32 firstIndex = 0u;
 		const int32_t vertexOffset = 0;
-		renderCommandEncoder.DrawIndexed(
+		// The level of detail range is bound through the buffer offset, as not all backends support a first index
+		if (indexRanges.IsEmpty())
+		{
+			renderCommandEncoder.DrawIndexed(
+				mesh.GetIndexBuffer(),
+				sizeof(Rendering::Index) * mesh.GetFirstIndex(),
+				sizeof(Rendering::Index) * mesh.GetIndexCount(),
+				mesh.GetIndexCount(),
+				instanceCount,
+				firstIndex,
+				vertexOffset,
+				boundFirstInstanceIndex
+			);
+		}
+		else
+		{
+			for (const Math::Range<Index> indexRange : indexRanges)
+			{
+				renderCommandEncoder.DrawIndexed(
+					mesh.GetIndexBuffer(),
+					sizeof(Rendering::Index) * (mesh.GetFirstIndex() + indexRange.GetMinimum()),
+					sizeof(Rendering::Index) * indexRange.GetSize(),
+					indexRange.GetSize(),
+					instanceCount,
+					firstIndex,
+					vertexOffset,
+					boundFirstInstanceIndex
+				);
+			}
+		}
+
+		if (boundFullPrecisionPipeline)
+		{
+			renderCommandEncoder.BindPipeline(*this);
+		}
+	}
+
+	void RenderMaterial::DrawIndexedIndirect(
+		const uint32 firstInstanceIndex,
+		const uint32 instanceCount,
+		const RenderMeshView mesh,
+		const BufferView instanceBuffer,
+		const RenderCommandEncoderView renderCommandEncoder,
+		const BufferView indirectBuffer,
+		const uint64 indirectBufferOffset,
+		const uint32 drawCount
+	) const
+	{
+		BindMeshBuffers(firstInstanceIndex, instanceCount, mesh, instanceBuffer, renderCommandEncoder);
+		const bool boundFullPrecisionPipeline = BindTextureCoordinatePipeline(mesh, renderCommandEncoder);
+
+		renderCommandEncoder.DrawIndexedIndirect(
 			mesh.GetIndexBuffer(),
-			0,
+			sizeof(Rendering::Index) * mesh.GetFirstIndex(),
 			sizeof(Rendering::Index) * mesh.GetIndexCount(),
-			mesh.GetIndexCount(),
-			instanceCount,
-			firstIndex,
-			vertexOffset,
-			firstInstanceIndex
+			indirectBuffer,
+			indirectBufferOffset,
+			drawCount,
+			sizeof(DrawIndexedIndirectArguments)
 		);
+
+		if (boundFullPrecisionPipeline)
+		{
+			renderCommandEncoder.BindPipeline(*this);
+		}
 	}
 
 	Threading::JobBatch RenderMaterial::LoadRenderMaterialInstanceResources(SceneView& sceneView, const MaterialInstanceIdentifier identifier)
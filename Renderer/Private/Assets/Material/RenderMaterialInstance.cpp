@@ -5,6 +5,7 @@
 #include <Renderer/Assets/Material/RuntimeMaterial.h>
 #include <Renderer/Assets/Texture/RenderTexture.h>
 #include <Renderer/Assets/Texture/MipMask.h>
+#include <Renderer/Assets/Texture/TextureStreaming.h>
 #include <Renderer/Scene/SceneView.h>
 #include <Renderer/Devices/LogicalDevice.h>
 #include <Renderer/Renderer.h>
@@ -65,6 +66,9 @@ namespace ngine::Rendering
 				m_descriptorContents.Reserve(descriptorBindings.GetSize());
 				m_loadingTextureCount = descriptorBindings.GetSize();
 
+				// Material stages report the usage of their textures, allowing them to be streamed
+				const bool isStreamingEnabled = logicalDevice.GetRenderer().GetTextureCache().IsStreamingEnabled();
+
 				for (const MaterialAsset::DescriptorBinding& __restrict binding : descriptorBindings)
 				{
 					switch (binding.m_type)
@@ -81,8 +85,8 @@ namespace ngine::Rendering
 								logicalDevice.GetIdentifier(),
 								content.m_textureData.m_textureIdentifier,
 								GetMappingType(binding.m_samplerInfo.m_texturePreset),
-								AllMips,
-								TextureLoadFlags::Default,
+								isStreamingEnabled ? TextureStreaming::AlwaysResidentMips : AllMips,
+								TextureLoadFlags::Default | (TextureLoadFlags::Streamed * isStreamingEnabled),
 								TextureCache::TextureLoadListenerData(*this, &RenderMaterialInstance::OnTextureLoadedAsync)
 							);
 							if (pJob != nullptr)
@@ -454,12 +458,14 @@ namespace ngine::Rendering
 				const MaterialAsset& materialAsset = *m_material->GetMaterial().GetAsset();
 				const MaterialAsset::DescriptorBinding& descriptorBinding = materialAsset.GetDescriptorBindings()[index];
 
+				const bool isStreamingEnabled = logicalDevice.GetRenderer().GetTextureCache().IsStreamingEnabled();
+
 				Threading::Job* pJob = logicalDevice.GetRenderer().GetTextureCache().GetOrLoadRenderTexture(
 					logicalDevice.GetIdentifier(),
 					newDescriptorContent.m_texture.m_identifier,
 					GetMappingType(descriptorBinding.m_samplerInfo.m_texturePreset),
-					AllMips,
-					TextureLoadFlags::Default,
+					isStreamingEnabled ? TextureStreaming::AlwaysResidentMips : AllMips,
+					TextureLoadFlags::Default | (TextureLoadFlags::Streamed * isStreamingEnabled),
 					TextureCache::TextureLoadListenerData(*this, &RenderMaterialInstance::OnTextureLoadedAsync)
 				);
 
@@ -516,4 +522,20 @@ namespace ngine::Rendering
 	{
 		return (m_pMaterialInstance != nullptr) && m_pMaterialInstance->IsValid() & (m_loadingTextureCount.Load() == 0);
 	}
+
+	void RenderMaterialInstance::ReportTextureUsage(LogicalDevice& logicalDevice, const uint32 resolution) const
+	{
+		TextureCache& textureCache = logicalDevice.GetRenderer().GetTextureCache();
+		for (const DescriptorContent& __restrict descriptorContent : m_descriptorContents)
+		{
+			switch (descriptorContent.m_type)
+			{
+				case DescriptorContentType::Invalid:
+					ExpectUnreachable();
+				case DescriptorContentType::Texture:
+					textureCache.ReportTextureUsage(logicalDevice.GetIdentifier(), descriptorContent.m_texture.m_identifier, resolution);
+					break;
+			}
+		}
+	}
 }
@@ -10,6 +10,7 @@
 #include <Common/Threading/Jobs/Job.h>
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
 #include <Common/IO/File.h>
+#include <Common/Guid.h>
 #include <Common/System/Query.h>
 
 #include <Renderer/Devices/LogicalDevice.h>
@@ -61,14 +62,18 @@ namespace ngine::Rendering
 			const size pipelineSize = (size)shaderCacheFile.GetSize();
 
 			FixedSizeVector<char, size> pipelineCacheData(Memory::ConstructWithSize, Memory::Uninitialized, pipelineSize);
-			if (LIKELY(shaderCacheFile.ReadIntoView(pipelineCacheData.GetView())))
+			const ConstByteView pipelineCacheView{reinterpret_cast<const ByteType*>(pipelineCacheData.GetData()), pipelineCacheData.GetSize()};
+			if (LIKELY(shaderCacheFile.ReadIntoView(pipelineCacheData.GetView())) && IsPipelineCacheCompatible(pipelineCacheView))
 			{
 #if RENDERER_VULKAN
 				const VkPipelineCacheCreateInfo cacheCreateInfo =
 					{VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, nullptr, 0, pipelineCacheData.GetSize(), pipelineCacheData.GetData()};
 
-				[[maybe_unused]] const VkResult result = vkCreatePipelineCache(GetLogicalDevice(), &cacheCreateInfo, nullptr, &m_pPipelineCache);
-				Assert(result == VK_SUCCESS);
+				const VkResult result = vkCreatePipelineCache(GetLogicalDevice(), &cacheCreateInfo, nullptr, &m_pPipelineCache);
+				if (result != VK_SUCCESS)
+				{
+					m_pPipelineCache = 0;
+				}
 #endif
 			}
 		}
@@ -105,31 +110,81 @@ namespace ngine::Rendering
 #endif
 	}
 
+	bool ShaderCache::IsPipelineCacheCompatible([[maybe_unused]] const ConstByteView pipelineCacheData) const
+	{
+#if RENDERER_VULKAN
+		// Drivers are expected to reject foreign data, but not all of them do so gracefully
+		// Only hand over data that was produced by the same device and driver
+		if (pipelineCacheData.GetDataSize() < sizeof(VkPipelineCacheHeaderVersionOne))
+		{
+			return false;
+		}
+
+		VkPipelineCacheHeaderVersionOne header;
+		Memory::CopyWithoutOverlap(&header, pipelineCacheData.GetData(), sizeof(VkPipelineCacheHeaderVersionOne));
+
+		VkPhysicalDeviceProperties deviceProperties;
+		vkGetPhysicalDeviceProperties(GetLogicalDevice().GetPhysicalDevice(), &deviceProperties);
+
+		if (header.headerSize < sizeof(VkPipelineCacheHeaderVersionOne) || header.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+		    header.vendorID != deviceProperties.vendorID || header.deviceID != deviceProperties.deviceID)
+		{
+			return false;
+		}
+
+		// The cache UUID changes with the driver version
+		for (uint32 index = 0; index < VK_UUID_SIZE; ++index)
+		{
+			if (header.pipelineCacheUUID[index] != deviceProperties.pipelineCacheUUID[index])
+			{
+				return false;
+			}
+		}
+		return true;
+#else
+		return true;
+#endif
+	}
+
 	void ShaderCache::SaveToDisk() const
 	{
 #if SUPPORTS_PIPELINE_CACHE
-		size pipelineSize;
+		size pipelineSize = 0;
 #if RENDERER_VULKAN
-		[[maybe_unused]] const VkResult getSizeResult = vkGetPipelineCacheData(GetLogicalDevice(), m_pPipelineCache, &pipelineSize, nullptr);
-		Assert(getSizeResult == VK_SUCCESS);
-		pipelineSize = 0;
+		const VkResult getSizeResult = vkGetPipelineCacheData(GetLogicalDevice(), m_pPipelineCache, &pipelineSize, nullptr);
+		if (getSizeResult != VK_SUCCESS || pipelineSize == 0)
+		{
+			return;
+		}
 #endif
 
-		FixedSizeVector<char> pipelineCacheData(Memory::ConstructWithSize, Memory::Uninitialized, (uint32)pipelineSize);
+		FixedSizeVector<char, size> pipelineCacheData(Memory::ConstructWithSize, Memory::Uninitialized, pipelineSize);
 
 #if RENDERER_VULKAN
-		[[maybe_unused]] const VkResult result =
-			vkGetPipelineCacheData(GetLogicalDevice(), m_pPipelineCache, &pipelineSize, pipelineCacheData.GetData());
+		const VkResult result = vkGetPipelineCacheData(GetLogicalDevice(), m_pPipelineCache, &pipelineSize, pipelineCacheData.GetData());
 		if (result != VK_SUCCESS)
 		{
 			return;
 		}
 #endif
 
+		// Write to a temporary file first, so that an interrupted save never leaves a truncated cache behind
 		const IO::Path shaderCacheFilePath = GetShaderCacheFilePath();
 		IO::Path(shaderCacheFilePath.GetParentPath()).CreateDirectories();
-		const IO::File shaderCacheFile(shaderCacheFilePath, IO::AccessModeFlags::Write | IO::AccessModeFlags::Binary);
-		shaderCacheFile.Write(pipelineCacheData.GetView());
+		const IO::Path temporaryFilePath = IO::Path::Merge(shaderCacheFilePath, MAKE_PATH(".tmp"));
+		{
+			const IO::File shaderCacheFile(temporaryFilePath, IO::AccessModeFlags::Write | IO::AccessModeFlags::Binary);
+			if (UNLIKELY_ERROR(!shaderCacheFile.IsValid()))
+			{
+				return;
+			}
+			shaderCacheFile.Write(pipelineCacheData.GetSubView((size)0, pipelineSize));
+		}
+		if (UNLIKELY_ERROR(!temporaryFilePath.MoveFileTo(shaderCacheFilePath)))
+		{
+			LogWarning("Failed to replace the pipeline cache, keeping the previous one");
+			[[maybe_unused]] const bool wasRemoved = temporaryFilePath.RemoveFile();
+		}
 #endif
 	}
 
@@ -175,7 +230,23 @@ namespace ngine::Rendering
 
 	IO::Path ShaderCache::GetShaderCacheFilePath() const
 	{
+#if RENDERER_VULKAN
+		// Keyed on the device and driver, so that devices in the same system don't overwrite each other's cache
+		VkPhysicalDeviceProperties deviceProperties;
+		vkGetPhysicalDeviceProperties(GetLogicalDevice().GetPhysicalDevice(), &deviceProperties);
+
+		static_assert(sizeof(Guid) == VK_UUID_SIZE);
+		Guid pipelineCacheGuid;
+		Memory::CopyWithoutOverlap(&pipelineCacheGuid, deviceProperties.pipelineCacheUUID, VK_UUID_SIZE);
+
+		const IO::Path fileName = IO::Path::Merge(
+			IO::Path::StringType().Format("{}-{}-", deviceProperties.vendorID, deviceProperties.deviceID).GetView(),
+			pipelineCacheGuid.ToString().GetView()
+		);
+		return IO::Path::Combine(IO::Path::GetApplicationCacheDirectory(), MAKE_PATH("ShaderCache"), IO::Path::Merge(fileName, MAKE_PATH(".bin")));
+#else
 		return IO::Path::Combine(IO::Path::GetApplicationCacheDirectory(), MAKE_PATH("ShaderCache"), MAKE_PATH("Cache.bin"));
+#endif
 	}
 
 	Threading::Job* ShaderCache::FindOrLoad(
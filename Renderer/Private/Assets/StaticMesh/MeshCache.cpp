@@ -31,6 +31,7 @@
 #include <Renderer/Assets/StaticMesh/Primitives/Sphere.h>
 #include <Renderer/Assets/StaticMesh/Primitives/Torus.h>
 #include <Renderer/Assets/StaticMesh/MeshSceneTag.h>
+#include <Renderer/Assets/StaticMesh/RenderVertexLayout.h>
 #include <Renderer/Renderer.h>
 
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
@@ -84,6 +85,11 @@ namespace ngine::Rendering
 
 	MeshCache::~MeshCache()
 	{
+		for (StaticMeshIdentifier::IndexType meshIndex = 0, meshCount = GetMaximumUsedIdentifierCount(); meshIndex < meshCount; ++meshIndex)
+		{
+			DeregisterMeshResource(StaticMeshIdentifier::MakeFromValidIndex(meshIndex));
+		}
+
 		IterateElements(
 			m_meshData.GetView(),
 			[](MeshData* pMeshData)
@@ -234,7 +240,8 @@ namespace ngine::Rendering
 		uint64 vertexNormalsBufferAddress;
 		uint64 vertexTextureCoordinatesBufferAddress;
 		uint64 indicesBufferAddress;
-		uint64 pad;
+		//! Non-zero if texture coordinates are stored at half precision, see TextureCoordinateFormat
+		uint64 halfPrecisionTextureCoordinates;
 	};
 
 	void MeshCache::OnLogicalDeviceCreated(LogicalDevice& logicalDevice)
@@ -875,6 +882,8 @@ namespace ngine::Rendering
 
 	void MeshCache::Remove(const StaticMeshIdentifier identifier)
 	{
+		DeregisterMeshResource(identifier);
+
 		MeshData* pMeshData = m_meshData[identifier];
 		if (pMeshData != nullptr && m_meshData[identifier].CompareExchangeStrong(pMeshData, nullptr))
 		{
@@ -996,8 +1005,9 @@ namespace ngine::Rendering
 	{
 		const StaticMeshIdentifier identifier = BaseType::RegisterAsset(
 			guid,
-			[](const StaticMeshIdentifier identifier, const Guid) mutable -> StaticMeshInfo
+			[this](const StaticMeshIdentifier identifier, const Guid) mutable -> StaticMeshInfo
 			{
+				RegisterMeshResource(identifier);
 				return StaticMeshInfo{LoadDefaultMeshGlobalDataFromDisk, UniquePtr<StaticMesh>::Make(identifier, identifier)};
 			}
 		);
@@ -1008,13 +1018,113 @@ namespace ngine::Rendering
 	{
 		return BaseType::FindOrRegisterAsset(
 			guid,
-			[](const StaticMeshIdentifier identifier, const Asset::Guid)
+			[this](const StaticMeshIdentifier identifier, const Asset::Guid)
 			{
+				RegisterMeshResource(identifier);
 				return StaticMeshInfo{LoadDefaultMeshGlobalDataFromDisk, UniquePtr<StaticMesh>::Make(identifier, identifier)};
 			}
 		);
 	}
 
+	void MeshCache::RegisterMeshResource(const StaticMeshIdentifier identifier)
+	{
+		if (const Optional<Resource::Manager*> pResourceManager = System::Find<Resource::Manager>())
+		{
+			const Resource::Identifier resourceIdentifier = pResourceManager->Register(*this);
+			if (LIKELY(resourceIdentifier.IsValid()))
+			{
+				m_resourceMeshIdentifiers[resourceIdentifier] = identifier;
+				m_meshResourceIdentifiers[identifier] = resourceIdentifier;
+			}
+		}
+	}
+
+	void MeshCache::DeregisterMeshResource(const StaticMeshIdentifier identifier)
+	{
+		Resource::Identifier& resourceIdentifier = m_meshResourceIdentifiers[identifier];
+		if (resourceIdentifier.IsValid())
+		{
+			System::Get<Resource::Manager>().Deregister(resourceIdentifier);
+			resourceIdentifier = {};
+		}
+	}
+
+	void MeshCache::ReportMeshResourceLoaded(const StaticMeshIdentifier identifier)
+	{
+		const Resource::Identifier resourceIdentifier = m_meshResourceIdentifiers[identifier];
+		if (resourceIdentifier.IsValid())
+		{
+			const StaticMesh& mesh = *GetAssetData(identifier).m_pMesh;
+			const size dataSize = mesh.GetStaticObjectData().GetDataSize() + mesh.GetSimplifiedLevelOfDetailIndices().GetDataSize() +
+			                      mesh.GetMeshlets().GetDataSize();
+			System::Get<Resource::Manager>().OnLoaded(resourceIdentifier, dataSize, 0);
+		}
+	}
+
+	void MeshCache::AcquireMeshData(const StaticMeshIdentifier identifier)
+	{
+		const Resource::Identifier resourceIdentifier = m_meshResourceIdentifiers[identifier];
+		if (resourceIdentifier.IsValid())
+		{
+			Resource::Manager& resourceManager = System::Get<Resource::Manager>();
+			resourceManager.Acquire(resourceIdentifier);
+			resourceManager.MarkUsed(resourceIdentifier);
+		}
+	}
+
+	void MeshCache::ReleaseMeshData(const StaticMeshIdentifier identifier)
+	{
+		const Resource::Identifier resourceIdentifier = m_meshResourceIdentifiers[identifier];
+		if (resourceIdentifier.IsValid())
+		{
+			System::Get<Resource::Manager>().Release(resourceIdentifier);
+		}
+	}
+
+	void MeshCache::Unload(const Resource::Identifier resourceIdentifier)
+	{
+		const StaticMeshIdentifier identifier = m_resourceMeshIdentifiers[resourceIdentifier];
+		// A load in progress replaces the data and reports the mesh to the manager again once done
+		if (!m_loadingMeshes.Set(identifier))
+		{
+			return;
+		}
+
+		Resource::Manager& resourceManager = System::Get<Resource::Manager>();
+		StaticMesh& mesh = *GetAssetData(identifier).m_pMesh;
+		// Readers acquire the data before checking whether the mesh is loaded, while the flag is cleared here before checking the pin.
+		// Either the reader sees the mesh as unloaded and waits for it to be loaded again, or the eviction is undone.
+		if (mesh.OnUnloaded())
+		{
+			if (resourceManager.IsAcquired(resourceIdentifier))
+			{
+				GetOrCreateMeshData(identifier);
+				OnMeshLoaded(identifier);
+				return;
+			}
+
+			mesh.ReleaseStaticObjectData();
+		}
+
+		[[maybe_unused]] const bool wasCleared = m_loadingMeshes.Clear(identifier);
+		Assert(wasCleared);
+
+		// Requests made while the data was being freed could not start loading, start it on their behalf
+		if (m_awaitingLoadMeshes.Clear(identifier) ||
+		    resourceManager.GetState(resourceIdentifier) == Resource::Manager::Resource::State::Reloading)
+		{
+			Reload(resourceIdentifier);
+		}
+	}
+
+	void MeshCache::Reload(const Resource::Identifier resourceIdentifier)
+	{
+		if (Threading::JobBatch jobBatch = TryReloadStaticMesh(m_resourceMeshIdentifiers[resourceIdentifier]))
+		{
+			Threading::JobRunnerThread::GetCurrent()->Queue(jobBatch);
+		}
+	}
+
 	struct LoadStaticMeshPerLogicalDeviceDataJob : public Threading::Job
 	{
 		enum class LoadStatus : uint8
@@ -1089,19 +1199,25 @@ namespace ngine::Rendering
 						.QueueCallback(
 							[this]()
 							{
-								const StaticMesh& staticMesh = *m_logicalDevice.GetRenderer().GetMeshCache().FindMesh(m_identifier);
+								MeshCache& meshCache = m_logicalDevice.GetRenderer().GetMeshCache();
+								const StaticMesh& staticMesh = *meshCache.FindMesh(m_identifier);
 								const ArrayView<const Index, Index> indices = staticMesh.GetIndices();
 
 								m_renderMesh = RenderMesh(
 									m_logicalDevice,
 									m_transferCommandEncoder,
 									m_graphicsCommandEncoder,
-									staticMesh.GetVertexCount(),
-									staticMesh.GetVertexData(),
+									staticMesh.GetVertexPositions(),
+									staticMesh.GetVertexNormals(),
+									staticMesh.GetVertexTextureCoordinates(),
 									indices,
+									staticMesh.GetSimplifiedLevelsOfDetail(),
+									staticMesh.GetSimplifiedLevelOfDetailIndices(),
+									staticMesh.GetMeshlets(),
 									m_stagingBuffer,
 									staticMesh.ShouldAllowCpuVertexAccess()
 								);
+								meshCache.ReleaseMeshData(m_identifier);
 								Queue(System::Get<Threading::JobManager>());
 							}
 						);
@@ -1119,22 +1235,28 @@ namespace ngine::Rendering
 			{
 				case LoadStatus::AwaitingLoad:
 				{
-					const Optional<const StaticMesh*> pStaticMesh = m_logicalDevice.GetRenderer().GetMeshCache().FindMesh(m_identifier);
+					MeshCache& meshCache = m_logicalDevice.GetRenderer().GetMeshCache();
+					const Optional<const StaticMesh*> pStaticMesh = meshCache.FindMesh(m_identifier);
 					Assert(pStaticMesh.IsValid());
 					if (UNLIKELY(!pStaticMesh.IsValid()))
 					{
 						return Result::FinishedAndDelete;
 					}
 
+					// Keep the CPU data from being evicted until the render mesh was created from it
+					meshCache.AcquireMeshData(m_identifier);
+
 					// TODO: Delay LoadStaticMeshPerLogicalDeviceDataJob queuing until pStaticMesh->HasFinishedLoading will return true so we don't
 					// have to check it
 					if (!pStaticMesh->HasFinishedLoading())
 					{
+						meshCache.ReleaseMeshData(m_identifier);
 						return Result::TryRequeue;
 					}
 
 					if (UNLIKELY(pStaticMesh->DidLoadingFail()))
 					{
+						meshCache.ReleaseMeshData(m_identifier);
 						return Result::FinishedAndDelete;
 					}
 					Assert(pStaticMesh->IsLoaded());
@@ -1171,12 +1293,17 @@ namespace ngine::Rendering
 						m_logicalDevice,
 						m_transferCommandEncoder,
 						m_graphicsCommandEncoder,
-						pStaticMesh->GetVertexCount(),
-						pStaticMesh->GetVertexData(),
+						pStaticMesh->GetVertexPositions(),
+						pStaticMesh->GetVertexNormals(),
+						pStaticMesh->GetVertexTextureCoordinates(),
 						indices,
+						pStaticMesh->GetSimplifiedLevelsOfDetail(),
+						pStaticMesh->GetSimplifiedLevelOfDetailIndices(),
+						pStaticMesh->GetMeshlets(),
 						m_stagingBuffer,
 						pStaticMesh->ShouldAllowCpuVertexAccess()
 					);
+					meshCache.ReleaseMeshData(m_identifier);
 #endif
 				}
 					[[fallthrough]];
@@ -1308,8 +1435,11 @@ namespace ngine::Rendering
 		}
 		else
 		{
+			// Flagged before claiming the load, so that an eviction holding the loading flag starts the load once it released it
+			m_awaitingLoadMeshes.Set(identifier);
 			if (m_loadingMeshes.Set(identifier))
 			{
+				m_awaitingLoadMeshes.Clear(identifier);
 				if (!pMesh->IsLoaded())
 				{
 					const StaticMeshGlobalLoadingCallback& loadingCallback = GetAssetData(identifier).m_globalLoadingCallback;
@@ -1422,6 +1552,8 @@ namespace ngine::Rendering
 		[[maybe_unused]] const bool cleared = m_loadingMeshes.Clear(identifier);
 		Assert(cleared);
 		GetAssetData(identifier).m_pMesh->OnLoaded();
+		ReportMeshResourceLoaded(identifier);
+		m_awaitingLoadMeshes.Clear(identifier);
 
 		m_meshData[identifier]->m_onLoadedCallback.ExecuteAndClear(identifier);
 	}
@@ -1431,6 +1563,7 @@ namespace ngine::Rendering
 		[[maybe_unused]] const bool cleared = m_loadingMeshes.Clear(identifier);
 		Assert(cleared);
 		GetAssetData(identifier).m_pMesh->OnLoadingFailed();
+		m_awaitingLoadMeshes.Clear(identifier);
 
 		m_meshData[identifier]->m_onLoadedCallback.ExecuteAndClear(identifier);
 	}
@@ -1581,15 +1714,15 @@ namespace ngine::Rendering
 			const BufferView meshBuffer = storedRenderMesh.GetVertexBuffer();
 			const Rendering::Index vertexCount = storedRenderMesh.GetVertexCount();
 
-			const uint64 normalsOffset = Memory::Align(sizeof(Rendering::VertexPosition) * vertexCount, alignof(Rendering::VertexNormals));
-			const uint64 textureCoordinatesOffset =
-				Memory::Align(normalsOffset + sizeof(Rendering::VertexNormals) * vertexCount, alignof(Rendering::VertexTextureCoordinate));
+			const uint64 normalsOffset = RenderVertexLayout::GetNormalsOffset(vertexCount);
+			const uint64 textureCoordinatesOffset = RenderVertexLayout::GetTextureCoordinatesOffset(vertexCount);
 			const uint64 vertexBufferAddress = meshBuffer.GetDeviceAddress(logicalDevice);
 
 			MeshAddresses addresses{
 				vertexBufferAddress + normalsOffset,
 				vertexBufferAddress + textureCoordinatesOffset,
-				storedRenderMesh.GetIndexBuffer().GetDeviceAddress(logicalDevice)
+				storedRenderMesh.GetIndexBuffer().GetDeviceAddress(logicalDevice),
+				storedRenderMesh.GetTextureCoordinateFormat() == TextureCoordinateFormat::Half
 			};
 
 			StagingBuffer stagingBuffer(
@@ -1669,6 +1802,14 @@ namespace ngine::Rendering
 				const Rendering::StaticMeshInfo& masterMeshInfo = m_meshCache.GetAssetData(m_masterMeshIdentifier);
 				Assert(masterMeshInfo.m_pMesh.IsValid());
 
+				m_meshCache.AcquireMeshData(m_masterMeshIdentifier);
+				if (!masterMeshInfo.m_pMesh->HasFinishedLoading())
+				{
+					// The master's data was evicted since it loaded, wait for it to be loaded again
+					m_meshCache.ReleaseMeshData(m_masterMeshIdentifier);
+					return Result::TryRequeue;
+				}
+
 				if (masterMeshInfo.m_pMesh->IsLoaded())
 				{
 					const Rendering::StaticMeshInfo& meshInfo = m_meshCache.GetAssetData(m_meshIdentifier);
@@ -1687,6 +1828,7 @@ namespace ngine::Rendering
 					Assert(masterMeshInfo.m_pMesh->DidLoadingFail());
 					m_meshCache.OnMeshLoadingFailed(m_meshIdentifier);
 				}
+				m_meshCache.ReleaseMeshData(m_masterMeshIdentifier);
 				return Result::FinishedAndDelete;
 			}
 		protected:
@@ -0,0 +1,189 @@
+#include "Assets/StaticMesh/MeshLevelOfDetail.h"
+
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Sqrt.h>
+#include <Common/Math/Primitives/BoundingBox.h>
+#include <Common/Math/NumericLimits.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/UnorderedMap.h>
+
+namespace ngine::Rendering::MeshSimplification
+{
+	namespace Internal
+	{
+		//! Cell coordinates are packed into 10 bits per axis
+		inline static constexpr uint32 MaximumGridResolution = 1024;
+
+		struct Cluster
+		{
+			Math::Vector3f m_positionSum;
+			Index m_vertexCount;
+			Index m_representativeVertexIndex;
+			float m_representativeDistanceSquared;
+		};
+
+		struct Clustering
+		{
+			Clustering(const ArrayView<const VertexPosition, Index> vertexPositions, const Math::BoundingBox boundingBox)
+				: m_vertexPositions(vertexPositions)
+				, m_minimum(boundingBox.GetMinimum())
+				, m_vertexClusters(Memory::ConstructWithSize, Memory::Uninitialized, vertexPositions.GetSize())
+				, m_vertexRemap(Memory::ConstructWithSize, Memory::Uninitialized, vertexPositions.GetSize())
+			{
+				const Math::Vector3f size = boundingBox.GetMaximum() - boundingBox.GetMinimum();
+				m_extent = Math::Max(size.x, Math::Max(size.y, size.z));
+			}
+
+			//! Assigns each vertex to a grid cell and remaps it to the vertex closest to the average position of its cell
+			void Cluster(const uint32 resolution)
+			{
+				m_cellClusters.Clear();
+				m_clusters.Clear();
+
+				const float inverseCellSize = float(resolution) / m_extent;
+				const uint32 maximumCellIndex = resolution - 1;
+				for (Index vertexIndex = 0, vertexCount = m_vertexPositions.GetSize(); vertexIndex < vertexCount; ++vertexIndex)
+				{
+					const Math::Vector3f cellCoordinates = (m_vertexPositions[vertexIndex] - m_minimum) * inverseCellSize;
+					const uint32 cellKey = Math::Min((uint32)cellCoordinates.x, maximumCellIndex) |
+					                       (Math::Min((uint32)cellCoordinates.y, maximumCellIndex) << 10) |
+					                       (Math::Min((uint32)cellCoordinates.z, maximumCellIndex) << 20);
+
+					decltype(m_cellClusters)::iterator it = m_cellClusters.Find(cellKey);
+					if (it == m_cellClusters.end())
+					{
+						it = m_cellClusters.Emplace(cellKey, m_clusters.GetSize());
+						m_clusters.EmplaceBack(Internal::Cluster{Math::Zero, 0, vertexIndex, Math::NumericLimits<float>::Max});
+					}
+
+					Internal::Cluster& cluster = m_clusters[it->second];
+					cluster.m_positionSum += m_vertexPositions[vertexIndex];
+					cluster.m_vertexCount++;
+					m_vertexClusters[vertexIndex] = it->second;
+				}
+
+				for (Index vertexIndex = 0, vertexCount = m_vertexPositions.GetSize(); vertexIndex < vertexCount; ++vertexIndex)
+				{
+					Internal::Cluster& cluster = m_clusters[m_vertexClusters[vertexIndex]];
+					const Math::Vector3f center = cluster.m_positionSum / (float)cluster.m_vertexCount;
+					const float distanceSquared = (m_vertexPositions[vertexIndex] - center).GetLengthSquared();
+					if (distanceSquared < cluster.m_representativeDistanceSquared)
+					{
+						cluster.m_representativeDistanceSquared = distanceSquared;
+						cluster.m_representativeVertexIndex = vertexIndex;
+					}
+				}
+
+				for (Index vertexIndex = 0, vertexCount = m_vertexPositions.GetSize(); vertexIndex < vertexCount; ++vertexIndex)
+				{
+					m_vertexRemap[vertexIndex] = m_clusters[m_vertexClusters[vertexIndex]].m_representativeVertexIndex;
+				}
+			}
+
+			//! Returns the number of indices remaining after dropping triangles that collapsed
+			[[nodiscard]] Index CountIndices(const ArrayView<const Index, Index> indices) const
+			{
+				Index indexCount = 0;
+				for (Index index = 0, count = indices.GetSize() - indices.GetSize() % 3; index < count; index += 3)
+				{
+					const Index first = m_vertexRemap[indices[index]];
+					const Index second = m_vertexRemap[indices[index + 1]];
+					const Index third = m_vertexRemap[indices[index + 2]];
+					indexCount += ((first != second) & (second != third) & (third != first)) * 3;
+				}
+				return indexCount;
+			}
+
+			void EmitIndices(const ArrayView<const Index, Index> indices, Vector<Index, Index>& indicesOut) const
+			{
+				for (Index index = 0, count = indices.GetSize() - indices.GetSize() % 3; index < count; index += 3)
+				{
+					const Index first = m_vertexRemap[indices[index]];
+					const Index second = m_vertexRemap[indices[index + 1]];
+					const Index third = m_vertexRemap[indices[index + 2]];
+					if ((first != second) & (second != third) & (third != first))
+					{
+						indicesOut.EmplaceBack(first);
+						indicesOut.EmplaceBack(second);
+						indicesOut.EmplaceBack(third);
+					}
+				}
+			}
+
+			//! Largest distance any vertex moved by being collapsed onto its cluster's representative
+			[[nodiscard]] float CalculateError() const
+			{
+				float maximumDistanceSquared = 0.f;
+				for (Index vertexIndex = 0, vertexCount = m_vertexPositions.GetSize(); vertexIndex < vertexCount; ++vertexIndex)
+				{
+					const float distanceSquared = (m_vertexPositions[vertexIndex] - m_vertexPositions[m_vertexRemap[vertexIndex]]).GetLengthSquared();
+					maximumDistanceSquared = Math::Max(maximumDistanceSquared, distanceSquared);
+				}
+				return Math::Sqrt(maximumDistanceSquared);
+			}
+
+			const ArrayView<const VertexPosition, Index> m_vertexPositions;
+			Math::Vector3f m_minimum;
+			float m_extent;
+
+			UnorderedMap<uint32, Index> m_cellClusters;
+			Vector<Internal::Cluster, Index> m_clusters;
+			Vector<Index, Index> m_vertexClusters;
+			Vector<Index, Index> m_vertexRemap;
+		};
+	}
+
+	float Generate(
+		const ArrayView<const VertexPosition, Index> vertexPositions,
+		const ArrayView<const Index, Index> indices,
+		const Index targetIndexCount,
+		Vector<Index, Index>& indicesOut
+	)
+	{
+		indicesOut.Clear();
+		if (vertexPositions.IsEmpty() || indices.GetSize() < 3)
+		{
+			return 0.f;
+		}
+
+		Math::BoundingBox boundingBox(vertexPositions[0]);
+		for (const VertexPosition& vertexPosition : vertexPositions)
+		{
+			boundingBox.Expand(vertexPosition);
+		}
+
+		const float radius = (boundingBox.GetMaximum() - boundingBox.GetMinimum()).GetLength() * 0.5f;
+		if (radius <= 0.f)
+		{
+			return 0.f;
+		}
+
+		Internal::Clustering clustering(vertexPositions, boundingBox);
+
+		// Coarser grids collapse more triangles, search for the finest grid that meets the target
+		// A single cell collapses every triangle, so the lowest resolution always qualifies
+		uint32 selectedResolution = 1;
+		uint32 minimumResolution = 2;
+		uint32 maximumResolution = Internal::MaximumGridResolution;
+		while (minimumResolution <= maximumResolution)
+		{
+			const uint32 resolution = (minimumResolution + maximumResolution) / 2;
+			clustering.Cluster(resolution);
+			if (clustering.CountIndices(indices) <= targetIndexCount)
+			{
+				selectedResolution = resolution;
+				minimumResolution = resolution + 1;
+			}
+			else
+			{
+				maximumResolution = resolution - 1;
+			}
+		}
+
+		clustering.Cluster(selectedResolution);
+		clustering.EmitIndices(indices, indicesOut);
+		return clustering.CalculateError() / radius;
+	}
+}
@@ -0,0 +1,265 @@
+#include "Assets/StaticMesh/Meshlet.h"
+
+#include <Common/Algorithms/Sort.h>
+#include <Common/Assert/Assert.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Sqrt.h>
+#include <Common/Math/Primitives/BoundingBox.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/FlatVector.h>
+
+namespace ngine::Rendering::Meshlets
+{
+	namespace Internal
+	{
+		struct SortedTriangle
+		{
+			uint32 m_mortonCode;
+			Index m_triangleIndex;
+		};
+
+		//! Spreads the lower 10 bits of a value so that there are two zero bits between each of them
+		[[nodiscard]] static uint32 SpreadBits(uint32 value)
+		{
+			value &= 0x3ff;
+			value = (value | (value << 16)) & 0x030000ff;
+			value = (value | (value << 8)) & 0x0300f00f;
+			value = (value | (value << 4)) & 0x030c30c3;
+			value = (value | (value << 2)) & 0x09249249;
+			return value;
+		}
+
+		[[nodiscard]] static Meshlet CalculateBounds(
+			const ArrayView<const VertexPosition, Index> vertexPositions,
+			const ArrayView<const Index, Index> indices,
+			const Index firstIndex,
+			const Index indexCount
+		)
+		{
+			const ArrayView<const Index, Index> meshletIndices = indices.GetSubView(firstIndex, indexCount);
+
+			Math::BoundingBox boundingBox(vertexPositions[meshletIndices[0]]);
+			for (const Index index : meshletIndices)
+			{
+				boundingBox.Expand(vertexPositions[index]);
+			}
+			const Math::Vector3f center = (boundingBox.GetMinimum() + boundingBox.GetMaximum()) * 0.5f;
+			float radiusSquared = 0.f;
+			for (const Index index : meshletIndices)
+			{
+				radiusSquared = Math::Max(radiusSquared, (vertexPositions[index] - center).GetLengthSquared());
+			}
+
+			Math::Vector3f normalSum{Math::Zero};
+			for (Index index = 0; index < indexCount; index += 3)
+			{
+				const Math::Vector3f first = vertexPositions[meshletIndices[index]];
+				const Math::Vector3f normal =
+					(vertexPositions[meshletIndices[index + 1]] - first).Cross(vertexPositions[meshletIndices[index + 2]] - first);
+				const float length = normal.GetLength();
+				if (length > 0.f)
+				{
+					normalSum += normal / length;
+				}
+			}
+
+			// A cutoff of one can never satisfy the back facing test, used whenever the triangles face too many directions
+			float coneCutoff = 1.f;
+			const float normalSumLength = normalSum.GetLength();
+			const Math::Vector3f coneAxis = normalSumLength > 0.f ? normalSum / normalSumLength : Math::Vector3f{Math::Zero};
+			if (normalSumLength > 0.f)
+			{
+				float minimumDot = 1.f;
+				for (Index index = 0; index < indexCount; index += 3)
+				{
+					const Math::Vector3f first = vertexPositions[meshletIndices[index]];
+					const Math::Vector3f normal =
+						(vertexPositions[meshletIndices[index + 1]] - first).Cross(vertexPositions[meshletIndices[index + 2]] - first);
+					const float length = normal.GetLength();
+					if (length > 0.f)
+					{
+						minimumDot = Math::Min(minimumDot, normal.Dot(coneAxis) / length);
+					}
+				}
+
+				if (minimumDot > 0.f)
+				{
+					coneCutoff = Math::Sqrt(1.f - minimumDot * minimumDot);
+				}
+			}
+
+			return Meshlet{
+				firstIndex,
+				indexCount,
+				(Math::UnalignedVector3<float>)center,
+				Math::Sqrt(radiusSquared),
+				(Math::UnalignedVector3<float>)coneAxis,
+				coneCutoff
+			};
+		}
+	}
+
+	void Build(
+		const ArrayView<const VertexPosition, Index> vertexPositions, const ArrayView<Index, Index> indices, Vector<Meshlet, Index>& meshletsOut
+	)
+	{
+		meshletsOut.Clear();
+		const Index triangleCount = indices.GetSize() / 3;
+		if (vertexPositions.IsEmpty() || triangleCount == 0)
+		{
+			return;
+		}
+
+		Math::BoundingBox boundingBox(vertexPositions[0]);
+		for (const VertexPosition& vertexPosition : vertexPositions)
+		{
+			boundingBox.Expand(vertexPosition);
+		}
+		const Math::Vector3f size = boundingBox.GetMaximum() - boundingBox.GetMinimum();
+		const float extent = Math::Max(size.x, Math::Max(size.y, size.z));
+		const float scale = extent > 0.f ? 1023.f / extent : 0.f;
+
+		// Order triangles along a Morton curve of their centroids so that neighbouring triangles end up in the same meshlet
+		Vector<Internal::SortedTriangle, Index> sortedTriangles(Memory::ConstructWithSize, Memory::Uninitialized, triangleCount);
+		for (Index triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+		{
+			const Index firstIndex = triangleIndex * 3;
+			const Math::Vector3f centroid = (vertexPositions[indices[firstIndex]] + vertexPositions[indices[firstIndex + 1]] +
+			                                 vertexPositions[indices[firstIndex + 2]]) /
+			                                3.f;
+			const Math::Vector3f cellCoordinates = (centroid - boundingBox.GetMinimum()) * scale;
+			sortedTriangles[triangleIndex] = Internal::SortedTriangle{
+				Internal::SpreadBits((uint32)cellCoordinates.x) | (Internal::SpreadBits((uint32)cellCoordinates.y) << 1) |
+					(Internal::SpreadBits((uint32)cellCoordinates.z) << 2),
+				triangleIndex
+			};
+		}
+		Algorithms::Sort(
+			sortedTriangles.begin(),
+			sortedTriangles.end(),
+			[](const Internal::SortedTriangle& left, const Internal::SortedTriangle& right)
+			{
+				return (left.m_mortonCode < right.m_mortonCode) |
+				       ((left.m_mortonCode == right.m_mortonCode) & (left.m_triangleIndex < right.m_triangleIndex));
+			}
+		);
+
+		Vector<Index, Index> sortedIndices(Memory::Reserve, triangleCount * 3);
+		FlatVector<Index, Meshlet::MaximumVertexCount> meshletVertices;
+		Index meshletFirstIndex = 0;
+		for (const Internal::SortedTriangle& sortedTriangle : sortedTriangles)
+		{
+			const Index firstIndex = sortedTriangle.m_triangleIndex * 3;
+			const Index newVertexCount = !meshletVertices.Contains(indices[firstIndex]) +
+			                             !meshletVertices.Contains(indices[firstIndex + 1]) +
+			                             !meshletVertices.Contains(indices[firstIndex + 2]);
+			const Index meshletIndexCount = sortedIndices.GetSize() - meshletFirstIndex;
+			if ((meshletVertices.GetSize() + newVertexCount > Meshlet::MaximumVertexCount) | (meshletIndexCount == Meshlet::MaximumTriangleCount * 3))
+			{
+				meshletsOut.EmplaceBack(Internal::CalculateBounds(vertexPositions, sortedIndices.GetView(), meshletFirstIndex, meshletIndexCount));
+				meshletFirstIndex = sortedIndices.GetSize();
+				meshletVertices.Clear();
+			}
+
+			for (Index index = firstIndex; index < firstIndex + 3; ++index)
+			{
+				if (!meshletVertices.Contains(indices[index]))
+				{
+					meshletVertices.EmplaceBack(indices[index]);
+				}
+				sortedIndices.EmplaceBack(indices[index]);
+			}
+		}
+		meshletsOut.EmplaceBack(
+			Internal::CalculateBounds(vertexPositions, sortedIndices.GetView(), meshletFirstIndex, sortedIndices.GetSize() - meshletFirstIndex)
+		);
+
+		indices.GetSubView(0, sortedIndices.GetSize()).CopyFrom(sortedIndices.GetView());
+	}
+
+	ArrayView<const Meshlet, Index>
+	GetMeshletsInRange(const ArrayView<const Meshlet, Index> meshlets, const Index firstIndex, const Index indexCount)
+	{
+		const auto findFirstMeshletAtOrAfter = [meshlets](const Index index)
+		{
+			Index low = 0;
+			Index high = meshlets.GetSize();
+			while (low < high)
+			{
+				const Index middle = low + (high - low) / 2;
+				if (meshlets[middle].m_firstIndex < index)
+				{
+					low = middle + 1;
+				}
+				else
+				{
+					high = middle;
+				}
+			}
+			return low;
+		};
+
+		const Index firstMeshletIndex = findFirstMeshletAtOrAfter(firstIndex);
+		const Index endMeshletIndex = findFirstMeshletAtOrAfter(firstIndex + indexCount);
+		return meshlets.GetSubView(firstMeshletIndex, endMeshletIndex - firstMeshletIndex);
+	}
+
+	void MergeRanges(Vector<Math::Range<Index>, Index>& ranges, const Index maximumRangeCount)
+	{
+		Assert(maximumRangeCount > 0);
+		if (ranges.GetSize() <= maximumRangeCount)
+		{
+			return;
+		}
+
+		const auto getGap = [&ranges](const Index rangeIndex)
+		{
+			return ranges[rangeIndex + 1].GetMinimum() - (ranges[rangeIndex].GetMinimum() + ranges[rangeIndex].GetSize());
+		};
+
+		// Find the largest gap that has to be closed, all smaller gaps are closed too
+		const Index gapCount = ranges.GetSize() - 1;
+		Vector<Index, Index> sortedGaps(Memory::ConstructWithSize, Memory::Uninitialized, gapCount);
+		for (Index rangeIndex = 0; rangeIndex < gapCount; ++rangeIndex)
+		{
+			sortedGaps[rangeIndex] = getGap(rangeIndex);
+		}
+		Algorithms::Sort(
+			sortedGaps.begin(),
+			sortedGaps.end(),
+			[](const Index left, const Index right)
+			{
+				return left < right;
+			}
+		);
+		const Index mergeCount = ranges.GetSize() - maximumRangeCount;
+		const Index maximumMergedGap = sortedGaps[mergeCount - 1];
+		Index remainingMaximumGapMergeCount = mergeCount;
+		for (const Index gap : sortedGaps.GetView().GetSubView(0, mergeCount))
+		{
+			remainingMaximumGapMergeCount -= gap < maximumMergedGap;
+		}
+
+		Index writeIndex = 0;
+		for (Index rangeIndex = 1, rangeCount = ranges.GetSize(); rangeIndex < rangeCount; ++rangeIndex)
+		{
+			const Index gap = getGap(rangeIndex - 1);
+			const bool merge = (gap < maximumMergedGap) | ((gap == maximumMergedGap) & (remainingMaximumGapMergeCount > 0));
+			if (merge)
+			{
+				remainingMaximumGapMergeCount -= gap == maximumMergedGap;
+				const Index end = ranges[rangeIndex].GetMinimum() + ranges[rangeIndex].GetSize();
+				ranges[rangeIndex] = Math::Range<Index>::Make(ranges[writeIndex].GetMinimum(), end - ranges[writeIndex].GetMinimum());
+			}
+			else
+			{
+				writeIndex++;
+			}
+			ranges[writeIndex] = ranges[rangeIndex];
+		}
+		ranges.Resize(writeIndex + 1);
+		Assert(ranges.GetSize() == maximumRangeCount);
+	}
+}
@@ -12,11 +12,13 @@
 #include <Renderer/Assets/StaticMesh/VertexNormals.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexTextureCoordinate.h>
+#include <Renderer/Assets/StaticMesh/RenderVertexLayout.h>
 
 #include <Engine/Threading/JobRunnerThread.h>
 
 #include <Common/Math/Vector2.h>
 #include <Common/Math/Tangents.h>
+#include <Common/Memory/Containers/Vector.h>
 
 namespace ngine::Rendering
 {
@@ -52,9 +54,13 @@ namespace ngine::Rendering
 				logicalDevice,
 				transferCommandEncoder,
 				graphicsCommandEncoder,
-				dummyVertexData.vertexPositions.GetSize(),
-				ConstByteView::Make(dummyVertexData),
+				dummyVertexData.vertexPositions.GetDynamicView(),
+				dummyVertexData.vertexNormals.GetDynamicView(),
+				dummyVertexData.textureCoordinates.GetDynamicView(),
 				dummyIndices.GetDynamicView(),
+				{},
+				{},
+				{},
 				stagingBufferOut
 			)
 	{
@@ -64,29 +70,83 @@ namespace ngine::Rendering
 		LogicalDevice& logicalDevice,
 		const CommandEncoderView transferCommandEncoder,
 		const CommandEncoderView graphicsCommandEncoder,
-		const Index vertexCount,
-		ConstByteView vertexData,
+		ArrayView<const VertexPosition, Index> vertexPositions,
+		ArrayView<const VertexNormals, Index> vertexNormals,
+		ArrayView<const VertexTextureCoordinate, Index> vertexTextureCoordinates,
 		ArrayView<const Index, Index> indices,
+		ArrayView<const MeshLevelOfDetail, uint8> simplifiedLevelsOfDetail,
+		ArrayView<const Index, Index> levelOfDetailIndices,
+		ArrayView<const Meshlet, Index> meshlets,
 		[[maybe_unused]] StagingBuffer& stagingBufferOut,
 		const bool allowCpuAccess
 	)
-		: m_vertexBuffer(
-				logicalDevice, logicalDevice.GetPhysicalDevice(), logicalDevice.GetDeviceMemoryPool(), vertexData.GetDataSize(), {}, allowCpuAccess
+		: m_textureCoordinateFormat(RenderVertexLayout::GetTextureCoordinateFormat(vertexTextureCoordinates))
+		, m_vertexBuffer(
+				logicalDevice,
+				logicalDevice.GetPhysicalDevice(),
+				logicalDevice.GetDeviceMemoryPool(),
+				RenderVertexLayout::GetSize(vertexPositions.GetSize(), m_textureCoordinateFormat),
+				{},
+				allowCpuAccess
+			)
+		, m_indexBuffer(
+				logicalDevice,
+				logicalDevice.GetPhysicalDevice(),
+				logicalDevice.GetDeviceMemoryPool(),
+				indices.GetDataSize() + levelOfDetailIndices.GetDataSize()
 			)
-		, m_indexBuffer(logicalDevice, logicalDevice.GetPhysicalDevice(), logicalDevice.GetDeviceMemoryPool(), indices.GetDataSize())
-		, m_vertexCount(vertexCount)
+		, m_vertexCount(vertexPositions.GetSize())
 		, m_indexCount(indices.GetSize())
 	{
+		Assert(vertexNormals.GetSize() == m_vertexCount && vertexTextureCoordinates.GetSize() == m_vertexCount);
+		// Simplified levels of detail are stored after the full detail indices in the same buffer
+		m_levelsOfDetail.EmplaceBack(MeshLevelOfDetail{0, m_indexCount, 0.f});
+		for (const MeshLevelOfDetail& levelOfDetail : simplifiedLevelsOfDetail)
+		{
+			if (m_levelsOfDetail.GetSize() == m_levelsOfDetail.GetCapacity())
+			{
+				break;
+			}
+			m_levelsOfDetail.EmplaceBack(levelOfDetail);
+		}
+		m_meshlets.CopyEmplaceRangeBack(meshlets);
+
 		if (LIKELY(m_vertexBuffer.IsValid() & m_indexBuffer.IsValid()))
 		{
+			const size indexDataSize = indices.GetDataSize() + levelOfDetailIndices.GetDataSize();
+			const Array<const DataToBuffer, 2> indexData{
+				DataToBuffer{0, ConstByteView(indices)},
+				DataToBuffer{indices.GetDataSize(), ConstByteView(levelOfDetailIndices)}
+			};
+
+			// Texture coordinates are kept at half precision on the GPU unless any of them would lose more than the tolerance
+			Vector<HalfVertexTextureCoordinate, Index> halfTextureCoordinates;
+			ConstByteView textureCoordinateData = ConstByteView(vertexTextureCoordinates);
+			if (m_textureCoordinateFormat == TextureCoordinateFormat::Half)
+			{
+				halfTextureCoordinates = Vector<HalfVertexTextureCoordinate, Index>(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
+				for (Index vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
+				{
+					halfTextureCoordinates[vertexIndex] = (Math::TVector2<half>)vertexTextureCoordinates[vertexIndex];
+				}
+				textureCoordinateData = ConstByteView(halfTextureCoordinates.GetView());
+			}
+
+			const size vertexDataSize = RenderVertexLayout::GetSize(m_vertexCount, m_textureCoordinateFormat);
+			const Array<const DataToBuffer, 3> vertexData{
+				DataToBuffer{0, ConstByteView(vertexPositions)},
+				DataToBuffer{RenderVertexLayout::GetNormalsOffset(m_vertexCount), ConstByteView(vertexNormals)},
+				DataToBuffer{RenderVertexLayout::GetTextureCoordinatesOffset(m_vertexCount), textureCoordinateData}
+			};
+
 			BlitCommandEncoder blitCommandEncoder = transferCommandEncoder.BeginBlit();
 			Optional<StagingBuffer> stagingBuffer;
 			blitCommandEncoder.RecordCopyDataToBuffer(
 				logicalDevice,
 				QueueFamily::Graphics,
 				Array<const DataToBufferBatch, 2>{
-					DataToBufferBatch{m_vertexBuffer, Array<const DataToBuffer, 1>{DataToBuffer{0, vertexData}}},
-					DataToBufferBatch{m_indexBuffer, Array<const DataToBuffer, 1>{DataToBuffer{0, ConstByteView(indices)}}}
+					DataToBufferBatch{m_vertexBuffer, vertexData.GetView()},
+					DataToBufferBatch{m_indexBuffer, indexData.GetView().GetSubView(0u, 1u + levelOfDetailIndices.HasElements())}
 				},
 				stagingBuffer
 			);
@@ -100,8 +160,8 @@ namespace ngine::Rendering
 			if (isUnifiedGraphicsAndTransferQueue)
 			{
 				const Array<Rendering::BufferMemoryBarrier, 2> barriers{
-					Rendering::BufferMemoryBarrier{AccessFlags::TransferWrite, AccessFlags::VertexRead, m_vertexBuffer, 0, vertexData.GetDataSize()},
-					Rendering::BufferMemoryBarrier{AccessFlags::TransferWrite, AccessFlags::VertexRead, m_indexBuffer, 0, indices.GetDataSize()}
+					Rendering::BufferMemoryBarrier{AccessFlags::TransferWrite, AccessFlags::VertexRead, m_vertexBuffer, 0, vertexDataSize},
+					Rendering::BufferMemoryBarrier{AccessFlags::TransferWrite, AccessFlags::VertexRead, m_indexBuffer, 0, indexDataSize}
 				};
 
 				transferCommandEncoder.RecordPipelineBarrier(PipelineStageFlags::Transfer, PipelineStageFlags::VertexInput, {}, barriers.GetView());
@@ -117,7 +177,7 @@ namespace ngine::Rendering
 							logicalDevice.GetPhysicalDevice().GetQueueFamily(QueueFamily::Graphics),
 							m_vertexBuffer,
 							0,
-							vertexData.GetDataSize()
+							vertexDataSize
 						},
 						Rendering::BufferMemoryBarrier{
 							AccessFlags::TransferWrite,
@@ -126,7 +186,7 @@ namespace ngine::Rendering
 							logicalDevice.GetPhysicalDevice().GetQueueFamily(QueueFamily::Graphics),
 							m_indexBuffer,
 							0,
-							indices.GetDataSize(),
+							indexDataSize,
 						}
 					};
 
@@ -143,7 +203,7 @@ namespace ngine::Rendering
 							logicalDevice.GetPhysicalDevice().GetQueueFamily(QueueFamily::Graphics),
 							m_vertexBuffer,
 							0,
-							vertexData.GetDataSize()
+							vertexDataSize
 						},
 						Rendering::BufferMemoryBarrier{
 							AccessFlags(),
@@ -152,7 +212,7 @@ namespace ngine::Rendering
 							logicalDevice.GetPhysicalDevice().GetQueueFamily(QueueFamily::Graphics),
 							m_indexBuffer,
 							0,
-							indices.GetDataSize(),
+							indexDataSize,
 						}
 					};
 
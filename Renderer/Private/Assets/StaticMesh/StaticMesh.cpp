@@ -26,6 +26,14 @@ namespace ngine::Rendering
 		return previousObject;
 	}
 
+	void StaticMesh::ReleaseStaticObjectData()
+	{
+		Assert(!IsLoaded());
+		const Math::BoundingBox boundingBox = m_object.m_boundingBox;
+		m_object = StaticObject{};
+		m_object.m_boundingBox = boundingBox;
+	}
+
 	ConstByteView StaticMesh::GetVertexData() const LIFETIME_BOUND
 	{
 		const uint32 dataSize = static_cast<uint32>(
@@ -2,6 +2,7 @@
 
 #include <Renderer/Assets/StaticMesh/VertexColors.h>
 #include <Renderer/Assets/StaticMesh/VertexNormals.h>
+#include <Renderer/Assets/StaticMesh/QuantizedVertexPosition.h>
 
 #include <Common/Math/Half.h>
 #include <Common/Math/Vector2.h>
@@ -23,6 +24,104 @@ namespace ngine::Rendering
 {
 	using MultiView = MultiArrayView<VertexPosition, VertexNormals, VertexTextureCoordinate, VertexColors, Rendering::Index>;
 
+	//! Largest position error accepted when quantizing positions, half a millimeter
+	inline static constexpr float MaximumPositionQuantizationError = 0.0005f;
+	//! Largest texture coordinate error accepted at half precision for meshes with simplified levels, a quarter texel of a 1024 texture
+	//! Simplified levels already move vertices further than this, other meshes keep the lossless check
+	inline static constexpr float MaximumLevelOfDetailTextureCoordinateCompressionError = 1.f / 4096.f;
+	//! Meshes with fewer indices than this are cheap enough to not need simplified levels
+	inline static constexpr Index MinimumLevelOfDetailIndexCount = 32 * 3;
+	//! Levels with a larger error would not be selected even at the smallest screen size class
+	inline static constexpr float MaximumLevelOfDetailError =
+		MaximumLevelOfDetailScreenError * float(1u << (ScreenSizeClassCount - 1)) / (1.f + ScreenSizeClassHysteresis);
+
+	[[nodiscard]] static size GetIndexSize(const IndexType indexType)
+	{
+		switch (indexType)
+		{
+			case IndexType::UInt32:
+				return sizeof(uint32);
+			case IndexType::UInt16:
+				return sizeof(uint16);
+			case IndexType::UInt8:
+				return sizeof(uint8);
+		}
+		ExpectUnreachable();
+	}
+
+	template<typename StoredIndexType>
+	[[nodiscard]] static bool ReadIndices(ConstByteView& data, const ArrayView<Index, Index> indices)
+	{
+		if constexpr (TypeTraits::IsSame<StoredIndexType, Rendering::Index>)
+		{
+			return data.ReadIntoViewAndSkip(indices);
+		}
+		else
+		{
+			if (UNLIKELY(data.GetDataSize() < sizeof(StoredIndexType) * indices.GetSize()))
+			{
+				return false;
+			}
+			for (Index& index : indices)
+			{
+				index = *data.ReadAndSkip<StoredIndexType>();
+			}
+			return true;
+		}
+	}
+
+	[[nodiscard]] static bool ReadIndices(ConstByteView& data, const IndexType indexType, const ArrayView<Index, Index> indices)
+	{
+		switch (indexType)
+		{
+			case IndexType::UInt32:
+				return ReadIndices<uint32>(data, indices);
+			case IndexType::UInt16:
+				return ReadIndices<uint16>(data, indices);
+			case IndexType::UInt8:
+				return ReadIndices<uint8>(data, indices);
+		}
+		ExpectUnreachable();
+	}
+
+	template<typename StoredIndexType>
+	static void WriteIndices(const IO::FileView outputFile, const ArrayView<const Index, Index> indices)
+	{
+		if constexpr (TypeTraits::IsSame<StoredIndexType, Rendering::Index>)
+		{
+			outputFile.Write(indices);
+		}
+		else
+		{
+			FixedSizeVector<StoredIndexType, Rendering::Index> storedIndices(Memory::ConstructWithSize, Memory::Uninitialized, indices.GetSize());
+			ArrayView<StoredIndexType, Rendering::Index> storedIndexView = storedIndices.GetView();
+
+			for (const Rendering::Index index : indices)
+			{
+				storedIndexView[0] = (StoredIndexType)index;
+				storedIndexView++;
+			}
+
+			outputFile.Write(storedIndices.GetView());
+		}
+	}
+
+	static void WriteIndices(const IO::FileView outputFile, const IndexType indexType, const ArrayView<const Index, Index> indices)
+	{
+		switch (indexType)
+		{
+			case IndexType::UInt32:
+				WriteIndices<uint32>(outputFile, indices);
+				break;
+			case IndexType::UInt16:
+				WriteIndices<uint16>(outputFile, indices);
+				break;
+			case IndexType::UInt8:
+				WriteIndices<uint8>(outputFile, indices);
+				break;
+		}
+	}
+
 	uint8 StaticObject::GetUsedVertexColorSlotCount() const
 	{
 		uint8 count = 0;
@@ -67,14 +166,21 @@ namespace ngine::Rendering
 
 			size requiredSize = 0;
 
-			switch (GetFloatPrecision(flags, Flags::HalfPointPrecisionPositions))
+			if (flags.IsSet(Flags::QuantizedPositions))
 			{
-				case FloatPrecision::Single:
-					requiredSize += sizeof(Math::UnalignedVector3<float>) * vertexCount;
-					break;
-				case FloatPrecision::Half:
-					requiredSize += sizeof(Math::UnalignedVector3<half>) * vertexCount;
-					break;
+				requiredSize += sizeof(WrittenBounds) + sizeof(QuantizedVertexPosition) * vertexCount;
+			}
+			else
+			{
+				switch (GetFloatPrecision(flags, Flags::HalfPointPrecisionPositions))
+				{
+					case FloatPrecision::Single:
+						requiredSize += sizeof(Math::UnalignedVector3<float>) * vertexCount;
+						break;
+					case FloatPrecision::Half:
+						requiredSize += sizeof(Math::UnalignedVector3<half>) * vertexCount;
+						break;
+				}
 			}
 			requiredSize += sizeof(VertexNormals) * vertexCount;
 			switch (GetFloatPrecision(flags, Flags::HalfPointPrecisionTextureCoordinates))
@@ -102,18 +208,7 @@ namespace ngine::Rendering
 				}
 			}
 
-			switch (GetIndexType(flags))
-			{
-				case IndexType::UInt32:
-					requiredSize += sizeof(uint32) * indexCount;
-					break;
-				case IndexType::UInt16:
-					requiredSize += sizeof(uint16) * indexCount;
-					break;
-				case IndexType::UInt8:
-					requiredSize += sizeof(uint8) * indexCount;
-					break;
-			}
+			requiredSize += GetIndexSize(GetIndexType(flags)) * indexCount;
 
 			requiredSize += sizeof(WrittenBounds);
 
@@ -127,29 +222,43 @@ namespace ngine::Rendering
 			LogWarningIf(m_vertexCount == 0 || m_indexCount == 0, "Mesh vertex or index count invalid!");
 
 			// Read vertex positions
-			switch (GetFloatPrecision(m_flags, Flags::HalfPointPrecisionPositions))
+			if (m_flags.IsSet(Flags::QuantizedPositions))
 			{
-				case FloatPrecision::Single:
+				const Math::BoundingBox quantizationBounds = *data.ReadAndSkip<const WrittenBounds>();
+				const PositionQuantization quantization(quantizationBounds.GetMinimum(), quantizationBounds.GetMaximum());
+
+				ArrayView<VertexPosition, Rendering::Index> positions = GetVertexElementView<VertexPosition>();
+				for (Rendering::Index vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
 				{
-					ArrayView<VertexPosition, Rendering::Index> positions = GetVertexElementView<VertexPosition>();
-					for (Rendering::Index vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
-					{
-						positions[vertexIndex] = *data.ReadAndSkip<Math::UnalignedVector3<float>>();
-					}
+					positions[vertexIndex] = quantization.Dequantize(*data.ReadAndSkip<QuantizedVertexPosition>());
 				}
-				break;
-				case FloatPrecision::Half:
+			}
+			else
+			{
+				switch (GetFloatPrecision(m_flags, Flags::HalfPointPrecisionPositions))
 				{
-					if (LIKELY(data.GetDataSize() >= sizeof(Math::UnalignedVector3<half>) * m_vertexCount))
+					case FloatPrecision::Single:
 					{
 						ArrayView<VertexPosition, Rendering::Index> positions = GetVertexElementView<VertexPosition>();
 						for (Rendering::Index vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
 						{
-							positions[vertexIndex] = (Math::Vector3f)(Math::Vector3h)*data.ReadAndSkip<Math::UnalignedVector3<half>>();
+							positions[vertexIndex] = *data.ReadAndSkip<Math::UnalignedVector3<float>>();
 						}
 					}
+					break;
+					case FloatPrecision::Half:
+					{
+						if (LIKELY(data.GetDataSize() >= sizeof(Math::UnalignedVector3<half>) * m_vertexCount))
+						{
+							ArrayView<VertexPosition, Rendering::Index> positions = GetVertexElementView<VertexPosition>();
+							for (Rendering::Index vertexIndex = 0; vertexIndex < m_vertexCount; ++vertexIndex)
+							{
+								positions[vertexIndex] = (Math::Vector3f)(Math::Vector3h)*data.ReadAndSkip<Math::UnalignedVector3<half>>();
+							}
+						}
+					}
+					break;
 				}
-				break;
 			}
 
 			// Read vertex normals
@@ -222,57 +331,61 @@ namespace ngine::Rendering
 				}
 			}
 
-			switch (GetIndexType(m_flags))
+			[[maybe_unused]] const bool readIndices = ReadIndices(data, GetIndexType(m_flags), GetIndices());
+			LogWarningIf(!readIndices, "Could not read mesh indices");
+
+			m_boundingBox = *data.ReadAndSkip<const WrittenBounds>();
+
+			// Read simplified levels of detail
+			if (version >= 1)
 			{
-				case IndexType::UInt32:
+				const uint8 levelOfDetailCount = data.ReadAndSkipWithDefaultValue<uint8>(0);
+				const bool canReadLevelsOfDetail = (levelOfDetailCount < MaximumLevelOfDetailCount) &
+				                                   (data.GetDataSize() >= (sizeof(Rendering::Index) + sizeof(float)) * levelOfDetailCount);
+				if (LIKELY(canReadLevelsOfDetail))
 				{
-					if constexpr (TypeTraits::IsSame<uint32, Rendering::Index>)
+					Rendering::Index levelOfDetailIndexCount = 0;
+					for (uint8 levelOfDetailIndex = 0; levelOfDetailIndex < levelOfDetailCount; ++levelOfDetailIndex)
 					{
-						[[maybe_unused]] const bool readIndices = data.ReadIntoViewAndSkip(GetIndices());
-						LogWarningIf(!readIndices, "Could not read mesh indices");
+						const Rendering::Index indexCount = *data.ReadAndSkip<Rendering::Index>();
+						const float error = *data.ReadAndSkip<float>();
+						m_levelsOfDetail.EmplaceBack(MeshLevelOfDetail{m_indexCount + levelOfDetailIndexCount, indexCount, error});
+						levelOfDetailIndexCount += indexCount;
 					}
-					else
+
+					m_levelOfDetailIndices =
+						Vector<Rendering::Index, Rendering::Index>(Memory::ConstructWithSize, Memory::Uninitialized, levelOfDetailIndexCount);
+					if (UNLIKELY(!ReadIndices(data, GetIndexType(m_flags), m_levelOfDetailIndices.GetView())))
 					{
-						ExpectUnreachable();
+						LogWarning("Could not read mesh level of detail indices");
+						ClearLevelsOfDetail();
 					}
 				}
-				break;
-				case IndexType::UInt16:
+			}
+
+			// Read meshlets
+			if (version >= 2)
+			{
+				const Rendering::Index meshletCount = data.ReadAndSkipWithDefaultValue<Rendering::Index>(0);
+				if (LIKELY(data.GetDataSize() >= sizeof(Meshlet) * meshletCount))
 				{
-					if constexpr (TypeTraits::IsSame<uint16, Rendering::Index>)
-					{
-						[[maybe_unused]] const bool readIndices = data.ReadIntoViewAndSkip(GetIndices());
-						LogWarningIf(!readIndices, "Could not read mesh indices");
-					}
-					else
-					{
-						if (LIKELY(data.GetDataSize() >= sizeof(uint16) * m_indexCount))
-						{
-							ArrayView<Index, Rendering::Index> indices = GetIndices();
-							for (Rendering::Index index = 0; index < m_indexCount; ++index)
-							{
-								indices[index] = *data.ReadAndSkip<uint16>();
-							}
-						}
-					}
+					m_meshlets = Vector<Meshlet, Rendering::Index>(Memory::ConstructWithSize, Memory::Uninitialized, meshletCount);
+					[[maybe_unused]] const bool readMeshlets = data.ReadIntoViewAndSkip(m_meshlets.GetView());
+					Assert(readMeshlets);
 				}
-				break;
-				case IndexType::UInt8:
-				{
-					if (LIKELY(data.GetDataSize() >= sizeof(uint8) * m_indexCount))
+
+				const bool areMeshletsValid = m_meshlets.GetView().All(
+					[indexCount = m_indexCount + m_levelOfDetailIndices.GetSize()](const Meshlet& meshlet)
 					{
-						static_assert(!TypeTraits::IsSame<uint8, Rendering::Index>);
-						ArrayView<Index, Rendering::Index> indices = GetIndices();
-						for (Rendering::Index index = 0; index < m_indexCount; ++index)
-						{
-							indices[index] = *data.ReadAndSkip<uint8>();
-						}
+						return meshlet.m_firstIndex + meshlet.m_indexCount <= indexCount;
 					}
+				);
+				if (UNLIKELY(m_meshlets.GetSize() != meshletCount || !areMeshletsValid))
+				{
+					LogWarning("Could not read mesh meshlets");
+					m_meshlets.Clear();
 				}
-				break;
 			}
-
-			m_boundingBox = *data.ReadAndSkip<const WrittenBounds>();
 		}
 		else
 		{
@@ -328,8 +441,18 @@ namespace ngine::Rendering
 			return result.GetFlags();
 		}(GetVertexElementView<VertexPosition>());
 
-		// Check if we can compress texture coordinates without losing precision
-		flags |= [](const ArrayView<const VertexTextureCoordinate, Rendering::Index> vertexTextureCoordinates)
+		// Otherwise quantize positions within the mesh bounds if the step is small enough
+		const Math::BoundingBox quantizationBounds = CalculateBoundingBox();
+		const PositionQuantization quantization(quantizationBounds.GetMinimum(), quantizationBounds.GetMaximum());
+		if (!flags.IsSet(Flags::HalfPointPrecisionPositions) && quantization.GetMaximumError() <= MaximumPositionQuantizationError)
+		{
+			flags |= Flags::QuantizedPositions;
+		}
+
+		// Check if we can compress texture coordinates without losing precision, or while staying within a fraction of a texel for meshes with simplified levels
+		const float maximumTextureCoordinateError = m_levelsOfDetail.HasElements() ? MaximumLevelOfDetailTextureCoordinateCompressionError
+		                                                                            : Math::NumericLimits<float>::Epsilon;
+		flags |= [maximumTextureCoordinateError](const ArrayView<const VertexTextureCoordinate, Rendering::Index> vertexTextureCoordinates)
 		{
 			EnumFlags<Flags> result = Flags::HalfPointPrecisionTextureCoordinates;
 
@@ -341,14 +464,14 @@ namespace ngine::Rendering
 				const Math::Vector2d decompressedCoordinate = (Math::Vector2d)(Math::Vector2f)compressedCordinate;
 				const Math::Vector2f renormalizedCoordinate = Math::Vector2f(decompressedCoordinate);
 
-				const bool isWithinEpsilon = renormalizedCoordinate.IsEquivalentTo(textureCoordinates, Math::NumericLimits<float>::Epsilon);
+				const bool isWithinEpsilon = renormalizedCoordinate.IsEquivalentTo(textureCoordinates, maximumTextureCoordinateError);
 				result &= ~((Flags::HalfPointPrecisionTextureCoordinates) * !isWithinEpsilon);
 			}
 
 			return result.GetFlags();
 		}(GetVertexElementView<VertexTextureCoordinate>());
 
-		flags |= m_flags;
+		flags |= m_flags & ~Flags::QuantizedPositions;
 
 		outputFile.Write(flags);
 
@@ -356,40 +479,59 @@ namespace ngine::Rendering
 		outputFile.Write(m_indexCount);
 
 		// Write vertex positions
-		switch (GetFloatPrecision(flags, Flags::HalfPointPrecisionPositions))
+		if (flags.IsSet(Flags::QuantizedPositions))
 		{
-			case FloatPrecision::Single:
-			{
-				FixedSizeVector<Math::UnalignedVector3<float>, Rendering::Index>
-					positions(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
-				ArrayView<Math::UnalignedVector3<float>, Rendering::Index> positionsView = positions.GetView();
+			WrittenBounds bounds = quantizationBounds;
+			outputFile.Write(ConstByteView::Make(bounds));
 
-				for (const VertexPosition& __restrict vertexPosition : GetVertexElementView<VertexPosition>())
-				{
-					positionsView[0] = (Math::UnalignedVector3<float>)vertexPosition;
-					positionsView++;
-				}
+			FixedSizeVector<QuantizedVertexPosition, Rendering::Index> positions(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
+			ArrayView<QuantizedVertexPosition, Rendering::Index> positionsView = positions.GetView();
 
-				outputFile.Write(positions.GetView());
-			}
-			break;
-			case FloatPrecision::Half:
+			for (const VertexPosition& __restrict vertexPosition : GetVertexElementView<VertexPosition>())
 			{
-				FixedSizeVector<Math::UnalignedVector3<half>, Rendering::Index>
-					positions(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
-				ArrayView<Math::UnalignedVector3<half>, Rendering::Index> positionsView = positions.GetView();
+				positionsView[0] = quantization.Quantize(vertexPosition);
+				positionsView++;
+			}
 
-				for (const VertexPosition& __restrict vertexPosition : GetVertexElementView<VertexPosition>())
+			outputFile.Write(positions.GetView());
+		}
+		else
+		{
+			switch (GetFloatPrecision(flags, Flags::HalfPointPrecisionPositions))
+			{
+				case FloatPrecision::Single:
 				{
-					const Math::Vector3h compressedPosition = (Math::Vector3h)vertexPosition;
+					FixedSizeVector<Math::UnalignedVector3<float>, Rendering::Index>
+						positions(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
+					ArrayView<Math::UnalignedVector3<float>, Rendering::Index> positionsView = positions.GetView();
 
-					positionsView[0] = (Math::UnalignedVector3<half>)compressedPosition;
-					positionsView++;
+					for (const VertexPosition& __restrict vertexPosition : GetVertexElementView<VertexPosition>())
+					{
+						positionsView[0] = (Math::UnalignedVector3<float>)vertexPosition;
+						positionsView++;
+					}
+
+					outputFile.Write(positions.GetView());
 				}
+				break;
+				case FloatPrecision::Half:
+				{
+					FixedSizeVector<Math::UnalignedVector3<half>, Rendering::Index>
+						positions(Memory::ConstructWithSize, Memory::Uninitialized, m_vertexCount);
+					ArrayView<Math::UnalignedVector3<half>, Rendering::Index> positionsView = positions.GetView();
+
+					for (const VertexPosition& __restrict vertexPosition : GetVertexElementView<VertexPosition>())
+					{
+						const Math::Vector3h compressedPosition = (Math::Vector3h)vertexPosition;
 
-				outputFile.Write(positions.GetView());
+						positionsView[0] = (Math::UnalignedVector3<half>)compressedPosition;
+						positionsView++;
+					}
+
+					outputFile.Write(positions.GetView());
+				}
+				break;
 			}
-			break;
 		}
 
 		// Write vertex normals
@@ -483,60 +625,23 @@ namespace ngine::Rendering
 			outputFile.Write(writtenVertexColors.GetView().GetSubView(0, writtenVertexColors.GetSize() - 1));
 		}
 
-		switch (GetIndexType(flags))
-		{
-			case IndexType::UInt32:
-			{
-				if constexpr (TypeTraits::IsSame<uint32, Rendering::Index>)
-				{
-					outputFile.Write(GetIndices());
-				}
-				else
-				{
-					ExpectUnreachable();
-				}
-			}
-			break;
-			case IndexType::UInt16:
-			{
-				if constexpr (TypeTraits::IsSame<uint16, Rendering::Index>)
-				{
-					outputFile.Write(GetIndices());
-				}
-				else
-				{
-					FixedSizeVector<uint16, Rendering::Index> indices(Memory::ConstructWithSize, Memory::Uninitialized, GetIndexCount());
-					ArrayView<uint16, Rendering::Index> indexView = indices.GetView();
+		WriteIndices(outputFile, GetIndexType(flags), GetIndices());
 
-					for (const Rendering::Index index : GetIndices())
-					{
-						indexView[0] = (uint16)index;
-						indexView++;
-					}
-
-					outputFile.Write(indices.GetView());
-				}
-			}
-			break;
-			case IndexType::UInt8:
-			{
-				static_assert(!TypeTraits::IsSame<uint8, Rendering::Index>);
-				FixedSizeVector<uint8, Rendering::Index> indices(Memory::ConstructWithSize, Memory::Uninitialized, GetIndexCount());
-				ArrayView<uint8, Rendering::Index> indexView = indices.GetView();
-
-				for (const Rendering::Index index : GetIndices())
-				{
-					indexView[0] = (uint8)index;
-					indexView++;
-				}
+		WrittenBounds bounds = m_boundingBox;
+		outputFile.Write(ConstByteView::Make(bounds));
 
-				outputFile.Write(indices.GetView());
-			}
-			break;
+		// Write simplified levels of detail
+		outputFile.Write(m_levelsOfDetail.GetSize());
+		for (const MeshLevelOfDetail& levelOfDetail : m_levelsOfDetail)
+		{
+			outputFile.Write(levelOfDetail.m_indexCount);
+			outputFile.Write(levelOfDetail.m_error);
 		}
+		WriteIndices(outputFile, GetIndexType(flags), m_levelOfDetailIndices.GetView());
 
-		WrittenBounds bounds = m_boundingBox;
-		outputFile.Write(ConstByteView::Make(bounds));
+		// Write meshlets
+		outputFile.Write(m_meshlets.GetSize());
+		outputFile.Write(m_meshlets.GetView());
 	}
 
 	Math::BoundingBox StaticObject::CalculateBoundingBox() const
@@ -685,6 +790,61 @@ namespace ngine::Rendering
 		return {reinterpret_cast<const Index*>(m_data.GetData() + offset), m_indexCount};
 	}
 
+	void StaticObject::GenerateMeshlets()
+	{
+		const ArrayView<const VertexPosition, Index> vertexPositions = GetVertexElementView<VertexPosition>();
+		Meshlets::Build(vertexPositions, GetIndices(), m_meshlets);
+
+		// Meshlets of simplified levels index into the same buffer, after the full detail indices
+		Vector<Meshlet, Index> levelOfDetailMeshlets;
+		for (const MeshLevelOfDetail& levelOfDetail : m_levelsOfDetail)
+		{
+			const Index firstLevelOfDetailIndex = levelOfDetail.m_firstIndex - m_indexCount;
+			Meshlets::Build(
+				vertexPositions,
+				m_levelOfDetailIndices.GetView().GetSubView(firstLevelOfDetailIndex, levelOfDetail.m_indexCount),
+				levelOfDetailMeshlets
+			);
+			for (Meshlet& meshlet : levelOfDetailMeshlets)
+			{
+				meshlet.m_firstIndex += levelOfDetail.m_firstIndex;
+			}
+			m_meshlets.CopyEmplaceRangeBack(levelOfDetailMeshlets.GetView());
+		}
+	}
+
+	void StaticObject::GenerateLevelsOfDetail()
+	{
+		ClearLevelsOfDetail();
+
+		const ArrayView<const VertexPosition, Index> vertexPositions = GetVertexElementView<VertexPosition>();
+		const ArrayView<const Index, Index> indices = GetIndices();
+
+		// Each level is simplified from the full detail indices to avoid accumulating error
+		Vector<Index, Index> simplifiedIndices;
+		Index previousIndexCount = m_indexCount;
+		while (m_levelsOfDetail.GetSize() < m_levelsOfDetail.GetCapacity())
+		{
+			const Index targetIndexCount = (previousIndexCount / 6) * 3;
+			if (targetIndexCount < MinimumLevelOfDetailIndexCount)
+			{
+				break;
+			}
+
+			const float error = MeshSimplification::Generate(vertexPositions, indices, targetIndexCount, simplifiedIndices);
+			const bool isUseful = (simplifiedIndices.GetSize() >= MinimumLevelOfDetailIndexCount) &
+			                      (simplifiedIndices.GetSize() <= previousIndexCount / 4 * 3) & (error <= MaximumLevelOfDetailError);
+			if (!isUseful)
+			{
+				break;
+			}
+
+			m_levelsOfDetail.EmplaceBack(MeshLevelOfDetail{m_indexCount + m_levelOfDetailIndices.GetSize(), simplifiedIndices.GetSize(), error});
+			m_levelOfDetailIndices.CopyEmplaceRangeBack(simplifiedIndices.GetView());
+			previousIndexCount = simplifiedIndices.GetSize();
+		}
+	}
+
 	void StaticObject::TransformRotation(const Math::Quaternionf quaternion)
 	{
 		const ArrayView<VertexPosition, Rendering::Index> positions = GetVertexElementView<VertexPosition>();
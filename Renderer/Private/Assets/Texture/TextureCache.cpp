@@ -12,6 +12,7 @@
 #include <Renderer/Assets/Texture/RenderTexture.h>
 #include <Renderer/Assets/Texture/RenderTargetAsset.h>
 #include <Renderer/Assets/Texture/MipMask.h>
+#include <Renderer/Assets/Texture/TextureStreaming.h>
 #include <Renderer/Wrappers/ImageMapping.h>
 #include <Renderer/Jobs/QueueSubmissionJob.h>
 #include <Renderer/Threading/Semaphore.h>
@@ -37,6 +38,8 @@
 #include <Common/Asset/Reference.h>
 #include <Common/Threading/Jobs/JobBatch.h>
 #include <Common/IO/Log.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Time/Duration.h>
 #include <Common/Serialization/Deserialize.h>
 
 namespace ngine::Rendering
@@ -449,18 +452,38 @@ namespace ngine::Rendering
 						);
 					}
 
-					m_allMipsMask = validMipsMask;
-
 					Rendering::TextureCache& textureCache = m_logicalDevice.GetRenderer().GetTextureCache();
+					textureCache.SetTextureAssetMips(m_logicalDevice.GetIdentifier(), m_identifier, validMipsMask);
+
 					const MipMask initiallyRequestedMips = textureCache.GetRequestedTextureMips(m_logicalDevice.GetIdentifier(), m_identifier);
 					MipMask requestedMips = initiallyRequestedMips & validMipsMask;
+					if (!requestedMips.AreAnySet())
+					{
+						// Requested mip wasn't available, pick the highest resolution one
+						requestedMips = MipMask::FromIndex(*validMipsMask.GetLastIndex());
+					}
 
 					// Ensure that we load all mips in the range
 					MipMask::StoredType firstRequestedMipIndex = *requestedMips.GetFirstIndex();
 					MipMask::StoredType lastRequestedMipIndex = *requestedMips.GetLastIndex();
 					requestedMips = MipMask::FromRange(MipRange(firstRequestedMipIndex, lastRequestedMipIndex - firstRequestedMipIndex + 1));
 
-					if (const Optional<RenderTexture*> pExistingTexture = textureCache.GetRenderTexture(m_logicalDevice.GetIdentifier(), m_identifier))
+					// Only allocate mips up to the largest requested one, streamed textures are recreated when it changes
+					m_allMipsMask = TextureStreaming::GetAllocatedMips(validMipsMask, requestedMips);
+
+					const Optional<RenderTexture*> pExistingTexture = textureCache.GetRenderTexture(m_logicalDevice.GetIdentifier(), m_identifier);
+					if (pExistingTexture.IsValid() && pExistingTexture->GetTotalMipMask() != m_allMipsMask)
+					{
+						// The image is replaced once the new one holds all previously loaded mips it contains, avoiding a drop in quality
+						// Evicting mips this way releases their memory with the previous image
+						m_replacedMips = pExistingTexture->GetLoadedMipMask() & m_allMipsMask;
+						if (m_replacedMips.AreAnySet())
+						{
+							firstRequestedMipIndex = Math::Min(firstRequestedMipIndex, *m_replacedMips.GetFirstIndex());
+							requestedMips = MipMask::FromRange(MipRange(firstRequestedMipIndex, lastRequestedMipIndex - firstRequestedMipIndex + 1));
+						}
+					}
+					else if (pExistingTexture.IsValid())
 					{
 						m_textureView = *pExistingTexture;
 						m_pRenderTexture = pExistingTexture;
@@ -484,13 +507,6 @@ namespace ngine::Rendering
 						}
 					}
 
-					if (!requestedMips.AreAnySet())
-					{
-						// Requested mip wasn't available, pick the highest resolution one
-						const uint16 highestMipMaskIndex = *validMipsMask.GetLastIndex();
-						requestedMips = MipMask::FromIndex(highestMipMaskIndex);
-					}
-
 					const uint16 totalRequestedMipCount = requestedMips.GetSize();
 					m_totalRequestedMipCount = totalRequestedMipCount;
 
@@ -505,7 +521,7 @@ namespace ngine::Rendering
 						{
 							return Result::AwaitExternalFinish;
 						}
-						else if (UNLIKELY_ERROR(!CreateRenderTexture(validMipsMask, currentMipMask)))
+						else if (UNLIKELY_ERROR(!CreateRenderTexture(m_allMipsMask, currentMipMask)))
 						{
 							return Result::FinishedAndDelete;
 						}
@@ -683,6 +699,7 @@ namespace ngine::Rendering
 				case LoadStatus::AwaitingMipTransfer:
 				{
 					const uint16 currentMipIndex = GetCurrentRelativeMipIndex();
+					const uint16 imageMipIndex = GetCurrentImageMipIndex();
 
 					const Math::Vector2ui mipSize = m_textureAsset.GetResolution() >> currentMipIndex;
 
@@ -703,7 +720,7 @@ namespace ngine::Rendering
 						bytesPerDimension,
 						formatInfo.GetBlockCount(mipSize),
 						formatInfo.m_blockExtent,
-						SubresourceLayers{ImageAspectFlags::Color, currentMipIndex, ArrayRange{0, m_textureAsset.GetArraySize()}},
+						SubresourceLayers{ImageAspectFlags::Color, imageMipIndex, ArrayRange{0, m_textureAsset.GetArraySize()}},
 						Math::Vector3i{0, 0, 0},
 						Math::Vector3ui{mipSize.x, mipSize.y, 1}
 					}};
@@ -728,7 +745,7 @@ namespace ngine::Rendering
 							*m_pRenderTexture,
 							Rendering::ImageSubresourceRange{
 								ImageAspectFlags::Color,
-								MipRange{currentMipIndex, 1},
+								MipRange{imageMipIndex, 1},
 								ArrayRange {
 									0,
 									m_textureAsset.GetArraySize()
@@ -759,7 +776,7 @@ namespace ngine::Rendering
 							*m_pRenderTexture,
 							Rendering::ImageSubresourceRange{
 								ImageAspectFlags::Color,
-								MipRange{currentMipIndex, 1},
+								MipRange{imageMipIndex, 1},
 								ArrayRange {
 									0,
 									m_textureAsset.GetArraySize()
@@ -779,7 +796,7 @@ namespace ngine::Rendering
 								*m_pRenderTexture,
 								Rendering::ImageSubresourceRange{
 									ImageAspectFlags::Color,
-									MipRange{currentMipIndex, 1},
+									MipRange{imageMipIndex, 1},
 									ArrayRange {
 										0,
 										m_textureAsset.GetArraySize()
@@ -803,10 +820,10 @@ namespace ngine::Rendering
 								AccessFlags::ShaderRead,
 								ImageLayout::ShaderReadOnlyOptimal,
 								m_logicalDevice.GetPhysicalDevice().GetQueueFamily(QueueFamily::Graphics),
-								m_ownedRenderTexture,
+								*m_pRenderTexture,
 								Rendering::ImageSubresourceRange{
 									ImageAspectFlags::Color,
-									MipRange{currentMipIndex, 1},
+									MipRange{imageMipIndex, 1},
 									ArrayRange {
 										0,
 										m_textureAsset.GetArraySize()
@@ -1035,21 +1052,30 @@ namespace ngine::Rendering
 				{
 					if (m_ownedRenderTexture.IsValid())
 					{
-						// First mip was loaded, assign the initial render texture
-						RenderTexture previousTexture;
-						TextureCache& textureCache = m_logicalDevice.GetRenderer().GetTextureCache();
-						textureCache.AssignRenderTexture(
-							m_logicalDevice.GetIdentifier(),
-							m_identifier,
-							Move(m_ownedRenderTexture),
-							previousTexture,
-							LoadedTextureFlags{}
-						);
-						m_pRenderTexture = textureCache.GetRenderTexture(m_logicalDevice.GetIdentifier(), m_identifier);
-						if (previousTexture.IsValid())
+						if ((m_ownedRenderTexture.GetLoadedMipMask() & m_currentMipMask).IsEmpty())
 						{
-							Threading::EngineJobRunnerThread& engineThread = static_cast<Threading::EngineJobRunnerThread&>(thread);
-							engineThread.GetRenderData().DestroyImage(m_logicalDevice.GetIdentifier(), Move(previousTexture));
+							// Another mip was loaded before the render texture replaced the previous one
+							m_ownedRenderTexture.OnMipsLoaded(m_currentMipMask);
+						}
+
+						if ((m_ownedRenderTexture.GetLoadedMipMask() & m_replacedMips) == m_replacedMips || m_remainingMips.IsEmpty())
+						{
+							// Assign the new render texture, replacing any previous one
+							RenderTexture previousTexture;
+							TextureCache& textureCache = m_logicalDevice.GetRenderer().GetTextureCache();
+							textureCache.AssignRenderTexture(
+								m_logicalDevice.GetIdentifier(),
+								m_identifier,
+								Move(m_ownedRenderTexture),
+								previousTexture,
+								LoadedTextureFlags{}
+							);
+							m_pRenderTexture = textureCache.GetRenderTexture(m_logicalDevice.GetIdentifier(), m_identifier);
+							if (previousTexture.IsValid())
+							{
+								Threading::EngineJobRunnerThread& engineThread = static_cast<Threading::EngineJobRunnerThread&>(thread);
+								engineThread.GetRenderData().DestroyImage(m_logicalDevice.GetIdentifier(), Move(previousTexture));
+							}
 						}
 					}
 					else
@@ -1130,7 +1156,9 @@ namespace ngine::Rendering
 
 			const Rendering::Format format = textureBinaryInfo.GetFormat();
 
-			const Math::Vector2ui resolution = m_textureAsset.GetResolution();
+			// Skip the asset's mips that are larger than the largest allocated one
+			const uint16 skippedMipCount = m_maximumMipCount - 1 - *allMipsMask.GetLastIndex();
+			const Math::Vector2ui resolution = m_textureAsset.GetResolution() >> skippedMipCount;
 
 			// Create the render texture
 			m_ownedRenderTexture = RenderTexture(
@@ -1201,6 +1229,11 @@ namespace ngine::Rendering
 		{
 			return (uint16)m_currentMipMask.GetRange(m_maximumMipCount).GetIndex();
 		}
+		//! Returns the level of the current mip in the render texture, which may not contain the largest mips of the asset
+		[[nodiscard]] uint16 GetCurrentImageMipIndex() const
+		{
+			return (uint16)m_currentMipMask.GetRange(*m_pRenderTexture->GetTotalMipMask().GetLastIndex() + 1).GetIndex();
+		}
 	protected:
 		LoadStatus m_status = LoadStatus::AwaitingInitialLoad;
 		UnifiedCommandBuffer m_graphicsCommandBuffer;
@@ -1213,7 +1246,10 @@ namespace ngine::Rendering
 		Vector<ByteType, size> m_stagingVector;
 #endif
 		MipMask m_remainingMips{0};
+		//! Mips allocated by the render texture, up to the largest requested one
 		MipMask m_allMipsMask;
+		//! Loaded mips of the texture being replaced, which the new render texture has to contain before it is assigned
+		MipMask m_replacedMips{0};
 		//! Mip mask containing the currently loaded mip index
 		MipMask m_currentMipMask;
 		uint16 m_maximumMipCount = 0u;
@@ -1243,7 +1279,14 @@ namespace ngine::Rendering
 		);
 	}
 
-	TextureCache::~TextureCache() = default;
+	TextureCache::~TextureCache()
+	{
+		for (TextureIdentifier::IndexType textureIndex = 0, textureCount = GetMaximumUsedIdentifierCount(); textureIndex < textureCount;
+		     ++textureIndex)
+		{
+			DeregisterStreamedTextureResources(TextureIdentifier::MakeFromValidIndex(textureIndex));
+		}
+	}
 
 	[[nodiscard]] inline UniquePtr<RenderTexture>
 	CreateDummyTexture(LogicalDevice& logicalDevice, const uint8 arraySize, const ImageFlags flags)
@@ -2140,9 +2183,29 @@ namespace ngine::Rendering
 
 	void TextureCache::Remove(const TextureIdentifier identifier)
 	{
+		DeregisterStreamedTextureResources(identifier);
 		BaseType::DeregisterAsset(identifier);
 	}
 
+	void TextureCache::DeregisterStreamedTextureResources(const TextureIdentifier identifier)
+	{
+		for (const UniquePtr<PerLogicalDeviceData>& pPerDeviceData : m_perLogicalDeviceData)
+		{
+			if (pPerDeviceData.IsValid())
+			{
+				Resource::Identifier& resourceIdentifier = pPerDeviceData->m_textureResourceIdentifiers[identifier];
+				if (resourceIdentifier.IsValid())
+				{
+					System::Get<Resource::Manager>().Deregister(resourceIdentifier);
+					resourceIdentifier = {};
+				}
+				pPerDeviceData->m_streamedTextures.Clear(identifier);
+				pPerDeviceData->m_evictedTextures.Clear(identifier);
+				pPerDeviceData->m_fullyResidentTextures.Clear(identifier);
+			}
+		}
+	}
+
 	RenderTexture& TextureCache::GetDummyTexture(const LogicalDeviceIdentifier deviceIdentifier, const ImageMappingType type) const
 	{
 		switch (type)
@@ -2196,13 +2259,20 @@ namespace ngine::Rendering
 		PerDeviceTextureData& perDeviceTextureData = GetOrCreatePerDeviceTextureData(perDeviceData, identifier);
 		perDeviceTextureData.m_onLoadedCallback.Emplace(Forward<TextureLoadListenerData>(newListenerData));
 
+		if (!flags.IsSet(TextureLoadFlags::Streamed) && !perDeviceData.m_fullyResidentTextures.IsSet(identifier))
+		{
+			perDeviceData.m_fullyResidentTextures.Set(identifier);
+		}
+
 		LogicalDevice& logicalDevice = *GetRenderer().GetLogicalDevice(deviceIdentifier);
 
 		if (perDeviceData.m_textures[identifier].IsValid())
 		{
 			RenderTexture& texture = *perDeviceData.m_textures[identifier];
 			const MipMask loadedMipMask = texture.GetLoadedMipMask();
-			const MipMask totalMipMask = texture.GetTotalMipMask();
+			// Streamed render textures may not contain all mips of the asset, the loading job grows them as needed
+			const MipMask assetMipMask{perDeviceTextureData.m_assetMips.Load()};
+			const MipMask totalMipMask = assetMipMask.AreAnySet() ? assetMipMask : texture.GetTotalMipMask();
 
 			// Exclude mips that don't exist
 			requestedMips &= totalMipMask;
@@ -2504,6 +2574,30 @@ namespace ngine::Rendering
 		return false;
 	}
 
+	void TextureCache::AddRenderTextureEvictListener(
+		const LogicalDeviceIdentifier deviceIdentifier, const TextureIdentifier identifier, TextureEvictListenerData&& listenerData
+	)
+	{
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
+		PerDeviceTextureData& textureData = GetOrCreatePerDeviceTextureData(perDeviceData, identifier);
+		textureData.m_onEvictedCallback.Emplace(Forward<TextureEvictListenerData>(listenerData));
+	}
+
+	bool TextureCache::RemoveRenderTextureEvictListener(
+		const LogicalDeviceIdentifier deviceIdentifier,
+		const TextureIdentifier identifier,
+		const TextureEvictListenerIdentifier listenerIdentifier
+	)
+	{
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
+		PerDeviceTextureData* pTextureData = perDeviceData.m_textureData[identifier];
+		if (LIKELY(pTextureData != nullptr))
+		{
+			return pTextureData->m_onEvictedCallback.Remove(listenerIdentifier);
+		}
+		return false;
+	}
+
 	void TextureCache::AssignRenderTexture(
 		const LogicalDeviceIdentifier deviceIdentifier,
 		const Rendering::TextureIdentifier identifier,
@@ -2594,23 +2688,27 @@ namespace ngine::Rendering
 
 		textureData.m_flags = flags;
 		textureData.m_onLoadedCallback(logicalDevice, identifier, storedTexture, storedTexture.GetLoadedMipMask(), flags);
+
+		if (previousTexture.IsValid())
+		{
+			// Streaming evicts mips by replacing the texture with a smaller one
+			const MipMask evictedMips = previousTexture.GetLoadedMipMask() & ~storedTexture.GetLoadedMipMask();
+			if (evictedMips.AreAnySet())
+			{
+				textureData.m_onEvictedCallback(logicalDevice, identifier, storedTexture, evictedMips);
+			}
+		}
 	}
 
-	void TextureCache::ChangeRenderTextureAvailableMips(
-		const LogicalDeviceIdentifier deviceIdentifier,
-		const Rendering::TextureIdentifier identifier,
-		const MipMask loadedMipValues,
-		const EnumFlags<LoadedTextureFlags> flags
+	void TextureCache::UpdateRenderTextureMapping(
+		LogicalDevice& logicalDevice,
+		PerLogicalDeviceData& perDeviceData,
+		PerDeviceTextureData& textureData,
+		RenderTexture& texture,
+		const TextureIdentifier identifier
 	)
 	{
-		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
-		RenderTexture& texture = *perDeviceData.m_textures[identifier];
-		texture.OnMipsLoaded(loadedMipValues);
-
-		PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier];
-		LogicalDevice& logicalDevice = *GetRenderer().GetLogicalDevice(deviceIdentifier);
 		Assert(texture.IsValid());
-
 		if (texture.GetUsageFlags().IsSet(UsageFlags::Sampled) && perDeviceData.m_texturesDescriptorSet.IsValid())
 		{
 			const ImageMappingType mappingType = texture.GetTotalArrayCount() == 6 ? ImageMappingType::Cube : ImageMappingType::TwoDimensional;
@@ -2646,13 +2744,217 @@ namespace ngine::Rendering
 			textureData.m_mapping.AtomicSwap(newMapping);
 
 			Threading::EngineJobRunnerThread& engineThread = *Threading::EngineJobRunnerThread::GetCurrent();
-			engineThread.GetRenderData().DestroyImageMapping(deviceIdentifier, Move(newMapping));
+			engineThread.GetRenderData().DestroyImageMapping(logicalDevice.GetIdentifier(), Move(newMapping));
 		}
+	}
+
+	void TextureCache::ChangeRenderTextureAvailableMips(
+		const LogicalDeviceIdentifier deviceIdentifier,
+		const Rendering::TextureIdentifier identifier,
+		const MipMask loadedMipValues,
+		const EnumFlags<LoadedTextureFlags> flags
+	)
+	{
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
+		RenderTexture& texture = *perDeviceData.m_textures[identifier];
+		texture.OnMipsLoaded(loadedMipValues);
+
+		PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier];
+		LogicalDevice& logicalDevice = *GetRenderer().GetLogicalDevice(deviceIdentifier);
+		UpdateRenderTextureMapping(logicalDevice, perDeviceData, textureData, texture, identifier);
 
 		textureData.m_flags = flags;
 		textureData.m_onLoadedCallback(logicalDevice, identifier, texture, loadedMipValues, flags);
 	}
 
+	void TextureCache::ReportTextureUsage(
+		const LogicalDeviceIdentifier deviceIdentifier, const TextureIdentifier identifier, const uint32 resolution
+	)
+	{
+		if (!m_isStreamingEnabled)
+		{
+			return;
+		}
+
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
+		if (perDeviceData.m_fullyResidentTextures.IsSet(identifier))
+		{
+			return;
+		}
+
+		if (PerDeviceTextureData* pTextureData = perDeviceData.m_textureData[identifier].Load())
+		{
+			pTextureData->m_streamingResolution.AssignMax(resolution);
+			if (!perDeviceData.m_streamedTextures.IsSet(identifier) && perDeviceData.m_streamedTextures.Set(identifier))
+			{
+				if (const Optional<Resource::Manager*> pResourceManager = System::Find<Resource::Manager>())
+				{
+					const Resource::Identifier resourceIdentifier = pResourceManager->Register(*this);
+					if (LIKELY(resourceIdentifier.IsValid()))
+					{
+						m_streamedTextureResources[resourceIdentifier] = StreamedTextureResource{identifier, deviceIdentifier};
+						perDeviceData.m_textureResourceIdentifiers[identifier] = resourceIdentifier;
+					}
+				}
+			}
+		}
+	}
+
+	void TextureCache::Unload(const Resource::Identifier resourceIdentifier)
+	{
+		const StreamedTextureResource streamedTexture = m_streamedTextureResources[resourceIdentifier];
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[streamedTexture.m_deviceIdentifier];
+		// Picked up by the next streaming update, which drops the texture to its always resident mips
+		perDeviceData.m_evictedTextures.Set(streamedTexture.m_textureIdentifier);
+	}
+
+	void TextureCache::Reload(const Resource::Identifier resourceIdentifier)
+	{
+		const StreamedTextureResource streamedTexture = m_streamedTextureResources[resourceIdentifier];
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[streamedTexture.m_deviceIdentifier];
+		// Streaming selects the mips for the current usage again on its next update
+		perDeviceData.m_evictedTextures.Clear(streamedTexture.m_textureIdentifier);
+	}
+
+	inline static constexpr Time::Durationf StreamingUpdateInterval{250_milliseconds};
+
+	void TextureCache::UpdateStreaming(LogicalDevice& logicalDevice)
+	{
+		if (!m_isStreamingEnabled)
+		{
+			return;
+		}
+
+		const LogicalDeviceIdentifier deviceIdentifier = logicalDevice.GetIdentifier();
+		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
+
+		bool expected = false;
+		if (!perDeviceData.m_isUpdatingStreaming.CompareExchangeStrong(expected, true))
+		{
+			return;
+		}
+
+		const Time::Timestamp currentTime = Time::Timestamp::GetCurrent();
+		if ((currentTime - perDeviceData.m_lastStreamingUpdateTime).GetDuration() < StreamingUpdateInterval)
+		{
+			perDeviceData.m_isUpdatingStreaming = false;
+			return;
+		}
+		perDeviceData.m_lastStreamingUpdateTime = currentTime;
+
+		// Resources are only registered for streamed textures while a resource manager exists
+		const Optional<Resource::Manager*> pResourceManager = System::Find<Resource::Manager>();
+
+		Vector<TextureIdentifier, uint32> textureIdentifiers;
+		Vector<TextureStreaming::TextureInfo, uint32> textures;
+		for (TextureIdentifier::IndexType textureIndex = 0, textureCount = GetMaximumUsedIdentifierCount(); textureIndex < textureCount;
+		     ++textureIndex)
+		{
+			const TextureIdentifier identifier = TextureIdentifier::MakeFromValidIndex(textureIndex);
+			// Textures pinned by a request that doesn't report usage keep all their requested mips
+			if (!perDeviceData.m_streamedTextures.IsSet(identifier) || perDeviceData.m_fullyResidentTextures.IsSet(identifier))
+			{
+				continue;
+			}
+
+			PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier].Load();
+			const uint32 resolution = textureData.m_streamingResolution.Exchange(0);
+			const Resource::Identifier resourceIdentifier = perDeviceData.m_textureResourceIdentifiers[identifier];
+			if (resolution > 0 && resourceIdentifier.IsValid())
+			{
+				// Visible textures are restored if the resource manager had evicted them
+				pResourceManager->MarkUsed(resourceIdentifier);
+			}
+
+			// The loading job replaces the render texture, so it can only be read while no load is in flight
+			// Textures that are loading are picked up again by the next update
+			if (perDeviceData.m_loadingTextures.IsSet(identifier))
+			{
+				continue;
+			}
+
+			const Optional<RenderTexture*> pTexture = perDeviceData.m_textures[identifier];
+			const MipMask assetMips{textureData.m_assetMips.Load()};
+			if (pTexture.IsInvalid() || assetMips.IsEmpty())
+			{
+				continue;
+			}
+
+			const Format format = pTexture->GetFormat();
+			const MipMask loadedMips = pTexture->GetLoadedMipMask();
+			const uint16 arrayCount = (uint16)pTexture->GetTotalArrayCount();
+			// Discard the snapshot if a load started while it was taken
+			if (perDeviceData.m_loadingTextures.IsSet(identifier))
+			{
+				continue;
+			}
+
+			const FormatInfo& __restrict formatInfo = GetFormatInfo(format);
+			textureIdentifiers.EmplaceBack(identifier);
+			textures.EmplaceBack(TextureStreaming::TextureInfo{assetMips, loadedMips, resolution, formatInfo.GetBitsPerPixel(), arrayCount});
+		}
+
+		Vector<MipMask, uint32> residentMips(Memory::ConstructWithSize, Memory::Uninitialized, textures.GetSize());
+		TextureStreaming::SelectResidentMips(textures.GetView(), m_streamingBudget, residentMips.GetView());
+
+		for (uint32 index = 0, count = textures.GetSize(); index < count; ++index)
+		{
+			const TextureIdentifier identifier = textureIdentifiers[index];
+			MipMask targetMips = residentMips[index];
+			if (const Resource::Identifier resourceIdentifier = perDeviceData.m_textureResourceIdentifiers[identifier]; resourceIdentifier.IsValid())
+			{
+				using ResourceState = Resource::Manager::Resource::State;
+				const ResourceState resourceState = pResourceManager->GetState(resourceIdentifier);
+				// A reload can be requested before the eviction reached the handler, in which case the texture is not clamped
+				if (perDeviceData.m_evictedTextures.IsSet(identifier) && resourceState != ResourceState::Reloading)
+				{
+					targetMips &= TextureStreaming::AlwaysResidentMips;
+				}
+				else if (resourceState != ResourceState::Evicted)
+				{
+					perDeviceData.m_evictedTextures.Clear(identifier);
+
+					uint64 targetSize = 0;
+					for (const MipMask::StoredType mipIndex : Memory::GetSetBitsIterator(targetMips.GetValue()))
+					{
+						targetSize += TextureStreaming::GetMipByteSize(textures[index], mipIndex);
+					}
+
+					PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier].Load();
+					if (resourceState != ResourceState::Loaded || targetSize != textureData.m_reportedStreamingSize)
+					{
+						textureData.m_reportedStreamingSize = targetSize;
+						// May evict other textures, which are dropped to their always resident mips by their next update
+						pResourceManager->OnLoaded(resourceIdentifier, 0, targetSize);
+					}
+				}
+			}
+
+			const MipMask loadedMips = textures[index].m_loadedMips;
+			if (targetMips == loadedMips)
+			{
+				continue;
+			}
+
+			// Textures that are already loading are picked up again by the next update
+			if (!perDeviceData.m_loadingTextures.Set(identifier))
+			{
+				continue;
+			}
+
+			PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier].Load();
+			textureData.m_requestedMips = targetMips.GetValue();
+
+			// The loading job recreates the render texture with the target mips, evicted ones are released with the previous image
+			if (const Optional<Threading::Job*> pLoadingJob = GetLoadingCallback(identifier)(identifier, logicalDevice))
+			{
+				pLoadingJob->Queue(System::Get<Threading::JobManager>());
+			}
+		}
+
+		perDeviceData.m_isUpdatingStreaming = false;
+	}
+
 	void TextureCache::OnTextureLoadFailed(const LogicalDeviceIdentifier deviceIdentifier, const Rendering::TextureIdentifier identifier)
 	{
 		PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
@@ -2671,14 +2973,17 @@ namespace ngine::Rendering
 		[[maybe_unused]] const bool wasCleared = perDeviceData.m_loadingTextures.Clear(identifier);
 		Assert(wasCleared);
 
-		if constexpr (DEBUG_BUILD)
+		// Mips requested while the texture was loading are picked up by another load
+		const Optional<RenderTexture*> pTexture = perDeviceData.m_textures[identifier];
+		const PerDeviceTextureData& textureData = *perDeviceData.m_textureData[identifier];
+		const MipMask requestedMips = MipMask{textureData.m_requestedMips.Load()} & MipMask{textureData.m_assetMips.Load()};
+		if (pTexture.IsValid() && (requestedMips & ~pTexture->GetLoadedMipMask()).AreAnySet() && perDeviceData.m_loadingTextures.Set(identifier))
 		{
-			RenderTexture& texture = *perDeviceData.m_textures[identifier];
-			[[maybe_unused]] MipMask requestedMips = MipMask{perDeviceData.m_textureData[identifier]->m_requestedMips.Load()};
-			[[maybe_unused]] const MipMask totalMips = texture.GetTotalMipMask();
-			requestedMips &= totalMips;
-
-			[[maybe_unused]] const MipMask loadedMips = texture.GetLoadedMipMask();
+			LogicalDevice& logicalDevice = *GetRenderer().GetLogicalDevice(deviceIdentifier);
+			if (const Optional<Threading::Job*> pLoadingJob = GetLoadingCallback(identifier)(identifier, logicalDevice))
+			{
+				pLoadingJob->Queue(System::Get<Threading::JobManager>());
+			}
 		}
 	}
 
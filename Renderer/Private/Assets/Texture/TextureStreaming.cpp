@@ -0,0 +1,148 @@
+#include "Assets/Texture/TextureStreaming.h"
+
+#include <Common/Algorithms/Sort.h>
+#include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Vector2.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Rendering::TextureStreaming
+{
+	namespace Internal
+	{
+		struct Candidate
+		{
+			uint32 m_textureIndex;
+			MipMask::StoredType m_mipIndex;
+			//! Whether the mip is needed at the texture's current screen coverage, otherwise it is only kept as a cache
+			bool m_isRequired;
+			float m_value;
+		};
+	}
+
+	MipMask GetRequiredMips(const MipMask totalMips, const uint32 requiredResolution)
+	{
+		if (requiredResolution == 0 || totalMips.IsEmpty())
+		{
+			return {};
+		}
+
+		// Clamp to the largest mip a mask can represent
+		const uint32 resolution = Math::Min(requiredResolution, 1u << (sizeof(MipMask::StoredType) * 8u - 1u));
+		const MipMask::StoredType requiredMipIndex = *MipMask::FromSizeToLargest(Math::Vector2ui{resolution}).GetFirstIndex();
+		const MipMask::StoredType lastMipIndex = Math::Min(requiredMipIndex, (MipMask::StoredType)*totalMips.GetLastIndex());
+		return MipMask{MipMask::StoredType((2u << lastMipIndex) - 1u)} & totalMips;
+	}
+
+	MipMask GetAllocatedMips(const MipMask totalMips, const MipMask requestedMips)
+	{
+		if (requestedMips.IsEmpty())
+		{
+			return {};
+		}
+
+		const MipMask::StoredType largestMipIndex = *requestedMips.GetLastIndex();
+		return MipMask{MipMask::StoredType((2u << largestMipIndex) - 1u)} & totalMips;
+	}
+
+	uint64 GetMipByteSize(const TextureInfo& texture, const MipMask::StoredType mipIndex)
+	{
+		const uint64 texelCount = uint64(1) << (mipIndex * 2u);
+		return Math::Max(texelCount * texture.m_bitsPerPixel / 8u, (uint64)1u) * texture.m_arrayLayerCount;
+	}
+
+	uint64 SelectResidentMips(
+		const ArrayView<const TextureInfo, uint32> textures, const uint64 budget, const ArrayView<MipMask, uint32> residentMipsOut
+	)
+	{
+		Assert(residentMipsOut.GetSize() == textures.GetSize());
+
+		uint64 usedSize = 0;
+		Vector<Internal::Candidate, uint32> candidates;
+		for (uint32 textureIndex = 0, textureCount = textures.GetSize(); textureIndex < textureCount; ++textureIndex)
+		{
+			const TextureInfo& __restrict texture = textures[textureIndex];
+			if (texture.m_totalMips.IsEmpty())
+			{
+				residentMipsOut[textureIndex] = {};
+				continue;
+			}
+
+			MipMask alwaysResidentMips = texture.m_totalMips & AlwaysResidentMips;
+			if (alwaysResidentMips.IsEmpty())
+			{
+				alwaysResidentMips = MipMask::FromIndex(*texture.m_totalMips.GetFirstIndex());
+			}
+			residentMipsOut[textureIndex] = alwaysResidentMips;
+
+			const MipMask::StoredType lastMipIndex = *texture.m_totalMips.GetLastIndex();
+			for (MipMask::StoredType mipIndex = *texture.m_totalMips.GetFirstIndex(); mipIndex <= lastMipIndex; ++mipIndex)
+			{
+				if ((alwaysResidentMips & MipMask::FromIndex(mipIndex)).AreAnySet())
+				{
+					usedSize += GetMipByteSize(texture, mipIndex);
+				}
+			}
+
+			const MipMask requiredMips = GetRequiredMips(texture.m_totalMips, texture.m_requiredResolution) & ~alwaysResidentMips;
+			const MipMask cachedMips = texture.m_loadedMips & texture.m_totalMips & ~requiredMips & ~alwaysResidentMips;
+			const float screenArea = (float)texture.m_requiredResolution * (float)texture.m_requiredResolution;
+			for (MipMask::StoredType mipIndex = *texture.m_totalMips.GetFirstIndex(); mipIndex <= lastMipIndex; ++mipIndex)
+			{
+				const MipMask mip = MipMask::FromIndex(mipIndex);
+				const float mipSize = (float)GetMipByteSize(texture, mipIndex);
+				if ((requiredMips & mip).AreAnySet())
+				{
+					candidates.EmplaceBack(Internal::Candidate{textureIndex, mipIndex, true, screenArea / mipSize});
+				}
+				else if ((cachedMips & mip).AreAnySet())
+				{
+					candidates.EmplaceBack(Internal::Candidate{textureIndex, mipIndex, false, 1.f / mipSize});
+				}
+			}
+		}
+
+		// Visit the most valuable mips first, the value of a texture's mips decreases with their size so smaller mips always come first
+		Algorithms::Sort(
+			candidates.begin(),
+			candidates.end(),
+			[](const Internal::Candidate& left, const Internal::Candidate& right)
+			{
+				if (left.m_isRequired != right.m_isRequired)
+				{
+					return left.m_isRequired;
+				}
+				if (left.m_value != right.m_value)
+				{
+					return left.m_value > right.m_value;
+				}
+				if (left.m_mipIndex != right.m_mipIndex)
+				{
+					return left.m_mipIndex < right.m_mipIndex;
+				}
+				return left.m_textureIndex < right.m_textureIndex;
+			}
+		);
+
+		for (const Internal::Candidate& candidate : candidates)
+		{
+			MipMask& residentMips = residentMipsOut[candidate.m_textureIndex];
+			// Mips can only be resident if the next smaller mip is too, once a mip was skipped all larger ones are skipped
+			if ((residentMips & MipMask::FromIndex(MipMask::StoredType(candidate.m_mipIndex - 1u))).IsEmpty())
+			{
+				continue;
+			}
+
+			const uint64 mipSize = GetMipByteSize(textures[candidate.m_textureIndex], candidate.m_mipIndex);
+			if (usedSize + mipSize > budget)
+			{
+				continue;
+			}
+
+			residentMips |= MipMask::FromIndex(candidate.m_mipIndex);
+			usedSize += mipSize;
+		}
+
+		return usedSize;
+	}
+}
@@ -5,6 +5,7 @@
 #include <Renderer/Buffers/IndexBuffer.h>
 #include <Renderer/Buffers/UniformBuffer.h>
 #include <Renderer/Buffers/StorageBuffer.h>
+#include <Renderer/Buffers/IndirectBuffer.h>
 #include <Renderer/Commands/CommandBufferView.h>
 #include <Renderer/Devices/LogicalDevice.h>
 #include <Renderer/Devices/PhysicalDevice.h>
@@ -279,4 +280,18 @@ namespace ngine::Rendering
 			)
 	{
 	}
+
+	IndirectBuffer::IndirectBuffer(
+		LogicalDevice& logicalDevice, const PhysicalDevice& physicalDevice, DeviceMemoryPool& memoryPool, const size size
+	)
+		: Buffer(
+				logicalDevice,
+				physicalDevice,
+				memoryPool,
+				size,
+				Buffer::UsageFlags::IndirectBuffer | Buffer::UsageFlags::TransferDestination,
+				MemoryFlags::HostCoherent | MemoryFlags::HostVisible
+			)
+	{
+	}
 }
@@ -35,6 +35,7 @@ namespace ngine::Rendering
 		wgpuUsageFlags |= WGPUBufferUsage_Vertex * usageFlags.IsSet(UsageFlags::VertexBuffer);
 		wgpuUsageFlags |= WGPUBufferUsage_Uniform * usageFlags.IsSet(UsageFlags::UniformBuffer);
 		wgpuUsageFlags |= WGPUBufferUsage_Storage * usageFlags.IsSet(UsageFlags::StorageBuffer);
+		wgpuUsageFlags |= WGPUBufferUsage_Indirect * usageFlags.IsSet(UsageFlags::IndirectBuffer);
 		wgpuUsageFlags |= WGPUBufferUsage_MapRead *
 		                  (memoryFlags.IsSet(MemoryFlags::HostVisible) & usageFlags.IsNotSet(UsageFlags::TransferSource));
 		wgpuUsageFlags |= WGPUBufferUsage_MapWrite *
@@ -1691,20 +1691,33 @@ namespace ngine::Rendering
 	}
 
 	void RenderCommandEncoderView::DrawIndexedIndirect(
-		const BufferView buffer, uint64 offset, const uint32 drawCount, const uint32 offsetStride
+		const BufferView indexBuffer,
+		const uint64 indexBufferOffset,
+		const uint64 indexBufferSize,
+		const BufferView buffer,
+		uint64 offset,
+		const uint32 drawCount,
+		const uint32 offsetStride
 	) const
 	{
+		Assert(indexBuffer.IsValid());
 		Assert(buffer.IsValid());
 
 #if RENDERER_VULKAN
+		UNUSED(indexBufferSize);
+		constexpr VkIndexType indexType = Math::Select(TypeTraits::IsSame<Index, uint32>, VK_INDEX_TYPE_UINT32, VK_INDEX_TYPE_UINT16);
+		vkCmdBindIndexBuffer(m_pCommandEncoder, indexBuffer, indexBufferOffset, indexType);
+
 		vkCmdDrawIndexedIndirect(m_pCommandEncoder, buffer, offset, drawCount, offsetStride);
 #elif RENDERER_WEBGPU
 
+		constexpr WGPUIndexFormat indexFormat = Math::Select(TypeTraits::IsSame<Index, uint32>, WGPUIndexFormat_Uint32, WGPUIndexFormat_Uint16);
 #if WEBGPU_SINGLE_THREADED
 		Rendering::Window::QueueOnWindowThreadOrExecuteImmediately(
-			[pCommandEncoder = m_pCommandEncoder, drawCount, buffer, offset, offsetStride]() mutable
+			[pCommandEncoder = m_pCommandEncoder, indexBuffer, indexBufferOffset, indexBufferSize, drawCount, buffer, offset, offsetStride]() mutable
 			{
 				WGPURenderPassEncoder pRenderPassEncoder = *pCommandEncoder;
+				wgpuRenderPassEncoderSetIndexBuffer(pRenderPassEncoder, indexBuffer, indexFormat, indexBufferOffset, indexBufferSize);
 				for (uint32 drawIndex = 0; drawIndex < drawCount; ++drawIndex)
 				{
 					wgpuRenderPassEncoderDrawIndexedIndirect(pRenderPassEncoder, buffer, offset);
@@ -1713,6 +1726,7 @@ namespace ngine::Rendering
 			}
 		);
 #else
+		wgpuRenderPassEncoderSetIndexBuffer(m_pCommandEncoder, indexBuffer, indexFormat, indexBufferOffset, indexBufferSize);
 		for (uint32 drawIndex = 0; drawIndex < drawCount; ++drawIndex)
 		{
 			wgpuRenderPassEncoderDrawIndexedIndirect(m_pCommandEncoder, buffer, offset);
@@ -1721,6 +1735,9 @@ namespace ngine::Rendering
 #endif
 
 #else
+		UNUSED(indexBuffer);
+		UNUSED(indexBufferOffset);
+		UNUSED(indexBufferSize);
 		UNUSED(buffer);
 		UNUSED(offset);
 		UNUSED(drawCount);
@@ -2815,18 +2832,33 @@ namespace ngine::Rendering
 	}
 
 	void ParallelRenderCommandEncoderView::DrawIndexedIndirect(
-		const BufferView buffer, uint64 offset, const uint32 drawCount, const uint32 offsetStride
+		const BufferView indexBuffer,
+		const uint64 indexBufferOffset,
+		const uint64 indexBufferSize,
+		const BufferView buffer,
+		uint64 offset,
+		const uint32 drawCount,
+		const uint32 offsetStride
 	) const
 	{
+		Assert(indexBuffer.IsValid());
+		Assert(buffer.IsValid());
+
 #if RENDERER_VULKAN
+		UNUSED(indexBufferSize);
+		constexpr VkIndexType indexType = Math::Select(TypeTraits::IsSame<Index, uint32>, VK_INDEX_TYPE_UINT32, VK_INDEX_TYPE_UINT16);
+		vkCmdBindIndexBuffer(m_pCommandEncoder, indexBuffer, indexBufferOffset, indexType);
+
 		vkCmdDrawIndexedIndirect(m_pCommandEncoder, buffer, offset, drawCount, offsetStride);
 #elif RENDERER_WEBGPU
 
+		constexpr WGPUIndexFormat indexFormat = Math::Select(TypeTraits::IsSame<Index, uint32>, WGPUIndexFormat_Uint32, WGPUIndexFormat_Uint16);
 #if WEBGPU_SINGLE_THREADED
 		Rendering::Window::QueueOnWindowThreadOrExecuteImmediately(
-			[pCommandEncoder = m_pCommandEncoder, drawCount, buffer, offset, offsetStride]() mutable
+			[pCommandEncoder = m_pCommandEncoder, indexBuffer, indexBufferOffset, indexBufferSize, drawCount, buffer, offset, offsetStride]() mutable
 			{
 				WGPURenderBundleEncoder pWGPURenderBundleEncoder = *pCommandEncoder;
+				wgpuRenderBundleEncoderSetIndexBuffer(pWGPURenderBundleEncoder, indexBuffer, indexFormat, indexBufferOffset, indexBufferSize);
 				for (uint32 drawIndex = 0; drawIndex < drawCount; ++drawIndex)
 				{
 					wgpuRenderBundleEncoderDrawIndexedIndirect(pWGPURenderBundleEncoder, buffer, offset);
@@ -2835,6 +2867,7 @@ namespace ngine::Rendering
 			}
 		);
 #else
+		wgpuRenderBundleEncoderSetIndexBuffer(m_pCommandEncoder, indexBuffer, indexFormat, indexBufferOffset, indexBufferSize);
 		for (uint32 drawIndex = 0; drawIndex < drawCount; ++drawIndex)
 		{
 			wgpuRenderBundleEncoderDrawIndexedIndirect(m_pCommandEncoder, buffer, offset);
@@ -2843,6 +2876,9 @@ namespace ngine::Rendering
 #endif
 
 #else
+		UNUSED(indexBuffer);
+		UNUSED(indexBufferOffset);
+		UNUSED(indexBufferSize);
 		UNUSED(buffer);
 		UNUSED(offset);
 		UNUSED(drawCount);
@@ -8,6 +8,8 @@
 #include <Common/Memory/IsAligned.h>
 #include <Common/Memory/MemorySize.h>
 #include <Common/Memory/AddressOf.h>
+#include <Common/Memory/CountBits.h>
+#include <Common/Threading/Jobs/JobRunnerThread.h>
 
 namespace ngine::Rendering
 {
@@ -17,6 +19,7 @@ namespace ngine::Rendering
 	inline static constexpr Memory::Size ExtraBlockSize = 100_megabytes;
 
 	DeviceMemoryPool::DeviceMemoryPool(const LogicalDeviceView logicalDevice, const PhysicalDevice& physicalDevice)
+		: m_bufferImageGranularity(physicalDevice.GetBufferImageGranularity())
 	{
 		if constexpr (!DISABLE_MEMORY_POOL_USAGE)
 		{
@@ -57,6 +60,11 @@ namespace ngine::Rendering
 		for (MemoryType& memoryType : m_memoryTypes)
 		{
 			Threading::UniqueLock lock(memoryType.m_blockMutex);
+			memoryType.m_pages.Clear();
+			for (SmallAllocationPage*& pThreadPage : memoryType.m_threadPages)
+			{
+				pThreadPage = nullptr;
+			}
 			for (Block& block : memoryType.m_blocks)
 			{
 				block.m_memory.Destroy(logicalDevice);
@@ -74,15 +82,8 @@ namespace ngine::Rendering
 		const LogicalDeviceView logicalDevice, const uint32 size, const uint8 memoryTypeIndex, const EnumFlags<MemoryFlags> memoryFlags
 	)
 		: m_memory(logicalDevice, size, memoryTypeIndex, memoryFlags)
+		, m_allocator(m_memory.IsValid() ? size : 0)
 	{
-		if (LIKELY(m_memory.IsValid()))
-		{
-			Block::Fragment::IdentifierType rootFragmentIdentifier = m_identifierStorage.AcquireIdentifier();
-			Assert(rootFragmentIdentifier.IsValid());
-			m_fragments[rootFragmentIdentifier] = Block::Fragment{0, size};
-			m_unusedFragments.Set(rootFragmentIdentifier);
-			m_availableSpace = size;
-		}
 	}
 
 	template<typename TargetType, typename SourceType>
@@ -100,7 +101,7 @@ namespace ngine::Rendering
 		}
 	}
 
-	[[nodiscard]] DeviceMemoryPool::Allocation TryAllocate(
+	[[nodiscard]] static DeviceMemoryPool::Allocation TryAllocate(
 		DeviceMemoryPool::Block& block,
 		const typename DeviceMemoryAllocation::BlockSizeType blockIndex,
 		const uint8 memoryTypeIndex,
@@ -108,367 +109,344 @@ namespace ngine::Rendering
 		const uint32 alignment
 	)
 	{
-		using Block = DeviceMemoryPool::Block;
-		using Allocation = DeviceMemoryPool::Allocation;
-
-		Allocation newAllocation;
-		for (const Block::Fragment::SizeType fragmentIndex : block.m_unusedFragments.GetSetBitsIterator())
+		const Optional<TlsfAllocator::Allocation> blockAllocation = block.m_allocator.Allocate(allocationSize, alignment);
+		if (blockAllocation.IsValid())
 		{
-			const Block::Fragment::IdentifierType fragmentIdentifier = Block::Fragment::IdentifierType::MakeFromValidIndex(fragmentIndex);
-			Block::Fragment::IdentifierType unusedFragmentIdentifier = block.m_identifierStorage.GetActiveIdentifier(fragmentIdentifier);
-			Assert(unusedFragmentIdentifier.GetFirstValidIndex() == fragmentIndex);
-			Assert(unusedFragmentIdentifier.GetIndex() == fragmentIdentifier.GetIndex());
-			Block::Fragment& unusedFragment = block.m_fragments[unusedFragmentIdentifier];
-
-			const typename Block::SizeType neededPadding = Memory::Align(unusedFragment.m_offset, alignment) - unusedFragment.m_offset;
-			const uint32 actualAllocationSize = allocationSize + neededPadding;
+			return DeviceMemoryPool::Allocation{
+				block.m_memory,
+				blockAllocation->m_offset,
+				blockAllocation->m_size,
+				blockAllocation->m_identifier,
+				memoryTypeIndex,
+				blockIndex
+			};
+		}
+		return {};
+	}
 
-			if ((unusedFragment.m_size > actualAllocationSize))
+	DeviceMemoryPool::Allocation DeviceMemoryPool::Allocate(
+		const LogicalDeviceView logicalDevice,
+		const size allocationSize,
+		const uint32 alignment,
+		const uint8 memoryTypeIndex,
+		const EnumFlags<MemoryFlags> memoryFlags,
+		const ResourceTiling tiling
+	)
+	{
+		if constexpr (!DISABLE_MEMORY_POOL_USAGE)
+		{
+			const Block::SizeType finalAllocationSize = Memory::Align(CheckedCast<Block::SizeType>(allocationSize), NewAlignment);
+			// Pages are aligned to their size and only hold one tiling, so they are only bypassed if the granularity exceeds a page
+			const bool canUsePages = tiling == ResourceTiling::Linear || m_bufferImageGranularity <= SmallAllocationPageSize;
+			if (canUsePages && finalAllocationSize <= SmallAllocationMaximumSize && alignment <= SmallAllocationMaximumSize)
 			{
-				const Block::Fragment::IdentifierType newFragmentIdentifier = block.m_identifierStorage.AcquireIdentifier();
-				Assert(newFragmentIdentifier.IsValid());
-				Block::Fragment& newFragment = block.m_fragments[newFragmentIdentifier] = Block::Fragment{
-					unusedFragment.m_offset,
-					actualAllocationSize,
-					unusedFragment.m_previousFragmentIdentifierIndex,
-					unusedFragmentIdentifier.GetIndex()
-				};
-
-				if (newFragment.m_previousFragmentIdentifierIndex != 0)
+				const Optional<Threading::JobRunnerThread*> pThread = Threading::JobRunnerThread::GetCurrent();
+				if (pThread.IsValid() && pThread->GetThreadIndex() < MaximumThreadCount)
 				{
-					block.m_fragments[newFragment.GetPreviousFragmentIdentifier()].m_nextFragmentIdentifierIndex = newFragmentIdentifier.GetIndex();
+					const Allocation allocation = AllocateSmall(
+						logicalDevice,
+						finalAllocationSize,
+						alignment,
+						memoryTypeIndex,
+						memoryFlags,
+						tiling,
+						(uint8)pThread->GetThreadIndex()
+					);
+					if (LIKELY(allocation.IsValid()))
+					{
+						return allocation;
+					}
 				}
+			}
 
-				Assert(!block.m_usedFragments.IsSet(newFragmentIdentifier));
-				Assert(!block.m_unusedFragments.IsSet(newFragmentIdentifier));
-				block.m_usedFragments.Set(newFragmentIdentifier);
-
-				unusedFragment.m_previousFragmentIdentifierIndex = newFragmentIdentifier.GetIndex();
-
-				newAllocation =
-					Allocation{block.m_memory, unusedFragment.m_offset, actualAllocationSize, newFragmentIdentifier, memoryTypeIndex, blockIndex};
-
-				unusedFragment.m_offset += actualAllocationSize;
-				unusedFragment.m_size -= actualAllocationSize;
-
-				Assert(newFragment.m_nextFragmentIdentifierIndex == unusedFragmentIdentifier.GetIndex());
-				Assert(unusedFragment.m_previousFragmentIdentifierIndex == newFragmentIdentifier.GetIndex());
+			if (tiling == ResourceTiling::Optimal && m_bufferImageGranularity > NewAlignment)
+			{
+				// Occupy whole granularity pages so that no linear allocation can share one with this resource
+				return AllocateFromBlocks(
+					logicalDevice,
+					Memory::Align(finalAllocationSize, m_bufferImageGranularity),
+					Math::Max(alignment, m_bufferImageGranularity),
+					memoryTypeIndex,
+					memoryFlags
+				);
+			}
+			return AllocateFromBlocks(logicalDevice, finalAllocationSize, alignment, memoryTypeIndex, memoryFlags);
+		}
+		else
+		{
+			return AllocateRaw(logicalDevice, allocationSize, memoryTypeIndex, memoryFlags);
+		}
+	}
 
-				block.m_availableSpace -= actualAllocationSize;
+	DeviceMemoryPool::Allocation DeviceMemoryPool::AllocateFromBlocks(
+		const LogicalDeviceView logicalDevice,
+		const uint32 finalAllocationSize,
+		const uint32 alignment,
+		const uint8 memoryTypeIndex,
+		const EnumFlags<MemoryFlags> memoryFlags
+	)
+	{
+		MemoryType& memoryType = m_memoryTypes[memoryTypeIndex];
 
-				if constexpr (ENABLE_ASSERTS)
+		Allocation allocation;
+		{
+			Threading::UniqueLock lock(memoryType.m_blockMutex);
+			typename DeviceMemoryAllocation::BlockSizeType blockIndex;
+			for (Block& block : memoryType.m_blocks)
+			{
+				if (block.m_allocator.GetAvailableSpace() < finalAllocationSize)
 				{
-					if (unusedFragment.m_previousFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& previousFragment = block.m_fragments[unusedFragment.GetPreviousFragmentIdentifier()];
-						Assert(previousFragment.m_nextFragmentIdentifierIndex == unusedFragmentIdentifier.GetIndex());
-					}
-
-					if (unusedFragment.m_nextFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& nextFragment = block.m_fragments[unusedFragment.GetNextFragmentIdentifier()];
-						Assert(nextFragment.m_previousFragmentIdentifierIndex == unusedFragmentIdentifier.GetIndex());
-					}
+					continue;
 				}
 
-				if constexpr (ENABLE_ASSERTS)
+				blockIndex = memoryType.m_blocks.GetIteratorIndex(Memory::GetAddressOf(block));
+
+				allocation = TryAllocate(block, blockIndex, memoryTypeIndex, finalAllocationSize, alignment);
+				if (allocation.m_memory.IsValid())
 				{
-					if (newFragment.m_previousFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& previousFragment = block.m_fragments[newFragment.GetPreviousFragmentIdentifier()];
-						Assert(previousFragment.m_nextFragmentIdentifierIndex == newFragmentIdentifier.GetIndex());
-					}
-					if (newFragment.m_nextFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& nextFragment = block.m_fragments[newFragment.GetNextFragmentIdentifier()];
-						Assert(nextFragment.m_previousFragmentIdentifierIndex == newFragmentIdentifier.GetIndex());
-					}
+					lock.Unlock();
+					Assert(IsAllocationValid(allocation));
+					Assert(allocation.m_memory.IsValid());
+					return allocation;
 				}
-
-				break;
 			}
-			else if ((unusedFragment.m_size == allocationSize) & Memory::IsAligned(unusedFragment.m_offset, alignment))
-			{
-				newAllocation =
-					Allocation{block.m_memory, unusedFragment.m_offset, allocationSize, unusedFragmentIdentifier, memoryTypeIndex, blockIndex};
+		}
 
-				block.m_availableSpace -= allocationSize;
+		typename DeviceMemoryAllocation::BlockSizeType blockIndex;
+		uint32 blockAllocationSize;
+		Block* __restrict pBlock;
+		do
+		{
+			{
+				if (UNLIKELY(memoryType.m_isOutOfMemory))
+				{
+					return {};
+				}
 
-				Assert(!block.m_usedFragments.IsSet(unusedFragmentIdentifier));
-				block.m_usedFragments.Set(unusedFragmentIdentifier);
-				Assert(block.m_unusedFragments.IsSet(unusedFragmentIdentifier));
-				block.m_unusedFragments.Clear(unusedFragmentIdentifier);
+				Threading::UniqueLock lock(memoryType.m_blockMutex);
+				blockIndex = memoryType.m_blocks.GetNextAvailableIndex();
 
-				if constexpr (ENABLE_ASSERTS)
+				blockAllocationSize = Math::Max((uint32)ExtraBlockSize.ToBytes(), finalAllocationSize);
+				do
 				{
-					if (unusedFragment.m_previousFragmentIdentifierIndex != 0)
+					pBlock = &memoryType.m_blocks
+					            .EmplaceBack(logicalDevice, blockAllocationSize, memoryTypeIndex, memoryFlags | MemoryFlags::AllocateDeviceAddress);
+					if (LIKELY(pBlock->m_memory.IsValid()))
 					{
-						[[maybe_unused]] const Block::Fragment& previousFragment = block.m_fragments[unusedFragment.GetPreviousFragmentIdentifier()];
-						Assert(previousFragment.m_nextFragmentIdentifierIndex == unusedFragmentIdentifier.GetIndex());
+						break;
 					}
-					if (unusedFragment.m_nextFragmentIdentifierIndex != 0)
+					else
 					{
-						[[maybe_unused]] const Block::Fragment& nextFragment = block.m_fragments[unusedFragment.GetNextFragmentIdentifier()];
-						Assert(nextFragment.m_previousFragmentIdentifierIndex == unusedFragmentIdentifier.GetIndex());
+						memoryType.m_blocks.PopBack();
+						blockAllocationSize = Math::Max(finalAllocationSize, blockAllocationSize / 2);
 					}
+				} while (blockAllocationSize > finalAllocationSize);
+
+				if (!memoryType.m_blocks.IsValidIndex(blockIndex))
+				{
+					memoryType.m_isOutOfMemory = true;
+					return {};
 				}
+			}
 
-				break;
+			{
+				Threading::UniqueLock lock(memoryType.m_blockMutex);
+				allocation = TryAllocate(memoryType.m_blocks[blockIndex], blockIndex, memoryTypeIndex, finalAllocationSize, alignment);
 			}
-		}
+		} while (!allocation.m_memory.IsValid());
+		Assert(IsAllocationValid(allocation));
+		return allocation;
+	}
 
-		if constexpr (ENABLE_ASSERTS)
+	inline static constexpr Array<uint32, DeviceMemoryPool::SmallAllocationSizeClassCount> SmallAllocationSlotSizes = {
+		4096, 8192, 12288, 16384, 24576, 32768, 49152, 65536
+	};
+	static_assert(SmallAllocationSlotSizes[0] == DeviceMemoryPool::SmallAllocationMinimumSize);
+	static_assert(SmallAllocationSlotSizes[DeviceMemoryPool::SmallAllocationSizeClassCount - 1] == DeviceMemoryPool::SmallAllocationMaximumSize);
+
+	//! Returns the smallest size class that fits the allocation and whose slots are all aligned, given the page is aligned to its size
+	[[nodiscard]] static uint8 GetSmallAllocationSizeClassIndex(const uint32 allocationSize, const uint32 alignment)
+	{
+		for (uint8 sizeClassIndex = 0; sizeClassIndex < DeviceMemoryPool::SmallAllocationSizeClassCount; ++sizeClassIndex)
 		{
-			if (newAllocation.m_identifier.IsValid())
+			const uint32 slotSize = SmallAllocationSlotSizes[sizeClassIndex];
+			if (slotSize >= allocationSize && Memory::IsAligned(slotSize, alignment))
 			{
-				Assert(block.m_usedFragments.IsSet(newAllocation.m_identifier));
-				Assert(!block.m_unusedFragments.IsSet(newAllocation.m_identifier));
+				return sizeClassIndex;
 			}
 		}
+		return DeviceMemoryPool::SmallAllocationSizeClassCount;
+	}
 
-		return newAllocation;
+	[[nodiscard]] static DeviceMemoryPool::Allocation
+	MakePageAllocation(const DeviceMemoryPool::Allocation pageAllocation, const uint32 offset, const uint32 slotSize)
+	{
+		DeviceMemoryPool::Allocation allocation = pageAllocation;
+		allocation.m_offset += offset;
+		allocation.m_size = slotSize;
+		return allocation;
 	}
 
-	DeviceMemoryPool::Allocation DeviceMemoryPool::Allocate(
+	DeviceMemoryPool::Allocation DeviceMemoryPool::AllocateSmall(
 		const LogicalDeviceView logicalDevice,
-		const size allocationSize,
+		const uint32 allocationSize,
 		const uint32 alignment,
 		const uint8 memoryTypeIndex,
-		const EnumFlags<MemoryFlags> memoryFlags
+		const EnumFlags<MemoryFlags> memoryFlags,
+		const ResourceTiling tiling,
+		const uint8 threadIndex
 	)
 	{
-		if constexpr (!DISABLE_MEMORY_POOL_USAGE)
-		{
-			MemoryType& memoryType = m_memoryTypes[memoryTypeIndex];
-
-			Block::SizeType finalAllocationSize = Memory::Align(CheckedCast<Block::SizeType>(allocationSize), NewAlignment);
+		MemoryType& memoryType = m_memoryTypes[memoryTypeIndex];
+		const uint8 sizeClassIndex = GetSmallAllocationSizeClassIndex(allocationSize, alignment);
+		Assert(sizeClassIndex < SmallAllocationSizeClassCount);
+		SmallAllocationPage*& pCurrentPage =
+			memoryType.m_threadPages[(threadIndex * (uint8)ResourceTiling::Count + (uint8)tiling) * SmallAllocationSizeClassCount + sizeClassIndex];
 
-			Allocation allocation;
+		if (pCurrentPage != nullptr)
+		{
+			Threading::UniqueLock pageLock(pCurrentPage->m_mutex);
+			if (UNLIKELY(pCurrentPage->m_isMemoryReleased))
 			{
-				// Threading::SharedLock lock(memoryType.m_blockMutex);
-				Threading::UniqueLock lock(memoryType.m_blockMutex);
-				typename DeviceMemoryAllocation::BlockSizeType blockIndex;
-				for (Block& block : memoryType.m_blocks)
-				{
-					if (block.m_availableSpace < finalAllocationSize)
-					{
-						continue;
-					}
-
-					blockIndex = memoryType.m_blocks.GetIteratorIndex(Memory::GetAddressOf(block));
-
-					allocation = TryAllocate(block, blockIndex, memoryTypeIndex, finalAllocationSize, alignment);
-					if (allocation.m_memory.IsValid())
-					{
-						lock.Unlock();
-						Assert(IsAllocationValid(allocation));
-						Assert(allocation.m_memory.IsValid());
-						return allocation;
-					}
-				}
+				// The page became empty and its memory was already returned to the block
+				pageLock.Unlock();
+				ReleaseEmptiedPage(memoryType, *pCurrentPage);
+				pCurrentPage = nullptr;
 			}
-
-			typename DeviceMemoryAllocation::BlockSizeType blockIndex;
-			uint32 blockAllocationSize;
-			Block* __restrict pBlock;
-			do
+			else if (const Optional<SlabAllocator::SizeType> offset = pCurrentPage->m_allocator.Allocate())
 			{
-				{
-					if (UNLIKELY(memoryType.m_isOutOfMemory))
-					{
-						return {};
-					}
-
-					Threading::UniqueLock lock(memoryType.m_blockMutex);
-					blockIndex = memoryType.m_blocks.GetNextAvailableIndex();
+				return MakePageAllocation(pCurrentPage->m_pageAllocation, *offset, pCurrentPage->m_allocator.GetSlotSize());
+			}
+			else
+			{
+				// The page is full, it is released by whichever thread frees its last allocation
+				pCurrentPage->m_isCurrent = false;
+				pCurrentPage = nullptr;
+			}
+		}
 
-					blockAllocationSize = Math::Max((uint32)ExtraBlockSize.ToBytes(), finalAllocationSize);
-					do
-					{
-						pBlock = &memoryType.m_blocks
-						            .EmplaceBack(logicalDevice, blockAllocationSize, memoryTypeIndex, memoryFlags | MemoryFlags::AllocateDeviceAddress);
-						if (LIKELY(pBlock->m_memory.IsValid()))
-						{
-							break;
-						}
-						else
-						{
-							memoryType.m_blocks.PopBack();
-							blockAllocationSize = Math::Max(finalAllocationSize, blockAllocationSize / 2);
-						}
-					} while (blockAllocationSize > finalAllocationSize);
-
-					if (!memoryType.m_blocks.IsValidIndex(blockIndex))
-					{
-						memoryType.m_isOutOfMemory = true;
-						return {};
-					}
-				}
+		// Pages are aligned to their size, so every slot is aligned to the slot size and the page never shares a granularity page with
+		// resources of the other tiling
+		Allocation pageAllocation =
+			AllocateFromBlocks(logicalDevice, SmallAllocationPageSize, SmallAllocationPageSize, memoryTypeIndex, memoryFlags);
+		if (UNLIKELY(!pageAllocation.IsValid()))
+		{
+			return {};
+		}
 
+		const uint32 slotSize = SmallAllocationSlotSizes[sizeClassIndex];
+		{
+			Threading::UniqueLock lock(memoryType.m_blockMutex);
+			const OptionalIterator<UniquePtr<SmallAllocationPage>> emptyPageIt = memoryType.m_pages.FindIf(
+				[](const UniquePtr<SmallAllocationPage>& pPage)
 				{
-					Threading::UniqueLock lock(memoryType.m_blockMutex);
-					allocation = TryAllocate(memoryType.m_blocks[blockIndex], blockIndex, memoryTypeIndex, finalAllocationSize, alignment);
+					return pPage.IsInvalid();
 				}
-			} while (!allocation.m_memory.IsValid());
-			Assert(IsAllocationValid(allocation));
-			return allocation;
-		}
-		else
-		{
-			return AllocateRaw(logicalDevice, allocationSize, memoryTypeIndex, memoryFlags);
+			);
+			if (emptyPageIt.IsValid())
+			{
+				pageAllocation.m_pageIndex = memoryType.m_pages.GetIteratorIndex(emptyPageIt);
+				*emptyPageIt = UniquePtr<SmallAllocationPage>::Make(pageAllocation, slotSize);
+				pCurrentPage = emptyPageIt->Get();
+			}
+			else if (LIKELY(memoryType.m_pages.GetSize() < DeviceMemoryAllocation::InvalidPageIndex))
+			{
+				pageAllocation.m_pageIndex = memoryType.m_pages.GetSize();
+				pCurrentPage = memoryType.m_pages.EmplaceBack(UniquePtr<SmallAllocationPage>::Make(pageAllocation, slotSize)).Get();
+			}
+			else
+			{
+				Block& block = memoryType.m_blocks[pageAllocation.m_blockIndex];
+				block.m_allocator.Deallocate(pageAllocation.m_identifier);
+				return {};
+			}
 		}
+
+		Threading::UniqueLock pageLock(pCurrentPage->m_mutex);
+		const Optional<SlabAllocator::SizeType> offset = pCurrentPage->m_allocator.Allocate();
+		Assert(offset.IsValid());
+		return MakePageAllocation(pCurrentPage->m_pageAllocation, *offset, pCurrentPage->m_allocator.GetSlotSize());
 	}
 
 	void DeviceMemoryPool::Deallocate(const Allocation allocation)
 	{
 		Assert(!DISABLE_MEMORY_POOL_USAGE);
 
+		if (allocation.m_pageIndex != DeviceMemoryAllocation::InvalidPageIndex)
+		{
+			DeallocateSmall(allocation);
+			return;
+		}
+
 		MemoryType& memoryType = m_memoryTypes[allocation.m_memoryTypeIndex];
 
 		Threading::UniqueLock lock(memoryType.m_blockMutex);
 
 		Block& block = memoryType.m_blocks[allocation.m_blockIndex];
-		Block::Fragment& fragment = block.m_fragments[allocation.m_identifier];
-
-		Assert(fragment.m_offset == allocation.m_offset);
-		Assert(fragment.m_size == allocation.m_size);
-
-		block.m_availableSpace += allocation.m_size;
+		Assert(block.m_allocator.IsAllocated(allocation.m_identifier, allocation.m_offset, allocation.m_size));
+		block.m_allocator.Deallocate(allocation.m_identifier);
+	}
 
-		Assert(!block.m_unusedFragments.IsSet(allocation.m_identifier));
-		Assert(block.m_usedFragments.IsSet(allocation.m_identifier));
-		block.m_usedFragments.Clear(allocation.m_identifier);
+	void DeviceMemoryPool::DeallocateSmall(const Allocation allocation)
+	{
+		MemoryType& memoryType = m_memoryTypes[allocation.m_memoryTypeIndex];
 
-		if (fragment.m_previousFragmentIdentifierIndex != 0 && !block.m_usedFragments.IsSet(fragment.GetPreviousFragmentIdentifier()))
+		// A page with live allocations is never released, so it stays valid after the shared lock is released
+		SmallAllocationPage* pPage;
 		{
-			Block::Fragment& previousFragment = block.m_fragments[fragment.GetPreviousFragmentIdentifier()];
-			previousFragment.m_size += fragment.m_size;
-
-			Assert(previousFragment.m_nextFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-
-			if (fragment.m_nextFragmentIdentifierIndex != 0 && !block.m_usedFragments.IsSet(fragment.GetNextFragmentIdentifier()))
-			{
-				const Block::Fragment& nextFragment = block.m_fragments[fragment.GetNextFragmentIdentifier()];
-				previousFragment.m_size += nextFragment.m_size;
-
-				Assert(block.m_unusedFragments.IsSet(fragment.GetNextFragmentIdentifier()));
-				block.m_unusedFragments.Clear(fragment.GetNextFragmentIdentifier());
-				block.m_identifierStorage.ReturnIdentifier(fragment.GetNextFragmentIdentifier());
-
-				Assert(nextFragment.m_previousFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-
-				previousFragment.m_nextFragmentIdentifierIndex = nextFragment.m_nextFragmentIdentifierIndex;
-				if (previousFragment.m_nextFragmentIdentifierIndex != 0)
-				{
-					block.m_fragments[previousFragment.GetNextFragmentIdentifier()].m_previousFragmentIdentifierIndex =
-						fragment.m_previousFragmentIdentifierIndex;
-				}
-
-				if constexpr (ENABLE_ASSERTS)
-				{
-					if (previousFragment.m_previousFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& previousFragmentPrevious =
-							block.m_fragments[previousFragment.GetPreviousFragmentIdentifier()];
-						Assert(previousFragmentPrevious.m_nextFragmentIdentifierIndex == fragment.m_previousFragmentIdentifierIndex);
-					}
-					if (previousFragment.m_nextFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& nextFragmentPrevious = block.m_fragments[previousFragment.GetNextFragmentIdentifier()];
-						Assert(nextFragmentPrevious.m_previousFragmentIdentifierIndex == fragment.m_previousFragmentIdentifierIndex);
-					}
-				}
-			}
-			else
-			{
-				previousFragment.m_nextFragmentIdentifierIndex = fragment.m_nextFragmentIdentifierIndex;
-				if (previousFragment.m_nextFragmentIdentifierIndex != 0)
-				{
-					block.m_fragments[previousFragment.GetNextFragmentIdentifier()].m_previousFragmentIdentifierIndex =
-						fragment.m_previousFragmentIdentifierIndex;
-				}
-
-				if constexpr (ENABLE_ASSERTS)
-				{
-					if (previousFragment.m_previousFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& previousFragmentPrevious =
-							block.m_fragments[previousFragment.GetPreviousFragmentIdentifier()];
-						Assert(previousFragmentPrevious.m_nextFragmentIdentifierIndex == fragment.m_previousFragmentIdentifierIndex);
-					}
-					if (previousFragment.m_nextFragmentIdentifierIndex != 0)
-					{
-						[[maybe_unused]] const Block::Fragment& nextFragmentPrevious = block.m_fragments[previousFragment.GetNextFragmentIdentifier()];
-						Assert(nextFragmentPrevious.m_previousFragmentIdentifierIndex == fragment.m_previousFragmentIdentifierIndex);
-					}
-				}
-			}
-
-			Assert(!block.m_unusedFragments.IsSet(allocation.m_identifier));
-			block.m_identifierStorage.ReturnIdentifier(allocation.m_identifier);
+			Threading::SharedLock lock(memoryType.m_blockMutex);
+			pPage = memoryType.m_pages[allocation.m_pageIndex].Get();
 		}
-		else if (fragment.m_nextFragmentIdentifierIndex != 0 && !block.m_usedFragments.IsSet(fragment.GetNextFragmentIdentifier()))
+		Assert(pPage != nullptr);
+
+		Allocation pageAllocation;
+		bool isCurrent;
 		{
-			Block::Fragment& nextFragment = block.m_fragments[fragment.GetNextFragmentIdentifier()];
-			fragment.m_size += nextFragment.m_size;
-
-			Assert(nextFragment.m_previousFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-
-			Assert(block.m_unusedFragments.IsSet(fragment.GetNextFragmentIdentifier()));
-			block.m_unusedFragments.Clear(fragment.GetNextFragmentIdentifier());
-			block.m_identifierStorage.ReturnIdentifier(fragment.GetNextFragmentIdentifier());
-			Assert(block.m_identifierStorage.IsIdentifierPotentiallyValid(allocation.m_identifier));
-			Assert(!block.m_unusedFragments.IsSet(allocation.m_identifier));
-			block.m_unusedFragments.Set(allocation.m_identifier);
-			fragment.m_nextFragmentIdentifierIndex = nextFragment.m_nextFragmentIdentifierIndex;
-			if (fragment.m_nextFragmentIdentifierIndex != 0)
+			Threading::UniqueLock pageLock(pPage->m_mutex);
+			const uint32 offset = allocation.m_offset - pPage->m_pageAllocation.m_offset;
+			Assert(pPage->m_allocator.IsAllocated(offset));
+			pPage->m_allocator.Deallocate(offset);
+
+			// Only one thread can observe the last free of a page
+			if (!pPage->m_allocator.IsEmpty())
 			{
-				block.m_fragments[fragment.GetNextFragmentIdentifier()].m_previousFragmentIdentifierIndex = allocation.m_identifier.GetIndex();
+				return;
 			}
 
-			if constexpr (ENABLE_ASSERTS)
+			pageAllocation = pPage->m_pageAllocation;
+			isCurrent = pPage->m_isCurrent;
+			if (isCurrent)
 			{
-				if (fragment.m_previousFragmentIdentifierIndex != 0)
-				{
-					[[maybe_unused]] const Block::Fragment& previousFragment = block.m_fragments[fragment.GetPreviousFragmentIdentifier()];
-					Assert(previousFragment.m_nextFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-				}
-				if (fragment.m_nextFragmentIdentifierIndex != 0)
-				{
-					[[maybe_unused]] const Block::Fragment& nextFragmentNext = block.m_fragments[fragment.GetNextFragmentIdentifier()];
-					Assert(nextFragmentNext.m_previousFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-				}
+				// The owning thread still references the page, it releases it on its next allocation from this size class
+				pPage->m_isMemoryReleased = true;
 			}
 		}
-		else
-		{
-			if constexpr (ENABLE_ASSERTS)
-			{
-				if (fragment.m_previousFragmentIdentifierIndex != 0)
-				{
-					[[maybe_unused]] const Block::Fragment& previousFragment = block.m_fragments[fragment.GetPreviousFragmentIdentifier()];
-					Assert(previousFragment.m_nextFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-				}
-				if (fragment.m_nextFragmentIdentifierIndex != 0)
-				{
-					[[maybe_unused]] const Block::Fragment& nextFragment = block.m_fragments[fragment.GetNextFragmentIdentifier()];
-					Assert(nextFragment.m_previousFragmentIdentifierIndex == allocation.m_identifier.GetIndex());
-				}
-			}
 
-			Assert(block.m_identifierStorage.IsIdentifierPotentiallyValid(allocation.m_identifier));
-			Assert(!block.m_unusedFragments.IsSet(allocation.m_identifier));
-			block.m_unusedFragments.Set(allocation.m_identifier);
+		Threading::UniqueLock lock(memoryType.m_blockMutex);
+		Block& block = memoryType.m_blocks[pageAllocation.m_blockIndex];
+		Assert(block.m_allocator.IsAllocated(pageAllocation.m_identifier, pageAllocation.m_offset, pageAllocation.m_size));
+		block.m_allocator.Deallocate(pageAllocation.m_identifier);
+		if (!isCurrent)
+		{
+			memoryType.m_pages[pageAllocation.m_pageIndex] = {};
 		}
 	}
 
+	void DeviceMemoryPool::ReleaseEmptiedPage(MemoryType& memoryType, SmallAllocationPage& page)
+	{
+		Threading::UniqueLock lock(memoryType.m_blockMutex);
+		const DeviceMemoryAllocation::PageIndexType pageIndex = page.m_pageAllocation.m_pageIndex;
+		Assert(memoryType.m_pages[pageIndex].Get() == &page);
+		memoryType.m_pages[pageIndex] = {};
+	}
+
 	DeviceMemoryPool::Allocation DeviceMemoryPool::AllocateRaw(
 		const LogicalDeviceView logicalDevice, size allocationSize, const uint8 memoryTypeIndex, const EnumFlags<MemoryFlags> memoryFlags
 	)
 	{
 		MemoryType& memoryType = m_memoryTypes[memoryTypeIndex];
 
-		Block::Fragment::IdentifierType fragmentIdentifier = memoryType.m_hostMappableMemoryIdentifierStorage.AcquireIdentifier();
+		DeviceMemoryFragment::IdentifierType fragmentIdentifier = memoryType.m_hostMappableMemoryIdentifierStorage.AcquireIdentifier();
 		if (LIKELY(fragmentIdentifier.IsValid()))
 		{
 			Assert(!memoryType.m_hostMappableMemory[fragmentIdentifier].IsValid());
@@ -500,39 +478,26 @@ namespace ngine::Rendering
 		const MemoryType& memoryType = m_memoryTypes[allocation.m_memoryTypeIndex];
 		Threading::SharedLock lock(memoryType.m_blockMutex);
 
-		if (!memoryType.m_blocks.IsValidIndex(allocation.m_blockIndex))
+		if (allocation.m_pageIndex != DeviceMemoryAllocation::InvalidPageIndex)
 		{
-			return false;
-		}
-
-		const Block& block = memoryType.m_blocks[allocation.m_blockIndex];
-		if (!block.m_fragments.GetView().IsValidIndex(allocation.m_blockIndex))
-		{
-			return false;
-		}
-
-		const Block::Fragment& fragment = block.m_fragments[allocation.m_identifier];
-
-		if (fragment.m_size != allocation.m_size)
-		{
-			return false;
-		}
+			if (!memoryType.m_pages.IsValidIndex(allocation.m_pageIndex) || memoryType.m_pages[allocation.m_pageIndex].IsInvalid())
+			{
+				return false;
+			}
 
-		if (fragment.m_offset != allocation.m_offset)
-		{
-			return false;
+			const SmallAllocationPage& page = *memoryType.m_pages[allocation.m_pageIndex];
+			Threading::UniqueLock pageLock(page.m_mutex);
+			return allocation.m_offset >= page.m_pageAllocation.m_offset && allocation.m_size == page.m_allocator.GetSlotSize() &&
+			       page.m_allocator.IsAllocated(allocation.m_offset - page.m_pageAllocation.m_offset);
 		}
 
-		if (!block.m_usedFragments.IsSet(allocation.m_identifier))
-		{
-			return false;
-		}
-		if (block.m_unusedFragments.IsSet(allocation.m_identifier))
+		if (!memoryType.m_blocks.IsValidIndex(allocation.m_blockIndex))
 		{
 			return false;
 		}
 
-		return true;
+		const Block& block = memoryType.m_blocks[allocation.m_blockIndex];
+		return block.m_allocator.IsAllocated(allocation.m_identifier, allocation.m_offset, allocation.m_size);
 	}
 
 	bool DeviceMemoryPool::IsRawAllocationValid(const Allocation allocation) const
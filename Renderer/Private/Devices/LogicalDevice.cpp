@@ -385,6 +385,7 @@ namespace ngine::Rendering
 		deviceFeatures2.features.fragmentStoresAndAtomics = requestedDeviceFeatures.IsSet(PhysicalDeviceFeatures::FragmentStoresAndAtomics);
 		deviceFeatures2.features.vertexPipelineStoresAndAtomics =
 			requestedDeviceFeatures.IsSet(PhysicalDeviceFeatures::VertexPipelineStoresAndAtomics);
+		deviceFeatures2.features.multiDrawIndirect = requestedDeviceFeatures.IsSet(PhysicalDeviceFeatures::MultiDrawIndirect);
 		deviceFeatures2.features.independentBlend = true;
 
 		VkPhysicalDeviceVulkan12Features deviceFeaturesVulkan_1_2{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES, nullptr};
@@ -122,6 +122,7 @@ namespace ngine::Rendering
 			m_supportedFeatures |= PhysicalDeviceFeatures::FragmentStoresAndAtomics * (bool)supportedFeatures2.features.fragmentStoresAndAtomics;
 			m_supportedFeatures |= PhysicalDeviceFeatures::VertexPipelineStoresAndAtomics *
 			                       (bool)supportedFeatures2.features.vertexPipelineStoresAndAtomics;
+			m_supportedFeatures |= PhysicalDeviceFeatures::MultiDrawIndirect * (bool)supportedFeatures2.features.multiDrawIndirect;
 
 			m_supportedFeatures |= PhysicalDeviceFeatures::ShaderFloat16 * (bool)(supportedDeviceVulkan1_2Features.shaderFloat16);
 			m_supportedFeatures |= PhysicalDeviceFeatures::DescriptorIndexing * (bool)(supportedDeviceVulkan1_2Features.descriptorIndexing);
@@ -295,6 +296,12 @@ namespace ngine::Rendering
 					m_memoryTypes[i] = static_cast<MemoryFlags>(memProperties.memoryTypes[i].propertyFlags) | MemoryFlags::AllocateDeviceAddress;
 				}
 			}
+
+			{
+				VkPhysicalDeviceProperties deviceProperties;
+				vkGetPhysicalDeviceProperties(device, &deviceProperties);
+				m_bufferImageGranularity = (uint32)deviceProperties.limits.bufferImageGranularity;
+			}
 		}
 #elif RENDERER_METAL
 		// TODO: All Metal command queues are general purpose by default
@@ -0,0 +1,56 @@
+#include "Devices/SlabAllocator.h"
+
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/CountBits.h>
+#include <Common/Math/Min.h>
+
+namespace ngine::Rendering
+{
+	SlabAllocator::SlabAllocator(const SizeType slotSize, const SlotIndexType slotCount)
+		: m_slotSize(slotSize)
+		, m_slotCount(slotCount)
+	{
+		Assert(slotSize > 0);
+		Assert(slotCount > 0 && slotCount <= MaximumSlotCount);
+		for (SlotIndexType wordIndex = 0; wordIndex * 64 < slotCount; ++wordIndex)
+		{
+			const SlotIndexType wordSlotCount = Math::Min(SlotIndexType(slotCount - wordIndex * 64), SlotIndexType(64));
+			m_freeSlots[wordIndex] = wordSlotCount == 64 ? ~uint64(0) : (uint64(1) << wordSlotCount) - 1;
+		}
+	}
+
+	Optional<SlabAllocator::SizeType> SlabAllocator::Allocate()
+	{
+		for (SlotIndexType wordIndex = 0; wordIndex * 64 < m_slotCount; ++wordIndex)
+		{
+			uint64& freeSlots = m_freeSlots[wordIndex];
+			if (freeSlots != 0)
+			{
+				const SlotIndexType bitIndex = (SlotIndexType)*Memory::GetFirstSetIndex(freeSlots);
+				freeSlots &= ~(uint64(1) << bitIndex);
+				m_usedSlotCount++;
+				return SizeType((wordIndex * 64 + bitIndex) * m_slotSize);
+			}
+		}
+		return Invalid;
+	}
+
+	void SlabAllocator::Deallocate(const SizeType offset)
+	{
+		Assert(IsAllocated(offset));
+		const SlotIndexType slotIndex = SlotIndexType(offset / m_slotSize);
+		m_freeSlots[slotIndex / 64] |= uint64(1) << (slotIndex % 64);
+		m_usedSlotCount--;
+	}
+
+	bool SlabAllocator::IsAllocated(const SizeType offset) const
+	{
+		if (offset % m_slotSize != 0 || offset / m_slotSize >= m_slotCount)
+		{
+			return false;
+		}
+
+		const SlotIndexType slotIndex = SlotIndexType(offset / m_slotSize);
+		return (m_freeSlots[slotIndex / 64] & (uint64(1) << (slotIndex % 64))) == 0;
+	}
+}
@@ -0,0 +1,251 @@
+#include "Devices/TlsfAllocator.h"
+
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/Align.h>
+#include <Common/Memory/CountBits.h>
+#include <Common/Math/NumericLimits.h>
+
+namespace ngine::Rendering
+{
+	TlsfAllocator::TlsfAllocator(const SizeType size)
+		: m_size(size)
+		, m_availableSpace(size)
+	{
+		const IdentifierType identifier = m_identifierStorage.AcquireIdentifier();
+		Assert(identifier.IsValid());
+		m_ranges[identifier] = Range{0, size, 0, 0, 0, 0};
+		AddFreeRange(identifier);
+	}
+
+	TlsfAllocator::Mapping TlsfAllocator::GetMapping(const SizeType size)
+	{
+		if (size < SecondLevelCount)
+		{
+			return Mapping{0, (uint8)size};
+		}
+
+		const uint8 mostSignificantBit = (uint8)*Memory::GetLastSetIndex(size);
+		return Mapping{
+			(uint8)(mostSignificantBit - SecondLevelBitCount + 1),
+			(uint8)((size >> (mostSignificantBit - SecondLevelBitCount)) ^ SecondLevelCount)
+		};
+	}
+
+	TlsfAllocator::IdentifierType TlsfAllocator::FindFreeRange(SizeType size) const
+	{
+		// Round up to the next bucket, so that every range in the found bucket is large enough
+		if (size >= SecondLevelCount)
+		{
+			const uint8 mostSignificantBit = (uint8)*Memory::GetLastSetIndex(size);
+			const SizeType roundingSize = (SizeType(1) << (mostSignificantBit - SecondLevelBitCount)) - 1;
+			if (UNLIKELY(size > Math::NumericLimits<SizeType>::Max - roundingSize))
+			{
+				return {};
+			}
+			size += roundingSize;
+		}
+
+		Mapping mapping = GetMapping(size);
+		uint32 secondLevelBitmap =
+			m_secondLevelBitmaps[mapping.m_firstLevelIndex] & (Math::NumericLimits<uint32>::Max << mapping.m_secondLevelIndex);
+		if (secondLevelBitmap == 0)
+		{
+			const uint32 firstLevelBitmap = m_firstLevelBitmap & (Math::NumericLimits<uint32>::Max << (mapping.m_firstLevelIndex + 1));
+			if (firstLevelBitmap == 0)
+			{
+				return {};
+			}
+
+			mapping.m_firstLevelIndex = (uint8)*Memory::GetFirstSetIndex(firstLevelBitmap);
+			secondLevelBitmap = m_secondLevelBitmaps[mapping.m_firstLevelIndex];
+		}
+		mapping.m_secondLevelIndex = (uint8)*Memory::GetFirstSetIndex(secondLevelBitmap);
+
+		return IdentifierType::MakeFromIndex(m_freeRangeHeads[mapping.m_firstLevelIndex * SecondLevelCount + mapping.m_secondLevelIndex]);
+	}
+
+	void TlsfAllocator::AddFreeRange(const IdentifierType identifier)
+	{
+		Assert(!m_freeRanges.IsSet(identifier));
+		Range& range = m_ranges[identifier];
+		const Mapping mapping = GetMapping(range.m_size);
+		IndexType& freeRangeHead = m_freeRangeHeads[mapping.m_firstLevelIndex * SecondLevelCount + mapping.m_secondLevelIndex];
+
+		range.m_previousFreeRangeIndex = 0;
+		range.m_nextFreeRangeIndex = freeRangeHead;
+		if (freeRangeHead != 0)
+		{
+			m_ranges[IdentifierType::MakeFromIndex(freeRangeHead)].m_previousFreeRangeIndex = identifier.GetIndex();
+		}
+		freeRangeHead = identifier.GetIndex();
+
+		m_firstLevelBitmap |= 1u << mapping.m_firstLevelIndex;
+		m_secondLevelBitmaps[mapping.m_firstLevelIndex] |= 1u << mapping.m_secondLevelIndex;
+		m_freeRanges.Set(identifier);
+	}
+
+	void TlsfAllocator::RemoveFreeRange(const IdentifierType identifier)
+	{
+		Assert(m_freeRanges.IsSet(identifier));
+		const Range& range = m_ranges[identifier];
+		if (range.m_previousFreeRangeIndex != 0)
+		{
+			m_ranges[IdentifierType::MakeFromIndex(range.m_previousFreeRangeIndex)].m_nextFreeRangeIndex = range.m_nextFreeRangeIndex;
+		}
+		else
+		{
+			const Mapping mapping = GetMapping(range.m_size);
+			IndexType& freeRangeHead = m_freeRangeHeads[mapping.m_firstLevelIndex * SecondLevelCount + mapping.m_secondLevelIndex];
+			Assert(freeRangeHead == identifier.GetIndex());
+			freeRangeHead = range.m_nextFreeRangeIndex;
+			if (freeRangeHead == 0)
+			{
+				uint32& secondLevelBitmap = m_secondLevelBitmaps[mapping.m_firstLevelIndex];
+				secondLevelBitmap &= ~(1u << mapping.m_secondLevelIndex);
+				if (secondLevelBitmap == 0)
+				{
+					m_firstLevelBitmap &= ~(1u << mapping.m_firstLevelIndex);
+				}
+			}
+		}
+
+		if (range.m_nextFreeRangeIndex != 0)
+		{
+			m_ranges[IdentifierType::MakeFromIndex(range.m_nextFreeRangeIndex)].m_previousFreeRangeIndex = range.m_previousFreeRangeIndex;
+		}
+		m_freeRanges.Clear(identifier);
+	}
+
+	TlsfAllocator::IdentifierType TlsfAllocator::SplitRange(const IdentifierType identifier, const SizeType splitOffset)
+	{
+		const IdentifierType newIdentifier = m_identifierStorage.AcquireIdentifier();
+		if (UNLIKELY(!newIdentifier.IsValid()))
+		{
+			return {};
+		}
+
+		Range& range = m_ranges[identifier];
+		Assert(splitOffset > 0 && splitOffset < range.m_size);
+		m_ranges[newIdentifier] =
+			Range{range.m_offset + splitOffset, range.m_size - splitOffset, identifier.GetIndex(), range.m_nextRangeIndex, 0, 0};
+		if (range.m_nextRangeIndex != 0)
+		{
+			m_ranges[IdentifierType::MakeFromIndex(range.m_nextRangeIndex)].m_previousRangeIndex = newIdentifier.GetIndex();
+		}
+		range.m_nextRangeIndex = newIdentifier.GetIndex();
+		range.m_size = splitOffset;
+		return newIdentifier;
+	}
+
+	void TlsfAllocator::MergeIntoPrevious(const IdentifierType identifier)
+	{
+		const Range& range = m_ranges[identifier];
+		Assert(range.m_previousRangeIndex != 0);
+		Range& previousRange = m_ranges[IdentifierType::MakeFromIndex(range.m_previousRangeIndex)];
+		Assert(previousRange.m_offset + previousRange.m_size == range.m_offset);
+		previousRange.m_size += range.m_size;
+		previousRange.m_nextRangeIndex = range.m_nextRangeIndex;
+		if (range.m_nextRangeIndex != 0)
+		{
+			m_ranges[IdentifierType::MakeFromIndex(range.m_nextRangeIndex)].m_previousRangeIndex = range.m_previousRangeIndex;
+		}
+		m_identifierStorage.ReturnIdentifier(identifier);
+	}
+
+	Optional<TlsfAllocator::Allocation> TlsfAllocator::Allocate(const SizeType size, const SizeType alignment)
+	{
+		Assert(size > 0);
+		Assert(alignment > 0 && (alignment & (alignment - 1)) == 0, "Alignment must be a power of two");
+
+		// Search for a range that fits the allocation regardless of where its offset lies
+		const SizeType alignmentPadding = alignment - 1;
+		if (UNLIKELY(size > Math::NumericLimits<SizeType>::Max - alignmentPadding))
+		{
+			return Invalid;
+		}
+
+		IdentifierType identifier = FindFreeRange(size + alignmentPadding);
+		if (!identifier.IsValid())
+		{
+			// Fall back to the exact size class, accepting a range that is already aligned
+			identifier = FindFreeRange(size);
+			if (!identifier.IsValid() || (m_ranges[identifier].m_offset & alignmentPadding) != 0)
+			{
+				return Invalid;
+			}
+		}
+		identifier = m_identifierStorage.GetActiveIdentifier(identifier);
+		RemoveFreeRange(identifier);
+
+		// Leading padding stays free, it can never be adjacent to another free range
+		const SizeType padding = Memory::Align(m_ranges[identifier].m_offset, alignment) - m_ranges[identifier].m_offset;
+		if (padding > 0)
+		{
+			const IdentifierType alignedIdentifier = SplitRange(identifier, padding);
+			AddFreeRange(identifier);
+			if (UNLIKELY(!alignedIdentifier.IsValid()))
+			{
+				return Invalid;
+			}
+			identifier = alignedIdentifier;
+		}
+
+		const Range& range = m_ranges[identifier];
+		if (range.m_size > size)
+		{
+			// If we ran out of identifiers the remainder is handed out as part of the allocation
+			const IdentifierType remainderIdentifier = SplitRange(identifier, size);
+			if (LIKELY(remainderIdentifier.IsValid()))
+			{
+				AddFreeRange(remainderIdentifier);
+			}
+		}
+
+		m_availableSpace -= range.m_size;
+		return Allocation{identifier, range.m_offset, range.m_size};
+	}
+
+	void TlsfAllocator::Deallocate(const IdentifierType identifier)
+	{
+		Assert(m_identifierStorage.IsIdentifierPotentiallyValid(identifier));
+		Assert(!m_freeRanges.IsSet(identifier));
+
+		const Range& range = m_ranges[identifier];
+		m_availableSpace += range.m_size;
+
+		if (range.m_nextRangeIndex != 0)
+		{
+			const IdentifierType nextIdentifier = IdentifierType::MakeFromIndex(range.m_nextRangeIndex);
+			if (m_freeRanges.IsSet(nextIdentifier))
+			{
+				RemoveFreeRange(nextIdentifier);
+				MergeIntoPrevious(nextIdentifier);
+			}
+		}
+
+		if (range.m_previousRangeIndex != 0)
+		{
+			const IdentifierType previousIdentifier = IdentifierType::MakeFromIndex(range.m_previousRangeIndex);
+			if (m_freeRanges.IsSet(previousIdentifier))
+			{
+				RemoveFreeRange(previousIdentifier);
+				MergeIntoPrevious(identifier);
+				AddFreeRange(previousIdentifier);
+				return;
+			}
+		}
+
+		AddFreeRange(identifier);
+	}
+
+	bool TlsfAllocator::IsAllocated(const IdentifierType identifier, const SizeType offset, const SizeType size) const
+	{
+		if (!m_identifierStorage.IsIdentifierPotentiallyValid(identifier))
+		{
+			return false;
+		}
+
+		const Range& range = m_ranges[identifier];
+		return !m_freeRanges.IsSet(identifier) && range.m_offset == offset && range.m_size == size;
+	}
+}
@@ -36,6 +36,20 @@ namespace ngine::Rendering
 		{
 			return true;
 		}
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override
+		{
+			return m_passInfo.GetComputePassInfo()->m_subpasses.GetView().Any(
+				[](const ComputeSubpassInfo& subpassInfo)
+				{
+					return subpassInfo.m_stages.GetView().Any(
+						[](const Stage& stage)
+						{
+							return stage.UpdatesSharedDescriptorSets();
+						}
+					);
+				}
+			);
+		}
 		virtual void OnBeforeRecordCommands(const CommandEncoderView commandEncoder) override
 		{
 #if RENDERER_OBJECT_DEBUG_NAMES
@@ -0,0 +1,391 @@
+#include "Framegraph/FramegraphBuilder.h"
+
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/InlineVector.h>
+#include <Common/Memory/Containers/Array.h>
+
+namespace ngine::Rendering
+{
+	namespace Internal
+	{
+		[[nodiscard]] static bool IsSameAttachment(const FramegraphAttachmentDescription& left, const FramegraphAttachmentDescription& right)
+		{
+			return left.m_identifier == right.m_identifier && left.m_subresourceRange == right.m_subresourceRange;
+		}
+
+		[[nodiscard]] static bool HasSize(const FramegraphAttachmentDescription& attachmentDescription, const Math::Vector2ui size)
+		{
+			return attachmentDescription.m_size.x == size.x && attachmentDescription.m_size.y == size.y;
+		}
+
+		//! Accumulated attachments of a chain of render pass stages being merged into a single render pass
+		struct MergedRenderPass
+		{
+			MergedRenderPass(const RenderPassDescription& passDescription)
+				: m_renderArea(passDescription.m_renderArea)
+			{
+				Merge(passDescription);
+			}
+
+			[[nodiscard]] Optional<Math::Vector2ui> GetAttachmentSize(const RenderPassDescription& passDescription) const
+			{
+				if (m_colorAttachments.HasElements())
+				{
+					return m_colorAttachments[0].m_size;
+				}
+				else if (m_depthAttachment.IsValid())
+				{
+					return m_depthAttachment->m_size;
+				}
+				else if (m_stencilAttachment.IsValid())
+				{
+					return m_stencilAttachment->m_size;
+				}
+				else if (passDescription.m_colorAttachments.HasElements())
+				{
+					return passDescription.m_colorAttachments[0].m_size;
+				}
+				else if (passDescription.m_depthAttachment.IsValid())
+				{
+					return passDescription.m_depthAttachment->m_size;
+				}
+				else if (passDescription.m_stencilAttachment.IsValid())
+				{
+					return passDescription.m_stencilAttachment->m_size;
+				}
+				return Invalid;
+			}
+
+			[[nodiscard]] bool IsWritten(const FramegraphAttachmentDescription& attachmentDescription) const
+			{
+				for (const ColorAttachmentDescription& colorAttachment : m_colorAttachments)
+				{
+					if (colorAttachment.m_identifier == attachmentDescription.m_identifier)
+					{
+						return true;
+					}
+				}
+				return (m_depthAttachment.IsValid() && m_depthAttachment->m_identifier == attachmentDescription.m_identifier) ||
+				       (m_stencilAttachment.IsValid() && m_stencilAttachment->m_identifier == attachmentDescription.m_identifier);
+			}
+
+			[[nodiscard]] bool IsRead(const FramegraphAttachmentDescription& attachmentDescription) const
+			{
+				for (const InputAttachmentDescription& inputAttachment : m_inputAttachments)
+				{
+					if (inputAttachment.m_identifier == attachmentDescription.m_identifier)
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			//! Whether an attachment written by the next pass can continue in the merged pass
+			//! Shared attachments can't be cleared again, as the load operation only applies to the first subpass using it
+			template<typename AttachmentDescriptionType>
+			[[nodiscard]] bool CanMergeAttachment(
+				const AttachmentDescriptionType& attachmentDescription, const Optional<AttachmentDescriptionType> existingAttachmentDescription
+			) const
+			{
+				if (IsRead(attachmentDescription))
+				{
+					return false;
+				}
+				if (existingAttachmentDescription.IsValid())
+				{
+					return IsSameAttachment(attachmentDescription, *existingAttachmentDescription) &&
+					       attachmentDescription.m_flags.IsNotSet(FramegraphAttachmentFlags::Clear);
+				}
+				return !IsWritten(attachmentDescription);
+			}
+
+			[[nodiscard]] bool CanMerge(const RenderPassDescription& passDescription) const
+			{
+				if (passDescription.m_renderArea != m_renderArea)
+				{
+					return false;
+				}
+
+				const Optional<Math::Vector2ui> attachmentSize = GetAttachmentSize(passDescription);
+				if (attachmentSize.IsInvalid())
+				{
+					return false;
+				}
+
+				for (const ColorAttachmentDescription& colorAttachment : passDescription.m_colorAttachments)
+				{
+					if (!HasSize(colorAttachment, *attachmentSize) || !CanMergeAttachment(colorAttachment, FindColorAttachment(colorAttachment)))
+					{
+						return false;
+					}
+				}
+				if (passDescription.m_depthAttachment.IsValid())
+				{
+					if (!HasSize(*passDescription.m_depthAttachment, *attachmentSize) || !CanMergeAttachment(*passDescription.m_depthAttachment, m_depthAttachment))
+					{
+						return false;
+					}
+				}
+				if (passDescription.m_stencilAttachment.IsValid())
+				{
+					const bool isCombinedDepthStencil = passDescription.m_depthAttachment.IsValid() &&
+					                                    passDescription.m_depthAttachment->m_identifier == passDescription.m_stencilAttachment->m_identifier;
+					if (!HasSize(*passDescription.m_stencilAttachment, *attachmentSize) || (!isCombinedDepthStencil && !CanMergeAttachment(*passDescription.m_stencilAttachment, m_stencilAttachment)))
+					{
+						return false;
+					}
+				}
+
+				// Reading attachments written earlier in the chain would require subpass inputs, which the stage doesn't know to use
+				for (const InputAttachmentDescription& inputAttachment : passDescription.m_inputAttachments)
+				{
+					if (IsWritten(inputAttachment))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			void Merge(const RenderPassDescription& passDescription)
+			{
+				constexpr EnumFlags<FramegraphAttachmentFlags> storeFlags = FramegraphAttachmentFlags::MustStore;
+
+				for (const ColorAttachmentDescription& colorAttachment : passDescription.m_colorAttachments)
+				{
+					if (const Optional<AttachmentIndex> existingIndex = FindColorAttachmentIndex(colorAttachment))
+					{
+						m_colorAttachments[*existingIndex].m_flags |= colorAttachment.m_flags & storeFlags;
+					}
+					else
+					{
+						m_colorAttachments.EmplaceBack(colorAttachment);
+					}
+				}
+				if (passDescription.m_depthAttachment.IsValid())
+				{
+					if (m_depthAttachment.IsValid())
+					{
+						m_depthAttachment->m_flags |= passDescription.m_depthAttachment->m_flags & storeFlags;
+					}
+					else
+					{
+						m_depthAttachment = passDescription.m_depthAttachment;
+					}
+				}
+				if (passDescription.m_stencilAttachment.IsValid())
+				{
+					if (m_stencilAttachment.IsValid())
+					{
+						m_stencilAttachment->m_flags |= passDescription.m_stencilAttachment->m_flags & storeFlags;
+					}
+					else
+					{
+						m_stencilAttachment = passDescription.m_stencilAttachment;
+					}
+				}
+				for (const InputAttachmentDescription& inputAttachment : passDescription.m_inputAttachments)
+				{
+					if (FindInputAttachmentIndex(inputAttachment).IsInvalid())
+					{
+						m_inputAttachments.EmplaceBack(inputAttachment);
+					}
+				}
+
+				m_stageCount++;
+			}
+
+			[[nodiscard]] Optional<AttachmentIndex> FindColorAttachmentIndex(const FramegraphAttachmentDescription& attachmentDescription) const
+			{
+				for (const ColorAttachmentDescription& colorAttachment : m_colorAttachments)
+				{
+					if (colorAttachment.m_identifier == attachmentDescription.m_identifier)
+					{
+						return m_colorAttachments.GetIteratorIndex(&colorAttachment);
+					}
+				}
+				return Invalid;
+			}
+			[[nodiscard]] Optional<ColorAttachmentDescription> FindColorAttachment(const FramegraphAttachmentDescription& attachmentDescription) const
+			{
+				if (const Optional<AttachmentIndex> index = FindColorAttachmentIndex(attachmentDescription))
+				{
+					return m_colorAttachments[*index];
+				}
+				return Invalid;
+			}
+			[[nodiscard]] Optional<AttachmentIndex> FindInputAttachmentIndex(const FramegraphAttachmentDescription& attachmentDescription) const
+			{
+				for (const InputAttachmentDescription& inputAttachment : m_inputAttachments)
+				{
+					if (IsSameAttachment(inputAttachment, attachmentDescription))
+					{
+						return m_inputAttachments.GetIteratorIndex(&inputAttachment);
+					}
+				}
+				return Invalid;
+			}
+
+			//! Gets the index of the depth or stencil attachment in the explicit pass attachment layout
+			[[nodiscard]] AttachmentIndex GetDepthAttachmentIndex() const
+			{
+				return m_depthAttachment.IsValid() ? m_colorAttachments.GetSize() : InvalidAttachmentIndex;
+			}
+			[[nodiscard]] AttachmentIndex GetStencilAttachmentIndex() const
+			{
+				if (m_stencilAttachment.IsInvalid())
+				{
+					return InvalidAttachmentIndex;
+				}
+				if (m_depthAttachment.IsValid() && m_depthAttachment->m_identifier == m_stencilAttachment->m_identifier)
+				{
+					return GetDepthAttachmentIndex();
+				}
+				return m_colorAttachments.GetSize() + m_depthAttachment.IsValid();
+			}
+			[[nodiscard]] AttachmentIndex GetFirstInputAttachmentIndex() const
+			{
+				const bool hasSeparateStencil = m_stencilAttachment.IsValid() &&
+				                                (m_depthAttachment.IsInvalid() || m_depthAttachment->m_identifier != m_stencilAttachment->m_identifier);
+				return m_colorAttachments.GetSize() + m_depthAttachment.IsValid() + hasSeparateStencil;
+			}
+
+			Math::Rectangleui m_renderArea;
+			Vector<ColorAttachmentDescription, AttachmentIndex> m_colorAttachments;
+			Optional<DepthAttachmentDescription> m_depthAttachment;
+			Optional<StencilAttachmentDescription> m_stencilAttachment;
+			Vector<InputAttachmentDescription, AttachmentIndex> m_inputAttachments;
+			StageIndex m_stageCount{0};
+		};
+	}
+
+	void FramegraphBuilder::MergeRenderPasses()
+	{
+		Vector<StageDescription, StageIndex> mergedStages;
+		mergedStages.Reserve(stages.GetSize());
+		// Maps the original stage indices to the index of the stage that ended up containing them
+		Vector<StageIndex, StageIndex> stageIndexMapping(Memory::ConstructWithSize, Memory::Uninitialized, stages.GetSize());
+
+		for (StageIndex stageIndex = 0, stageCount = stages.GetSize(); stageIndex < stageCount;)
+		{
+			StageDescription& stageDescription = stages[stageIndex];
+			const StageIndex mergedStageIndex = mergedStages.GetSize();
+			if (stageDescription.m_type != StageType::RenderPass)
+			{
+				stageIndexMapping[stageIndex] = mergedStageIndex;
+				mergedStages.EmplaceBack(Move(stageDescription));
+				stageIndex++;
+				continue;
+			}
+
+			Internal::MergedRenderPass mergedRenderPass(stageDescription.m_renderPassDescription);
+			for (StageIndex nextStageIndex = stageIndex + 1; nextStageIndex < stageCount; ++nextStageIndex)
+			{
+				const StageDescription& nextStageDescription = stages[nextStageIndex];
+				const bool canMerge = nextStageDescription.m_type == StageType::RenderPass &&
+				                      nextStageDescription.m_previousStageIndex == nextStageIndex - 1 &&
+				                      nextStageDescription.m_pSceneViewDrawer == stageDescription.m_pSceneViewDrawer.Get() &&
+				                      mergedRenderPass.CanMerge(nextStageDescription.m_renderPassDescription);
+				if (!canMerge)
+				{
+					break;
+				}
+				mergedRenderPass.Merge(nextStageDescription.m_renderPassDescription);
+			}
+
+			const StageIndex subpassCount = mergedRenderPass.m_stageCount;
+			const AttachmentIndex subpassAttachmentIndexCount = [&]()
+			{
+				AttachmentIndex count{0};
+				for (StageIndex subpassIndex = 0; subpassIndex < subpassCount; ++subpassIndex)
+				{
+					const RenderPassDescription& passDescription = stages[stageIndex + subpassIndex].m_renderPassDescription;
+					count += passDescription.m_colorAttachments.GetSize() + passDescription.m_inputAttachments.GetSize();
+				}
+				return count;
+			}();
+			const bool hasCapacity =
+				renderSubpasses.GetSize() + subpassCount <= renderSubpasses.GetCapacity() &&
+				subpassStages.GetSize() + subpassCount <= subpassStages.GetCapacity() &&
+				colorAttachments.GetSize() + mergedRenderPass.m_colorAttachments.GetSize() <= colorAttachments.GetCapacity() &&
+				inputAttachments.GetSize() + mergedRenderPass.m_inputAttachments.GetSize() <= inputAttachments.GetCapacity() &&
+				attachmentIndices.GetSize() + subpassAttachmentIndexCount <= attachmentIndices.GetCapacity();
+			if (subpassCount == 1 || !hasCapacity)
+			{
+				stageIndexMapping[stageIndex] = mergedStageIndex;
+				mergedStages.EmplaceBack(Move(stageDescription));
+				stageIndex++;
+				continue;
+			}
+
+			const ArrayView<const ColorAttachmentDescription, AttachmentIndex> mergedColorAttachments =
+				EmplaceColorAttachments(mergedRenderPass.m_colorAttachments.GetView());
+			const ArrayView<const InputAttachmentDescription, AttachmentIndex> mergedInputAttachments =
+				EmplaceInputAttachments(mergedRenderPass.m_inputAttachments.GetView());
+
+			InlineVector<RenderSubpassDescription, 8, PassIndex> subpassDescriptions;
+			subpassDescriptions.Reserve(subpassCount);
+			for (StageIndex subpassIndex = 0; subpassIndex < subpassCount; ++subpassIndex)
+			{
+				const StageDescription& subpassStageDescription = stages[stageIndex + subpassIndex];
+				const RenderPassDescription& passDescription = subpassStageDescription.m_renderPassDescription;
+				stageIndexMapping[stageIndex + subpassIndex] = mergedStageIndex;
+
+				InlineVector<AttachmentIndex, 8, AttachmentIndex> colorAttachmentIndices;
+				for (const ColorAttachmentDescription& colorAttachment : passDescription.m_colorAttachments)
+				{
+					colorAttachmentIndices.EmplaceBack(*mergedRenderPass.FindColorAttachmentIndex(colorAttachment));
+				}
+				InlineVector<AttachmentIndex, 8, AttachmentIndex> inputAttachmentIndices;
+				for (const InputAttachmentDescription& inputAttachment : passDescription.m_inputAttachments)
+				{
+					inputAttachmentIndices.EmplaceBack(
+						AttachmentIndex(mergedRenderPass.GetFirstInputAttachmentIndex() + *mergedRenderPass.FindInputAttachmentIndex(inputAttachment))
+					);
+				}
+
+				ArrayView<const ReferenceWrapper<Stage>, StageIndex> stageReferences;
+				if (subpassStageDescription.m_pStage.IsValid())
+				{
+					stageReferences = EmplaceSubpassStages(Array<ReferenceWrapper<Stage>, 1>{*subpassStageDescription.m_pStage});
+				}
+
+				subpassDescriptions.EmplaceBack(RenderSubpassDescription{
+					subpassStageDescription.m_name,
+					stageReferences,
+					EmplaceAttachmentIndices(colorAttachmentIndices.GetView()),
+					passDescription.m_depthAttachment.IsValid() ? mergedRenderPass.GetDepthAttachmentIndex() : InvalidAttachmentIndex,
+					passDescription.m_stencilAttachment.IsValid() ? mergedRenderPass.GetStencilAttachmentIndex() : InvalidAttachmentIndex,
+					ArrayView<const AttachmentIndex, AttachmentIndex>{},
+					EmplaceAttachmentIndices(inputAttachmentIndices.GetView())
+				});
+			}
+
+			mergedStages.EmplaceBack(ExplicitRenderPassStageDescription{
+				stageDescription.m_name,
+				stageDescription.m_previousStageIndex,
+				Invalid,
+				stageDescription.m_pSceneViewDrawer,
+				mergedRenderPass.m_renderArea,
+				mergedColorAttachments,
+				mergedRenderPass.m_depthAttachment,
+				mergedRenderPass.m_stencilAttachment,
+				mergedInputAttachments,
+				EmplaceRenderSubpass(subpassDescriptions.GetView())
+			});
+			stageIndex += subpassCount;
+		}
+
+		stages.Clear();
+		for (StageDescription& stageDescription : mergedStages)
+		{
+			if (stageDescription.m_previousStageIndex != InvalidStageIndex)
+			{
+				stageDescription.m_previousStageIndex = stageIndexMapping[stageDescription.m_previousStageIndex];
+			}
+			stages.EmplaceBack(Move(stageDescription));
+		}
+	}
+}
@@ -32,7 +32,7 @@ namespace ngine::Rendering
 		, m_endStage(Threading::CreateCallback(
 				[this](Threading::JobRunnerThread&)
 				{
-					// TODO: Multiple frames in flight
+					// Frames are recorded one at a time, while previous frames may still be executing on the GPU
 					const FrameMask processingFramesMask = m_processingFrameCpuMask.Load();
 					Assert(Memory::GetNumberOfSetBits(processingFramesMask) == 1);
 					const FrameIndex frameIndex = Math::Log2(processingFramesMask);
@@ -43,13 +43,9 @@ namespace ngine::Rendering
 				"Framegraph End Stage"
 			))
 		, m_finishFrameGpuExecutionStage(Threading::CreateCallback(
-				[this](Threading::JobRunnerThread&)
+				[](Threading::JobRunnerThread&)
 				{
-					// TODO: Multiple frames in flight
-					const FrameMask processingFramesMask = m_processingFrameGpuMask.Load();
-					Assert(Memory::GetNumberOfSetBits(processingFramesMask) == 1);
-					const FrameIndex frameIndex = Math::Log2(processingFramesMask);
-					OnFinishFrameGpuExecution(frameIndex);
+					// Queued by OnFinishFrameGpuExecution once a frame's tracked stages all finished executing
 					return Threading::CallbackResult::Finished;
 				},
 				Threading::JobPriority::Submit,
@@ -58,7 +54,6 @@ namespace ngine::Rendering
 		, m_pAcquireRenderOutputImageStage(Memory::ConstructInPlace, logicalDevice, renderOutput)
 		, m_pPresentRenderOutputImageStage(Memory::ConstructInPlace, logicalDevice, renderOutput, *m_pAcquireRenderOutputImageStage)
 	{
-		m_startStage.AddSubsequentStage(m_finishFrameGpuExecutionStage);
 		m_startStage.AddSubsequentStage(m_endStage);
 	}
 
@@ -222,14 +217,15 @@ namespace ngine::Rendering
 						{
 							passInfo.GetStage()->GetSubmitJob().AddSubsequentStage(subpassStage.GetSubmitJob());
 						}
-						if (!passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(subpassStage.GetFinishedExecutionStage()))
-						{
-							passInfo.GetStage()->GetFinishedExecutionStage().AddSubsequentStage(subpassStage.GetFinishedExecutionStage());
-						}
-						if (!subpassStage.GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
+						for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
 						{
-							subpassStage.GetFinishedExecutionStage().AddSubsequentStage(m_finishFrameGpuExecutionStage);
+							Threading::AsyncCallbackJobBase& finishedExecutionStage = passInfo.GetStage()->GetFinishedExecutionStage(frameIndex);
+							if (!finishedExecutionStage.IsDirectlyFollowedBy(subpassStage.GetFinishedExecutionStage(frameIndex)))
+							{
+								finishedExecutionStage.AddSubsequentStage(subpassStage.GetFinishedExecutionStage(frameIndex));
+							}
 						}
+						TrackStageGpuExecution(subpassStage);
 						if (!subpassStage.GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 						{
 							subpassStage.GetSubmitJob().AddSubsequentStage(m_endStage);
@@ -247,24 +243,22 @@ namespace ngine::Rendering
 				{
 					passInfo.GetStage()->GetSubmitJob().AddSubsequentStage(pGenericPassInfo->m_stage.GetSubmitJob());
 				}
-				if (!passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(pGenericPassInfo->m_stage.GetFinishedExecutionStage()))
-				{
-					passInfo.GetStage()->GetFinishedExecutionStage().AddSubsequentStage(pGenericPassInfo->m_stage.GetFinishedExecutionStage());
-				}
-				if (!pGenericPassInfo->m_stage.GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
+				for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
 				{
-					pGenericPassInfo->m_stage.GetFinishedExecutionStage().AddSubsequentStage(m_finishFrameGpuExecutionStage);
+					Threading::AsyncCallbackJobBase& finishedExecutionStage = passInfo.GetStage()->GetFinishedExecutionStage(frameIndex);
+					if (!finishedExecutionStage.IsDirectlyFollowedBy(pGenericPassInfo->m_stage.GetFinishedExecutionStage(frameIndex)))
+					{
+						finishedExecutionStage.AddSubsequentStage(pGenericPassInfo->m_stage.GetFinishedExecutionStage(frameIndex));
+					}
 				}
+				TrackStageGpuExecution(pGenericPassInfo->m_stage);
 				if (!pGenericPassInfo->m_stage.GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 				{
 					pGenericPassInfo->m_stage.GetSubmitJob().AddSubsequentStage(m_endStage);
 				}
 			}
 
-			if (!passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
-			{
-				passInfo.GetStage()->GetFinishedExecutionStage().AddSubsequentStage(m_finishFrameGpuExecutionStage);
-			}
+			TrackStageGpuExecution(*passInfo.GetStage());
 			if (!passInfo.GetStage()->GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 			{
 				passInfo.GetStage()->GetSubmitJob().AddSubsequentStage(m_endStage);
@@ -280,7 +274,8 @@ namespace ngine::Rendering
 		if (m_lastRenderOutputPassIndex != InvalidPassIndex)
 		{
 			m_passes[m_lastRenderOutputPassIndex].GetStage()->AddSubsequentGpuStage(*m_pPresentRenderOutputImageStage);
-			m_pPresentRenderOutputImageStage->AddSubsequentStage(m_finishFrameGpuExecutionStage);
+			// Presenting is part of the frame's CPU work, the next frame can't start until the image was handed back
+			m_pPresentRenderOutputImageStage->AddSubsequentStage(m_endStage);
 		}
 
 		m_isEnabled = true;
@@ -336,17 +331,16 @@ namespace ngine::Rendering
 								->GetSubmitJob()
 								.RemoveSubsequentStage(subpassStage.GetSubmitJob(), Invalid, Threading::Job::RemovalFlags{});
 						}
-						if (passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(subpassStage.GetFinishedExecutionStage()))
-						{
-							passInfo.GetStage()
-								->GetFinishedExecutionStage()
-								.RemoveSubsequentStage(subpassStage.GetFinishedExecutionStage(), Invalid, Threading::Job::RemovalFlags{});
-						}
-						if (subpassStage.GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
+						for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
 						{
-							subpassStage.GetFinishedExecutionStage()
-								.RemoveSubsequentStage(m_finishFrameGpuExecutionStage, Invalid, Threading::Job::RemovalFlags{});
+							Threading::AsyncCallbackJobBase& finishedExecutionStage = passInfo.GetStage()->GetFinishedExecutionStage(frameIndex);
+							if (finishedExecutionStage.IsDirectlyFollowedBy(subpassStage.GetFinishedExecutionStage(frameIndex)))
+							{
+								finishedExecutionStage
+									.RemoveSubsequentStage(subpassStage.GetFinishedExecutionStage(frameIndex), Invalid, Threading::Job::RemovalFlags{});
+							}
 						}
+						subpassStage.m_pFramegraph = Invalid;
 						if (subpassStage.GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 						{
 							subpassStage.GetSubmitJob().RemoveSubsequentStage(m_endStage, Invalid, Threading::Job::RemovalFlags{});
@@ -366,29 +360,23 @@ namespace ngine::Rendering
 						->GetSubmitJob()
 						.RemoveSubsequentStage(pGenericPassInfo->m_stage.GetSubmitJob(), Invalid, Threading::Job::RemovalFlags{});
 				}
-				if (passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(pGenericPassInfo->m_stage.GetFinishedExecutionStage()))
-				{
-					passInfo.GetStage()
-						->GetFinishedExecutionStage()
-						.RemoveSubsequentStage(pGenericPassInfo->m_stage.GetFinishedExecutionStage(), Invalid, Threading::Job::RemovalFlags{});
-				}
-				if (pGenericPassInfo->m_stage.GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
+				for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
 				{
-					pGenericPassInfo->m_stage.GetFinishedExecutionStage()
-						.RemoveSubsequentStage(m_finishFrameGpuExecutionStage, Invalid, Threading::Job::RemovalFlags{});
+					Threading::AsyncCallbackJobBase& finishedExecutionStage = passInfo.GetStage()->GetFinishedExecutionStage(frameIndex);
+					if (finishedExecutionStage.IsDirectlyFollowedBy(pGenericPassInfo->m_stage.GetFinishedExecutionStage(frameIndex)))
+					{
+						finishedExecutionStage
+							.RemoveSubsequentStage(pGenericPassInfo->m_stage.GetFinishedExecutionStage(frameIndex), Invalid, Threading::Job::RemovalFlags{});
+					}
 				}
+				pGenericPassInfo->m_stage.m_pFramegraph = Invalid;
 				if (pGenericPassInfo->m_stage.GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 				{
 					pGenericPassInfo->m_stage.GetSubmitJob().RemoveSubsequentStage(m_endStage, Invalid, Threading::Job::RemovalFlags{});
 				}
 			}
 
-			if (passInfo.GetStage()->GetFinishedExecutionStage().IsDirectlyFollowedBy(m_finishFrameGpuExecutionStage))
-			{
-				passInfo.GetStage()
-					->GetFinishedExecutionStage()
-					.RemoveSubsequentStage(m_finishFrameGpuExecutionStage, Invalid, Threading::Job::RemovalFlags{});
-			}
+			passInfo.GetStage()->m_pFramegraph = Invalid;
 			if (passInfo.GetStage()->GetSubmitJob().IsDirectlyFollowedBy(m_endStage))
 			{
 				passInfo.GetStage()->GetSubmitJob().RemoveSubsequentStage(m_endStage, Invalid, Threading::Job::RemovalFlags{});
@@ -405,8 +393,10 @@ namespace ngine::Rendering
 		if (m_lastRenderOutputPassIndex != InvalidPassIndex)
 		{
 			m_passes[m_lastRenderOutputPassIndex].GetStage()->RemoveSubsequentGpuStage(*m_pPresentRenderOutputImageStage);
-			m_pPresentRenderOutputImageStage->RemoveSubsequentStage(m_finishFrameGpuExecutionStage, Invalid, Threading::Job::RemovalFlags{});
+			m_pPresentRenderOutputImageStage->RemoveSubsequentStage(m_endStage, Invalid, Threading::Job::RemovalFlags{});
 		}
+
+		m_trackedGpuStageCount = 0;
 	}
 
 	Optional<Stage*> Framegraph::GetStagePass(Stage& stage) const
@@ -480,18 +470,18 @@ namespace ngine::Rendering
 		}
 	}
 
-	void Framegraph::WaitForProcessingFramesToFinish(const FrameMask frameMask)
+	void Framegraph::WaitForProcessingFramesToFinish(const FrameMask cpuFrameMask, const FrameMask gpuFrameMask)
 	{
 		if (Optional<Threading::JobRunnerThread*> pCurrentThread = Threading::JobRunnerThread::GetCurrent())
 		{
-			while ((m_processingFrameCpuMask.Load() & frameMask) != 0 || (m_processingFrameGpuMask.Load() & frameMask) != 0)
+			while ((m_processingFrameCpuMask.Load() & cpuFrameMask) != 0 || (m_processingFrameGpuMask.Load() & gpuFrameMask) != 0)
 			{
 				pCurrentThread->DoRunNextJob();
 			}
 		}
 		else
 		{
-			while ((m_processingFrameCpuMask.Load() & frameMask) != 0 || (m_processingFrameGpuMask.Load() & frameMask) != 0)
+			while ((m_processingFrameCpuMask.Load() & cpuFrameMask) != 0 || (m_processingFrameGpuMask.Load() & gpuFrameMask) != 0)
 				;
 		}
 	}
@@ -500,33 +490,39 @@ namespace ngine::Rendering
 	{
 		Engine& engine = System::Get<Engine>();
 		const FrameIndex frameIndex = engine.GetCurrentFrameIndex();
+		const FrameMask frameMask = FrameMask(1u << frameIndex);
 
-		WaitForProcessingFramesToFinish(Rendering::AllFramesMask);
+		// Recording is serialized, but earlier frames can keep executing on the GPU until their per-frame resources are needed again
+		WaitForProcessingFramesToFinish(Rendering::AllFramesMask, frameMask);
 
-		const FrameMask frameMask = FrameMask(1u << frameIndex);
 		{
 			const FrameMask previousFrameMask = m_processingFrameCpuMask.FetchOr(frameMask);
-			[[maybe_unused]] const bool canStartFrame = (previousFrameMask & frameMask) == 0;
+			[[maybe_unused]] const bool canStartFrame = previousFrameMask == 0;
 			Assert(canStartFrame);
-			Assert(previousFrameMask == 0, "TODO: Multiple frames in flight");
 		}
+		m_remainingGpuStageCounts[frameIndex] = m_trackedGpuStageCount;
 		{
 			const FrameMask previousFrameMask = m_processingFrameGpuMask.FetchOr(frameMask);
 			[[maybe_unused]] const bool canStartFrame = (previousFrameMask & frameMask) == 0;
 			Assert(canStartFrame);
-			Assert(previousFrameMask == 0, "TODO: Multiple frames in flight");
 		}
 
-		m_pStartFrameThread = *Threading::EngineJobRunnerThread::GetCurrent();
+		Threading::EngineJobRunnerThread& startFrameThread = *Threading::EngineJobRunnerThread::GetCurrent();
+		m_startFrameThreads[frameIndex] = &startFrameThread;
 
 		while (m_pendingCompilationTasks.Load() > 0)
 		{
-			m_pStartFrameThread->DoRunNextJob();
+			startFrameThread.DoRunNextJob();
 		}
 
-		m_pStartFrameThread->GetRenderData().OnStartFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
-		m_pStartFrameThread->GetRenderData().OnStartFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
-		m_pStartFrameThread->GetRenderData().OnStartFrameGpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		startFrameThread.GetRenderData().OnStartFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		startFrameThread.GetRenderData().OnStartFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		startFrameThread.GetRenderData().OnStartFrameGpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+
+		if (m_trackedGpuStageCount == 0)
+		{
+			OnFinishFrameGpuExecution(frameIndex);
+		}
 	}
 
 	void Framegraph::OnEndFrame(const FrameIndex frameIndex)
@@ -536,17 +532,85 @@ namespace ngine::Rendering
 		[[maybe_unused]] const bool finishedFrame = (previousFrameMask & frameMask) == frameMask;
 		Assert(finishedFrame);
 
-		m_pStartFrameThread->GetRenderData().OnFinishFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		m_startFrameThreads[frameIndex]->GetRenderData().OnFinishFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+	}
+
+	void Framegraph::TrackStageGpuExecution(Stage& stage)
+	{
+		// Stages managed by a pass never submit on their own
+		if (stage.m_pFramegraph != this && !stage.IsManagedByRenderPass())
+		{
+			Assert(stage.m_pFramegraph.IsInvalid());
+			stage.m_pFramegraph = this;
+			m_trackedGpuStageCount++;
+		}
+	}
+
+	void Framegraph::OnStageFinishedGpuExecution(const FrameIndex frameIndex)
+	{
+		const uint16 previousCount = m_remainingGpuStageCounts[frameIndex].FetchSubtract(1);
+		Assert(previousCount > 0);
+		if (previousCount == 1)
+		{
+			OnFinishFrameGpuExecution(frameIndex);
+		}
+	}
+
+	bool Framegraph::DeferUntilPreviousFramesGpuExecution(const FrameIndex frameIndex, DeferredCallback&& callback)
+	{
+		const FrameMask previousFramesMask = FrameMask(AllFramesMask & ~(1u << frameIndex));
+
+		// Checked under the lock, so a frame finishing concurrently either sees the work or is seen as finished here
+		Threading::UniqueLock lock(m_deferredWorkMutex);
+		if ((m_processingFrameGpuMask.Load() & previousFramesMask) == 0)
+		{
+			return false;
+		}
+
+		m_deferredWork.EmplaceBack(DeferredWork{frameIndex, Move(callback)});
+		return true;
 	}
 
 	void Framegraph::OnFinishFrameGpuExecution(const FrameIndex frameIndex)
 	{
 		const FrameMask frameMask = FrameMask(1u << frameIndex);
-		const FrameMask previousFrameMask = m_processingFrameGpuMask.FetchAnd((FrameMask)~frameMask);
-		[[maybe_unused]] const bool finishedFrame = (previousFrameMask & frameMask) == frameMask;
-		Assert(finishedFrame);
+		Assert((m_processingFrameGpuMask.Load() & frameMask) == frameMask);
+
+		Threading::EngineJobRunnerThread& startFrameThread = *m_startFrameThreads[frameIndex];
+		startFrameThread.GetRenderData().OnFinishFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		startFrameThread.GetRenderData().OnFinishFrameGpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+
+		if (m_finishFrameGpuExecutionStage.HasSubsequentTasks())
+		{
+			m_finishFrameGpuExecutionStage.Queue(System::Get<Threading::JobManager>());
+		}
+
+		// Only release the frame index once its per-frame data was handed back, as the next frame using it may start immediately
+		[[maybe_unused]] const FrameMask previousFrameMask = m_processingFrameGpuMask.FetchAnd((FrameMask)~frameMask);
+		Assert((previousFrameMask & frameMask) == frameMask);
 
-		m_pStartFrameThread->GetRenderData().OnFinishFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
-		m_pStartFrameThread->GetRenderData().OnFinishFrameGpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
+		// Release work that was waiting for this frame, this can be called from a thread awaiting fences so always go through the job system
+		Threading::UniqueLock lock(m_deferredWorkMutex);
+		const FrameMask processingFramesMask = m_processingFrameGpuMask.Load();
+		for (uint32 index = 0; index < m_deferredWork.GetSize();)
+		{
+			DeferredWork& deferredWork = m_deferredWork[index];
+			const FrameMask previousFramesMask = FrameMask(AllFramesMask & ~(1u << deferredWork.m_frameIndex));
+			if ((processingFramesMask & previousFramesMask) == 0)
+			{
+				System::Get<Threading::JobManager>().QueueCallback(
+					[callback = Move(deferredWork.m_callback)](Threading::JobRunnerThread& thread)
+					{
+						callback(thread);
+					},
+					Threading::JobPriority::Submit
+				);
+				m_deferredWork.Remove(m_deferredWork.begin() + index);
+			}
+			else
+			{
+				++index;
+			}
+		}
 	}
 }
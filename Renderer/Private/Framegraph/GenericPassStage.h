@@ -35,6 +35,10 @@ namespace ngine::Rendering
 		{
 			return true;
 		}
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override
+		{
+			return m_passInfo.GetGenericPassInfo()->m_stage.UpdatesSharedDescriptorSets();
+		}
 		virtual void OnBeforeRecordCommands(const CommandEncoderView commandEncoder) override
 		{
 #if RENDERER_OBJECT_DEBUG_NAMES
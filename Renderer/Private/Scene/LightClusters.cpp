@@ -0,0 +1,233 @@
+#include "Scene/LightClusters.h"
+
+#include <Common/Math/Clamp.h>
+#include <Common/Math/Floor.h>
+#include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Power.h>
+
+namespace ngine::Rendering::LightClusters
+{
+	namespace Internal
+	{
+		struct TileRange
+		{
+			uint32 m_first;
+			uint32 m_last;
+		};
+
+		//! Gets the tiles along one axis that a light can overlap within a depth range
+		//! The view space extent of a tile at depth d is its normalized coordinate range scaled by d * tan, so the light's extent is divided
+		//! by the depth that widens it the most. The range is padded by a tile so that rounding never drops a cluster the exact test accepts.
+		[[nodiscard]] static bool GetTileRange(
+			const float center,
+			const float radius,
+			const float tanHalfFieldOfView,
+			const float nearDepth,
+			const float farDepth,
+			const uint32 tileCount,
+			TileRange& rangeOut
+		)
+		{
+			const float minimum = center - radius;
+			const float maximum = center + radius;
+			const float minimumCoordinate = minimum / ((minimum >= 0.f ? farDepth : nearDepth) * tanHalfFieldOfView);
+			const float maximumCoordinate = maximum / ((maximum >= 0.f ? nearDepth : farDepth) * tanHalfFieldOfView);
+			if (maximumCoordinate < -1.f || minimumCoordinate > 1.f)
+			{
+				return false;
+			}
+
+			const float clampedMinimum = Math::Max(minimumCoordinate, -1.f);
+			const float clampedMaximum = Math::Min(maximumCoordinate, 1.f);
+			const int32 first = (int32)Math::Floor((clampedMinimum * 0.5f + 0.5f) * (float)tileCount) - 1;
+			const int32 last = (int32)Math::Floor((clampedMaximum * 0.5f + 0.5f) * (float)tileCount) + 1;
+			rangeOut.m_first = (uint32)Math::Clamp(first, (int32)0, (int32)tileCount - 1);
+			rangeOut.m_last = (uint32)Math::Clamp(last, (int32)0, (int32)tileCount - 1);
+			return true;
+		}
+	}
+
+	float Grid::GetSliceDepth(const uint32 sliceIndex) const
+	{
+		if (sliceIndex >= m_sliceCount)
+		{
+			return m_farPlane;
+		}
+		return m_nearPlane * Math::Power(m_farPlane / m_nearPlane, (float)sliceIndex / (float)m_sliceCount);
+	}
+
+	ClusterBounds Grid::GetClusterBounds(const uint32 x, const uint32 y, const uint32 sliceIndex) const
+	{
+		const float nearDepth = GetSliceDepth(sliceIndex);
+		const float farDepth = GetSliceDepth(sliceIndex + 1);
+
+		const Math::Vector2f tileSize = Math::Vector2f{2.f} / Math::Vector2f{(float)m_tileCount.x, (float)m_tileCount.y};
+		const Math::Vector2f minimumCoordinate =
+			Math::Vector2f{(float)x * tileSize.x - 1.f, (float)y * tileSize.y - 1.f} * m_tanHalfFieldOfView;
+		const Math::Vector2f maximumCoordinate =
+			Math::Vector2f{(float)(x + 1) * tileSize.x - 1.f, (float)(y + 1) * tileSize.y - 1.f} * m_tanHalfFieldOfView;
+
+		// Tile edges spread out with depth, so the extremes are on either the near or the far face
+		return ClusterBounds{
+			Math::Vector3f{
+				Math::Min(minimumCoordinate.x * nearDepth, minimumCoordinate.x * farDepth),
+				Math::Min(minimumCoordinate.y * nearDepth, minimumCoordinate.y * farDepth),
+				nearDepth
+			},
+			Math::Vector3f{
+				Math::Max(maximumCoordinate.x * nearDepth, maximumCoordinate.x * farDepth),
+				Math::Max(maximumCoordinate.y * nearDepth, maximumCoordinate.y * farDepth),
+				farDepth
+			}
+		};
+	}
+
+	bool Intersects(const ClusterBounds& bounds, const LightBounds& light)
+	{
+		const Math::Vector3f position = light.m_viewPosition;
+		const float distanceX = Math::Max(Math::Max(bounds.m_minimum.x - position.x, position.x - bounds.m_maximum.x), 0.f);
+		const float distanceY = Math::Max(Math::Max(bounds.m_minimum.y - position.y, position.y - bounds.m_maximum.y), 0.f);
+		const float distanceZ = Math::Max(Math::Max(bounds.m_minimum.z - position.z, position.z - bounds.m_maximum.z), 0.f);
+		return distanceX * distanceX + distanceY * distanceY + distanceZ * distanceZ <= light.m_radius * light.m_radius;
+	}
+
+	void AssignSlice(
+		const Grid& grid,
+		const ArrayView<const LightBounds, uint32> lights,
+		const uint32 sliceIndex,
+		const ArrayView<Cluster, uint32> sliceClustersOut,
+		Vector<uint32, uint32>& sliceLightIndicesOut
+	)
+	{
+		Assert(sliceClustersOut.GetSize() == grid.GetSliceClusterCount());
+		Assert(grid.m_nearPlane > 0.f);
+		for (Cluster& cluster : sliceClustersOut)
+		{
+			cluster = Cluster{0, 0};
+		}
+		sliceLightIndicesOut.Clear();
+
+		const float nearDepth = grid.GetSliceDepth(sliceIndex);
+		const float farDepth = grid.GetSliceDepth(sliceIndex + 1);
+
+		// Collect the overlapping clusters of each light, light order is kept so every cluster lists its lights in ascending order
+		struct Entry
+		{
+			uint32 m_clusterIndex;
+			uint32 m_lightIndex;
+		};
+		Vector<Entry, uint32> entries;
+		for (uint32 lightIndex = 0, lightCount = lights.GetSize(); lightIndex < lightCount; ++lightIndex)
+		{
+			const LightBounds& __restrict light = lights[lightIndex];
+
+			// Matches the depth term of Intersects so that no light the exact test accepts is skipped
+			const float distanceZ = Math::Max(Math::Max(nearDepth - light.m_viewPosition.z, light.m_viewPosition.z - farDepth), 0.f);
+			if (distanceZ * distanceZ > light.m_radius * light.m_radius)
+			{
+				continue;
+			}
+
+			Internal::TileRange rangeX, rangeY;
+			if (!Internal::GetTileRange(
+						light.m_viewPosition.x,
+						light.m_radius,
+						grid.m_tanHalfFieldOfView.x,
+						nearDepth,
+						farDepth,
+						grid.m_tileCount.x,
+						rangeX
+					) ||
+			    !Internal::GetTileRange(
+						light.m_viewPosition.y,
+						light.m_radius,
+						grid.m_tanHalfFieldOfView.y,
+						nearDepth,
+						farDepth,
+						grid.m_tileCount.y,
+						rangeY
+					))
+			{
+				continue;
+			}
+
+			for (uint32 y = rangeY.m_first; y <= rangeY.m_last; ++y)
+			{
+				for (uint32 x = rangeX.m_first; x <= rangeX.m_last; ++x)
+				{
+					if (Intersects(grid.GetClusterBounds(x, y, sliceIndex), light))
+					{
+						const uint32 clusterIndex = y * grid.m_tileCount.x + x;
+						sliceClustersOut[clusterIndex].m_lightCount++;
+						entries.EmplaceBack(Entry{clusterIndex, lightIndex});
+					}
+				}
+			}
+		}
+
+		uint32 nextLightIndex = 0;
+		for (Cluster& cluster : sliceClustersOut)
+		{
+			cluster.m_firstLightIndex = nextLightIndex;
+			nextLightIndex += cluster.m_lightCount;
+			cluster.m_lightCount = 0;
+		}
+
+		sliceLightIndicesOut.Resize(entries.GetSize());
+		for (const Entry& entry : entries)
+		{
+			Cluster& cluster = sliceClustersOut[entry.m_clusterIndex];
+			sliceLightIndicesOut[cluster.m_firstLightIndex + cluster.m_lightCount] = entry.m_lightIndex;
+			cluster.m_lightCount++;
+		}
+	}
+
+	void AppendSlice(
+		const ArrayView<Cluster, uint32> sliceClusters, const ArrayView<const uint32, uint32> sliceLightIndices, Vector<uint32, uint32>& lightIndicesOut
+	)
+	{
+		const uint32 offset = lightIndicesOut.GetSize();
+		for (Cluster& cluster : sliceClusters)
+		{
+			cluster.m_firstLightIndex += offset;
+		}
+		lightIndicesOut.CopyEmplaceRangeBack(sliceLightIndices);
+	}
+
+	void LimitLightIndexCount(const ArrayView<Cluster, uint32> clusters, Vector<uint32, uint32>& lightIndices, const uint32 maximumCount)
+	{
+		if (lightIndices.GetSize() <= maximumCount)
+		{
+			return;
+		}
+
+		for (Cluster& cluster : clusters)
+		{
+			const uint32 firstLightIndex = Math::Min(cluster.m_firstLightIndex, maximumCount);
+			cluster.m_lightCount = Math::Min(cluster.m_firstLightIndex + cluster.m_lightCount, maximumCount) - firstLightIndex;
+			cluster.m_firstLightIndex = firstLightIndex;
+		}
+		lightIndices.Resize(maximumCount);
+	}
+
+	void Assign(
+		const Grid& grid,
+		const ArrayView<const LightBounds, uint32> lights,
+		const ArrayView<Cluster, uint32> clustersOut,
+		Vector<uint32, uint32>& lightIndicesOut
+	)
+	{
+		Assert(clustersOut.GetSize() == grid.GetClusterCount());
+		lightIndicesOut.Clear();
+
+		const uint32 sliceClusterCount = grid.GetSliceClusterCount();
+		Vector<uint32, uint32> sliceLightIndices;
+		for (uint32 sliceIndex = 0; sliceIndex < grid.m_sliceCount; ++sliceIndex)
+		{
+			const ArrayView<Cluster, uint32> sliceClusters = clustersOut.GetSubView(sliceIndex * sliceClusterCount, sliceClusterCount);
+			AssignSlice(grid, lights, sliceIndex, sliceClusters, sliceLightIndices);
+			AppendSlice(sliceClusters, sliceLightIndices.GetView(), lightIndicesOut);
+		}
+	}
+}
@@ -14,6 +14,7 @@
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
 #include <Common/Math/Primitives/CullingFrustum.h>
 #include <Common/Math/Primitives/Transform/BoundingBox.h>
+#include <Common/Math/Tan.h>
 
 #include <Engine/Engine.h>
 #include <Engine/Scene/Scene.h>
@@ -35,6 +36,7 @@
 #include <Renderer/Commands/BlitCommandEncoder.h>
 #include <Renderer/RenderOutput/RenderOutput.h>
 #include <Renderer/Assets/Material/RenderMaterial.h>
+#include <Renderer/Assets/StaticMesh/MeshLevelOfDetail.h>
 #include <Renderer/Assets/Texture/RenderTexture.h>
 #include <Renderer/Devices/LogicalDevice.h>
 
@@ -250,6 +252,34 @@ namespace ngine::Rendering
 			perFrameStagingBuffer
 		);
 		m_transformBuffer.StartFrame(graphicsCommandEncoder);
+
+		// Apply the texture usage reported by material stages during previous frames
+		m_logicalDevice.GetRenderer().GetTextureCache().UpdateStreaming(m_logicalDevice);
+	}
+
+	void SceneView::PrepareOctreeTraversal()
+	{
+		m_viewFrustum = ViewFrustum(m_viewMatrices.GetMatrix(ViewMatrices::Type::ViewProjection));
+		{
+			Threading::UniqueLock lock(m_shadowCasterVolumesMutex);
+			m_cullingVolumes.Set(m_viewFrustum, m_shadowCasterVolumes.GetView());
+		}
+
+		if (const Optional<Entity::CameraComponent*> pCameraComponent = GetActiveCameraComponentSafe())
+		{
+			m_screenSizeViewLocation = pCameraComponent->GetWorldLocation();
+			m_screenSizeProjectionScale = 1.f / Math::Tan(pCameraComponent->GetFieldOfView().GetRadians() * 0.5f);
+		}
+	}
+
+	void SceneView::SetShadowCasterVolumes(const ArrayView<const ViewFrustum, uint8> volumes)
+	{
+		Threading::UniqueLock lock(m_shadowCasterVolumesMutex);
+		m_shadowCasterVolumes.Clear();
+		for (const ViewFrustum& volume : volumes)
+		{
+			m_shadowCasterVolumes.EmplaceBack(volume);
+		}
 	}
 
 	void SceneView::StartLateStageOctreeVisibilityCheck()
@@ -285,9 +315,131 @@ namespace ngine::Rendering
 
 		const Math::WorldBoundingBox renderItemWorldBoundingBox = Math::Transform(renderItemWorldTransform, renderItemBoundingBox);
 
-		const bool isVisible = renderItemFlags.AreNoneSet(Entity::ComponentFlags::IsDisabledFromAnySource) &
-		                       renderItemWorldBoundingBox.IsVisibleFromFrustum();
-		return SceneViewBase::ProcessComponent(sceneRegistry, componentIdentifier, component, isVisible);
+		CullingVolumes::Visibility visibility = renderItemFlags.AreNoneSet(Entity::ComponentFlags::IsDisabledFromAnySource)
+		                                          ? m_cullingVolumes.GetVisibility(renderItemWorldBoundingBox, m_cullingVolumes.GetRootClassification())
+		                                          : CullingVolumes::Visibility::Hidden;
+		if (visibility == CullingVolumes::Visibility::ShadowCaster && !component.IsStaticMesh(sceneRegistry))
+		{
+			visibility = CullingVolumes::Visibility::Hidden;
+		}
+		const TraversalResult traversalResult = SceneViewBase::ProcessComponent(
+			sceneRegistry,
+			componentIdentifier,
+			component,
+			visibility != CullingVolumes::Visibility::Hidden,
+			visibility == CullingVolumes::Visibility::ShadowCaster
+		);
+		if (m_screenSizeDependentStages.AreAnySet())
+		{
+			const Entity::RenderItemIdentifier renderItemIdentifier =
+				sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>().GetComponentImplementationUnchecked(componentIdentifier);
+			UpdateRenderItemScreenSizeClass(renderItemIdentifier, renderItemWorldBoundingBox, traversalResult);
+		}
+		return traversalResult;
+	}
+
+	CullingVolumes::Visibility SceneView::IsComponentVisibleFromOctreeTraversal(
+		Entity::HierarchyComponentBase& component, const CullingVolumes::Classification nodeClassification
+	) const
+	{
+		Scene& scene = *GetSceneChecked();
+		Entity::SceneRegistry& sceneRegistry = scene.GetEntitySceneRegistry();
+
+		const Entity::ComponentIdentifier componentIdentifier = component.GetIdentifier();
+
+		const Optional<Entity::Data::Flags*> pFlagsComponent =
+			sceneRegistry.GetCachedSceneData<Entity::Data::Flags>().GetComponentImplementation(componentIdentifier);
+		if (UNLIKELY_ERROR(pFlagsComponent.IsInvalid()))
+		{
+			return CullingVolumes::Visibility::Hidden;
+		}
+
+		const EnumFlags<Entity::ComponentFlags> renderItemFlags = *pFlagsComponent;
+		if (renderItemFlags.AreAnySet(Entity::ComponentFlags::IsDestroying | Entity::ComponentFlags::IsDisabledFromAnySource))
+		{
+			return CullingVolumes::Visibility::Hidden;
+		}
+		else if (nodeClassification.IsInsideViewFrustum())
+		{
+			return CullingVolumes::Visibility::Visible;
+		}
+
+		const Math::WorldTransform& __restrict renderItemWorldTransform =
+			sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>().GetComponentImplementationUnchecked(componentIdentifier);
+		const Math::BoundingBox& __restrict renderItemBoundingBox =
+			sceneRegistry.GetCachedSceneData<Entity::Data::BoundingBox>().GetComponentImplementationUnchecked(componentIdentifier);
+		const CullingVolumes::Visibility visibility =
+			m_cullingVolumes.GetVisibility(Math::Transform(renderItemWorldTransform, renderItemBoundingBox), nodeClassification);
+		// Only static meshes are drawn into shadow maps
+		if (visibility == CullingVolumes::Visibility::ShadowCaster && !component.IsStaticMesh(sceneRegistry))
+		{
+			return CullingVolumes::Visibility::Hidden;
+		}
+		return visibility;
+	}
+
+	SceneView::TraversalResult SceneView::ProcessVisibleComponentFromOctreeTraversal(
+		Entity::HierarchyComponentBase& component, const CullingVolumes::Visibility visibility
+	)
+	{
+		Assert(visibility != CullingVolumes::Visibility::Hidden);
+		Scene& scene = *GetSceneChecked();
+		Entity::SceneRegistry& sceneRegistry = scene.GetEntitySceneRegistry();
+		const Entity::ComponentIdentifier componentIdentifier = component.GetIdentifier();
+		const TraversalResult traversalResult = SceneViewBase::ProcessComponent(
+			sceneRegistry,
+			componentIdentifier,
+			component,
+			true,
+			visibility == CullingVolumes::Visibility::ShadowCaster
+		);
+		if (m_screenSizeDependentStages.AreAnySet())
+		{
+			const Math::WorldTransform& __restrict renderItemWorldTransform =
+				sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>().GetComponentImplementationUnchecked(componentIdentifier);
+			const Math::BoundingBox& __restrict renderItemBoundingBox =
+				sceneRegistry.GetCachedSceneData<Entity::Data::BoundingBox>().GetComponentImplementationUnchecked(componentIdentifier);
+			const Entity::RenderItemIdentifier renderItemIdentifier =
+				sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>().GetComponentImplementationUnchecked(componentIdentifier);
+			UpdateRenderItemScreenSizeClass(
+				renderItemIdentifier,
+				Math::Transform(renderItemWorldTransform, renderItemBoundingBox),
+				traversalResult
+			);
+		}
+		return traversalResult;
+	}
+
+	void SceneView::UpdateRenderItemScreenSizeClass(
+		const Entity::RenderItemIdentifier renderItemIdentifier,
+		const Math::WorldBoundingBox worldBoundingBox,
+		const TraversalResult traversalResult
+	)
+	{
+		if ((traversalResult != TraversalResult::BecameVisible) & (traversalResult != TraversalResult::RemainedVisible))
+		{
+			return;
+		}
+
+		const float radius = (worldBoundingBox.GetMaximum() - worldBoundingBox.GetMinimum()).GetLength() * 0.5f;
+		const float distance = (worldBoundingBox.GetCenter() - m_screenSizeViewLocation).GetLength();
+		const float projectedRadius = distance > radius ? radius * m_screenSizeProjectionScale / distance : 1.f;
+
+		uint8& storedScreenSizeClass = m_renderItemScreenSizeClasses[renderItemIdentifier];
+		// Items that stayed visible keep their class until they clearly leave it, newly visible ones start from their exact class
+		const uint8 screenSizeClass = traversalResult == TraversalResult::RemainedVisible
+		                                ? GetScreenSizeClass(projectedRadius, storedScreenSizeClass)
+		                                : GetScreenSizeClass(projectedRadius);
+		if (screenSizeClass != storedScreenSizeClass)
+		{
+			storedScreenSizeClass = screenSizeClass;
+
+			// Newly visible items are grouped by their stages with the new class, existing ones have to be regrouped
+			if (traversalResult == TraversalResult::RemainedVisible)
+			{
+				ProcessResetRenderItemStageMask(renderItemIdentifier, m_screenSizeDependentStages);
+			}
+		}
 	}
 
 	void SceneView::NotifyOctreeTraversalRenderStages(
@@ -355,7 +507,8 @@ namespace ngine::Rendering
 			if (!scene.GetEntitySceneRegistry().GetDynamicRenderUpdatesFinishedStage().IsDirectlyFollowedBy(*pLatestageVisibilityCheckPass))
 			{
 				scene.GetEntitySceneRegistry().GetDynamicRenderUpdatesFinishedStage().AddSubsequentStage(*pLatestageVisibilityCheckPass);
-				scene.GetEntitySceneRegistry().GetDynamicRenderUpdatesFinishedStage().AddSubsequentStage(*pOctreeTraversalPass);
+				scene.GetRootComponent().GetOctreeUpdateJob().AddSubsequentStage(m_pOctreeTraversalStage->GetCullingJob());
+				m_pOctreeTraversalStage->GetCullingFinishedStage().AddSubsequentStage(*pOctreeTraversalPass);
 				scene.GetEntitySceneRegistry().GetDynamicLateUpdatesFinishedStage().AddSubsequentStage(*pLatestageVisibilityCheckPass);
 
 				pOctreeTraversalPass->AddSubsequentCpuStage(scene.GetRootComponent().GetOctreeCleanupJob());
@@ -363,6 +516,11 @@ namespace ngine::Rendering
 				pLatestageVisibilityCheckPass->AddSubsequentCpuStage(scene.GetRootComponent().GetOctreeCleanupJob());
 				pLatestageVisibilityCheckPass->AddSubsequentCpuStage(scene.GetEndFrameStage());
 				pLatestageVisibilityCheckPass->AddSubsequentCpuStage(scene.GetDestroyComponentsStage());
+
+				for (const PostTraversalJobs& postTraversalJobs : m_postTraversalJobs)
+				{
+					LinkPostTraversalJobs(postTraversalJobs);
+				}
 			}
 		}
 
@@ -389,8 +547,12 @@ namespace ngine::Rendering
 				scene.GetEntitySceneRegistry()
 					.GetDynamicRenderUpdatesFinishedStage()
 					.RemoveSubsequentStage(*pLatestageVisibilityCheckPass, Invalid, Threading::StageBase::RemovalFlags{});
-				scene.GetEntitySceneRegistry()
-					.GetDynamicRenderUpdatesFinishedStage()
+				scene.GetRootComponent().GetOctreeUpdateJob().RemoveSubsequentStage(
+					m_pOctreeTraversalStage->GetCullingJob(),
+					Invalid,
+					Threading::StageBase::RemovalFlags{}
+				);
+				m_pOctreeTraversalStage->GetCullingFinishedStage()
 					.RemoveSubsequentStage(*pOctreeTraversalPass, Invalid, Threading::StageBase::RemovalFlags{});
 				scene.GetEntitySceneRegistry()
 					.GetDynamicLateUpdatesFinishedStage()
@@ -404,6 +566,11 @@ namespace ngine::Rendering
 				pLatestageVisibilityCheckPass->RemoveSubsequentCpuStage(scene.GetEndFrameStage(), Invalid, Threading::StageBase::RemovalFlags{});
 				pLatestageVisibilityCheckPass
 					->RemoveSubsequentCpuStage(scene.GetDestroyComponentsStage(), Invalid, Threading::StageBase::RemovalFlags{});
+
+				for (const PostTraversalJobs& postTraversalJobs : m_postTraversalJobs)
+				{
+					UnlinkPostTraversalJobs(postTraversalJobs);
+				}
 			}
 
 			if (pCamera.IsValid())
@@ -411,9 +578,9 @@ namespace ngine::Rendering
 				Optional<Entity::ComponentTypeSceneDataInterface*> pCameraSceneData = pCamera->GetTypeSceneData();
 				if (Optional<Threading::StageBase*> pCameraUpdateStage = pCameraSceneData->GetUpdateStage())
 				{
-					if (pCameraUpdateStage->IsDirectlyFollowedBy(*pOctreeTraversalPass))
+					if (pCameraUpdateStage->IsDirectlyFollowedBy(m_pOctreeTraversalStage->GetCullingJob()))
 					{
-						pCameraUpdateStage->RemoveSubsequentStage(*pOctreeTraversalPass, Invalid, Threading::StageBase::RemovalFlags{});
+						pCameraUpdateStage->RemoveSubsequentStage(m_pOctreeTraversalStage->GetCullingJob(), Invalid, Threading::StageBase::RemovalFlags{});
 					}
 				}
 			}
@@ -484,10 +651,10 @@ namespace ngine::Rendering
 					{
 						if (Optional<Threading::StageBase*> pCameraUpdateStage = pPreviousCameraSceneData->GetUpdateStage())
 						{
-							if (pCameraUpdateStage->IsDirectlyFollowedBy(*pOctreeTraversalPass))
+							if (pCameraUpdateStage->IsDirectlyFollowedBy(m_pOctreeTraversalStage->GetCullingJob()))
 							{
 								Threading::JobRunnerThread& thread = *Threading::JobRunnerThread::GetCurrent();
-								pCameraUpdateStage->RemoveSubsequentStage(*pOctreeTraversalPass, thread, Threading::StageBase::RemovalFlags{});
+								pCameraUpdateStage->RemoveSubsequentStage(m_pOctreeTraversalStage->GetCullingJob(), thread, Threading::StageBase::RemovalFlags{});
 							}
 						}
 					}
@@ -503,7 +670,7 @@ namespace ngine::Rendering
 								{
 									if (pCameraUpdateStage->HasDependencies())
 									{
-										pCameraUpdateStage->AddSubsequentStage(*pOctreeTraversalPass);
+										pCameraUpdateStage->AddSubsequentStage(m_pOctreeTraversalStage->GetCullingJob());
 									}
 								}
 							}
@@ -556,6 +723,93 @@ namespace ngine::Rendering
 		return *m_pLateStageVisibilityCheckStage;
 	}
 
+	void SceneView::RegisterPostTraversalJobs(Threading::StageBase& startJob, Threading::StageBase& finishedStage, Stage& dependentStage)
+	{
+		Assert(IsDisabled());
+		m_postTraversalJobs.EmplaceBack(PostTraversalJobs{startJob, finishedStage, dependentStage});
+	}
+
+	void SceneView::DeregisterPostTraversalJobs(Threading::StageBase& startJob, Stage& dependentStage)
+	{
+		const OptionalIterator<PostTraversalJobs> pPostTraversalJobs = m_postTraversalJobs.FindIf(
+			[&startJob, &dependentStage](const PostTraversalJobs& postTraversalJobs)
+			{
+				return (&*postTraversalJobs.m_startJob == &startJob) & (&*postTraversalJobs.m_dependentStage == &dependentStage);
+			}
+		);
+		Assert(pPostTraversalJobs.IsValid());
+		if (LIKELY(pPostTraversalJobs.IsValid()))
+		{
+			// Views can be torn down while enabled, in which case the jobs are still linked
+			const bool wasLinked = UnlinkPostTraversalJobs(*pPostTraversalJobs);
+			m_postTraversalJobs.Remove(pPostTraversalJobs);
+
+			// Restore the links of other dependent stages sharing the same jobs
+			if (wasLinked)
+			{
+				for (const PostTraversalJobs& postTraversalJobs : m_postTraversalJobs)
+				{
+					LinkPostTraversalJobs(postTraversalJobs);
+				}
+			}
+		}
+	}
+
+	void SceneView::LinkPostTraversalJobs(const PostTraversalJobs& postTraversalJobs)
+	{
+		Framegraph& framegraph = m_drawer.GetFramegraph();
+		const Optional<Rendering::Stage*> pOctreeTraversalPass = framegraph.GetStagePass(*m_pOctreeTraversalStage);
+		const Optional<Rendering::Stage*> pLateStageVisibilityCheckPass = framegraph.GetStagePass(*m_pLateStageVisibilityCheckStage);
+		const Optional<Rendering::Stage*> pDependentPass = framegraph.GetStagePass(*postTraversalJobs.m_dependentStage);
+		if (LIKELY(pOctreeTraversalPass.IsValid() && pLateStageVisibilityCheckPass.IsValid() && pDependentPass.IsValid()))
+		{
+			// Jobs shared by several dependent stages are only linked once
+			if (!pOctreeTraversalPass->IsDirectlyFollowedBy(*postTraversalJobs.m_startJob))
+			{
+				pOctreeTraversalPass->AddSubsequentCpuStage(*postTraversalJobs.m_startJob);
+			}
+			// Late stage changes notify the render stages too, the jobs must not run concurrently with them
+			if (!pLateStageVisibilityCheckPass->IsDirectlyFollowedBy(*postTraversalJobs.m_startJob))
+			{
+				pLateStageVisibilityCheckPass->AddSubsequentCpuStage(*postTraversalJobs.m_startJob);
+			}
+			if (!postTraversalJobs.m_finishedStage->IsDirectlyFollowedBy(*pDependentPass))
+			{
+				postTraversalJobs.m_finishedStage->AddSubsequentStage(*pDependentPass);
+			}
+		}
+	}
+
+	bool SceneView::UnlinkPostTraversalJobs(const PostTraversalJobs& postTraversalJobs)
+	{
+		Framegraph& framegraph = m_drawer.GetFramegraph();
+		const Optional<Rendering::Stage*> pOctreeTraversalPass = framegraph.GetStagePass(*m_pOctreeTraversalStage);
+		const Optional<Rendering::Stage*> pLateStageVisibilityCheckPass = framegraph.GetStagePass(*m_pLateStageVisibilityCheckStage);
+		const Optional<Rendering::Stage*> pDependentPass = framegraph.GetStagePass(*postTraversalJobs.m_dependentStage);
+		if (pOctreeTraversalPass.IsInvalid() || pLateStageVisibilityCheckPass.IsInvalid() || pDependentPass.IsInvalid())
+		{
+			return false;
+		}
+
+		bool wasLinked = false;
+		if (postTraversalJobs.m_finishedStage->IsDirectlyFollowedBy(*pDependentPass))
+		{
+			postTraversalJobs.m_finishedStage->RemoveSubsequentStage(*pDependentPass, Invalid, Threading::StageBase::RemovalFlags{});
+			wasLinked = true;
+		}
+		if (pOctreeTraversalPass->IsDirectlyFollowedBy(*postTraversalJobs.m_startJob))
+		{
+			pOctreeTraversalPass->RemoveSubsequentCpuStage(*postTraversalJobs.m_startJob, Invalid, Threading::StageBase::RemovalFlags{});
+			wasLinked = true;
+		}
+		if (pLateStageVisibilityCheckPass->IsDirectlyFollowedBy(*postTraversalJobs.m_startJob))
+		{
+			pLateStageVisibilityCheckPass->RemoveSubsequentCpuStage(*postTraversalJobs.m_startJob, Invalid, Threading::StageBase::RemovalFlags{});
+			wasLinked = true;
+		}
+		return wasLinked;
+	}
+
 	void SceneView::OnActiveCameraPropertiesChanged()
 	{
 		Entity::CameraComponent* pCameraComponent = GetActiveCameraComponentSafe();
@@ -638,10 +892,10 @@ namespace ngine::Rendering
 				Framegraph& framegraph = m_drawer.GetFramegraph();
 				if (const Optional<Stage*> pOctreeTraversalPass = framegraph.GetStagePass(*m_pOctreeTraversalStage))
 				{
-					if (pCameraUpdateStage->IsDirectlyFollowedBy(*pOctreeTraversalPass))
+					if (pCameraUpdateStage->IsDirectlyFollowedBy(m_pOctreeTraversalStage->GetCullingJob()))
 					{
 						Threading::JobRunnerThread& thread = *Threading::JobRunnerThread::GetCurrent();
-						pCameraUpdateStage->RemoveSubsequentStage(*pOctreeTraversalPass, thread, Threading::StageBase::RemovalFlags{});
+						pCameraUpdateStage->RemoveSubsequentStage(m_pOctreeTraversalStage->GetCullingJob(), thread, Threading::StageBase::RemovalFlags{});
 					}
 				}
 			}
@@ -199,6 +199,8 @@ namespace ngine::Rendering
 		m_newlyDisabledRenderItemStagesMask.ClearAll();
 		m_newlyEnabledRenderItemStagesMask.ClearAll();
 		m_cameraPropertyDependentStages.ClearAll();
+		m_screenSizeDependentStages.ClearAll();
+		m_shadowCasterStages.ClearAll();
 
 		m_renderItemComponents.GetView().ZeroInitialize();
 		m_renderItemComponentIdentifiers.GetView().ZeroInitialize();
@@ -209,6 +211,7 @@ namespace ngine::Rendering
 		m_visibleRenderItemsBeforeTraversal.ClearAll();
 		m_visibleRenderItemsDuringTraversal.ClearAll();
 		m_visibleRenderItems.ClearAll();
+		m_shadowCasterOnlyRenderItems.ClearAll();
 
 		m_logicalDevice.GetRenderer().GetStageCache().IterateElements(
 			m_sceneRenderStages.GetView(),
@@ -294,6 +297,7 @@ namespace ngine::Rendering
 		}
 
 		m_visibleRenderItems.Clear(renderItems);
+		m_shadowCasterOnlyRenderItems.Clear(renderItems);
 		m_visibleRenderItemsDuringTraversal.Clear(renderItems);
 
 		for (const uint32 renderItemIndex : renderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
@@ -331,6 +335,7 @@ namespace ngine::Rendering
 		}
 
 		m_visibleRenderItems.Clear(renderItems);
+		m_shadowCasterOnlyRenderItems.Clear(renderItems);
 		m_visibleRenderItemsDuringTraversal.Clear(renderItems);
 		m_changedTransformRenderItems.Clear(renderItems);
 		m_newlyVisibleRenderItems.Clear(renderItems);
@@ -368,7 +373,8 @@ namespace ngine::Rendering
 		}
 
 		RenderItemStageMask& queuedStageMask = m_queuedRenderItemStageMasks[renderItemIdentifier];
-		const RenderItemStageMask changedStagesMask = (queuedStageMask ^ enabledStages) & enabledStages;
+		const RenderItemStageMask allowedStages = GetAllowedRenderItemStages(renderItemIdentifier, enabledStages);
+		const RenderItemStageMask changedStagesMask = (queuedStageMask ^ allowedStages) & allowedStages;
 		m_newlyVisibleRenderStageItemsMask |= changedStagesMask;
 		queuedStageMask |= changedStagesMask;
 
@@ -418,7 +424,8 @@ namespace ngine::Rendering
 
 		RenderItemStageMask& queuedStageMask = m_queuedRenderItemStageMasks[renderItemIdentifier];
 		{
-			const RenderItemStageMask changedStagesMask = (queuedStageMask ^ enabledStages) & enabledStages;
+			const RenderItemStageMask allowedStages = GetAllowedRenderItemStages(renderItemIdentifier, enabledStages);
+			const RenderItemStageMask changedStagesMask = (queuedStageMask ^ allowedStages) & allowedStages;
 			m_newlyVisibleRenderStageItemsMask |= changedStagesMask;
 			queuedStageMask |= changedStagesMask;
 			for (const typename RenderItemStageMask::BitIndexType stageIndex : changedStagesMask.GetSetBitsIterator())
@@ -453,6 +460,11 @@ namespace ngine::Rendering
 			return;
 		}
 
+		if (m_shadowCasterOnlyRenderItems.IsSet(renderItemIdentifier) && !m_shadowCasterStages.IsSet(stageIdentifier))
+		{
+			return;
+		}
+
 		RenderItemStageMask& queuedStageMask = m_queuedRenderItemStageMasks[renderItemIdentifier];
 		if (!queuedStageMask.IsSet(stageIdentifier))
 		{
@@ -532,7 +544,8 @@ namespace ngine::Rendering
 		Entity::SceneRegistry& sceneRegistry,
 		const Entity::ComponentIdentifier componentIdentifier,
 		Entity::HierarchyComponentBase& component,
-		const bool isVisible
+		const bool isVisible,
+		const bool isOnlyCastingShadows
 	)
 	{
 		const AtomicRenderItemStageMask& __restrict renderItemStageMask =
@@ -540,13 +553,24 @@ namespace ngine::Rendering
 		const Entity::RenderItemIdentifier renderItemIdentifier =
 			sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>().GetComponentImplementationUnchecked(componentIdentifier);
 
-		const RenderItemStageMask stageMask = reinterpret_cast<const RenderItemStageMask&>(renderItemStageMask);
+		// Items outside the view that only cast shadows into it are limited to the stages drawing shadow casters
+		const RenderItemStageMask stageMask = isOnlyCastingShadows
+		                                        ? reinterpret_cast<const RenderItemStageMask&>(renderItemStageMask) & m_shadowCasterStages
+		                                        : reinterpret_cast<const RenderItemStageMask&>(renderItemStageMask);
 		const bool wasVisible = m_visibleRenderItems.IsSet(renderItemIdentifier);
 		if (wasVisible == isVisible)
 		{
 			if (isVisible)
 			{
 				m_visibleRenderItemsDuringTraversal.Set(renderItemIdentifier);
+				if (isOnlyCastingShadows)
+				{
+					m_shadowCasterOnlyRenderItems.Set(renderItemIdentifier);
+				}
+				else
+				{
+					m_shadowCasterOnlyRenderItems.Clear(renderItemIdentifier);
+				}
 
 				RenderItemStageMask& queuedStageMask = m_queuedRenderItemStageMasks[renderItemIdentifier];
 				const RenderItemStageMask changedMask = stageMask ^ queuedStageMask;
@@ -607,6 +631,10 @@ namespace ngine::Rendering
 
 			m_visibleRenderItems.Set(renderItemIdentifier);
 			m_visibleRenderItemsDuringTraversal.Set(renderItemIdentifier);
+			if (isOnlyCastingShadows)
+			{
+				m_shadowCasterOnlyRenderItems.Set(renderItemIdentifier);
+			}
 
 			m_queuedRenderItemStageMasks[renderItemIdentifier] = stageMask;
 			m_renderItemComponents[renderItemIdentifier] = &component;
@@ -631,6 +659,7 @@ namespace ngine::Rendering
 
 			m_visibleRenderItems.Clear(renderItemIdentifier);
 			m_visibleRenderItemsDuringTraversal.Clear(renderItemIdentifier);
+			m_shadowCasterOnlyRenderItems.Clear(renderItemIdentifier);
 			m_renderItemComponents[renderItemIdentifier] = Invalid;
 
 			m_newlyVisibleRenderItems.Clear(renderItemIdentifier);
@@ -850,6 +879,7 @@ namespace ngine::Rendering
 
 			Assert(m_visibleRenderItems.IsSet(renderItemIdentifier));
 			m_visibleRenderItems.Clear(renderItemIdentifier);
+			m_shadowCasterOnlyRenderItems.Clear(renderItemIdentifier);
 			m_renderItemComponents[renderItemIdentifier] = Invalid;
 
 			m_newlyVisibleRenderItems.Clear(renderItemIdentifier);
@@ -0,0 +1,45 @@
+#include "Scene/ShadowCasters.h"
+
+#include <Common/Algorithms/Sort.h>
+#include <Common/Storage/IdentifierMask.h>
+
+namespace ngine::Rendering::ShadowCasters
+{
+	void Sort(const ArrayView<ShadowCaster, uint32> shadowCasters)
+	{
+		Algorithms::Sort(
+			shadowCasters.begin(),
+			shadowCasters.end(),
+			[](const ShadowCaster& left, const ShadowCaster& right)
+			{
+				if (left.m_instanceGroupIdentifierIndex != right.m_instanceGroupIdentifierIndex)
+				{
+					return left.m_instanceGroupIdentifierIndex < right.m_instanceGroupIdentifierIndex;
+				}
+				return left.m_instanceIndex < right.m_instanceIndex;
+			}
+		);
+	}
+
+	bool IsCacheValid(
+		const ArrayView<const ShadowCaster, uint32> cachedShadowCasters,
+		const ArrayView<const ShadowCaster, uint32> shadowCasters,
+		const Entity::RenderItemMask& removedRenderItems
+	)
+	{
+		if (cachedShadowCasters.GetSize() != shadowCasters.GetSize())
+		{
+			return false;
+		}
+
+		for (uint32 index = 0, count = shadowCasters.GetSize(); index < count; ++index)
+		{
+			const ShadowCaster& cachedShadowCaster = cachedShadowCasters[index];
+			if ((cachedShadowCaster != shadowCasters[index]) | removedRenderItems.IsSet(cachedShadowCaster.m_renderItemIdentifier))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
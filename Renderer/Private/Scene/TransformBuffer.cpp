@@ -269,16 +269,20 @@ namespace ngine::Rendering
 		}
 	}
 
-	void TransformBuffer::OnRenderItemsBecomeVisible(
+	//! Unchanged items in gaps up to this size are uploaded along with their neighbours instead of starting a new copy region
+	inline static constexpr TransformBuffer::RenderItemIndexType MaximumCoalescedGapSize = 4;
+
+	void TransformBuffer::UploadTransforms(
 		Entity::SceneRegistry& sceneRegistry,
 		LogicalDevice& logicalDevice,
-		Entity::RenderItemMask& renderItems,
+		const Entity::RenderItemMask& renderItems,
 		const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount,
 		const FixedIdentifierArrayView<Entity::ComponentIdentifier::IndexType, Entity::RenderItemIdentifier> renderItemComponentIdentifiers,
 		const CommandQueueView graphicsCommandQueue,
 		const CommandEncoderView graphicsCommandEncoder,
-		PerFrameStagingBuffer& perFrameStagingBuffer
-
+		PerFrameStagingBuffer& perFrameStagingBuffer,
+		const ArrayView<const BufferView, uint8> rotationBuffers,
+		const ArrayView<const BufferView, uint8> locationBuffers
 	)
 	{
 		RenderItemIndexType minimumInstanceIndex = Math::NumericLimits<RenderItemIndexType>::Max;
@@ -288,53 +292,40 @@ namespace ngine::Rendering
 			minimumInstanceIndex = Math::Min(renderItemIndex, minimumInstanceIndex);
 			maximumInstanceIndex = Math::Max(renderItemIndex, maximumInstanceIndex);
 		}
+		if (minimumInstanceIndex > maximumInstanceIndex)
+		{
+			return;
+		}
 
 		RenderItemIndexType totalAffectedItemCount = maximumInstanceIndex - minimumInstanceIndex + 1;
 
-		const size copiedRotationDataOffset = minimumInstanceIndex * sizeof(StoredRotationType);
-		const size copiedLocationDataOffset = minimumInstanceIndex * sizeof(StoredCoordinateType);
-		const size copiedRotationDataSize = totalAffectedItemCount * sizeof(StoredRotationType);
-		const size copiedLocationDataSize = totalAffectedItemCount * sizeof(StoredCoordinateType);
-
-		const BufferView rotationBuffer = GetRotationMatrixBuffer();
-		const BufferView locationBuffer = GetLocationBuffer();
-		const BufferView previousRotationBuffer = GetPreviousRotationMatrixBuffer();
-		const BufferView previousLocationBuffer = GetPreviousLocationBuffer();
-
 		{
-			Array<Rendering::BufferMemoryBarrier, 4> barriers{
-				Rendering::BufferMemoryBarrier{
+			const size rotationDataOffset = minimumInstanceIndex * sizeof(StoredRotationType);
+			const size locationDataOffset = minimumInstanceIndex * sizeof(StoredCoordinateType);
+			const size rotationDataSize = totalAffectedItemCount * sizeof(StoredRotationType);
+			const size locationDataSize = totalAffectedItemCount * sizeof(StoredCoordinateType);
+
+			FlatVector<Rendering::BufferMemoryBarrier, 4> barriers;
+			for (const BufferView rotationBuffer : rotationBuffers)
+			{
+				barriers.EmplaceBack(Rendering::BufferMemoryBarrier{
 					AccessFlags::VertexRead | AccessFlags::TransferWrite,
 					AccessFlags::TransferWrite,
 					rotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-
-				Rendering::BufferMemoryBarrier{
+					rotationDataOffset,
+					rotationDataSize
+				});
+			}
+			for (const BufferView locationBuffer : locationBuffers)
+			{
+				barriers.EmplaceBack(Rendering::BufferMemoryBarrier{
 					AccessFlags::VertexRead | AccessFlags::TransferWrite,
 					AccessFlags::TransferWrite,
 					locationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				},
-
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::VertexRead | AccessFlags::TransferWrite,
-					AccessFlags::TransferWrite,
-					previousRotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::VertexRead | AccessFlags::TransferWrite,
-					AccessFlags::TransferWrite,
-					previousLocationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				}
-			};
+					locationDataOffset,
+					locationDataSize
+				});
+			}
 
 			graphicsCommandEncoder.RecordPipelineBarrier(
 				PipelineStageFlags::VertexInput | PipelineStageFlags::Transfer,
@@ -344,114 +335,118 @@ namespace ngine::Rendering
 			);
 		}
 
-		PerFrameStagingBuffer::BatchCopyContext copyRotationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredRotationType) * totalAffectedItemCount,
-			rotationBuffer,
-			copiedRotationDataOffset
-		);
-		PerFrameStagingBuffer::BatchCopyContext copyPreviousRotationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredRotationType) * totalAffectedItemCount,
-			previousRotationBuffer,
-			copiedRotationDataOffset
-		);
-		PerFrameStagingBuffer::BatchCopyContext copyLocationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredCoordinateType) * totalAffectedItemCount,
-			locationBuffer,
-			copiedLocationDataOffset
-		);
-		PerFrameStagingBuffer::BatchCopyContext copyPreviousLocationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredCoordinateType) * totalAffectedItemCount,
-			previousLocationBuffer,
-			copiedLocationDataOffset
-		);
-
 		Entity::ComponentTypeSceneData<Entity::Data::WorldTransform>& __restrict worldTransformSceneData =
 			*sceneRegistry.FindComponentTypeData<Entity::Data::WorldTransform>();
 
-		for (uint32 renderItemIndex = minimumInstanceIndex, renderItemIndexEnd = maximumInstanceIndex + 1;
-		     renderItemIndex != renderItemIndexEnd;
-		     ++renderItemIndex)
+		// Only upload runs of changed items, so that sparse changes don't transfer everything in between them
+		const auto uploadRun = [&](const RenderItemIndexType firstInstanceIndex, const RenderItemIndexType instanceCount)
 		{
-			const Entity::RenderItemIdentifier renderItemIdentifier = Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex);
-			const Entity::ComponentIdentifier componentIdentifier = Entity::ComponentIdentifier::MakeFromIndex(
-				Math::Max(renderItemComponentIdentifiers[renderItemIdentifier], (Entity::ComponentIdentifier::IndexType)1u)
-			);
+			FlatVector<PerFrameStagingBuffer::BatchCopyContext, 2> rotationContexts;
+			for (const BufferView rotationBuffer : rotationBuffers)
+			{
+				rotationContexts.EmplaceBack(perFrameStagingBuffer.BeginBatchCopyToBuffer(
+					sizeof(StoredRotationType) * instanceCount,
+					rotationBuffer,
+					firstInstanceIndex * sizeof(StoredRotationType)
+				));
+			}
+			FlatVector<PerFrameStagingBuffer::BatchCopyContext, 2> locationContexts;
+			for (const BufferView locationBuffer : locationBuffers)
+			{
+				locationContexts.EmplaceBack(perFrameStagingBuffer.BeginBatchCopyToBuffer(
+					sizeof(StoredCoordinateType) * instanceCount,
+					locationBuffer,
+					firstInstanceIndex * sizeof(StoredCoordinateType)
+				));
+			}
 
-			const uint32 index = renderItemIndex - minimumInstanceIndex;
+			for (uint32 index = 0; index < instanceCount; ++index)
+			{
+				const Entity::RenderItemIdentifier renderItemIdentifier =
+					Entity::RenderItemIdentifier::MakeFromValidIndex(RenderItemIndexType(firstInstanceIndex + index));
+				const Entity::ComponentIdentifier componentIdentifier = Entity::ComponentIdentifier::MakeFromIndex(
+					Math::Max(renderItemComponentIdentifiers[renderItemIdentifier], (Entity::ComponentIdentifier::IndexType)1u)
+				);
 
-			const Entity::Data::WorldTransform& __restrict worldTransformComponent =
-				worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
-			const Math::WorldTransform transform = worldTransformComponent;
+				const Entity::Data::WorldTransform& __restrict worldTransformComponent =
+					worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
+				const Math::WorldTransform transform = worldTransformComponent;
 
-			const StoredRotationType rotation = transform.GetRotationMatrix();
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyRotationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(rotation),
-				index * sizeof(StoredRotationType)
-			);
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyPreviousRotationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(rotation),
-				index * sizeof(StoredRotationType)
-			);
+				const StoredRotationType rotation = transform.GetRotationMatrix();
+				for (PerFrameStagingBuffer::BatchCopyContext& rotationContext : rotationContexts)
+				{
+					perFrameStagingBuffer.BatchCopyToBuffer(
+						logicalDevice,
+						rotationContext,
+						graphicsCommandQueue,
+						ConstByteView::Make(rotation),
+						index * sizeof(StoredRotationType)
+					);
+				}
 
-			const StoredCoordinateType location = transform.GetLocation();
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyLocationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(location),
-				index * sizeof(StoredCoordinateType)
-			);
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyPreviousLocationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(location),
-				index * sizeof(StoredCoordinateType)
-			);
-		}
+				const StoredCoordinateType location = transform.GetLocation();
+				for (PerFrameStagingBuffer::BatchCopyContext& locationContext : locationContexts)
+				{
+					perFrameStagingBuffer.BatchCopyToBuffer(
+						logicalDevice,
+						locationContext,
+						graphicsCommandQueue,
+						ConstByteView::Make(location),
+						index * sizeof(StoredCoordinateType)
+					);
+				}
+			}
 
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyRotationsContext, graphicsCommandEncoder);
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyPreviousRotationsContext, graphicsCommandEncoder);
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyLocationsContext, graphicsCommandEncoder);
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyPreviousLocationsContext, graphicsCommandEncoder);
+			for (PerFrameStagingBuffer::BatchCopyContext& rotationContext : rotationContexts)
+			{
+				perFrameStagingBuffer.EndBatchCopyToBuffer(rotationContext, graphicsCommandEncoder);
+			}
+			for (PerFrameStagingBuffer::BatchCopyContext& locationContext : locationContexts)
+			{
+				perFrameStagingBuffer.EndBatchCopyToBuffer(locationContext, graphicsCommandEncoder);
+			}
+		};
 
+		RenderItemIndexType runStartIndex = minimumInstanceIndex;
+		RenderItemIndexType runEndIndex = minimumInstanceIndex;
+		for (const RenderItemIndexType renderItemIndex : renderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
 		{
-			Array<Rendering::BufferMemoryBarrier, 4> barriers{
-				Rendering::BufferMemoryBarrier{
+			if (renderItemIndex > runEndIndex + MaximumCoalescedGapSize)
+			{
+				uploadRun(runStartIndex, runEndIndex - runStartIndex);
+				runStartIndex = renderItemIndex;
+			}
+			runEndIndex = renderItemIndex + 1;
+		}
+		uploadRun(runStartIndex, runEndIndex - runStartIndex);
+
+		{
+			const size rotationDataOffset = minimumInstanceIndex * sizeof(StoredRotationType);
+			const size locationDataOffset = minimumInstanceIndex * sizeof(StoredCoordinateType);
+			const size rotationDataSize = totalAffectedItemCount * sizeof(StoredRotationType);
+			const size locationDataSize = totalAffectedItemCount * sizeof(StoredCoordinateType);
+
+			FlatVector<Rendering::BufferMemoryBarrier, 4> barriers;
+			for (const BufferView rotationBuffer : rotationBuffers)
+			{
+				barriers.EmplaceBack(Rendering::BufferMemoryBarrier{
 					AccessFlags::TransferWrite,
 					AccessFlags::VertexRead,
 					rotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-				Rendering::BufferMemoryBarrier{
+					rotationDataOffset,
+					rotationDataSize
+				});
+			}
+			for (const BufferView locationBuffer : locationBuffers)
+			{
+				barriers.EmplaceBack(Rendering::BufferMemoryBarrier{
 					AccessFlags::TransferWrite,
 					AccessFlags::VertexRead,
 					locationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				},
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::TransferWrite,
-					AccessFlags::VertexRead,
-					previousRotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::TransferWrite,
-					AccessFlags::VertexRead,
-					previousLocationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				}
-			};
+					locationDataOffset,
+					locationDataSize
+				});
+			}
 
 			graphicsCommandEncoder.RecordPipelineBarrier(PipelineStageFlags::Transfer, PipelineStageFlags::VertexInput, {}, barriers.GetView());
 		}
@@ -465,7 +460,7 @@ namespace ngine::Rendering
 		m_modifiedInstanceRange = Math::Range<RenderItemIndexType>::Make(minimumInstanceIndex, totalAffectedItemCount);
 	}
 
-	void TransformBuffer::OnVisibleRenderItemTransformsChanged(
+	void TransformBuffer::OnRenderItemsBecomeVisible(
 		Entity::SceneRegistry& sceneRegistry,
 		LogicalDevice& logicalDevice,
 		Entity::RenderItemMask& renderItems,
@@ -477,130 +472,45 @@ namespace ngine::Rendering
 
 	)
 	{
-		RenderItemIndexType minimumInstanceIndex = Math::NumericLimits<RenderItemIndexType>::Max;
-		RenderItemIndexType maximumInstanceIndex = Math::NumericLimits<RenderItemIndexType>::Min;
-		for (const RenderItemIndexType renderItemIndex : renderItems.GetSetBitsIterator(0, maximumUsedRenderItemCount))
-		{
-			minimumInstanceIndex = Math::Min(renderItemIndex, minimumInstanceIndex);
-			maximumInstanceIndex = Math::Max(renderItemIndex, maximumInstanceIndex);
-		}
-
-		RenderItemIndexType totalAffectedItemCount = maximumInstanceIndex - minimumInstanceIndex + 1;
-
-		const size copiedRotationDataOffset = minimumInstanceIndex * sizeof(StoredRotationType);
-		const size copiedLocationDataOffset = minimumInstanceIndex * sizeof(StoredCoordinateType);
-		const size copiedRotationDataSize = totalAffectedItemCount * sizeof(StoredRotationType);
-		const size copiedLocationDataSize = totalAffectedItemCount * sizeof(StoredCoordinateType);
-
-		const BufferView rotationBuffer = GetRotationMatrixBuffer();
-		const BufferView locationBuffer = GetLocationBuffer();
-
-		{
-			Array<Rendering::BufferMemoryBarrier, 2> barriers{
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::VertexRead | AccessFlags::TransferWrite,
-					AccessFlags::TransferWrite,
-					rotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::VertexRead | AccessFlags::TransferWrite,
-					AccessFlags::TransferWrite,
-					locationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				}
-			};
-
-			graphicsCommandEncoder.RecordPipelineBarrier(
-				PipelineStageFlags::VertexInput | PipelineStageFlags::Transfer,
-				PipelineStageFlags::Transfer,
-				{},
-				barriers.GetView()
-			);
-		}
-
-		PerFrameStagingBuffer::BatchCopyContext copyRotationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredRotationType) * totalAffectedItemCount,
-			rotationBuffer,
-			copiedRotationDataOffset
-		);
-		PerFrameStagingBuffer::BatchCopyContext copyLocationsContext = perFrameStagingBuffer.BeginBatchCopyToBuffer(
-			sizeof(StoredCoordinateType) * totalAffectedItemCount,
-			locationBuffer,
-			copiedLocationDataOffset
+		// Newly visible items have no valid previous transform, so initialize it to the current one
+		UploadTransforms(
+			sceneRegistry,
+			logicalDevice,
+			renderItems,
+			maximumUsedRenderItemCount,
+			renderItemComponentIdentifiers,
+			graphicsCommandQueue,
+			graphicsCommandEncoder,
+			perFrameStagingBuffer,
+			Array<const BufferView, 2, uint8>{GetRotationMatrixBuffer(), GetPreviousRotationMatrixBuffer()},
+			Array<const BufferView, 2, uint8>{GetLocationBuffer(), GetPreviousLocationBuffer()}
 		);
+	}
 
-		Entity::ComponentTypeSceneData<Entity::Data::WorldTransform>& __restrict worldTransformSceneData =
-			*sceneRegistry.FindComponentTypeData<Entity::Data::WorldTransform>();
-
-		for (uint32 renderItemIndex = minimumInstanceIndex, renderItemIndexEnd = maximumInstanceIndex + 1;
-		     renderItemIndex != renderItemIndexEnd;
-		     ++renderItemIndex)
-		{
-			const Entity::RenderItemIdentifier renderItemIdentifier = Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex);
-			const Entity::ComponentIdentifier componentIdentifier = Entity::ComponentIdentifier::MakeFromIndex(
-				Math::Max(renderItemComponentIdentifiers[renderItemIdentifier], (Entity::ComponentIdentifier::IndexType)1u)
-			);
-
-			const uint32 index = renderItemIndex - minimumInstanceIndex;
-
-			const Entity::Data::WorldTransform& __restrict worldTransformComponent =
-				worldTransformSceneData.GetComponentImplementationUnchecked(componentIdentifier);
-			const Math::WorldTransform transform = worldTransformComponent;
-
-			const StoredRotationType rotation = transform.GetRotationMatrix();
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyRotationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(rotation),
-				index * sizeof(StoredRotationType)
-			);
-
-			const StoredCoordinateType location = transform.GetLocation();
-			perFrameStagingBuffer.BatchCopyToBuffer(
-				logicalDevice,
-				copyLocationsContext,
-				graphicsCommandQueue,
-				ConstByteView::Make(location),
-				index * sizeof(StoredCoordinateType)
-			);
-		}
-
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyRotationsContext, graphicsCommandEncoder);
-		perFrameStagingBuffer.EndBatchCopyToBuffer(copyLocationsContext, graphicsCommandEncoder);
-
-		{
-			Array<Rendering::BufferMemoryBarrier, 2> barriers{
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::TransferWrite,
-					AccessFlags::VertexRead,
-					rotationBuffer,
-					copiedRotationDataOffset,
-					copiedRotationDataSize
-				},
-				Rendering::BufferMemoryBarrier{
-					AccessFlags::TransferWrite,
-					AccessFlags::VertexRead,
-					locationBuffer,
-					copiedLocationDataOffset,
-					copiedLocationDataSize
-				},
-			};
-
-			graphicsCommandEncoder.RecordPipelineBarrier(PipelineStageFlags::Transfer, PipelineStageFlags::VertexInput, {}, barriers.GetView());
-		}
+	void TransformBuffer::OnVisibleRenderItemTransformsChanged(
+		Entity::SceneRegistry& sceneRegistry,
+		LogicalDevice& logicalDevice,
+		Entity::RenderItemMask& renderItems,
+		const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount,
+		const FixedIdentifierArrayView<Entity::ComponentIdentifier::IndexType, Entity::RenderItemIdentifier> renderItemComponentIdentifiers,
+		const CommandQueueView graphicsCommandQueue,
+		const CommandEncoderView graphicsCommandEncoder,
+		PerFrameStagingBuffer& perFrameStagingBuffer
 
-		if (m_modifiedInstanceRange.GetSize() > 0)
-		{
-			minimumInstanceIndex = Math::Min(m_modifiedInstanceRange.GetMinimum(), minimumInstanceIndex);
-			maximumInstanceIndex = Math::Max(m_modifiedInstanceRange.GetMaximum(), maximumInstanceIndex);
-			totalAffectedItemCount = maximumInstanceIndex - minimumInstanceIndex + 1;
-		}
-		m_modifiedInstanceRange = Math::Range<RenderItemIndexType>::Make(minimumInstanceIndex, totalAffectedItemCount);
+	)
+	{
+		UploadTransforms(
+			sceneRegistry,
+			logicalDevice,
+			renderItems,
+			maximumUsedRenderItemCount,
+			renderItemComponentIdentifiers,
+			graphicsCommandQueue,
+			graphicsCommandEncoder,
+			perFrameStagingBuffer,
+			Array<const BufferView, 1, uint8>{GetRotationMatrixBuffer()},
+			Array<const BufferView, 1, uint8>{GetLocationBuffer()}
+		);
 	}
 
 	InstanceBuffer::InstanceBuffer(
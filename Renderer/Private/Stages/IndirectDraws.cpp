@@ -0,0 +1,34 @@
+#include "Stages/IndirectDraws.h"
+
+namespace ngine::Rendering::IndirectDraws
+{
+	bool AppendArguments(
+		const ArrayView<DrawIndexedIndirectArguments, uint32> arguments,
+		uint32& argumentCount,
+		const ArrayView<const Math::Range<Index>, Index> indexRanges,
+		const Index indexCount,
+		const uint32 instanceCount
+	)
+	{
+		if (indexRanges.IsEmpty())
+		{
+			if (argumentCount == arguments.GetSize())
+			{
+				return false;
+			}
+			arguments[argumentCount++] = DrawIndexedIndirectArguments{indexCount, instanceCount, 0, 0, 0};
+			return true;
+		}
+
+		if (indexRanges.GetSize() > arguments.GetSize() - argumentCount)
+		{
+			return false;
+		}
+		for (const Math::Range<Index> indexRange : indexRanges)
+		{
+			arguments[argumentCount++] =
+				DrawIndexedIndirectArguments{(uint32)indexRange.GetSize(), instanceCount, (uint32)indexRange.GetMinimum(), 0, 0};
+		}
+		return true;
+	}
+}
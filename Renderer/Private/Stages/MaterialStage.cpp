@@ -7,15 +7,19 @@
 #include <Engine/Entity/Data/RenderItem/StaticMeshIdentifier.h>
 #include <Engine/Entity/Data/RenderItem/MaterialInstanceIdentifier.h>
 #include <Engine/Entity/Data/RenderItem/VisibilityListener.h>
+#include <Engine/Entity/Data/RenderItem/Identifier.h>
 #include <Engine/Entity/Data/Flags.h>
+#include <Engine/Entity/Data/WorldTransform.h>
 #include <Engine/Entity/Scene/SceneRegistry.h>
 #include <Engine/Entity/ComponentTypeSceneData.h>
 #include <Engine/Threading/JobRunnerThread.h>
 #include <Engine/Threading/JobManager.h>
 #include <Engine/Asset/AssetManager.h>
 #include <Engine/Scene/Scene.h>
+#include <Engine/Engine.h>
 
 #include <Renderer/Devices/LogicalDevice.h>
+#include <Renderer/Devices/PhysicalDevice.h>
 #include <Renderer/Commands/RenderCommandEncoder.h>
 #include <Renderer/Commands/BlitCommandEncoder.h>
 #include <Renderer/Scene/SceneView.h>
@@ -37,6 +41,7 @@
 #include <Renderer/Wrappers/AttachmentReference.h>
 #include <Renderer/Wrappers/SubpassDependency.h>
 #include <Renderer/Wrappers/BufferMemoryBarrier.h>
+#include <Renderer/Stages/IndirectDraws.h>
 
 #if STAGE_DEPENDENCY_PROFILING
 #include <Common/Memory/Containers/Format/String.h>
@@ -45,9 +50,12 @@
 #endif
 
 #include <Common/Math/Vector4.h>
+#include <Common/Math/Abs.h>
+#include <Common/Math/Max.h>
 #include <Common/Math/Mod.h>
 #include <Common/Threading/Jobs/JobRunnerThread.inl>
 #include <Common/Memory/AddressOf.h>
+#include <Common/Algorithms/Sort.h>
 
 namespace ngine::Rendering
 {
@@ -62,6 +70,37 @@ namespace ngine::Rendering
 		, m_renderAreaFactor(renderAreaFactor)
 	{
 		Assert(materialIdentifier.IsValid());
+
+#if RENDERER_VULKAN
+		// Meshlet culling produces several draws per group, which requires reading more than one draw per indirect call
+		// Other backends would record as many commands for indirect draws as for direct ones
+		if (m_logicalDevice.GetPhysicalDevice().GetSupportedFeatures().IsSet(PhysicalDeviceFeatures::MultiDrawIndirect))
+		{
+			const size bufferSize = sizeof(DrawIndexedIndirectArguments) * MaximumIndirectDrawCount * MaximumConcurrentFrameCount;
+			m_indirectDrawBuffer =
+				IndirectBuffer(m_logicalDevice, m_logicalDevice.GetPhysicalDevice(), m_logicalDevice.GetDeviceMemoryPool(), bufferSize);
+			if (LIKELY(m_indirectDrawBuffer.IsValid()))
+			{
+				m_indirectDrawBuffer.MapToHostMemory(
+					m_logicalDevice,
+					Math::Range<size>::Make(0, bufferSize),
+					Buffer::MapMemoryFlags::Write | Buffer::MapMemoryFlags::KeepMapped,
+					[this](const Buffer::MapMemoryStatus status, const ByteView data, [[maybe_unused]] const bool executedAsynchronously)
+					{
+						Assert(!executedAsynchronously);
+						if (LIKELY(status == Buffer::MapMemoryStatus::Success))
+						{
+							m_indirectDrawBufferData = data;
+						}
+					}
+				);
+			}
+		}
+#endif
+
+		MaterialsStage& materialsStage = m_sceneView.GetMaterialsStage();
+		m_sceneView.RegisterPostTraversalJobs(materialsStage.GetIndirectDrawsStartJob(), materialsStage.GetIndirectDrawsFinishedStage(), *this);
+
 		MaterialCache& materialCache = sceneView.GetLogicalDevice().GetRenderer().GetMaterialCache();
 		Threading::JobBatch jobBatch = materialCache.TryLoad(
 			materialIdentifier,
@@ -81,6 +120,7 @@ namespace ngine::Rendering
 							stageCache.FindOrRegisterAsset(pMaterialAsset->GetGuid(), pMaterialAsset->GetName(), Rendering::StageFlags::Hidden);
 
 						materialStage.m_sceneView.RegisterRenderItemStage(stageIdentifier, materialStage);
+						materialStage.m_sceneView.SetStageDependentOnScreenSize(stageIdentifier);
 						materialStage.m_sceneView.GetMaterialsStage().RegisterStage(materialIdentifier, materialStage);
 
 						for (const Asset::Guid dependentStage : pMaterialAsset->GetDependentStages())
@@ -104,6 +144,8 @@ namespace ngine::Rendering
 
 	MaterialStage::~MaterialStage()
 	{
+		m_sceneView.DeregisterPostTraversalJobs(m_sceneView.GetMaterialsStage().GetIndirectDrawsStartJob(), *this);
+
 		if (const Optional<const MaterialAsset*> pMaterialAsset = m_material.GetMaterial().GetAsset())
 		{
 			TextureCache& textureCache = System::Get<Rendering::Renderer>().GetTextureCache();
@@ -128,6 +170,15 @@ namespace ngine::Rendering
 
 		m_material.Destroy(m_logicalDevice);
 
+		if (m_indirectDrawBuffer.IsValid())
+		{
+			if (m_indirectDrawBufferData.HasElements())
+			{
+				m_indirectDrawBuffer.UnmapFromHostMemory(m_logicalDevice);
+			}
+			m_indirectDrawBuffer.Destroy(m_logicalDevice, m_logicalDevice.GetDeviceMemoryPool());
+		}
+
 		VisibleStaticMeshes::Destroy(m_logicalDevice);
 	}
 
@@ -413,6 +464,66 @@ namespace ngine::Rendering
 			pushConstantData.WriteAndSkip(dummy);
 		}
 
+		const MaterialAsset::PushConstants::Container::ConstView pushConstantDefinitions = materialAsset.GetPushConstants();
+		const auto pushMaterialInstanceConstants = [&](const RenderMaterialInstance& __restrict materialInstance)
+		{
+			// TODO: Look into specialization constants
+			// https://github.com/SaschaWillems/Vulkan/blob/master/examples/specializationconstants/specializationconstants.cpp
+			// http://web.engr.oregonstate.edu/~mjb/vulkan/Handouts/SpecializationConstants.1pp.pdf
+
+			if (pushConstantDefinitions.HasElements() | requiresJitterOffsets)
+			{
+				const PushConstantsData::ConstViewType pushConstants = materialInstance.GetMaterialInstance().GetPushConstantsData();
+				PushConstantsData::SizeType baseOffset = 0;
+				PushConstantsData::SizeType pushConstantOffset =
+					PushConstantsData::SizeType((uintptr)pushConstantData.GetData() - (uintptr)pushConstantData.GetData());
+				for (const PushConstantDefinition& __restrict pushConstantDefinition : pushConstantDefinitions)
+				{
+					pushConstantOffset = Memory::Align(pushConstantOffset, pushConstantDefinition.m_alignment);
+					pushConstantData.GetSubView(PushConstantsData::SizeType(pushConstantOffset + baseOffset), pushConstantDefinition.m_size)
+						.CopyFrom(pushConstants.GetSubView(baseOffset, pushConstantDefinition.m_size));
+					baseOffset += pushConstantDefinition.m_size;
+				}
+
+				m_material.PushConstants(m_logicalDevice, renderCommandEncoder, pushConstantRanges, pushConstantBuffer);
+			}
+		};
+
+		// Stages without visible items are skipped by the materials stage's jobs, so their draws are from an earlier frame
+		if (m_useIndirectDraws & HasVisibleItems())
+		{
+			// Arguments were written by the materials stage's jobs, draws are sorted by material instance so that its bindings are only set once
+			const RenderMaterialInstance* pBoundMaterialInstance = nullptr;
+			for (const IndirectDraw& indirectDraw : m_indirectDraws)
+			{
+				const InstanceGroup& instanceGroup = *indirectDraw.m_instanceGroup;
+				const RenderMaterialInstance& materialInstance = *instanceGroup.m_materialInstance;
+				if (&materialInstance != pBoundMaterialInstance)
+				{
+					m_material.BindMaterialInstance(materialInstance, renderCommandEncoder);
+					pushMaterialInstanceConstants(materialInstance);
+					pBoundMaterialInstance = &materialInstance;
+				}
+
+				m_material.DrawIndexedIndirect(
+					instanceGroup.m_instanceBuffer.GetFirstInstanceIndex(),
+					instanceGroup.m_instanceBuffer.GetInstanceCount(),
+					indirectDraw.m_renderMeshView,
+					instanceGroup.m_instanceBuffer.GetBuffer(),
+					renderCommandEncoder,
+					m_indirectDrawBuffer,
+					m_indirectDrawBufferOffset + sizeof(DrawIndexedIndirectArguments) * indirectDraw.m_firstArgumentIndex,
+					indirectDraw.m_argumentCount
+				);
+			}
+			return;
+		}
+
+		// Back facing meshlets can only be culled when the rasterizer would cull their triangles too
+		const bool cullBackFacingMeshlets = !materialAsset.m_twoSided;
+		Optional<Math::WorldCoordinate> viewLocation;
+		const uint32 viewHeight = m_sceneView.GetRenderResolution().y;
+
 		const VisibleRenderItems::VisibleInstanceGroups::ConstDynamicView instanceGroups = GetVisibleItems();
 		for (const Optional<VisibleRenderItems::InstanceGroup*> pInstanceGroup : instanceGroups)
 		{
@@ -425,42 +536,219 @@ namespace ngine::Rendering
 			{
 				const InstanceGroup& instanceGroup = static_cast<const InstanceGroup&>(*pInstanceGroup);
 
-				const RenderMaterialInstance& __restrict materialInstance = *instanceGroup.m_materialInstance;
-
-				// TODO: Look into specialization constants
-				// https://github.com/SaschaWillems/Vulkan/blob/master/examples/specializationconstants/specializationconstants.cpp
-				// http://web.engr.oregonstate.edu/~mjb/vulkan/Handouts/SpecializationConstants.1pp.pdf
-
-				const MaterialAsset::PushConstants::Container::ConstView pushConstantDefinitions = materialAsset.GetPushConstants();
-				if (pushConstantDefinitions.HasElements() | requiresJitterOffsets)
+				const RenderMeshView renderMeshView = instanceGroup.m_renderMeshView.GetLevelOfDetailView(instanceGroup.m_screenSizeClass);
+				ArrayView<const Math::Range<Index>, Index> indexRanges;
+				if (!GetVisibleIndexRanges(instanceGroup, renderMeshView, viewLocation, cullBackFacingMeshlets, indexRanges))
 				{
-					const PushConstantsData::ConstViewType pushConstants = materialInstance.GetMaterialInstance().GetPushConstantsData();
-					PushConstantsData::SizeType baseOffset = 0;
-					PushConstantsData::SizeType pushConstantOffset =
-						PushConstantsData::SizeType((uintptr)pushConstantData.GetData() - (uintptr)pushConstantData.GetData());
-					for (const PushConstantDefinition& __restrict pushConstantDefinition : pushConstantDefinitions)
-					{
-						pushConstantOffset = Memory::Align(pushConstantOffset, pushConstantDefinition.m_alignment);
-						pushConstantData.GetSubView(PushConstantsData::SizeType(pushConstantOffset + baseOffset), pushConstantDefinition.m_size)
-							.CopyFrom(pushConstants.GetSubView(baseOffset, pushConstantDefinition.m_size));
-						baseOffset += pushConstantDefinition.m_size;
-					}
-
-					m_material.PushConstants(m_logicalDevice, renderCommandEncoder, pushConstantRanges, pushConstantBuffer);
+					continue;
 				}
 
+				const RenderMaterialInstance& materialInstance = *instanceGroup.m_materialInstance;
+				// Items of a screen size class span at most the view height scaled by the class, request textures at that resolution
+				materialInstance.ReportTextureUsage(m_logicalDevice, Math::Max(viewHeight >> instanceGroup.m_screenSizeClass, 1u));
+				pushMaterialInstanceConstants(materialInstance);
+
 				m_material.Draw(
 					instanceGroup.m_instanceBuffer.GetFirstInstanceIndex(),
 					instanceGroup.m_instanceBuffer.GetInstanceCount(),
-					instanceGroup.m_renderMeshView,
+					renderMeshView,
 					instanceGroup.m_instanceBuffer.GetBuffer(),
 					instanceGroup.m_materialInstance,
-					renderCommandEncoder
+					renderCommandEncoder,
+					indexRanges
 				);
 			}
 		}
 	}
 
+	void MaterialStage::UpdateIndirectDraws()
+	{
+		m_indirectDraws.Clear();
+		m_useIndirectDraws = m_material.IsValid() && HasVisibleItems() && BuildIndirectDraws();
+	}
+
+	bool MaterialStage::BuildIndirectDraws()
+	{
+		if (m_indirectDrawBufferData.IsEmpty())
+		{
+			return false;
+		}
+
+		// Each frame in flight writes to its own region, as the GPU may still be reading the previous frames' arguments
+		const uint8 frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
+		m_indirectDrawBufferOffset = sizeof(DrawIndexedIndirectArguments) * MaximumIndirectDrawCount * frameIndex;
+		const ArrayView<DrawIndexedIndirectArguments, uint32> arguments{
+			reinterpret_cast<DrawIndexedIndirectArguments*>(m_indirectDrawBufferData.GetData() + m_indirectDrawBufferOffset),
+			MaximumIndirectDrawCount
+		};
+
+		// Back facing meshlets can only be culled when the rasterizer would cull their triangles too
+		const bool cullBackFacingMeshlets = !m_material.GetMaterial().GetAsset()->m_twoSided;
+		Optional<Math::WorldCoordinate> viewLocation;
+		const uint32 viewHeight = m_sceneView.GetRenderResolution().y;
+
+		uint32 argumentCount = 0;
+		const VisibleRenderItems::VisibleInstanceGroups::ConstDynamicView instanceGroups = GetVisibleItems();
+		for (const Optional<VisibleRenderItems::InstanceGroup*> pInstanceGroup : instanceGroups)
+		{
+			if (pInstanceGroup == nullptr || pInstanceGroup->m_instanceBuffer.GetInstanceCount() == 0)
+			{
+				continue;
+			}
+
+			const InstanceGroup& instanceGroup = static_cast<const InstanceGroup&>(*pInstanceGroup);
+			const RenderMeshView renderMeshView = instanceGroup.m_renderMeshView.GetLevelOfDetailView(instanceGroup.m_screenSizeClass);
+			ArrayView<const Math::Range<Index>, Index> indexRanges;
+			if (!GetVisibleIndexRanges(instanceGroup, renderMeshView, viewLocation, cullBackFacingMeshlets, indexRanges))
+			{
+				continue;
+			}
+
+			const uint32 firstArgumentIndex = argumentCount;
+			if (!IndirectDraws::AppendArguments(
+						arguments,
+						argumentCount,
+						indexRanges,
+						renderMeshView.GetIndexCount(),
+						instanceGroup.m_instanceBuffer.GetInstanceCount()
+					))
+			{
+				m_indirectDraws.Clear();
+				return false;
+			}
+			m_indirectDraws.EmplaceBack(IndirectDraw{instanceGroup, renderMeshView, firstArgumentIndex, argumentCount - firstArgumentIndex});
+
+			// Items of a screen size class span at most the view height scaled by the class, request textures at that resolution
+			const RenderMaterialInstance& materialInstance = *instanceGroup.m_materialInstance;
+			materialInstance.ReportTextureUsage(m_logicalDevice, Math::Max(viewHeight >> instanceGroup.m_screenSizeClass, 1u));
+		}
+
+		Algorithms::Sort(
+			m_indirectDraws.begin(),
+			m_indirectDraws.end(),
+			[](const IndirectDraw& left, const IndirectDraw& right)
+			{
+				const InstanceGroup& leftInstanceGroup = *left.m_instanceGroup;
+				const InstanceGroup& rightInstanceGroup = *right.m_instanceGroup;
+				return leftInstanceGroup.m_materialInstanceIdentifier.GetFirstValidIndex() <
+				       rightInstanceGroup.m_materialInstanceIdentifier.GetFirstValidIndex();
+			}
+		);
+		return true;
+	}
+
+	bool MaterialStage::GetVisibleIndexRanges(
+		const InstanceGroup& instanceGroup,
+		const RenderMeshView renderMeshView,
+		Optional<Math::WorldCoordinate>& viewLocation,
+		const bool cullBackFacingMeshlets,
+		ArrayView<const Math::Range<Index>, Index>& indexRangesOut
+	)
+	{
+		indexRangesOut = {};
+
+		// Meshlets are tested against the transform of every instance, larger groups are drawn in full
+		if (renderMeshView.GetMeshlets().HasElements() &
+		    (instanceGroup.m_instanceBuffer.GetInstanceCount() <= MaximumMeshletCulledInstanceCount))
+		{
+			if (!viewLocation.IsValid())
+			{
+				viewLocation = m_sceneView.GetWorldLocation();
+			}
+
+			const bool anyMeshletVisible = CullMeshlets(instanceGroup, renderMeshView, *viewLocation, cullBackFacingMeshlets);
+			if (!anyMeshletVisible)
+			{
+				return false;
+			}
+			indexRangesOut = m_visibleMeshletRanges.GetView();
+		}
+		return true;
+	}
+
+	bool MaterialStage::CullMeshlets(
+		const InstanceGroup& instanceGroup,
+		const RenderMeshView renderMeshView,
+		const Math::WorldCoordinate viewLocation,
+		const bool cullBackFacing
+	)
+	{
+		m_visibleMeshletRanges.Clear();
+
+		struct CulledInstance
+		{
+			Math::WorldTransform m_worldTransform;
+			float m_maximumScale;
+			Math::Vector3f m_localViewLocation;
+			bool m_canCullBackFacing;
+		};
+		FlatVector<CulledInstance, MaximumMeshletCulledInstanceCount> culledInstances;
+
+		Entity::SceneRegistry& sceneRegistry = m_sceneView.GetScene().GetEntitySceneRegistry();
+		Entity::ComponentTypeSceneData<Entity::Data::WorldTransform>& worldTransformSceneData =
+			sceneRegistry.GetCachedSceneData<Entity::Data::WorldTransform>();
+		const InstanceBuffer::InstanceIndexType firstInstanceIndex = instanceGroup.m_instanceBuffer.GetFirstInstanceIndex();
+		for (InstanceBuffer::InstanceIndexType instanceIndex = firstInstanceIndex,
+		                                       endInstanceIndex = firstInstanceIndex + instanceGroup.m_instanceBuffer.GetInstanceCount();
+		     instanceIndex < endInstanceIndex;
+		     ++instanceIndex)
+		{
+			const Optional<Entity::HierarchyComponentBase*> pVisibleComponent =
+				m_sceneView.GetVisibleRenderItemComponent(instanceGroup.GetInstanceRenderItem(instanceIndex));
+			if (UNLIKELY(pVisibleComponent.IsInvalid()))
+			{
+				// No ranges draws the mesh in full
+				return true;
+			}
+
+			const Math::WorldTransform& __restrict worldTransform =
+				worldTransformSceneData.GetComponentImplementationUnchecked(pVisibleComponent->GetIdentifier());
+			const Math::Vector3f scale = worldTransform.GetScale();
+			culledInstances.EmplaceBack(CulledInstance{
+				worldTransform,
+				Math::Max(Math::Abs(scale.x), Math::Max(Math::Abs(scale.y), Math::Abs(scale.z))),
+				worldTransform.InverseTransformLocation(viewLocation),
+				// Mirroring flips the winding order and non-uniform scale skews the normal cones, only test cones when neither applies
+				cullBackFacing & scale.IsUniform() & (scale.x > 0.f)
+			});
+		}
+
+		const ViewFrustum& viewFrustum = m_sceneView.GetViewFrustum();
+		const Index viewFirstIndex = renderMeshView.GetFirstIndex();
+		for (const Meshlet& meshlet : renderMeshView.GetMeshlets())
+		{
+			const bool isVisible = culledInstances.GetView().Any(
+				[&meshlet, &viewFrustum](const CulledInstance& instance)
+				{
+					const Math::WorldCoordinate center = instance.m_worldTransform.TransformLocation((Math::Vector3f)meshlet.m_center);
+					return viewFrustum.IsVisible(center, meshlet.m_radius * instance.m_maximumScale) &&
+					       !(instance.m_canCullBackFacing && meshlet.IsBackFacing(instance.m_localViewLocation));
+				}
+			);
+			if (!isVisible)
+			{
+				continue;
+			}
+
+			// Meshlets are stored in index order, merge adjacent visible ones into a single draw
+			// Ranges are relative to the level of detail drawn by the view
+			const Index firstIndex = meshlet.m_firstIndex - viewFirstIndex;
+			if (m_visibleMeshletRanges.HasElements() &&
+			    m_visibleMeshletRanges.GetLastElement().GetMinimum() + m_visibleMeshletRanges.GetLastElement().GetSize() == firstIndex)
+			{
+				Math::Range<Index>& lastRange = m_visibleMeshletRanges.GetLastElement();
+				lastRange = Math::Range<Index>::Make(lastRange.GetMinimum(), lastRange.GetSize() + meshlet.m_indexCount);
+			}
+			else
+			{
+				m_visibleMeshletRanges.EmplaceBack(Math::Range<Index>::Make(firstIndex, meshlet.m_indexCount));
+			}
+		}
+
+		Meshlets::MergeRanges(m_visibleMeshletRanges, MaximumMeshletRangeCount);
+		return m_visibleMeshletRanges.HasElements();
+	}
+
 	VisibleRenderItems::InstanceGroup::SupportResult MaterialStage::InstanceGroup::SupportsComponent(
 		const LogicalDevice&, const Entity::HierarchyComponentBase& component, Entity::SceneRegistry& sceneRegistry
 	) const
@@ -475,9 +763,13 @@ namespace ngine::Rendering
 			staticMeshIdentifierSceneData.GetComponentImplementationUnchecked(componentIdentifier);
 		const Rendering::MaterialInstanceIdentifier materialInstanceIdentifier =
 			materialInstanceIdentifierSceneData.GetComponentImplementationUnchecked(componentIdentifier);
+		const Entity::RenderItemIdentifier renderItemIdentifier =
+			sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>().GetComponentImplementationUnchecked(componentIdentifier);
+		const SceneView& sceneView = *m_sceneView;
+		const uint8 screenSizeClass = sceneView.GetRenderItemScreenSizeClass(renderItemIdentifier);
 
-		return (meshIdentifier.IsValid() &&
-		        (m_meshIdentifierIndex == meshIdentifier.GetFirstValidIndex()) & (m_materialInstanceIdentifier == materialInstanceIdentifier))
+		return (meshIdentifier.IsValid() && (m_meshIdentifierIndex == meshIdentifier.GetFirstValidIndex()) &
+		                                      (m_materialInstanceIdentifier == materialInstanceIdentifier) & (m_screenSizeClass == screenSizeClass))
 		         ? SupportResult::Supported
 		         : SupportResult::Unsupported;
 	}
@@ -486,6 +778,8 @@ namespace ngine::Rendering
 		MaterialStage& otherStage, const Rendering::MaterialInstanceIdentifier materialInstanceIdentifier
 	)
 	{
+		// A material instance can be spread across several groups, one per screen size class
+		bool movedAny = false;
 		for (UniquePtr<VisibleRenderItems::InstanceGroup>& pInstanceGroup :
 		     otherStage.m_instanceGroupIdentifiers.GetValidElementView(otherStage.m_visibleInstanceGroups.GetView()))
 		{
@@ -510,12 +804,13 @@ namespace ngine::Rendering
 					otherStage.m_visibleInstanceGroups[previousInstanceGroupIdentifier].DestroyElement();
 					otherStage.m_instanceGroupIdentifiers.ReturnIdentifier(previousInstanceGroupIdentifier);
 					otherStage.m_instanceGroupCount--;
-					return true;
+					movedAny = true;
+					continue;
 				}
 				break;
 			}
 		}
-		return false;
+		return movedAny;
 	}
 
 	UniquePtr<VisibleRenderItems::InstanceGroup> MaterialStage::CreateInstanceGroup(
@@ -543,8 +838,17 @@ namespace ngine::Rendering
 			return nullptr;
 		}
 
-		UniquePtr<InstanceGroup> pInstanceGroup =
-			UniquePtr<InstanceGroup>::Make(logicalDevice, materialInstanceIdentifier, renderMaterialInstance, maximumInstanceCount);
+		const Entity::RenderItemIdentifier renderItemIdentifier =
+			sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>().GetComponentImplementationUnchecked(componentIdentifier);
+
+		UniquePtr<InstanceGroup> pInstanceGroup = UniquePtr<InstanceGroup>::Make(
+			logicalDevice,
+			materialInstanceIdentifier,
+			renderMaterialInstance,
+			m_sceneView,
+			m_sceneView.GetRenderItemScreenSizeClass(renderItemIdentifier),
+			maximumInstanceCount
+		);
 		if (LIKELY(pInstanceGroup->m_instanceBuffer.IsValid()))
 		{
 			pInstanceGroup->m_meshIdentifierIndex = meshIdentifier.GetFirstValidIndex();
@@ -12,6 +12,7 @@
 #include <Renderer/Buffers/StagingBuffer.h>
 
 #include <Engine/Scene/Scene.h>
+#include <Engine/Threading/JobManager.h>
 #include <Engine/Entity/Data/RenderItem/StaticMeshIdentifier.h>
 #include <Engine/Entity/Data/RenderItem/MaterialInstanceIdentifier.h>
 #include <Engine/Entity/ComponentTypeSceneData.h>
@@ -21,6 +22,62 @@
 
 namespace ngine::Rendering
 {
+	struct MaterialsStage::IndirectDrawsStartJob final : public Threading::Job
+	{
+		IndirectDrawsStartJob(MaterialsStage& stage)
+			: Threading::Job(Threading::JobPriority::Draw)
+			, m_stage(stage)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.PrepareIndirectDraws();
+			if (m_stage.m_indirectDrawsJobs.IsEmpty())
+			{
+				m_stage.BuildIndirectDraws(0, 1);
+			}
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Material Indirect Draws Start Job";
+		}
+#endif
+	protected:
+		MaterialsStage& m_stage;
+	};
+
+	struct MaterialsStage::IndirectDrawsJob final : public Threading::Job
+	{
+		IndirectDrawsJob(MaterialsStage& stage, const uint32 firstStageIndex, const uint32 stageStep)
+			: Threading::Job(Threading::JobPriority::Draw)
+			, m_stage(stage)
+			, m_firstStageIndex(firstStageIndex)
+			, m_stageStep(stageStep)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.BuildIndirectDraws(m_firstStageIndex, m_stageStep);
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Material Indirect Draws Job";
+		}
+#endif
+	protected:
+		MaterialsStage& m_stage;
+		const uint32 m_firstStageIndex;
+		const uint32 m_stageStep;
+	};
+
 	MaterialsStage::MaterialsStage(SceneView& sceneView)
 		: RenderItemStage(sceneView.GetLogicalDevice(), Threading::JobPriority::Draw)
 		, m_sceneView(sceneView)
@@ -37,11 +94,27 @@ namespace ngine::Rendering
 						)
 					: StorageBuffer()
 			)
+		, m_pIndirectDrawsStartJob(UniqueRef<IndirectDrawsStartJob>::Make(*this))
 	{
+		// Material stages are independent, so each job builds the draws of every n-th active stage
+		const uint32 jobCount = (uint32)System::Get<Threading::JobManager>().GetJobThreads().GetSize();
+		m_indirectDrawsJobs.Reserve(jobCount);
+		for (uint32 jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+		{
+			IndirectDrawsJob& job = *m_indirectDrawsJobs.EmplaceBack(UniquePtr<IndirectDrawsJob>::Make(*this, jobIndex, jobCount));
+			m_pIndirectDrawsStartJob->AddSubsequentStage(job);
+			job.AddSubsequentStage(m_indirectDrawsFinishedStage);
+		}
+		if (m_indirectDrawsJobs.IsEmpty())
+		{
+			m_pIndirectDrawsStartJob->AddSubsequentStage(m_indirectDrawsFinishedStage);
+		}
+
 		Rendering::StageCache& stageCache = sceneView.GetLogicalDevice().GetRenderer().GetStageCache();
 		const SceneRenderStageIdentifier stageIdentifier =
 			stageCache.FindOrRegisterAsset(TypeGuid, MAKE_UNICODE_LITERAL("Materials"), Rendering::StageFlags::Hidden);
 		sceneView.RegisterRenderItemStage(stageIdentifier, *this);
+		sceneView.SetStageDependentOnScreenSize(stageIdentifier);
 	}
 
 	MaterialsStage::~MaterialsStage()
@@ -52,6 +125,16 @@ namespace ngine::Rendering
 
 		m_renderItemsDataBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
 
+		for (const UniquePtr<IndirectDrawsJob>& pJob : m_indirectDrawsJobs)
+		{
+			pJob->RemoveSubsequentStage(m_indirectDrawsFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+			m_pIndirectDrawsStartJob->RemoveSubsequentStage(*pJob, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+		if (m_indirectDrawsJobs.IsEmpty())
+		{
+			m_pIndirectDrawsStartJob->RemoveSubsequentStage(m_indirectDrawsFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+
 		// Deregister material listeners
 		Rendering::Renderer& renderer = System::Get<Rendering::Renderer>();
 		Rendering::MaterialCache& materialCache = renderer.GetMaterialCache();
@@ -71,6 +154,31 @@ namespace ngine::Rendering
 		}
 	}
 
+	Threading::StageBase& MaterialsStage::GetIndirectDrawsStartJob()
+	{
+		return *m_pIndirectDrawsStartJob;
+	}
+
+	void MaterialsStage::PrepareIndirectDraws()
+	{
+		m_indirectDrawStages.Clear();
+
+		const typename MaterialIdentifier::IndexType maximumUsedMaterialCount =
+			System::Get<Rendering::Renderer>().GetMaterialCache().GetMaximumUsedIdentifierCount();
+		for (const typename MaterialIdentifier::IndexType materialIndex : m_activeMaterials.GetSetBitsIterator(0, maximumUsedMaterialCount))
+		{
+			m_indirectDrawStages.EmplaceBack(*m_materialStages[MaterialIdentifier::MakeFromValidIndex(materialIndex)]);
+		}
+	}
+
+	void MaterialsStage::BuildIndirectDraws(const uint32 firstStageIndex, const uint32 stageStep)
+	{
+		for (uint32 stageIndex = firstStageIndex, stageCount = m_indirectDrawStages.GetSize(); stageIndex < stageCount; stageIndex += stageStep)
+		{
+			m_indirectDrawStages[stageIndex]->UpdateIndirectDraws();
+		}
+	}
+
 	void MaterialsStage::RegisterStage(const Rendering::MaterialIdentifier identifier, MaterialStage& stage)
 	{
 		m_materialStages[identifier] = &stage;
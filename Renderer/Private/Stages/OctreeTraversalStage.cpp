@@ -6,6 +6,7 @@
 #include <Renderer/Commands/CommandEncoderView.h>
 
 #include <Common/Threading/Jobs/JobRunnerThread.h>
+#include <Common/Threading/Jobs/JobManager.h>
 
 #include <Engine/Scene/Scene.h>
 #include <Engine/Entity/CameraComponent.h>
@@ -26,6 +27,56 @@ namespace ngine::Rendering
 		return registry.FindOrRegister("{13CA71B8-D868-4F7C-A0BB-C7585DB11327}"_asset, Tag::Flags::Transient);
 	}
 
+	struct OctreeTraversalStage::CullingJob final : public Threading::Job
+	{
+		CullingJob(OctreeTraversalStage& stage)
+			: Threading::Job(Threading::JobPriority::OctreeCulling)
+			, m_stage(stage)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.StartCulling();
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Octree Culling Job";
+		}
+#endif
+	protected:
+		OctreeTraversalStage& m_stage;
+	};
+
+	struct OctreeTraversalStage::TraversalJob final : public Threading::Job
+	{
+		TraversalJob(OctreeTraversalStage& stage, const uint16 workerIndex)
+			: Threading::Job(Threading::JobPriority::OctreeCulling)
+			, m_stage(stage)
+			, m_workerIndex(workerIndex)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread&) override final
+		{
+			m_stage.ProcessTraversalTasks(m_workerIndex);
+			return Result::Finished;
+		}
+
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Octree Traversal Job";
+		}
+#endif
+	protected:
+		OctreeTraversalStage& m_stage;
+		const uint16 m_workerIndex;
+	};
+
 	OctreeTraversalStage::OctreeTraversalStage(SceneView& sceneView)
 		: Stage(sceneView.GetLogicalDevice(), Threading::JobPriority::OctreeCulling)
 		, m_sceneView(sceneView)
@@ -37,37 +88,78 @@ namespace ngine::Rendering
 				StagingBufferSize,
 				StagingBuffer::Flags::TransferSource | StagingBuffer::Flags::TransferDestination
 			)
+		, m_pCullingJob(UniqueRef<CullingJob>::Make(*this))
 	{
+		const uint16 workerCount = (uint16)System::Get<Threading::JobManager>().GetJobThreads().GetSize();
+		m_visibleComponents.Resize(workerCount + 1u);
+		m_traversalJobs.Reserve(workerCount);
+		for (uint16 workerIndex = 0; workerIndex < workerCount; ++workerIndex)
+		{
+			TraversalJob& traversalJob = *m_traversalJobs.EmplaceBack(UniquePtr<TraversalJob>::Make(*this, workerIndex));
+			m_pCullingJob->AddSubsequentStage(traversalJob);
+			traversalJob.AddSubsequentStage(m_cullingFinishedStage);
+		}
+		if (m_traversalJobs.IsEmpty())
+		{
+			m_pCullingJob->AddSubsequentStage(m_cullingFinishedStage);
+		}
 	}
 
 	OctreeTraversalStage::~OctreeTraversalStage()
 	{
+		for (const UniquePtr<TraversalJob>& pTraversalJob : m_traversalJobs)
+		{
+			pTraversalJob->RemoveSubsequentStage(m_cullingFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+			m_pCullingJob->RemoveSubsequentStage(*pTraversalJob, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+		if (m_traversalJobs.IsEmpty())
+		{
+			m_pCullingJob->RemoveSubsequentStage(m_cullingFinishedStage, Invalid, Threading::StageBase::RemovalFlags{});
+		}
+
 		m_perFrameStagingBuffer.Destroy(m_sceneView.GetLogicalDevice(), m_sceneView.GetLogicalDevice().GetDeviceMemoryPool());
 	}
 
+	Threading::Job& OctreeTraversalStage::GetCullingJob()
+	{
+		return *m_pCullingJob;
+	}
+
 	bool OctreeTraversalStage::ShouldRecordCommands() const
 	{
 		return m_sceneView.HasActiveCamera();
 	}
 
-	void OctreeTraversalStage::RecordCommands(const CommandEncoderView graphicsCommandEncoder)
+	void OctreeTraversalStage::StartCulling()
 	{
-#if RENDERER_OBJECT_DEBUG_NAMES
-		const DebugMarker debugMarker{graphicsCommandEncoder, m_sceneView.GetLogicalDevice(), "Octree Traversal", "#FF0000"_color};
-#endif
+		for (VisibleComponents& visibleComponents : m_visibleComponents)
+		{
+			visibleComponents.Clear();
+		}
+		m_traversalTasks.Clear();
+		m_nextTraversalTaskIndex = 0;
 
-		m_lastFrameIndex = m_sceneView.GetCurrentFrameIndex();
-		m_perFrameStagingBuffer.Start();
+		if (!ShouldRecordCommands())
+		{
+			return;
+		}
 
-		m_sceneView.StartOctreeTraversal(graphicsCommandEncoder, m_perFrameStagingBuffer);
+		m_sceneView.PrepareOctreeTraversal();
 
 		const Entity::CameraComponent& camera = m_sceneView.GetActiveCameraComponent();
 
 		Entity::SceneRegistry& sceneRegistry = m_sceneView.GetScene().GetEntitySceneRegistry();
+		m_pSceneRegistry = &sceneRegistry;
+		m_cullingVolumes = m_sceneView.GetCullingVolumes();
+		const Classification rootClassification = m_cullingVolumes.GetRootClassification();
+
+		VisibleComponents& localVisibleComponents = m_visibleComponents.GetLastElement();
+
 		Entity::ComponentTypeSceneData<Entity::Data::OctreeNode>& octreeNodeSceneData =
 			*sceneRegistry.FindComponentTypeData<Entity::Data::OctreeNode>();
 		Optional<Entity::Data::OctreeNode*> pCameraOctreeNode = octreeNodeSceneData.GetComponentImplementation(camera.GetIdentifier());
 
+		// Walk up from the camera's node, culling the siblings of each visited node and splitting visible subtrees into tasks
 		const SceneOctreeNode* pNode = LIKELY(pCameraOctreeNode != nullptr) ? &pCameraOctreeNode->Get()
 		                                                                    : &m_sceneView.GetScene().GetRootComponent().GetRootNode();
 		const SceneOctreeNode* pNodeChild = nullptr;
@@ -75,19 +167,16 @@ namespace ngine::Rendering
 		{
 			if (pNode->ContainsTag(m_renderItemTagIdentifier))
 			{
-				for (Entity::Component3D& transformedComponent : pNode->GetComponentsView())
-				{
-					ProcessTransformedComponentInOctree(transformedComponent, graphicsCommandEncoder, sceneRegistry);
-				}
+				ProcessNodeComponentsInOctree(*pNode, rootClassification, localVisibleComponents);
 
 				for (const Optional<SceneOctreeNode*> pChildNode : pNode->GetChildren())
 				{
 					if (pChildNode != nullptr && pChildNode != pNodeChild)
 					{
-						if (pChildNode->ContainsTag(m_renderItemTagIdentifier
-						    )) // Math::Overlaps<Math::WorldCoordinate>(cullingFrustum, childNode.GetDynamicBoundingBox(), worldToCameraSpace))
+						const Classification childClassification = ClassifyChildNode(*pChildNode, rootClassification);
+						if (!childClassification.IsOutside())
 						{
-							ProcessHierarchyInOctree(*pChildNode, graphicsCommandEncoder, sceneRegistry);
+							GatherTraversalTasks(*pChildNode, childClassification, ParallelSplitDepth);
 						}
 					}
 				}
@@ -97,6 +186,33 @@ namespace ngine::Rendering
 			pNode = pNode->GetParent();
 		} while (pNode != nullptr);
 
+		// The gathered subtrees are culled by the traversal jobs that follow this job
+		if (m_traversalJobs.IsEmpty())
+		{
+			ProcessTraversalTasks((uint16)m_traversalJobs.GetSize());
+		}
+	}
+
+	void OctreeTraversalStage::RecordCommands(const CommandEncoderView graphicsCommandEncoder)
+	{
+#if RENDERER_OBJECT_DEBUG_NAMES
+		const DebugMarker debugMarker{graphicsCommandEncoder, m_sceneView.GetLogicalDevice(), "Octree Traversal", "#FF0000"_color};
+#endif
+
+		m_lastFrameIndex = m_sceneView.GetCurrentFrameIndex();
+		m_perFrameStagingBuffer.Start();
+
+		m_sceneView.StartOctreeTraversal(graphicsCommandEncoder, m_perFrameStagingBuffer);
+
+		// Culling finished before this stage was queued, registering visible items mutates the view state so it stays on the recording thread
+		for (VisibleComponents& visibleComponents : m_visibleComponents)
+		{
+			for (const VisibleComponent& visibleComponent : visibleComponents)
+			{
+				m_sceneView.ProcessVisibleComponentFromOctreeTraversal(visibleComponent.m_component, visibleComponent.m_visibility);
+			}
+		}
+
 		m_sceneView.OnOctreeTraversalFinished(graphicsCommandEncoder, m_perFrameStagingBuffer);
 	}
 
@@ -110,13 +226,57 @@ namespace ngine::Rendering
 		m_lastFrameIndex = m_sceneView.GetCurrentFrameIndex();
 	}
 
-	void OctreeTraversalStage::ProcessTransformedComponentInOctree(
+	void
+	OctreeTraversalStage::GatherTraversalTasks(const SceneOctreeNode& node, const Classification classification, const uint8 remainingSplitDepth)
+	{
+		if (remainingSplitDepth == 0 || !node.HasChildren())
+		{
+			m_traversalTasks.EmplaceBack(TraversalTask{node, classification});
+			return;
+		}
+
+		ProcessNodeComponentsInOctree(node, classification, m_visibleComponents.GetLastElement());
 
-		Entity::Component3D& transformedComponent,
-		const Rendering::CommandEncoderView graphicsCommandEncoder,
-		Entity::SceneRegistry& sceneRegistry
+		for (const Optional<SceneOctreeNode*> pChildNode : node.GetChildren())
+		{
+			if (pChildNode != nullptr)
+			{
+				const Classification childClassification = ClassifyChildNode(*pChildNode, classification);
+				if (!childClassification.IsOutside())
+				{
+					GatherTraversalTasks(*pChildNode, childClassification, remainingSplitDepth - 1);
+				}
+			}
+		}
+	}
+
+	void OctreeTraversalStage::ProcessTraversalTasks(const uint16 workerIndex)
+	{
+		VisibleComponents& visibleComponents = m_visibleComponents[workerIndex];
+		const uint32 taskCount = m_traversalTasks.GetSize();
+		for (uint32 taskIndex = m_nextTraversalTaskIndex.FetchAdd(1); taskIndex < taskCount; taskIndex = m_nextTraversalTaskIndex.FetchAdd(1))
+		{
+			const TraversalTask& task = m_traversalTasks[taskIndex];
+			ProcessHierarchyInOctree(task.m_node, task.m_classification, visibleComponents);
+		}
+	}
+
+	OctreeTraversalStage::Classification
+	OctreeTraversalStage::ClassifyChildNode(const SceneOctreeNode& childNode, const Classification parentClassification) const
+	{
+		if (!childNode.ContainsTag(m_renderItemTagIdentifier))
+		{
+			return Classification{};
+		}
+		// Subtrees of fully contained nodes are contained as well, only volumes the parent partially overlaps are tested
+		return m_cullingVolumes.Classify(childNode.GetChildBoundingBox(), parentClassification);
+	}
+
+	void OctreeTraversalStage::ProcessTransformedComponentInOctree(
+		Entity::Component3D& transformedComponent, const Classification classification, VisibleComponents& visibleComponentsOut
 	)
 	{
+		Entity::SceneRegistry& sceneRegistry = *m_pSceneRegistry;
 		Entity::ComponentTypeSceneData<Entity::Data::Flags>& flagsSceneData = sceneRegistry.GetCachedSceneData<Entity::Data::Flags>();
 		const EnumFlags<Entity::ComponentFlags> componentFlags =
 			flagsSceneData.GetComponentImplementationUnchecked(transformedComponent.GetIdentifier());
@@ -124,7 +284,11 @@ namespace ngine::Rendering
 			sceneRegistry.GetCachedSceneData<Entity::Data::RenderItem::Identifier>();
 		if (sceneRegistry.HasDataComponentOfType(transformedComponent.GetIdentifier(), renderItemIdentifierSceneData.GetIdentifier()))
 		{
-			m_sceneView.ProcessComponentFromOctreeTraversal(transformedComponent);
+			const CullingVolumes::Visibility visibility = m_sceneView.IsComponentVisibleFromOctreeTraversal(transformedComponent, classification);
+			if (visibility != CullingVolumes::Visibility::Hidden)
+			{
+				visibleComponentsOut.EmplaceBack(VisibleComponent{transformedComponent, visibility});
+			}
 		}
 		else if (componentFlags.IsSet(Entity::ComponentFlags::IsRootScene))
 		{
@@ -132,35 +296,43 @@ namespace ngine::Rendering
 
 			const SceneOctreeNode& octreeNode = rootSceneComponent.GetRootNode();
 
-			if (octreeNode.ContainsTag(m_renderItemTagIdentifier
-			    )) // Math::Overlaps<Math::WorldCoordinate>(cullingFrustum, rootSceneComponent.GetDynamicOctreeWorldBoundingBox(),
-			       // worldToCameraSpaceMatrix))
+			if (octreeNode.ContainsTag(m_renderItemTagIdentifier))
 			{
-				ProcessHierarchyInOctree(octreeNode, graphicsCommandEncoder, sceneRegistry);
+				const Classification rootClassification =
+					m_cullingVolumes.Classify(rootSceneComponent.GetDynamicOctreeWorldBoundingBox(), classification);
+				if (!rootClassification.IsOutside())
+				{
+					ProcessHierarchyInOctree(octreeNode, rootClassification, visibleComponentsOut);
+				}
 			}
 		}
 	}
 
-	void OctreeTraversalStage::ProcessHierarchyInOctree(
-		const SceneOctreeNode& node, const Rendering::CommandEncoderView graphicsCommandEncoder, Entity::SceneRegistry& sceneRegistry
+	void OctreeTraversalStage::ProcessNodeComponentsInOctree(
+		const SceneOctreeNode& node, const Classification classification, VisibleComponents& visibleComponentsOut
 	)
 	{
+		const SceneOctreeNode::ComponentsView components = node.GetComponentsView();
+		for (Entity::Component3D& transformedComponent : components)
 		{
-			const SceneOctreeNode::ComponentsView components = node.GetComponentsView();
-			for (Entity::Component3D& transformedComponent : components)
-			{
-				ProcessTransformedComponentInOctree(transformedComponent, graphicsCommandEncoder, sceneRegistry);
-			}
+			ProcessTransformedComponentInOctree(transformedComponent, classification, visibleComponentsOut);
 		}
+	}
+
+	void OctreeTraversalStage::ProcessHierarchyInOctree(
+		const SceneOctreeNode& node, const Classification classification, VisibleComponents& visibleComponentsOut
+	)
+	{
+		ProcessNodeComponentsInOctree(node, classification, visibleComponentsOut);
 
 		for (const Optional<SceneOctreeNode*> pChildNode : node.GetChildren())
 		{
 			if (pChildNode != nullptr)
 			{
-				if (pChildNode->ContainsTag(m_renderItemTagIdentifier
-				    )) // Math::Overlaps<Math::WorldCoordinate>(cullingFrustum, childNode.GetDynamicBoundingBox(), worldToCameraSpaceMatrix))
+				const Classification childClassification = ClassifyChildNode(*pChildNode, classification);
+				if (!childClassification.IsOutside())
 				{
-					ProcessHierarchyInOctree(*pChildNode, graphicsCommandEncoder, sceneRegistry);
+					ProcessHierarchyInOctree(*pChildNode, childClassification, visibleComponentsOut);
 				}
 			}
 		}
@@ -136,6 +136,21 @@ namespace ngine::Rendering
 																		);
 	}
 
+	bool Pass::UpdatesSharedDescriptorSets() const
+	{
+		return m_subpassStages.GetView().Any(
+			[](const SubpassStages& subpassStages)
+			{
+				return subpassStages.GetView().Any(
+					[](const Stage& stage)
+					{
+						return stage.UpdatesSharedDescriptorSets();
+					}
+				);
+			}
+		);
+	}
+
 	void Pass::OnBeforeRecordCommands(const CommandEncoderView commandEncoder)
 	{
 		for (SubpassStages& subpassStages : m_subpassStages.GetView())
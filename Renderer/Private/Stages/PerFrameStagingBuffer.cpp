@@ -8,7 +8,10 @@
 
 #include <Renderer/WebGPU/Includes.h>
 
+#include <Engine/Engine.h>
+
 #include <Common/Threading/Jobs/JobRunnerThread.h>
+#include <Common/System/Query.h>
 
 namespace ngine::Rendering
 {
@@ -19,12 +22,13 @@ namespace ngine::Rendering
 		[[maybe_unused]] const size allocatedSize,
 		[[maybe_unused]] const EnumFlags<StagingBuffer::Flags> stagingBufferFlags
 	)
-		: m_stagingBuffer(logicalDevice, physicalDevice, memoryPool, allocatedSize, stagingBufferFlags)
+		: m_stagingBuffer(logicalDevice, physicalDevice, memoryPool, allocatedSize * MaximumConcurrentFrameCount, stagingBufferFlags)
+		, m_frameSize(allocatedSize)
 	{
 #if !RENDERER_WEBGPU
 		m_stagingBuffer.MapToHostMemory(
 			logicalDevice,
-			Math::Range<size>::Make(0, allocatedSize),
+			Math::Range<size>::Make(0, allocatedSize * MaximumConcurrentFrameCount),
 			Buffer::MapMemoryFlags::Write | Buffer::MapMemoryFlags::KeepMapped,
 			[this]([[maybe_unused]] const Buffer::MapMemoryStatus status, const ByteView data, [[maybe_unused]] const bool executedAsynchronously)
 			{
@@ -46,7 +50,10 @@ namespace ngine::Rendering
 
 	void PerFrameStagingBuffer::Start()
 	{
-		m_stagingBufferOffset = 0;
+		// Each frame in flight writes to its own region, as the GPU may still be copying from the previous frames' data
+		const uint8 frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
+		m_frameOffset = m_frameSize * frameIndex;
+		m_stagingBufferOffset = m_frameOffset;
 	}
 
 	void PerFrameStagingBuffer::CopyToBuffer(
@@ -1,5 +1,6 @@
 #include "Stages/Stage.h"
 #include "Stages/PresentStage.h"
+#include "Framegraph/Framegraph.h"
 
 #include <Renderer/Scene/SceneView.h>
 #include <Renderer/Devices/LogicalDevice.h>
@@ -39,7 +40,10 @@ namespace ngine::Rendering
 				Threading::JobPriority::Submit,
 				"Submitted Stage to GPU"
 			))
-		, m_finishedExecutionStage(Threading::CreateCallback(
+	{
+		for (Threading::AsyncCallbackJobBase*& pFinishedExecutionStage : m_finishedExecutionStages)
+		{
+			pFinishedExecutionStage = &Threading::CreateCallback(
 				[this](Threading::JobRunnerThread&)
 				{
 					OnCommandsExecuted();
@@ -47,8 +51,9 @@ namespace ngine::Rendering
 				},
 				Threading::JobPriority::Submit,
 				"Finished Stage Execution"
-			))
-	{
+			);
+		}
+
 		AddSubsequentCpuStage(m_submitJob);
 	}
 
@@ -58,24 +63,36 @@ namespace ngine::Rendering
 		{
 			semaphore.Destroy(m_logicalDevice);
 		}
-		m_drawingCompletePresentSemaphore.Destroy(m_logicalDevice);
+		for (Semaphore& semaphore : m_drawingCompletePresentSemaphores)
+		{
+			semaphore.Destroy(m_logicalDevice);
+		}
 
-		if (m_drawingCompletePresentFence.IsValid())
+		for (Fence& fence : m_drawingCompletePresentFences)
 		{
-			m_drawingCompletePresentFence.Destroy(m_logicalDevice);
+			if (fence.IsValid())
+			{
+				fence.Destroy(m_logicalDevice);
+			}
 		}
 
 		RemoveSubsequentCpuStage(m_submitJob, Invalid, Threading::Job::RemovalFlags{});
 
 		delete &m_submitJob;
-		delete &m_finishedExecutionStage;
+		for (Threading::AsyncCallbackJobBase* pFinishedExecutionStage : m_finishedExecutionStages)
+		{
+			delete pFinishedExecutionStage;
+		}
 	}
 
 	void Stage::AddSubsequentGpuStage(PresentStage& presentStage)
 	{
 #if STAGE_DEPENDENCY_PROFILING
 		m_submitJob.SetDebugName(Move(String().Format("{} submit stage", GetDebugName())));
-		m_finishedExecutionStage.SetDebugName(Move(String().Format("{} finished execution stage", GetDebugName())));
+		for (Threading::AsyncCallbackJobBase* pFinishedExecutionStage : m_finishedExecutionStages)
+		{
+			pFinishedExecutionStage->SetDebugName(Move(String().Format("{} finished execution stage", GetDebugName())));
+		}
 #endif
 
 		Assert(m_pSubsequentGpuPresentStage.IsInvalid());
@@ -84,16 +101,22 @@ namespace ngine::Rendering
 		if (presentStage.SupportsSemaphores())
 		{
 			Assert(GetPipelineStageFlags().AreAnySet());
-			m_drawingCompletePresentSemaphore = Semaphore(m_logicalDevice);
+			for (Semaphore& semaphore : m_drawingCompletePresentSemaphores)
+			{
+				semaphore = Semaphore(m_logicalDevice);
 #if RENDERER_OBJECT_DEBUG_NAMES
-			String debugName;
-			debugName.Format("{} -> {}", GetDebugName(), presentStage.GetDebugName());
-			m_drawingCompletePresentSemaphore.SetDebugName(m_logicalDevice, Move(debugName));
+				String debugName;
+				debugName.Format("{} -> {}", GetDebugName(), presentStage.GetDebugName());
+				semaphore.SetDebugName(m_logicalDevice, Move(debugName));
 #endif
+			}
 		}
 		else
 		{
-			m_drawingCompletePresentFence = Fence(m_logicalDevice, FenceView::Status::Unsignaled);
+			for (Fence& fence : m_drawingCompletePresentFences)
+			{
+				fence = Fence(m_logicalDevice, FenceView::Status::Unsignaled);
+			}
 		}
 
 		m_pSubsequentGpuPresentStage = &presentStage;
@@ -109,11 +132,17 @@ namespace ngine::Rendering
 			Threading::EngineJobRunnerThread& thread = *Threading::EngineJobRunnerThread::GetCurrent();
 			if (presentStage.SupportsSemaphores())
 			{
-				thread.GetRenderData().DestroySemaphore(m_logicalDevice.GetIdentifier(), Move(m_drawingCompletePresentSemaphore));
+				for (Semaphore& semaphore : m_drawingCompletePresentSemaphores)
+				{
+					thread.GetRenderData().DestroySemaphore(m_logicalDevice.GetIdentifier(), Move(semaphore));
+				}
 			}
 			else
 			{
-				thread.GetRenderData().DestroyFence(m_logicalDevice.GetIdentifier(), Move(m_drawingCompletePresentFence));
+				for (Fence& fence : m_drawingCompletePresentFences)
+				{
+					thread.GetRenderData().DestroyFence(m_logicalDevice.GetIdentifier(), Move(fence));
+				}
 			}
 
 			m_pSubsequentGpuPresentStage = Invalid;
@@ -167,12 +196,16 @@ namespace ngine::Rendering
 	{
 		Assert(GetPipelineStageFlags().AreAnySet());
 		Threading::UniqueLock lock(m_drawingCompleteSemaphoresMutex);
-		[[maybe_unused]] Semaphore& semaphore = m_drawingCompleteSemaphores.EmplaceBack(m_logicalDevice);
+		Assert(m_drawingCompleteSemaphores.GetSize() == GetDrawingCompleteSemaphoreIndex(m_subsequentGpuStages.GetSize(), 0));
+		for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
+		{
+			[[maybe_unused]] Semaphore& semaphore = m_drawingCompleteSemaphores.EmplaceBack(m_logicalDevice);
 #if RENDERER_OBJECT_DEBUG_NAMES
-		String debugName;
-		debugName.Format("{} -> {}", GetDebugName(), subsequentStage.GetDebugName());
-		semaphore.SetDebugName(m_logicalDevice, Move(debugName));
+			String debugName;
+			debugName.Format("{} -> {}", GetDebugName(), subsequentStage.GetDebugName());
+			semaphore.SetDebugName(m_logicalDevice, Move(debugName));
 #endif
+		}
 		m_subsequentGpuStages.EmplaceBack(subsequentStage);
 
 		m_submitJob.AddSubsequentStage(subsequentStage.GetSubmitJob());
@@ -187,11 +220,14 @@ namespace ngine::Rendering
 		Assert(stageIt != m_subsequentGpuStages.end());
 		if (LIKELY(stageIt != m_subsequentGpuStages.end()))
 		{
-			decltype(m_drawingCompleteSemaphores)::iterator semaphoreIt = m_drawingCompleteSemaphores.begin() +
-			                                                              m_subsequentGpuStages.GetIteratorIndex(stageIt);
-			thread.GetRenderData().DestroySemaphore(m_logicalDevice.GetIdentifier(), Move(*semaphoreIt));
+			const uint16 firstSemaphoreIndex = GetDrawingCompleteSemaphoreIndex(m_subsequentGpuStages.GetIteratorIndex(stageIt), 0);
+			for (FrameIndex frameIndex = 0; frameIndex < MaximumConcurrentFrameCount; ++frameIndex)
+			{
+				decltype(m_drawingCompleteSemaphores)::iterator semaphoreIt = m_drawingCompleteSemaphores.begin() + firstSemaphoreIndex;
+				thread.GetRenderData().DestroySemaphore(m_logicalDevice.GetIdentifier(), Move(*semaphoreIt));
+				m_drawingCompleteSemaphores.Remove(semaphoreIt);
+			}
 
-			m_drawingCompleteSemaphores.Remove(semaphoreIt);
 			m_subsequentGpuStages.Remove(stageIt);
 		}
 
@@ -245,9 +281,11 @@ namespace ngine::Rendering
 	Threading::Job::Result Stage::OnExecute(Threading::JobRunnerThread& thread)
 	{
 		Threading::EngineJobRunnerThread& engineThreadRunner = static_cast<Threading::EngineJobRunnerThread&>(thread);
-		const uint8 frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
+		const FrameIndex frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
 
-		Assert(m_flags.AreNoneSet(Flags::AwaitingSubmission | Flags::AwaitingGPUFinish));
+		// Previous frames may still be executing on the GPU, but never the frame we're recording
+		Assert((m_awaitingSubmissionFrameMask.Load() & FrameMask(1u << frameIndex)) == 0);
+		Assert((m_awaitingGpuFinishFrameMask.Load() & FrameMask(1u << frameIndex)) == 0);
 
 		if (m_flags.IsSet(Flags::ManagedByPass))
 		{
@@ -256,15 +294,43 @@ namespace ngine::Rendering
 
 		if (EvaluateShouldSkip())
 		{
-			if (m_finishedExecutionStage.HasSubsequentTasks())
+			Threading::AsyncCallbackJobBase& finishedExecutionStage = *m_finishedExecutionStages[frameIndex];
+			if (finishedExecutionStage.HasSubsequentTasks())
 			{
-				m_finishedExecutionStage.SignalExecutionFinished(thread);
+				finishedExecutionStage.SignalExecutionFinished(thread);
+			}
+			if (m_pFramegraph.IsValid())
+			{
+				m_pFramegraph->OnStageFinishedGpuExecution(frameIndex);
 			}
 			return Result::Finished;
 		}
 
-		m_pThreadRunner = &engineThreadRunner;
+		// Descriptor sets aren't buffered per frame, hold back recording until earlier frames stopped reading them
+		if (m_pFramegraph.IsValid() && UpdatesSharedDescriptorSets())
+		{
+			const bool deferred = m_pFramegraph->DeferUntilPreviousFramesGpuExecution(
+				frameIndex,
+				[this, frameIndex](Threading::JobRunnerThread& thread)
+				{
+					RecordFrame(static_cast<Threading::EngineJobRunnerThread&>(thread), frameIndex);
+					SignalExecutionFinished(thread);
+				}
+			);
+			if (deferred)
+			{
+				return Result::AwaitExternalFinish;
+			}
+		}
 
+		RecordFrame(engineThreadRunner, frameIndex);
+		return Result::Finished;
+	}
+
+	void Stage::RecordFrame(Threading::EngineJobRunnerThread& engineThreadRunner, const FrameIndex frameIndex)
+	{
+		PerFrameSubmission& submission = m_perFrameSubmissions[frameIndex];
+		submission.m_pThreadRunner = &engineThreadRunner;
 		engineThreadRunner.GetRenderData().OnStartFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
 
 		const QueueFamily queueFamily = GetRecordedQueueFamily();
@@ -301,33 +367,34 @@ namespace ngine::Rendering
 			RecordCommandsInternal(commandEncoder);
 
 			{
-				m_encodedCommandBuffer = commandEncoder.StopEncoding();
-				Assert(m_encodedCommandBuffer.IsValid());
+				submission.m_encodedCommandBuffer = commandEncoder.StopEncoding();
+				Assert(submission.m_encodedCommandBuffer.IsValid());
 			}
 		}
 
-		m_waitSemaphores.Clear();
-		m_signalSemaphores.Clear();
-		m_waitStagesMasks.Clear();
+		submission.m_waitSemaphores.Clear();
+		submission.m_signalSemaphores.Clear();
+		submission.m_waitStagesMasks.Clear();
+		submission.m_signalFence = {};
 
-		m_waitSemaphores.Reserve(m_parentStages.GetSize());
-		m_waitStagesMasks.Reserve(m_parentStages.GetSize());
+		submission.m_waitSemaphores.Reserve(m_parentStages.GetSize());
+		submission.m_waitStagesMasks.Reserve(m_parentStages.GetSize());
 
 		for (const StageBase& parent : m_parentStages)
 		{
 			Stage::IterateUsedStages(
 				parent,
 				*this,
-				[this](Stage::UsedStage usedStage)
+				[&submission](Stage::UsedStage usedStage)
 				{
 					if (usedStage.stage->IsSubmissionFinishedSemaphoreUsable())
 					{
 						if (const SemaphoreView waitSemaphore = usedStage.stage->GetSubmissionFinishedSemaphore(usedStage.nextStage);
 					      waitSemaphore.IsValid())
 						{
-							Assert(!m_waitSemaphores.Contains(waitSemaphore));
-							m_waitSemaphores.EmplaceBack(waitSemaphore);
-							m_waitStagesMasks.EmplaceBack(usedStage.stage->GetPipelineStageFlags());
+							Assert(!submission.m_waitSemaphores.Contains(waitSemaphore));
+							submission.m_waitSemaphores.EmplaceBack(waitSemaphore);
+							submission.m_waitStagesMasks.EmplaceBack(usedStage.stage->GetPipelineStageFlags());
 						}
 					}
 				}
@@ -336,34 +403,36 @@ namespace ngine::Rendering
 
 		if (GetPipelineStageFlags().AreAnySet())
 		{
-			m_signalSemaphores.Reserve(m_drawingCompleteSemaphores.GetSize() + m_drawingCompletePresentSemaphore.IsValid());
+			const Semaphore& presentSemaphore = m_drawingCompletePresentSemaphores[frameIndex];
+			submission.m_signalSemaphores.Reserve(uint8(m_subsequentGpuStages.GetSize() + presentSemaphore.IsValid()));
 
-			for (uint8 index = 0, count = m_drawingCompleteSemaphores.GetSize(); index < count; ++index)
+			for (uint8 index = 0, count = m_subsequentGpuStages.GetSize(); index < count; ++index)
 			{
 				if (!m_subsequentGpuStages[index]->EvaluateShouldSkip())
 				{
-					m_signalSemaphores.EmplaceBack(m_drawingCompleteSemaphores[index]);
+					submission.m_signalSemaphores.EmplaceBack(m_drawingCompleteSemaphores[GetDrawingCompleteSemaphoreIndex(index, frameIndex)]);
 				}
 			}
-			if (m_drawingCompletePresentSemaphore.IsValid())
+			if (presentSemaphore.IsValid())
 			{
-				m_signalSemaphores.EmplaceBack(m_drawingCompletePresentSemaphore);
+				submission.m_signalSemaphores.EmplaceBack(presentSemaphore);
 			}
 		}
 
-		if (m_drawingCompletePresentFence.IsValid())
+		if (m_drawingCompletePresentFences[frameIndex].IsValid())
 		{
-			m_signalFence = m_drawingCompletePresentFence;
+			submission.m_signalFence = m_drawingCompletePresentFences[frameIndex];
 		}
 
-		m_flags |= Flags::AwaitingSubmission | Flags::AwaitingGPUFinish;
-		return Result::Finished;
+		m_awaitingSubmissionFrameMask.FetchOr(FrameMask(1u << frameIndex));
+		m_awaitingGpuFinishFrameMask.FetchOr(FrameMask(1u << frameIndex));
 	}
 
 	SemaphoreView Stage::GetSubmissionFinishedSemaphore(const Threading::Job& stage) const
 	{
 		if (!const_cast<Stage&>(*this).EvaluateShouldSkip())
 		{
+			const FrameIndex frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
 			if (Optional<uint8> childIndex = m_subsequentGpuStages.FindIndex(stage))
 			{
 				if (static_cast<Stage&>(const_cast<Threading::Job&>(stage)).EvaluateShouldSkip())
@@ -371,11 +440,11 @@ namespace ngine::Rendering
 					return {};
 				}
 
-				return m_drawingCompleteSemaphores[*childIndex];
+				return m_drawingCompleteSemaphores[GetDrawingCompleteSemaphoreIndex(*childIndex, frameIndex)];
 			}
 			else
 			{
-				return m_drawingCompletePresentSemaphore;
+				return m_drawingCompletePresentSemaphores[frameIndex];
 			}
 		}
 		else
@@ -384,45 +453,85 @@ namespace ngine::Rendering
 		}
 	}
 
+	FenceView Stage::GetSubmissionFinishedFence() const
+	{
+		return m_drawingCompletePresentFences[System::Get<Engine>().GetCurrentFrameIndex()];
+	}
+
 	void Stage::SubmitEncodedCommandBuffer()
 	{
-		Threading::EngineJobRunnerThread& engineThreadRunner = *m_pThreadRunner;
-		const uint8 frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
+		const FrameIndex frameIndex = System::Get<Engine>().GetCurrentFrameIndex();
+		Assert((m_awaitingSubmissionFrameMask.Load() & FrameMask(1u << frameIndex)) != 0);
 
+		// Resources shared between frames are only hazard tracked within a frame, hold back submission until earlier frames finished on the GPU
+		// The submit job keeps awaiting its external finish meanwhile, so no thread is blocked and recording of this frame still overlaps
+		if (m_pFramegraph.IsValid())
+		{
+			const bool deferred = m_pFramegraph->DeferUntilPreviousFramesGpuExecution(
+				frameIndex,
+				[this, frameIndex](Threading::JobRunnerThread&)
+				{
+					SubmitEncodedCommandBuffer(frameIndex);
+				}
+			);
+			if (deferred)
+			{
+				return;
+			}
+		}
+
+		SubmitEncodedCommandBuffer(frameIndex);
+	}
+
+	void Stage::SubmitEncodedCommandBuffer(const FrameIndex frameIndex)
+	{
+		PerFrameSubmission& submission = m_perFrameSubmissions[frameIndex];
+		Threading::EngineJobRunnerThread& engineThreadRunner = *submission.m_pThreadRunner;
 		const QueueFamily queueFamily = GetRecordedQueueFamily();
 
-		Assert(m_flags.AreAllSet(Flags::AwaitingSubmission | Flags::AwaitingGPUFinish));
+		Assert((m_awaitingSubmissionFrameMask.Load() & FrameMask(1u << frameIndex)) != 0);
+		Assert((m_awaitingGpuFinishFrameMask.Load() & FrameMask(1u << frameIndex)) != 0);
 
 		QueueSubmissionParameters submissionParameters;
-		submissionParameters.m_signalSemaphores = m_signalSemaphores.GetView();
-		submissionParameters.m_waitSemaphores = m_waitSemaphores;
-		submissionParameters.m_waitStagesMasks = m_waitStagesMasks;
-		submissionParameters.m_fence = m_signalFence;
+		submissionParameters.m_signalSemaphores = submission.m_signalSemaphores.GetView();
+		submissionParameters.m_waitSemaphores = submission.m_waitSemaphores;
+		submissionParameters.m_waitStagesMasks = submission.m_waitStagesMasks;
+		submissionParameters.m_fence = submission.m_signalFence;
 
 		submissionParameters.m_submittedCallback = [this, frameIndex, &engineThreadRunner]()
 		{
-			[[maybe_unused]] const bool clearedFlags = m_flags.TryClearFlags(Flags::AwaitingSubmission);
-			Assert(clearedFlags);
+			const FrameMask frameMask = FrameMask(1u << frameIndex);
+			[[maybe_unused]] const FrameMask previousFrameMask = m_awaitingSubmissionFrameMask.FetchAnd((FrameMask)~frameMask);
+			Assert((previousFrameMask & frameMask) != 0);
 			m_submitJob.SignalExecutionFinished(*Threading::JobRunnerThread::GetCurrent());
 			engineThreadRunner.GetRenderData().OnFinishFrameCpuWork(m_logicalDevice.GetIdentifier(), frameIndex);
 		};
 
-		submissionParameters.m_finishedCallback = [this, frameIndex, &engineThreadRunner]() mutable
+		submissionParameters.m_finishedCallback = [this, frameIndex, signalFence = submission.m_signalFence, &engineThreadRunner]() mutable
 		{
-			if (m_signalFence.IsValid())
+			if (signalFence.IsValid())
 			{
-				m_signalFence.Reset(m_logicalDevice);
+				signalFence.Reset(m_logicalDevice);
 			}
 
-			[[maybe_unused]] const bool clearedFlags = m_flags.TryClearFlags(Flags::AwaitingGPUFinish);
-			Assert(clearedFlags);
+			const FrameMask frameMask = FrameMask(1u << frameIndex);
+			[[maybe_unused]] const FrameMask previousFrameMask = m_awaitingGpuFinishFrameMask.FetchAnd((FrameMask)~frameMask);
+			Assert((previousFrameMask & frameMask) != 0);
 
-			m_finishedExecutionStage.Queue(System::Get<Threading::JobManager>());
+			m_finishedExecutionStages[frameIndex]->Queue(System::Get<Threading::JobManager>());
 			engineThreadRunner.GetRenderData().OnPerFrameCommandBufferFinishedExecution(m_logicalDevice.GetIdentifier(), frameIndex);
+			if (m_pFramegraph.IsValid())
+			{
+				m_pFramegraph->OnStageFinishedGpuExecution(frameIndex);
+			}
 		};
 
 		m_logicalDevice.GetQueueSubmissionJob(queueFamily)
-			.Queue(GetPriority(), ArrayView<const EncodedCommandBufferView, uint16>(m_encodedCommandBuffer), Move(submissionParameters));
+			.Queue(
+				GetPriority(),
+				ArrayView<const EncodedCommandBufferView, uint16>(submission.m_encodedCommandBuffer),
+				Move(submissionParameters)
+			);
 	}
 
 	[[nodiscard]] bool Stage::IsSubmissionFinishedSemaphoreUsable() const
@@ -97,6 +97,7 @@ namespace ngine::Rendering
 			}
 
 			m_renderItemInfo[renderItemIdentifier] = RenderItemInfo{visibleInstanceGroupIdentifier.GetIndex(), instanceIndex};
+			instanceGroup.SetInstanceRenderItem(instanceIndex, renderItemIdentifier);
 			m_instanceCount++;
 
 			addedRenderItems.Set(renderItemIdentifier);
@@ -167,6 +168,7 @@ namespace ngine::Rendering
 			}
 
 			m_renderItemInfo[renderItemIdentifier] = RenderItemInfo{visibleInstanceGroupIdentifier.GetIndex(), instanceIndex};
+			instanceGroup.SetInstanceRenderItem(instanceIndex, renderItemIdentifier);
 
 			addedRenderItems.Set(renderItemIdentifier);
 		}
@@ -211,7 +213,6 @@ namespace ngine::Rendering
 					instanceGroup,
 					visibleInstanceGroupIdentifier,
 					renderItemInfo,
-					scene,
 					graphicsCommandEncoder,
 					perFrameStagingBuffer
 				);
@@ -371,7 +372,6 @@ namespace ngine::Rendering
 		InstanceGroup& instanceGroup,
 		const VisibleInstanceGroupIdentifier instanceGroupIdentifier,
 		RenderItemInfo& renderItemInfo,
-		SceneBase& scene,
 		const CommandEncoderView graphicsCommandEncoder,
 		PerFrameStagingBuffer& perFrameStagingBuffer
 	)
@@ -390,10 +390,6 @@ namespace ngine::Rendering
 			}
 			break;
 			case InstanceBuffer::RemovalResult::RemovedFrontInstance:
-			{
-				renderItemInfo.m_visibleInstanceGroupIdentifierIndex = VisibleInstanceGroupIdentifier::Invalid;
-			}
-			break;
 			case InstanceBuffer::RemovalResult::RemovedBackInstance:
 			{
 				renderItemInfo.m_visibleInstanceGroupIdentifierIndex = VisibleInstanceGroupIdentifier::Invalid;
@@ -403,37 +399,28 @@ namespace ngine::Rendering
 			{
 				renderItemInfo.m_visibleInstanceGroupIdentifierIndex = VisibleInstanceGroupIdentifier::Invalid;
 
+				// Move the last instance to the now unused index
 				const InstanceBuffer::InstanceIndexType lastInstanceIndex = instanceGroup.m_instanceBuffer.GetFirstInstanceIndex() +
 				                                                            instanceGroup.m_instanceBuffer.GetInstanceCount();
-				// Move the last instance to the now unused index
-				const RenderItems::DynamicView renderItems = scene.GetValidRenderItemView(m_renderItemInfo.GetView());
-				for (RenderItemInfo& otherRenderItemInfo : renderItems)
-				{
-					if (otherRenderItemInfo.m_visibleInstanceGroupIdentifierIndex != instanceGroupIdentifier.GetIndex())
-					{
-						continue;
-					}
-
-					const InstanceBuffer::InstanceIndexType previousInstanceIndex = otherRenderItemInfo.m_instanceIndex;
-					if (previousInstanceIndex == lastInstanceIndex)
-					{
-						const InstanceBuffer::InstanceIndexType newInstanceIndex = renderItemInfo.m_instanceIndex;
-						otherRenderItemInfo.m_instanceIndex = newInstanceIndex;
-
-						instanceGroup.m_instanceBuffer.MoveElement(
-							lastInstanceIndex,
-							otherRenderItemInfo.m_instanceIndex,
-							graphicsCommandEncoder,
-							sizeof(InstanceGroup::IdentifierIndexType),
-							perFrameStagingBuffer
-						);
-
-						return;
-					}
-				}
+				const InstanceBuffer::InstanceIndexType newInstanceIndex = renderItemInfo.m_instanceIndex;
+				const Entity::RenderItemIdentifier movedRenderItemIdentifier = instanceGroup.m_instanceRenderItems[lastInstanceIndex];
+				RenderItemInfo& movedRenderItemInfo = m_renderItemInfo[movedRenderItemIdentifier];
+				Assert(
+					(movedRenderItemInfo.m_visibleInstanceGroupIdentifierIndex == instanceGroupIdentifier.GetIndex()) &
+					(movedRenderItemInfo.m_instanceIndex == lastInstanceIndex)
+				);
+				movedRenderItemInfo.m_instanceIndex = newInstanceIndex;
+				instanceGroup.SetInstanceRenderItem(newInstanceIndex, movedRenderItemIdentifier);
 
-				Assert(false, "Removing instance that could not be found in instance group!");
+				instanceGroup.m_instanceBuffer.MoveElement(
+					lastInstanceIndex,
+					newInstanceIndex,
+					graphicsCommandEncoder,
+					sizeof(InstanceGroup::IdentifierIndexType),
+					perFrameStagingBuffer
+				);
 			}
+			break;
 		}
 	}
 
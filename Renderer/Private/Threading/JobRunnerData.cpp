@@ -179,6 +179,13 @@ namespace ngine::Rendering
 		return isProcessingFrame;
 	}
 
+	bool JobRunnerData::PerFrameData::AtomicState::IsAwaitingCpuFinish() const
+	{
+		State state;
+		state.m_value = m_value.Load();
+		return state.m_data.m_stateFlags.IsSet(FrameStateFlags::AwaitingCpuFinish);
+	}
+
 	void JobRunnerData::PerFrameData::AtomicState::FinishFrame()
 	{
 		uint64 previousValue = m_value.Load();
@@ -494,26 +501,72 @@ namespace ngine::Rendering
 		OnFinishFrameGpuWork(logicalDeviceIdentifier, frameIndex);
 	}
 
-	void JobRunnerData::AwaitFrameFinish(const LogicalDeviceIdentifier logicalDeviceIdentifier, const uint8 frameIndex)
+	void JobRunnerData::AwaitFramesFinishInternal(LogicalDeviceData& logicalDeviceData, const uint8 frameMask)
 	{
-		const Optional<LogicalDeviceData*> pLogicalDeviceData = m_logicalDeviceData[logicalDeviceIdentifier].Get();
-		if (pLogicalDeviceData.IsValid())
+		const auto isProcessingFrames = [&logicalDeviceData, frameMask]()
 		{
-			PerFrameData& __restrict perFrameData = pLogicalDeviceData->m_perFrameData[frameIndex];
-
-			if (const Optional<Threading::JobRunnerThread*> pCurrentThread = Threading::JobRunnerThread::GetCurrent())
+			for (const uint8 frameIndex : Memory::GetSetBitsIterator(frameMask))
+			{
+				if (logicalDeviceData.m_perFrameData[frameIndex].m_state.IsProcessingFrameOrAwaitingReset())
+				{
+					return true;
+				}
+			}
+			return false;
+		};
+		const auto isAwaitingCpuFinish = [&logicalDeviceData, frameMask]()
+		{
+			for (const uint8 frameIndex : Memory::GetSetBitsIterator(frameMask))
 			{
-				while (perFrameData.m_state.IsProcessingFrameOrAwaitingReset())
+				if (logicalDeviceData.m_perFrameData[frameIndex].m_state.IsAwaitingCpuFinish())
 				{
-					pCurrentThread->DoRunNextJob();
-					// TODO: condition variable here?
+					return true;
 				}
 			}
-			else
+			return false;
+		};
+
+		const Optional<Threading::JobRunnerThread*> pCurrentThread = Threading::JobRunnerThread::GetCurrent();
+		// Finishing a frame is executed on the owning runner, so it has to keep processing its jobs
+		const bool isOwningThread = GetRunnerThread().IsExecutingOnThread();
+		while (isProcessingFrames())
+		{
+			// CPU work can depend on any job, so help out rather than risk parking the thread it was queued on
+			if (pCurrentThread.IsValid() && (isOwningThread || isAwaitingCpuFinish()))
 			{
-				while (perFrameData.m_state.IsProcessingFrameOrAwaitingReset())
-					;
+				pCurrentThread->DoRunNextJob();
+				continue;
 			}
+
+			// Only GPU work remains, which is signaled from the fence await thread and finished on the owning runner
+			logicalDeviceData.m_frameFinishedWaiterCount.FetchAdd(1);
+			{
+				Threading::UniqueLock lock(logicalDeviceData.m_frameFinishedMutex);
+				if (isProcessingFrames() && (pCurrentThread.IsInvalid() || !isAwaitingCpuFinish()))
+				{
+					logicalDeviceData.m_frameFinishedConditionVariable.Wait(lock);
+				}
+			}
+			logicalDeviceData.m_frameFinishedWaiterCount.FetchSubtract(1);
+		}
+	}
+
+	void JobRunnerData::NotifyFrameFinished(LogicalDeviceData& logicalDeviceData)
+	{
+		// Waiters register before checking the frame state, so a waiter that missed the finished state is guaranteed to be seen here
+		if (logicalDeviceData.m_frameFinishedWaiterCount.Load() > 0)
+		{
+			Threading::UniqueLock lock(logicalDeviceData.m_frameFinishedMutex);
+			logicalDeviceData.m_frameFinishedConditionVariable.NotifyAll();
+		}
+	}
+
+	void JobRunnerData::AwaitFrameFinish(const LogicalDeviceIdentifier logicalDeviceIdentifier, const uint8 frameIndex)
+	{
+		const Optional<LogicalDeviceData*> pLogicalDeviceData = m_logicalDeviceData[logicalDeviceIdentifier].Get();
+		if (pLogicalDeviceData.IsValid())
+		{
+			AwaitFramesFinishInternal(*pLogicalDeviceData, uint8(1u << frameIndex));
 		}
 	}
 
@@ -534,27 +587,7 @@ namespace ngine::Rendering
 		const Optional<LogicalDeviceData*> pLogicalDeviceData = m_logicalDeviceData[logicalDeviceIdentifier].Get();
 		if (pLogicalDeviceData.IsValid())
 		{
-			if (const Optional<Threading::JobRunnerThread*> pCurrentThread = Threading::JobRunnerThread::GetCurrent())
-			{
-				for (const uint8 frameIndex : Memory::GetSetBitsIterator(frameMask))
-				{
-					PerFrameData& __restrict perFrameData = pLogicalDeviceData->m_perFrameData[frameIndex];
-					while (perFrameData.m_state.IsProcessingFrameOrAwaitingReset())
-					{
-						pCurrentThread->DoRunNextJob();
-						// TODO: condition variable here?
-					}
-				}
-			}
-			else
-			{
-				for (const uint8 frameIndex : Memory::GetSetBitsIterator(frameMask))
-				{
-					PerFrameData& __restrict perFrameData = pLogicalDeviceData->m_perFrameData[frameIndex];
-					while (perFrameData.m_state.IsProcessingFrameOrAwaitingReset())
-						;
-				}
-			}
+			AwaitFramesFinishInternal(*pLogicalDeviceData, frameMask);
 		}
 	}
 
@@ -691,7 +724,7 @@ namespace ngine::Rendering
 			perFrameData.m_queueMutexes[(uint8)queueType].LockExclusive();
 		}
 		Rendering::Window::QueueOnWindowThread(
-			[&perFrameData, queue = Move(perFrameData.m_queue), &logicalDeviceData, &logicalDevice]() mutable
+			[this, &perFrameData, queue = Move(perFrameData.m_queue), &logicalDeviceData, &logicalDevice]() mutable
 			{
 				for (PerFrameQueue::Type queueType = PerFrameQueue::Type::First; queueType != PerFrameQueue::Type::End; ++queueType)
 				{
@@ -707,6 +740,7 @@ namespace ngine::Rendering
 				}
 
 				perFrameData.m_state.FinishFrame();
+				NotifyFrameFinished(logicalDeviceData);
 			}
 		);
 #else
@@ -720,6 +754,7 @@ namespace ngine::Rendering
 		}
 
 		perFrameData.m_state.FinishFrame();
+		NotifyFrameFinished(logicalDeviceData);
 #endif
 	}
 
@@ -1,5 +1,6 @@
 #if PLATFORM_APPLE_IOS || PLATFORM_APPLE_VISIONOS || PLATFORM_APPLE_MACOS
 #include <Engine/Engine.h>
+#include <Engine/Resource/ResourceManager.h>
 
 #include <Renderer/Window/Window.h>
 #include <Renderer/Window/iOS/MetalView.h>
@@ -302,6 +303,10 @@ ASAuthorizationAppleIDProvider* appleIDProvider = nil;
 {
 	[super didReceiveMemoryWarning];
 	// Dispose of any resources that can be recreated.
+	if (const ngine::Optional<ngine::Resource::Manager*> pResourceManager = ngine::System::Find<ngine::Resource::Manager>())
+	{
+		pResourceManager->OnMemoryRunningLow();
+	}
 }
 #endif
 
@@ -226,7 +226,8 @@ namespace ngine::Rendering
 					(size)memoryRequirements.size,
 					(uint32)memoryRequirements.alignment,
 					memoryTypeIndex,
-					MemoryFlags::DeviceLocal
+					MemoryFlags::DeviceLocal,
+					DeviceMemoryPool::ResourceTiling::Optimal
 				);
 #endif
 				if (LIKELY(m_deviceMemoryAllocation.IsValid()))
@@ -269,8 +270,14 @@ namespace ngine::Rendering
 		const MTLSizeAndAlign sizeAndAlign = [(id<MTLDevice>)logicalDevice heapTextureSizeAndAlignWithDescriptor:textureDescriptor];
 
 		const uint8 memoryTypeIndex = physicalDevice.GetMemoryTypeIndex(MemoryFlags::DeviceLocal);
-		m_deviceMemoryAllocation =
-			memoryPool.Allocate(logicalDevice, sizeAndAlign.size, (uint32)sizeAndAlign.align, memoryTypeIndex, MemoryFlags::DeviceLocal);
+		m_deviceMemoryAllocation = memoryPool.Allocate(
+			logicalDevice,
+			sizeAndAlign.size,
+			(uint32)sizeAndAlign.align,
+			memoryTypeIndex,
+			MemoryFlags::DeviceLocal,
+			DeviceMemoryPool::ResourceTiling::Optimal
+		);
 
 		id<MTLTexture> texture = [(id<MTLHeap>)m_deviceMemoryAllocation.m_memory
 			newTextureWithDescriptor:(MTLTextureDescriptor*)textureDescriptor
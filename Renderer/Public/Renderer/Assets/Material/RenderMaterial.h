@@ -2,6 +2,7 @@
 
 #include <Common/Math/ForwardDeclarations/Matrix4x4.h>
 #include <Common/Math/Primitives/ForwardDeclarations/Rectangle.h>
+#include <Common/Math/Range.h>
 #include <Common/EnumFlags.h>
 #include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Memory/UniquePtr.h>
@@ -13,6 +14,7 @@
 
 #include <Renderer/Assets/Material/MaterialInstanceIdentifier.h>
 #include <Renderer/Constants.h>
+#include <Renderer/Index.h>
 #include <Renderer/Pipelines/GraphicsPipeline.h>
 #include <Renderer/Pipelines/PushConstantRange.h>
 #include <Renderer/Descriptors/DescriptorSetLayout.h>
@@ -61,7 +63,24 @@ namespace ngine::Rendering
 			const Rendering::RenderMeshView mesh,
 			const BufferView instanceBuffer,
 			const RenderMaterialInstance& materialInstance,
-			const Rendering::RenderCommandEncoderView renderCommandEncoder
+			const Rendering::RenderCommandEncoderView renderCommandEncoder,
+			const ArrayView<const Math::Range<Index>, Index> indexRanges = {}
+		) const;
+		//! Binds the descriptor set of a material instance, draws of the same instance only need to bind it once
+		void BindMaterialInstance(
+			const RenderMaterialInstance& materialInstance, const Rendering::RenderCommandEncoderView renderCommandEncoder
+		) const;
+		//! Draws the mesh with arguments read from an indirect buffer, expects the material instance to have been bound
+		//! Index ranges in the arguments are relative to the mesh's first index, instances are relative to the first instance index.
+		void DrawIndexedIndirect(
+			const uint32 firstInstanceIndex,
+			const uint32 instanceCount,
+			const Rendering::RenderMeshView mesh,
+			const BufferView instanceBuffer,
+			const Rendering::RenderCommandEncoderView renderCommandEncoder,
+			const BufferView indirectBuffer,
+			const uint64 indirectBufferOffset,
+			const uint32 drawCount
 		) const;
 
 		[[nodiscard]] const RuntimeMaterial& GetMaterial() const
@@ -84,6 +103,7 @@ namespace ngine::Rendering
 			const DescriptorSetLayoutView viewInfoDescriptorSetLayout,
 			const DescriptorSetLayoutView transformBufferDescriptorSetLayout
 		);
+		void PrepareForResize(const LogicalDeviceView logicalDevice);
 		[[nodiscard]] Threading::JobBatch CreatePipeline(
 			Rendering::LogicalDevice& logicalDevice,
 			Rendering::ShaderCache& shaderCache,
@@ -97,6 +117,18 @@ namespace ngine::Rendering
 		{
 			return m_pushConstantRanges.GetView();
 		}
+	protected:
+		void BindMeshBuffers(
+			const uint32 firstInstanceIndex,
+			const uint32 instanceCount,
+			const Rendering::RenderMeshView mesh,
+			const BufferView instanceBuffer,
+			const Rendering::RenderCommandEncoderView renderCommandEncoder
+		) const;
+		//! Binds the full precision texture coordinates variant if the mesh requires it, returns whether it was bound
+		[[nodiscard]] bool BindTextureCoordinatePipeline(
+			const Rendering::RenderMeshView mesh, const Rendering::RenderCommandEncoderView renderCommandEncoder
+		) const;
 	protected:
 		using PushConstantRangeContainer = FixedCapacityVector<PushConstantRange, uint8>;
 	protected:
@@ -104,6 +136,8 @@ namespace ngine::Rendering
 		ReferenceWrapper<const RuntimeMaterial> m_material;
 		Threading::Mutex m_descriptorLoadingMutex;
 		PushConstantRangeContainer m_pushConstantRanges;
+		//! Variant reading texture coordinates at full precision, only created if the material reads them
+		GraphicsPipeline m_fullPrecisionTextureCoordinatesPipeline;
 		TIdentifierArray<UniquePtr<RenderMaterialInstance>, MaterialInstanceIdentifier> m_materialInstances{Memory::Zeroed};
 		Threading::AtomicIdentifierMask<MaterialInstanceIdentifier> m_loadingMaterialInstances;
 
@@ -95,6 +95,9 @@ namespace ngine::Rendering
 		}
 
 		[[nodiscard]] bool IsValid() const;
+
+		//! Reports the resolution that the instance's textures are rendered at to texture streaming
+		void ReportTextureUsage(LogicalDevice& logicalDevice, const uint32 resolution) const;
 	protected:
 		EventCallbackResult OnTextureLoadedAsync(
 			LogicalDevice& logicalDevice,
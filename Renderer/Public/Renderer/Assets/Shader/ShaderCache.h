@@ -103,6 +103,8 @@ namespace ngine::Rendering
 		virtual void OnAssetModified(const Asset::Guid assetGuid, const IdentifierType identifier, const IO::PathView filePath) override;
 
 		[[nodiscard]] IO::Path GetShaderCacheFilePath() const;
+		//! Whether previously saved pipeline cache data was produced by this device and driver
+		[[nodiscard]] bool IsPipelineCacheCompatible(const ConstByteView pipelineCacheData) const;
 	protected:
 #if RENDERER_VULKAN
 		VkPipelineCache m_pPipelineCache = 0;
@@ -14,6 +14,7 @@
 #include <Common/Threading/AtomicPtr.h>
 #include <Common/EnumFlagOperators.h>
 #include <Engine/Asset/AssetType.h>
+#include <Engine/Resource/ResourceManager.h>
 
 #include <Renderer/Devices/LogicalDeviceIdentifier.h>
 #include <Renderer/Constants.h>
@@ -76,7 +77,7 @@ namespace ngine::Rendering
 	};
 	ENUM_FLAG_OPERATORS(MeshLoadFlags);
 
-	struct MeshCache final : public Asset::Type<StaticMeshIdentifier, StaticMeshInfo>
+	struct MeshCache final : public Asset::Type<StaticMeshIdentifier, StaticMeshInfo>, public Resource::Handler
 	{
 		using BaseType = Type;
 
@@ -115,6 +116,11 @@ namespace ngine::Rendering
 		void OnMeshLoaded(const StaticMeshIdentifier identifier);
 		void OnMeshLoadingFailed(const StaticMeshIdentifier identifier);
 
+		//! Pins the CPU data of a mesh loaded from disk so that the resource manager can't evict it while it is read
+		//! Requests the data again if it had been evicted, callers check StaticMesh::IsLoaded after acquiring and wait or load if it isn't
+		void AcquireMeshData(const StaticMeshIdentifier identifier);
+		void ReleaseMeshData(const StaticMeshIdentifier identifier);
+
 		enum class LoadedMeshFlags : uint8
 		{
 			IsDummy = 1 << 0
@@ -186,6 +192,14 @@ namespace ngine::Rendering
 
 		void CreateProceduralMeshes();
 
+		//! Registers the CPU data of a mesh loaded from disk with the resource manager, procedural meshes and clones can't be reloaded
+		void RegisterMeshResource(const StaticMeshIdentifier identifier);
+		void DeregisterMeshResource(const StaticMeshIdentifier identifier);
+		void ReportMeshResourceLoaded(const StaticMeshIdentifier identifier);
+
+		virtual void Unload(const Resource::Identifier resourceIdentifier) override;
+		virtual void Reload(const Resource::Identifier resourceIdentifier) override;
+
 		friend struct LoadStaticMeshPerLogicalDeviceDataJob;
 
 		struct MeshData
@@ -197,9 +211,14 @@ namespace ngine::Rendering
 		[[nodiscard]] Threading::JobBatch ReloadRenderMeshData(const StaticMeshIdentifier identifier, LogicalDevice& logicalDevice);
 	protected:
 		Threading::AtomicIdentifierMask<StaticMeshIdentifier> m_loadingMeshes;
+		//! Meshes requested while another thread held their loading flag
+		Threading::AtomicIdentifierMask<StaticMeshIdentifier> m_awaitingLoadMeshes;
 
 		TIdentifierArray<Threading::Atomic<MeshData*>, StaticMeshIdentifier> m_meshData{Memory::Zeroed};
 
+		TIdentifierArray<Resource::Identifier, StaticMeshIdentifier> m_meshResourceIdentifiers;
+		TIdentifierArray<StaticMeshIdentifier, Resource::Identifier> m_resourceMeshIdentifiers;
+
 		ProceduralMeshCache m_proceduralMeshCache;
 
 		struct PerLogicalDeviceData
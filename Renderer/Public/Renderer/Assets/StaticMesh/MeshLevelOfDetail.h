@@ -0,0 +1,95 @@
+#pragma once
+
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/ForwardDeclarations/Vector.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+#include <Renderer/Index.h>
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
+
+namespace ngine::Rendering
+{
+	//! Maximum number of levels of detail per mesh, including the full detail level
+	inline static constexpr uint8 MaximumLevelOfDetailCount = 4;
+
+	//! Range of a mesh's index buffer rendering one level of detail, all levels share the same vertices
+	struct MeshLevelOfDetail
+	{
+		Index m_firstIndex;
+		Index m_indexCount;
+		//! Maximum distance of a vertex from its simplified location, relative to the mesh's bounding radius
+		float m_error;
+	};
+
+	//! Render items are grouped by their projected radius relative to half the view height
+	//! Class zero covers radii above one half, each following class covers half the radius of the previous one
+	inline static constexpr uint8 ScreenSizeClassCount = 8;
+	//! Screen-space error relative to half the view height that is tolerated when picking a simplified level of detail
+	inline static constexpr float MaximumLevelOfDetailScreenError = 1.f / 1024.f;
+
+	//! Fraction of a class boundary an item has to move past before leaving its current class
+	//! Avoids regrouping items, and switching their level of detail, every frame when they hover around a boundary
+	inline static constexpr float ScreenSizeClassHysteresis = 0.125f;
+
+	[[nodiscard]] inline uint8 GetScreenSizeClass(const float projectedRadius)
+	{
+		uint8 screenSizeClass = 0;
+		for (float classMaximum = 0.5f; (projectedRadius <= classMaximum) & (screenSizeClass < ScreenSizeClassCount - 1); classMaximum *= 0.5f)
+		{
+			screenSizeClass++;
+		}
+		return screenSizeClass;
+	}
+
+	//! Gets the screen size class of an item that was previously in the specified class
+	//! The previous class is kept until the projected radius leaves its range widened by ScreenSizeClassHysteresis
+	[[nodiscard]] inline uint8 GetScreenSizeClass(const float projectedRadius, const uint8 previousScreenSizeClass)
+	{
+		const float classMaximum = 1.f / float(1u << previousScreenSizeClass);
+		const float classMinimum = classMaximum * 0.5f;
+		const bool exceedsClass = (previousScreenSizeClass > 0) & (projectedRadius > classMaximum * (1.f + ScreenSizeClassHysteresis));
+		const bool subceedsClass = (previousScreenSizeClass < ScreenSizeClassCount - 1) &
+		                           (projectedRadius <= classMinimum * (1.f - ScreenSizeClassHysteresis));
+		if (exceedsClass | subceedsClass)
+		{
+			return GetScreenSizeClass(projectedRadius);
+		}
+		return previousScreenSizeClass;
+	}
+
+	//! Picks the coarsest level of detail whose error stays below the tolerated error at the largest size of the screen size class
+	//! Includes the hysteresis, as items can stay in a class while slightly larger than its range
+	[[nodiscard]] inline uint8
+	SelectLevelOfDetail(const ArrayView<const MeshLevelOfDetail, uint8> levelsOfDetail, const uint8 screenSizeClass)
+	{
+		if (screenSizeClass == 0)
+		{
+			return 0;
+		}
+
+		const float maximumProjectedRadius = (1.f + ScreenSizeClassHysteresis) / float(1u << screenSizeClass);
+		uint8 selectedLevel = 0;
+		for (uint8 level = 1, levelCount = levelsOfDetail.GetSize(); level < levelCount; ++level)
+		{
+			if (levelsOfDetail[level].m_error * maximumProjectedRadius > MaximumLevelOfDetailScreenError)
+			{
+				break;
+			}
+			selectedLevel = level;
+		}
+		return selectedLevel;
+	}
+
+	namespace MeshSimplification
+	{
+		//! Simplifies a triangle list by clustering vertices in a uniform grid and collapsing each cluster onto its most central vertex
+		//! The grid is made as fine as possible while producing at most targetIndexCount indices, referencing the original vertices
+		//! Returns the error of the resulting indices, relative to the bounding radius of the vertices
+		[[nodiscard]] float Generate(
+			const ArrayView<const VertexPosition, Index> vertexPositions,
+			const ArrayView<const Index, Index> indices,
+			const Index targetIndexCount,
+			Vector<Index, Index>& indicesOut
+		);
+	}
+}
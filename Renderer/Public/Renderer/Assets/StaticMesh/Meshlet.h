@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/ForwardDeclarations/Vector.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Range.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+#include <Renderer/Index.h>
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
+
+namespace ngine::Rendering
+{
+	//! Cluster of neighbouring triangles covering a contiguous range of one of a mesh's levels of detail
+	//! Bounds are stored in mesh space so that a meshlet can be culled as a whole
+	struct Meshlet
+	{
+		inline static constexpr Index MaximumVertexCount = 64;
+		inline static constexpr Index MaximumTriangleCount = 124;
+
+		//! Checks whether all triangles of the meshlet face away from the specified location, in mesh space
+		[[nodiscard]] bool IsBackFacing(const Math::Vector3f viewLocation) const
+		{
+			const Math::Vector3f toCenter = (Math::Vector3f)m_center - viewLocation;
+			return toCenter.Dot((Math::Vector3f)m_coneAxis) >= m_coneCutoff * toCenter.GetLength() + m_radius;
+		}
+
+		Index m_firstIndex;
+		Index m_indexCount;
+		Math::UnalignedVector3<float> m_center;
+		float m_radius;
+		//! Average front facing normal of the meshlet's triangles
+		Math::UnalignedVector3<float> m_coneAxis;
+		//! Sine of the largest angle between a triangle normal and the cone axis, one if the meshlet can never be back facing
+		float m_coneCutoff;
+	};
+
+	namespace Meshlets
+	{
+		//! Reorders the triangles of a triangle list by spatial locality and splits them into meshlets, each covering a contiguous index range
+		//! The triangles are kept as-is, only their order changes
+		void Build(
+			const ArrayView<const VertexPosition, Index> vertexPositions, const ArrayView<Index, Index> indices, Vector<Meshlet, Index>& meshletsOut
+		);
+
+		//! Gets the meshlets within the specified index range, expects meshlets sorted by their first index
+		[[nodiscard]] ArrayView<const Meshlet, Index>
+		GetMeshletsInRange(const ArrayView<const Meshlet, Index> meshlets, const Index firstIndex, const Index indexCount);
+
+		//! Merges the sorted, non-overlapping ranges separated by the smallest gaps until at most maximumRangeCount remain
+		//! Drawing the indices in a few small gaps is cheaper than recording a draw per range
+		void MergeRanges(Vector<Math::Range<Index>, Index>& ranges, const Index maximumRangeCount);
+	}
+}
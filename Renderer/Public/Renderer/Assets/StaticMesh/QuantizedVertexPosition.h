@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
+
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering
+{
+	//! Vertex position stored as 16-bit unsigned normalized coordinates within the bounds of the mesh
+	struct QuantizedVertexPosition
+	{
+		uint16 x, y, z;
+	};
+
+	//! Maps positions within the specified bounds to and from quantized positions
+	struct PositionQuantization
+	{
+		inline static constexpr float MaximumValue = 65535.f;
+
+		PositionQuantization(const Math::Vector3f minimum, const Math::Vector3f maximum)
+			: m_minimum(minimum)
+			, m_step((maximum - minimum) / MaximumValue)
+		{
+		}
+
+		[[nodiscard]] QuantizedVertexPosition Quantize(const VertexPosition position) const
+		{
+			return QuantizedVertexPosition{
+				Quantize(position.x, m_minimum.x, m_step.x),
+				Quantize(position.y, m_minimum.y, m_step.y),
+				Quantize(position.z, m_minimum.z, m_step.z)
+			};
+		}
+
+		[[nodiscard]] VertexPosition Dequantize(const QuantizedVertexPosition position) const
+		{
+			return m_minimum + Math::Vector3f{(float)position.x, (float)position.y, (float)position.z} * m_step;
+		}
+
+		//! Largest distance on any axis between a position within the bounds and its dequantized position
+		[[nodiscard]] float GetMaximumError() const
+		{
+			return Math::Max(m_step.x, Math::Max(m_step.y, m_step.z)) * 0.5f;
+		}
+	protected:
+		[[nodiscard]] static uint16 Quantize(const float value, const float minimum, const float step)
+		{
+			return step > 0.f ? (uint16)Math::Min(Math::Max((value - minimum) / step + 0.5f, 0.f), MaximumValue) : uint16(0);
+		}
+	protected:
+		Math::Vector3f m_minimum;
+		Math::Vector3f m_step;
+	};
+}
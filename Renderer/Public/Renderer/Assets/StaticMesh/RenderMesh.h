@@ -2,10 +2,15 @@
 
 #include "RenderMeshView.h"
 
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexTextureCoordinate.h>
+
 #include <Renderer/Buffers/VertexBuffer.h>
 #include <Renderer/Buffers/IndexBuffer.h>
 
 #include <Common/Memory/Containers/ForwardDeclarations/ByteView.h>
+#include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Memory/Containers/Vector.h>
 
 namespace ngine
 {
@@ -29,6 +34,7 @@ namespace ngine::Rendering
 	struct RenderMeshView;
 	struct CommandEncoderView;
 	struct StagingBuffer;
+	struct VertexNormals;
 
 	struct RenderMesh
 	{
@@ -49,9 +55,13 @@ namespace ngine::Rendering
 			LogicalDevice& logicalDevice,
 			const CommandEncoderView transferCommandBuffer,
 			const CommandEncoderView graphicsCommandEncoder,
-			const Index vertexCount,
-			ConstByteView vertexData,
+			ArrayView<const VertexPosition, Index> vertexPositions,
+			ArrayView<const VertexNormals, Index> vertexNormals,
+			ArrayView<const VertexTextureCoordinate, Index> vertexTextureCoordinates,
 			ArrayView<const Index, Index> indices,
+			ArrayView<const MeshLevelOfDetail, uint8> simplifiedLevelsOfDetail,
+			ArrayView<const Index, Index> levelOfDetailIndices,
+			ArrayView<const Meshlet, Index> meshlets,
 			StagingBuffer& stagingBufferOut,
 			const bool allowCpuAccess = false
 		);
@@ -94,10 +104,23 @@ namespace ngine::Rendering
 		{
 			return m_vertexBuffer.IsValid();
 		}
+		//! Format of the texture coordinates in the vertex buffer, see RenderVertexLayout
+		[[nodiscard]] TextureCoordinateFormat GetTextureCoordinateFormat() const
+		{
+			return m_textureCoordinateFormat;
+		}
 
 		[[nodiscard]] operator RenderMeshView() const
 		{
-			return RenderMeshView{m_vertexBuffer, m_indexBuffer, m_vertexCount, m_indexCount};
+			return RenderMeshView{
+				m_vertexBuffer,
+				m_indexBuffer,
+				m_vertexCount,
+				m_indexCount,
+				m_levelsOfDetail.GetView(),
+				m_meshlets.GetView(),
+				m_textureCoordinateFormat
+			};
 		}
 
 		[[nodiscard]] size GetVertexBufferOffset() const
@@ -117,9 +140,15 @@ namespace ngine::Rendering
 			return m_indexBuffer.GetSize();
 		}
 	protected:
+		//! Declared first, as the vertex buffer size depends on it
+		TextureCoordinateFormat m_textureCoordinateFormat = TextureCoordinateFormat::Half;
 		VertexBuffer m_vertexBuffer;
 		IndexBuffer m_indexBuffer;
 		Index m_vertexCount;
 		Index m_indexCount;
+		//! Index ranges of each level of detail, starting with the full detail level
+		FlatVector<MeshLevelOfDetail, MaximumLevelOfDetailCount, uint8> m_levelsOfDetail;
+		//! Kept on the CPU to cull clusters of each level of detail before drawing
+		Vector<Meshlet, Index> m_meshlets;
 	};
 }
@@ -2,6 +2,11 @@
 
 #include <Renderer/Buffers/BufferView.h>
 #include <Renderer/Index.h>
+#include <Renderer/Assets/StaticMesh/MeshLevelOfDetail.h>
+#include <Renderer/Assets/StaticMesh/Meshlet.h>
+#include <Renderer/Assets/StaticMesh/RenderVertexLayout.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Assert/Assert.h>
 #include <Common/Platform/TrivialABI.h>
 
 namespace ngine::Rendering
@@ -16,6 +21,26 @@ namespace ngine::Rendering
 			, m_indexCount(indexCount)
 		{
 		}
+		RenderMeshView(
+			const BufferView vertexBuffer,
+			const BufferView indexBuffer,
+			const Index vertexCount,
+			const Index indexCount,
+			const ArrayView<const MeshLevelOfDetail, uint8> levelsOfDetail,
+			const ArrayView<const Meshlet, Index> meshlets = {},
+			const TextureCoordinateFormat textureCoordinateFormat = TextureCoordinateFormat::Half
+		)
+			: RenderMeshView(vertexBuffer, indexBuffer, vertexCount, indexCount)
+		{
+			m_textureCoordinateFormat = textureCoordinateFormat;
+			m_allMeshlets = meshlets;
+			m_meshlets = Meshlets::GetMeshletsInRange(meshlets, 0, indexCount);
+			Assert(levelsOfDetail.GetSize() <= MaximumLevelOfDetailCount);
+			for (const MeshLevelOfDetail& levelOfDetail : levelsOfDetail)
+			{
+				m_levelsOfDetail[m_levelOfDetailCount++] = levelOfDetail;
+			}
+		}
 
 		[[nodiscard]] bool IsValid() const
 		{
@@ -30,6 +55,11 @@ namespace ngine::Rendering
 		{
 			return m_indexBuffer;
 		}
+		//! First index in the index buffer to draw from
+		[[nodiscard]] Index GetFirstIndex() const
+		{
+			return m_firstIndex;
+		}
 		[[nodiscard]] Index GetIndexCount() const
 		{
 			return m_indexCount;
@@ -43,10 +73,56 @@ namespace ngine::Rendering
 		{
 			return m_indexCount / 3;
 		}
+		//! Format of the texture coordinates in the vertex buffer, see RenderVertexLayout
+		[[nodiscard]] TextureCoordinateFormat GetTextureCoordinateFormat() const
+		{
+			return m_textureCoordinateFormat;
+		}
+
+		//! Levels of detail stored in the index buffer, starting with the full detail level
+		[[nodiscard]] ArrayView<const MeshLevelOfDetail, uint8> GetLevelsOfDetail() const
+		{
+			return m_levelsOfDetail.GetView().GetSubView(0, m_levelOfDetailCount);
+		}
+
+		//! Meshlets of the level of detail drawn by this view, their first indices are relative to the start of the index buffer
+		[[nodiscard]] ArrayView<const Meshlet, Index> GetMeshlets() const
+		{
+			return m_meshlets;
+		}
+
+		//! Returns a view drawing the level of detail suited to render items of the specified screen size class
+		[[nodiscard]] RenderMeshView GetLevelOfDetailView(const uint8 screenSizeClass) const
+		{
+			if (m_levelOfDetailCount <= 1)
+			{
+				return *this;
+			}
+
+			const uint8 levelOfDetailIndex = SelectLevelOfDetail(GetLevelsOfDetail(), screenSizeClass);
+			if (levelOfDetailIndex == 0)
+			{
+				return *this;
+			}
+
+			const MeshLevelOfDetail& levelOfDetail = m_levelsOfDetail[levelOfDetailIndex];
+			RenderMeshView view = *this;
+			view.m_firstIndex = levelOfDetail.m_firstIndex;
+			view.m_indexCount = levelOfDetail.m_indexCount;
+			view.m_meshlets = Meshlets::GetMeshletsInRange(m_allMeshlets, levelOfDetail.m_firstIndex, levelOfDetail.m_indexCount);
+			return view;
+		}
 	protected:
 		BufferView m_vertexBuffer;
 		BufferView m_indexBuffer;
 		Index m_vertexCount = 0;
+		Index m_firstIndex = 0;
 		Index m_indexCount = 0;
+		TextureCoordinateFormat m_textureCoordinateFormat = TextureCoordinateFormat::Half;
+		uint8 m_levelOfDetailCount = 0;
+		Array<MeshLevelOfDetail, MaximumLevelOfDetailCount, uint8> m_levelsOfDetail;
+		//! Meshlets of all levels of detail, sorted by their first index
+		ArrayView<const Meshlet, Index> m_allMeshlets;
+		ArrayView<const Meshlet, Index> m_meshlets;
 	};
 }
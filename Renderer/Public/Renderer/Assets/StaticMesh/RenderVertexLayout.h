@@ -0,0 +1,76 @@
+#pragma once
+
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
+#include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexTextureCoordinate.h>
+#include <Renderer/Assets/StaticMesh/VertexNormals.h>
+#include <Renderer/Format.h>
+#include <Renderer/Index.h>
+
+#include <Common/Math/Half.h>
+#include <Common/Math/Vector2.h>
+#include <Common/Memory/Align.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering
+{
+	//! Texture coordinates as stored in render mesh vertex buffers at half precision, read by shaders as R16G16_SFLOAT
+	using HalfVertexTextureCoordinate = Math::UnalignedVector2<half>;
+
+	//! Format of the texture coordinates in a render mesh vertex buffer, chosen per mesh
+	enum class TextureCoordinateFormat : uint8
+	{
+		//! Two 32 bit floats, R32G32_SFLOAT
+		Full,
+		//! Two 16 bit floats, R16G16_SFLOAT
+		Half
+	};
+
+	//! Layout of render mesh vertex buffers
+	//! Positions are followed by the packed normals and the texture coordinates, each aligned to their element type
+	namespace RenderVertexLayout
+	{
+		//! Largest texture coordinate error accepted at half precision, a quarter texel of a 1024 texture
+		inline static constexpr float MaximumHalfTextureCoordinateError = 1.f / 4096.f;
+
+		//! Returns half precision if every coordinate stays within the tolerance, full precision otherwise
+		//! Coordinates accumulated along splines and roads exceed it quickly, as half precision only has 11 bits of mantissa
+		[[nodiscard]] inline TextureCoordinateFormat GetTextureCoordinateFormat(
+			const ArrayView<const VertexTextureCoordinate, Index> vertexTextureCoordinates
+		)
+		{
+			for (const VertexTextureCoordinate& __restrict textureCoordinates : vertexTextureCoordinates)
+			{
+				const Math::Vector2f decompressedCoordinate = (Math::Vector2f)(Math::Vector2h)textureCoordinates;
+				if (!decompressedCoordinate.IsEquivalentTo(textureCoordinates, MaximumHalfTextureCoordinateError))
+				{
+					return TextureCoordinateFormat::Full;
+				}
+			}
+			return TextureCoordinateFormat::Half;
+		}
+
+		[[nodiscard]] inline constexpr uint32 GetTextureCoordinateSize(const TextureCoordinateFormat format)
+		{
+			return format == TextureCoordinateFormat::Half ? sizeof(HalfVertexTextureCoordinate) : sizeof(VertexTextureCoordinate);
+		}
+		[[nodiscard]] inline constexpr Format GetTextureCoordinateVertexFormat(const TextureCoordinateFormat format)
+		{
+			return format == TextureCoordinateFormat::Half ? Format::R16G16_SFLOAT : Format::R32G32_SFLOAT;
+		}
+
+		[[nodiscard]] inline uint64 GetNormalsOffset(const Index vertexCount)
+		{
+			return Memory::Align(sizeof(VertexPosition) * vertexCount, alignof(VertexNormals));
+		}
+		//! Aligned for full precision coordinates, so the offset doesn't depend on the format
+		[[nodiscard]] inline uint64 GetTextureCoordinatesOffset(const Index vertexCount)
+		{
+			return Memory::Align(GetNormalsOffset(vertexCount) + sizeof(VertexNormals) * vertexCount, alignof(VertexTextureCoordinate));
+		}
+		[[nodiscard]] inline uint64 GetSize(const Index vertexCount, const TextureCoordinateFormat textureCoordinateFormat)
+		{
+			return GetTextureCoordinatesOffset(vertexCount) + GetTextureCoordinateSize(textureCoordinateFormat) * vertexCount;
+		}
+	}
+}
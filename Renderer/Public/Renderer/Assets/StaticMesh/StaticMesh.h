@@ -86,6 +86,18 @@ namespace ngine::Rendering
 		{
 			return m_object.GetIndices();
 		}
+		[[nodiscard]] ArrayView<const MeshLevelOfDetail, uint8> GetSimplifiedLevelsOfDetail() const LIFETIME_BOUND
+		{
+			return m_object.GetSimplifiedLevelsOfDetail();
+		}
+		[[nodiscard]] ArrayView<const Index, Index> GetSimplifiedLevelOfDetailIndices() const LIFETIME_BOUND
+		{
+			return m_object.GetSimplifiedLevelOfDetailIndices();
+		}
+		[[nodiscard]] ArrayView<const Meshlet, Index> GetMeshlets() const LIFETIME_BOUND
+		{
+			return m_object.GetMeshlets();
+		}
 
 		[[nodiscard]] bool IsLoaded() const
 		{
@@ -123,6 +135,14 @@ namespace ngine::Rendering
 			[[maybe_unused]] const bool wasSet = m_flags.TrySetFlags(Flags::FailedLoading);
 			Assert(wasSet);
 		}
+		//! Marks the CPU data as no longer available, readers that observe this have to load the mesh again
+		//! Returns false if the mesh was not loaded
+		[[nodiscard]] bool OnUnloaded()
+		{
+			return m_flags.TryClearFlags(Flags::WasLoaded);
+		}
+		//! Frees the CPU data of an unloaded mesh, keeping its bounding box so that culling is unaffected until it is reloaded
+		void ReleaseStaticObjectData();
 
 		[[nodiscard]] const Rendering::StaticObject& GetStaticObjectData() const
 		{
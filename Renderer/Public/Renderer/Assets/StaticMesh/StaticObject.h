@@ -3,6 +3,8 @@
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexPosition.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexTextureCoordinate.h>
 #include <Renderer/Assets/StaticMesh/ForwardDeclarations/VertexColors.h>
+#include <Renderer/Assets/StaticMesh/MeshLevelOfDetail.h>
+#include <Renderer/Assets/StaticMesh/Meshlet.h>
 #include <Renderer/Index.h>
 
 #include <Common/EnumFlagOperators.h>
@@ -13,6 +15,8 @@
 #include <Common/Math/CoreNumericTypes.h>
 #include <Common/Memory/Allocators/DynamicAllocator.h>
 #include <Common/Memory/Containers/ForwardDeclarations/ByteView.h>
+#include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Memory/Containers/Vector.h>
 
 namespace ngine::IO
 {
@@ -35,7 +39,9 @@ namespace ngine::Rendering
 		IsVertexColorSlotUsedFirst = 1 << 4,
 		IsVertexColorSlotUsedLast = IsVertexColorSlotUsedFirst << (MaximumVertexColorCountOnDisk - 1),
 		HasVertexColorSlotAlphaFirst = IsVertexColorSlotUsedLast << 1,
-		HasVertexColorSlotAlphaLast = HasVertexColorSlotAlphaFirst << (MaximumVertexColorCountOnDisk - 1)
+		HasVertexColorSlotAlphaLast = HasVertexColorSlotAlphaFirst << (MaximumVertexColorCountOnDisk - 1),
+		//! Positions are stored as 16-bit normalized coordinates within bounds written ahead of them
+		QuantizedPositions = HasVertexColorSlotAlphaLast << 1
 	};
 	ENUM_FLAG_OPERATORS(StaticObjectFlags);
 
@@ -95,9 +101,11 @@ namespace ngine::Rendering
 		using ChunkSizeType = uint16;
 
 		using VersionType = uint16;
-		inline static constexpr VersionType Version = 0u;
+		//! Version 1 appends simplified levels of detail after the bounds
+		//! Version 2 appends meshlets after the levels of detail, covering the full detail level and, when generated after them, the simplified levels
+		inline static constexpr VersionType Version = 2u;
 		inline static constexpr VersionType FirstCompatibleVersion = 0u;
-		inline static constexpr VersionType LastCompatibleVersion = 0u;
+		inline static constexpr VersionType LastCompatibleVersion = 2u;
 
 		using VertexPosition = Rendering::VertexPosition;
 		using VertexNormals = Rendering::VertexNormals;
@@ -114,6 +122,9 @@ namespace ngine::Rendering
 			, m_flags(other.m_flags)
 			, m_data(Move(other.m_data))
 			, m_boundingBox(other.m_boundingBox)
+			, m_levelsOfDetail(Move(other.m_levelsOfDetail))
+			, m_levelOfDetailIndices(Move(other.m_levelOfDetailIndices))
+			, m_meshlets(Move(other.m_meshlets))
 		{
 			other.m_vertexCount = 0;
 			other.m_indexCount = 0;
@@ -126,6 +137,9 @@ namespace ngine::Rendering
 			m_flags = Move(other.m_flags);
 			m_data = Move(other.m_data);
 			m_boundingBox = other.m_boundingBox;
+			m_levelsOfDetail = Move(other.m_levelsOfDetail);
+			m_levelOfDetailIndices = Move(other.m_levelOfDetailIndices);
+			m_meshlets = Move(other.m_meshlets);
 
 			other.m_vertexCount = 0;
 			other.m_indexCount = 0;
@@ -173,6 +187,9 @@ namespace ngine::Rendering
 			m_flags = flags;
 
 			Reserve(vertexCount, indexCount, GetUsedVertexColorSlotCount());
+			// The simplified indices and meshlets no longer match the new geometry
+			ClearLevelsOfDetail();
+			m_meshlets.Clear();
 		}
 
 		using Flags = StaticObjectFlags;
@@ -210,6 +227,36 @@ namespace ngine::Rendering
 		[[nodiscard]] PURE_LOCALS_AND_POINTERS ArrayView<Index, Index> GetIndices() LIFETIME_BOUND;
 		[[nodiscard]] PURE_LOCALS_AND_POINTERS ArrayView<const Index, Index> GetIndices() const LIFETIME_BOUND;
 
+		//! Simplified levels of detail, excluding the full detail level
+		//! Their index ranges start after the full detail indices, as they would be laid out in an index buffer
+		[[nodiscard]] ArrayView<const MeshLevelOfDetail, uint8> GetSimplifiedLevelsOfDetail() const LIFETIME_BOUND
+		{
+			return m_levelsOfDetail.GetView();
+		}
+		//! Indices of all simplified levels of detail, referencing the same vertices as the full detail indices
+		[[nodiscard]] ArrayView<const Index, Index> GetSimplifiedLevelOfDetailIndices() const LIFETIME_BOUND
+		{
+			return m_levelOfDetailIndices.GetView();
+		}
+		//! Generates simplified levels of detail from the full detail indices, each with roughly half the triangles of the previous one
+		void GenerateLevelsOfDetail();
+		void ClearLevelsOfDetail()
+		{
+			m_levelsOfDetail.Clear();
+			m_levelOfDetailIndices.Clear();
+			// Meshlets of the simplified levels are stored after the full detail ones
+			m_meshlets.Resize(Meshlets::GetMeshletsInRange(m_meshlets.GetView(), 0, m_indexCount).GetSize());
+		}
+
+		//! Meshlets of all levels of detail sorted by their first index, empty if none were generated
+		[[nodiscard]] ArrayView<const Meshlet, Index> GetMeshlets() const LIFETIME_BOUND
+		{
+			return m_meshlets.GetView();
+		}
+		//! Reorders the triangles of each level of detail into meshlets with bounds for culling
+		//! Generate levels of detail first, as doing so discards the meshlets of previous simplified levels
+		void GenerateMeshlets();
+
 		void TransformRotation(const Math::Quaternionf quaternion);
 
 		void WriteToFile(const IO::FileView outputFile) const;
@@ -232,5 +279,9 @@ namespace ngine::Rendering
 		AllocatorType m_data;
 
 		Math::BoundingBox m_boundingBox{Math::Radiusf(0.1_meters)};
+
+		FlatVector<MeshLevelOfDetail, MaximumLevelOfDetailCount - 1, uint8> m_levelsOfDetail;
+		Vector<Index, Index> m_levelOfDetailIndices;
+		Vector<Meshlet, Index> m_meshlets;
 	};
 }
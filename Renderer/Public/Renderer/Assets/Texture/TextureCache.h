@@ -16,6 +16,7 @@
 #include <Renderer/Wrappers/Sampler.h> // temp
 
 #include <Engine/Asset/AssetType.h>
+#include <Engine/Resource/ResourceManager.h>
 
 #include <Common/Memory/UniquePtr.h>
 #include <Common/Memory/Optional.h>
@@ -26,6 +27,7 @@
 #include <Common/Function/ThreadSafeEvent.h>
 #include <Common/Function/Function.h>
 #include <Common/Storage/AtomicIdentifierMask.h>
+#include <Common/Time/Timestamp.h>
 
 #include <Common/Threading/Mutexes/SharedMutex.h>
 #include <Common/Threading/AtomicPtr.h>
@@ -97,14 +99,19 @@ namespace ngine::Rendering
 	{
 		//! Assign a dummy texture if the requested one is not loaded yet (1, 1, 1, 0 if RGBA)
 		LoadDummy = 1 << 0,
+		//! The requester reports its usage through ReportTextureUsage, allowing streaming to keep fewer mips resident than requested
+		//! Textures requested without this flag stay fully resident
+		Streamed = 1 << 1,
 		Default = LoadDummy
 	};
 	ENUM_FLAG_OPERATORS(TextureLoadFlags);
 
-	struct TextureCache final : public Asset::Type<TextureIdentifier, TextureInfo>
+	struct TextureCache final : public Asset::Type<TextureIdentifier, TextureInfo>, public Resource::Handler
 	{
 		using BaseType = Type;
 
+		inline static constexpr uint64 DefaultStreamingBudget = 512ull * 1024ull * 1024ull;
+
 		[[nodiscard]] PURE_LOCALS_AND_POINTERS Renderer& GetRenderer();
 		[[nodiscard]] PURE_LOCALS_AND_POINTERS const Renderer& GetRenderer() const;
 
@@ -150,6 +157,14 @@ namespace ngine::Rendering
 		using TextureLoadListenerData = TextureLoadEvent::ListenerData;
 		using TextureLoadListenerIdentifier = TextureLoadEvent::ListenerIdentifier;
 
+		//! Notified when a texture was replaced by one without some of its previously loaded mips
+		using TextureEvictEvent = ThreadSafe::Event<
+			EventCallbackResult(void*, LogicalDevice& logicalDevice, const TextureIdentifier identifier, RenderTexture& texture, MipMask evictedMips),
+			96,
+			false>;
+		using TextureEvictListenerData = TextureEvictEvent::ListenerData;
+		using TextureEvictListenerIdentifier = TextureEvictEvent::ListenerIdentifier;
+
 		[[nodiscard]] Optional<Threading::Job*> GetOrLoadRenderTexture(
 			const LogicalDeviceIdentifier deviceIdentifier,
 			const TextureIdentifier identifier,
@@ -166,6 +181,14 @@ namespace ngine::Rendering
 			const TextureIdentifier identifier,
 			const TextureLoadListenerIdentifier listenerIdentifier
 		);
+		void AddRenderTextureEvictListener(
+			const LogicalDeviceIdentifier deviceIdentifier, const TextureIdentifier identifier, TextureEvictListenerData&& listenerData
+		);
+		bool RemoveRenderTextureEvictListener(
+			const LogicalDeviceIdentifier deviceIdentifier,
+			const TextureIdentifier identifier,
+			const TextureEvictListenerIdentifier listenerIdentifier
+		);
 		void
 		AssignRenderTexture(const LogicalDeviceIdentifier deviceIdentifier, const Rendering::TextureIdentifier identifier, RenderTexture&& texture, RenderTexture& previousTexture, const EnumFlags<LoadedTextureFlags>);
 		void
@@ -192,6 +215,43 @@ namespace ngine::Rendering
 			const PerDeviceTextureData& perDeviceTextureData = *perDeviceData.m_textureData[textureIdentifier];
 			return MipMask{perDeviceTextureData.m_requestedMips.Load()};
 		}
+		//! Stores the mips contained in the texture asset for the device's binary type
+		//! Render textures may only allocate a subset of them while streamed
+		void SetTextureAssetMips(const LogicalDeviceIdentifier deviceIdentifier, const TextureIdentifier textureIdentifier, const MipMask mips)
+		{
+			PerDeviceTextureData& perDeviceTextureData = *m_perLogicalDeviceData[deviceIdentifier]->m_textureData[textureIdentifier];
+			perDeviceTextureData.m_assetMips = mips.GetValue();
+		}
+
+		//! Streaming is disabled by default, keeping all requested mips resident
+		//! Should only be enabled once every user sampling material textures reports its usage
+		void SetStreamingEnabled(const bool enabled)
+		{
+			m_isStreamingEnabled = enabled;
+		}
+		[[nodiscard]] bool IsStreamingEnabled() const
+		{
+			return m_isStreamingEnabled;
+		}
+
+		//! Limits the estimated size of the mips that streaming keeps resident, see TextureStreaming::SelectResidentMips
+		void SetStreamingBudget(const uint64 budget)
+		{
+			m_streamingBudget = budget;
+		}
+		[[nodiscard]] uint64 GetStreamingBudget() const
+		{
+			return m_streamingBudget;
+		}
+		//! Notes that a texture was rendered at the specified resolution, opting it into streaming if enabled
+		//! Ignored for textures that any user requested without TextureLoadFlags::Streamed
+		//! Its resident mips are adjusted on the next streaming update
+		void ReportTextureUsage(const LogicalDeviceIdentifier deviceIdentifier, const TextureIdentifier identifier, const uint32 resolution);
+		//! Selects the resident mips of streamed textures from the usage reported since the last update
+		//! Textures whose largest resident mip changes are recreated at the new size by their loading job, releasing the memory of evicted mips
+		//! Calls made within the update interval of the previous one are ignored
+		void UpdateStreaming(LogicalDevice& logicalDevice);
+
 		[[nodiscard]] DescriptorSetLayoutView GetTexturesDescriptorSetLayout(const LogicalDeviceIdentifier deviceIdentifier) const
 		{
 			const PerLogicalDeviceData& perDeviceData = *m_perLogicalDeviceData[deviceIdentifier];
@@ -230,11 +290,23 @@ namespace ngine::Rendering
 
 		[[nodiscard]] TextureIdentifier RegisterAsset(const Asset::Guid guid);
 
+		//! Streamed textures are registered with the resource manager per device, evicting one drops it to its always resident mips
+		virtual void Unload(const Resource::Identifier resourceIdentifier) override;
+		virtual void Reload(const Resource::Identifier resourceIdentifier) override;
+		void DeregisterStreamedTextureResources(const TextureIdentifier identifier);
+
 		struct PerDeviceTextureData
 		{
 			TextureLoadEvent m_onLoadedCallback;
+			TextureEvictEvent m_onEvictedCallback;
 			EnumFlags<LoadedTextureFlags> m_flags;
 			Threading::Atomic<MipMask::StoredType> m_requestedMips;
+			//! Mips contained in the texture asset, zero until the first load validated them
+			Threading::Atomic<MipMask::StoredType> m_assetMips{0};
+			//! Largest resolution reported through ReportTextureUsage since the last streaming update
+			Threading::Atomic<uint32> m_streamingResolution{0};
+			//! Estimated size of the resident mips last reported to the resource manager
+			uint64 m_reportedStreamingSize{0};
 			ImageMapping m_mapping;
 		};
 
@@ -252,13 +324,40 @@ namespace ngine::Rendering
 
 			Threading::AtomicIdentifierMask<TextureIdentifier> m_loadingTextures;
 			TIdentifierArray<Threading::Atomic<PerDeviceTextureData*>, TextureIdentifier> m_textureData{Memory::Zeroed};
+
+			Threading::AtomicIdentifierMask<TextureIdentifier> m_streamedTextures;
+			//! Textures requested without TextureLoadFlags::Streamed, never reduced by streaming
+			Threading::AtomicIdentifierMask<TextureIdentifier> m_fullyResidentTextures;
+			TIdentifierArray<Resource::Identifier, TextureIdentifier> m_textureResourceIdentifiers;
+			//! Streamed textures evicted by the resource manager, kept at their always resident mips until used again
+			Threading::AtomicIdentifierMask<TextureIdentifier> m_evictedTextures;
+			Threading::Atomic<bool> m_isUpdatingStreaming{false};
+			Time::Timestamp m_lastStreamingUpdateTime;
 		};
 
 		PerDeviceTextureData& GetOrCreatePerDeviceTextureData(PerLogicalDeviceData& perDeviceData, const TextureIdentifier identifier);
 		RenderTexture& GetDummyTexture(const LogicalDeviceIdentifier deviceIdentifier, const ImageMappingType type) const;
+		//! Recreates the bindless mapping of a texture over its currently available mips
+		void UpdateRenderTextureMapping(
+			LogicalDevice& logicalDevice,
+			PerLogicalDeviceData& perDeviceData,
+			PerDeviceTextureData& textureData,
+			RenderTexture& texture,
+			const TextureIdentifier identifier
+		);
 	protected:
 		TIdentifierArray<UniquePtr<PerLogicalDeviceData>, LogicalDeviceIdentifier> m_perLogicalDeviceData;
 
 		Asset::Type<RenderTargetTemplateIdentifier, RenderTargetInfo> m_renderTargetAssetType;
+
+		uint64 m_streamingBudget{DefaultStreamingBudget};
+		bool m_isStreamingEnabled{false};
+
+		struct StreamedTextureResource
+		{
+			TextureIdentifier m_textureIdentifier;
+			LogicalDeviceIdentifier m_deviceIdentifier;
+		};
+		TIdentifierArray<StreamedTextureResource, Resource::Identifier> m_streamedTextureResources;
 	};
 }
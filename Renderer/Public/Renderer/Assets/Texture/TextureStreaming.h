@@ -0,0 +1,40 @@
+#pragma once
+
+#include <Renderer/Assets/Texture/MipMask.h>
+
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering::TextureStreaming
+{
+	//! Mips up to 32x32 are always resident so that every streamed texture can be sampled
+	inline static constexpr MipMask AlwaysResidentMips{MipMask::StoredType((1u << 6u) - 1u)};
+
+	//! State of a streamed texture as seen by the residency selection
+	struct TextureInfo
+	{
+		MipMask m_totalMips;
+		MipMask m_loadedMips;
+		//! Largest resolution the texture was rendered at since the last selection, zero if it was not visible
+		uint32 m_requiredResolution;
+		uint32 m_bitsPerPixel;
+		uint16 m_arrayLayerCount;
+	};
+
+	//! Gets the mips needed to render a texture at the specified resolution, from the smallest up to the closest larger mip
+	[[nodiscard]] MipMask GetRequiredMips(const MipMask totalMips, const uint32 requiredResolution);
+	//! Gets the mips a render texture allocates to hold the requested ones, all mips of the texture up to the largest requested one
+	//! Evicting the largest mips of a streamed texture recreates it with fewer allocated mips, releasing their memory
+	[[nodiscard]] MipMask GetAllocatedMips(const MipMask totalMips, const MipMask requestedMips);
+	//! Estimates the memory used by a mip, assuming square mips
+	[[nodiscard]] uint64 GetMipByteSize(const TextureInfo& texture, const MipMask::StoredType mipIndex);
+
+	//! Picks the mips that should be resident for each texture, keeping their estimated total size within the budget
+	//! Required mips are valued by the screen area of their texture per byte, so the mips adding the least detail on screen are evicted first.
+	//! Loaded mips that are no longer required are only kept while the budget allows.
+	//! Resident mips are always contiguous from the smallest one, the always resident mips are kept even if they exceed the budget.
+	//! Returns the estimated size of all selected mips.
+	uint64 SelectResidentMips(
+		const ArrayView<const TextureInfo, uint32> textures, const uint64 budget, const ArrayView<MipMask, uint32> residentMipsOut
+	);
+}
@@ -30,6 +30,7 @@ namespace ngine::Rendering
 			StorageBuffer = 1 << 5,
 			IndexBuffer = 1 << 6,
 			VertexBuffer = 1 << 7,
+			IndirectBuffer = 1 << 8,
 			ShaderDeviceAddress = 0x00020000,
 			AccelerationStructureBuildInputReadOnly = 0x00080000,
 			AccelerationStructureStorage = 0x00100000,
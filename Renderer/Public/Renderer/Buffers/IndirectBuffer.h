@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Renderer/Buffers/Buffer.h>
+
+namespace ngine::Rendering
+{
+	//! Arguments of an indexed draw read from an indirect buffer, laid out as expected by all backends
+	struct DrawIndexedIndirectArguments
+	{
+		uint32 m_indexCount;
+		uint32 m_instanceCount;
+		uint32 m_firstIndex;
+		int32 m_vertexOffset;
+		uint32 m_firstInstance;
+	};
+
+	//! Host visible buffer holding draw arguments written by the CPU
+	struct IndirectBuffer : public Buffer
+	{
+		IndirectBuffer() = default;
+		IndirectBuffer(LogicalDevice& logicalDevice, const PhysicalDevice& physicalDevice, DeviceMemoryPool& memoryPool, const size size);
+		IndirectBuffer(const IndirectBuffer&) = delete;
+		IndirectBuffer& operator=(const IndirectBuffer&) = delete;
+		IndirectBuffer(IndirectBuffer&&) = default;
+		IndirectBuffer& operator=(IndirectBuffer&&) = default;
+	};
+}
@@ -103,7 +103,16 @@ namespace ngine::Rendering
 			const uint32 firstInstance = 0
 		) const;
 		void Draw(const uint32 vertexCount, const uint32 instanceCount, const uint32 firstVertex = 0, const uint32 firstInstance = 0) const;
-		void DrawIndexedIndirect(const BufferView buffer, const uint64 offset, const uint32 drawCount = 1, const uint32 offsetStride = 0) const;
+		//! Binds the index buffer and draws with arguments read from an indirect buffer
+		void DrawIndexedIndirect(
+			const BufferView indexBuffer,
+			const uint64 indexBufferOffset,
+			const uint64 indexBufferSize,
+			const BufferView buffer,
+			const uint64 offset,
+			const uint32 drawCount = 1,
+			const uint32 offsetStride = 0
+		) const;
 		void DrawIndirect(const BufferView buffer, const uint64 offset, const uint32 drawCount = 1, const uint32 offsetStride = 0) const;
 
 		void StartNextSubpass() const;
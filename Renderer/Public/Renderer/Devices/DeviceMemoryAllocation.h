@@ -4,6 +4,7 @@
 #include <Common/Storage/Identifier.h>
 #include <Common/Memory/CountBits.h>
 #include <Common/Memory/GetIntegerType.h>
+#include <Common/Math/NumericLimits.h>
 
 namespace ngine::Rendering
 {
@@ -24,6 +25,8 @@ namespace ngine::Rendering
 	struct DeviceMemoryAllocation
 	{
 		using BlockSizeType = uint16;
+		using PageIndexType = uint16;
+		inline static constexpr PageIndexType InvalidPageIndex = Math::NumericLimits<PageIndexType>::Max;
 
 		[[nodiscard]] bool IsValid() const
 		{
@@ -36,5 +39,7 @@ namespace ngine::Rendering
 		DeviceMemoryFragment::IdentifierType m_identifier;
 		uint8 m_memoryTypeIndex = 0;
 		BlockSizeType m_blockIndex = 0;
+		//! Index of the small allocation page the allocation was sub-allocated from, if any
+		PageIndexType m_pageIndex = InvalidPageIndex;
 	};
 }
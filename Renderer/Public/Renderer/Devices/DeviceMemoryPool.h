@@ -2,6 +2,8 @@
 
 #include <Renderer/Buffers/DeviceMemory.h>
 #include <Renderer/Devices/DeviceMemoryAllocation.h>
+#include <Renderer/Devices/TlsfAllocator.h>
+#include <Renderer/Devices/SlabAllocator.h>
 
 #include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Storage/SaltedIdentifierStorage.h>
@@ -9,6 +11,7 @@
 #include <Common/Storage/IdentifierMask.h>
 #include <Common/Memory/Bitset.h>
 #include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/UniquePtr.h>
 
 #include <Common/Threading/Mutexes/Mutex.h>
 #include <Common/Threading/Mutexes/SharedMutex.h>
@@ -22,6 +25,13 @@ namespace ngine::Rendering
 
 #define DISABLE_MEMORY_POOL_USAGE 0
 
+	//! Sub-allocates device memory blocks per memory type
+	//! Small allocations made from job threads are served from pages owned by the allocating thread, so that threads only contend on the
+	//! memory type lock when acquiring or releasing a whole page. Larger allocations go straight to the block's TLSF allocator.
+	//! Linear and optimally tiled resources never share a page, and optimal allocations from the blocks are padded to the buffer-image
+	//! granularity so that they can't alias a linear neighbour. Pages are returned to their block as soon as they are empty.
+	//! Allocations are never relocated: defragmentation is a follow-up that first needs buffers and images to expose their pool allocation
+	//! for rebinding, after which blocks with low occupancy can be evacuated through queued copies.
 	struct DeviceMemoryPool
 	{
 		struct Block
@@ -34,41 +44,30 @@ namespace ngine::Rendering
 			inline static constexpr SizeType Alignment = 16;
 
 			DeviceMemory m_memory;
-			uint32 m_availableSpace = 0;
+			TlsfAllocator m_allocator;
+		};
 
-			struct Fragment
-			{
-				using IdentifierType = typename DeviceMemoryFragment::IdentifierType;
-				using SizeType = typename DeviceMemoryFragment::SizeType;
-				using ReuseType = typename DeviceMemoryFragment::ReuseType;
-				using IdentifierStorageType = typename DeviceMemoryFragment::IdentifierStorageType;
-				inline static constexpr size MaximumCount = DeviceMemoryFragment::MaximumCount;
-				inline static constexpr size ReuseCount = DeviceMemoryFragment::ReuseCount;
-				inline static constexpr size CountBitCount = DeviceMemoryFragment::CountBitCount;
-				inline static constexpr size RequiredBitCount = DeviceMemoryFragment::RequiredBitCount;
-
-				[[nodiscard]] IdentifierType GetPreviousFragmentIdentifier() const
-				{
-					return Block::Fragment::IdentifierType::MakeFromIndex(m_previousFragmentIdentifierIndex);
-				}
-				[[nodiscard]] IdentifierType GetNextFragmentIdentifier() const
-				{
-					return Block::Fragment::IdentifierType::MakeFromIndex(m_nextFragmentIdentifierIndex);
-				}
-
-				Block::SizeType m_offset;
-				Block::SizeType m_size;
-				typename IdentifierType::IndexType m_previousFragmentIdentifierIndex;
-				typename IdentifierType::IndexType m_nextFragmentIdentifierIndex;
-			};
+		using Allocation = DeviceMemoryAllocation;
 
-			TSaltedIdentifierStorage<Fragment::IdentifierType> m_identifierStorage;
-			TIdentifierArray<Fragment, Fragment::IdentifierType> m_fragments;
-			IdentifierMask<Fragment::IdentifierType> m_usedFragments;
-			IdentifierMask<Fragment::IdentifierType> m_unusedFragments;
+		//! Layout of the resource bound to an allocation, linear and optimal resources must not share a buffer-image granularity page
+		enum class ResourceTiling : uint8
+		{
+			//! Buffers and linearly tiled images
+			Linear,
+			//! Optimally tiled images
+			Optimal,
+			Count
 		};
 
-		using Allocation = DeviceMemoryAllocation;
+		//! Allocations up to this size and alignment are sub-allocated from per-thread pages
+		inline static constexpr uint32 SmallAllocationMaximumSize = 64 * 1024;
+		inline static constexpr uint32 SmallAllocationMinimumSize = 4096;
+		//! Size classes step by powers of two with an intermediate class in between: 4, 8, 12, 16, 24, 32, 48 and 64 KiB
+		inline static constexpr uint8 SmallAllocationSizeClassCount = 8;
+		inline static constexpr uint32 SmallAllocationPageSize = 1024 * 1024;
+		static_assert(SmallAllocationPageSize / SmallAllocationMinimumSize <= SlabAllocator::MaximumSlotCount);
+		//! Job threads with a higher index always use the shared blocks
+		inline static constexpr uint8 MaximumThreadCount = 64;
 
 		DeviceMemoryPool() = default;
 		DeviceMemoryPool(const LogicalDeviceView logicalDevice, const PhysicalDevice& physicalDevice);
@@ -81,7 +80,8 @@ namespace ngine::Rendering
 			size allocationSize,
 			const uint32 alignment,
 			const uint8 memoryTypeIndex,
-			const EnumFlags<MemoryFlags> memoryFlags
+			const EnumFlags<MemoryFlags> memoryFlags,
+			const ResourceTiling tiling = ResourceTiling::Linear
 		);
 		void Deallocate(const Allocation allocation);
 		[[nodiscard]] Allocation AllocateRaw(
@@ -97,6 +97,25 @@ namespace ngine::Rendering
 			DeviceMemory m_memory;
 		};
 
+		struct SmallAllocationPage
+		{
+			SmallAllocationPage(const Allocation pageAllocation, const uint32 slotSize)
+				: m_pageAllocation(pageAllocation)
+				, m_allocator(slotSize, SlabAllocator::SlotIndexType(SmallAllocationPageSize / slotSize))
+			{
+			}
+
+			//! Only contended when another thread frees an allocation from this page
+			mutable Threading::Mutex m_mutex;
+			Allocation m_pageAllocation;
+			SlabAllocator m_allocator;
+			//! Whether the page is still its thread's current page
+			//! Once empty, a retired page is released entirely, while a current page only returns its memory and is released by its thread
+			bool m_isCurrent = true;
+			//! Set when a current page became empty and its memory was returned to the block
+			bool m_isMemoryReleased = false;
+		};
+
 		struct MemoryType
 		{
 			mutable Threading::SharedMutex m_blockMutex;
@@ -105,10 +124,38 @@ namespace ngine::Rendering
 			Vector<Block, typename DeviceMemoryAllocation::BlockSizeType> m_blocks;
 			Threading::Atomic<bool> m_isOutOfMemory = false;
 
-			TSaltedIdentifierStorage<Block::Fragment::IdentifierType> m_hostMappableMemoryIdentifierStorage;
-			TIdentifierArray<DeviceMemory, Block::Fragment::IdentifierType> m_hostMappableMemory;
+			TSaltedIdentifierStorage<DeviceMemoryFragment::IdentifierType> m_hostMappableMemoryIdentifierStorage;
+			TIdentifierArray<DeviceMemory, DeviceMemoryFragment::IdentifierType> m_hostMappableMemory;
+
+			//! Released pages leave an empty slot to be reused, guarded by the block mutex
+			Vector<UniquePtr<SmallAllocationPage>, DeviceMemoryAllocation::PageIndexType> m_pages;
+			//! Current page of each thread, tiling and size class, only accessed by the owning thread
+			Array<SmallAllocationPage*, MaximumThreadCount * (uint8)ResourceTiling::Count * SmallAllocationSizeClassCount> m_threadPages{
+				Memory::Zeroed
+			};
 		};
 
+		[[nodiscard]] Allocation AllocateFromBlocks(
+			const LogicalDeviceView logicalDevice,
+			const uint32 allocationSize,
+			const uint32 alignment,
+			const uint8 memoryTypeIndex,
+			const EnumFlags<MemoryFlags> memoryFlags
+		);
+		[[nodiscard]] Allocation AllocateSmall(
+			const LogicalDeviceView logicalDevice,
+			const uint32 allocationSize,
+			const uint32 alignment,
+			const uint8 memoryTypeIndex,
+			const EnumFlags<MemoryFlags> memoryFlags,
+			const ResourceTiling tiling,
+			const uint8 threadIndex
+		);
+		void DeallocateSmall(const Allocation allocation);
+		//! Destroys a current page whose memory was already returned to its block, called by the owning thread
+		void ReleaseEmptiedPage(MemoryType& memoryType, SmallAllocationPage& page);
+
 		Array<MemoryType, 32> m_memoryTypes;
+		uint32 m_bufferImageGranularity = 1;
 	};
 }
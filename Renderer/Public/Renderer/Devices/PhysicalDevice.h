@@ -61,6 +61,12 @@ namespace ngine::Rendering
 		[[nodiscard]] PURE_LOCALS_AND_POINTERS MemoryTypeSizeType
 		GetMemoryTypeIndex(const EnumFlags<MemoryFlags> flags, const uint32 typeFilter = Math::NumericLimits<uint32>::Max) const;
 
+		//! Granularity at which linear and optimally tiled resources bound to the same memory must not alias
+		[[nodiscard]] uint32 GetBufferImageGranularity() const
+		{
+			return m_bufferImageGranularity;
+		}
+
 		[[nodiscard]] EnumFlags<PhysicalDeviceFeatures> GetSupportedFeatures() const
 		{
 			return m_supportedFeatures;
@@ -111,5 +117,6 @@ namespace ngine::Rendering
 		// EnumFlags<PhysicalDeviceFeatures> m_supportedFeatures;
 
 		FlatVector<EnumFlags<MemoryFlags>, MaximumMemoryTypeCount> m_memoryTypes;
+		uint32 m_bufferImageGranularity{1};
 	};
 };
@@ -36,7 +36,9 @@ namespace ngine::Rendering
 		ShaderInt64 = 1 << 27,
 		SeparateDepthStencilLayout = 1 << 28,
 		ReadWriteBuffers = 1 << 29,
-		ReadWriteTextures = 1 << 30
+		ReadWriteTextures = 1 << 30,
+		//! Indirect draws can read more than one draw from the argument buffer
+		MultiDrawIndirect = 1u << 31
 	};
 
 	ENUM_FLAG_OPERATORS(PhysicalDeviceFeatures);
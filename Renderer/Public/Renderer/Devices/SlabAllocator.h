@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Optional.h>
+
+namespace ngine::Rendering
+{
+	//! Allocates fixed size slots within a single page, tracking free slots in a bitmap
+	//! Used as the per-thread front-end for small device memory allocations, never touches the managed memory
+	struct SlabAllocator
+	{
+		using SizeType = uint32;
+		using SlotIndexType = uint16;
+
+		inline static constexpr SlotIndexType MaximumSlotCount = 256;
+
+		SlabAllocator(const SizeType slotSize, const SlotIndexType slotCount);
+
+		//! Returns the offset of a free slot, if any
+		[[nodiscard]] Optional<SizeType> Allocate();
+		void Deallocate(const SizeType offset);
+
+		[[nodiscard]] bool IsAllocated(const SizeType offset) const;
+
+		[[nodiscard]] SizeType GetSlotSize() const
+		{
+			return m_slotSize;
+		}
+		[[nodiscard]] bool IsEmpty() const
+		{
+			return m_usedSlotCount == 0;
+		}
+		[[nodiscard]] bool IsFull() const
+		{
+			return m_usedSlotCount == m_slotCount;
+		}
+	protected:
+		SizeType m_slotSize;
+		SlotIndexType m_slotCount;
+		SlotIndexType m_usedSlotCount = 0;
+		//! Set bits mark free slots
+		Array<uint64, MaximumSlotCount / 64> m_freeSlots{Memory::Zeroed};
+	};
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <Renderer/Devices/DeviceMemoryAllocation.h>
+
+#include <Common/Storage/SaltedIdentifierStorage.h>
+#include <Common/Storage/IdentifierArray.h>
+#include <Common/Storage/IdentifierMask.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Optional.h>
+
+namespace ngine::Rendering
+{
+	//! Two-level segregated fit allocator managing offsets within a single contiguous range
+	//! Free ranges are bucketed by size class, with bitmaps locating the first large enough bucket so that allocating and freeing are O(1)
+	//! Never touches the managed memory, allowing device memory to be sub-allocated from the CPU
+	struct TlsfAllocator
+	{
+		using SizeType = uint32;
+		using IdentifierType = DeviceMemoryFragment::IdentifierType;
+		using IndexType = typename IdentifierType::IndexType;
+
+		//! Each power of two size class is split into this many linearly spaced buckets
+		inline static constexpr uint8 SecondLevelBitCount = 4;
+		inline static constexpr uint8 SecondLevelCount = 1 << SecondLevelBitCount;
+		inline static constexpr uint8 FirstLevelCount = sizeof(SizeType) * 8 - SecondLevelBitCount + 1;
+
+		struct Allocation
+		{
+			IdentifierType m_identifier;
+			SizeType m_offset;
+			SizeType m_size;
+		};
+
+		TlsfAllocator() = default;
+		explicit TlsfAllocator(const SizeType size);
+
+		//! Finds a free range of at least the specified size with the requested power of two alignment
+		[[nodiscard]] Optional<Allocation> Allocate(const SizeType size, const SizeType alignment);
+		//! Returns the allocation's range, merging it with adjacent free ranges
+		void Deallocate(const IdentifierType identifier);
+
+		[[nodiscard]] bool IsAllocated(const IdentifierType identifier, const SizeType offset, const SizeType size) const;
+
+		[[nodiscard]] SizeType GetSize() const
+		{
+			return m_size;
+		}
+		[[nodiscard]] SizeType GetAvailableSpace() const
+		{
+			return m_availableSpace;
+		}
+	protected:
+		struct Range
+		{
+			SizeType m_offset;
+			SizeType m_size;
+			//! Neighbouring ranges in address order
+			IndexType m_previousRangeIndex;
+			IndexType m_nextRangeIndex;
+			//! Neighbouring free ranges in the same bucket
+			IndexType m_previousFreeRangeIndex;
+			IndexType m_nextFreeRangeIndex;
+		};
+
+		struct Mapping
+		{
+			uint8 m_firstLevelIndex;
+			uint8 m_secondLevelIndex;
+		};
+		[[nodiscard]] static Mapping GetMapping(const SizeType size);
+
+		[[nodiscard]] IdentifierType FindFreeRange(const SizeType size) const;
+		void AddFreeRange(const IdentifierType identifier);
+		void RemoveFreeRange(const IdentifierType identifier);
+		//! Splits the range at the specified relative offset, returning the new range covering the remainder
+		[[nodiscard]] IdentifierType SplitRange(const IdentifierType identifier, const SizeType splitOffset);
+		//! Merges the range into the range preceding it in address order
+		void MergeIntoPrevious(const IdentifierType identifier);
+	protected:
+		SizeType m_size = 0;
+		SizeType m_availableSpace = 0;
+
+		TSaltedIdentifierStorage<IdentifierType> m_identifierStorage;
+		TIdentifierArray<Range, IdentifierType> m_ranges;
+		IdentifierMask<IdentifierType> m_freeRanges;
+
+		uint32 m_firstLevelBitmap = 0;
+		Array<uint32, FirstLevelCount> m_secondLevelBitmaps{Memory::Zeroed};
+		Array<IndexType, FirstLevelCount * SecondLevelCount> m_freeRangeHeads{Memory::Zeroed};
+	};
+}
@@ -16,7 +16,10 @@
 #include <Common/Storage/ForwardDeclarations/FixedIdentifierArrayView.h>
 #include <Common/Asset/Guid.h>
 #include <Common/Memory/UniqueRef.h>
+#include <Common/Memory/Containers/Array.h>
 #include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Function/Function.h>
 #include <Common/Threading/Jobs/StageBase.h>
 
 #if STAGE_DEPENDENCY_PROFILING
@@ -28,6 +31,7 @@ namespace ngine::Threading
 	struct Job;
 	struct JobBatch;
 	struct IntermediateStage;
+	struct JobRunnerThread;
 	struct EngineJobRunnerThread;
 }
 
@@ -131,7 +135,10 @@ namespace ngine::Rendering
 			return *m_pPresentRenderOutputImageStage;
 		}
 
-		void WaitForProcessingFramesToFinish(const FrameMask frameMask);
+		void WaitForProcessingFramesToFinish(const FrameMask frameMask)
+		{
+			WaitForProcessingFramesToFinish(frameMask, frameMask);
+		}
 
 		[[nodiscard]] bool IsProcessingFrames(const FrameMask frameMask) const
 		{
@@ -297,11 +304,22 @@ namespace ngine::Rendering
 			Threading::JobBatch& jobBatch
 		);
 
+		void WaitForProcessingFramesToFinish(const FrameMask cpuFrameMask, const FrameMask gpuFrameMask);
+
 		void OnStartFrame();
 		void OnEndFrame(const FrameIndex frameIndex);
 
+		//! Starts counting the stage towards the GPU completion of each frame
+		void TrackStageGpuExecution(Stage& stage);
+		//! Called once per frame by every tracked stage, after its commands finished executing or it was skipped
+		void OnStageFinishedGpuExecution(const FrameIndex frameIndex);
+		using DeferredCallback = Function<void(Threading::JobRunnerThread&), 24>;
+		//! Holds back the callback until all frames started before the specified one have finished executing on the GPU
+		//! Returns false without taking the callback if no earlier frame is still executing, in which case the caller proceeds immediately
+		[[nodiscard]] bool DeferUntilPreviousFramesGpuExecution(const FrameIndex frameIndex, DeferredCallback&& callback);
 		void OnFinishFrameGpuExecution(const FrameIndex frameIndex);
 	protected:
+		friend Stage;
 		friend RenderPassStage;
 		friend GenericPassStage;
 		friend ComputePassStage;
@@ -334,6 +352,20 @@ namespace ngine::Rendering
 		Threading::Atomic<uint16> m_pendingCompilationTasks{0};
 		Threading::Atomic<FrameMask> m_processingFrameCpuMask{0};
 		Threading::Atomic<FrameMask> m_processingFrameGpuMask{0};
-		Optional<Threading::EngineJobRunnerThread*> m_pStartFrameThread;
+		//! Number of stages reporting GPU completion each frame
+		uint16 m_trackedGpuStageCount{0};
+		//! Stages that have yet to report GPU completion per frame, the frame finishes on the GPU when this reaches zero
+		Array<Threading::Atomic<uint16>, MaximumConcurrentFrameCount> m_remainingGpuStageCounts;
+		//! The thread that started each frame, and owns its render data
+		Array<Optional<Threading::EngineJobRunnerThread*>, MaximumConcurrentFrameCount> m_startFrameThreads;
+
+		struct DeferredWork
+		{
+			FrameIndex m_frameIndex;
+			DeferredCallback m_callback;
+		};
+		Threading::Mutex m_deferredWorkMutex;
+		//! Work held back until earlier frames finished executing on the GPU, queued in order from OnFinishFrameGpuExecution
+		Vector<DeferredWork> m_deferredWork;
 	};
 }
@@ -84,13 +84,27 @@ namespace ngine::Rendering
 			return attachmentIndices
 			  .GetSubView(attachmentIndices.GetSize() - emplacedAttachmentIndices.GetSize(), emplacedAttachmentIndices.GetSize());
 		}
+
+		ArrayView<const ReferenceWrapper<Stage>, StageIndex>
+		EmplaceSubpassStages(const ArrayView<const ReferenceWrapper<Stage>, StageIndex> emplacedSubpassStages)
+		{
+			subpassStages.CopyEmplaceRangeBack(emplacedSubpassStages);
+			return subpassStages.GetSubView(subpassStages.GetSize() - emplacedSubpassStages.GetSize(), emplacedSubpassStages.GetSize());
+		}
+
+		//! Merges chains of render pass stages that draw to compatible attachments into explicit render passes with one subpass per stage
+		//! Avoids storing and reloading the shared attachments between the passes, which is especially costly on tile-based GPUs
+		//! Passes reading attachments written earlier in the chain are not merged, as that requires the stage to read subpass inputs
+		//! Must be called after all stages were emplaced, and remaps the stage indices of dependencies accordingly
+		void MergeRenderPasses();
 	protected:
 		InlineVector<StageDescription, 100, StageIndex> stages;
 		FlatVector<ColorAttachmentDescription, 128, AttachmentIndex> colorAttachments;
 		FlatVector<InputAttachmentDescription, 32, AttachmentIndex> inputAttachments;
 		FlatVector<InputOutputAttachmentDescription, 32, AttachmentIndex> inputOutputAttachments;
 		FlatVector<OutputAttachmentDescription, 96, AttachmentIndex> outputAttachments;
-		FlatVector<RenderSubpassDescription, 32, PassIndex> renderSubpasses;
+		FlatVector<RenderSubpassDescription, 64, PassIndex> renderSubpasses;
+		FlatVector<ReferenceWrapper<Stage>, 64, StageIndex> subpassStages;
 		FlatVector<SubpassAttachmentReference, 128, AttachmentIndex> subpassAttachmentReferences;
 		FlatVector<ComputeSubpassDescription, 128, PassIndex> computeSubpasses;
 		FlatVector<AttachmentIndex, 128, AttachmentIndex> attachmentIndices;
@@ -364,8 +364,32 @@ namespace ngine::Rendering
 					break;
 			}
 		}
+
+		[[nodiscard]] ConstStringView GetName() const
+		{
+			return m_name;
+		}
+		[[nodiscard]] StageIndex GetPreviousStageIndex() const
+		{
+			return m_previousStageIndex;
+		}
+		[[nodiscard]] StageType GetType() const
+		{
+			return m_type;
+		}
+		[[nodiscard]] const RenderPassDescription& GetRenderPassDescription() const
+		{
+			Assert(m_type == StageType::RenderPass);
+			return m_renderPassDescription;
+		}
+		[[nodiscard]] const ExplicitRenderPassDescription& GetExplicitRenderPassDescription() const
+		{
+			Assert(m_type == StageType::ExplicitRenderPass);
+			return m_explicitRenderPassDescription;
+		}
 	protected:
 		friend struct RenderPassStageDescription;
+		friend struct FramegraphBuilder;
 		friend Framegraph;
 
 		StageDescription(
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <Renderer/Scene/ViewFrustum.h>
+
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/FlatVector.h>
+
+namespace ngine::Rendering
+{
+	//! View frustum and the volumes of the shadow maps rendered by the view, culled against together during octree traversal
+	//! Render items only inside the shadow caster volumes are visible to the stages drawing shadow casters
+	struct CullingVolumes
+	{
+		inline static constexpr uint8 MaximumShadowCasterVolumeCount = 8;
+		//! One bit per volume, the view frustum is the first
+		using Mask = uint16;
+		inline static constexpr Mask ViewFrustumMask = 1;
+
+		//! Volumes a node is fully inside of, and volumes it partially overlaps and whose children have to be tested
+		struct Classification
+		{
+			[[nodiscard]] bool IsOutside() const
+			{
+				return (m_inside | m_intersecting) == 0;
+			}
+			[[nodiscard]] bool IsInViewFrustum() const
+			{
+				return ((m_inside | m_intersecting) & ViewFrustumMask) != 0;
+			}
+			[[nodiscard]] bool IsInsideViewFrustum() const
+			{
+				return (m_inside & ViewFrustumMask) != 0;
+			}
+
+			Mask m_inside{0};
+			Mask m_intersecting{0};
+		};
+
+		enum class Visibility : uint8
+		{
+			Hidden,
+			//! Outside the view frustum, but can cast shadows into it
+			ShadowCaster,
+			Visible
+		};
+
+		//! Creates a set containing everything in the view frustum and no shadow caster volumes
+		CullingVolumes()
+		{
+			m_volumes.EmplaceBack(ViewFrustum());
+		}
+
+		void Set(const ViewFrustum& viewFrustum, const ArrayView<const ViewFrustum, uint8> shadowCasterVolumes)
+		{
+			Assert(shadowCasterVolumes.GetSize() <= MaximumShadowCasterVolumeCount);
+			m_volumes.Clear();
+			m_volumes.EmplaceBack(viewFrustum);
+			for (const ViewFrustum& shadowCasterVolume : shadowCasterVolumes)
+			{
+				m_volumes.EmplaceBack(shadowCasterVolume);
+			}
+		}
+
+		//! Classification of the root node, partially overlapping every volume
+		[[nodiscard]] Classification GetRootClassification() const
+		{
+			return Classification{0, Mask((1u << m_volumes.GetSize()) - 1u)};
+		}
+
+		//! Classifies a box contained in a node of the given classification, only testing the volumes the node partially overlaps
+		[[nodiscard]] PURE_STATICS Classification Classify(const Math::WorldBoundingBox boundingBox, const Classification parent) const
+		{
+			// Everything inside the view frustum is visible to all stages, the shadow caster volumes no longer matter
+			if (parent.IsInsideViewFrustum())
+			{
+				return parent;
+			}
+
+			Classification result{parent.m_inside, 0};
+			for (uint8 volumeIndex = 0, volumeCount = (uint8)m_volumes.GetSize(); volumeIndex < volumeCount; ++volumeIndex)
+			{
+				const Mask volumeMask = Mask(1u << volumeIndex);
+				if ((parent.m_intersecting & volumeMask) == 0)
+				{
+					continue;
+				}
+
+				switch (m_volumes[volumeIndex].Classify(boundingBox))
+				{
+					case ViewFrustum::Intersection::Inside:
+						result.m_inside |= volumeMask;
+						break;
+					case ViewFrustum::Intersection::Intersecting:
+						result.m_intersecting |= volumeMask;
+						break;
+					case ViewFrustum::Intersection::Outside:
+						break;
+				}
+			}
+			return result;
+		}
+
+		//! Gets the visibility of a render item bounding box contained in a node of the given classification
+		[[nodiscard]] PURE_STATICS Visibility GetVisibility(const Math::WorldBoundingBox boundingBox, const Classification parent) const
+		{
+			if (parent.IsInsideViewFrustum())
+			{
+				return Visibility::Visible;
+			}
+
+			const Classification classification = Classify(boundingBox, parent);
+			if (classification.IsInViewFrustum())
+			{
+				return Visibility::Visible;
+			}
+			return classification.IsOutside() ? Visibility::Hidden : Visibility::ShadowCaster;
+		}
+	protected:
+		FlatVector<ViewFrustum, MaximumShadowCasterVolumeCount + 1> m_volumes;
+	};
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <Common/Math/Vector2.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering::LightClusters
+{
+	//! Bounding sphere of a light in view space, with depth increasing along +z
+	struct LightBounds
+	{
+		Math::Vector3f m_viewPosition;
+		float m_radius;
+	};
+
+	//! Range of a cluster's entries in the light index list
+	struct Cluster
+	{
+		uint32 m_firstLightIndex;
+		uint32 m_lightCount;
+	};
+
+	//! View space axis aligned bounds of a cluster
+	struct ClusterBounds
+	{
+		Math::Vector3f m_minimum;
+		Math::Vector3f m_maximum;
+	};
+
+	//! Froxel grid splitting a perspective view frustum into screen tiles and exponentially distributed depth slices
+	//! Tiles are indexed from negative to positive x and y in view space.
+	struct Grid
+	{
+		[[nodiscard]] uint32 GetSliceClusterCount() const
+		{
+			return m_tileCount.x * m_tileCount.y;
+		}
+		[[nodiscard]] uint32 GetClusterCount() const
+		{
+			return GetSliceClusterCount() * m_sliceCount;
+		}
+		[[nodiscard]] uint32 GetClusterIndex(const uint32 x, const uint32 y, const uint32 sliceIndex) const
+		{
+			return (sliceIndex * m_tileCount.y + y) * m_tileCount.x + x;
+		}
+
+		//! Gets the view space depth at which a slice starts, passing the slice count returns the far plane
+		[[nodiscard]] float GetSliceDepth(const uint32 sliceIndex) const;
+		[[nodiscard]] ClusterBounds GetClusterBounds(const uint32 x, const uint32 y, const uint32 sliceIndex) const;
+
+		Math::Vector2ui m_tileCount;
+		uint32 m_sliceCount;
+		float m_nearPlane;
+		float m_farPlane;
+		//! Tangents of half the horizontal and vertical field of view
+		Math::Vector2f m_tanHalfFieldOfView;
+	};
+
+	[[nodiscard]] bool Intersects(const ClusterBounds& bounds, const LightBounds& light);
+
+	//! Assigns lights to the clusters of a single slice
+	//! Slices are independent of each other so they can be assigned by parallel jobs, each writing to its own outputs.
+	//! Cluster ranges index into sliceLightIndicesOut until the slice is appended with AppendSlice.
+	void AssignSlice(
+		const Grid& grid,
+		const ArrayView<const LightBounds, uint32> lights,
+		const uint32 sliceIndex,
+		const ArrayView<Cluster, uint32> sliceClustersOut,
+		Vector<uint32, uint32>& sliceLightIndicesOut
+	);
+	//! Appends the light indices of an assigned slice to the combined list and offsets its cluster ranges into it
+	void AppendSlice(
+		const ArrayView<Cluster, uint32> sliceClusters, const ArrayView<const uint32, uint32> sliceLightIndices, Vector<uint32, uint32>& lightIndicesOut
+	);
+	//! Cuts the light index list down to the given count, shortening the ranges of the clusters that referenced the removed entries
+	void LimitLightIndexCount(const ArrayView<Cluster, uint32> clusters, Vector<uint32, uint32>& lightIndices, const uint32 maximumCount);
+	//! Assigns lights to all clusters of the grid on the calling thread
+	void Assign(
+		const Grid& grid,
+		const ArrayView<const LightBounds, uint32> lights,
+		const ArrayView<Cluster, uint32> clustersOut,
+		Vector<uint32, uint32>& lightIndicesOut
+	);
+}
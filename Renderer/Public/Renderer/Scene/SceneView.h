@@ -5,6 +5,8 @@
 #include <Renderer/Constants.h>
 #include <Renderer/Assets/Material/RenderMaterialCache.h>
 #include <Renderer/Scene/TransformBuffer.h>
+#include <Renderer/Scene/ViewFrustum.h>
+#include <Renderer/Scene/CullingVolumes.h>
 
 #include <Common/Assert/Assert.h>
 #include <Common/Math/Vector2.h>
@@ -12,7 +14,10 @@
 #include <Common/Math/Primitives/ForwardDeclarations/WorldLine.h>
 #include <Common/Math/Primitives/ForwardDeclarations/CullingFrustum.h>
 #include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Threading/Mutexes/Mutex.h>
 #include <Common/Storage/SaltedIdentifierStorage.h>
 #include <Common/Storage/IdentifierMask.h>
 #include <Common/AtomicEnumFlags.h>
@@ -37,6 +42,11 @@ namespace ngine
 		struct Scene3D;
 	}
 
+	namespace Threading
+	{
+		struct StageBase;
+	}
+
 	struct Scene3D;
 }
 
@@ -223,6 +233,19 @@ namespace ngine::Rendering
 		}
 
 		[[nodiscard]] Math::CullingFrustum<float> GetCullingFrustum() const;
+		//! Gets the world space frustum captured at the start of the current octree traversal
+		[[nodiscard]] const ViewFrustum& GetViewFrustum() const
+		{
+			return m_viewFrustum;
+		}
+		//! Gets the view frustum and shadow caster volumes captured at the start of the current octree traversal
+		[[nodiscard]] const CullingVolumes& GetCullingVolumes() const
+		{
+			return m_cullingVolumes;
+		}
+		//! Sets the volumes that shadow casters outside the view frustum are collected from, applied when the next octree traversal starts
+		//! Static meshes inside them are only visible to the stages marked with SetStageDrawsShadowCasters
+		void SetShadowCasterVolumes(const ArrayView<const ViewFrustum, uint8> volumes);
 
 		void OnBeforeResizeRenderOutput();
 		void OnAfterResizeRenderOutput();
@@ -255,14 +278,29 @@ namespace ngine::Rendering
 		[[nodiscard]] PURE_STATICS Stage& GetOctreeTraversalStage() const;
 		[[nodiscard]] PURE_STATICS Stage& GetLateStageVisibilityCheckStage() const;
 
+		//! Registers CPU jobs that start once the octree traversal and late stage visibility passes notified the render stages, and that the dependent stage's pass waits for
+		//! The same jobs can be registered for several dependent stages. They are linked into the framegraph while the view is enabled, so they have to be registered while it is disabled
+		void RegisterPostTraversalJobs(Threading::StageBase& startJob, Threading::StageBase& finishedStage, Stage& dependentStage);
+		void DeregisterPostTraversalJobs(Threading::StageBase& startJob, Stage& dependentStage);
+
 		void ProcessEnabledRenderItem(Entity::HierarchyComponentBase& component);
 		void ProcessLateStageAddedRenderItem(Entity::HierarchyComponentBase& component);
 		void ProcessLateStageChangedRenderItemTransform(Entity::HierarchyComponentBase& component);
 
+		//! Updates the view frustum and screen size parameters used to cull the octree, called before culling starts for a frame
+		void PrepareOctreeTraversal();
 		void StartOctreeTraversal(const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer);
 		void StartLateStageOctreeVisibilityCheck();
 		using TraversalResult = SceneViewBase::TraversalResult;
 		TraversalResult ProcessComponentFromOctreeTraversal(Entity::HierarchyComponentBase& component);
+		//! Checks whether a component found during octree traversal should be rendered, without modifying the view state
+		//! Safe to call from multiple threads concurrently
+		[[nodiscard]] CullingVolumes::Visibility IsComponentVisibleFromOctreeTraversal(
+			Entity::HierarchyComponentBase& component, const CullingVolumes::Classification nodeClassification
+		) const;
+		//! Registers a component that passed IsComponentVisibleFromOctreeTraversal as visible for this frame
+		TraversalResult
+		ProcessVisibleComponentFromOctreeTraversal(Entity::HierarchyComponentBase& component, const CullingVolumes::Visibility visibility);
 		void NotifyOctreeTraversalRenderStages(
 			const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer
 		);
@@ -270,6 +308,12 @@ namespace ngine::Rendering
 		void
 		OnOctreeTraversalFinished(const Rendering::CommandEncoderView graphicsCommandEncoder, PerFrameStagingBuffer& perFrameStagingBuffer);
 
+		//! Screen size class of a visible render item as of the last traversal, see GetScreenSizeClass
+		[[nodiscard]] uint8 GetRenderItemScreenSizeClass(const Entity::RenderItemIdentifier identifier) const
+		{
+			return m_renderItemScreenSizeClasses[identifier];
+		}
+
 		[[nodiscard]] DescriptorSetView GetTransformBufferDescriptorSet() const
 		{
 			return m_transformBuffer.GetTransformDescriptorSet();
@@ -305,6 +349,17 @@ namespace ngine::Rendering
 		void OnActiveCameraDestroyed();
 
 		void OnCameraAssignedInternal(Entity::CameraComponent& newCamera, const Optional<Entity::CameraComponent*> pPreviousCamera);
+
+		void UpdateRenderItemScreenSizeClass(
+			const Entity::RenderItemIdentifier renderItemIdentifier,
+			const Math::WorldBoundingBox worldBoundingBox,
+			const TraversalResult traversalResult
+		);
+
+		struct PostTraversalJobs;
+		void LinkPostTraversalJobs(const PostTraversalJobs& jobs);
+		//! Returns true if any link was removed
+		bool UnlinkPostTraversalJobs(const PostTraversalJobs& jobs);
 	private:
 		Optional<Widgets::Document::Scene3D*> m_pSceneWidget = Invalid;
 
@@ -313,6 +368,24 @@ namespace ngine::Rendering
 
 		UniqueRef<OctreeTraversalStage> m_pOctreeTraversalStage;
 		UniqueRef<LateStageVisibilityCheckStage> m_pLateStageVisibilityCheckStage;
+
+		struct PostTraversalJobs
+		{
+			ReferenceWrapper<Threading::StageBase> m_startJob;
+			ReferenceWrapper<Threading::StageBase> m_finishedStage;
+			ReferenceWrapper<Stage> m_dependentStage;
+		};
+		Vector<PostTraversalJobs> m_postTraversalJobs;
+
+		ViewFrustum m_viewFrustum;
+		CullingVolumes m_cullingVolumes;
+		Threading::Mutex m_shadowCasterVolumesMutex;
+		FlatVector<ViewFrustum, CullingVolumes::MaximumShadowCasterVolumeCount> m_shadowCasterVolumes;
+
+		//! Camera location and inverse tangent of half the vertical field of view, captured when the traversal starts
+		Math::WorldCoordinate m_screenSizeViewLocation{Math::Zero};
+		float m_screenSizeProjectionScale{0.f};
+		TIdentifierArray<uint8, Entity::RenderItemIdentifier> m_renderItemScreenSizeClasses{Memory::Zeroed};
 	public:
 		TransformBuffer m_transformBuffer;
 	};
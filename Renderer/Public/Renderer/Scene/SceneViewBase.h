@@ -131,6 +131,8 @@ namespace ngine::Rendering
 		{
 			DeregisterSceneRenderStage(identifier);
 			m_renderItemStagesMask.Clear(identifier);
+			m_screenSizeDependentStages.Clear(identifier);
+			m_shadowCasterStages.Clear(identifier);
 		}
 
 		void RegisterSceneRenderStage(const SceneRenderStageIdentifier identifier, SceneRenderStage& stage)
@@ -154,6 +156,16 @@ namespace ngine::Rendering
 		{
 			m_cameraPropertyDependentStages.Set(identifier);
 		}
+		//! Marks a stage as depending on the screen size class of its render items, resetting them when their class changes
+		void SetStageDependentOnScreenSize(const SceneRenderStageIdentifier identifier)
+		{
+			m_screenSizeDependentStages.Set(identifier);
+		}
+		//! Marks a stage as drawing shadow casters, receiving render items outside the view that can cast shadows into it
+		void SetStageDrawsShadowCasters(const SceneRenderStageIdentifier identifier)
+		{
+			m_shadowCasterStages.Set(identifier);
+		}
 
 		void StartTraversal();
 
@@ -198,7 +210,8 @@ namespace ngine::Rendering
 			Entity::SceneRegistry& sceneRegistry,
 			const Entity::ComponentIdentifier componentIdentifier,
 			Entity::HierarchyComponentBase& component,
-			const bool isVisible
+			const bool isVisible,
+			const bool isOnlyCastingShadows = false
 		);
 
 		void NotifyRenderStages(
@@ -220,6 +233,11 @@ namespace ngine::Rendering
 		{
 			return m_visibleRenderItems.IsSet(renderItemIdentifier);
 		}
+		//! Whether a visible render item is outside the view and only visible to the stages drawing shadow casters
+		[[nodiscard]] bool IsRenderItemOnlyCastingShadows(const Entity::RenderItemIdentifier renderItemIdentifier) const
+		{
+			return m_shadowCasterOnlyRenderItems.IsSet(renderItemIdentifier);
+		}
 
 		[[nodiscard]] PURE_STATICS Optional<Entity::HierarchyComponentBase*>
 		GetVisibleRenderItemComponent(const Entity::RenderItemIdentifier renderItemIdentifier) const
@@ -267,6 +285,12 @@ namespace ngine::Rendering
 		void OnSceneDetached();
 		void OnSceneEnabled();
 		void OnSceneDisabled();
+
+		[[nodiscard]] RenderItemStageMask
+		GetAllowedRenderItemStages(const Entity::RenderItemIdentifier renderItemIdentifier, const RenderItemStageMask& stages) const
+		{
+			return m_shadowCasterOnlyRenderItems.IsSet(renderItemIdentifier) ? stages & m_shadowCasterStages : stages;
+		}
 	protected:
 		LogicalDevice& m_logicalDevice;
 		SceneViewDrawer& m_drawer;
@@ -300,6 +324,8 @@ namespace ngine::Rendering
 		RenderItemStageMask m_newlyDisabledRenderItemStagesMask;
 		RenderItemStageMask m_newlyEnabledRenderItemStagesMask;
 		RenderItemStageMask m_cameraPropertyDependentStages;
+		RenderItemStageMask m_screenSizeDependentStages;
+		RenderItemStageMask m_shadowCasterStages;
 
 		TIdentifierArray<RenderItemStageMask, Entity::RenderItemIdentifier> m_queuedRenderItemStageMasks{Memory::Zeroed};
 		TIdentifierArray<RenderItemStageMask, Entity::RenderItemIdentifier> m_submittedRenderItemStageMasks{Memory::Zeroed};
@@ -312,6 +338,8 @@ namespace ngine::Rendering
 		Entity::RenderItemMask m_visibleRenderItemsBeforeTraversal;
 		Entity::RenderItemMask m_visibleRenderItemsDuringTraversal;
 		Entity::RenderItemMask m_visibleRenderItems;
+		//! Visible render items that are only visible to m_shadowCasterStages
+		Entity::RenderItemMask m_shadowCasterOnlyRenderItems;
 	};
 
 	ENUM_FLAG_OPERATORS(SceneViewBase::Flags);
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <Engine/Entity/RenderItemIdentifier.h>
+#include <Engine/Entity/RenderItemMask.h>
+
+#include <Renderer/Scene/InstanceBuffer.h>
+
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering
+{
+	//! Instance drawn into a shadow map
+	struct ShadowCaster
+	{
+		[[nodiscard]] bool operator==(const ShadowCaster& other) const
+		{
+			return (m_instanceGroupIdentifierIndex == other.m_instanceGroupIdentifierIndex) & (m_instanceIndex == other.m_instanceIndex) &
+			       (m_renderItemIdentifier == other.m_renderItemIdentifier);
+		}
+		[[nodiscard]] bool operator!=(const ShadowCaster& other) const
+		{
+			return !operator==(other);
+		}
+
+		uint32 m_instanceGroupIdentifierIndex;
+		InstanceBuffer::InstanceIndexType m_instanceIndex;
+		//! Render item occupying the instance, instance slots and groups are reused once their render items are removed
+		Entity::RenderItemIdentifier m_renderItemIdentifier;
+	};
+
+	//! Tracks which casters a shadow map was rendered with, so that its contents can be kept across frames
+	namespace ShadowCasters
+	{
+		//! Sorts casters by instance group and instance so that consecutive instances can be drawn together
+		void Sort(const ArrayView<ShadowCaster, uint32> shadowCasters);
+
+		//! Checks whether a shadow map rendered with the cached casters can be kept for the current (sorted) casters
+		//! Removed render items invalidate the shadow map even if another render item took over their instance in the meantime
+		[[nodiscard]] bool IsCacheValid(
+			const ArrayView<const ShadowCaster, uint32> cachedShadowCasters,
+			const ArrayView<const ShadowCaster, uint32> shadowCasters,
+			const Entity::RenderItemMask& removedRenderItems
+		);
+	}
+}
@@ -122,6 +122,21 @@ namespace ngine::Rendering
 		{
 			return {GetRotationMatrixBuffer(), GetLocationBuffer(), GetPreviousRotationMatrixBuffer(), GetPreviousLocationBuffer()};
 		}
+
+		//! Uploads the transforms of the specified render items to the provided buffers
+		//! Changed items are coalesced into runs, with each run copied separately so that transfers scale with the number of changed items
+		void UploadTransforms(
+			Entity::SceneRegistry& sceneRegistry,
+			LogicalDevice& logicalDevice,
+			const Entity::RenderItemMask& renderItems,
+			const typename Entity::RenderItemIdentifier::IndexType maximumUsedRenderItemCount,
+			const FixedIdentifierArrayView<Entity::ComponentIdentifier::IndexType, Entity::RenderItemIdentifier> renderItemComponentIdentifiers,
+			const CommandQueueView graphicsCommandQueue,
+			const CommandEncoderView graphicsCommandEncoder,
+			PerFrameStagingBuffer& perFrameStagingBuffer,
+			const ArrayView<const BufferView, uint8> rotationBuffers,
+			const ArrayView<const BufferView, uint8> locationBuffers
+		);
 	protected:
 		enum class Buffers : uint8
 		{
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Common/Math/Matrix4x4.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Vector4.h>
+#include <Common/Math/Abs.h>
+#include <Common/Math/Primitives/WorldBoundingBox.h>
+#include <Common/Memory/Containers/Array.h>
+
+namespace ngine::Rendering
+{
+	//! Set of world space clip planes extracted from a view projection matrix
+	//! Planes are stored as (normal, distance) with normals pointing into the frustum
+	struct ViewFrustum
+	{
+		enum class Intersection : uint8
+		{
+			Outside,
+			Intersecting,
+			Inside
+		};
+
+		//! Creates a frustum that contains everything
+		ViewFrustum()
+			: m_planes{Memory::InitializeAll, Math::Vector4f{0.f, 0.f, 0.f, 1.f}}
+		{
+		}
+		//! Extracts the clip planes from a row-vector view projection matrix (clip = position * matrix) with a [0, 1] depth range
+		explicit ViewFrustum(const Math::Matrix4x4f& viewProjectionMatrix)
+		{
+			const auto getColumn = [&viewProjectionMatrix](const uint8 index)
+			{
+				return Math::Vector4f{
+					viewProjectionMatrix.m_rows[0][index],
+					viewProjectionMatrix.m_rows[1][index],
+					viewProjectionMatrix.m_rows[2][index],
+					viewProjectionMatrix.m_rows[3][index]
+				};
+			};
+			const Math::Vector4f x = getColumn(0);
+			const Math::Vector4f y = getColumn(1);
+			const Math::Vector4f z = getColumn(2);
+			const Math::Vector4f w = getColumn(3);
+
+			m_planes[0] = w + x;
+			m_planes[1] = w - x;
+			m_planes[2] = w + y;
+			m_planes[3] = w - y;
+			m_planes[4] = z;
+			m_planes[5] = w - z;
+		}
+
+		//! Extends the frustum infinitely past its near plane, towards the origin of the projection
+		void RemoveNearPlane()
+		{
+			m_planes[4] = Math::Vector4f{0.f, 0.f, 0.f, 1.f};
+		}
+
+		//! Replaces the far plane, limiting the frustum to the specified distance from an origin along a normalized direction
+		void SetFarPlane(const Math::Vector3f origin, const Math::Vector3f direction, const float distance)
+		{
+			m_planes[5] = Math::Vector4f{-direction.x, -direction.y, -direction.z, direction.Dot(origin) + distance};
+		}
+
+		//! Extends the frustum infinitely along a direction by dropping the planes that the direction points out of
+		//! The planes along the silhouette are not added, so the result is a conservative superset of the swept volume
+		void ExtrudeTowards(const Math::Vector3f direction)
+		{
+			for (Math::Vector4f& plane : m_planes)
+			{
+				if (plane.x * direction.x + plane.y * direction.y + plane.z * direction.z < 0.f)
+				{
+					plane = Math::Vector4f{0.f, 0.f, 0.f, 1.f};
+				}
+			}
+		}
+
+		[[nodiscard]] PURE_STATICS Intersection Classify(const Math::WorldBoundingBox boundingBox) const
+		{
+			const Math::Vector3f center = boundingBox.GetCenter();
+			const Math::Vector3f halfSize = boundingBox.GetSize() * 0.5f;
+
+			Intersection result = Intersection::Inside;
+			for (const Math::Vector4f plane : m_planes)
+			{
+				const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+				const float projectedRadius = Math::Abs(plane.x) * halfSize.x + Math::Abs(plane.y) * halfSize.y + Math::Abs(plane.z) * halfSize.z;
+				if (distance < -projectedRadius)
+				{
+					return Intersection::Outside;
+				}
+				else if (distance < projectedRadius)
+				{
+					result = Intersection::Intersecting;
+				}
+			}
+			return result;
+		}
+
+		[[nodiscard]] PURE_STATICS bool IsVisible(const Math::WorldBoundingBox boundingBox) const
+		{
+			return Classify(boundingBox) != Intersection::Outside;
+		}
+
+		[[nodiscard]] PURE_STATICS bool IsVisible(const Math::WorldCoordinate center, const float radius) const
+		{
+			for (const Math::Vector4f plane : m_planes)
+			{
+				const float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+				const float planeNormalLength = Math::Vector3f{plane.x, plane.y, plane.z}.GetLength();
+				if (distance < -radius * planeNormalLength)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+	protected:
+		Array<Math::Vector4f, 6> m_planes;
+	};
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Renderer/Buffers/IndirectBuffer.h>
+#include <Renderer/Index.h>
+
+#include <Common/Math/Range.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Rendering::IndirectDraws
+{
+	//! Writes one draw per index range after the first argumentCount arguments, or a single draw of all indices if there are no ranges
+	//! Index ranges are relative to the mesh's first index, instances to the bound instance buffer offset
+	//! Returns false and leaves the arguments untouched if the draws don't fit
+	[[nodiscard]] bool AppendArguments(
+		const ArrayView<DrawIndexedIndirectArguments, uint32> arguments,
+		uint32& argumentCount,
+		const ArrayView<const Math::Range<Index>, Index> indexRanges,
+		const Index indexCount,
+		const uint32 instanceCount
+	);
+}
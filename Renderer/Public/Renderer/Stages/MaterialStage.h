@@ -13,10 +13,12 @@
 #include <Renderer/Assets/Material/RenderMaterial.h>
 #include <Renderer/Wrappers/ImageMapping.h>
 #include <Renderer/Commands/ClearValue.h>
+#include <Renderer/Buffers/IndirectBuffer.h>
 
 #include <Common/Memory/UniquePtr.h>
 #include <Common/Memory/Containers/FlatVector.h>
 #include <Common/Memory/Variant.h>
+#include <Common/Memory/Containers/ByteView.h>
 #include <Common/Asset/Guid.h>
 
 #if PROFILE_BUILD
@@ -24,6 +26,7 @@
 #endif
 
 #include <Common/Math/Matrix4x4.h>
+#include <Common/Math/WorldCoordinate.h>
 
 namespace ngine::Rendering
 {
@@ -136,17 +139,23 @@ namespace ngine::Rendering
 				LogicalDevice& logicalDevice,
 				const MaterialInstanceIdentifier materialInstanceIdentifier,
 				const RenderMaterialInstance& materialInstance,
+				const SceneView& sceneView,
+				const uint8 screenSizeClass,
 				const uint32 maximumInstanceCount
 			)
 				: BaseType(logicalDevice, maximumInstanceCount)
 				, m_materialInstanceIdentifier(materialInstanceIdentifier)
 				, m_materialInstance(materialInstance)
+				, m_sceneView(sceneView)
+				, m_screenSizeClass(screenSizeClass)
 			{
 			}
 			InstanceGroup(InstanceGroup&& other)
 				: BaseType(static_cast<BaseType&&>(other))
 				, m_materialInstanceIdentifier(other.m_materialInstanceIdentifier)
 				, m_materialInstance(other.m_materialInstance)
+				, m_sceneView(other.m_sceneView)
+				, m_screenSizeClass(other.m_screenSizeClass)
 			{
 			}
 			using BaseType::BaseType;
@@ -158,6 +167,9 @@ namespace ngine::Rendering
 
 			MaterialInstanceIdentifier m_materialInstanceIdentifier;
 			ReferenceWrapper<const RenderMaterialInstance> m_materialInstance;
+			ReferenceWrapper<const SceneView> m_sceneView;
+			//! Instances are grouped by screen size class so that each group can draw a single level of detail
+			uint8 m_screenSizeClass;
 		};
 
 		void OnRenderItemsBecomeVisibleFromMaterialsStage(
@@ -173,6 +185,32 @@ namespace ngine::Rendering
 	protected:
 		friend struct MaterialsStage;
 
+		//! Gets the index ranges of an instance group's mesh that should be drawn, empty ranges draw the mesh in full
+		//! Returns false if the group is entirely culled
+		[[nodiscard]] bool GetVisibleIndexRanges(
+			const InstanceGroup& instanceGroup,
+			const RenderMeshView renderMeshView,
+			Optional<Math::WorldCoordinate>& viewLocation,
+			const bool cullBackFacingMeshlets,
+			ArrayView<const Math::Range<Index>, Index>& indexRangesOut
+		);
+		//! Culls the meshlets of a group's level of detail against the view frustum, and against the view direction if back faces are culled
+		//! A meshlet is kept if it is visible for any instance of the group
+		//! Visible meshlets are merged into at most MaximumMeshletRangeCount index ranges written to m_visibleMeshletRanges
+		//! Returns false if none are visible, leaves the ranges empty to draw the mesh in full if a render item can't be resolved
+		[[nodiscard]] bool CullMeshlets(
+			const InstanceGroup& instanceGroup,
+			const RenderMeshView renderMeshView,
+			const Math::WorldCoordinate viewLocation,
+			const bool cullBackFacing
+		);
+
+		//! Builds this frame's indirect draws, called from the materials stage's jobs once visibility changes were processed
+		void UpdateIndirectDraws();
+		//! Writes the draw arguments of all visible instance groups to this frame's region of the indirect draw buffer
+		//! Returns false if indirect draws are unsupported or the arguments didn't fit, in which case groups are drawn directly
+		[[nodiscard]] bool BuildIndirectDraws();
+	protected:
 		SceneView& m_sceneView;
 		Entity::RenderItemMask m_visibleRenderItems;
 
@@ -180,6 +218,28 @@ namespace ngine::Rendering
 
 		const float m_renderAreaFactor;
 
+		//! Each meshlet is tested against every instance, larger groups are drawn in full
+		inline static constexpr InstanceBuffer::InstanceIndexType MaximumMeshletCulledInstanceCount = 8;
+		//! Maximum number of draws recorded per instance group, ranges separated by the smallest gaps are merged beyond that
+		inline static constexpr Index MaximumMeshletRangeCount = 8;
+		Vector<Math::Range<Index>, Index> m_visibleMeshletRanges;
+
+		//! Maximum number of draw arguments per frame in flight
+		inline static constexpr uint32 MaximumIndirectDrawCount = 4096;
+		struct IndirectDraw
+		{
+			ReferenceWrapper<const InstanceGroup> m_instanceGroup;
+			RenderMeshView m_renderMeshView;
+			uint32 m_firstArgumentIndex;
+			uint32 m_argumentCount;
+		};
+		//! Draw arguments for each frame in flight, created with the stage when indirect draws are supported and kept mapped
+		IndirectBuffer m_indirectDrawBuffer;
+		ByteView m_indirectDrawBufferData;
+		uint64 m_indirectDrawBufferOffset = 0;
+		Vector<IndirectDraw, uint32> m_indirectDraws;
+		bool m_useIndirectDraws = false;
+
 #if STAGE_DEPENDENCY_PROFILING
 		String m_debugMarkerName{"Material Stage"};
 #endif
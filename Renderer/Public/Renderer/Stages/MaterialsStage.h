@@ -8,7 +8,12 @@
 #include <Common/Storage/IdentifierArray.h>
 #include <Common/Storage/IdentifierMask.h>
 #include <Common/Memory/Optional.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/UniqueRef.h>
+#include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Threading/Jobs/IntermediateStage.h>
 
 namespace ngine::Rendering
 {
@@ -33,7 +38,22 @@ namespace ngine::Rendering
 		{
 			return m_renderItemsDataBuffer;
 		}
+
+		//! Jobs building the indirect draws of all active material stages, which each material stage's pass waits for
+		[[nodiscard]] Threading::StageBase& GetIndirectDrawsStartJob();
+		[[nodiscard]] Threading::StageBase& GetIndirectDrawsFinishedStage()
+		{
+			return m_indirectDrawsFinishedStage;
+		}
 	protected:
+		struct IndirectDrawsStartJob;
+		struct IndirectDrawsJob;
+
+		//! Gathers the material stages with visible items
+		void PrepareIndirectDraws();
+		//! Builds the indirect draws of every active material stage from the given one on, stepping over the stages handled by other jobs
+		void BuildIndirectDraws(const uint32 firstStageIndex, const uint32 stageStep);
+
 		// RenderItemStage
 		[[nodiscard]] virtual bool ShouldRecordCommands() const override
 		{
@@ -99,5 +119,11 @@ namespace ngine::Rendering
 			int32 padding;
 		};
 		StorageBuffer m_renderItemsDataBuffer;
+
+		//! Start job -> build jobs -> finished stage -> each material stage's pass
+		UniqueRef<IndirectDrawsStartJob> m_pIndirectDrawsStartJob;
+		Vector<UniquePtr<IndirectDrawsJob>> m_indirectDrawsJobs;
+		Threading::IntermediateStage m_indirectDrawsFinishedStage{"Material Indirect Draws Finished"};
+		Vector<ReferenceWrapper<MaterialStage>, MaterialIdentifier::IndexType> m_indirectDrawStages;
 	};
 }
@@ -3,11 +3,18 @@
 #include <Renderer/Constants.h>
 #include <Renderer/Stages/Stage.h>
 #include <Renderer/Stages/PerFrameStagingBuffer.h>
+#include <Renderer/Scene/CullingVolumes.h>
 
 #include <Engine/Tag/TagIdentifier.h>
 #include <Engine/Entity/ForwardDeclarations/ComponentTypeSceneData.h>
 
 #include <Common/Math/Transform.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/ReferenceWrapper.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/UniqueRef.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Jobs/IntermediateStage.h>
 
 namespace ngine
 {
@@ -17,6 +24,7 @@ namespace ngine
 namespace ngine::Entity
 {
 	struct Component3D;
+	struct HierarchyComponentBase;
 	struct SceneRegistry;
 }
 
@@ -35,6 +43,15 @@ namespace ngine::Rendering
 		virtual ~OctreeTraversalStage();
 
 		[[nodiscard]] bool HasStartedCulling() const;
+
+		//! Gets the job that starts culling the octree for the next frame
+		//! Stages that the traversal depends on (octree updates, camera updates) should precede this job rather than the stage's pass.
+		[[nodiscard]] Threading::Job& GetCullingJob();
+		//! Gets the stage that is signaled once every traversal job has finished culling, precedes the stage's pass
+		[[nodiscard]] Threading::StageBase& GetCullingFinishedStage()
+		{
+			return m_cullingFinishedStage;
+		}
 	protected:
 		// Stage
 		virtual bool ShouldRecordCommands() const override;
@@ -54,19 +71,59 @@ namespace ngine::Rendering
 		}
 		// ~Stage
 
+		using Classification = CullingVolumes::Classification;
+		struct VisibleComponent
+		{
+			ReferenceWrapper<Entity::HierarchyComponentBase> m_component;
+			CullingVolumes::Visibility m_visibility;
+		};
+		using VisibleComponents = Vector<VisibleComponent>;
+
+		//! Culls the nodes around the camera and collects the subtrees that the traversal jobs will cull in parallel
+		void StartCulling();
+		//! Collects the subtrees that will be culled in parallel, descending up to ParallelSplitDepth levels on the culling job
+		void GatherTraversalTasks(const SceneOctreeNode& node, const Classification classification, const uint8 remainingSplitDepth);
+		//! Processes queued traversal tasks until none are left
+		void ProcessTraversalTasks(const uint16 workerIndex);
+
 		void ProcessTransformedComponentInOctree(
-			Entity::Component3D& transformedComponent,
-			const Rendering::CommandEncoderView graphicsCommandEncoder,
-			Entity::SceneRegistry& sceneRegistry
-		);
-		void ProcessHierarchyInOctree(
-			const SceneOctreeNode& node, const Rendering::CommandEncoderView graphicsCommandEncoder, Entity::SceneRegistry& sceneRegistry
+			Entity::Component3D& transformedComponent, const Classification classification, VisibleComponents& visibleComponentsOut
 		);
+		void
+		ProcessNodeComponentsInOctree(const SceneOctreeNode& node, const Classification classification, VisibleComponents& visibleComponentsOut);
+		void ProcessHierarchyInOctree(const SceneOctreeNode& node, const Classification classification, VisibleComponents& visibleComponentsOut);
+		//! Classifies a child node against the view frustum and the shadow caster volumes its parent overlaps
+		[[nodiscard]] Classification ClassifyChildNode(const SceneOctreeNode& childNode, const Classification parentClassification) const;
 	protected:
+		struct CullingJob;
+		struct TraversalJob;
+
+		struct TraversalTask
+		{
+			ReferenceWrapper<const SceneOctreeNode> m_node;
+			Classification m_classification;
+		};
+
+		//! Number of octree levels below the camera node's ancestors that are split into separate traversal tasks
+		inline static constexpr uint8 ParallelSplitDepth = 2;
+
 		SceneView& m_sceneView;
 		Tag::Identifier m_renderItemTagIdentifier;
 		PerFrameStagingBuffer m_perFrameStagingBuffer;
 
+		Optional<Entity::SceneRegistry*> m_pSceneRegistry;
+		CullingVolumes m_cullingVolumes;
+		Vector<TraversalTask> m_traversalTasks;
+		Threading::Atomic<uint32> m_nextTraversalTaskIndex{0};
+		//! Visible components found per traversal job, the last entry is owned by the culling job
+		Vector<VisibleComponents> m_visibleComponents;
+
+		//! Culling runs as culling job -> traversal jobs -> culling finished stage -> this stage's pass
+		//! Every traversal job runs each frame and the finished stage only executes after all of them returned, so recording never waits on them.
+		UniqueRef<CullingJob> m_pCullingJob;
+		Vector<UniquePtr<TraversalJob>> m_traversalJobs;
+		Threading::IntermediateStage m_cullingFinishedStage{"Octree Culling Finished"};
+
 		uint8 m_lastFrameIndex = 1u;
 	};
 }
@@ -69,6 +69,7 @@ namespace ngine::Rendering
 	protected:
 		virtual void OnBeforeRenderPassDestroyed() override;
 		[[nodiscard]] virtual bool ShouldRecordCommands() const override;
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const override;
 		virtual void OnBeforeRecordCommands(const CommandEncoderView) override;
 		virtual void RecordCommands(const CommandEncoderView commandEncoder) override;
 		virtual void RecordRenderPassCommands(
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Renderer/Buffers/StagingBuffer.h>
+#include <Renderer/Constants.h>
 
 namespace ngine::Rendering
 {
@@ -65,7 +66,7 @@ namespace ngine::Rendering
 		[[nodiscard]] size AcquireBlock(const size requestedSize)
 		{
 			const size offset = m_stagingBufferOffset;
-			Assert(m_stagingBuffer.GetSize() - offset >= requestedSize);
+			Assert(m_frameOffset + m_frameSize - offset >= requestedSize);
 			m_stagingBufferOffset += requestedSize;
 			return offset;
 		}
@@ -83,6 +84,9 @@ namespace ngine::Rendering
 #if !RENDERER_WEBGPU
 		ByteView m_stagingBufferMappedData;
 #endif
+		//! Size of the region used by each frame in flight
+		size m_frameSize;
+		size m_frameOffset = 0;
 		size m_stagingBufferOffset = 0;
 	};
 }
@@ -61,9 +61,7 @@ namespace ngine::Rendering
 			EvaluatedSkipped = 1 << 1,
 			//! Indicates that this stage is managed by a pass, and should not execute its own logic
 			ManagedByPass = 1 << 2,
-			Enabled = 1 << 3,
-			AwaitingSubmission = 1 << 4,
-			AwaitingGPUFinish = 1 << 5
+			Enabled = 1 << 3
 		};
 
 		Stage(LogicalDevice& logicalDevice, const Threading::JobPriority priority, const EnumFlags<Flags> flags = Flags::Enabled);
@@ -91,13 +89,10 @@ namespace ngine::Rendering
 		[[nodiscard]] virtual SemaphoreView GetSubmissionFinishedSemaphore(const Threading::Job& stage) const override final;
 		[[nodiscard]] virtual bool IsSubmissionFinishedSemaphoreUsable() const override final;
 
-		[[nodiscard]] virtual FenceView GetSubmissionFinishedFence() const override final
-		{
-			return m_drawingCompletePresentFence;
-		}
+		[[nodiscard]] virtual FenceView GetSubmissionFinishedFence() const override final;
 		[[nodiscard]] virtual bool IsSubmissionFinishedFenceUsable() const override final
 		{
-			return m_drawingCompletePresentFence.IsValid();
+			return m_drawingCompletePresentFences[0].IsValid();
 		}
 
 		[[nodiscard]] bool WasSkipped() const
@@ -146,9 +141,9 @@ namespace ngine::Rendering
 		{
 			return m_submitJob;
 		}
-		[[nodiscard]] Threading::AsyncCallbackJobBase& GetFinishedExecutionStage()
+		[[nodiscard]] Threading::AsyncCallbackJobBase& GetFinishedExecutionStage(const FrameIndex frameIndex)
 		{
-			return m_finishedExecutionStage;
+			return *m_finishedExecutionStages[frameIndex];
 		}
 
 		virtual void OnAddedSubsequentGpuStage(Stage&) override final;
@@ -174,6 +169,12 @@ namespace ngine::Rendering
 		{
 			return 0;
 		}
+		//! Whether recording this stage will write descriptor sets that are shared between frames
+		//! Such stages don't record until earlier frames finished executing on the GPU, as those may still read the descriptors
+		[[nodiscard]] virtual bool UpdatesSharedDescriptorSets() const
+		{
+			return false;
+		}
 
 		virtual void OnBeforeRenderPassDestroyed()
 		{
@@ -250,30 +251,50 @@ namespace ngine::Rendering
 			RecordCommands(commandEncoder);
 			OnAfterRecordCommands(commandEncoder);
 		}
+		void RecordFrame(Threading::EngineJobRunnerThread& engineThreadRunner, const FrameIndex frameIndex);
 		void SubmitEncodedCommandBuffer();
+		void SubmitEncodedCommandBuffer(const FrameIndex frameIndex);
 		virtual void OnCommandsExecuted()
 		{
 		}
 	protected:
 		LogicalDevice& m_logicalDevice;
 	private:
+		[[nodiscard]] static uint16 GetDrawingCompleteSemaphoreIndex(const uint8 subsequentStageIndex, const FrameIndex frameIndex)
+		{
+			return uint16(subsequentStageIndex * MaximumConcurrentFrameCount + frameIndex);
+		}
+
 		Threading::Mutex m_drawingCompleteSemaphoresMutex;
-		Vector<Semaphore, uint8> m_drawingCompleteSemaphores;
-		Semaphore m_drawingCompletePresentSemaphore;
-		Fence m_drawingCompletePresentFence;
+		//! One semaphore per subsequent GPU stage and frame, see GetDrawingCompleteSemaphoreIndex
+		Vector<Semaphore, uint16> m_drawingCompleteSemaphores;
+		Array<Semaphore, MaximumConcurrentFrameCount> m_drawingCompletePresentSemaphores;
+		Array<Fence, MaximumConcurrentFrameCount> m_drawingCompletePresentFences;
 
 		Vector<ReferenceWrapper<Rendering::Stage>, uint8> m_subsequentGpuStages;
 		Optional<Threading::Job*> m_pSubsequentGpuPresentStage;
-		Vector<SemaphoreView, uint8> m_waitSemaphores;
-		Vector<SemaphoreView, uint8> m_signalSemaphores;
-		FenceView m_signalFence;
-		Vector<EnumFlags<PipelineStageFlags>, uint8> m_waitStagesMasks;
+
+		//! State of a recorded frame, kept until its commands were submitted
+		struct PerFrameSubmission
+		{
+			EncodedCommandBuffer m_encodedCommandBuffer;
+			Optional<Threading::EngineJobRunnerThread*> m_pThreadRunner;
+			Vector<SemaphoreView, uint8> m_waitSemaphores;
+			Vector<SemaphoreView, uint8> m_signalSemaphores;
+			FenceView m_signalFence;
+			Vector<EnumFlags<PipelineStageFlags>, uint8> m_waitStagesMasks;
+		};
+		Array<PerFrameSubmission, MaximumConcurrentFrameCount> m_perFrameSubmissions;
 
 		AtomicEnumFlags<Flags> m_flags{Flags::Enabled};
+		//! Frames whose commands were recorded but have not yet been submitted
+		Threading::Atomic<FrameMask> m_awaitingSubmissionFrameMask{0};
+		//! Frames whose commands were recorded but have not yet finished executing on the GPU
+		Threading::Atomic<FrameMask> m_awaitingGpuFinishFrameMask{0};
 		uint8 m_evaluatedSkippedFrameIndex{Math::NumericLimits<uint8>::Max};
 
-		EncodedCommandBuffer m_encodedCommandBuffer;
-		Optional<Threading::EngineJobRunnerThread*> m_pThreadRunner{nullptr};
+		//! The framegraph tracking this stage's per-frame GPU completion
+		Optional<Framegraph*> m_pFramegraph;
 
 		friend StageBase;
 		friend StartFrameStage;
@@ -281,7 +302,8 @@ namespace ngine::Rendering
 		Vector<ReferenceWrapper<Stage>> m_dependencies;
 
 		Threading::AsyncCallbackJobBase& m_submitJob;
-		Threading::AsyncCallbackJobBase& m_finishedExecutionStage;
+		//! Queued once the frame's commands finished executing on the GPU
+		Array<Threading::AsyncCallbackJobBase*, MaximumConcurrentFrameCount> m_finishedExecutionStages;
 	};
 
 	ENUM_FLAG_OPERATORS(Stage::Flags);
@@ -5,6 +5,7 @@
 #include <Common/Storage/Identifier.h>
 #include <Common/Memory/Optional.h>
 #include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/Containers/Vector.h>
 
 #include <Renderer/Stages/RenderItemStage.h>
 #include <Renderer/Assets/StaticMesh/StaticMeshIdentifier.h>
@@ -50,7 +51,28 @@ namespace ngine::Rendering
 
 			virtual void Destroy(LogicalDevice& logicalDevice);
 
+			//! Gets the render item drawn by the specified instance of the group
+			[[nodiscard]] Entity::RenderItemIdentifier GetInstanceRenderItem(const InstanceBuffer::InstanceIndexType instanceIndex) const
+			{
+				Assert(
+					(instanceIndex >= m_instanceBuffer.GetFirstInstanceIndex()) &
+					(instanceIndex - m_instanceBuffer.GetFirstInstanceIndex() < m_instanceBuffer.GetInstanceCount())
+				);
+				return m_instanceRenderItems[instanceIndex];
+			}
+			void SetInstanceRenderItem(const InstanceBuffer::InstanceIndexType instanceIndex, const Entity::RenderItemIdentifier renderItemIdentifier)
+			{
+				if (instanceIndex >= m_instanceRenderItems.GetSize())
+				{
+					m_instanceRenderItems.Resize(instanceIndex + 1);
+				}
+				m_instanceRenderItems[instanceIndex] = renderItemIdentifier;
+			}
+
 			Rendering::InstanceBuffer m_instanceBuffer;
+			//! Render item of each instance, indexed by instance index
+			//! Entries outside of the instance buffer's used range are stale
+			Vector<Entity::RenderItemIdentifier, InstanceBuffer::InstanceIndexType> m_instanceRenderItems;
 
 			enum class SupportResult : uint8
 			{
@@ -120,6 +142,21 @@ namespace ngine::Rendering
 			return m_instanceGroupIdentifiers.GetValidElementView(m_visibleInstanceGroups.GetView());
 		}
 
+		//! Gets the instance group a render item is drawn by, invalid if the item has not been added to a group
+		[[nodiscard]] VisibleInstanceGroupIdentifier GetRenderItemInstanceGroup(const Entity::RenderItemIdentifier renderItemIdentifier) const
+		{
+			return VisibleInstanceGroupIdentifier::MakeFromIndex(m_renderItemInfo[renderItemIdentifier].m_visibleInstanceGroupIdentifierIndex);
+		}
+		//! Gets the index of a render item's instance in the buffer of its instance group
+		[[nodiscard]] InstanceBuffer::InstanceIndexType GetRenderItemInstanceIndex(const Entity::RenderItemIdentifier renderItemIdentifier) const
+		{
+			return m_renderItemInfo[renderItemIdentifier].m_instanceIndex;
+		}
+		[[nodiscard]] Optional<const InstanceGroup*> GetInstanceGroup(const VisibleInstanceGroupIdentifier identifier) const
+		{
+			return m_visibleInstanceGroups[identifier].Get();
+		}
+
 		[[nodiscard]] VisibleInstanceGroupIdentifier::IndexType GetInstanceGroupCount() const
 		{
 			return m_instanceGroupCount;
@@ -166,7 +203,6 @@ namespace ngine::Rendering
 			InstanceGroup& instanceGroup,
 			const VisibleInstanceGroupIdentifier instanceGroupIdentifier,
 			RenderItemInfo& renderItemInfo,
-			SceneBase& scene,
 			const CommandEncoderView graphicsCommandEncoder,
 			PerFrameStagingBuffer& perFrameStagingBuffer
 		);
@@ -13,6 +13,8 @@
 #include <Common/Memory/UniquePtr.h>
 #include <Common/Storage/IdentifierArray.h>
 #include <Common/Threading/Mutexes/SharedMutex.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Threading/Mutexes/ConditionVariable.h>
 #include <Common/Threading/AtomicInteger.h>
 #include <Common/Threading/AtomicBool.h>
 #include <Common/AtomicEnumFlags.h>
@@ -201,6 +203,9 @@ namespace ngine::Rendering
 		void QueueFinishFrameWorkInternal(const LogicalDeviceIdentifier logicalDeviceIdentifier, const uint8 frameIndex);
 		void OnFinishFrameWorkInternal(const LogicalDeviceIdentifier logicalDeviceIdentifier, const uint8 frameIndex);
 		void ResetFrameResources(const LogicalDeviceIdentifier logicalDeviceIdentifier, const uint8 frameIndex);
+
+		void AwaitFramesFinishInternal(LogicalDeviceData& logicalDeviceData, const uint8 frameMask);
+		void NotifyFrameFinished(LogicalDeviceData& logicalDeviceData);
 	protected:
 		struct PerFramePoolData
 		{
@@ -250,6 +255,7 @@ namespace ngine::Rendering
 
 				[[nodiscard]] bool IsProcessingFrame() const;
 				[[nodiscard]] bool IsProcessingFrameOrAwaitingReset() const;
+				[[nodiscard]] bool IsAwaitingCpuFinish() const;
 				void FinishFrame();
 
 				union
@@ -278,6 +284,11 @@ namespace ngine::Rendering
 			Array<CommandPoolView, (uint8)QueueFamily::Count> m_commandPoolViews;
 
 			DescriptorPool m_descriptorPool;
+
+			//! Signaled whenever a frame finishes, allowing threads awaiting frames to park instead of spinning
+			Threading::Mutex m_frameFinishedMutex;
+			Threading::ConditionVariable m_frameFinishedConditionVariable;
+			Threading::Atomic<uint16> m_frameFinishedWaiterCount{0};
 		};
 	protected:
 		TIdentifierArray<UniquePtr<LogicalDeviceData>, LogicalDeviceIdentifier> m_logicalDeviceData;
@@ -0,0 +1,142 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Abs.h>
+#include <Common/Math/Sin.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Assets/StaticMesh/MeshLevelOfDetail.h>
+#include <Renderer/Assets/StaticMesh/QuantizedVertexPosition.h>
+
+namespace ngine::Rendering::Tests
+{
+	static void CreateGrid(const Index gridSize, Vector<VertexPosition, Index>& vertexPositions, Vector<Index, Index>& indices)
+	{
+		for (Index y = 0; y < gridSize; ++y)
+		{
+			for (Index x = 0; x < gridSize; ++x)
+			{
+				vertexPositions.EmplaceBack(VertexPosition{(float)x, (float)y, Math::Sin((float)x * 0.2f) * Math::Sin((float)y * 0.2f)});
+			}
+		}
+
+		for (Index y = 0; y < gridSize - 1; ++y)
+		{
+			for (Index x = 0; x < gridSize - 1; ++x)
+			{
+				const Index first = y * gridSize + x;
+				indices.EmplaceBack(first);
+				indices.EmplaceBack(first + 1);
+				indices.EmplaceBack(first + gridSize);
+				indices.EmplaceBack(first + 1);
+				indices.EmplaceBack(first + gridSize + 1);
+				indices.EmplaceBack(first + gridSize);
+			}
+		}
+	}
+
+	UNIT_TEST(MeshLevelOfDetail, SimplifyReachesTarget)
+	{
+		Vector<VertexPosition, Index> vertexPositions;
+		Vector<Index, Index> indices;
+		CreateGrid(64, vertexPositions, indices);
+
+		Vector<Index, Index> simplifiedIndices;
+		const Index targetIndexCount = (indices.GetSize() / 12) * 3;
+		const float error =
+			MeshSimplification::Generate(vertexPositions.GetView(), indices.GetView(), targetIndexCount, simplifiedIndices);
+
+		EXPECT_GT(simplifiedIndices.GetSize(), 0u);
+		EXPECT_LE(simplifiedIndices.GetSize(), targetIndexCount);
+		EXPECT_EQ(simplifiedIndices.GetSize() % 3, 0u);
+		EXPECT_GT(error, 0.f);
+		EXPECT_LT(error, 0.25f);
+
+		for (Index index = 0; index < simplifiedIndices.GetSize(); index += 3)
+		{
+			EXPECT_LT(simplifiedIndices[index], vertexPositions.GetSize());
+			EXPECT_LT(simplifiedIndices[index + 1], vertexPositions.GetSize());
+			EXPECT_LT(simplifiedIndices[index + 2], vertexPositions.GetSize());
+			EXPECT_NE(simplifiedIndices[index], simplifiedIndices[index + 1]);
+			EXPECT_NE(simplifiedIndices[index + 1], simplifiedIndices[index + 2]);
+			EXPECT_NE(simplifiedIndices[index + 2], simplifiedIndices[index]);
+		}
+
+		// A coarser target can only increase the error
+		Vector<Index, Index> coarserIndices;
+		const float coarserError =
+			MeshSimplification::Generate(vertexPositions.GetView(), indices.GetView(), targetIndexCount / 6 * 3, coarserIndices);
+		EXPECT_LT(coarserIndices.GetSize(), simplifiedIndices.GetSize());
+		EXPECT_GE(coarserError, error);
+	}
+
+	UNIT_TEST(MeshLevelOfDetail, QuantizedPositionsStayWithinError)
+	{
+		Vector<VertexPosition, Index> vertexPositions;
+		Vector<Index, Index> indices;
+		CreateGrid(16, vertexPositions, indices);
+
+		const PositionQuantization quantization(Math::Vector3f{0.f, 0.f, -1.f}, Math::Vector3f{15.f, 15.f, 1.f});
+		const float maximumError = quantization.GetMaximumError();
+		EXPECT_GT(maximumError, 0.f);
+
+		for (const VertexPosition vertexPosition : vertexPositions)
+		{
+			const VertexPosition dequantizedPosition = quantization.Dequantize(quantization.Quantize(vertexPosition));
+			EXPECT_LE(Math::Abs(dequantizedPosition.x - vertexPosition.x), maximumError * 1.01f);
+			EXPECT_LE(Math::Abs(dequantizedPosition.y - vertexPosition.y), maximumError * 1.01f);
+			EXPECT_LE(Math::Abs(dequantizedPosition.z - vertexPosition.z), maximumError * 1.01f);
+		}
+	}
+
+	UNIT_TEST(MeshLevelOfDetail, SelectByScreenSize)
+	{
+		EXPECT_EQ(GetScreenSizeClass(2.f), 0u);
+		EXPECT_EQ(GetScreenSizeClass(0.4f), 1u);
+		EXPECT_EQ(GetScreenSizeClass(0.2f), 2u);
+		EXPECT_EQ(GetScreenSizeClass(0.f), ScreenSizeClassCount - 1);
+
+		const Array<MeshLevelOfDetail, 3, uint8> levelsOfDetail{
+			MeshLevelOfDetail{0, 3000, 0.f},
+			MeshLevelOfDetail{3000, 1500, 0.003f},
+			MeshLevelOfDetail{4500, 750, 0.03f}
+		};
+		const ArrayView<const MeshLevelOfDetail, uint8> levelsOfDetailView = levelsOfDetail.GetView();
+
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView, 0), 0u);
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView, 1), 0u);
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView, 2), 1u);
+		// The coarsest level only stays within the tolerance once the hysteresis is accounted for
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView, 5), 1u);
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView, 6), 2u);
+		EXPECT_EQ(SelectLevelOfDetail(levelsOfDetailView.GetSubView(0, 1), ScreenSizeClassCount - 1), 0u);
+	}
+
+	UNIT_TEST(MeshLevelOfDetail, ScreenSizeClassHysteresis)
+	{
+		// Class 2 covers projected radii in (0.125, 0.25]
+		EXPECT_EQ(GetScreenSizeClass(0.2f, 2), 2u);
+		// Slightly outside the class range the previous class is kept
+		EXPECT_EQ(GetScreenSizeClass(0.26f, 2), 2u);
+		EXPECT_EQ(GetScreenSizeClass(0.12f, 2), 2u);
+		// Beyond the hysteresis the exact class is used
+		EXPECT_EQ(GetScreenSizeClass(0.3f, 2), 1u);
+		EXPECT_EQ(GetScreenSizeClass(0.1f, 2), 3u);
+		EXPECT_EQ(GetScreenSizeClass(0.01f, 2), GetScreenSizeClass(0.01f));
+
+		// Moving back and forth across a boundary doesn't change the class
+		uint8 screenSizeClass = GetScreenSizeClass(0.26f);
+		EXPECT_EQ(screenSizeClass, 1u);
+		for (const float projectedRadius : Array<float, 4>{0.24f, 0.26f, 0.235f, 0.27f})
+		{
+			screenSizeClass = GetScreenSizeClass(projectedRadius, screenSizeClass);
+			EXPECT_EQ(screenSizeClass, 1u);
+		}
+
+		// The outermost classes are unbounded on one side
+		EXPECT_EQ(GetScreenSizeClass(10.f, 0), 0u);
+		EXPECT_EQ(GetScreenSizeClass(0.f, ScreenSizeClassCount - 1), ScreenSizeClassCount - 1);
+	}
+}
@@ -0,0 +1,161 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Math/Vector3.h>
+#include <Common/Math/Range.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Assets/StaticMesh/Meshlet.h>
+
+namespace ngine::Rendering::Tests
+{
+	//! Creates a flat grid facing up
+	static void CreatePlane(const Index gridSize, Vector<VertexPosition, Index>& vertexPositions, Vector<Index, Index>& indices)
+	{
+		for (Index y = 0; y < gridSize; ++y)
+		{
+			for (Index x = 0; x < gridSize; ++x)
+			{
+				vertexPositions.EmplaceBack(VertexPosition{(float)x, (float)y, 0.f});
+			}
+		}
+
+		for (Index y = 0; y < gridSize - 1; ++y)
+		{
+			for (Index x = 0; x < gridSize - 1; ++x)
+			{
+				const Index first = y * gridSize + x;
+				indices.EmplaceBack(first);
+				indices.EmplaceBack(first + 1);
+				indices.EmplaceBack(first + gridSize);
+				indices.EmplaceBack(first + 1);
+				indices.EmplaceBack(first + gridSize + 1);
+				indices.EmplaceBack(first + gridSize);
+			}
+		}
+	}
+
+	UNIT_TEST(Meshlet, BuildCoversAllTriangles)
+	{
+		Vector<VertexPosition, Index> vertexPositions;
+		Vector<Index, Index> indices;
+		CreatePlane(48, vertexPositions, indices);
+
+		uint64 originalIndexSum = 0;
+		for (const Index index : indices)
+		{
+			originalIndexSum += index;
+		}
+
+		Vector<Meshlet, Index> meshlets;
+		Meshlets::Build(vertexPositions.GetView(), indices.GetView(), meshlets);
+		ASSERT_GT(meshlets.GetSize(), 1u);
+
+		Index nextIndex = 0;
+		for (const Meshlet& meshlet : meshlets)
+		{
+			EXPECT_EQ(meshlet.m_firstIndex, nextIndex);
+			EXPECT_GT(meshlet.m_indexCount, 0u);
+			EXPECT_EQ(meshlet.m_indexCount % 3, 0u);
+			EXPECT_LE(meshlet.m_indexCount, Meshlet::MaximumTriangleCount * 3);
+			nextIndex += meshlet.m_indexCount;
+
+			Vector<Index, Index> uniqueVertices;
+			for (const Index index : indices.GetView().GetSubView(meshlet.m_firstIndex, meshlet.m_indexCount))
+			{
+				if (!uniqueVertices.Contains(index))
+				{
+					uniqueVertices.EmplaceBack(index);
+				}
+
+				// All vertices are within the bounding sphere
+				EXPECT_LE((vertexPositions[index] - (Math::Vector3f)meshlet.m_center).GetLength(), meshlet.m_radius * 1.001f);
+			}
+			EXPECT_LE(uniqueVertices.GetSize(), Meshlet::MaximumVertexCount);
+		}
+		EXPECT_EQ(nextIndex, indices.GetSize());
+
+		// Triangles are only reordered
+		uint64 indexSum = 0;
+		for (const Index index : indices)
+		{
+			indexSum += index;
+		}
+		EXPECT_EQ(indexSum, originalIndexSum);
+	}
+
+	UNIT_TEST(Meshlet, BackFacingCone)
+	{
+		Vector<VertexPosition, Index> vertexPositions;
+		Vector<Index, Index> indices;
+		CreatePlane(8, vertexPositions, indices);
+
+		Vector<Meshlet, Index> meshlets;
+		Meshlets::Build(vertexPositions.GetView(), indices.GetView(), meshlets);
+		ASSERT_EQ(meshlets.GetSize(), 1u);
+
+		const Meshlet& meshlet = meshlets[0];
+		EXPECT_GT(meshlet.m_coneAxis.z, 0.99f);
+		EXPECT_LT(meshlet.m_coneCutoff, 0.01f);
+
+		EXPECT_TRUE(meshlet.IsBackFacing(Math::Vector3f{3.5f, 3.5f, -10.f}));
+		EXPECT_FALSE(meshlet.IsBackFacing(Math::Vector3f{3.5f, 3.5f, 10.f}));
+		// Grazing views within the bounding sphere are never culled
+		EXPECT_FALSE(meshlet.IsBackFacing(Math::Vector3f{3.5f, 3.5f, -1.f}));
+	}
+
+	UNIT_TEST(Meshlet, GetMeshletsInRange)
+	{
+		Vector<Meshlet, Index> meshlets;
+		// Full detail level covering [0, 30), a simplified level covering [30, 42)
+		meshlets.EmplaceBack(Meshlet{0, 12, {}, 1.f, {}, 1.f});
+		meshlets.EmplaceBack(Meshlet{12, 12, {}, 1.f, {}, 1.f});
+		meshlets.EmplaceBack(Meshlet{24, 6, {}, 1.f, {}, 1.f});
+		meshlets.EmplaceBack(Meshlet{30, 6, {}, 1.f, {}, 1.f});
+		meshlets.EmplaceBack(Meshlet{36, 6, {}, 1.f, {}, 1.f});
+
+		const ArrayView<const Meshlet, Index> fullDetailMeshlets = Meshlets::GetMeshletsInRange(meshlets.GetView(), 0, 30);
+		ASSERT_EQ(fullDetailMeshlets.GetSize(), 3u);
+		EXPECT_EQ(fullDetailMeshlets[0].m_firstIndex, 0u);
+		EXPECT_EQ(fullDetailMeshlets[2].m_firstIndex, 24u);
+
+		const ArrayView<const Meshlet, Index> simplifiedMeshlets = Meshlets::GetMeshletsInRange(meshlets.GetView(), 30, 12);
+		ASSERT_EQ(simplifiedMeshlets.GetSize(), 2u);
+		EXPECT_EQ(simplifiedMeshlets[0].m_firstIndex, 30u);
+		EXPECT_EQ(simplifiedMeshlets[1].m_firstIndex, 36u);
+
+		EXPECT_TRUE(Meshlets::GetMeshletsInRange(meshlets.GetView(), 42, 12).IsEmpty());
+	}
+
+	UNIT_TEST(Meshlet, MergeRangesClosesSmallestGaps)
+	{
+		Vector<Math::Range<Index>, Index> ranges;
+		// Gaps of 9, 3, 1, 3 and 6 indices
+		ranges.EmplaceBack(Math::Range<Index>::Make(0, 3));
+		ranges.EmplaceBack(Math::Range<Index>::Make(12, 3));
+		ranges.EmplaceBack(Math::Range<Index>::Make(18, 3));
+		ranges.EmplaceBack(Math::Range<Index>::Make(22, 2));
+		ranges.EmplaceBack(Math::Range<Index>::Make(27, 3));
+		ranges.EmplaceBack(Math::Range<Index>::Make(36, 6));
+
+		Meshlets::MergeRanges(ranges, 6);
+		EXPECT_EQ(ranges.GetSize(), 6u);
+
+		Meshlets::MergeRanges(ranges, 4);
+		ASSERT_EQ(ranges.GetSize(), 4u);
+		// The gap of one and the first gap of three are closed, the equal gap after them is kept
+		EXPECT_EQ(ranges[0].GetMinimum(), 0u);
+		EXPECT_EQ(ranges[0].GetSize(), 3u);
+		EXPECT_EQ(ranges[1].GetMinimum(), 12u);
+		EXPECT_EQ(ranges[1].GetSize(), 12u);
+		EXPECT_EQ(ranges[2].GetMinimum(), 27u);
+		EXPECT_EQ(ranges[2].GetSize(), 3u);
+		EXPECT_EQ(ranges[3].GetMinimum(), 36u);
+		EXPECT_EQ(ranges[3].GetSize(), 6u);
+
+		Meshlets::MergeRanges(ranges, 1);
+		ASSERT_EQ(ranges.GetSize(), 1u);
+		EXPECT_EQ(ranges[0].GetMinimum(), 0u);
+		EXPECT_EQ(ranges[0].GetSize(), 42u);
+	}
+}
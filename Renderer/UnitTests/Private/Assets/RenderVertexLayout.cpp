@@ -0,0 +1,36 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Math/Vector2.h>
+#include <Common/Memory/Containers/Array.h>
+
+#include <Renderer/Assets/StaticMesh/RenderVertexLayout.h>
+
+namespace ngine::Rendering::Tests
+{
+	UNIT_TEST(RenderVertexLayout, HalfPrecisionTextureCoordinates)
+	{
+		const Array<VertexTextureCoordinate, 4> textureCoordinates{
+			Math::Vector2f{0.f, 0.f}, Math::Vector2f{1.f, 0.f}, Math::Vector2f{0.25f, 0.75f}, Math::Vector2f{0.5f, 1.f}
+		};
+		EXPECT_EQ(RenderVertexLayout::GetTextureCoordinateFormat(textureCoordinates.GetDynamicView()), TextureCoordinateFormat::Half);
+	}
+
+	UNIT_TEST(RenderVertexLayout, AccumulatedLengthKeepsFullPrecision)
+	{
+		// Roads and splines store their accumulated length, half precision only has a step of 1/16 at this range
+		const Array<VertexTextureCoordinate, 4> textureCoordinates{
+			Math::Vector2f{0.f, 0.f}, Math::Vector2f{1.f, 0.f}, Math::Vector2f{0.f, 250.3f}, Math::Vector2f{1.f, 250.3f}
+		};
+		EXPECT_EQ(RenderVertexLayout::GetTextureCoordinateFormat(textureCoordinates.GetDynamicView()), TextureCoordinateFormat::Full);
+	}
+
+	UNIT_TEST(RenderVertexLayout, TextureCoordinateOffsetIndependentOfFormat)
+	{
+		constexpr Index vertexCount = 3;
+		const uint64 offset = RenderVertexLayout::GetTextureCoordinatesOffset(vertexCount);
+		EXPECT_EQ(offset % alignof(VertexTextureCoordinate), 0u);
+		EXPECT_EQ(RenderVertexLayout::GetSize(vertexCount, TextureCoordinateFormat::Half), offset + sizeof(HalfVertexTextureCoordinate) * vertexCount);
+		EXPECT_EQ(RenderVertexLayout::GetSize(vertexCount, TextureCoordinateFormat::Full), offset + sizeof(VertexTextureCoordinate) * vertexCount);
+	}
+}
@@ -0,0 +1,101 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Math/NumericLimits.h>
+
+#include <Renderer/Assets/Texture/TextureStreaming.h>
+
+namespace ngine::Rendering::Tests
+{
+	//! Mips from 1x1 up to 1024x1024
+	inline static constexpr MipMask FullMips{MipMask::StoredType((1u << 11u) - 1u)};
+	//! Size of the always resident mips of a texture with one byte per texel
+	inline static constexpr uint64 AlwaysResidentSize = 1 + 4 + 16 + 64 + 256 + 1024;
+
+	[[nodiscard]] static MipMask GetMipsUpTo(const MipMask::StoredType mipIndex)
+	{
+		return MipMask{MipMask::StoredType((2u << mipIndex) - 1u)};
+	}
+
+	UNIT_TEST(TextureStreaming, RequiredMips)
+	{
+		EXPECT_TRUE(TextureStreaming::GetRequiredMips(FullMips, 0).IsEmpty());
+		EXPECT_EQ(TextureStreaming::GetRequiredMips(FullMips, 128), GetMipsUpTo(7));
+		// Rounds up to the next larger mip
+		EXPECT_EQ(TextureStreaming::GetRequiredMips(FullMips, 100), GetMipsUpTo(7));
+		// Clamped to the mips of the texture
+		EXPECT_EQ(TextureStreaming::GetRequiredMips(FullMips, 8192), FullMips);
+	}
+
+	UNIT_TEST(TextureStreaming, AllocatedMips)
+	{
+		EXPECT_EQ(TextureStreaming::GetAllocatedMips(FullMips, TextureStreaming::AlwaysResidentMips), GetMipsUpTo(5));
+		EXPECT_EQ(TextureStreaming::GetAllocatedMips(FullMips, MipMask::FromIndex(8)), GetMipsUpTo(8));
+		// Mips missing from the texture are not allocated
+		const MipMask blockCompressedMips = FullMips & ~GetMipsUpTo(1);
+		EXPECT_EQ(TextureStreaming::GetAllocatedMips(blockCompressedMips, GetMipsUpTo(6)), blockCompressedMips & GetMipsUpTo(6));
+		EXPECT_EQ(TextureStreaming::GetAllocatedMips(FullMips, FullMips), FullMips);
+		EXPECT_TRUE(TextureStreaming::GetAllocatedMips(FullMips, MipMask{}).IsEmpty());
+	}
+
+	UNIT_TEST(TextureStreaming, UnlimitedBudgetSelectsRequiredMips)
+	{
+		const Array<TextureStreaming::TextureInfo, 2> textures{
+			TextureStreaming::TextureInfo{FullMips, GetMipsUpTo(5), 256, 8, 1},
+			TextureStreaming::TextureInfo{FullMips, GetMipsUpTo(5), 0, 8, 1}
+		};
+		Array<MipMask, 2> residentMips;
+		TextureStreaming::SelectResidentMips(textures.GetView(), Math::NumericLimits<uint64>::Max, residentMips.GetView());
+
+		EXPECT_EQ(residentMips[0], GetMipsUpTo(8));
+		// Textures that are not visible keep their always resident mips
+		EXPECT_EQ(residentMips[1], GetMipsUpTo(5));
+	}
+
+	UNIT_TEST(TextureStreaming, BudgetEvictsLeastValuableMips)
+	{
+		const Array<TextureStreaming::TextureInfo, 2> textures{
+			TextureStreaming::TextureInfo{FullMips, FullMips, 1024, 8, 1},
+			TextureStreaming::TextureInfo{FullMips, FullMips, 256, 8, 1}
+		};
+		// Enough for the 64x64 and 128x128 mips of the first texture and the 64x64 mip of the second one
+		const uint64 budget = AlwaysResidentSize * 2 + 4096 + 16384 + 4096;
+		Array<MipMask, 2> residentMips;
+		const uint64 usedSize = TextureStreaming::SelectResidentMips(textures.GetView(), budget, residentMips.GetView());
+
+		EXPECT_EQ(residentMips[0], GetMipsUpTo(7));
+		EXPECT_EQ(residentMips[1], GetMipsUpTo(6));
+		EXPECT_EQ(usedSize, budget);
+	}
+
+	UNIT_TEST(TextureStreaming, UnusedMipsAreEvictedFirst)
+	{
+		const Array<TextureStreaming::TextureInfo, 2> textures{
+			TextureStreaming::TextureInfo{FullMips, GetMipsUpTo(5), 1024, 8, 1},
+			TextureStreaming::TextureInfo{FullMips, FullMips, 0, 8, 1}
+		};
+		Array<MipMask, 2> residentMips;
+
+		// All mips of both textures fit
+		TextureStreaming::SelectResidentMips(textures.GetView(), Math::NumericLimits<uint64>::Max, residentMips.GetView());
+		EXPECT_EQ(residentMips[0], FullMips);
+		EXPECT_EQ(residentMips[1], FullMips);
+
+		// Only the required mips fit, the loaded mips of the texture that is no longer visible are evicted
+		const uint64 requiredSize = AlwaysResidentSize * 2 + 4096 + 16384 + 65536 + 262144 + 1048576;
+		TextureStreaming::SelectResidentMips(textures.GetView(), requiredSize + 4095, residentMips.GetView());
+		EXPECT_EQ(residentMips[0], FullMips);
+		EXPECT_EQ(residentMips[1], GetMipsUpTo(5));
+	}
+
+	UNIT_TEST(TextureStreaming, AlwaysResidentMipsExceedBudget)
+	{
+		const Array<TextureStreaming::TextureInfo, 1> textures{TextureStreaming::TextureInfo{FullMips, FullMips, 1024, 8, 1}};
+		Array<MipMask, 1> residentMips;
+		const uint64 usedSize = TextureStreaming::SelectResidentMips(textures.GetView(), 0, residentMips.GetView());
+
+		EXPECT_EQ(residentMips[0], GetMipsUpTo(5));
+		EXPECT_EQ(usedSize, AlwaysResidentSize);
+	}
+}
@@ -0,0 +1,70 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Devices/SlabAllocator.h>
+
+namespace ngine::Rendering::Tests
+{
+	UNIT_TEST(SlabAllocator, AllocateAllSlots)
+	{
+		constexpr SlabAllocator::SizeType SlotSize = 4096;
+		// Not a multiple of 64, so the last bitmap word is partially used
+		constexpr SlabAllocator::SlotIndexType SlotCount = 100;
+		SlabAllocator allocator(SlotSize, SlotCount);
+		EXPECT_TRUE(allocator.IsEmpty());
+
+		Vector<SlabAllocator::SizeType> offsets;
+		while (const Optional<SlabAllocator::SizeType> offset = allocator.Allocate())
+		{
+			EXPECT_EQ(*offset % SlotSize, 0u);
+			EXPECT_LT(*offset, SlotSize * SlotCount);
+			EXPECT_TRUE(allocator.IsAllocated(*offset));
+			offsets.EmplaceBack(*offset);
+		}
+		EXPECT_EQ(offsets.GetSize(), SlotCount);
+		EXPECT_TRUE(allocator.IsFull());
+
+		// Every slot was handed out exactly once
+		for (uint32 index = 0; index < offsets.GetSize(); ++index)
+		{
+			for (uint32 otherIndex = index + 1; otherIndex < offsets.GetSize(); ++otherIndex)
+			{
+				EXPECT_NE(offsets[index], offsets[otherIndex]);
+			}
+		}
+
+		EXPECT_FALSE(allocator.IsAllocated(SlotSize * SlotCount));
+		EXPECT_FALSE(allocator.IsAllocated(SlotSize / 2));
+	}
+
+	UNIT_TEST(SlabAllocator, DeallocateReusesSlots)
+	{
+		constexpr SlabAllocator::SizeType SlotSize = 65536;
+		constexpr SlabAllocator::SlotIndexType SlotCount = 16;
+		SlabAllocator allocator(SlotSize, SlotCount);
+
+		Vector<SlabAllocator::SizeType> offsets;
+		while (const Optional<SlabAllocator::SizeType> offset = allocator.Allocate())
+		{
+			offsets.EmplaceBack(*offset);
+		}
+		ASSERT_EQ(offsets.GetSize(), SlotCount);
+
+		allocator.Deallocate(offsets[5]);
+		EXPECT_FALSE(allocator.IsAllocated(offsets[5]));
+		EXPECT_FALSE(allocator.IsFull());
+
+		const Optional<SlabAllocator::SizeType> reusedOffset = allocator.Allocate();
+		ASSERT_TRUE(reusedOffset.IsValid());
+		EXPECT_EQ(*reusedOffset, offsets[5]);
+		EXPECT_FALSE(allocator.Allocate().IsValid());
+
+		for (const SlabAllocator::SizeType offset : offsets)
+		{
+			allocator.Deallocate(offset);
+		}
+		EXPECT_TRUE(allocator.IsEmpty());
+	}
+}
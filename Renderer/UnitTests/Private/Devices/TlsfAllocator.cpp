@@ -0,0 +1,62 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Devices/TlsfAllocator.h>
+
+namespace ngine::Rendering::Tests
+{
+	UNIT_TEST(TlsfAllocator, AllocateAligned)
+	{
+		UniquePtr<TlsfAllocator> pAllocator(Memory::ConstructInPlace, 1024u * 1024u);
+		TlsfAllocator& allocator = *pAllocator;
+
+		const Optional<TlsfAllocator::Allocation> first = allocator.Allocate(100, 1);
+		ASSERT_TRUE(first.IsValid());
+		EXPECT_EQ(first->m_offset, 0u);
+		EXPECT_EQ(first->m_size, 100u);
+
+		const Optional<TlsfAllocator::Allocation> aligned = allocator.Allocate(256, 4096);
+		ASSERT_TRUE(aligned.IsValid());
+		EXPECT_EQ(aligned->m_offset % 4096, 0u);
+		EXPECT_GE(aligned->m_offset, first->m_offset + first->m_size);
+		EXPECT_TRUE(allocator.IsAllocated(aligned->m_identifier, aligned->m_offset, aligned->m_size));
+		EXPECT_EQ(allocator.GetAvailableSpace(), allocator.GetSize() - first->m_size - aligned->m_size);
+
+		EXPECT_FALSE(allocator.Allocate(allocator.GetSize(), 1).IsValid());
+	}
+
+	UNIT_TEST(TlsfAllocator, DeallocateMergesNeighbours)
+	{
+		constexpr uint32 Size = 64u * 1024u;
+		UniquePtr<TlsfAllocator> pAllocator(Memory::ConstructInPlace, Size);
+		TlsfAllocator& allocator = *pAllocator;
+
+		Vector<TlsfAllocator::Allocation> allocations;
+		while (const Optional<TlsfAllocator::Allocation> allocation = allocator.Allocate(4096, 4096))
+		{
+			allocations.EmplaceBack(*allocation);
+		}
+		EXPECT_EQ(allocations.GetSize(), Size / 4096);
+		EXPECT_EQ(allocator.GetAvailableSpace(), 0u);
+
+		// Free every other range first so that the remaining frees have to merge in both directions
+		for (uint32 index = 0; index < allocations.GetSize(); index += 2)
+		{
+			allocator.Deallocate(allocations[index].m_identifier);
+		}
+		EXPECT_FALSE(allocator.Allocate(8192, 1).IsValid());
+		for (uint32 index = 1; index < allocations.GetSize(); index += 2)
+		{
+			EXPECT_TRUE(allocator.IsAllocated(allocations[index].m_identifier, allocations[index].m_offset, allocations[index].m_size));
+			allocator.Deallocate(allocations[index].m_identifier);
+		}
+		EXPECT_EQ(allocator.GetAvailableSpace(), Size);
+
+		const Optional<TlsfAllocator::Allocation> fullAllocation = allocator.Allocate(Size, 1);
+		ASSERT_TRUE(fullAllocation.IsValid());
+		EXPECT_EQ(fullAllocation->m_offset, 0u);
+	}
+}
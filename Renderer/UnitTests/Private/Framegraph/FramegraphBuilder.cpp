@@ -0,0 +1,282 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/Containers/Array.h>
+
+#include <Renderer/Framegraph/FramegraphBuilder.h>
+
+namespace ngine::Rendering::Tests
+{
+	UNIT_TEST(FramegraphBuilder, MergeChainedRenderPasses)
+	{
+		UniquePtr<FramegraphBuilder> pFramegraphBuilder(Memory::ConstructInPlace);
+		FramegraphBuilder& framegraphBuilder = *pFramegraphBuilder;
+
+		constexpr Math::Vector2ui resolution{1920, 1080};
+		const AttachmentIdentifier sceneAttachment = AttachmentIdentifier::MakeFromValidIndex(0);
+		const AttachmentIdentifier outputAttachment = AttachmentIdentifier::MakeFromValidIndex(1);
+
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Opaque",
+			InvalidStageIndex,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{
+				sceneAttachment,
+				resolution,
+				MipRange(0, 1),
+				ArrayRange(0, 1),
+				FramegraphAttachmentFlags::CanStore,
+				Math::Color{0.f, 0.f, 0.f, 1.f}
+			}})
+		});
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Transparent",
+			0,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{sceneAttachment, resolution}})
+		});
+		// Samples the scene attachment, so can't be merged without the stage reading it as a subpass input
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Tonemapping",
+			1,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{outputAttachment, resolution}}),
+			Invalid,
+			Invalid,
+			framegraphBuilder.EmplaceInputAttachments(Array{InputAttachmentDescription{
+				sceneAttachment,
+				resolution,
+				ImageSubresourceRange{ImageAspectFlags::Color, MipRange(0, 1), ArrayRange(0, 1)}
+			}})
+		});
+
+		framegraphBuilder.MergeRenderPasses();
+		const ArrayView<const StageDescription, StageIndex> stages = framegraphBuilder.GetStages();
+		ASSERT_EQ(stages.GetSize(), 2);
+
+		ASSERT_EQ(stages[0].GetType(), StageType::ExplicitRenderPass);
+		EXPECT_EQ(stages[0].GetPreviousStageIndex(), InvalidStageIndex);
+		const ExplicitRenderPassDescription& mergedPass = stages[0].GetExplicitRenderPassDescription();
+		ASSERT_EQ(mergedPass.m_colorAttachments.GetSize(), 1);
+		EXPECT_TRUE(mergedPass.m_colorAttachments[0].m_identifier == sceneAttachment);
+		EXPECT_TRUE(mergedPass.m_externalInputAttachments.IsEmpty());
+		ASSERT_EQ(mergedPass.m_subpassDescriptions.GetSize(), 2);
+		for (const RenderSubpassDescription& subpassDescription : mergedPass.m_subpassDescriptions)
+		{
+			ASSERT_EQ(subpassDescription.m_colorAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(subpassDescription.m_colorAttachmentIndices[0], 0);
+			EXPECT_EQ(subpassDescription.m_depthAttachmentIndex, InvalidAttachmentIndex);
+			EXPECT_TRUE(subpassDescription.m_externalInputAttachmentIndices.IsEmpty());
+		}
+
+		ASSERT_EQ(stages[1].GetType(), StageType::RenderPass);
+		// Previously followed the transparent stage, which is now part of the merged pass
+		EXPECT_EQ(stages[1].GetPreviousStageIndex(), 0);
+	}
+
+	UNIT_TEST(FramegraphBuilder, MergedSubpassAttachmentIndices)
+	{
+		UniquePtr<FramegraphBuilder> pFramegraphBuilder(Memory::ConstructInPlace);
+		FramegraphBuilder& framegraphBuilder = *pFramegraphBuilder;
+
+		constexpr Math::Vector2ui resolution{1280, 720};
+		const AttachmentIdentifier sceneAttachment = AttachmentIdentifier::MakeFromValidIndex(0);
+		const AttachmentIdentifier depthAttachment = AttachmentIdentifier::MakeFromValidIndex(1);
+		const AttachmentIdentifier overlayAttachment = AttachmentIdentifier::MakeFromValidIndex(2);
+		const AttachmentIdentifier outputAttachment = AttachmentIdentifier::MakeFromValidIndex(3);
+		const AttachmentIdentifier debugAttachment = AttachmentIdentifier::MakeFromValidIndex(4);
+
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Opaque",
+			InvalidStageIndex,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{
+				sceneAttachment,
+				resolution,
+				MipRange(0, 1),
+				ArrayRange(0, 1),
+				FramegraphAttachmentFlags::CanStore,
+				Math::Color{0.f, 0.f, 0.f, 1.f}
+			}}),
+			DepthAttachmentDescription{
+				depthAttachment,
+				resolution,
+				MipRange(0, 1),
+				ArrayRange(0, 1),
+				FramegraphAttachmentFlags::CanStore,
+				DepthValue{0.f}
+			}
+		});
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Transparent",
+			0,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{sceneAttachment, resolution}}),
+			DepthAttachmentDescription{depthAttachment, resolution}
+		});
+		// Introduces a new attachment ahead of the shared one, so the local and merged indices differ
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Overlay",
+			1,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{
+				ColorAttachmentDescription{overlayAttachment, resolution},
+				ColorAttachmentDescription{sceneAttachment, resolution}
+			})
+		});
+		// Samples the scene attachment, starting a new pass in which it is an external input
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Tonemapping",
+			2,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{outputAttachment, resolution}}),
+			Invalid,
+			Invalid,
+			framegraphBuilder.EmplaceInputAttachments(Array{InputAttachmentDescription{
+				sceneAttachment,
+				resolution,
+				ImageSubresourceRange{ImageAspectFlags::Color, MipRange(0, 1), ArrayRange(0, 1)}
+			}})
+		});
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"UI",
+			3,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, resolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{outputAttachment, resolution}})
+		});
+		// Different render area, never merged
+		constexpr Math::Vector2ui debugResolution{256, 256};
+		framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+			"Debug",
+			4,
+			Invalid,
+			Invalid,
+			Math::Rectangleui{Math::Zero, debugResolution},
+			framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{debugAttachment, debugResolution}})
+		});
+
+		framegraphBuilder.MergeRenderPasses();
+		const ArrayView<const StageDescription, StageIndex> stages = framegraphBuilder.GetStages();
+		ASSERT_EQ(stages.GetSize(), 3);
+
+		// Opaque, transparent and overlay
+		{
+			ASSERT_EQ(stages[0].GetType(), StageType::ExplicitRenderPass);
+			EXPECT_EQ(stages[0].GetPreviousStageIndex(), InvalidStageIndex);
+			const ExplicitRenderPassDescription& mergedPass = stages[0].GetExplicitRenderPassDescription();
+			ASSERT_EQ(mergedPass.m_colorAttachments.GetSize(), 2);
+			EXPECT_TRUE(mergedPass.m_colorAttachments[0].m_identifier == sceneAttachment);
+			EXPECT_TRUE(mergedPass.m_colorAttachments[1].m_identifier == overlayAttachment);
+			ASSERT_TRUE(mergedPass.m_depthAttachment.IsValid());
+			EXPECT_TRUE(mergedPass.m_depthAttachment->m_identifier == depthAttachment);
+			EXPECT_TRUE(mergedPass.m_externalInputAttachments.IsEmpty());
+			ASSERT_EQ(mergedPass.m_subpassDescriptions.GetSize(), 3);
+
+			const RenderSubpassDescription& opaqueSubpass = mergedPass.m_subpassDescriptions[0];
+			ASSERT_EQ(opaqueSubpass.m_colorAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(opaqueSubpass.m_colorAttachmentIndices[0], 0);
+			// Depth follows the color attachments
+			EXPECT_EQ(opaqueSubpass.m_depthAttachmentIndex, 2);
+			EXPECT_EQ(opaqueSubpass.m_stencilAttachmentIndex, InvalidAttachmentIndex);
+
+			const RenderSubpassDescription& transparentSubpass = mergedPass.m_subpassDescriptions[1];
+			ASSERT_EQ(transparentSubpass.m_colorAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(transparentSubpass.m_colorAttachmentIndices[0], 0);
+			EXPECT_EQ(transparentSubpass.m_depthAttachmentIndex, 2);
+
+			const RenderSubpassDescription& overlaySubpass = mergedPass.m_subpassDescriptions[2];
+			ASSERT_EQ(overlaySubpass.m_colorAttachmentIndices.GetSize(), 2);
+			EXPECT_EQ(overlaySubpass.m_colorAttachmentIndices[0], 1);
+			EXPECT_EQ(overlaySubpass.m_colorAttachmentIndices[1], 0);
+			EXPECT_EQ(overlaySubpass.m_depthAttachmentIndex, InvalidAttachmentIndex);
+			EXPECT_TRUE(overlaySubpass.m_subpassInputAttachmentIndices.IsEmpty());
+			EXPECT_TRUE(overlaySubpass.m_externalInputAttachmentIndices.IsEmpty());
+		}
+
+		// Tonemapping and UI
+		{
+			ASSERT_EQ(stages[1].GetType(), StageType::ExplicitRenderPass);
+			EXPECT_EQ(stages[1].GetPreviousStageIndex(), 0);
+			const ExplicitRenderPassDescription& mergedPass = stages[1].GetExplicitRenderPassDescription();
+			ASSERT_EQ(mergedPass.m_colorAttachments.GetSize(), 1);
+			EXPECT_TRUE(mergedPass.m_colorAttachments[0].m_identifier == outputAttachment);
+			EXPECT_TRUE(mergedPass.m_depthAttachment.IsInvalid());
+			ASSERT_EQ(mergedPass.m_externalInputAttachments.GetSize(), 1);
+			EXPECT_TRUE(mergedPass.m_externalInputAttachments[0].m_identifier == sceneAttachment);
+			ASSERT_EQ(mergedPass.m_subpassDescriptions.GetSize(), 2);
+
+			const RenderSubpassDescription& tonemappingSubpass = mergedPass.m_subpassDescriptions[0];
+			ASSERT_EQ(tonemappingSubpass.m_colorAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(tonemappingSubpass.m_colorAttachmentIndices[0], 0);
+			EXPECT_TRUE(tonemappingSubpass.m_subpassInputAttachmentIndices.IsEmpty());
+			// External inputs are laid out after the color attachments
+			ASSERT_EQ(tonemappingSubpass.m_externalInputAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(tonemappingSubpass.m_externalInputAttachmentIndices[0], 1);
+			const AttachmentIndex externalInputAttachmentIndex = tonemappingSubpass.m_externalInputAttachmentIndices[0];
+			EXPECT_TRUE(mergedPass.GetAttachmentDescription(externalInputAttachmentIndex).m_identifier == sceneAttachment);
+
+			const RenderSubpassDescription& uiSubpass = mergedPass.m_subpassDescriptions[1];
+			ASSERT_EQ(uiSubpass.m_colorAttachmentIndices.GetSize(), 1);
+			EXPECT_EQ(uiSubpass.m_colorAttachmentIndices[0], 0);
+			EXPECT_TRUE(uiSubpass.m_externalInputAttachmentIndices.IsEmpty());
+		}
+
+		ASSERT_EQ(stages[2].GetType(), StageType::RenderPass);
+		EXPECT_TRUE(stages[2].GetName() == ConstStringView("Debug"));
+		// Previously followed the UI stage, now the second merged pass
+		EXPECT_EQ(stages[2].GetPreviousStageIndex(), 1);
+	}
+
+	UNIT_TEST(FramegraphBuilder, DontMergeClearedSharedAttachments)
+	{
+		UniquePtr<FramegraphBuilder> pFramegraphBuilder(Memory::ConstructInPlace);
+		FramegraphBuilder& framegraphBuilder = *pFramegraphBuilder;
+
+		constexpr Math::Vector2ui resolution{512, 512};
+		const AttachmentIdentifier attachment = AttachmentIdentifier::MakeFromValidIndex(0);
+
+		for (StageIndex stageIndex = 0; stageIndex < 2; ++stageIndex)
+		{
+			framegraphBuilder.EmplaceStage(RenderPassStageDescription{
+				"Pass",
+				stageIndex > 0 ? StageIndex(stageIndex - 1) : InvalidStageIndex,
+				Invalid,
+				Invalid,
+				Math::Rectangleui{Math::Zero, resolution},
+				framegraphBuilder.EmplaceColorAttachments(Array{ColorAttachmentDescription{
+					attachment,
+					resolution,
+					MipRange(0, 1),
+					ArrayRange(0, 1),
+					FramegraphAttachmentFlags::CanStore,
+					Math::Color{0.f, 0.f, 0.f, 1.f}
+				}})
+			});
+		}
+
+		framegraphBuilder.MergeRenderPasses();
+		const ArrayView<const StageDescription, StageIndex> stages = framegraphBuilder.GetStages();
+		ASSERT_EQ(stages.GetSize(), 2);
+		EXPECT_EQ(stages[0].GetType(), StageType::RenderPass);
+		EXPECT_EQ(stages[0].GetPreviousStageIndex(), InvalidStageIndex);
+		EXPECT_EQ(stages[1].GetType(), StageType::RenderPass);
+		EXPECT_EQ(stages[1].GetPreviousStageIndex(), 0);
+	}
+}
@@ -0,0 +1,136 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Array.h>
+
+#include <Renderer/Scene/CullingVolumes.h>
+
+namespace ngine::Rendering::Tests
+{
+	//! Orthographic volume covering the given box, with the near plane at the minimum depth
+	[[nodiscard]] static ViewFrustum CreateBoxVolume(const Math::Vector3f minimum, const Math::Vector3f maximum)
+	{
+		const Math::Vector3f size = maximum - minimum;
+		return ViewFrustum(Math::Matrix4x4f{
+			2.f / size.x,
+			0.f,
+			0.f,
+			0.f,
+			0.f,
+			2.f / size.y,
+			0.f,
+			0.f,
+			0.f,
+			0.f,
+			1.f / size.z,
+			0.f,
+			-(maximum.x + minimum.x) / size.x,
+			-(maximum.y + minimum.y) / size.y,
+			-minimum.z / size.z,
+			1.f
+		});
+	}
+
+	[[nodiscard]] static Math::WorldBoundingBox CreateBox(const Math::Vector3f center, const float halfSize)
+	{
+		const Math::Vector3f extent{halfSize, halfSize, halfSize};
+		return Math::WorldBoundingBox{center - extent, center + extent};
+	}
+
+	UNIT_TEST(CullingVolumes, ExtrudeTowards)
+	{
+		ViewFrustum volume = CreateBoxVolume(Math::Vector3f{-10.f, -10.f, 0.f}, Math::Vector3f{10.f, 10.f, 100.f});
+		EXPECT_TRUE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, 50.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, -50.f}, 1.f)));
+
+		// Extending towards negative depth only drops the near plane
+		volume.ExtrudeTowards(Math::Vector3f{0.f, 0.f, -1.f});
+		EXPECT_TRUE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, -50.f}, 1.f)));
+		EXPECT_TRUE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, -10000.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, 150.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{20.f, 0.f, -50.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, -20.f, -50.f}, 1.f)));
+
+		ViewFrustum nearPlaneRemoved = CreateBoxVolume(Math::Vector3f{-10.f, -10.f, 0.f}, Math::Vector3f{10.f, 10.f, 100.f});
+		nearPlaneRemoved.RemoveNearPlane();
+		EXPECT_EQ(
+			nearPlaneRemoved.Classify(CreateBox(Math::Vector3f{0.f, 0.f, -50.f}, 1.f)),
+			volume.Classify(CreateBox(Math::Vector3f{0.f, 0.f, -50.f}, 1.f))
+		);
+	}
+
+	UNIT_TEST(CullingVolumes, SetFarPlane)
+	{
+		ViewFrustum volume = CreateBoxVolume(Math::Vector3f{-10.f, -10.f, 0.f}, Math::Vector3f{10.f, 10.f, 100.f});
+		volume.SetFarPlane(Math::Vector3f{0.f, 0.f, 0.f}, Math::Vector3f{0.f, 0.f, 1.f}, 40.f);
+		EXPECT_TRUE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, 30.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 0.f, 60.f}, 1.f)));
+
+		// Casters above the clamped range are still kept when extended towards the light, the ones past the range are not
+		volume.ExtrudeTowards(Math::Vector3f{0.f, 1.f, 0.f});
+		EXPECT_TRUE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 500.f, 30.f}, 1.f)));
+		EXPECT_FALSE(volume.IsVisible(CreateBox(Math::Vector3f{0.f, 500.f, 60.f}, 1.f)));
+	}
+
+	UNIT_TEST(CullingVolumes, ShadowCastersOutsideView)
+	{
+		const ViewFrustum viewFrustum = CreateBoxVolume(Math::Vector3f{-10.f, -10.f, 0.f}, Math::Vector3f{10.f, 10.f, 100.f});
+		// Light shining down the y axis onto the view, extended towards the light
+		ViewFrustum shadowCasterVolume = viewFrustum;
+		shadowCasterVolume.ExtrudeTowards(Math::Vector3f{0.f, 1.f, 0.f});
+
+		CullingVolumes cullingVolumes;
+		const Array<ViewFrustum, 1> shadowCasterVolumes{shadowCasterVolume};
+		cullingVolumes.Set(viewFrustum, shadowCasterVolumes.GetView());
+
+		const CullingVolumes::Classification root = cullingVolumes.GetRootClassification();
+		EXPECT_EQ(cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{0.f, 0.f, 50.f}, 1.f), root), CullingVolumes::Visibility::Visible);
+		EXPECT_EQ(
+			cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{0.f, 500.f, 50.f}, 1.f), root),
+			CullingVolumes::Visibility::ShadowCaster
+		);
+		EXPECT_EQ(cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{0.f, -500.f, 50.f}, 1.f), root), CullingVolumes::Visibility::Hidden);
+		EXPECT_EQ(cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{500.f, 500.f, 50.f}, 1.f), root), CullingVolumes::Visibility::Hidden);
+
+		// A node above the view is only inside the shadow caster volume
+		const CullingVolumes::Classification node = cullingVolumes.Classify(CreateBox(Math::Vector3f{0.f, 500.f, 50.f}, 5.f), root);
+		EXPECT_FALSE(node.IsOutside());
+		EXPECT_FALSE(node.IsInViewFrustum());
+		EXPECT_EQ(node.m_inside, CullingVolumes::Mask(1u << 1u));
+		EXPECT_EQ(node.m_intersecting, 0u);
+	}
+
+	UNIT_TEST(CullingVolumes, ContainedNodesSkipTests)
+	{
+		const ViewFrustum viewFrustum = CreateBoxVolume(Math::Vector3f{-10.f, -10.f, 0.f}, Math::Vector3f{10.f, 10.f, 100.f});
+		CullingVolumes cullingVolumes;
+		const Array<ViewFrustum, 1> shadowCasterVolumes{CreateBoxVolume(Math::Vector3f{50.f, -10.f, 0.f}, Math::Vector3f{70.f, 10.f, 100.f})};
+		cullingVolumes.Set(viewFrustum, shadowCasterVolumes.GetView());
+
+		const CullingVolumes::Classification root = cullingVolumes.GetRootClassification();
+		EXPECT_EQ(root.m_intersecting, 0b11u);
+		EXPECT_TRUE(cullingVolumes.Classify(CreateBox(Math::Vector3f{30.f, 0.f, 50.f}, 1.f), root).IsOutside());
+
+		// Boxes within a node inside the view are visible without being tested
+		const CullingVolumes::Classification insideView = cullingVolumes.Classify(CreateBox(Math::Vector3f{0.f, 0.f, 50.f}, 5.f), root);
+		EXPECT_TRUE(insideView.IsInsideViewFrustum());
+		EXPECT_EQ(cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{1000.f, 0.f, 0.f}, 1.f), insideView), CullingVolumes::Visibility::Visible);
+
+		// Nodes inside a shadow caster volume keep it without testing it again, but still test the view frustum
+		const CullingVolumes::Classification insideShadowCasterVolume =
+			cullingVolumes.Classify(CreateBox(Math::Vector3f{60.f, 0.f, 50.f}, 5.f), root);
+		EXPECT_EQ(insideShadowCasterVolume.m_inside, CullingVolumes::Mask(1u << 1u));
+		EXPECT_EQ(
+			cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{1000.f, 0.f, 0.f}, 1.f), insideShadowCasterVolume),
+			CullingVolumes::Visibility::ShadowCaster
+		);
+
+		// Without shadow caster volumes only the view frustum remains
+		cullingVolumes.Set(viewFrustum, {});
+		EXPECT_EQ(cullingVolumes.GetRootClassification().m_intersecting, CullingVolumes::ViewFrustumMask);
+		EXPECT_EQ(
+			cullingVolumes.GetVisibility(CreateBox(Math::Vector3f{60.f, 0.f, 50.f}, 1.f), cullingVolumes.GetRootClassification()),
+			CullingVolumes::Visibility::Hidden
+		);
+	}
+}
@@ -0,0 +1,188 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Scene/LightClusters.h>
+
+namespace ngine::Rendering::Tests
+{
+	[[nodiscard]] static LightClusters::Grid CreateGrid()
+	{
+		return LightClusters::Grid{Math::Vector2ui{16, 9}, 24, 0.1f, 500.f, Math::Vector2f{1.f, 0.5625f}};
+	}
+
+	//! Deterministic pseudo random lights spread through and around the view frustum
+	static void CreateLights(const uint32 count, Vector<LightClusters::LightBounds, uint32>& lights)
+	{
+		uint32 state = 0x12345678u;
+		const auto next = [&state]()
+		{
+			state = state * 1664525u + 1013904223u;
+			return (float)(state >> 8u) / (float)(1u << 24u);
+		};
+
+		for (uint32 index = 0; index < count; ++index)
+		{
+			const float depth = next() * 120.f - 5.f;
+			lights.EmplaceBack(LightClusters::LightBounds{
+				Math::Vector3f{(next() * 2.4f - 1.2f) * depth, (next() * 1.4f - 0.7f) * depth, depth},
+				0.05f + next() * next() * 8.f
+			});
+		}
+	}
+
+	UNIT_TEST(LightClusters, SliceDepths)
+	{
+		const LightClusters::Grid grid = CreateGrid();
+		EXPECT_NEAR(grid.GetSliceDepth(0), grid.m_nearPlane, 0.0001f);
+		EXPECT_EQ(grid.GetSliceDepth(grid.m_sliceCount), grid.m_farPlane);
+		for (uint32 sliceIndex = 0; sliceIndex < grid.m_sliceCount; ++sliceIndex)
+		{
+			EXPECT_LT(grid.GetSliceDepth(sliceIndex), grid.GetSliceDepth(sliceIndex + 1));
+		}
+	}
+
+	UNIT_TEST(LightClusters, MatchesBruteForce)
+	{
+		const LightClusters::Grid grid = CreateGrid();
+		Vector<LightClusters::LightBounds, uint32> lights;
+		CreateLights(2048, lights);
+
+		Vector<LightClusters::Cluster, uint32> clusters(Memory::ConstructWithSize, Memory::Zeroed, grid.GetClusterCount());
+		Vector<uint32, uint32> lightIndices;
+		LightClusters::Assign(grid, lights.GetView(), clusters.GetView(), lightIndices);
+
+		uint32 assignedCount = 0;
+		for (uint32 sliceIndex = 0; sliceIndex < grid.m_sliceCount; ++sliceIndex)
+		{
+			for (uint32 y = 0; y < grid.m_tileCount.y; ++y)
+			{
+				for (uint32 x = 0; x < grid.m_tileCount.x; ++x)
+				{
+					const LightClusters::ClusterBounds bounds = grid.GetClusterBounds(x, y, sliceIndex);
+					Vector<uint32, uint32> expectedLightIndices;
+					for (uint32 lightIndex = 0; lightIndex < lights.GetSize(); ++lightIndex)
+					{
+						if (LightClusters::Intersects(bounds, lights[lightIndex]))
+						{
+							expectedLightIndices.EmplaceBack(lightIndex);
+						}
+					}
+
+					const LightClusters::Cluster& cluster = clusters[grid.GetClusterIndex(x, y, sliceIndex)];
+					ASSERT_EQ(cluster.m_lightCount, expectedLightIndices.GetSize());
+					ASSERT_LE(cluster.m_firstLightIndex + cluster.m_lightCount, lightIndices.GetSize());
+					for (uint32 index = 0; index < cluster.m_lightCount; ++index)
+					{
+						EXPECT_EQ(lightIndices[cluster.m_firstLightIndex + index], expectedLightIndices[index]);
+					}
+					assignedCount += cluster.m_lightCount;
+				}
+			}
+		}
+
+		EXPECT_EQ(assignedCount, lightIndices.GetSize());
+		EXPECT_GT(assignedCount, 0u);
+	}
+
+	UNIT_TEST(LightClusters, SlicesAssignIndependently)
+	{
+		const LightClusters::Grid grid = CreateGrid();
+		Vector<LightClusters::LightBounds, uint32> lights;
+		CreateLights(256, lights);
+
+		Vector<LightClusters::Cluster, uint32> clusters(Memory::ConstructWithSize, Memory::Zeroed, grid.GetClusterCount());
+		Vector<uint32, uint32> lightIndices;
+		LightClusters::Assign(grid, lights.GetView(), clusters.GetView(), lightIndices);
+
+		// Assigning the slices out of order and appending them afterwards gives the same result
+		const uint32 sliceClusterCount = grid.GetSliceClusterCount();
+		Vector<LightClusters::Cluster, uint32> sliceClusters(Memory::ConstructWithSize, Memory::Zeroed, grid.GetClusterCount());
+		Vector<Vector<uint32, uint32>, uint32> sliceLightIndices(Memory::ConstructWithSize, Memory::DefaultConstruct, grid.m_sliceCount);
+		for (uint32 sliceIndex = grid.m_sliceCount; sliceIndex > 0; --sliceIndex)
+		{
+			LightClusters::AssignSlice(
+				grid,
+				lights.GetView(),
+				sliceIndex - 1,
+				sliceClusters.GetView().GetSubView((sliceIndex - 1) * sliceClusterCount, sliceClusterCount),
+				sliceLightIndices[sliceIndex - 1]
+			);
+		}
+
+		Vector<uint32, uint32> combinedLightIndices;
+		for (uint32 sliceIndex = 0; sliceIndex < grid.m_sliceCount; ++sliceIndex)
+		{
+			LightClusters::AppendSlice(
+				sliceClusters.GetView().GetSubView(sliceIndex * sliceClusterCount, sliceClusterCount),
+				sliceLightIndices[sliceIndex].GetView(),
+				combinedLightIndices
+			);
+		}
+
+		ASSERT_EQ(combinedLightIndices.GetSize(), lightIndices.GetSize());
+		for (uint32 index = 0; index < lightIndices.GetSize(); ++index)
+		{
+			EXPECT_EQ(combinedLightIndices[index], lightIndices[index]);
+		}
+		for (uint32 clusterIndex = 0; clusterIndex < clusters.GetSize(); ++clusterIndex)
+		{
+			EXPECT_EQ(sliceClusters[clusterIndex].m_firstLightIndex, clusters[clusterIndex].m_firstLightIndex);
+			EXPECT_EQ(sliceClusters[clusterIndex].m_lightCount, clusters[clusterIndex].m_lightCount);
+		}
+	}
+
+	UNIT_TEST(LightClusters, LightsOutsideFrustumAreSkipped)
+	{
+		const LightClusters::Grid grid = CreateGrid();
+		const Array<LightClusters::LightBounds, 2> lights{
+			// Behind the camera
+			LightClusters::LightBounds{Math::Vector3f{0.f, 0.f, -10.f}, 1.f},
+			// Beyond the far plane
+			LightClusters::LightBounds{Math::Vector3f{0.f, 0.f, 510.f}, 1.f}
+		};
+
+		Vector<LightClusters::Cluster, uint32> clusters(Memory::ConstructWithSize, Memory::Zeroed, grid.GetClusterCount());
+		Vector<uint32, uint32> lightIndices;
+		LightClusters::Assign(grid, lights.GetView(), clusters.GetView(), lightIndices);
+		EXPECT_EQ(lightIndices.GetSize(), 0u);
+	}
+
+	UNIT_TEST(LightClusters, LimitLightIndexCount)
+	{
+		const LightClusters::Grid grid = CreateGrid();
+		Vector<LightClusters::LightBounds, uint32> lights;
+		CreateLights(256, lights);
+
+		Vector<LightClusters::Cluster, uint32> clusters(Memory::ConstructWithSize, Memory::Zeroed, grid.GetClusterCount());
+		Vector<uint32, uint32> lightIndices;
+		LightClusters::Assign(grid, lights.GetView(), clusters.GetView(), lightIndices);
+		const Vector<LightClusters::Cluster, uint32> unlimitedClusters(clusters.GetView());
+		const Vector<uint32, uint32> unlimitedLightIndices(lightIndices.GetView());
+
+		const uint32 maximumCount = lightIndices.GetSize() / 2;
+		ASSERT_GT(maximumCount, 0u);
+		LightClusters::LimitLightIndexCount(clusters.GetView(), lightIndices, maximumCount);
+		EXPECT_EQ(lightIndices.GetSize(), maximumCount);
+
+		// Clusters keep the lights that fit, in the same order
+		for (uint32 clusterIndex = 0; clusterIndex < clusters.GetSize(); ++clusterIndex)
+		{
+			const LightClusters::Cluster& cluster = clusters[clusterIndex];
+			const LightClusters::Cluster& unlimitedCluster = unlimitedClusters[clusterIndex];
+			ASSERT_LE(cluster.m_firstLightIndex + cluster.m_lightCount, maximumCount);
+			ASSERT_LE(cluster.m_lightCount, unlimitedCluster.m_lightCount);
+			if (unlimitedCluster.m_firstLightIndex + unlimitedCluster.m_lightCount <= maximumCount)
+			{
+				EXPECT_EQ(cluster.m_firstLightIndex, unlimitedCluster.m_firstLightIndex);
+				EXPECT_EQ(cluster.m_lightCount, unlimitedCluster.m_lightCount);
+			}
+			for (uint32 index = 0; index < cluster.m_lightCount; ++index)
+			{
+				EXPECT_EQ(lightIndices[cluster.m_firstLightIndex + index], unlimitedLightIndices[unlimitedCluster.m_firstLightIndex + index]);
+			}
+		}
+	}
+}
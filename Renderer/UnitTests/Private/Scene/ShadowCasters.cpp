@@ -0,0 +1,69 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Storage/IdentifierMask.h>
+
+#include <Renderer/Scene/ShadowCasters.h>
+
+namespace ngine::Rendering::Tests
+{
+	[[nodiscard]] static ShadowCaster
+	CreateCaster(const uint32 instanceGroupIndex, const InstanceBuffer::InstanceIndexType instanceIndex, const uint32 renderItemIndex)
+	{
+		return ShadowCaster{instanceGroupIndex, instanceIndex, Entity::RenderItemIdentifier::MakeFromValidIndex(renderItemIndex)};
+	}
+
+	UNIT_TEST(ShadowCasters, SortByInstanceGroupAndInstance)
+	{
+		Vector<ShadowCaster, uint32> shadowCasters;
+		shadowCasters.EmplaceBack(CreateCaster(2, 0, 5));
+		shadowCasters.EmplaceBack(CreateCaster(1, 3, 1));
+		shadowCasters.EmplaceBack(CreateCaster(1, 1, 7));
+		shadowCasters.EmplaceBack(CreateCaster(0, 4, 2));
+		ShadowCasters::Sort(shadowCasters.GetView());
+
+		EXPECT_EQ(shadowCasters[0], CreateCaster(0, 4, 2));
+		EXPECT_EQ(shadowCasters[1], CreateCaster(1, 1, 7));
+		EXPECT_EQ(shadowCasters[2], CreateCaster(1, 3, 1));
+		EXPECT_EQ(shadowCasters[3], CreateCaster(2, 0, 5));
+	}
+
+	UNIT_TEST(ShadowCasters, CacheValidity)
+	{
+		Vector<ShadowCaster, uint32> cachedShadowCasters;
+		cachedShadowCasters.EmplaceBack(CreateCaster(0, 0, 1));
+		cachedShadowCasters.EmplaceBack(CreateCaster(0, 1, 2));
+		Entity::RenderItemMask removedRenderItems;
+
+		Vector<ShadowCaster, uint32> shadowCasters(cachedShadowCasters.GetView());
+		EXPECT_TRUE(ShadowCasters::IsCacheValid(cachedShadowCasters.GetView(), shadowCasters.GetView(), removedRenderItems));
+
+		// New caster
+		shadowCasters.EmplaceBack(CreateCaster(1, 0, 3));
+		EXPECT_FALSE(ShadowCasters::IsCacheValid(cachedShadowCasters.GetView(), shadowCasters.GetView(), removedRenderItems));
+		shadowCasters.PopBack();
+
+		// Another render item took over the instance of a removed one
+		shadowCasters[1] = CreateCaster(0, 1, 4);
+		EXPECT_FALSE(ShadowCasters::IsCacheValid(cachedShadowCasters.GetView(), shadowCasters.GetView(), removedRenderItems));
+	}
+
+	UNIT_TEST(ShadowCasters, RemovedRenderItemInvalidatesReusedIdentifiers)
+	{
+		Vector<ShadowCaster, uint32> cachedShadowCasters;
+		cachedShadowCasters.EmplaceBack(CreateCaster(0, 0, 1));
+		cachedShadowCasters.EmplaceBack(CreateCaster(3, 0, 2));
+
+		// Render item 2 was removed and a new render item reusing its identifier was placed in a reused instance group within the same frame
+		const Vector<ShadowCaster, uint32> shadowCasters(cachedShadowCasters.GetView());
+		Entity::RenderItemMask removedRenderItems;
+		removedRenderItems.Set(Entity::RenderItemIdentifier::MakeFromValidIndex(2));
+		EXPECT_FALSE(ShadowCasters::IsCacheValid(cachedShadowCasters.GetView(), shadowCasters.GetView(), removedRenderItems));
+
+		// Removals of render items the shadow map wasn't rendered with don't matter
+		Entity::RenderItemMask unrelatedRemovedRenderItems;
+		unrelatedRemovedRenderItems.Set(Entity::RenderItemIdentifier::MakeFromValidIndex(9));
+		EXPECT_TRUE(ShadowCasters::IsCacheValid(cachedShadowCasters.GetView(), shadowCasters.GetView(), unrelatedRemovedRenderItems));
+	}
+}
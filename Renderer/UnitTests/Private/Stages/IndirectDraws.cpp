@@ -0,0 +1,61 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+#include <Common/Memory/Containers/Vector.h>
+
+#include <Renderer/Stages/IndirectDraws.h>
+
+namespace ngine::Rendering::Tests
+{
+	static void ExpectArguments(
+		const DrawIndexedIndirectArguments& arguments, const uint32 indexCount, const uint32 instanceCount, const uint32 firstIndex
+	)
+	{
+		EXPECT_EQ(arguments.m_indexCount, indexCount);
+		EXPECT_EQ(arguments.m_instanceCount, instanceCount);
+		EXPECT_EQ(arguments.m_firstIndex, firstIndex);
+		EXPECT_EQ(arguments.m_vertexOffset, 0);
+		EXPECT_EQ(arguments.m_firstInstance, 0u);
+	}
+
+	UNIT_TEST(IndirectDraws, AppendFullMesh)
+	{
+		Vector<DrawIndexedIndirectArguments, uint32> arguments(Memory::ConstructWithSize, Memory::Zeroed, 4);
+		uint32 argumentCount = 1;
+		EXPECT_TRUE(IndirectDraws::AppendArguments(arguments.GetView(), argumentCount, {}, 96, 3));
+		EXPECT_EQ(argumentCount, 2u);
+		ExpectArguments(arguments[1], 96, 3, 0);
+	}
+
+	UNIT_TEST(IndirectDraws, AppendIndexRanges)
+	{
+		Vector<Math::Range<Index>, Index> indexRanges;
+		indexRanges.EmplaceBack(Math::Range<Index>::Make(12, 24));
+		indexRanges.EmplaceBack(Math::Range<Index>::Make(60, 6));
+
+		Vector<DrawIndexedIndirectArguments, uint32> arguments(Memory::ConstructWithSize, Memory::Zeroed, 4);
+		uint32 argumentCount = 0;
+		EXPECT_TRUE(IndirectDraws::AppendArguments(arguments.GetView(), argumentCount, indexRanges.GetView(), 96, 1));
+		EXPECT_EQ(argumentCount, 2u);
+		ExpectArguments(arguments[0], 24, 1, 12);
+		ExpectArguments(arguments[1], 6, 1, 60);
+	}
+
+	UNIT_TEST(IndirectDraws, RejectOverflow)
+	{
+		Vector<Math::Range<Index>, Index> indexRanges;
+		indexRanges.EmplaceBack(Math::Range<Index>::Make(0, 3));
+		indexRanges.EmplaceBack(Math::Range<Index>::Make(6, 3));
+		indexRanges.EmplaceBack(Math::Range<Index>::Make(12, 3));
+
+		Vector<DrawIndexedIndirectArguments, uint32> arguments(Memory::ConstructWithSize, Memory::Zeroed, 4);
+		uint32 argumentCount = 2;
+		EXPECT_FALSE(IndirectDraws::AppendArguments(arguments.GetView(), argumentCount, indexRanges.GetView(), 15, 1));
+		EXPECT_EQ(argumentCount, 2u);
+		ExpectArguments(arguments[2], 0, 0, 0);
+
+		argumentCount = 4;
+		EXPECT_FALSE(IndirectDraws::AppendArguments(arguments.GetView(), argumentCount, {}, 15, 1));
+		EXPECT_EQ(argumentCount, 4u);
+	}
+}